@@ -1011,6 +1011,79 @@ heap_deformtuple(HeapTuple tuple,
 	pfree(boolNulls);
 }
 
+/*
+ * Alignment, in bytes, that att_align_nominal enforces for attalign.
+ */
+static int
+attalign_bytes(char attalign)
+{
+	switch (attalign)
+	{
+		case 'i':
+			return ALIGNOF_INT;
+		case 'd':
+			return ALIGNOF_DOUBLE;
+		case 's':
+			return ALIGNOF_SHORT;
+		default:
+			return 1;
+	}
+}
+
+/*
+ * compute_deform_offsets
+ *		Fill in tupleDesc->tddeformoff for slot_deform_tuple's no-nulls path.
+ *
+ * The attributes are divided into runs of consecutive fixed-width columns,
+ * each run starting where the alignment requirement goes up (or after a
+ * variable-width column, which is never part of a run).  Since no column in
+ * a run needs stricter alignment than its first column, once the start of a
+ * run has been aligned the offset of every column relative to that start is
+ * the same in every tuple without nulls, even when the run follows a
+ * varlena.  So slot_deform_tuple need only align once per run, where the
+ * generic loop aligns for each column and gives up on cached offsets
+ * altogether after the first varlena.
+ *
+ * tddeformoff[i] is the offset of attribute i+1 from the start of its run
+ * (so 0 marks the first column of a run), or -1 for a variable-width
+ * column.
+ */
+static void
+compute_deform_offsets(TupleDesc tupleDesc)
+{
+	Form_pg_attribute *att = tupleDesc->attrs;
+	int		   *runoff = tupleDesc->tddeformoff;
+	int			runalign = 0;
+	int			attnum;
+
+	for (attnum = 0; attnum < tupleDesc->natts; attnum++)
+	{
+		Form_pg_attribute thisatt = att[attnum];
+		int			align = attalign_bytes(thisatt->attalign);
+
+		if (thisatt->attlen <= 0)
+		{
+			runoff[attnum] = -1;
+			runalign = 0;
+		}
+		else if (runalign == 0 || align > runalign)
+		{
+			runoff[attnum] = 0;
+			runalign = align;
+		}
+		else
+		{
+			Form_pg_attribute prevatt = att[attnum - 1];
+
+			runoff[attnum] = att_align_nominal(runoff[attnum - 1] +
+											   prevatt->attlen,
+											   thisatt->attalign);
+		}
+	}
+
+	tupleDesc->tddeformvalid = true;
+}
+
 /*
  * slot_deform_tuple
  *		Given a TupleTableSlot, extract data from the slot's physical tuple
@@ -1058,6 +1131,54 @@ slot_deform_tuple(TupleTableSlot *slot, int natts)
 
 	tp = (char *) tup + tup->t_hoff;
 
+	if (!hasnulls)
+	{
+		/*
+		 * Fast path for tuples without nulls, using the run offsets computed
+		 * by compute_deform_offsets.  If we're resuming in the middle of a
+		 * run, work back from the end of the previous column to the start of
+		 * the run.
+		 */
+		int		   *runoff;
+		long		runstart = 0;
+
+		if (!tupleDesc->tddeformvalid)
+			compute_deform_offsets(tupleDesc);
+		runoff = tupleDesc->tddeformoff;
+
+		if (attnum > 0 && attnum < natts && runoff[attnum] > 0)
+			runstart = off - runoff[attnum - 1] - att[attnum - 1]->attlen;
+
+		for (; attnum < natts; attnum++)
+		{
+			Form_pg_attribute thisatt = att[attnum];
+
+			isnull[attnum] = false;
+
+			if (runoff[attnum] >= 0)
+			{
+				if (runoff[attnum] == 0)
+					runstart = att_align_nominal(off, thisatt->attalign);
+				off = runstart + runoff[attnum];
+				values[attnum] = fetchatt(thisatt, tp + off);
+				off += thisatt->attlen;
+			}
+			else
+			{
+				off = att_align_pointer(off, thisatt->attalign,
+										thisatt->attlen, tp + off);
+				values[attnum] = fetchatt(thisatt, tp + off);
+				off = att_addlength_pointer(off, thisatt->attlen, tp + off);
+			}
+		}
+
+		/* tts_slow matters only for tuples with nulls */
+		slot->tts_nvalid = attnum;
+		slot->tts_off = off;
+		slot->tts_slow = true;
+		return;
+	}
+
 	for (; attnum < natts; attnum++)
 	{
 		Form_pg_attribute thisatt = att[attnum];
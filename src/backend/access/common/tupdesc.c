@@ -47,7 +47,8 @@ CreateTemplateTupleDesc(int natts, bool hasoid)
 
 	/*
 	 * Allocate enough memory for the tuple descriptor, including the
-	 * attribute rows, and set up the attribute row pointers.
+	 * attribute rows and the deforming offsets, and set up the attribute row
+	 * pointers.
 	 *
 	 * Note: we assume that sizeof(struct tupleDesc) is a multiple of the
 	 * struct pointer alignment requirement, and hence we don't need to insert
@@ -60,8 +61,11 @@ CreateTemplateTupleDesc(int natts, bool hasoid)
 	 */
 	attroffset = sizeof(struct tupleDesc) + natts * sizeof(Form_pg_attribute);
 	attroffset = MAXALIGN(attroffset);
-	stg = palloc(attroffset + natts * MAXALIGN(ATTRIBUTE_FIXED_PART_SIZE));
+	stg = palloc(attroffset + natts * MAXALIGN(ATTRIBUTE_FIXED_PART_SIZE) +
+				 natts * sizeof(int));
 	desc = (TupleDesc) stg;
+	desc->tddeformoff = (int *)
+		(stg + attroffset + natts * MAXALIGN(ATTRIBUTE_FIXED_PART_SIZE));
 
 	if (natts > 0)
 	{
@@ -89,6 +93,7 @@ CreateTemplateTupleDesc(int natts, bool hasoid)
 	desc->tdtypmod = -1;
 	desc->tdhasoid = hasoid;
 	desc->tdrefcount = -1;		/* assume not reference-counted */
+	desc->tddeformvalid = false;
 
 	return desc;
 }
@@ -114,7 +119,9 @@ CreateTupleDesc(int natts, bool hasoid, Form_pg_attribute *attrs)
 	 */
 	AssertArg(natts >= 0);
 
-	desc = (TupleDesc) palloc(sizeof(struct tupleDesc));
+	desc = (TupleDesc) palloc(sizeof(struct tupleDesc) + natts * sizeof(int));
+	desc->tddeformoff = (int *) ((char *) desc + sizeof(struct tupleDesc));
+	desc->tddeformvalid = false;
 	desc->attrs = attrs;
 	desc->natts = natts;
 	desc->constr = NULL;
@@ -467,6 +474,7 @@ TupleDescInitEntry(TupleDesc desc,
 	att->attstattarget = -1;
 	att->attcacheoff = -1;
 	att->atttypmod = typmod;
+	desc->tddeformvalid = false;
 
 	att->attnum = attributeNumber;
 	att->attndims = attdim;
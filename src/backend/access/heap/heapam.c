@@ -282,6 +282,26 @@ heapgetpage(HeapScanDesc scan, BlockNumber page)
 
 	LockBuffer(buffer, BUFFER_LOCK_UNLOCK);
 
+	/*
+	 * Let the caller's page filter weed out tuples it can reject cheaply.
+	 * The tuples stay put as long as we hold the pin, so the lock isn't
+	 * needed for this.  Rejected tuples still count as read, as they would
+	 * have if the caller had fetched and rejected them one by one.
+	 */
+	if (scan->rs_pagefilter != NULL && ntup > 0)
+	{
+		int			nkept;
+
+		nkept = (*scan->rs_pagefilter) (scan, dp, ntup,
+										scan->rs_pagefilter_arg);
+		Assert(nkept >= 0 && nkept <= ntup);
+		while (ntup > nkept)
+		{
+			pgstat_count_heap_getnext(scan->rs_rd);
+			ntup--;
+		}
+	}
+
 	Assert(ntup <= MaxHeapTuplesPerPage);
 	scan->rs_ntuples = ntup;
 }
@@ -1212,6 +1232,8 @@ heap_beginscan_internal(Relation relation, Snapshot snapshot,
 	scan->rs_strategy = NULL;	/* set in initscan */
 	scan->rs_allow_strat = allow_strat;
 	scan->rs_allow_sync = allow_sync;
+	scan->rs_pagefilter = NULL;
+	scan->rs_pagefilter_arg = NULL;
 
 	/*
 	 * we can use page-at-a-time mode if it's an MVCC-safe snapshot
@@ -1255,6 +1277,32 @@ heap_rescan(HeapScanDesc scan,
 	initscan(scan, key, true);
 }
 
+/* ----------------
+ *		heap_setpagefilter	- install a filter over each page's tuples
+ *
+ *		In page-at-a-time mode, heapgetpage collects the offsets of all the
+ *		visible tuples on a page before returning any of them.  A caller
+ *		that can test some of its quals more cheaply than by evaluating them
+ *		on each returned tuple can install a filter to drop non-matching
+ *		tuples from that array in one pass.  The filter must be installed
+ *		before the first heap_getnext and must reject the same tuples each
+ *		time a page is read, since heap_restrpos re-reads the marked page.
+ *		Returns false, installing nothing, if the scan isn't
+ *		being done a page at a time.
+ * ----------------
+ */
+bool
+heap_setpagefilter(HeapScanDesc scan, HeapPageFilterFunc filter, void *arg)
+{
+	if (!scan->rs_pageatatime)
+		return false;
+
+	Assert(!scan->rs_inited);
+	scan->rs_pagefilter = filter;
+	scan->rs_pagefilter_arg = arg;
+	return true;
+}
+
 /* ----------------
  *		heap_endscan	- end relation scan
  *
@@ -1981,7 +2029,8 @@ heap_insert(Relation relation, HeapTuple tup, CommandId cid,
 	/* Clear the bit in the visibility map if necessary */
 	if (all_visible_cleared)
 		visibilitymap_clear(relation,
-							ItemPointerGetBlockNumber(&(heaptup->t_self)));
+							ItemPointerGetBlockNumber(&(heaptup->t_self)),
+							VISIBILITYMAP_VALID_BITS);
 
 	/*
 	 * If tuple is cachable, mark it for invalidation from the caches in case
@@ -2280,7 +2329,8 @@ l1:
 
 	/* Clear the bit in the visibility map if necessary */
 	if (all_visible_cleared)
-		visibilitymap_clear(relation, BufferGetBlockNumber(buffer));
+		visibilitymap_clear(relation, BufferGetBlockNumber(buffer),
+							VISIBILITYMAP_VALID_BITS);
 
 	/* Now we can release the buffer */
 	ReleaseBuffer(buffer);
@@ -2811,9 +2861,11 @@ l2:
 
 	/* Clear bits in visibility map */
 	if (all_visible_cleared)
-		visibilitymap_clear(relation, BufferGetBlockNumber(buffer));
+		visibilitymap_clear(relation, BufferGetBlockNumber(buffer),
+							VISIBILITYMAP_VALID_BITS);
 	if (all_visible_cleared_new)
-		visibilitymap_clear(relation, BufferGetBlockNumber(newbuf));
+		visibilitymap_clear(relation, BufferGetBlockNumber(newbuf),
+							VISIBILITYMAP_VALID_BITS);
 
 	/* Now we can release the buffer(s) */
 	if (newbuf != buffer)
@@ -3078,6 +3130,7 @@ heap_lock_tuple(Relation relation, HeapTuple tuple, Buffer *buffer,
 	uint16		new_infomask;
 	LOCKMODE	tuple_lock_type;
 	bool		have_tuple_lock = false;
+	bool		all_frozen_cleared = false;
 
 	tuple_lock_type = (mode == LockTupleShared) ? ShareLock : ExclusiveLock;
 
@@ -3375,6 +3428,13 @@ l3:
 		new_infomask |= HEAP_XMAX_EXCL_LOCK;
 	}
 
+	/*
+	 * The page stays all-visible, but it's no longer all-frozen once our xid
+	 * is in it.  We clear the map bit below, after releasing the lock.
+	 */
+	if (PageIsAllVisible(page))
+		all_frozen_cleared = true;
+
 	START_CRIT_SECTION();
 
 	/*
@@ -3414,6 +3474,7 @@ l3:
 		xlrec.locking_xid = xid;
 		xlrec.xid_is_mxact = ((new_infomask & HEAP_XMAX_IS_MULTI) != 0);
 		xlrec.shared_lock = (mode == LockTupleShared);
+		xlrec.all_frozen_cleared = all_frozen_cleared;
 		rdata[0].data = (char *) &xlrec;
 		rdata[0].len = SizeOfHeapLock;
 		rdata[0].buffer = InvalidBuffer;
@@ -3436,9 +3497,12 @@ l3:
 	LockBuffer(*buffer, BUFFER_LOCK_UNLOCK);
 
 	/*
-	 * Don't update the visibility map here. Locking a tuple doesn't change
-	 * visibility info.
+	 * Locking a tuple doesn't change visibility info, so only the
+	 * all-frozen bit needs clearing.
 	 */
+	if (all_frozen_cleared)
+		visibilitymap_clear(relation, BufferGetBlockNumber(*buffer),
+							VISIBILITYMAP_ALL_FROZEN);
 
 	/*
 	 * Now that we have successfully marked the tuple as locked, we can
@@ -3709,6 +3773,32 @@ recheck_xvac:
 	return changed;
 }
 
+/*
+ * heap_tuple_is_frozen
+ *
+ * Check whether a tuple contains no normal transaction ID that could need
+ * freezing, so that it can't hold back relfrozenxid.  A MultiXactId in xmax
+ * is OK, since those are never frozen and aren't covered by relfrozenxid.
+ * VACUUM uses this after heap_freeze_tuple to decide whether a page may be
+ * marked all-frozen in the visibility map.
+ */
+bool
+heap_tuple_is_frozen(HeapTupleHeader tuple)
+{
+	if (TransactionIdIsNormal(HeapTupleHeaderGetXmin(tuple)))
+		return false;
+
+	if (!(tuple->t_infomask & HEAP_XMAX_IS_MULTI) &&
+		TransactionIdIsNormal(HeapTupleHeaderGetXmax(tuple)))
+		return false;
+
+	if ((tuple->t_infomask & HEAP_MOVED) &&
+		TransactionIdIsNormal(HeapTupleHeaderGetXvac(tuple)))
+		return false;
+
+	return true;
+}
+
 
 /* ----------------
  *		heap_markpos	- mark scan position
@@ -3965,6 +4055,42 @@ log_heap_freeze(Relation reln, Buffer buffer,
 	return recptr;
 }
 
+/*
+ * Perform XLogInsert for a heap-visible operation.  'block' is the block
+ * being marked all-visible (and maybe all-frozen), and vm_buffer is the
+ * buffer containing the corresponding visibility map page.  This is called
+ * by visibilitymap_set, which has already changed the map page.
+ */
+XLogRecPtr
+log_heap_visible(RelFileNode rnode, BlockNumber block, Buffer vm_buffer,
+				 TransactionId cutoff_xid, uint8 flags)
+{
+	xl_heap_visible xlrec;
+	XLogRecPtr	recptr;
+	XLogRecData rdata[2];
+
+	xlrec.node = rnode;
+	xlrec.block = block;
+	xlrec.cutoff_xid = cutoff_xid;
+	xlrec.flags = flags;
+
+	rdata[0].data = (char *) &xlrec;
+	rdata[0].len = SizeOfHeapVisible;
+	rdata[0].buffer = InvalidBuffer;
+	rdata[0].next = &(rdata[1]);
+
+	/* the map page isn't a standard-layout page, so back up all of it */
+	rdata[1].data = NULL;
+	rdata[1].len = 0;
+	rdata[1].buffer = vm_buffer;
+	rdata[1].buffer_std = false;
+	rdata[1].next = NULL;
+
+	recptr = XLogInsert(RM_HEAP2_ID, XLOG_HEAP2_VISIBLE, rdata);
+
+	return recptr;
+}
+
 /*
  * Perform XLogInsert for a heap-update operation.	Caller must already
  * have modified the buffer(s) and marked them dirty.
@@ -4242,6 +4368,70 @@ heap_xlog_freeze(XLogRecPtr lsn, XLogRecord *record)
 	UnlockReleaseBuffer(buffer);
 }
 
+/*
+ * Replay XLOG_HEAP2_VISIBLE record.
+ *
+ * The heap page's PD_ALL_VISIBLE flag is set here too, since setting it
+ * isn't WAL-logged by itself.  We don't bump the heap page's LSN, as that
+ * would cost a full-page image for every page vacuum marks all-visible.
+ */
+static void
+heap_xlog_visible(XLogRecPtr lsn, XLogRecord *record)
+{
+	xl_heap_visible *xlrec = (xl_heap_visible *) XLogRecGetData(record);
+	Buffer		buffer;
+	Page		page;
+
+	/*
+	 * Queries on the standby might later trust the map for the page, so
+	 * they must not be running with a snapshot that still considers some
+	 * tuple on it invisible.
+	 */
+	if (InHotStandby && TransactionIdIsValid(xlrec->cutoff_xid))
+		ResolveRecoveryConflictWithSnapshot(xlrec->cutoff_xid, xlrec->node);
+
+	/*
+	 * The heap page might have been dropped or truncated later in the WAL
+	 * sequence; in that case we've nothing to do for it, but we still set the
+	 * map bits below.  If the page's LSN is at or beyond ours, a later change
+	 * to it is already on disk, and the replay of that change will clear the
+	 * map bits again.
+	 */
+	buffer = XLogReadBufferExtended(xlrec->node, MAIN_FORKNUM, xlrec->block,
+									RBM_NORMAL);
+	if (BufferIsValid(buffer))
+	{
+		LockBuffer(buffer, BUFFER_LOCK_EXCLUSIVE);
+		page = (Page) BufferGetPage(buffer);
+
+		if (XLByteLT(PageGetLSN(page), lsn))
+		{
+			PageSetAllVisible(page);
+			MarkBufferDirty(buffer);
+		}
+
+		UnlockReleaseBuffer(buffer);
+	}
+
+	if (record->xl_info & XLR_BKP_BLOCK_1)
+		RestoreBkpBlocks(lsn, record, false);
+	else
+	{
+		Relation	reln = CreateFakeRelcacheEntry(xlrec->node);
+		Buffer		vmbuffer = InvalidBuffer;
+
+		visibilitymap_pin(reln, xlrec->block, &vmbuffer);
+
+		/* Don't set the bits if replay has already passed this point */
+		if (XLByteLT(PageGetLSN(BufferGetPage(vmbuffer)), lsn))
+			visibilitymap_set(reln, xlrec->block, lsn, &vmbuffer,
+							  xlrec->cutoff_xid, xlrec->flags);
+
+		ReleaseBuffer(vmbuffer);
+		FreeFakeRelcacheEntry(reln);
+	}
+}
+
 static void
 heap_xlog_newpage(XLogRecPtr lsn, XLogRecord *record)
 {
@@ -4287,7 +4477,7 @@ heap_xlog_delete(XLogRecPtr lsn, XLogRecord *record)
 	{
 		Relation	reln = CreateFakeRelcacheEntry(xlrec->target.node);
 
-		visibilitymap_clear(reln, blkno);
+		visibilitymap_clear(reln, blkno, VISIBILITYMAP_VALID_BITS);
 		FreeFakeRelcacheEntry(reln);
 	}
 
@@ -4365,7 +4555,7 @@ heap_xlog_insert(XLogRecPtr lsn, XLogRecord *record)
 	{
 		Relation	reln = CreateFakeRelcacheEntry(xlrec->target.node);
 
-		visibilitymap_clear(reln, blkno);
+		visibilitymap_clear(reln, blkno, VISIBILITYMAP_VALID_BITS);
 		FreeFakeRelcacheEntry(reln);
 	}
 
@@ -4478,7 +4668,8 @@ heap_xlog_update(XLogRecPtr lsn, XLogRecord *record, bool hot_update)
 		Relation	reln = CreateFakeRelcacheEntry(xlrec->target.node);
 
 		visibilitymap_clear(reln,
-							ItemPointerGetBlockNumber(&xlrec->target.tid));
+							ItemPointerGetBlockNumber(&xlrec->target.tid),
+							VISIBILITYMAP_VALID_BITS);
 		FreeFakeRelcacheEntry(reln);
 	}
 
@@ -4558,7 +4749,8 @@ newt:;
 	{
 		Relation	reln = CreateFakeRelcacheEntry(xlrec->target.node);
 
-		visibilitymap_clear(reln, ItemPointerGetBlockNumber(&xlrec->newtid));
+		visibilitymap_clear(reln, ItemPointerGetBlockNumber(&xlrec->newtid),
+							VISIBILITYMAP_VALID_BITS);
 		FreeFakeRelcacheEntry(reln);
 	}
 
@@ -4664,6 +4856,20 @@ heap_xlog_lock(XLogRecPtr lsn, XLogRecord *record)
 	ItemId		lp = NULL;
 	HeapTupleHeader htup;
 
+	/*
+	 * The visibility map may need to be fixed even if the heap page is
+	 * already up-to-date.
+	 */
+	if (xlrec->all_frozen_cleared)
+	{
+		Relation	reln = CreateFakeRelcacheEntry(xlrec->target.node);
+
+		visibilitymap_clear(reln,
+							ItemPointerGetBlockNumber(&(xlrec->target.tid)),
+							VISIBILITYMAP_ALL_FROZEN);
+		FreeFakeRelcacheEntry(reln);
+	}
+
 	if (record->xl_info & XLR_BKP_BLOCK_1)
 		return;
 
@@ -4824,6 +5030,9 @@ heap2_redo(XLogRecPtr lsn, XLogRecord *record)
 		case XLOG_HEAP2_CLEANUP_INFO:
 			heap_xlog_cleanup_info(lsn, record);
 			break;
+		case XLOG_HEAP2_VISIBLE:
+			heap_xlog_visible(lsn, record);
+			break;
 		default:
 			elog(PANIC, "heap2_redo: unknown op code %u", info);
 	}
@@ -4952,6 +5161,17 @@ heap2_desc(StringInfo buf, uint8 xl_info, char *rec)
 		appendStringInfo(buf, "cleanup info: remxid %u",
 						 xlrec->latestRemovedXid);
 	}
+	else if (info == XLOG_HEAP2_VISIBLE)
+	{
+		xl_heap_visible *xlrec = (xl_heap_visible *) rec;
+
+		appendStringInfo(buf, "visible: rel %u/%u/%u; blk %u; cutoff %u%s",
+						 xlrec->node.spcNode, xlrec->node.dbNode,
+						 xlrec->node.relNode, xlrec->block,
+						 xlrec->cutoff_xid,
+						 (xlrec->flags & VISIBILITYMAP_ALL_FROZEN) ?
+						 "; all frozen" : "");
+	}
 	else
 		appendStringInfo(buf, "UNKNOWN");
 }
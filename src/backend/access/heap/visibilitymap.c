@@ -11,34 +11,34 @@
  *	  $PostgreSQL$
  *
  * INTERFACE ROUTINES
- *		visibilitymap_clear - clear a bit in the visibility map
- *		visibilitymap_pin	- pin a map page for setting a bit
- *		visibilitymap_set	- set a bit in a previously pinned page
- *		visibilitymap_test	- test if a bit is set
+ *		visibilitymap_clear - clear bits in the visibility map
+ *		visibilitymap_pin	- pin a map page for setting bits
+ *		visibilitymap_set	- set bits in a previously pinned page
+ *		visibilitymap_test	- test if the all-visible bit is set
+ *		visibilitymap_get_status - get both bits for a heap page
+ *		visibilitymap_count  - count number of all-visible pages
  *
  * NOTES
  *
- * The visibility map is a bitmap with one bit per heap page. A set bit means
- * that all tuples on the page are known visible to all transactions, and
- * therefore the page doesn't need to be vacuumed. The map is conservative in
- * the sense that we make sure that whenever a bit is set, we know the
- * condition is true, but if a bit is not set, it might or might not be true.
+ * The visibility map is a bitmap with two bits per heap page. The first
+ * (all-visible) bit means that all tuples on the page are known visible to
+ * all transactions, and therefore the page doesn't need to be vacuumed. The
+ * second (all-frozen) bit, which is only ever set along with the first,
+ * additionally means that no tuple on the page contains an unfrozen
+ * transaction ID, so even an anti-wraparound vacuum can skip the page. The
+ * map is conservative in the sense that we make sure that whenever a bit is
+ * set, we know the condition is true, but if a bit is not set, it might or
+ * might not be true.
  *
- * There's no explicit WAL logging in the functions in this file. The callers
- * must make sure that whenever a bit is cleared, the bit is cleared on WAL
- * replay of the updating operation as well. Setting bits during recovery
- * isn't necessary for correctness.
+ * Setting bits is WAL-logged by visibilitymap_set, because a stale
+ * all-frozen bit that survived a crash could make VACUUM advance
+ * relfrozenxid past an unfrozen xid. Clearing bits isn't logged here; the
+ * callers must make sure that whenever a bit is cleared, the bit is cleared
+ * on WAL replay of the updating operation as well.
  *
- * Currently, the visibility map is only used as a hint, to speed up VACUUM.
- * A corrupted visibility map won't cause data corruption, although it can
- * make VACUUM skip pages that need vacuuming, until the next anti-wraparound
- * vacuum. The visibility map is not used for anti-wraparound vacuums, because
- * an anti-wraparound vacuum needs to freeze tuples and observe the latest xid
- * present in the table, even on pages that don't have any dead tuples.
- *
- * Although the visibility map is just a hint at the moment, the PD_ALL_VISIBLE
- * flag on heap pages *must* be correct, because it is used to skip visibility
- * checking.
+ * The all-visible bit is otherwise just a hint, used to let VACUUM skip
+ * pages.  The PD_ALL_VISIBLE flag on heap pages *must* be correct, because
+ * it is used to skip visibility checking.
  *
  * LOCKING
  *
@@ -59,37 +59,40 @@
  * But when a bit is cleared, we don't have to do that because it's always
  * safe to clear a bit in the map from correctness point of view.
  *
- * TODO
+ * Any modification that puts a new transaction ID on a page clears the
+ * all-frozen bit, including row locks, which don't affect visibility and so
+ * leave the all-visible bit alone.
  *
- * It would be nice to use the visibility map to skip visibility checks in
- * index scans.
+ * Index-only scans use the all-visible bit to skip fetching the heap tuple
+ * altogether, so the bit must never be set when some tuple on the page is
+ * invisible to some snapshot.
  *
- * Currently, the visibility map is not 100% correct all the time.
  * During updates, the bit in the visibility map is cleared after releasing
  * the lock on the heap page. During the window between releasing the lock
  * and clearing the bit in the visibility map, the bit in the visibility map
  * is set, but the new insertion or deletion is not yet visible to other
- * backends.
- *
- * That might actually be OK for the index scans, though. The newly inserted
- * tuple wouldn't have an index pointer yet, so all tuples reachable from an
- * index would still be visible to all other backends, and deletions wouldn't
- * be visible to other backends yet.  (But HOT breaks that argument, no?)
- *
- * There's another hole in the way the PD_ALL_VISIBLE flag is set. When
- * vacuum observes that all tuples are visible to all, it sets the flag on
- * the heap page, and also sets the bit in the visibility map. If we then
- * crash, and only the visibility map page was flushed to disk, we'll have
- * a bit set in the visibility map, but the corresponding flag on the heap
- * page is not set. If the heap page is then updated, the updater won't
- * know to clear the bit in the visibility map.  (Isn't that prevented by
- * the LSN interlock?)
+ * backends.  That is OK for index-only scans: the bit is always cleared
+ * before heap_insert, heap_update or heap_delete returns, which is before
+ * the modifying transaction can commit and before it inserts any index
+ * entries pointing to the new tuple.  A HOT update doesn't change any
+ * indexed column, so an index-only scan that still sees the bit set returns
+ * exactly what the old, still visible, tuple version contains.
+ * The window is harmless for the all-frozen bit too: any xid stored on the
+ * page meanwhile belongs to a running transaction, so it's newer than any
+ * freeze cutoff a concurrent VACUUM could be using.
+ *
+ * Replay of the WAL record written when bits are set also sets the
+ * PD_ALL_VISIBLE flag on the heap page, so a crash can't leave a bit set
+ * in the map while the heap page has lost its flag.  (An updater would not
+ * know to clear the map bit in that case.)
  *
  *-------------------------------------------------------------------------
  */
 #include "postgres.h"
 
+#include "access/heapam.h"
 #include "access/visibilitymap.h"
+#include "miscadmin.h"
 #include "storage/bufmgr.h"
 #include "storage/bufpage.h"
 #include "storage/lmgr.h"
@@ -106,10 +109,10 @@
 #define MAPSIZE (BLCKSZ - MAXALIGN(SizeOfPageHeaderData))
 
 /* Number of bits allocated for each heap block. */
-#define BITS_PER_HEAPBLOCK 1
+#define BITS_PER_HEAPBLOCK 2
 
 /* Number of heap blocks we can represent in one byte. */
-#define HEAPBLOCKS_PER_BYTE 8
+#define HEAPBLOCKS_PER_BYTE (BITS_PER_BYTE / BITS_PER_HEAPBLOCK)
 
 /* Number of heap blocks we can represent in one visibility map page. */
 #define HEAPBLOCKS_PER_PAGE (MAPSIZE * HEAPBLOCKS_PER_BYTE)
@@ -117,7 +120,7 @@
 /* Mapping from heap block number to the right bit in the visibility map */
 #define HEAPBLK_TO_MAPBLOCK(x) ((x) / HEAPBLOCKS_PER_PAGE)
 #define HEAPBLK_TO_MAPBYTE(x) (((x) % HEAPBLOCKS_PER_PAGE) / HEAPBLOCKS_PER_BYTE)
-#define HEAPBLK_TO_MAPBIT(x) ((x) % HEAPBLOCKS_PER_BYTE)
+#define HEAPBLK_TO_OFFSET(x) (((x) % HEAPBLOCKS_PER_BYTE) * BITS_PER_HEAPBLOCK)
 
 /* prototypes for internal routines */
 static Buffer vm_readbuf(Relation rel, BlockNumber blkno, bool extend);
@@ -125,23 +128,28 @@ static void vm_extend(Relation rel, BlockNumber nvmblocks);
 
 
 /*
- *	visibilitymap_clear - clear a bit in visibility map
+ *	visibilitymap_clear - clear bits in visibility map
  *
- * Clear a bit in the visibility map, marking that not all tuples are
- * visible to all transactions anymore.
+ * Clear the given bits for heapBlk in the visibility map: normally both,
+ * marking that not all tuples are visible to all transactions anymore, or
+ * just VISIBILITYMAP_ALL_FROZEN when a new xid was stored on the page
+ * without affecting visibility.
  */
 void
-visibilitymap_clear(Relation rel, BlockNumber heapBlk)
+visibilitymap_clear(Relation rel, BlockNumber heapBlk, uint8 flags)
 {
 	BlockNumber mapBlock = HEAPBLK_TO_MAPBLOCK(heapBlk);
 	int			mapByte = HEAPBLK_TO_MAPBYTE(heapBlk);
-	int			mapBit = HEAPBLK_TO_MAPBIT(heapBlk);
-	uint8		mask = 1 << mapBit;
+	int			mapOffset = HEAPBLK_TO_OFFSET(heapBlk);
+	uint8		mask = flags << mapOffset;
 	Buffer		mapBuffer;
 	char	   *map;
 
+	Assert(flags != 0 && (flags & ~VISIBILITYMAP_VALID_BITS) == 0);
+
 #ifdef TRACE_VISIBILITYMAP
-	elog(DEBUG1, "vm_clear %s %d", RelationGetRelationName(rel), heapBlk);
+	elog(DEBUG1, "vm_clear %s %d %x", RelationGetRelationName(rel), heapBlk,
+		 flags);
 #endif
 
 	mapBuffer = vm_readbuf(rel, mapBlock, false);
@@ -162,13 +170,13 @@ visibilitymap_clear(Relation rel, BlockNumber heapBlk)
 }
 
 /*
- *	visibilitymap_pin - pin a map page for setting a bit
+ *	visibilitymap_pin - pin a map page for setting bits
  *
- * Setting a bit in the visibility map is a two-phase operation. First, call
+ * Setting bits in the visibility map is a two-phase operation. First, call
  * visibilitymap_pin, to pin the visibility map page containing the bit for
  * the heap page. Because that can require I/O to read the map page, you
  * shouldn't hold a lock on the heap page while doing that. Then, call
- * visibilitymap_set to actually set the bit.
+ * visibilitymap_set to actually set the bits.
  *
  * On entry, *buf should be InvalidBuffer or a valid buffer returned by
  * an earlier call to visibilitymap_pin or visibilitymap_test on the same
@@ -194,28 +202,39 @@ visibilitymap_pin(Relation rel, BlockNumber heapBlk, Buffer *buf)
 }
 
 /*
- *	visibilitymap_set - set a bit on a previously pinned page
+ *	visibilitymap_set - set bits on a previously pinned page
  *
- * recptr is the LSN of the heap page. The LSN of the visibility map page is
- * advanced to that, to make sure that the visibility map doesn't get flushed
- * to disk before the update to the heap page that made all tuples visible.
+ * flags is VISIBILITYMAP_ALL_VISIBLE, possibly together with
+ * VISIBILITYMAP_ALL_FROZEN.  The caller must hold at least a share lock on
+ * the heap page, and have set its PD_ALL_VISIBLE flag.
+ *
+ * Normally recptr is invalid, and we write a WAL record for the
+ * change; cutoff_xid is put in it for hot standby conflict resolution, and
+ * should be the newest xmin on the page (or InvalidTransactionId if there
+ * is none).  During recovery, recptr is the LSN of the record being
+ * replayed.  Either way the LSN of the map page is advanced, so that it
+ * doesn't get flushed to disk before the record.
  *
  * This is an opportunistic function. It does nothing, unless *buf
- * contains the bit for heapBlk. Call visibilitymap_pin first to pin
+ * contains the bits for heapBlk. Call visibilitymap_pin first to pin
  * the right map page. This function doesn't do any I/O.
  */
 void
 visibilitymap_set(Relation rel, BlockNumber heapBlk, XLogRecPtr recptr,
-				  Buffer *buf)
+				  Buffer *buf, TransactionId cutoff_xid, uint8 flags)
 {
 	BlockNumber mapBlock = HEAPBLK_TO_MAPBLOCK(heapBlk);
 	uint32		mapByte = HEAPBLK_TO_MAPBYTE(heapBlk);
-	uint8		mapBit = HEAPBLK_TO_MAPBIT(heapBlk);
+	uint8		mapOffset = HEAPBLK_TO_OFFSET(heapBlk);
 	Page		page;
 	char	   *map;
 
+	Assert(flags & VISIBILITYMAP_ALL_VISIBLE);
+	Assert((flags & ~VISIBILITYMAP_VALID_BITS) == 0);
+
 #ifdef TRACE_VISIBILITYMAP
-	elog(DEBUG1, "vm_set %s %d", RelationGetRelationName(rel), heapBlk);
+	elog(DEBUG1, "vm_set %s %d %x", RelationGetRelationName(rel), heapBlk,
+		 flags);
 #endif
 
 	/* Check that we have the right page pinned */
@@ -226,21 +245,30 @@ visibilitymap_set(Relation rel, BlockNumber heapBlk, XLogRecPtr recptr,
 	map = PageGetContents(page);
 	LockBuffer(*buf, BUFFER_LOCK_EXCLUSIVE);
 
-	if (!(map[mapByte] & (1 << mapBit)))
+	if (flags != ((map[mapByte] >> mapOffset) & flags))
 	{
-		map[mapByte] |= (1 << mapBit);
+		START_CRIT_SECTION();
 
-		if (XLByteLT(PageGetLSN(page), recptr))
-			PageSetLSN(page, recptr);
-		PageSetTLI(page, ThisTimeLineID);
+		map[mapByte] |= (flags << mapOffset);
 		MarkBufferDirty(*buf);
+
+		if (!rel->rd_istemp)
+		{
+			if (XLogRecPtrIsInvalid(recptr))
+				recptr = log_heap_visible(rel->rd_node, heapBlk, *buf,
+										  cutoff_xid, flags);
+			PageSetLSN(page, recptr);
+			PageSetTLI(page, ThisTimeLineID);
+		}
+
+		END_CRIT_SECTION();
 	}
 
 	LockBuffer(*buf, BUFFER_LOCK_UNLOCK);
 }
 
 /*
- *	visibilitymap_test - test if a bit is set
+ *	visibilitymap_test - test if the all-visible bit is set
  *
  * Are all tuples on heapBlk visible to all, according to the visibility map?
  *
@@ -252,15 +280,29 @@ visibilitymap_set(Relation rel, BlockNumber heapBlk, XLogRecPtr recptr,
  */
 bool
 visibilitymap_test(Relation rel, BlockNumber heapBlk, Buffer *buf)
+{
+	return (visibilitymap_get_status(rel, heapBlk, buf) &
+			VISIBILITYMAP_ALL_VISIBLE) != 0;
+}
+
+/*
+ *	visibilitymap_get_status - get status of bits
+ *
+ * Returns the visibility map bits for heapBlk, as a combination of
+ * VISIBILITYMAP_ALL_VISIBLE and VISIBILITYMAP_ALL_FROZEN.  *buf is handled
+ * as in visibilitymap_test.
+ */
+uint8
+visibilitymap_get_status(Relation rel, BlockNumber heapBlk, Buffer *buf)
 {
 	BlockNumber mapBlock = HEAPBLK_TO_MAPBLOCK(heapBlk);
 	uint32		mapByte = HEAPBLK_TO_MAPBYTE(heapBlk);
-	uint8		mapBit = HEAPBLK_TO_MAPBIT(heapBlk);
-	bool		result;
+	uint8		mapOffset = HEAPBLK_TO_OFFSET(heapBlk);
+	uint8		result;
 	char	   *map;
 
 #ifdef TRACE_VISIBILITYMAP
-	elog(DEBUG1, "vm_test %s %d", RelationGetRelationName(rel), heapBlk);
+	elog(DEBUG1, "vm_get_status %s %d", RelationGetRelationName(rel), heapBlk);
 #endif
 
 	/* Reuse the old pinned buffer if possible */
@@ -277,15 +319,71 @@ visibilitymap_test(Relation rel, BlockNumber heapBlk, Buffer *buf)
 	{
 		*buf = vm_readbuf(rel, mapBlock, false);
 		if (!BufferIsValid(*buf))
-			return false;
+			return 0;
 	}
 
 	map = PageGetContents(BufferGetPage(*buf));
 
 	/*
-	 * We don't need to lock the page, as we're only looking at a single bit.
+	 * We don't need to lock the page, as we're only looking at a single
+	 * byte, which is read atomically.
 	 */
-	result = (map[mapByte] & (1 << mapBit)) ? true : false;
+	result = (map[mapByte] >> mapOffset) & VISIBILITYMAP_VALID_BITS;
+
+	return result;
+}
+
+/*
+ *	visibilitymap_count	 - count number of bits set in visibility map
+ *
+ * Returns the number of heap pages marked all-visible.  Note: we ignore
+ * the possibility of race conditions when the table is being extended
+ * concurrently with the call.  New pages added to the table aren't going
+ * to be marked all-visible, so they won't affect the result.
+ */
+BlockNumber
+visibilitymap_count(Relation rel)
+{
+	BlockNumber result = 0;
+	BlockNumber mapBlock;
+
+	for (mapBlock = 0;; mapBlock++)
+	{
+		Buffer		mapBuffer;
+		unsigned char *map;
+		int			i;
+
+		/*
+		 * Read till we fall off the end of the map.  We assume that any extra
+		 * bytes in the last page are zeroed, so we don't bother excluding
+		 * them from the count.
+		 */
+		mapBuffer = vm_readbuf(rel, mapBlock, false);
+		if (!BufferIsValid(mapBuffer))
+			break;
+
+		/*
+		 * We choose not to lock the page, since the result is going to be
+		 * immediately stale anyway if anyone is concurrently setting or
+		 * clearing bits, and we only really need an approximate value.
+		 */
+		map = (unsigned char *) PageGetContents(BufferGetPage(mapBuffer));
+
+		for (i = 0; i < MAPSIZE; i++)
+		{
+			uint8		byte = map[i];
+			int			j;
+
+			for (j = 0; j < HEAPBLOCKS_PER_BYTE; j++)
+			{
+				if (byte & VISIBILITYMAP_ALL_VISIBLE)
+					result++;
+				byte >>= BITS_PER_HEAPBLOCK;
+			}
+		}
+
+		ReleaseBuffer(mapBuffer);
+	}
 
 	return result;
 }
@@ -304,10 +402,10 @@ visibilitymap_truncate(Relation rel, BlockNumber nheapblocks)
 {
 	BlockNumber newnblocks;
 
-	/* last remaining block, byte, and bit */
+	/* last remaining block, byte, and bits */
 	BlockNumber truncBlock = HEAPBLK_TO_MAPBLOCK(nheapblocks);
 	uint32		truncByte = HEAPBLK_TO_MAPBYTE(nheapblocks);
-	uint8		truncBit = HEAPBLK_TO_MAPBIT(nheapblocks);
+	uint8		truncOffset = HEAPBLK_TO_OFFSET(nheapblocks);
 
 #ifdef TRACE_VISIBILITYMAP
 	elog(DEBUG1, "vm_truncate %s %d", RelationGetRelationName(rel), nheapblocks);
@@ -329,7 +427,7 @@ visibilitymap_truncate(Relation rel, BlockNumber nheapblocks)
 	 * because we don't get a chance to clear the bits if the heap is extended
 	 * again.
 	 */
-	if (truncByte != 0 || truncBit != 0)
+	if (truncByte != 0 || truncOffset != 0)
 	{
 		Buffer		mapBuffer;
 		Page		page;
@@ -355,10 +453,10 @@ visibilitymap_truncate(Relation rel, BlockNumber nheapblocks)
 		/*
 		 * Mask out the unwanted bits of the last remaining byte.
 		 *
-		 * ((1 << 0) - 1) = 00000000 ((1 << 1) - 1) = 00000001 ... ((1 << 6) -
-		 * 1) = 00111111 ((1 << 7) - 1) = 01111111
+		 * ((1 << 0) - 1) = 00000000 ((1 << 2) - 1) = 00000011 ((1 << 4) -
+		 * 1) = 00001111 ((1 << 6) - 1) = 00111111
 		 */
-		map[truncByte] &= (1 << truncBit) - 1;
+		map[truncByte] &= (1 << truncOffset) - 1;
 
 		MarkBufferDirty(mapBuffer);
 		UnlockReleaseBuffer(mapBuffer);
@@ -247,6 +247,17 @@ btgettuple(PG_FUNCTION_ARGS)
 	/* btree indexes are never lossy */
 	scan->xs_recheck = false;
 
+	/*
+	 * If the caller wants index tuples returned, set up the workspaces to
+	 * hold copies of them.  The caller sets xs_want_itup only after starting
+	 * the scan, so we can't do this any earlier.
+	 */
+	if (scan->xs_want_itup && so->currTuples == NULL)
+	{
+		so->currTuples = (char *) palloc(BLCKSZ * 2);
+		so->markTuples = so->currTuples + BLCKSZ;
+	}
+
 	/*
 	 * If we've already initialized this scan, we can just advance it in the
 	 * appropriate direction.  If we haven't done so yet, we call a routine to
@@ -369,6 +380,7 @@ btrescan(PG_FUNCTION_ARGS)
 			so->keyData = NULL;
 		so->killedItems = NULL; /* until needed */
 		so->numKilled = 0;
+		so->currTuples = so->markTuples = NULL; /* until needed */
 		scan->opaque = so;
 	}
 
@@ -430,6 +442,9 @@ btendscan(PG_FUNCTION_ARGS)
 
 	if (so->killedItems != NULL)
 		pfree(so->killedItems);
+	if (so->currTuples != NULL)
+		pfree(so->currTuples);
+	/* so->markTuples should not be pfree'd, see btgettuple */
 	if (so->keyData != NULL)
 		pfree(so->keyData);
 	pfree(so);
@@ -504,6 +519,9 @@ btrestrpos(PG_FUNCTION_ARGS)
 			memcpy(&so->currPos, &so->markPos,
 				   offsetof(BTScanPosData, items[1]) +
 				   so->markPos.lastItem * sizeof(BTScanPosItem));
+			if (so->currTuples)
+				memcpy(so->currTuples, so->markTuples,
+					   so->markPos.nextTupleOffset);
 		}
 	}
 
@@ -31,6 +31,7 @@
 #include "access/slru.h"
 #include "access/subtrans.h"
 #include "access/transam.h"
+#include "access/xlog.h"
 #include "pg_trace.h"
 #include "utils/snapmgr.h"
 
@@ -62,8 +63,49 @@ static SlruCtlData SubTransCtlData;
 #define SubTransCtl  (&SubTransCtlData)
 
 
+/*
+ * Backend-local cache of recent SubTransGetTopmostTransaction() results.
+ *
+ * A subtransaction's parent never changes once it has been recorded, so a
+ * lookup result can be remembered for as long as the XID is of interest.
+ * This matters when some backend has overflowed its subxid cache: every
+ * snapshot check of an XID belonging to it then has to consult pg_subtrans,
+ * and the same handful of XIDs tend to be checked over and over (one per
+ * tuple they inserted or deleted).  The cache is direct-mapped on the low
+ * bits of the XID; an entry whose xid is InvalidTransactionId is empty.
+ * Entries are only made outside recovery, see SubTransGetTopmostTransaction.
+ *
+ * An XID value is reused after wraparound, so an entry must not outlive the
+ * XID it describes.  That XID stops being of interest once TransactionXmin
+ * passes it, so we remember the oldest XID entered (as a 64-bit value
+ * including the epoch, so that comparisons can't be fooled by wraparound)
+ * and empty the whole cache when TransactionXmin moves beyond it.
+ */
+#define SUBTRANS_TOPMOST_CACHE_SIZE 256		/* must be a power of 2 */
+
+typedef struct SubTransTopmostCacheEntry
+{
+	TransactionId xid;			/* subtransaction looked up */
+	TransactionId topxid;		/* its topmost parent (as far as known) */
+} SubTransTopmostCacheEntry;
+
+static SubTransTopmostCacheEntry topmostCache[SUBTRANS_TOPMOST_CACHE_SIZE];
+
+/* TransactionXmin the cache was last checked against, and its full value */
+static TransactionId topmostCacheXmin = InvalidTransactionId;
+static uint64 topmostCacheXminFull = 0;
+
+/* Oldest XID (with epoch) entered since the cache was last emptied */
+static uint64 topmostCacheOldest = 0;
+static bool topmostCacheEmpty = true;
+
+#define TopmostCacheSlot(xid) \
+	(&topmostCache[(xid) & (SUBTRANS_TOPMOST_CACHE_SIZE - 1)])
+
+
 static int	ZeroSUBTRANSPage(int pageno);
 static bool SubTransPagePrecedes(int page1, int page2);
+static void TopmostCacheCheckXmin(void);
 
 
 /*
@@ -141,16 +183,30 @@ SubTransGetParent(TransactionId xid)
  * we only care about detecting whether the topmost parent is still running
  * or is part of a current snapshot's list of still-running transactions.
  * Therefore, any XID before TransactionXmin is as good as any other.
+ * For the same reason it is safe to hand back a result remembered in the
+ * backend-local cache: TransactionXmin only moves forward, so an answer
+ * that stopped short of the true topmost parent remains good enough.
  */
 TransactionId
 SubTransGetTopmostTransaction(TransactionId xid)
 {
+	SubTransTopmostCacheEntry *entry;
 	TransactionId parentXid = xid,
 				previousXid = xid;
 
 	/* Can't ask about stuff that might not be around anymore */
 	Assert(TransactionIdFollowsOrEquals(xid, TransactionXmin));
 
+	/* Bootstrap and frozen XIDs have no parent, and are never cached */
+	if (!TransactionIdIsNormal(xid))
+		return xid;
+
+	TopmostCacheCheckXmin();
+
+	entry = TopmostCacheSlot(xid);
+	if (TransactionIdEquals(entry->xid, xid))
+		return entry->topxid;
+
 	while (TransactionIdIsValid(parentXid))
 	{
 		previousXid = parentXid;
@@ -161,9 +217,60 @@ SubTransGetTopmostTransaction(TransactionId xid)
 
 	Assert(TransactionIdIsValid(previousXid));
 
+	/*
+	 * During recovery the parent link of a subxact may be replayed only after
+	 * tuples carrying its XID, so an answer obtained now could go stale.
+	 * Don't remember anything until we are out of recovery.
+	 */
+	if (!RecoveryInProgress())
+	{
+		uint64		fullXid;
+
+		/* xid follows TransactionXmin, so it is in the same epoch or later */
+		fullXid = topmostCacheXminFull + (uint32) (xid - TransactionXmin);
+		if (topmostCacheEmpty || fullXid < topmostCacheOldest)
+			topmostCacheOldest = fullXid;
+		topmostCacheEmpty = false;
+
+		entry->xid = xid;
+		entry->topxid = previousXid;
+	}
+
 	return previousXid;
 }
 
+/*
+ * TopmostCacheCheckXmin
+ *
+ * Empty the topmost-parent cache if TransactionXmin has advanced past the
+ * oldest XID in it, since that XID value may since have been reused.  The
+ * epoch lookup is only needed when TransactionXmin has changed, which is
+ * at most once per snapshot.
+ */
+static void
+TopmostCacheCheckXmin(void)
+{
+	TransactionId nextXid;
+	uint32		epoch;
+
+	if (TransactionIdEquals(TransactionXmin, topmostCacheXmin))
+		return;
+
+	GetNextXidAndEpoch(&nextXid, &epoch);
+
+	/* TransactionXmin precedes nextXid, so if it's larger it wrapped */
+	if (TransactionXmin > nextXid)
+		epoch--;
+	topmostCacheXmin = TransactionXmin;
+	topmostCacheXminFull = ((uint64) epoch << 32) | TransactionXmin;
+
+	if (!topmostCacheEmpty && topmostCacheOldest < topmostCacheXminFull)
+	{
+		MemSet(topmostCache, 0, sizeof(topmostCache));
+		topmostCacheEmpty = true;
+	}
+}
+
 
 /*
  * Initialization of shared memory for SUBTRANS
@@ -0,0 +1,1888 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+/* Substitute the variable and function names.  */
+#define yyparse         boot_yyparse
+#define yylex           boot_yylex
+#define yyerror         boot_yyerror
+#define yydebug         boot_yydebug
+#define yynerrs         boot_yynerrs
+#define yylval          boot_yylval
+#define yychar          boot_yychar
+
+/* First part of user prologue.  */
+#line 1 "bootparse.y"
+
+/*-------------------------------------------------------------------------
+ *
+ * bootparse.y
+ *	  yacc grammar for the "bootstrap" mode (BKI file format)
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *	  $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#include "postgres.h"
+
+#include <unistd.h>
+
+#include "access/attnum.h"
+#include "access/htup.h"
+#include "access/itup.h"
+#include "access/skey.h"
+#include "access/tupdesc.h"
+#include "access/xact.h"
+#include "bootstrap/bootstrap.h"
+#include "catalog/catalog.h"
+#include "catalog/heap.h"
+#include "catalog/pg_am.h"
+#include "catalog/pg_attribute.h"
+#include "catalog/pg_authid.h"
+#include "catalog/pg_class.h"
+#include "catalog/pg_namespace.h"
+#include "catalog/pg_tablespace.h"
+#include "catalog/toasting.h"
+#include "commands/defrem.h"
+#include "miscadmin.h"
+#include "nodes/makefuncs.h"
+#include "nodes/nodes.h"
+#include "nodes/parsenodes.h"
+#include "nodes/pg_list.h"
+#include "nodes/primnodes.h"
+#include "rewrite/prs2lock.h"
+#include "storage/block.h"
+#include "storage/fd.h"
+#include "storage/ipc.h"
+#include "storage/itemptr.h"
+#include "storage/off.h"
+#include "storage/smgr.h"
+#include "tcop/dest.h"
+#include "utils/rel.h"
+
+#define atooid(x)	((Oid) strtoul((x), NULL, 10))
+
+
+/*
+ * Bison doesn't allocate anything that needs to live across parser calls,
+ * so we can easily have it use palloc instead of malloc.  This prevents
+ * memory leaks if we error out during parsing.  Note this only works with
+ * bison >= 2.0.  However, in bison 1.875 the default is to use alloca()
+ * if possible, so there's not really much problem anyhow, at least if
+ * you're building with gcc.
+ */
+#define YYMALLOC palloc
+#define YYFREE   pfree
+
+static void
+do_start(void)
+{
+	StartTransactionCommand();
+	elog(DEBUG4, "start transaction");
+}
+
+
+static void
+do_end(void)
+{
+	CommitTransactionCommand();
+	elog(DEBUG4, "commit transaction");
+	CHECK_FOR_INTERRUPTS();		/* allow SIGINT to kill bootstrap run */
+	if (isatty(0))
+	{
+		printf("bootstrap> ");
+		fflush(stdout);
+	}
+}
+
+
+static int num_columns_read = 0;
+
+
+#line 171 "bootparse.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int boot_yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    CONST_P = 258,                 /* CONST_P  */
+    ID = 259,                      /* ID  */
+    OPEN = 260,                    /* OPEN  */
+    XCLOSE = 261,                  /* XCLOSE  */
+    XCREATE = 262,                 /* XCREATE  */
+    INSERT_TUPLE = 263,            /* INSERT_TUPLE  */
+    XDECLARE = 264,                /* XDECLARE  */
+    INDEX = 265,                   /* INDEX  */
+    ON = 266,                      /* ON  */
+    USING = 267,                   /* USING  */
+    XBUILD = 268,                  /* XBUILD  */
+    INDICES = 269,                 /* INDICES  */
+    UNIQUE = 270,                  /* UNIQUE  */
+    XTOAST = 271,                  /* XTOAST  */
+    COMMA = 272,                   /* COMMA  */
+    EQUALS = 273,                  /* EQUALS  */
+    LPAREN = 274,                  /* LPAREN  */
+    RPAREN = 275,                  /* RPAREN  */
+    OBJ_ID = 276,                  /* OBJ_ID  */
+    XBOOTSTRAP = 277,              /* XBOOTSTRAP  */
+    XSHARED_RELATION = 278,        /* XSHARED_RELATION  */
+    XWITHOUT_OIDS = 279,           /* XWITHOUT_OIDS  */
+    XROWTYPE_OID = 280,            /* XROWTYPE_OID  */
+    NULLVAL = 281,                 /* NULLVAL  */
+    low = 282,                     /* low  */
+    high = 283                     /* high  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 98 "bootparse.y"
+
+	List		*list;
+	IndexElem	*ielem;
+	char		*str;
+	int			ival;
+	Oid			oidval;
+
+#line 254 "bootparse.c"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+extern YYSTYPE boot_yylval;
+
+
+int boot_yyparse (void);
+
+
+
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_CONST_P = 3,                    /* CONST_P  */
+  YYSYMBOL_ID = 4,                         /* ID  */
+  YYSYMBOL_OPEN = 5,                       /* OPEN  */
+  YYSYMBOL_XCLOSE = 6,                     /* XCLOSE  */
+  YYSYMBOL_XCREATE = 7,                    /* XCREATE  */
+  YYSYMBOL_INSERT_TUPLE = 8,               /* INSERT_TUPLE  */
+  YYSYMBOL_XDECLARE = 9,                   /* XDECLARE  */
+  YYSYMBOL_INDEX = 10,                     /* INDEX  */
+  YYSYMBOL_ON = 11,                        /* ON  */
+  YYSYMBOL_USING = 12,                     /* USING  */
+  YYSYMBOL_XBUILD = 13,                    /* XBUILD  */
+  YYSYMBOL_INDICES = 14,                   /* INDICES  */
+  YYSYMBOL_UNIQUE = 15,                    /* UNIQUE  */
+  YYSYMBOL_XTOAST = 16,                    /* XTOAST  */
+  YYSYMBOL_COMMA = 17,                     /* COMMA  */
+  YYSYMBOL_EQUALS = 18,                    /* EQUALS  */
+  YYSYMBOL_LPAREN = 19,                    /* LPAREN  */
+  YYSYMBOL_RPAREN = 20,                    /* RPAREN  */
+  YYSYMBOL_OBJ_ID = 21,                    /* OBJ_ID  */
+  YYSYMBOL_XBOOTSTRAP = 22,                /* XBOOTSTRAP  */
+  YYSYMBOL_XSHARED_RELATION = 23,          /* XSHARED_RELATION  */
+  YYSYMBOL_XWITHOUT_OIDS = 24,             /* XWITHOUT_OIDS  */
+  YYSYMBOL_XROWTYPE_OID = 25,              /* XROWTYPE_OID  */
+  YYSYMBOL_NULLVAL = 26,                   /* NULLVAL  */
+  YYSYMBOL_low = 27,                       /* low  */
+  YYSYMBOL_high = 28,                      /* high  */
+  YYSYMBOL_YYACCEPT = 29,                  /* $accept  */
+  YYSYMBOL_TopLevel = 30,                  /* TopLevel  */
+  YYSYMBOL_Boot_Queries = 31,              /* Boot_Queries  */
+  YYSYMBOL_Boot_Query = 32,                /* Boot_Query  */
+  YYSYMBOL_Boot_OpenStmt = 33,             /* Boot_OpenStmt  */
+  YYSYMBOL_Boot_CloseStmt = 34,            /* Boot_CloseStmt  */
+  YYSYMBOL_Boot_CreateStmt = 35,           /* Boot_CreateStmt  */
+  YYSYMBOL_36_1 = 36,                      /* $@1  */
+  YYSYMBOL_37_2 = 37,                      /* $@2  */
+  YYSYMBOL_Boot_InsertStmt = 38,           /* Boot_InsertStmt  */
+  YYSYMBOL_39_3 = 39,                      /* $@3  */
+  YYSYMBOL_Boot_DeclareIndexStmt = 40,     /* Boot_DeclareIndexStmt  */
+  YYSYMBOL_Boot_DeclareUniqueIndexStmt = 41, /* Boot_DeclareUniqueIndexStmt  */
+  YYSYMBOL_Boot_DeclareToastStmt = 42,     /* Boot_DeclareToastStmt  */
+  YYSYMBOL_Boot_BuildIndsStmt = 43,        /* Boot_BuildIndsStmt  */
+  YYSYMBOL_boot_index_params = 44,         /* boot_index_params  */
+  YYSYMBOL_boot_index_param = 45,          /* boot_index_param  */
+  YYSYMBOL_optbootstrap = 46,              /* optbootstrap  */
+  YYSYMBOL_optsharedrelation = 47,         /* optsharedrelation  */
+  YYSYMBOL_optwithoutoids = 48,            /* optwithoutoids  */
+  YYSYMBOL_optrowtypeoid = 49,             /* optrowtypeoid  */
+  YYSYMBOL_boot_column_list = 50,          /* boot_column_list  */
+  YYSYMBOL_boot_column_def = 51,           /* boot_column_def  */
+  YYSYMBOL_oidspec = 52,                   /* oidspec  */
+  YYSYMBOL_optoideq = 53,                  /* optoideq  */
+  YYSYMBOL_boot_column_val_list = 54,      /* boot_column_val_list  */
+  YYSYMBOL_boot_column_val = 55,           /* boot_column_val  */
+  YYSYMBOL_boot_const = 56,                /* boot_const  */
+  YYSYMBOL_boot_ident = 57                 /* boot_ident  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  28
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   84
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  29
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  29
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  50
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  94
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   283
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   126,   126,   127,   131,   132,   136,   137,   138,   139,
+     140,   141,   142,   143,   147,   156,   162,   172,   182,   171,
+     257,   256,   278,   296,   314,   324,   334,   335,   339,   353,
+     354,   358,   359,   363,   364,   368,   369,   373,   374,   378,
+     387,   391,   392,   396,   397,   398,   402,   404,   406,   411,
+     415
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "CONST_P", "ID",
+  "OPEN", "XCLOSE", "XCREATE", "INSERT_TUPLE", "XDECLARE", "INDEX", "ON",
+  "USING", "XBUILD", "INDICES", "UNIQUE", "XTOAST", "COMMA", "EQUALS",
+  "LPAREN", "RPAREN", "OBJ_ID", "XBOOTSTRAP", "XSHARED_RELATION",
+  "XWITHOUT_OIDS", "XROWTYPE_OID", "NULLVAL", "low", "high", "$accept",
+  "TopLevel", "Boot_Queries", "Boot_Query", "Boot_OpenStmt",
+  "Boot_CloseStmt", "Boot_CreateStmt", "$@1", "$@2", "Boot_InsertStmt",
+  "$@3", "Boot_DeclareIndexStmt", "Boot_DeclareUniqueIndexStmt",
+  "Boot_DeclareToastStmt", "Boot_BuildIndsStmt", "boot_index_params",
+  "boot_index_param", "optbootstrap", "optsharedrelation",
+  "optwithoutoids", "optrowtypeoid", "boot_column_list", "boot_column_def",
+  "oidspec", "optoideq", "boot_column_val_list", "boot_column_val",
+  "boot_const", "boot_ident", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-41)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-1)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int8 yypact[] =
+{
+      36,     8,     8,     8,    -7,     0,     6,    24,    36,   -41,
+     -41,   -41,   -41,   -41,   -41,   -41,   -41,   -41,   -41,   -41,
+     -41,     8,    12,   -41,     8,    16,     8,   -41,   -41,   -41,
+      10,   -41,     8,    14,     8,     8,     8,   -41,    13,   -41,
+       3,    26,     8,    27,   -41,    22,   -41,   -41,     1,   -41,
+     -41,   -41,     8,    37,     8,   -41,    25,     3,   -41,   -41,
+      23,     8,   -41,     8,    33,   -41,     8,    42,   -41,   -41,
+      38,     8,     8,     8,    39,    44,   -41,    41,     5,   -41,
+       8,     8,     8,    35,     8,     8,   -41,   -41,    11,   -41,
+     -41,   -41,   -41,   -41
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int8 yydefact[] =
+{
+       3,     0,    16,     0,    42,     0,     0,     0,     2,     4,
+       6,     7,     8,     9,    10,    11,    12,    13,    50,    14,
+      15,     0,     0,    20,     0,     0,     0,    25,     1,     5,
+      30,    40,     0,     0,     0,     0,     0,    29,    32,    41,
+       0,     0,     0,     0,    31,    34,    49,    48,     0,    43,
+      47,    46,     0,     0,     0,    33,    36,     0,    21,    44,
+       0,     0,    24,     0,     0,    45,     0,     0,    35,    17,
+       0,     0,     0,     0,     0,    18,    37,     0,     0,    27,
+       0,     0,     0,     0,     0,     0,    22,    28,     0,    38,
+      19,    39,    26,    23
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int8 yypgoto[] =
+{
+     -41,   -41,   -41,    54,   -41,   -41,   -41,   -41,   -41,   -41,
+     -41,   -41,   -41,   -41,   -41,   -18,   -21,   -41,   -41,   -41,
+     -41,   -41,   -16,   -23,   -41,   -41,   -40,   -41,    -1
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int8 yydefgoto[] =
+{
+       0,     7,     8,     9,    10,    11,    12,    72,    83,    13,
+      33,    14,    15,    16,    17,    78,    79,    38,    45,    56,
+      64,    75,    76,    30,    23,    48,    49,    50,    31
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int8 yytable[] =
+{
+      19,    20,    21,    36,    46,    18,    46,    18,    59,    39,
+      24,    41,    18,    43,    22,    25,    26,    65,    57,    53,
+      27,    58,    85,    34,    28,    86,    35,    47,    85,    47,
+      32,    93,    37,    40,    42,    66,    44,    52,    54,    51,
+      68,     1,     2,     3,     4,     5,    55,    51,    61,     6,
+      63,    60,    69,    62,    71,    90,    51,    73,    81,    84,
+      67,    82,    29,    88,    92,    70,    89,     0,     0,     0,
+      74,    77,    80,     0,     0,     0,     0,     0,     0,    87,
+      80,    77,     0,    91,    80
+};
+
+static const yytype_int8 yycheck[] =
+{
+       1,     2,     3,    26,     3,     4,     3,     4,    48,    32,
+      10,    34,     4,    36,    21,    15,    16,    57,    17,    42,
+      14,    20,    17,    24,     0,    20,    10,    26,    17,    26,
+      18,    20,    22,    19,    35,    12,    23,    11,    11,    40,
+      63,     5,     6,     7,     8,     9,    24,    48,    11,    13,
+      25,    52,    19,    54,    12,    20,    57,    19,    19,    18,
+      61,    17,     8,    81,    85,    66,    82,    -1,    -1,    -1,
+      71,    72,    73,    -1,    -1,    -1,    -1,    -1,    -1,    80,
+      81,    82,    -1,    84,    85
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
+{
+       0,     5,     6,     7,     8,     9,    13,    30,    31,    32,
+      33,    34,    35,    38,    40,    41,    42,    43,     4,    57,
+      57,    57,    21,    53,    10,    15,    16,    14,     0,    32,
+      52,    57,    18,    39,    57,    10,    52,    22,    46,    52,
+      19,    52,    57,    52,    23,    47,     3,    26,    54,    55,
+      56,    57,    11,    52,    11,    24,    48,    17,    20,    55,
+      57,    11,    57,    25,    49,    55,    12,    57,    52,    19,
+      57,    12,    36,    19,    57,    50,    51,    57,    44,    45,
+      57,    19,    17,    37,    18,    17,    20,    57,    44,    51,
+      20,    57,    45,    20
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    29,    30,    30,    31,    31,    32,    32,    32,    32,
+      32,    32,    32,    32,    33,    34,    34,    36,    37,    35,
+      39,    38,    40,    41,    42,    43,    44,    44,    45,    46,
+      46,    47,    47,    48,    48,    49,    49,    50,    50,    51,
+      52,    53,    53,    54,    54,    54,    55,    55,    55,    56,
+      57
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     0,     1,     2,     1,     1,     1,     1,
+       1,     1,     1,     1,     2,     2,     1,     0,     0,    12,
+       0,     6,    11,    12,     6,     2,     3,     1,     2,     1,
+       0,     1,     0,     1,     0,     2,     0,     1,     3,     3,
+       1,     3,     0,     1,     2,     3,     1,     1,     1,     1,
+       1
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 14: /* Boot_OpenStmt: OPEN boot_ident  */
+#line 148 "bootparse.y"
+                                {
+					do_start();
+					boot_openrel((yyvsp[0].str));
+					do_end();
+				}
+#line 1356 "bootparse.c"
+    break;
+
+  case 15: /* Boot_CloseStmt: XCLOSE boot_ident  */
+#line 157 "bootparse.y"
+                                {
+					do_start();
+					closerel((yyvsp[0].str));
+					do_end();
+				}
+#line 1366 "bootparse.c"
+    break;
+
+  case 16: /* Boot_CloseStmt: XCLOSE  */
+#line 163 "bootparse.y"
+                                {
+					do_start();
+					closerel(NULL);
+					do_end();
+				}
+#line 1376 "bootparse.c"
+    break;
+
+  case 17: /* $@1: %empty  */
+#line 172 "bootparse.y"
+                                {
+					do_start();
+					numattr = 0;
+					elog(DEBUG4, "creating%s%s relation %s %u",
+						 (yyvsp[-4].ival) ? " bootstrap" : "",
+						 (yyvsp[-3].ival) ? " shared" : "",
+						 (yyvsp[-6].str),
+						 (yyvsp[-5].oidval));
+				}
+#line 1390 "bootparse.c"
+    break;
+
+  case 18: /* $@2: %empty  */
+#line 182 "bootparse.y"
+                                {
+					do_end();
+				}
+#line 1398 "bootparse.c"
+    break;
+
+  case 19: /* Boot_CreateStmt: XCREATE boot_ident oidspec optbootstrap optsharedrelation optwithoutoids optrowtypeoid LPAREN $@1 boot_column_list $@2 RPAREN  */
+#line 186 "bootparse.y"
+                                {
+					TupleDesc tupdesc;
+					bool	shared_relation;
+					bool	mapped_relation;
+
+					do_start();
+
+					tupdesc = CreateTupleDesc(numattr, !((yyvsp[-6].ival)), attrtypes);
+
+					shared_relation = (yyvsp[-7].ival);
+
+					/*
+					 * The catalogs that use the relation mapper are the
+					 * bootstrap catalogs plus the shared catalogs.  If this
+					 * ever gets more complicated, we should invent a BKI
+					 * keyword to mark the mapped catalogs, but for now a
+					 * quick hack seems the most appropriate thing.  Note in
+					 * particular that all "nailed" heap rels (see formrdesc
+					 * in relcache.c) must be mapped.
+					 */
+					mapped_relation = ((yyvsp[-8].ival) || shared_relation);
+
+					if ((yyvsp[-8].ival))
+					{
+						if (boot_reldesc)
+						{
+							elog(DEBUG4, "create bootstrap: warning, open relation exists, closing first");
+							closerel(NULL);
+						}
+
+						boot_reldesc = heap_create((yyvsp[-10].str),
+												   PG_CATALOG_NAMESPACE,
+												   shared_relation ? GLOBALTABLESPACE_OID : 0,
+												   (yyvsp[-9].oidval),
+												   tupdesc,
+												   RELKIND_RELATION,
+												   shared_relation,
+												   mapped_relation,
+												   true);
+						elog(DEBUG4, "bootstrap relation created");
+					}
+					else
+					{
+						Oid id;
+
+						id = heap_create_with_catalog((yyvsp[-10].str),
+													  PG_CATALOG_NAMESPACE,
+													  shared_relation ? GLOBALTABLESPACE_OID : 0,
+													  (yyvsp[-9].oidval),
+													  (yyvsp[-5].oidval),
+													  InvalidOid,
+													  BOOTSTRAP_SUPERUSERID,
+													  tupdesc,
+													  NIL,
+													  RELKIND_RELATION,
+													  shared_relation,
+													  mapped_relation,
+													  true,
+													  0,
+													  ONCOMMIT_NOOP,
+													  (Datum) 0,
+													  false,
+													  true);
+						elog(DEBUG4, "relation created with oid %u", id);
+					}
+					do_end();
+				}
+#line 1470 "bootparse.c"
+    break;
+
+  case 20: /* $@3: %empty  */
+#line 257 "bootparse.y"
+                                {
+					do_start();
+					if ((yyvsp[0].oidval))
+						elog(DEBUG4, "inserting row with oid %u", (yyvsp[0].oidval));
+					else
+						elog(DEBUG4, "inserting row");
+					num_columns_read = 0;
+				}
+#line 1483 "bootparse.c"
+    break;
+
+  case 21: /* Boot_InsertStmt: INSERT_TUPLE optoideq $@3 LPAREN boot_column_val_list RPAREN  */
+#line 266 "bootparse.y"
+                                {
+					if (num_columns_read != numattr)
+						elog(ERROR, "incorrect number of columns in row (expected %d, got %d)",
+							 numattr, num_columns_read);
+					if (boot_reldesc == NULL)
+						elog(FATAL, "relation not open");
+					InsertOneTuple((yyvsp[-4].oidval));
+					do_end();
+				}
+#line 1497 "bootparse.c"
+    break;
+
+  case 22: /* Boot_DeclareIndexStmt: XDECLARE INDEX boot_ident oidspec ON boot_ident USING boot_ident LPAREN boot_index_params RPAREN  */
+#line 279 "bootparse.y"
+                                {
+					do_start();
+
+					DefineIndex(makeRangeVar(NULL, (yyvsp[-5].str), -1),
+								(yyvsp[-8].str),
+								(yyvsp[-7].oidval),
+								(yyvsp[-3].str),
+								NULL,
+								(yyvsp[-1].list),
+								NULL, NIL, NIL,
+								false, false, false, false, false,
+								false, false, true, false, false);
+					do_end();
+				}
+#line 1516 "bootparse.c"
+    break;
+
+  case 23: /* Boot_DeclareUniqueIndexStmt: XDECLARE UNIQUE INDEX boot_ident oidspec ON boot_ident USING boot_ident LPAREN boot_index_params RPAREN  */
+#line 297 "bootparse.y"
+                                {
+					do_start();
+
+					DefineIndex(makeRangeVar(NULL, (yyvsp[-5].str), -1),
+								(yyvsp[-8].str),
+								(yyvsp[-7].oidval),
+								(yyvsp[-3].str),
+								NULL,
+								(yyvsp[-1].list),
+								NULL, NIL, NIL,
+								true, false, false, false, false,
+								false, false, true, false, false);
+					do_end();
+				}
+#line 1535 "bootparse.c"
+    break;
+
+  case 24: /* Boot_DeclareToastStmt: XDECLARE XTOAST oidspec oidspec ON boot_ident  */
+#line 315 "bootparse.y"
+                                {
+					do_start();
+
+					BootstrapToastTable((yyvsp[0].str), (yyvsp[-3].oidval), (yyvsp[-2].oidval));
+					do_end();
+				}
+#line 1546 "bootparse.c"
+    break;
+
+  case 25: /* Boot_BuildIndsStmt: XBUILD INDICES  */
+#line 325 "bootparse.y"
+                                {
+					do_start();
+					build_indices();
+					do_end();
+				}
+#line 1556 "bootparse.c"
+    break;
+
+  case 26: /* boot_index_params: boot_index_params COMMA boot_index_param  */
+#line 334 "bootparse.y"
+                                                                { (yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].ielem)); }
+#line 1562 "bootparse.c"
+    break;
+
+  case 27: /* boot_index_params: boot_index_param  */
+#line 335 "bootparse.y"
+                                                                                        { (yyval.list) = list_make1((yyvsp[0].ielem)); }
+#line 1568 "bootparse.c"
+    break;
+
+  case 28: /* boot_index_param: boot_ident boot_ident  */
+#line 340 "bootparse.y"
+                                {
+					IndexElem *n = makeNode(IndexElem);
+					n->name = (yyvsp[-1].str);
+					n->expr = NULL;
+					n->indexcolname = NULL;
+					n->opclass = list_make1(makeString((yyvsp[0].str)));
+					n->ordering = SORTBY_DEFAULT;
+					n->nulls_ordering = SORTBY_NULLS_DEFAULT;
+					(yyval.ielem) = n;
+				}
+#line 1583 "bootparse.c"
+    break;
+
+  case 29: /* optbootstrap: XBOOTSTRAP  */
+#line 353 "bootparse.y"
+                                        { (yyval.ival) = 1; }
+#line 1589 "bootparse.c"
+    break;
+
+  case 30: /* optbootstrap: %empty  */
+#line 354 "bootparse.y"
+                                                { (yyval.ival) = 0; }
+#line 1595 "bootparse.c"
+    break;
+
+  case 31: /* optsharedrelation: XSHARED_RELATION  */
+#line 358 "bootparse.y"
+                                                { (yyval.ival) = 1; }
+#line 1601 "bootparse.c"
+    break;
+
+  case 32: /* optsharedrelation: %empty  */
+#line 359 "bootparse.y"
+                                                                { (yyval.ival) = 0; }
+#line 1607 "bootparse.c"
+    break;
+
+  case 33: /* optwithoutoids: XWITHOUT_OIDS  */
+#line 363 "bootparse.y"
+                                        { (yyval.ival) = 1; }
+#line 1613 "bootparse.c"
+    break;
+
+  case 34: /* optwithoutoids: %empty  */
+#line 364 "bootparse.y"
+                                                        { (yyval.ival) = 0; }
+#line 1619 "bootparse.c"
+    break;
+
+  case 35: /* optrowtypeoid: XROWTYPE_OID oidspec  */
+#line 368 "bootparse.y"
+                                                { (yyval.oidval) = (yyvsp[0].oidval); }
+#line 1625 "bootparse.c"
+    break;
+
+  case 36: /* optrowtypeoid: %empty  */
+#line 369 "bootparse.y"
+                                                                        { (yyval.oidval) = InvalidOid; }
+#line 1631 "bootparse.c"
+    break;
+
+  case 39: /* boot_column_def: boot_ident EQUALS boot_ident  */
+#line 379 "bootparse.y"
+                                {
+				   if (++numattr > MAXATTR)
+						elog(FATAL, "too many columns");
+				   DefineAttr((yyvsp[-2].str), (yyvsp[0].str), numattr-1);
+				}
+#line 1641 "bootparse.c"
+    break;
+
+  case 40: /* oidspec: boot_ident  */
+#line 387 "bootparse.y"
+                                                                                        { (yyval.oidval) = atooid((yyvsp[0].str)); }
+#line 1647 "bootparse.c"
+    break;
+
+  case 41: /* optoideq: OBJ_ID EQUALS oidspec  */
+#line 391 "bootparse.y"
+                                                                        { (yyval.oidval) = (yyvsp[0].oidval); }
+#line 1653 "bootparse.c"
+    break;
+
+  case 42: /* optoideq: %empty  */
+#line 392 "bootparse.y"
+                                                                                                { (yyval.oidval) = InvalidOid; }
+#line 1659 "bootparse.c"
+    break;
+
+  case 46: /* boot_column_val: boot_ident  */
+#line 403 "bootparse.y"
+                        { InsertOneValue((yyvsp[0].str), num_columns_read++); }
+#line 1665 "bootparse.c"
+    break;
+
+  case 47: /* boot_column_val: boot_const  */
+#line 405 "bootparse.y"
+                        { InsertOneValue((yyvsp[0].str), num_columns_read++); }
+#line 1671 "bootparse.c"
+    break;
+
+  case 48: /* boot_column_val: NULLVAL  */
+#line 407 "bootparse.y"
+                        { InsertOneNull(num_columns_read++); }
+#line 1677 "bootparse.c"
+    break;
+
+  case 49: /* boot_const: CONST_P  */
+#line 411 "bootparse.y"
+                          { (yyval.str) = yylval.str; }
+#line 1683 "bootparse.c"
+    break;
+
+  case 50: /* boot_ident: ID  */
+#line 415 "bootparse.y"
+                        { (yyval.str) = yylval.str; }
+#line 1689 "bootparse.c"
+    break;
+
+
+#line 1693 "bootparse.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 417 "bootparse.y"
+
+
+#include "bootscanner.c"
@@ -0,0 +1,785 @@
+/* A lexical scanner generated by pyflex */
+#define yy_create_buffer boot_yy_create_buffer
+#define yy_delete_buffer boot_yy_delete_buffer
+#define yy_flex_debug boot_yy_flex_debug
+#define yy_init_buffer boot_yy_init_buffer
+#define yy_flush_buffer boot_yy_flush_buffer
+#define yy_load_buffer_state boot_yy_load_buffer_state
+#define yy_switch_to_buffer boot_yy_switch_to_buffer
+#define yyin boot_yyin
+#define yyleng boot_yyleng
+#define yylex boot_yylex
+#define yylineno boot_yylineno
+#define yyout boot_yyout
+#define yyrestart boot_yyrestart
+#define yytext boot_yytext
+#define yywrap boot_yywrap
+#define yyalloc boot_yyalloc
+#define yyrealloc boot_yyrealloc
+#define yyfree boot_yyfree
+#define yy_scan_buffer boot_yy_scan_buffer
+#define yy_scan_string boot_yy_scan_string
+#define yy_scan_bytes boot_yy_scan_bytes
+#define yylex_init boot_yylex_init
+#define yylex_destroy boot_yylex_destroy
+#define yyget_extra boot_yyget_extra
+#define yyset_extra boot_yyset_extra
+#define yyget_in boot_yyget_in
+#define yyset_in boot_yyset_in
+#define yyget_out boot_yyget_out
+#define yyset_out boot_yyset_out
+#define yyget_leng boot_yyget_leng
+#define yyget_text boot_yyget_text
+#define yyget_lineno boot_yyget_lineno
+#define yyset_lineno boot_yyset_lineno
+#define yyget_column boot_yyget_column
+#define yyset_column boot_yyset_column
+#define yyget_lval boot_yyget_lval
+#define yyset_lval boot_yyset_lval
+#define yyget_lloc boot_yyget_lloc
+#define yyset_lloc boot_yyset_lloc
+#define yyget_debug boot_yyget_debug
+#define yyset_debug boot_yyset_debug
+#define FLEX_SCANNER
+#define YY_FLEX_MAJOR_VERSION 2
+#define YY_FLEX_MINOR_VERSION 5
+#define YY_FLEX_SUBMINOR_VERSION 35
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <stdlib.h>
+#ifndef YY_TYPEDEF_YY_SIZE_T
+#define YY_TYPEDEF_YY_SIZE_T
+typedef size_t yy_size_t;
+#endif
+#define yyconst const
+#define YY_NULL 0
+#define YY_END_OF_BUFFER_CHAR 0
+#ifndef YY_BUF_SIZE
+#define YY_BUF_SIZE 16384
+#endif
+#ifndef YY_TYPEDEF_YY_BUFFER_STATE
+#define YY_TYPEDEF_YY_BUFFER_STATE
+typedef struct yy_buffer_state *YY_BUFFER_STATE;
+#endif
+struct yy_buffer_state
+{
+	FILE *yy_input_file;
+	char *yy_ch_buf;
+	yy_size_t yy_buf_size;
+	int yy_n_chars;
+	int yy_pos;
+	int yy_filled;
+	int yy_is_our_buffer;
+};
+void yyrestart(FILE *input_file);
+void yy_switch_to_buffer(YY_BUFFER_STATE new_buffer);
+YY_BUFFER_STATE yy_create_buffer(FILE *file, int size);
+void yy_delete_buffer(YY_BUFFER_STATE b);
+void yy_flush_buffer(YY_BUFFER_STATE b);
+YY_BUFFER_STATE yy_scan_buffer(char *base, yy_size_t size);
+YY_BUFFER_STATE yy_scan_string(yyconst char *yy_str);
+YY_BUFFER_STATE yy_scan_bytes(yyconst char *bytes, int len);
+void *yyalloc(yy_size_t);
+void *yyrealloc(void *, yy_size_t);
+void yyfree(void *);
+int yylex_destroy(void);
+extern int yyleng;
+extern FILE *yyin, *yyout;
+extern char *yytext;
+extern int yylineno;
+
+/* user code from definitions section */
+/*-------------------------------------------------------------------------
+ *
+ * bootscanner.l
+ *	  a lexical scanner for the bootstrap parser
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *	  $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/attnum.h"
+#include "access/htup.h"
+#include "access/itup.h"
+#include "access/skey.h"
+#include "access/tupdesc.h"
+#include "bootstrap/bootstrap.h"
+#include "catalog/pg_am.h"
+#include "catalog/pg_attribute.h"
+#include "catalog/pg_class.h"
+#include "nodes/nodes.h"
+#include "nodes/parsenodes.h"
+#include "nodes/pg_list.h"
+#include "nodes/primnodes.h"
+#include "parser/scansup.h"
+#include "rewrite/prs2lock.h"
+#include "storage/block.h"
+#include "storage/fd.h"
+#include "storage/itemptr.h"
+#include "storage/off.h"
+#include "utils/rel.h"
+
+/* Not needed now that this file is compiled as part of bootparse. */
+/* #include "bootparse.h" */
+
+
+/* Avoid exit() on fatal scanner errors (a bit ugly -- see yy_fatal_error) */
+#undef fprintf
+#define fprintf(file, fmt, msg)  ereport(ERROR, (errmsg_internal("%s", msg)))
+
+
+static int	yyline = 1;			/* line number for error reporting */
+
+
+/* start conditions */
+#define INITIAL 0
+#ifndef YY_EXTRA_TYPE
+#define YY_EXTRA_TYPE void *
+#endif
+#define YYG(x) (x)
+int yyleng;
+FILE *yyin = NULL, *yyout = NULL;
+char *yytext;
+int yylineno = 1;
+static YY_BUFFER_STATE yy_current_buffer = NULL;
+static char yy_hold_char;
+static char *yy_hold_ptr = NULL;
+static int yy_init = 0;
+static int yy_start = 0;
+#define YY_CURRENT_BUFFER (YYG(yy_current_buffer))
+#define YY_CURRENT_BUFFER_LVALUE YYG(yy_current_buffer)
+#define BEGIN YYG(yy_start) = 
+#define YY_START (YYG(yy_start))
+#define YYSTATE YY_START
+#define yyterminate() return YY_NULL
+#ifndef ECHO
+#define ECHO do { if (fwrite(yytext, yyleng, 1, yyout)) {} } while (0)
+#endif
+#ifndef YY_USER_ACTION
+#define YY_USER_ACTION
+#endif
+#ifndef YY_BREAK
+#define YY_BREAK break;
+#endif
+#define YY_RULE_SETUP YY_USER_ACTION
+#define YY_FATAL_ERROR(msg) yy_fatal_error(msg)
+static void yy_fatal_error(yyconst char *msg);
+static void yy_fill_buffer(YY_BUFFER_STATE b);
+#undef yyless
+#define yyless(n) \
+	do { \
+		int yyless_macro_arg = (n); \
+		if (YYG(yy_hold_ptr)) *YYG(yy_hold_ptr) = YYG(yy_hold_char); \
+		YYG(yy_hold_ptr) = yytext + yyless_macro_arg; \
+		YYG(yy_hold_char) = *YYG(yy_hold_ptr); \
+		*YYG(yy_hold_ptr) = '\0'; \
+		yyleng = yyless_macro_arg; \
+		YY_CURRENT_BUFFER->yy_pos = (int) (YYG(yy_hold_ptr) - YY_CURRENT_BUFFER->yy_ch_buf); \
+	} while (0)
+#ifndef YY_DECL
+#define YY_DECL_IS_OURS 1
+extern int yylex(void);
+#define YY_DECL int yylex(void)
+#endif
+static yyconst unsigned char yy_ec[256] = {42,42,42,42,42,42,42,42,42,17,35,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,23,42,22,24,42,42,42,42,33,34,42,39,31,21,38,42,19,19,19,19,19,19,19,19,19,19,42,42,42,32,42,42,42,41,41,41,12,37,41,41,41,11,41,41,41,41,41,10,41,41,41,41,41,41,41,41,41,41,41,36,40,20,42,28,42,8,13,2,15,3,41,18,14,27,41,41,5,41,4,0,1,25,7,6,9,29,41,26,16,30,41,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42};
+static yyconst short yy_nxt[175][43] = {
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{3,4,5,4,4,4,6,7,4,8,9,4,4,10,4,11,4,12,4,13,14,15,16,17,14,4,18,19,20,21,4,22,23,24,25,26,14,4,27,14,28,4,14},
+{3,4,5,4,4,4,6,7,4,8,9,4,4,10,4,11,4,12,4,13,14,15,16,17,29,4,18,19,20,21,4,22,23,24,25,26,14,4,27,14,28,4,14},
+{30,31,30,30,32,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,36,30,37,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,38,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{39,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{40,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,41,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{42,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,43,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,44,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{30,30,30,45,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,46,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,45,47,0,35,30,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,0,48,49,0,33,0,0,0,48,48,48,48,48,48,0,0,0,0,0,0,48,50,0,35,48,0},
+{51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,52,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,53,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,54,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,55,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,56,30,57,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,0,60,60,60,60,60,60,60},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,61,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,0,48,48,0,33,0,0,0,48,48,48,48,48,48,0,0,0,0,0,0,48,0,0,35,48,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{65,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,66,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,67,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,68,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,69,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,70,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{71,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,72,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,73,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,74,0,75,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,76,35,30,0},
+{30,30,30,45,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,46,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,45,47,0,35,30,0},
+{0,0,0,77,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,77,0,0,0,0,0},
+{48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,0,48,48,0,33,0,0,0,48,48,48,48,48,48,0,0,0,0,0,0,48,0,0,35,48,0},
+{48,48,48,79,48,48,48,48,48,48,48,48,48,48,48,48,48,0,48,80,0,33,0,0,0,48,48,48,48,48,48,0,0,0,0,0,0,79,47,0,35,48,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,52,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{30,30,30,30,30,30,30,30,30,81,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,82,30,30,30,30,30,30,30,30,83,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,84,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,85,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,86,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{0,0,0,87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,87,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,0,60,60,60,60,60,60,60},
+{30,30,30,30,90,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,91,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{30,30,30,30,30,30,92,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,93,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,94,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,95,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,96,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,97,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,98,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,99,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,100,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,0,48,101,0,33,0,0,0,48,48,48,48,48,48,0,0,0,0,0,0,48,0,0,35,48,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,103,0,104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,104,0,0,0},
+{0,0,0,105,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,0,0,0,0,0},
+{48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,0,48,101,0,75,0,0,0,48,48,48,48,48,48,0,0,0,0,0,0,48,0,76,35,48,0},
+{48,48,48,79,48,48,48,48,48,48,48,48,48,48,48,48,48,0,48,80,0,33,0,0,0,48,48,48,48,48,48,0,0,0,0,0,0,79,47,0,35,48,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,107,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,108,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,109,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,110,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,111,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,112,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,113,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,0,115,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,115,0,0,0},
+{0,0,0,87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,87,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,116,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,117,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{30,30,30,118,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,119,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,120,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,121,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,122,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,123,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,124,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,125,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,100,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,0,48,126,0,33,0,0,0,48,48,48,48,48,48,0,0,0,0,0,0,48,0,0,35,48,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,129,0,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,130,0,0,0},
+{0,0,0,105,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,0,0,0,0,0},
+{131,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,132,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,133,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,134,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,135,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,136,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,137,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,0,48,48,0,33,0,0,0,48,48,48,48,48,48,0,0,0,0,0,0,48,0,0,35,48,0},
+{48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,0,48,48,0,33,0,0,0,48,48,48,48,48,48,0,0,0,0,0,0,48,0,0,35,48,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,139,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,140,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,141,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,142,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,143,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,0,48,126,0,33,0,0,0,48,48,48,48,48,48,0,0,0,0,0,0,48,0,0,35,48,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,129,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,145,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,146,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,147,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,148,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,149,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,150,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,151,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,152,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,153,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{30,30,30,30,30,30,30,30,30,154,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,155,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,156,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,157,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,158,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,159,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,160,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{161,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,162,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{163,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,164,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,165,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,166,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,167,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,168,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,169,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,170,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,171,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,172,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{173,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,174,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,30,30,0,33,0,0,0,30,30,30,30,30,30,0,0,0,0,0,34,30,0,0,35,30,0},
+};
+static yyconst short yy_accept[175] = {0,0,0,28,28,28,28,28,28,28,28,28,16,28,33,28,33,17,28,28,28,28,11,12,13,14,15,33,33,18,28,28,24,28,0,0,28,28,28,28,28,28,28,28,28,28,28,30,28,28,0,0,29,28,28,28,28,28,31,0,18,28,0,27,0,28,28,28,28,28,4,28,28,28,28,28,0,0,30,28,28,28,28,28,28,28,28,0,31,0,1,0,28,28,28,28,28,28,28,28,28,28,32,30,0,0,30,28,28,28,28,28,28,28,31,0,28,28,2,28,28,28,26,28,20,28,28,32,30,30,0,28,28,23,28,28,28,25,31,3,28,28,28,28,30,28,10,28,9,22,28,28,28,19,28,21,28,28,28,28,28,28,5,28,28,28,28,28,8,28,28,7,28,28,6};
+static yyconst short yy_start_state[2] = {1,2};
+YY_DECL
+{
+	int yy_current_state;
+	char *yy_cp, *yy_bp, *yy_end, *yy_last;
+	int yy_act;
+	YY_BUFFER_STATE yy_b;
+	if (!YYG(yy_init))
+	{
+		YYG(yy_init) = 1;
+		if (!yyin)
+			yyin = stdin;
+		if (!yyout)
+			yyout = stdout;
+	}
+	{
+
+	}
+	while (1)
+	{
+		if (YYG(yy_hold_ptr))
+		{
+			*YYG(yy_hold_ptr) = YYG(yy_hold_char);
+			YYG(yy_hold_ptr) = NULL;
+		}
+		if (!YY_CURRENT_BUFFER)
+			YY_CURRENT_BUFFER_LVALUE = yy_create_buffer(yyin, YY_BUF_SIZE);
+		yy_b = YY_CURRENT_BUFFER;
+		if (!yy_b->yy_filled)
+			yy_fill_buffer(yy_b);
+		yy_bp = yy_b->yy_ch_buf + yy_b->yy_pos;
+		if (yy_b->yy_pos >= yy_b->yy_n_chars)
+		{
+			yytext = yy_bp;
+			yyleng = 0;
+			switch (YY_START)
+			{
+				default:
+					yyterminate();
+			}
+		}
+		yy_current_state = yy_start_state[YY_START * 2 + ((yy_b->yy_pos == 0 || yy_b->yy_ch_buf[yy_b->yy_pos - 1] == '\n') ? 1 : 0)];
+		yy_cp = yy_bp;
+		yy_end = yy_b->yy_ch_buf + yy_b->yy_n_chars;
+		yy_act = 0;
+		yy_last = NULL;
+		while (yy_cp < yy_end)
+		{
+			yy_current_state = yy_nxt[yy_current_state][yy_ec[(unsigned char) *yy_cp]];
+			if (yy_current_state == 0)
+				break;
+			yy_cp++;
+			if (yy_accept[yy_current_state])
+			{
+				yy_act = yy_accept[yy_current_state];
+				yy_last = yy_cp;
+			}
+		}
+		if (!yy_act)
+			YY_FATAL_ERROR("flex scanner jammed");
+		yy_cp = yy_last;
+		yytext = yy_bp;
+		yyleng = (int) (yy_cp - yy_bp);
+		YYG(yy_hold_ptr) = yy_cp;
+		YYG(yy_hold_char) = *yy_cp;
+		*yy_cp = '\0';
+		yy_b->yy_pos = (int) (yy_cp - yy_b->yy_ch_buf);
+do_action:
+		switch (yy_act)
+		{
+			case 1:
+YY_RULE_SETUP
+{ return(OPEN); }
+	YY_BREAK
+			case 2:
+YY_RULE_SETUP
+{ return(XCLOSE); }
+	YY_BREAK
+			case 3:
+YY_RULE_SETUP
+{ return(XCREATE); }
+	YY_BREAK
+			case 4:
+YY_RULE_SETUP
+{ return(OBJ_ID); }
+	YY_BREAK
+			case 5:
+YY_RULE_SETUP
+{ return(XBOOTSTRAP); }
+	YY_BREAK
+			case 6:
+YY_RULE_SETUP
+{ return(XSHARED_RELATION); }
+	YY_BREAK
+			case 7:
+YY_RULE_SETUP
+{ return(XWITHOUT_OIDS); }
+	YY_BREAK
+			case 8:
+YY_RULE_SETUP
+{ return(XROWTYPE_OID); }
+	YY_BREAK
+			case 9:
+YY_RULE_SETUP
+{ return(NULLVAL); }
+	YY_BREAK
+			case 10:
+YY_RULE_SETUP
+{ return(INSERT_TUPLE); }
+	YY_BREAK
+			case 11:
+YY_RULE_SETUP
+{ return(COMMA); }
+	YY_BREAK
+			case 12:
+YY_RULE_SETUP
+{ return(EQUALS); }
+	YY_BREAK
+			case 13:
+YY_RULE_SETUP
+{ return(LPAREN); }
+	YY_BREAK
+			case 14:
+YY_RULE_SETUP
+{ return(RPAREN); }
+	YY_BREAK
+			case 15:
+YY_RULE_SETUP
+{ yyline++; }
+	YY_BREAK
+			case 16:
+YY_RULE_SETUP
+;
+	YY_BREAK
+			case 17:
+YY_RULE_SETUP
+;
+	YY_BREAK
+			case 18:
+YY_RULE_SETUP
+; /* drop everything after "#" for comments */
+	YY_BREAK
+			case 19:
+YY_RULE_SETUP
+{ return(XDECLARE); }
+	YY_BREAK
+			case 20:
+YY_RULE_SETUP
+{ return(XBUILD); }
+	YY_BREAK
+			case 21:
+YY_RULE_SETUP
+{ return(INDICES); }
+	YY_BREAK
+			case 22:
+YY_RULE_SETUP
+{ return(UNIQUE); }
+	YY_BREAK
+			case 23:
+YY_RULE_SETUP
+{ return(INDEX); }
+	YY_BREAK
+			case 24:
+YY_RULE_SETUP
+{ return(ON); }
+	YY_BREAK
+			case 25:
+YY_RULE_SETUP
+{ return(USING); }
+	YY_BREAK
+			case 26:
+YY_RULE_SETUP
+{ return(XTOAST); }
+	YY_BREAK
+			case 27:
+YY_RULE_SETUP
+{
+					yylval.str = pstrdup(MapArrayTypeName(yytext));
+					return(ID);
+				}
+	YY_BREAK
+			case 28:
+YY_RULE_SETUP
+{
+					yylval.str = scanstr(yytext);
+					return(ID);
+				}
+	YY_BREAK
+			case 29:
+YY_RULE_SETUP
+{
+					yytext[strlen(yytext)-1] = '\0'; /* strip off quotes */
+					yylval.str = scanstr(yytext+1);
+					yytext[strlen(yytext)] = '"'; /* restore quotes */
+					return(ID);
+				}
+	YY_BREAK
+			case 30:
+			case 31:
+			case 32:
+YY_RULE_SETUP
+{
+							yylval.str = pstrdup(yytext);
+							return(CONST_P);
+						}
+	YY_BREAK
+			case 33:
+YY_RULE_SETUP
+{
+					elog(ERROR, "syntax error at line %d: unexpected character \"%s\"", yyline, yytext);
+				}
+	YY_BREAK
+			default:
+				YY_FATAL_ERROR("fatal flex scanner internal error--no action found");
+		}
+	}
+}
+
+static void
+yy_fatal_error(yyconst char *msg)
+{
+	(void) fprintf(stderr, "%s\n", msg);
+	exit(2);
+}
+
+static void
+yy_fill_buffer(YY_BUFFER_STATE b)
+{
+	yy_size_t	size = 16384;
+	yy_size_t	n = 0;
+
+	b->yy_ch_buf = (char *) yyalloc(size + 2);
+	if (!b->yy_ch_buf)
+		YY_FATAL_ERROR("out of dynamic memory in yy_fill_buffer()");
+	if (b->yy_input_file)
+	{
+		for (;;)
+		{
+			size_t		r;
+
+			if (n == size)
+			{
+				size *= 2;
+				b->yy_ch_buf = (char *) yyrealloc(b->yy_ch_buf, size + 2);
+				if (!b->yy_ch_buf)
+					YY_FATAL_ERROR("out of dynamic memory in yy_fill_buffer()");
+			}
+			r = fread(b->yy_ch_buf + n, 1, size - n, b->yy_input_file);
+			if (r == 0)
+			{
+				if (ferror(b->yy_input_file) && errno == EINTR)
+				{
+					clearerr(b->yy_input_file);
+					continue;
+				}
+				break;
+			}
+			n += r;
+		}
+	}
+	b->yy_ch_buf[n] = b->yy_ch_buf[n + 1] = YY_END_OF_BUFFER_CHAR;
+	b->yy_n_chars = (int) n;
+	b->yy_buf_size = size;
+	b->yy_pos = 0;
+	b->yy_filled = 1;
+	b->yy_is_our_buffer = 1;
+}
+
+void
+yyrestart(FILE *input_file)
+{
+
+	if (YYG(yy_hold_ptr))
+	{
+		*YYG(yy_hold_ptr) = YYG(yy_hold_char);
+		YYG(yy_hold_ptr) = NULL;
+	}
+	if (YY_CURRENT_BUFFER)
+		yy_delete_buffer(YY_CURRENT_BUFFER);
+	YY_CURRENT_BUFFER_LVALUE = yy_create_buffer(input_file, YY_BUF_SIZE);
+}
+
+void
+yy_switch_to_buffer(YY_BUFFER_STATE new_buffer)
+{
+
+	if (YYG(yy_hold_ptr))
+	{
+		*YYG(yy_hold_ptr) = YYG(yy_hold_char);
+		YYG(yy_hold_ptr) = NULL;
+	}
+	YY_CURRENT_BUFFER_LVALUE = new_buffer;
+}
+
+YY_BUFFER_STATE
+yy_create_buffer(FILE *file, int size)
+{
+	YY_BUFFER_STATE b;
+
+	(void) size;
+	b = (YY_BUFFER_STATE) yyalloc(sizeof(struct yy_buffer_state));
+	if (!b)
+		YY_FATAL_ERROR("out of dynamic memory in yy_create_buffer()");
+	memset(b, 0, sizeof(struct yy_buffer_state));
+	b->yy_input_file = file;
+	return b;
+}
+
+void
+yy_delete_buffer(YY_BUFFER_STATE b)
+{
+
+	if (!b)
+		return;
+	if (b == YY_CURRENT_BUFFER)
+	{
+		if (YYG(yy_hold_ptr))
+		{
+			*YYG(yy_hold_ptr) = YYG(yy_hold_char);
+			YYG(yy_hold_ptr) = NULL;
+		}
+		YY_CURRENT_BUFFER_LVALUE = NULL;
+	}
+	if (b->yy_is_our_buffer && b->yy_ch_buf)
+		yyfree(b->yy_ch_buf);
+	yyfree(b);
+}
+
+void
+yy_flush_buffer(YY_BUFFER_STATE b)
+{
+	if (!b)
+		return;
+	b->yy_pos = b->yy_n_chars;
+}
+
+YY_BUFFER_STATE
+yy_scan_buffer(char *base, yy_size_t size)
+{
+	YY_BUFFER_STATE b;
+
+	if (size < 2 ||
+		base[size - 2] != YY_END_OF_BUFFER_CHAR ||
+		base[size - 1] != YY_END_OF_BUFFER_CHAR)
+		return NULL;
+	b = (YY_BUFFER_STATE) yyalloc(sizeof(struct yy_buffer_state));
+	if (!b)
+		YY_FATAL_ERROR("out of dynamic memory in yy_scan_buffer()");
+	memset(b, 0, sizeof(struct yy_buffer_state));
+	b->yy_ch_buf = base;
+	b->yy_buf_size = size - 2;
+	b->yy_n_chars = (int) (size - 2);
+	b->yy_pos = 0;
+	b->yy_filled = 1;
+	b->yy_is_our_buffer = 0;
+	yy_switch_to_buffer(b);
+	return b;
+}
+
+YY_BUFFER_STATE
+yy_scan_string(yyconst char *yystr)
+{
+	return yy_scan_bytes(yystr, (int) strlen(yystr));
+}
+
+YY_BUFFER_STATE
+yy_scan_bytes(yyconst char *yybytes, int len)
+{
+	YY_BUFFER_STATE b;
+	char	   *buf;
+
+	buf = (char *) yyalloc(len + 2);
+	if (!buf)
+		YY_FATAL_ERROR("out of dynamic memory in yy_scan_bytes()");
+	memcpy(buf, yybytes, len);
+	buf[len] = buf[len + 1] = YY_END_OF_BUFFER_CHAR;
+	b = yy_scan_buffer(buf, len + 2);
+	if (!b)
+		YY_FATAL_ERROR("bad buffer in yy_scan_bytes()");
+	b->yy_is_our_buffer = 1;
+	return b;
+}
+
+int
+yylex_destroy(void)
+{
+	if (YY_CURRENT_BUFFER)
+		yy_delete_buffer(YY_CURRENT_BUFFER);
+	yy_init = 0;
+	yy_start = 0;
+	return 0;
+}
+void *
+yyalloc(yy_size_t size)
+{
+	return malloc(size);
+}
+void *
+yyrealloc(void *ptr, yy_size_t size)
+{
+	return realloc(ptr, size);
+}
+void
+yyfree(void *ptr)
+{
+	free(ptr);
+}
+
+/* user code */
+
+void
+yyerror(const char *message)
+{
+	elog(ERROR, "%s at line %d", message, yyline);
+}
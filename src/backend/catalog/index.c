@@ -28,6 +28,7 @@
 #include "access/relscan.h"
 #include "access/sysattr.h"
 #include "access/transam.h"
+#include "access/visibilitymap.h"
 #include "access/xact.h"
 #include "bootstrap/bootstrap.h"
 #include "catalog/catalog.h"
@@ -1357,6 +1358,16 @@ index_update_stats(Relation rel,
 		rd_rel->relpages = (int32) relpages;
 		dirty = true;
 	}
+	if (rd_rel->relkind != RELKIND_INDEX)
+	{
+		BlockNumber relallvisible = visibilitymap_count(rel);
+
+		if (rd_rel->relallvisible != (int32) relallvisible)
+		{
+			rd_rel->relallvisible = (int32) relallvisible;
+			dirty = true;
+		}
+	}
 
 	/*
 	 * If anything changed, write out the tuple
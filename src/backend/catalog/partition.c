@@ -0,0 +1,1168 @@
+/*-------------------------------------------------------------------------
+ *
+ * partition.c
+ *	  routines to derive and search the partition bounds of a table
+ *	  partitioned by inheritance
+ *
+ * A table is partitioned when its "partition_key" storage parameter names
+ * one of its columns.  Each direct inheritance child is then a partition,
+ * and its bounds are read from its CHECK constraints on that column:
+ *
+ *		key >= lower AND key < upper	(range partitioning; > and <= work as
+ *										 well, and either end may be omitted
+ *										 to leave it unbounded)
+ *		key = value, key IN (...)		(list partitioning)
+ *
+ * The bounds are sorted so that INSERT/COPY tuple routing and partition
+ * pruning, whether done by the planner or by an Append node once parameter
+ * values are known, can find the right partitions by binary search, rather
+ * than by running a routing trigger or proving constraint exclusion child
+ * by child.  The CHECK constraints themselves remain in force, so a wrong
+ * routing decision would be caught when the tuple is stored.
+ *
+ * Since reading the bounds means parsing every child's constraints, the
+ * descriptors are cached per backend, keyed by the parent's OID.  An entry
+ * is flushed by a relcache invalidation of the parent or of any of its
+ * partitions, which covers changes to the partition key, to the children's
+ * constraints, and to the set of children.
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *	  $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/heapam.h"
+#include "access/nbtree.h"
+#include "catalog/partition.h"
+#include "catalog/pg_am.h"
+#include "catalog/pg_inherits_fn.h"
+#include "catalog/pg_type.h"
+#include "commands/defrem.h"
+#include "nodes/makefuncs.h"
+#include "nodes/nodeFuncs.h"
+#include "optimizer/clauses.h"
+#include "optimizer/var.h"
+#include "parser/parse_coerce.h"
+#include "storage/lmgr.h"
+#include "utils/array.h"
+#include "utils/builtins.h"
+#include "utils/catcache.h"
+#include "utils/datum.h"
+#include "utils/hsearch.h"
+#include "utils/inval.h"
+#include "utils/lsyscache.h"
+#include "utils/memutils.h"
+#include "utils/rel.h"
+
+
+/* Working representation of one range partition while sorting */
+typedef struct PartitionRangeBound
+{
+	Oid			oid;
+	Datum		lower;
+	bool		lower_incl;
+	bool		lower_inf;
+	Datum		upper;
+	bool		upper_incl;
+	bool		upper_inf;
+} PartitionRangeBound;
+
+/* Working representation of one list value while sorting */
+typedef struct PartitionListValue
+{
+	Datum		value;
+	int			part;
+} PartitionListValue;
+
+/* Cached partition descriptor of one parent */
+typedef struct PartitionDescCacheEntry
+{
+	Oid			parentrelid;	/* hash key - must be first */
+	MemoryContext cxt;			/* private context holding pd */
+	PartitionDesc pd;
+} PartitionDescCacheEntry;
+
+static HTAB *PartitionDescCacheHash = NULL;
+
+static void InitPartitionDescCache(void);
+static void PartitionDescCacheCallback(Datum arg, Oid relid);
+static PartitionDesc partition_build_desc(Relation parent, char *keyname,
+					 LOCKMODE lockmode, bool complain);
+static PartitionDesc partition_copy_desc(PartitionDesc pd);
+static bool partition_is_key(Node *node, Index varno, AttrNumber attno);
+static bool partition_match_clause(PartitionDesc pd, Node *clause,
+					   Index varno, AttrNumber attno,
+					   int *strategy, List **consts);
+static Const *partition_coerce_const(PartitionDesc pd, Const *con);
+static int32 partition_compare(PartitionDesc pd, Datum a, Datum b);
+static int	range_count_lower(PartitionDesc pd, Datum value, bool strict);
+static int	list_count_values(PartitionDesc pd, Datum value, bool strict);
+static Bitmapset *partition_matching(PartitionDesc pd, int strategy,
+				   Datum value);
+static int	range_bound_cmp(const void *a, const void *b, void *arg);
+static int	list_value_cmp(const void *a, const void *b, void *arg);
+static int	oid_index_cmp(const void *a, const void *b, void *arg);
+
+
+/*
+ * RelationBuildPartitionDesc
+ *
+ * Build the partition descriptor of 'parent', or return NULL if it has no
+ * partition key.  The children are locked with 'lockmode'.
+ *
+ * If the children's CHECK constraints don't describe a valid partitioning,
+ * we raise an error when 'complain' is true and return NULL otherwise.
+ * The planner uses the latter, since it can always fall back on constraint
+ * exclusion.
+ *
+ * The result is a copy of the cached descriptor, allocated in the current
+ * memory context, so that a cache flush can't pull it out from under the
+ * caller.  Only valid descriptors are cached.
+ */
+PartitionDesc
+RelationBuildPartitionDesc(Relation parent, LOCKMODE lockmode, bool complain)
+{
+	Oid			parentoid = RelationGetRelid(parent);
+	char	   *keyname = RelationGetPartitionKey(parent);
+	PartitionDescCacheEntry *entry;
+	PartitionDesc pd;
+	MemoryContext cxt;
+	MemoryContext oldcxt;
+	bool		found;
+
+	if (keyname == NULL)
+		return NULL;
+
+	if (PartitionDescCacheHash == NULL)
+		InitPartitionDescCache();
+
+	entry = (PartitionDescCacheEntry *) hash_search(PartitionDescCacheHash,
+													(void *) &parentoid,
+													HASH_FIND, NULL);
+	if (entry != NULL && lockmode != NoLock)
+	{
+		Oid		   *oids;
+		int			nparts = entry->pd->nparts;
+		int			i;
+
+		/*
+		 * Lock the partitions, in OID order as find_inheritance_children
+		 * would.  Taking a lock processes pending invalidation messages,
+		 * which may flush the entry, so look it up again afterwards.
+		 */
+		oids = (Oid *) palloc(Max(nparts, 1) * sizeof(Oid));
+		memcpy(oids, entry->pd->sorted_oids, nparts * sizeof(Oid));
+		for (i = 0; i < nparts; i++)
+			LockRelationOid(oids[i], lockmode);
+		pfree(oids);
+
+		entry = (PartitionDescCacheEntry *)
+			hash_search(PartitionDescCacheHash, (void *) &parentoid,
+						HASH_FIND, NULL);
+	}
+	if (entry != NULL)
+		return partition_copy_desc(entry->pd);
+
+	pd = partition_build_desc(parent, keyname, lockmode, complain);
+	if (pd == NULL)
+		return NULL;
+
+	cxt = AllocSetContextCreate(CacheMemoryContext,
+								"partition descriptor",
+								ALLOCSET_SMALL_MINSIZE,
+								ALLOCSET_SMALL_INITSIZE,
+								ALLOCSET_SMALL_MAXSIZE);
+	oldcxt = MemoryContextSwitchTo(cxt);
+	entry = (PartitionDescCacheEntry *) hash_search(PartitionDescCacheHash,
+													(void *) &parentoid,
+													HASH_ENTER, &found);
+	if (found)
+		MemoryContextDelete(entry->cxt);
+	entry->cxt = cxt;
+	entry->pd = partition_copy_desc(pd);
+	MemoryContextSwitchTo(oldcxt);
+
+	return pd;
+}
+
+/*
+ * InitPartitionDescCache
+ *		Initialize the partition descriptor cache.
+ */
+static void
+InitPartitionDescCache(void)
+{
+	HASHCTL		ctl;
+
+	MemSet(&ctl, 0, sizeof(ctl));
+	ctl.keysize = sizeof(Oid);
+	ctl.entrysize = sizeof(PartitionDescCacheEntry);
+	ctl.hash = oid_hash;
+	PartitionDescCacheHash =
+		hash_create("Partition descriptor cache", 16, &ctl,
+					HASH_ELEM | HASH_FUNCTION);
+
+	/* Make sure we've initialized CacheMemoryContext. */
+	if (!CacheMemoryContext)
+		CreateCacheMemoryContext();
+
+	CacheRegisterRelcacheCallback(PartitionDescCacheCallback, (Datum) 0);
+}
+
+/*
+ * PartitionDescCacheCallback
+ *		Relcache inval callback function
+ *
+ * Flush the descriptors of 'relid' and of its parent, if it is a partition;
+ * or all of them, if 'relid' is InvalidOid.
+ */
+static void
+PartitionDescCacheCallback(Datum arg, Oid relid)
+{
+	HASH_SEQ_STATUS status;
+	PartitionDescCacheEntry *entry;
+
+	hash_seq_init(&status, PartitionDescCacheHash);
+	while ((entry = (PartitionDescCacheEntry *) hash_seq_search(&status)) != NULL)
+	{
+		if (OidIsValid(relid) &&
+			entry->parentrelid != relid &&
+			partition_index_for_oid(entry->pd, relid) < 0)
+			continue;
+
+		MemoryContextDelete(entry->cxt);
+		if (hash_search(PartitionDescCacheHash,
+						(void *) &entry->parentrelid,
+						HASH_REMOVE, NULL) == NULL)
+			elog(ERROR, "hash table corrupted");
+	}
+}
+
+/*
+ * partition_build_desc
+ *
+ * Workhorse for RelationBuildPartitionDesc: read the bounds off the
+ * children's constraints.  The result is allocated in the current memory
+ * context.
+ */
+static PartitionDesc
+partition_build_desc(Relation parent, char *keyname, LOCKMODE lockmode,
+					 bool complain)
+{
+	Oid			parentoid = RelationGetRelid(parent);
+	PartitionDesc pd;
+	Oid			atttype;
+	Oid			opclass;
+	Oid			cmpproc;
+	List	   *children;
+	ListCell   *lc;
+	PartitionRangeBound *ranges;
+	int			nranges = 0;
+	PartitionListValue *values = NULL;
+	int			nvalues = 0;
+	int			maxvalues = 0;
+	int			i;
+
+	pd = (PartitionDesc) palloc0(sizeof(PartitionDescData));
+	pd->parentrelid = parentoid;
+	pd->keyattno = get_attnum(parentoid, keyname);
+	if (pd->keyattno <= 0)
+	{
+		if (!complain)
+			return NULL;
+		ereport(ERROR,
+				(errcode(ERRCODE_UNDEFINED_COLUMN),
+				 errmsg("partition key column \"%s\" of relation \"%s\" does not exist",
+						keyname, RelationGetRelationName(parent))));
+	}
+
+	/* The key is ordered by the default btree opclass of its type */
+	atttype = get_atttype(parentoid, pd->keyattno);
+	opclass = GetDefaultOpClass(atttype, BTREE_AM_OID);
+	if (!OidIsValid(opclass))
+	{
+		if (!complain)
+			return NULL;
+		ereport(ERROR,
+				(errcode(ERRCODE_UNDEFINED_OBJECT),
+				 errmsg("data type %s has no default operator class for access method \"%s\"",
+						format_type_be(atttype), "btree"),
+				 errhint("The partition key column must have a sortable data type.")));
+	}
+	pd->opfamily = get_opclass_family(opclass);
+	pd->keytype = get_opclass_input_type(opclass);
+	if (IsPolymorphicType(pd->keytype))
+		pd->keytype = atttype;
+	get_typlenbyval(pd->keytype, &pd->keytyplen, &pd->keytypbyval);
+
+	cmpproc = get_opfamily_proc(pd->opfamily, pd->keytype, pd->keytype,
+								BTORDER_PROC);
+	if (!RegProcedureIsValid(cmpproc))
+		elog(ERROR, "missing support function %d(%u,%u) in opfamily %u",
+			 BTORDER_PROC, pd->keytype, pd->keytype, pd->opfamily);
+	fmgr_info(cmpproc, &pd->cmpfn);
+
+	children = find_inheritance_children(parentoid, lockmode);
+	ranges = (PartitionRangeBound *)
+		palloc0(Max(list_length(children), 1) * sizeof(PartitionRangeBound));
+
+	/*
+	 * Read each child's bounds off its CHECK constraints.  Several range
+	 * comparisons are combined by taking the tightest, an exclusive bound
+	 * being the tighter of two equal ones; the child must not
+	 * mix range comparisons with a value list, nor carry two value lists.
+	 */
+	foreach(lc, children)
+	{
+		Oid			childoid = lfirst_oid(lc);
+		Relation	childrel = heap_open(childoid, NoLock);
+		TupleConstr *constr = RelationGetDescr(childrel)->constr;
+		AttrNumber	childattno = get_attnum(childoid, keyname);
+		PartitionRangeBound *range = &ranges[nranges];
+		bool		has_lower = false;
+		bool		has_upper = false;
+		List	   *listconsts = NIL;
+		bool		ambiguous = false;
+
+		for (i = 0; constr != NULL && i < constr->num_check; i++)
+		{
+			Node	   *expr = stringToNode(constr->check[i].ccbin);
+			ListCell   *lc2;
+
+			foreach(lc2, make_ands_implicit((Expr *) expr))
+			{
+				int			strategy;
+				List	   *consts;
+				Datum		bound;
+
+				if (!partition_match_clause(pd, (Node *) lfirst(lc2),
+											1, childattno,
+											&strategy, &consts))
+					continue;
+
+				if (strategy == BTEqualStrategyNumber)
+				{
+					if (listconsts != NIL)
+						ambiguous = true;
+					listconsts = consts;
+					continue;
+				}
+
+				bound = ((Const *) linitial(consts))->constvalue;
+				if (strategy == BTGreaterEqualStrategyNumber ||
+					strategy == BTGreaterStrategyNumber)
+				{
+					bool		incl = (strategy == BTGreaterEqualStrategyNumber);
+					int32		cmp = 1;
+
+					if (has_lower)
+						cmp = partition_compare(pd, bound, range->lower);
+					if (cmp > 0 || (cmp == 0 && !incl))
+					{
+						range->lower = bound;
+						range->lower_incl = incl;
+					}
+					has_lower = true;
+				}
+				else
+				{
+					bool		incl = (strategy == BTLessEqualStrategyNumber);
+					int32		cmp = -1;
+
+					if (has_upper)
+						cmp = partition_compare(pd, bound, range->upper);
+					if (cmp < 0 || (cmp == 0 && !incl))
+					{
+						range->upper = bound;
+						range->upper_incl = incl;
+					}
+					has_upper = true;
+				}
+			}
+		}
+
+		if (listconsts != NIL && (has_lower || has_upper))
+			ambiguous = true;
+		if (!ambiguous &&
+			(listconsts != NIL ? pd->strategy == PARTITION_STRATEGY_RANGE :
+			 pd->strategy == PARTITION_STRATEGY_LIST))
+			ambiguous = true;
+		if (ambiguous || (listconsts == NIL && !has_lower && !has_upper))
+		{
+			char	   *childname = pstrdup(RelationGetRelationName(childrel));
+
+			heap_close(childrel, NoLock);
+			if (!complain)
+				return NULL;
+			ereport(ERROR,
+					(errcode(ERRCODE_OBJECT_NOT_IN_PREREQUISITE_STATE),
+					 errmsg("cannot determine partition bounds of table \"%s\"",
+							childname),
+					 errdetail("Each child of table \"%s\" needs CHECK constraints bounding \"%s\" with >, >=, < or <=, or of the form \"%s IN (values)\", all children using the same form.",
+							   RelationGetRelationName(parent),
+							   keyname, keyname)));
+		}
+
+		if (listconsts != NIL)
+		{
+			ListCell   *lc2;
+
+			pd->strategy = PARTITION_STRATEGY_LIST;
+			foreach(lc2, listconsts)
+			{
+				if (nvalues >= maxvalues)
+				{
+					maxvalues = Max(maxvalues * 2, 16);
+					if (values == NULL)
+						values = (PartitionListValue *)
+							palloc(maxvalues * sizeof(PartitionListValue));
+					else
+						values = (PartitionListValue *)
+							repalloc(values,
+									 maxvalues * sizeof(PartitionListValue));
+				}
+				values[nvalues].value =
+					datumCopy(((Const *) lfirst(lc2))->constvalue,
+							  pd->keytypbyval, pd->keytyplen);
+				values[nvalues].part = nranges;
+				nvalues++;
+			}
+		}
+		else
+		{
+			pd->strategy = PARTITION_STRATEGY_RANGE;
+			range->lower_inf = !has_lower;
+			range->upper_inf = !has_upper;
+			if (has_lower)
+				range->lower = datumCopy(range->lower,
+										 pd->keytypbyval, pd->keytyplen);
+			if (has_upper)
+				range->upper = datumCopy(range->upper,
+										 pd->keytypbyval, pd->keytyplen);
+		}
+		range->oid = childoid;
+		nranges++;
+
+		heap_close(childrel, NoLock);
+	}
+
+	pd->nparts = nranges;
+	pd->oids = (Oid *) palloc(Max(nranges, 1) * sizeof(Oid));
+
+	if (pd->strategy == PARTITION_STRATEGY_LIST)
+	{
+		for (i = 0; i < nranges; i++)
+			pd->oids[i] = ranges[i].oid;
+
+		qsort_arg(values, nvalues, sizeof(PartitionListValue),
+				  list_value_cmp, pd);
+		pd->nvalues = nvalues;
+		pd->values = (Datum *) palloc(nvalues * sizeof(Datum));
+		pd->valueparts = (int *) palloc(nvalues * sizeof(int));
+		for (i = 0; i < nvalues; i++)
+		{
+			if (i > 0 &&
+				partition_compare(pd, values[i - 1].value,
+								  values[i].value) == 0 &&
+				values[i - 1].part != values[i].part)
+			{
+				if (!complain)
+					return NULL;
+				ereport(ERROR,
+						(errcode(ERRCODE_OBJECT_NOT_IN_PREREQUISITE_STATE),
+						 errmsg("partitions \"%s\" and \"%s\" of table \"%s\" overlap",
+								get_rel_name(pd->oids[values[i - 1].part]),
+								get_rel_name(pd->oids[values[i].part]),
+								RelationGetRelationName(parent))));
+			}
+			pd->values[i] = values[i].value;
+			pd->valueparts[i] = values[i].part;
+		}
+	}
+	else
+	{
+		qsort_arg(ranges, nranges, sizeof(PartitionRangeBound),
+				  range_bound_cmp, pd);
+		pd->lower = (Datum *) palloc(Max(nranges, 1) * sizeof(Datum));
+		pd->lower_incl = (bool *) palloc(Max(nranges, 1) * sizeof(bool));
+		pd->lower_inf = (bool *) palloc(Max(nranges, 1) * sizeof(bool));
+		pd->upper = (Datum *) palloc(Max(nranges, 1) * sizeof(Datum));
+		pd->upper_incl = (bool *) palloc(Max(nranges, 1) * sizeof(bool));
+		pd->upper_inf = (bool *) palloc(Max(nranges, 1) * sizeof(bool));
+		for (i = 0; i < nranges; i++)
+		{
+			int32		cmp = 0;
+
+			/* Adjacent ranges may share a bound only if one excludes it */
+			if (i > 0 && !ranges[i - 1].upper_inf && !ranges[i].lower_inf)
+				cmp = partition_compare(pd, ranges[i - 1].upper,
+										ranges[i].lower);
+			if (i > 0 &&
+				(ranges[i - 1].upper_inf || ranges[i].lower_inf ||
+				 cmp > 0 ||
+				 (cmp == 0 && ranges[i - 1].upper_incl &&
+				  ranges[i].lower_incl)))
+			{
+				if (!complain)
+					return NULL;
+				ereport(ERROR,
+						(errcode(ERRCODE_OBJECT_NOT_IN_PREREQUISITE_STATE),
+						 errmsg("partitions \"%s\" and \"%s\" of table \"%s\" overlap",
+								get_rel_name(ranges[i - 1].oid),
+								get_rel_name(ranges[i].oid),
+								RelationGetRelationName(parent))));
+			}
+			pd->oids[i] = ranges[i].oid;
+			pd->lower[i] = ranges[i].lower;
+			pd->lower_incl[i] = ranges[i].lower_incl;
+			pd->lower_inf[i] = ranges[i].lower_inf;
+			pd->upper[i] = ranges[i].upper;
+			pd->upper_incl[i] = ranges[i].upper_incl;
+			pd->upper_inf[i] = ranges[i].upper_inf;
+		}
+	}
+
+	/* Set up lookup of partitions by OID */
+	pd->sorted_parts = (int *) palloc(Max(nranges, 1) * sizeof(int));
+	for (i = 0; i < nranges; i++)
+		pd->sorted_parts[i] = i;
+	qsort_arg(pd->sorted_parts, nranges, sizeof(int), oid_index_cmp, pd);
+	pd->sorted_oids = (Oid *) palloc(Max(nranges, 1) * sizeof(Oid));
+	for (i = 0; i < nranges; i++)
+		pd->sorted_oids[i] = pd->oids[pd->sorted_parts[i]];
+
+	pfree(ranges);
+	if (values)
+		pfree(values);
+
+	return pd;
+}
+
+/*
+ * partition_find_for_value
+ *
+ * Return the index of the partition that accepts key 'value', or -1 if
+ * there is none.  A null key never matches any partition.
+ */
+int
+partition_find_for_value(PartitionDesc pd, Datum value, bool isnull)
+{
+	int			n;
+
+	if (isnull)
+		return -1;
+
+	if (pd->strategy == PARTITION_STRATEGY_LIST)
+	{
+		n = list_count_values(pd, value, false);
+		if (n > 0 && partition_compare(pd, pd->values[n - 1], value) == 0)
+			return pd->valueparts[n - 1];
+		return -1;
+	}
+
+	/* The candidate is the last partition whose lower bound admits value */
+	n = range_count_lower(pd, value, false) - 1;
+	if (n < 0)
+		return -1;
+	if (!pd->upper_inf[n])
+	{
+		int32		cmp = partition_compare(pd, value, pd->upper[n]);
+
+		if (cmp > 0 || (cmp == 0 && !pd->upper_incl[n]))
+			return -1;
+	}
+	return n;
+}
+
+/*
+ * partition_index_for_oid
+ *
+ * Return the index of the partition with OID 'relid', or -1 if it isn't
+ * one of the partitions.
+ */
+int
+partition_index_for_oid(PartitionDesc pd, Oid relid)
+{
+	int			lo = 0;
+	int			hi = pd->nparts;
+
+	while (lo < hi)
+	{
+		int			mid = (lo + hi) / 2;
+
+		if (pd->sorted_oids[mid] < relid)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (lo < pd->nparts && pd->sorted_oids[lo] == relid)
+		return pd->sorted_parts[lo];
+	return -1;
+}
+
+/*
+ * partition_prune_by_clauses
+ *
+ * Return the set of indexes of the partitions that might contain rows
+ * satisfying all of 'clauses', an implicitly-ANDed list of bare qual
+ * expressions in which the partitioned table is referenced as 'varno'.
+ *
+ * Only clauses comparing the key column with a constant using an operator
+ * of the key's btree opfamily, or "key = ANY (array constant)", are used;
+ * anything else is simply ignored, so the result may include partitions
+ * that in fact have no matching rows.
+ */
+Bitmapset *
+partition_prune_by_clauses(PartitionDesc pd, List *clauses, Index varno)
+{
+	Bitmapset  *result = NULL;
+	ListCell   *lc;
+	int			i;
+
+	for (i = 0; i < pd->nparts; i++)
+		result = bms_add_member(result, i);
+
+	foreach(lc, clauses)
+	{
+		int			strategy;
+		List	   *consts;
+		Bitmapset  *matching = NULL;
+		ListCell   *lc2;
+
+		if (!partition_match_clause(pd, (Node *) lfirst(lc),
+									varno, pd->keyattno,
+									&strategy, &consts))
+			continue;
+
+		/* An IN list matches the union of its values' partitions */
+		foreach(lc2, consts)
+		{
+			Bitmapset  *parts;
+
+			parts = partition_matching(pd, strategy,
+									   ((Const *) lfirst(lc2))->constvalue);
+			matching = bms_join(matching, parts);
+		}
+		result = bms_int_members(result, matching);
+		bms_free(matching);
+
+		if (bms_is_empty(result))
+			break;
+	}
+
+	return result;
+}
+
+/*
+ * partition_match_runtime_clause
+ *
+ * Does 'clause' compare the key column of relation 'varno' with an
+ * expression that can't be reduced to a constant at plan time, but can be
+ * computed before the partitioned table is scanned?  Such an expression
+ * contains Params, or Vars of the outer side of a nestloop join; it must
+ * not reference 'varno' itself, nor contain volatile functions or subplans.
+ * If so, return the operator's btree strategy and the expression, converted
+ * to the key type.  The executor evaluates it and passes the value to
+ * partition_prune_by_values.
+ */
+bool
+partition_match_runtime_clause(PartitionDesc pd, Node *clause, Index varno,
+							   int *strategy, Expr **valexpr)
+{
+	Node	   *leftop;
+	Node	   *rightop;
+	Oid			opno;
+	Oid			valtype;
+
+	if (!is_opclause(clause) || list_length(((OpExpr *) clause)->args) != 2)
+		return false;
+	opno = ((OpExpr *) clause)->opno;
+	leftop = get_leftop((Expr *) clause);
+	rightop = get_rightop((Expr *) clause);
+
+	/* Put the key on the left, commuting the operator if need be */
+	if (!partition_is_key(leftop, varno, pd->keyattno))
+	{
+		Node	   *tmp = leftop;
+
+		if (!partition_is_key(rightop, varno, pd->keyattno))
+			return false;
+		leftop = rightop;
+		rightop = tmp;
+		opno = get_commutator(opno);
+		if (!OidIsValid(opno))
+			return false;
+	}
+
+	if (IsA(rightop, Const) ||
+		bms_is_member(varno, pull_varnos(rightop)) ||
+		contain_volatile_functions(rightop) ||
+		contain_subplans(rightop))
+		return false;
+
+	*strategy = get_op_opfamily_strategy(opno, pd->opfamily);
+	if (*strategy == 0)
+		return false;
+
+	valtype = exprType(rightop);
+	if (valtype != pd->keytype)
+	{
+		rightop = coerce_to_target_type(NULL, rightop, valtype,
+										pd->keytype, -1,
+										COERCION_IMPLICIT,
+										COERCE_IMPLICIT_CAST,
+										-1);
+		if (rightop == NULL || contain_volatile_functions(rightop))
+			return false;
+	}
+	*valexpr = (Expr *) rightop;
+	return true;
+}
+
+/*
+ * partition_prune_by_values
+ *
+ * Return the set of indexes of the partitions that might contain rows for
+ * which "key <op> value" holds for each of the 'nconds' given strategies
+ * and values.  A null value matches nothing, as the operators are strict.
+ */
+Bitmapset *
+partition_prune_by_values(PartitionDesc pd, int nconds,
+						  const int *strategies,
+						  const Datum *values, const bool *isnulls)
+{
+	Bitmapset  *result = NULL;
+	int			i;
+
+	for (i = 0; i < nconds; i++)
+	{
+		if (isnulls[i])
+			return NULL;
+	}
+
+	for (i = 0; i < pd->nparts; i++)
+		result = bms_add_member(result, i);
+
+	for (i = 0; i < nconds && !bms_is_empty(result); i++)
+	{
+		Bitmapset  *matching;
+
+		matching = partition_matching(pd, strategies[i], values[i]);
+		result = bms_int_members(result, matching);
+		bms_free(matching);
+	}
+
+	return result;
+}
+
+/*
+ * partition_copy_desc
+ *		Copy a partition descriptor into the current memory context.
+ */
+static PartitionDesc
+partition_copy_desc(PartitionDesc pd)
+{
+	PartitionDesc copy = (PartitionDesc) palloc(sizeof(PartitionDescData));
+	int			n = Max(pd->nparts, 1);
+	int			i;
+
+	memcpy(copy, pd, sizeof(PartitionDescData));
+	fmgr_info_copy(&copy->cmpfn, &pd->cmpfn, CurrentMemoryContext);
+
+	copy->oids = (Oid *) palloc(n * sizeof(Oid));
+	memcpy(copy->oids, pd->oids, n * sizeof(Oid));
+	copy->sorted_oids = (Oid *) palloc(n * sizeof(Oid));
+	memcpy(copy->sorted_oids, pd->sorted_oids, n * sizeof(Oid));
+	copy->sorted_parts = (int *) palloc(n * sizeof(int));
+	memcpy(copy->sorted_parts, pd->sorted_parts, n * sizeof(int));
+
+	if (pd->lower != NULL)
+	{
+		copy->lower = (Datum *) palloc(n * sizeof(Datum));
+		copy->lower_incl = (bool *) palloc(n * sizeof(bool));
+		copy->lower_inf = (bool *) palloc(n * sizeof(bool));
+		copy->upper = (Datum *) palloc(n * sizeof(Datum));
+		copy->upper_incl = (bool *) palloc(n * sizeof(bool));
+		copy->upper_inf = (bool *) palloc(n * sizeof(bool));
+		memcpy(copy->lower_incl, pd->lower_incl, n * sizeof(bool));
+		memcpy(copy->lower_inf, pd->lower_inf, n * sizeof(bool));
+		memcpy(copy->upper_incl, pd->upper_incl, n * sizeof(bool));
+		memcpy(copy->upper_inf, pd->upper_inf, n * sizeof(bool));
+		for (i = 0; i < pd->nparts; i++)
+		{
+			copy->lower[i] = pd->lower_inf[i] ? (Datum) 0 :
+				datumCopy(pd->lower[i], pd->keytypbyval, pd->keytyplen);
+			copy->upper[i] = pd->upper_inf[i] ? (Datum) 0 :
+				datumCopy(pd->upper[i], pd->keytypbyval, pd->keytyplen);
+		}
+	}
+
+	if (pd->values != NULL)
+	{
+		copy->values = (Datum *) palloc(pd->nvalues * sizeof(Datum));
+		copy->valueparts = (int *) palloc(pd->nvalues * sizeof(int));
+		memcpy(copy->valueparts, pd->valueparts, pd->nvalues * sizeof(int));
+		for (i = 0; i < pd->nvalues; i++)
+			copy->values[i] = datumCopy(pd->values[i],
+										pd->keytypbyval, pd->keytyplen);
+	}
+
+	return copy;
+}
+
+/*
+ * partition_is_key
+ *		Is 'node' the key column, possibly under binary-compatible casts?
+ */
+static bool
+partition_is_key(Node *node, Index varno, AttrNumber attno)
+{
+	while (node && IsA(node, RelabelType))
+		node = (Node *) ((RelabelType *) node)->arg;
+	return (node != NULL && IsA(node, Var) &&
+			((Var *) node)->varno == varno &&
+			((Var *) node)->varattno == attno &&
+			((Var *) node)->varlevelsup == 0);
+}
+
+/*
+ * partition_match_clause
+ *
+ * Does 'clause' compare column 'attno' of relation 'varno' with constants,
+ * using an operator of the key's opfamily?  If so, return the operator's
+ * btree strategy and the constants, converted to the key type.  Only
+ * equality is recognized for "= ANY (array)"; a null constant or array
+ * element makes the clause unusable.
+ */
+static bool
+partition_match_clause(PartitionDesc pd, Node *clause,
+					   Index varno, AttrNumber attno,
+					   int *strategy, List **consts)
+{
+	Node	   *leftop;
+	Node	   *rightop;
+	Oid			opno;
+	Const	   *con;
+
+	if (is_opclause(clause) && list_length(((OpExpr *) clause)->args) == 2)
+	{
+		opno = ((OpExpr *) clause)->opno;
+		leftop = get_leftop((Expr *) clause);
+		rightop = get_rightop((Expr *) clause);
+	}
+	else if (IsA(clause, ScalarArrayOpExpr) &&
+			 ((ScalarArrayOpExpr *) clause)->useOr)
+	{
+		ScalarArrayOpExpr *saop = (ScalarArrayOpExpr *) clause;
+		ArrayType  *arr;
+		int16		elmlen;
+		bool		elmbyval;
+		char		elmalign;
+		Datum	   *elems;
+		bool	   *nulls;
+		int			nelems;
+		int			i;
+
+		leftop = (Node *) linitial(saop->args);
+		rightop = (Node *) lsecond(saop->args);
+		if (!partition_is_key(leftop, varno, attno) ||
+			!IsA(rightop, Const) ||
+			((Const *) rightop)->constisnull)
+			return false;
+		if (get_op_opfamily_strategy(saop->opno, pd->opfamily) !=
+			BTEqualStrategyNumber)
+			return false;
+
+		arr = DatumGetArrayTypeP(((Const *) rightop)->constvalue);
+		get_typlenbyvalalign(ARR_ELEMTYPE(arr),
+							 &elmlen, &elmbyval, &elmalign);
+		deconstruct_array(arr, ARR_ELEMTYPE(arr),
+						  elmlen, elmbyval, elmalign,
+						  &elems, &nulls, &nelems);
+		*consts = NIL;
+		for (i = 0; i < nelems; i++)
+		{
+			if (nulls[i])
+				return false;
+			con = makeConst(ARR_ELEMTYPE(arr), -1, elmlen, elems[i],
+							false, elmbyval);
+			con = partition_coerce_const(pd, con);
+			if (con == NULL)
+				return false;
+			*consts = lappend(*consts, con);
+		}
+		*strategy = BTEqualStrategyNumber;
+		return *consts != NIL;
+	}
+	else
+		return false;
+
+	/* Put the key on the left, commuting the operator if need be */
+	if (rightop && IsA(leftop, Const))
+	{
+		Node	   *tmp = leftop;
+
+		leftop = rightop;
+		rightop = tmp;
+		opno = get_commutator(opno);
+		if (!OidIsValid(opno))
+			return false;
+	}
+	if (!partition_is_key(leftop, varno, attno) ||
+		rightop == NULL || !IsA(rightop, Const) ||
+		((Const *) rightop)->constisnull)
+		return false;
+
+	*strategy = get_op_opfamily_strategy(opno, pd->opfamily);
+	if (*strategy == 0)
+		return false;
+
+	con = partition_coerce_const(pd, (Const *) rightop);
+	if (con == NULL)
+		return false;
+	*consts = list_make1(con);
+	return true;
+}
+
+/*
+ * partition_coerce_const
+ *
+ * Convert a comparison constant to the key type, so that it can be compared
+ * with the bounds.  Cross-type operators of the key's opfamily are assumed
+ * to agree with the implicit casts between their input types.  Returns NULL
+ * if there is no such cast.
+ */
+static Const *
+partition_coerce_const(PartitionDesc pd, Const *con)
+{
+	Node	   *expr;
+
+	if (con->consttype == pd->keytype)
+		return con;
+
+	expr = coerce_to_target_type(NULL, (Node *) con, con->consttype,
+								 pd->keytype, -1,
+								 COERCION_IMPLICIT, COERCE_IMPLICIT_CAST,
+								 -1);
+	if (expr == NULL)
+		return NULL;
+	expr = eval_const_expressions(NULL, expr);
+	if (!IsA(expr, Const) || ((Const *) expr)->constisnull)
+		return NULL;
+	return (Const *) expr;
+}
+
+/*
+ * partition_compare
+ *		Compare two key values with the key's btree comparison proc.
+ */
+static int32
+partition_compare(PartitionDesc pd, Datum a, Datum b)
+{
+	return DatumGetInt32(FunctionCall2(&pd->cmpfn, a, b));
+}
+
+/*
+ * range_count_lower
+ *
+ * Return the number of range partitions whose lower bound admits 'value'
+ * (is less than 'value', if 'strict').  These are a prefix of the
+ * partitions, since they are sorted by lower bound, inclusive first.
+ */
+static int
+range_count_lower(PartitionDesc pd, Datum value, bool strict)
+{
+	int			lo = 0;
+	int			hi = pd->nparts;
+
+	while (lo < hi)
+	{
+		int			mid = (lo + hi) / 2;
+		int32		cmp;
+
+		if (pd->lower_inf[mid])
+			cmp = -1;
+		else
+			cmp = partition_compare(pd, pd->lower[mid], value);
+		if (cmp < 0 || (cmp == 0 && !strict && pd->lower_incl[mid]))
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo;
+}
+
+/*
+ * list_count_values
+ *
+ * Return the number of list values at most 'value' (less than 'value', if
+ * 'strict').
+ */
+static int
+list_count_values(PartitionDesc pd, Datum value, bool strict)
+{
+	int			lo = 0;
+	int			hi = pd->nvalues;
+
+	while (lo < hi)
+	{
+		int			mid = (lo + hi) / 2;
+		int32		cmp = partition_compare(pd, pd->values[mid], value);
+
+		if (cmp < 0 || (cmp == 0 && !strict))
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo;
+}
+
+/*
+ * partition_matching
+ *
+ * Return the set of partitions that may hold key values for which
+ * "key <op> value" is true, <op> having btree strategy 'strategy'.
+ */
+static Bitmapset *
+partition_matching(PartitionDesc pd, int strategy, Datum value)
+{
+	Bitmapset  *result = NULL;
+	int			start;
+	int			end;
+	int			i;
+
+	if (strategy == BTEqualStrategyNumber)
+	{
+		i = partition_find_for_value(pd, value, false);
+		return (i >= 0) ? bms_make_singleton(i) : NULL;
+	}
+
+	if (pd->strategy == PARTITION_STRATEGY_LIST)
+	{
+		switch (strategy)
+		{
+			case BTLessStrategyNumber:
+				start = 0;
+				end = list_count_values(pd, value, true);
+				break;
+			case BTLessEqualStrategyNumber:
+				start = 0;
+				end = list_count_values(pd, value, false);
+				break;
+			case BTGreaterEqualStrategyNumber:
+				start = list_count_values(pd, value, true);
+				end = pd->nvalues;
+				break;
+			case BTGreaterStrategyNumber:
+				start = list_count_values(pd, value, false);
+				end = pd->nvalues;
+				break;
+			default:
+				elog(ERROR, "unrecognized btree strategy number: %d",
+					 strategy);
+				start = end = 0;	/* keep compiler quiet */
+				break;
+		}
+		for (i = start; i < end; i++)
+			result = bms_add_member(result, pd->valueparts[i]);
+		return result;
+	}
+
+	switch (strategy)
+	{
+		case BTLessStrategyNumber:
+			start = 0;
+			end = range_count_lower(pd, value, true);
+			break;
+		case BTLessEqualStrategyNumber:
+			start = 0;
+			end = range_count_lower(pd, value, false);
+			break;
+		case BTGreaterEqualStrategyNumber:
+		case BTGreaterStrategyNumber:
+
+			/*
+			 * Partitions after the last one whose lower bound admits value
+			 * hold only keys above it; that one qualifies only if its upper
+			 * bound admits keys at or above value (above it, for ">").
+			 */
+			start = range_count_lower(pd, value, false) - 1;
+			if (start < 0)
+				start = 0;
+			else if (!pd->upper_inf[start])
+			{
+				int32		cmp = partition_compare(pd, pd->upper[start],
+													value);
+
+				if (cmp < 0 ||
+					(cmp == 0 && (strategy == BTGreaterStrategyNumber ||
+								  !pd->upper_incl[start])))
+					start++;
+			}
+			end = pd->nparts;
+			break;
+		default:
+			elog(ERROR, "unrecognized btree strategy number: %d",
+				 strategy);
+			start = end = 0;	/* keep compiler quiet */
+			break;
+	}
+	for (i = start; i < end; i++)
+		result = bms_add_member(result, i);
+	return result;
+}
+
+/*
+ * qsort_arg comparator for range bounds: unbounded lower ends first, and
+ * an inclusive bound before an exclusive one of the same value
+ */
+static int
+range_bound_cmp(const void *a, const void *b, void *arg)
+{
+	const PartitionRangeBound *ra = (const PartitionRangeBound *) a;
+	const PartitionRangeBound *rb = (const PartitionRangeBound *) b;
+	int32		cmp;
+
+	if (ra->lower_inf)
+		return rb->lower_inf ? 0 : -1;
+	if (rb->lower_inf)
+		return 1;
+	cmp = partition_compare((PartitionDesc) arg, ra->lower, rb->lower);
+	if (cmp != 0 || ra->lower_incl == rb->lower_incl)
+		return cmp;
+	return ra->lower_incl ? -1 : 1;
+}
+
+/*
+ * qsort_arg comparator for list values
+ */
+static int
+list_value_cmp(const void *a, const void *b, void *arg)
+{
+	return partition_compare((PartitionDesc) arg,
+							 ((const PartitionListValue *) a)->value,
+							 ((const PartitionListValue *) b)->value);
+}
+
+/*
+ * qsort_arg comparator ordering partition indexes by partition OID
+ */
+static int
+oid_index_cmp(const void *a, const void *b, void *arg)
+{
+	PartitionDesc pd = (PartitionDesc) arg;
+	Oid			oa = pd->oids[*(const int *) a];
+	Oid			ob = pd->oids[*(const int *) b];
+
+	if (oa < ob)
+		return -1;
+	if (oa > ob)
+		return 1;
+	return 0;
+}
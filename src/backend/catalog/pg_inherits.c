@@ -28,9 +28,18 @@
 #include "parser/parse_type.h"
 #include "storage/lmgr.h"
 #include "utils/fmgroids.h"
+#include "utils/hsearch.h"
+#include "utils/memutils.h"
 #include "utils/syscache.h"
 #include "utils/tqual.h"
 
+/* Entry in find_all_inheritors' table of the rels found so far */
+typedef struct SeenRelsEntry
+{
+	Oid			rel_id;			/* hash key --- must be first */
+	ListCell   *numparents_cell;	/* its member of the numparents list */
+} SeenRelsEntry;
+
 static int	oid_cmp(const void *p1, const void *p2);
 
 
@@ -160,6 +169,9 @@ find_all_inheritors(Oid parentrelId, LOCKMODE lockmode, List **numparents)
 {
 	List	   *rels_list,
 			   *rel_numparents;
+	HASHCTL		ctl;
+	HTAB	   *seen_rels;
+	SeenRelsEntry *hash_entry;
 	ListCell   *l;
 
 	/*
@@ -168,9 +180,26 @@ find_all_inheritors(Oid parentrelId, LOCKMODE lockmode, List **numparents)
 	 * already-found rels and the agenda of rels yet to be scanned for more
 	 * children.  This is a bit tricky but works because the foreach() macro
 	 * doesn't fetch the next list element until the bottom of the loop.
+	 *
+	 * To find out quickly whether a rel has been seen already, we also keep
+	 * the rels in a hash table; searching the list instead would make this
+	 * quadratic in the number of children.
 	 */
+	memset(&ctl, 0, sizeof(ctl));
+	ctl.keysize = sizeof(Oid);
+	ctl.entrysize = sizeof(SeenRelsEntry);
+	ctl.hash = oid_hash;
+	ctl.hcxt = CurrentMemoryContext;
+	seen_rels = hash_create("find_all_inheritors temporary table",
+							32,
+							&ctl,
+							HASH_ELEM | HASH_FUNCTION | HASH_CONTEXT);
+
 	rels_list = list_make1_oid(parentrelId);
 	rel_numparents = list_make1_int(0);
+	hash_entry = (SeenRelsEntry *) hash_search(seen_rels, &parentrelId,
+											   HASH_ENTER, NULL);
+	hash_entry->numparents_cell = list_head(rel_numparents);
 
 	foreach(l, rels_list)
 	{
@@ -191,30 +220,26 @@ find_all_inheritors(Oid parentrelId, LOCKMODE lockmode, List **numparents)
 		foreach(lc, currentchildren)
 		{
 			Oid			child_oid = lfirst_oid(lc);
-			bool		found = false;
-			ListCell   *lo;
-			ListCell   *li;
+			bool		found;
 
-			/* if the rel is already there, bump number-of-parents counter */
-			forboth(lo, rels_list, li, rel_numparents)
-			{
-				if (lfirst_oid(lo) == child_oid)
-				{
-					lfirst_int(li)++;
-					found = true;
-					break;
-				}
-			}
+			hash_entry = (SeenRelsEntry *) hash_search(seen_rels, &child_oid,
+													   HASH_ENTER, &found);
 
-			/* if it's not there, add it. expect 1 parent, initially. */
-			if (!found)
+			/* if the rel is already there, bump number-of-parents counter */
+			if (found)
+				lfirst_int(hash_entry->numparents_cell)++;
+			else
 			{
+				/* if it's not there, add it. expect 1 parent, initially. */
 				rels_list = lappend_oid(rels_list, child_oid);
 				rel_numparents = lappend_int(rel_numparents, 1);
+				hash_entry->numparents_cell = list_tail(rel_numparents);
 			}
 		}
 	}
 
+	hash_destroy(seen_rels);
+
 	if (numparents)
 		*numparents = rel_numparents;
 	else
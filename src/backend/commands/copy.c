@@ -27,6 +27,7 @@
 #include "commands/copy.h"
 #include "commands/defrem.h"
 #include "commands/trigger.h"
+#include "executor/execPartition.h"
 #include "executor/executor.h"
 #include "libpq/libpq.h"
 #include "libpq/pqformat.h"
@@ -1811,6 +1812,10 @@ CopyFrom(CopyState cstate)
 	estate->es_num_result_relations = 1;
 	estate->es_result_relation_info = resultRelInfo;
 
+	/* Rows copied into a partitioned table go to its partitions */
+	if (RelationGetPartitionKey(cstate->rel) != NULL)
+		ExecSetupPartitionRouting(resultRelInfo, estate, true);
+
 	/* Set up a tuple slot too */
 	slot = ExecInitExtraTupleSlot(estate);
 	ExecSetSlotDescriptor(slot, tupDesc);
@@ -2151,27 +2156,51 @@ CopyFrom(CopyState cstate)
 		if (!skip_tuple)
 		{
 			List	   *recheckIndexes = NIL;
+			ResultRelInfo *targetRelInfo = resultRelInfo;
+			TupleTableSlot *targetSlot = slot;
+			BulkInsertState targetBistate = bistate;
+			int			target_options = hi_options;
 
 			/* Place tuple in tuple slot */
 			ExecStoreTuple(tuple, slot, InvalidBuffer, false);
 
+			/*
+			 * If the table is partitioned, store the tuple in the partition
+			 * it belongs in.  The WAL and FSM shortcuts in hi_options were
+			 * only established for the table itself, so don't use them.
+			 */
+			if (resultRelInfo->ri_PartitionDispatch)
+			{
+				targetRelInfo = ExecRouteTuple(resultRelInfo,
+											   &targetSlot, &tuple,
+											   estate, &targetBistate);
+				if (targetRelInfo == NULL)		/* "do nothing" */
+					continue;
+				target_options = 0;
+				estate->es_result_relation_info = targetRelInfo;
+			}
+
 			/* Check the constraints of the tuple */
-			if (cstate->rel->rd_att->constr)
-				ExecConstraints(resultRelInfo, slot, estate);
+			if (targetRelInfo->ri_RelationDesc->rd_att->constr)
+				ExecConstraints(targetRelInfo, targetSlot, estate);
 
 			/* OK, store the tuple and create index entries for it */
-			heap_insert(cstate->rel, tuple, mycid, hi_options, bistate);
+			heap_insert(targetRelInfo->ri_RelationDesc, tuple, mycid,
+						target_options, targetBistate);
 
-			if (resultRelInfo->ri_NumIndices > 0)
-				recheckIndexes = ExecInsertIndexTuples(slot, &(tuple->t_self),
+			if (targetRelInfo->ri_NumIndices > 0)
+				recheckIndexes = ExecInsertIndexTuples(targetSlot,
+													   &(tuple->t_self),
 													   estate);
 
 			/* AFTER ROW INSERT Triggers */
-			ExecARInsertTriggers(estate, resultRelInfo, tuple,
+			ExecARInsertTriggers(estate, targetRelInfo, tuple,
 								 recheckIndexes);
 
 			list_free(recheckIndexes);
 
+			estate->es_result_relation_info = resultRelInfo;
+
 			/*
 			 * We count only tuples not suppressed by a BEFORE INSERT trigger;
 			 * this is the same definition used by execMain.c for counting
@@ -2203,6 +2232,8 @@ CopyFrom(CopyState cstate)
 	pfree(defmap);
 	pfree(defexprs);
 
+	ExecCleanupPartitionRouting(resultRelInfo);
+
 	ExecResetTupleTable(estate->es_tupleTable, false);
 
 	ExecCloseIndices(resultRelInfo);
@@ -69,6 +69,8 @@ static void show_upper_qual(List *qual, const char *qlabel, Plan *plan,
 static void show_sort_keys(Plan *sortplan, ExplainState *es);
 static void show_sort_info(SortState *sortstate, ExplainState *es);
 static void show_hash_info(HashState *hashstate, ExplainState *es);
+static void show_memoize_info(MemoizeState *mstate, Plan *outer_plan,
+				  ExplainState *es);
 static const char *explain_get_index_name(Oid indexId);
 static void ExplainScanTarget(Scan *plan, ExplainState *es);
 static void ExplainMemberNodes(List *plans, PlanState **planstate,
@@ -645,6 +647,9 @@ ExplainNode(Plan *plan, PlanState *planstate,
 		case T_Append:
 			pname = sname = "Append";
 			break;
+		case T_MergeAppend:
+			pname = sname = "Merge Append";
+			break;
 		case T_RecursiveUnion:
 			pname = sname = "Recursive Union";
 			break;
@@ -669,7 +674,10 @@ ExplainNode(Plan *plan, PlanState *planstate,
 			pname = sname = "Seq Scan";
 			break;
 		case T_IndexScan:
-			pname = sname = "Index Scan";
+			if (((IndexScan *) plan)->indexonly)
+				pname = sname = "Index Only Scan";
+			else
+				pname = sname = "Index Scan";
 			break;
 		case T_BitmapIndexScan:
 			pname = sname = "Bitmap Index Scan";
@@ -698,9 +706,15 @@ ExplainNode(Plan *plan, PlanState *planstate,
 		case T_Material:
 			pname = sname = "Materialize";
 			break;
+		case T_Memoize:
+			pname = sname = "Memoize";
+			break;
 		case T_Sort:
 			pname = sname = "Sort";
 			break;
+		case T_IncrementalSort:
+			pname = sname = "Incremental Sort";
+			break;
 		case T_Group:
 			pname = sname = "Group";
 			break;
@@ -1008,6 +1022,9 @@ ExplainNode(Plan *plan, PlanState *planstate,
 			show_scan_qual(((IndexScan *) plan)->indexqualorig,
 						   "Index Cond", plan, outer_plan, es);
 			show_scan_qual(plan->qual, "Filter", plan, outer_plan, es);
+			if (es->analyze && ((IndexScan *) plan)->indexonly)
+				ExplainPropertyLong("Heap Fetches",
+							((IndexScanState *) planstate)->iss_HeapFetches, es);
 			break;
 		case T_BitmapIndexScan:
 			show_scan_qual(((BitmapIndexScan *) plan)->indexqualorig,
@@ -1066,6 +1083,26 @@ ExplainNode(Plan *plan, PlanState *planstate,
 			show_sort_keys(plan, es);
 			show_sort_info((SortState *) planstate, es);
 			break;
+		case T_IncrementalSort:
+		case T_MergeAppend:
+			show_sort_keys(plan, es);
+			break;
+		case T_Append:
+			{
+				AppendState *astate = (AppendState *) planstate;
+				int			nremoved = 0;
+				int			i;
+
+				/* Subplans pruned at executor startup have no state */
+				for (i = 0; i < astate->as_nplans; i++)
+				{
+					if (astate->appendplans[i] == NULL)
+						nremoved++;
+				}
+				if (nremoved > 0)
+					ExplainPropertyInteger("Subplans Removed", nremoved, es);
+			}
+			break;
 		case T_Result:
 			show_upper_qual((List *) ((Result *) plan)->resconstantqual,
 							"One-Time Filter", plan, es);
@@ -1074,6 +1111,9 @@ ExplainNode(Plan *plan, PlanState *planstate,
 		case T_Hash:
 			show_hash_info((HashState *) planstate, es);
 			break;
+		case T_Memoize:
+			show_memoize_info((MemoizeState *) planstate, outer_plan, es);
+			break;
 		default:
 			break;
 	}
@@ -1162,6 +1202,7 @@ ExplainNode(Plan *plan, PlanState *planstate,
 		innerPlan(plan) ||
 		IsA(plan, ModifyTable) ||
 		IsA(plan, Append) ||
+		IsA(plan, MergeAppend) ||
 		IsA(plan, BitmapAnd) ||
 		IsA(plan, BitmapOr) ||
 		IsA(plan, SubqueryScan) ||
@@ -1179,10 +1220,12 @@ ExplainNode(Plan *plan, PlanState *planstate,
 		/*
 		 * Ordinarily we don't pass down our own outer_plan value to our child
 		 * nodes, but in bitmap scan trees we must, since the bottom
-		 * BitmapIndexScan nodes may have outer references.
+		 * BitmapIndexScan nodes may have outer references.  Likewise for the
+		 * inner indexscan below a Memoize.
 		 */
 		ExplainNode(outerPlan(plan), outerPlanState(planstate),
-					IsA(plan, BitmapHeapScan) ? outer_plan : NULL,
+					(IsA(plan, BitmapHeapScan) ||
+					 IsA(plan, Memoize)) ? outer_plan : NULL,
 					"Outer", NULL, es);
 	}
 
@@ -1207,6 +1250,11 @@ ExplainNode(Plan *plan, PlanState *planstate,
 							   ((AppendState *) planstate)->appendplans,
 							   outer_plan, es);
 			break;
+		case T_MergeAppend:
+			ExplainMemberNodes(((MergeAppend *) plan)->mergeplans,
+							   ((MergeAppendState *) planstate)->mergeplans,
+							   outer_plan, es);
+			break;
 		case T_BitmapAnd:
 			ExplainMemberNodes(((BitmapAnd *) plan)->bitmapplans,
 							   ((BitmapAndState *) planstate)->bitmapplans,
@@ -1264,7 +1312,7 @@ show_plan_tlist(Plan *plan, ExplainState *es)
 	if (plan->targetlist == NIL)
 		return;
 	/* The tlist of an Append isn't real helpful, so suppress it */
-	if (IsA(plan, Append))
+	if (IsA(plan, Append) || IsA(plan, MergeAppend))
 		return;
 	/* Likewise for RecursiveUnion */
 	if (IsA(plan, RecursiveUnion))
@@ -1354,22 +1402,38 @@ show_upper_qual(List *qual, const char *qlabel, Plan *plan, ExplainState *es)
 }
 
 /*
- * Show the sort keys for a Sort node.
+ * Show the sort keys for a Sort, IncrementalSort or MergeAppend node.
  */
 static void
 show_sort_keys(Plan *sortplan, ExplainState *es)
 {
-	int			nkeys = ((Sort *) sortplan)->numCols;
-	AttrNumber *keycols = ((Sort *) sortplan)->sortColIdx;
+	int			nkeys;
+	AttrNumber *keycols;
 	List	   *context;
 	List	   *result = NIL;
+	List	   *presorted = NIL;
+	int			npresorted = 0;
 	bool		useprefix;
 	int			keyno;
 	char	   *exprstr;
 
+	if (IsA(sortplan, MergeAppend))
+	{
+		nkeys = ((MergeAppend *) sortplan)->numCols;
+		keycols = ((MergeAppend *) sortplan)->sortColIdx;
+	}
+	else
+	{
+		nkeys = ((Sort *) sortplan)->numCols;
+		keycols = ((Sort *) sortplan)->sortColIdx;
+	}
+
 	if (nkeys <= 0)
 		return;
 
+	if (IsA(sortplan, IncrementalSort))
+		npresorted = ((IncrementalSort *) sortplan)->presortedCols;
+
 	/* Set up deparsing context */
 	context = deparse_context_for_plan((Node *) sortplan,
 									   NULL,
@@ -1389,9 +1453,13 @@ show_sort_keys(Plan *sortplan, ExplainState *es)
 		exprstr = deparse_expression((Node *) target->expr, context,
 									 useprefix, true);
 		result = lappend(result, exprstr);
+		if (keyno < npresorted)
+			presorted = lappend(presorted, exprstr);
 	}
 
 	ExplainPropertyList("Sort Key", result, es);
+	if (npresorted > 0)
+		ExplainPropertyList("Presorted Key", presorted, es);
 }
 
 /*
@@ -1468,6 +1536,48 @@ show_hash_info(HashState *hashstate, ExplainState *es)
 	}
 }
 
+/*
+ * Show the cache key of a Memoize node, and how well the cache did.
+ */
+static void
+show_memoize_info(MemoizeState *mstate, Plan *outer_plan, ExplainState *es)
+{
+	Plan	   *plan = mstate->ps.plan;
+	List	   *context;
+	List	   *result = NIL;
+	ListCell   *lc;
+
+	/* The keys refer to the outer rel, so always qualify them */
+	context = deparse_context_for_plan((Node *) plan,
+									   (Node *) outer_plan,
+									   es->rtable,
+									   es->pstmt->subplans);
+	foreach(lc, ((Memoize *) plan)->paramExprs)
+		result = lappend(result,
+						 deparse_expression((Node *) lfirst(lc), context,
+											true, false));
+	ExplainPropertyList("Cache Key", result, es);
+
+	if (!es->analyze)
+		return;
+
+	if (es->format == EXPLAIN_FORMAT_TEXT)
+	{
+		appendStringInfoSpaces(es->str, es->indent * 2);
+		appendStringInfo(es->str,
+						 "Hits: %ld  Misses: %ld  Evictions: %ld  Overflows: %ld\n",
+						 mstate->hits, mstate->misses,
+						 mstate->evictions, mstate->overflows);
+	}
+	else
+	{
+		ExplainPropertyLong("Cache Hits", mstate->hits, es);
+		ExplainPropertyLong("Cache Misses", mstate->misses, es);
+		ExplainPropertyLong("Cache Evictions", mstate->evictions, es);
+		ExplainPropertyLong("Cache Overflows", mstate->overflows, es);
+	}
+}
+
 /*
  * Fetch the name of an index in an EXPLAIN
  *
@@ -1599,6 +1709,9 @@ ExplainScanTarget(Scan *plan, ExplainState *es)
  * Ordinarily we don't pass down outer_plan to our child nodes, but in these
  * cases we must, since the node could be an "inner indexscan" in which case
  * outer references can appear in the child nodes.
+ *
+ * Members with no PlanState (Append subplans pruned at executor startup)
+ * are not shown.
  */
 static void
 ExplainMemberNodes(List *plans, PlanState **planstate, Plan *outer_plan,
@@ -1611,6 +1724,11 @@ ExplainMemberNodes(List *plans, PlanState **planstate, Plan *outer_plan,
 	{
 		Plan	   *subnode = (Plan *) lfirst(lst);
 
+		if (planstate[j] == NULL)
+		{
+			j++;
+			continue;
+		}
 		ExplainNode(subnode, planstate[j],
 					outer_plan,
 					"Member", NULL,
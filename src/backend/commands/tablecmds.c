@@ -7711,6 +7711,12 @@ ATExecDropInherit(Relation rel, RangeVar *parent)
 	systable_endscan(scan);
 	heap_close(catalogRelation, RowExclusiveLock);
 
+	/*
+	 * The parent's partition bounds, if any, are derived from its set of
+	 * children, so make sure they get recomputed.
+	 */
+	CacheInvalidateRelcache(parent_rel);
+
 	/* keep our lock on the parent relation until commit */
 	heap_close(parent_rel, NoLock);
 }
@@ -74,8 +74,9 @@
 #define LAZY_ALLOC_TUPLES		MaxHeapTuplesPerPage
 
 /*
- * Before we consider skipping a page that's marked as clean in
- * visibility map, we must've seen at least this many clean pages.
+ * Before we consider skipping a page that's marked as clean (or, in an
+ * anti-wraparound vacuum, as frozen) in the visibility map, we must've seen
+ * at least this many such pages.
  */
 #define SKIP_PAGES_THRESHOLD	32
 
@@ -84,6 +85,7 @@ typedef struct LVRelStats
 	/* hasindex = true means two-pass strategy; false means one-pass */
 	bool		hasindex;
 	bool		scanned_all;	/* have we scanned all pages (this far)? */
+	bool		scanned_unfrozen;	/* ... all but all-frozen pages? */
 	/* Overall statistics about rel */
 	BlockNumber rel_pages;
 	double		old_rel_tuples; /* previous value of pg_class.reltuples */
@@ -176,6 +178,8 @@ lazy_vacuum_rel(Relation onerel, VacuumStmt *vacstmt,
 	vacrelstats = (LVRelStats *) palloc0(sizeof(LVRelStats));
 
 	vacrelstats->scanned_all = true;	/* will be cleared if we skip a page */
+	vacrelstats->scanned_unfrozen = true;	/* cleared if we skip one that
+											 * isn't all-frozen */
 	vacrelstats->old_rel_tuples = onerel->rd_rel->reltuples;
 	vacrelstats->num_index_scans = 0;
 
@@ -211,10 +215,22 @@ lazy_vacuum_rel(Relation onerel, VacuumStmt *vacstmt,
 	 * accurate in any case, but because we use the reltuples / relpages ratio
 	 * in the planner, it's better to not update relpages either if we can't
 	 * update reltuples.
+	 *
+	 * If the only pages we skipped were all-frozen ones, we can still advance
+	 * relfrozenxid, since those pages contain no xid that needs freezing.
+	 * Keep the old size estimates in that case; ANALYZE will update them.
 	 */
 	if (vacrelstats->scanned_all)
 		vac_update_relstats(onerel,
 							vacrelstats->rel_pages, vacrelstats->rel_tuples,
+							visibilitymap_count(onerel),
+							vacrelstats->hasindex,
+							FreezeLimit);
+	else if (vacrelstats->scanned_unfrozen)
+		vac_update_relstats(onerel,
+							onerel->rd_rel->relpages,
+							vacrelstats->old_rel_tuples,
+							visibilitymap_count(onerel),
 							vacrelstats->hasindex,
 							FreezeLimit);
 
@@ -307,7 +323,8 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 	int			i;
 	PGRUsage	ru0;
 	Buffer		vmbuffer = InvalidBuffer;
-	BlockNumber all_visible_streak;
+	BlockNumber skippable_streak;
+	XLogRecPtr	InvalidXLogRecPtr = {0, 0};
 
 	pg_rusage_init(&ru0);
 
@@ -330,7 +347,7 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 
 	lazy_space_alloc(vacrelstats, nblocks);
 
-	all_visible_streak = 0;
+	skippable_streak = 0;
 	for (blkno = 0; blkno < nblocks; blkno++)
 	{
 		Buffer		buf;
@@ -343,36 +360,40 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 		OffsetNumber frozen[MaxOffsetNumber];
 		int			nfrozen;
 		Size		freespace;
-		bool		all_visible_according_to_vm = false;
+		uint8		vmstatus;
+		uint8		vmflags;
 		bool		all_visible;
+		bool		all_frozen;
+		TransactionId visibility_cutoff_xid;
 
 		/*
 		 * Skip pages that don't require vacuuming according to the visibility
-		 * map. But only if we've seen a streak of at least
-		 * SKIP_PAGES_THRESHOLD pages marked as clean. Since we're reading
-		 * sequentially, the OS should be doing readahead for us and there's
-		 * no gain in skipping a page now and then. You need a longer run of
-		 * consecutive skipped pages before it's worthwhile. Also, skipping
-		 * even a single page means that we can't update relfrozenxid or
-		 * reltuples, so we only want to do it if there's a good chance to
-		 * skip a goodly number of pages.
+		 * map. An anti-wraparound vacuum must visit every page that might
+		 * contain an unfrozen xid, so it can only skip pages marked
+		 * all-frozen. But only skip if we've seen a streak of at least
+		 * SKIP_PAGES_THRESHOLD pages that could be skipped. Since we're
+		 * reading sequentially, the OS should be doing readahead for us and
+		 * there's no gain in skipping a page now and then. You need a longer
+		 * run of consecutive skipped pages before it's worthwhile. Also,
+		 * skipping even a single page means that we can't update reltuples,
+		 * nor relfrozenxid unless the page was all-frozen, so we only want to
+		 * do it if there's a good chance to skip a goodly number of pages.
 		 */
-		if (!scan_all)
+		vmstatus = visibilitymap_get_status(onerel, blkno, &vmbuffer);
+		if (vmstatus & (scan_all ? VISIBILITYMAP_ALL_FROZEN :
+						VISIBILITYMAP_ALL_VISIBLE))
 		{
-			all_visible_according_to_vm =
-				visibilitymap_test(onerel, blkno, &vmbuffer);
-			if (all_visible_according_to_vm)
+			skippable_streak++;
+			if (skippable_streak >= SKIP_PAGES_THRESHOLD)
 			{
-				all_visible_streak++;
-				if (all_visible_streak >= SKIP_PAGES_THRESHOLD)
-				{
-					vacrelstats->scanned_all = false;
-					continue;
-				}
+				vacrelstats->scanned_all = false;
+				if (!(vmstatus & VISIBILITYMAP_ALL_FROZEN))
+					vacrelstats->scanned_unfrozen = false;
+				continue;
 			}
-			else
-				all_visible_streak = 0;
 		}
+		else
+			skippable_streak = 0;
 
 		vacuum_delay_point();
 
@@ -401,6 +422,13 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 			vacrelstats->num_index_scans++;
 		}
 
+		/*
+		 * Pin the visibility map page now, in case we need to set bits for
+		 * this page below.  Doing that while we still hold the buffer lock
+		 * ensures nobody can put a new xid on the page in between.
+		 */
+		visibilitymap_pin(onerel, blkno, &vmbuffer);
+
 		buf = ReadBufferExtended(onerel, MAIN_FORKNUM, blkno,
 								 RBM_NORMAL, vac_strategy);
 
@@ -462,19 +490,13 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 				SetBufferCommitInfoNeedsSave(buf);
 			}
 
-			LockBuffer(buf, BUFFER_LOCK_UNLOCK);
-
-			/* Update the visibility map */
-			if (!all_visible_according_to_vm)
-			{
-				visibilitymap_pin(onerel, blkno, &vmbuffer);
-				LockBuffer(buf, BUFFER_LOCK_SHARE);
-				if (PageIsAllVisible(page))
-					visibilitymap_set(onerel, blkno, PageGetLSN(page), &vmbuffer);
-				LockBuffer(buf, BUFFER_LOCK_UNLOCK);
-			}
+			/* Update the visibility map; an empty page is trivially frozen */
+			vmflags = VISIBILITYMAP_ALL_VISIBLE | VISIBILITYMAP_ALL_FROZEN;
+			if ((vmstatus & vmflags) != vmflags)
+				visibilitymap_set(onerel, blkno, InvalidXLogRecPtr, &vmbuffer,
+								  InvalidTransactionId, vmflags);
 
-			ReleaseBuffer(buf);
+			UnlockReleaseBuffer(buf);
 			RecordPageWithFreeSpace(onerel, blkno, freespace);
 			continue;
 		}
@@ -491,6 +513,8 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 		 * requiring freezing.
 		 */
 		all_visible = true;
+		all_frozen = true;
+		visibility_cutoff_xid = InvalidTransactionId;
 		nfrozen = 0;
 		hastup = false;
 		prev_dead_count = vacrelstats->num_dead_tuples;
@@ -601,6 +625,11 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 							all_visible = false;
 							break;
 						}
+
+						/* Track newest xmin on page, for hot standby. */
+						if (TransactionIdIsNormal(xmin) &&
+							TransactionIdFollows(xmin, visibility_cutoff_xid))
+							visibility_cutoff_xid = xmin;
 					}
 					break;
 				case HEAPTUPLE_RECENTLY_DEAD:
@@ -644,6 +673,10 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 				if (heap_freeze_tuple(tuple.t_data, FreezeLimit,
 									  InvalidBuffer))
 					frozen[nfrozen++] = offnum;
+
+				/* Is it frozen now, or does it still hold a recent xid? */
+				if (!heap_tuple_is_frozen(tuple.t_data))
+					all_frozen = false;
 			}
 		}						/* scan along page */
 
@@ -702,22 +735,34 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 			 * updating the visibility map, but since this case shouldn't
 			 * happen anyway, don't worry about that.
 			 */
-			visibilitymap_clear(onerel, blkno);
+			visibilitymap_clear(onerel, blkno, VISIBILITYMAP_VALID_BITS);
+		}
+		else if (all_visible && !all_frozen &&
+				 (vmstatus & VISIBILITYMAP_ALL_FROZEN))
+		{
+			/*
+			 * A tuple locker may have stored its xid on the page and not yet
+			 * cleared the all-frozen bit; or the bit was wrong.  Either way
+			 * it's safe to clear it ourselves.
+			 */
+			visibilitymap_clear(onerel, blkno, VISIBILITYMAP_ALL_FROZEN);
 		}
 
-		LockBuffer(buf, BUFFER_LOCK_UNLOCK);
-
-		/* Update the visibility map */
-		if (!all_visible_according_to_vm && all_visible)
+		/*
+		 * Update the visibility map.  We still hold the lock on the heap
+		 * page, so it can't have changed since we looked at it.
+		 */
+		if (all_visible)
 		{
-			visibilitymap_pin(onerel, blkno, &vmbuffer);
-			LockBuffer(buf, BUFFER_LOCK_SHARE);
-			if (PageIsAllVisible(page))
-				visibilitymap_set(onerel, blkno, PageGetLSN(page), &vmbuffer);
-			LockBuffer(buf, BUFFER_LOCK_UNLOCK);
+			vmflags = VISIBILITYMAP_ALL_VISIBLE;
+			if (all_frozen)
+				vmflags |= VISIBILITYMAP_ALL_FROZEN;
+			if ((vmstatus & vmflags) != vmflags)
+				visibilitymap_set(onerel, blkno, InvalidXLogRecPtr, &vmbuffer,
+								  visibility_cutoff_xid, vmflags);
 		}
 
-		ReleaseBuffer(buf);
+		UnlockReleaseBuffer(buf);
 
 		/* Remember the location of the last page with nonremovable tuples */
 		if (hastup)
@@ -966,7 +1011,7 @@ lazy_cleanup_index(Relation indrel,
 	if (!stats->estimated_count)
 		vac_update_relstats(indrel,
 							stats->num_pages, stats->num_index_tuples,
-							false, InvalidTransactionId);
+							0, false, InvalidTransactionId);
 
 	ereport(elevel,
 			(errmsg("index \"%s\" now contains %.0f row versions in %u pages",
@@ -26,10 +26,13 @@
 #include "executor/nodeGroup.h"
 #include "executor/nodeHash.h"
 #include "executor/nodeHashjoin.h"
+#include "executor/nodeIncrementalSort.h"
 #include "executor/nodeIndexscan.h"
 #include "executor/nodeLimit.h"
 #include "executor/nodeLockRows.h"
 #include "executor/nodeMaterial.h"
+#include "executor/nodeMemoize.h"
+#include "executor/nodeMergeAppend.h"
 #include "executor/nodeMergejoin.h"
 #include "executor/nodeModifyTable.h"
 #include "executor/nodeNestloop.h"
@@ -137,6 +140,10 @@ ExecReScan(PlanState *node, ExprContext *exprCtxt)
 			ExecReScanAppend((AppendState *) node, exprCtxt);
 			break;
 
+		case T_MergeAppendState:
+			ExecReScanMergeAppend((MergeAppendState *) node, exprCtxt);
+			break;
+
 		case T_RecursiveUnionState:
 			ExecRecursiveUnionReScan((RecursiveUnionState *) node, exprCtxt);
 			break;
@@ -205,10 +212,19 @@ ExecReScan(PlanState *node, ExprContext *exprCtxt)
 			ExecMaterialReScan((MaterialState *) node, exprCtxt);
 			break;
 
+		case T_MemoizeState:
+			ExecReScanMemoize((MemoizeState *) node, exprCtxt);
+			break;
+
 		case T_SortState:
 			ExecReScanSort((SortState *) node, exprCtxt);
 			break;
 
+		case T_IncrementalSortState:
+			ExecReScanIncrementalSort((IncrementalSortState *) node,
+									  exprCtxt);
+			break;
+
 		case T_GroupState:
 			ExecReScanGroup((GroupState *) node, exprCtxt);
 			break;
@@ -452,6 +452,47 @@ FindTupleHashEntry(TupleHashTable hashtable, TupleTableSlot *slot,
 	return entry;
 }
 
+/*
+ * Remove the hashtable entry for the tuple group containing the given
+ * tuple, which must be the same type as the hashtable entries.  Returns
+ * false if there is no such entry.
+ *
+ * The entry's firstTuple, and anything else the caller hung off the entry,
+ * is not freed here.  Fetch what's needed from the entry beforehand: its
+ * space is recycled for the next entry created.
+ */
+bool
+RemoveTupleHashEntry(TupleHashTable hashtable, TupleTableSlot *slot)
+{
+	MemoryContext oldContext;
+	TupleHashTable saveCurHT;
+	TupleHashEntryData dummy;
+	bool		found;
+
+	/* Need to run the hash functions in short-lived context */
+	oldContext = MemoryContextSwitchTo(hashtable->tempcxt);
+
+	/* Set up data needed by hash and match functions, as above */
+	hashtable->inputslot = slot;
+	hashtable->in_hash_funcs = hashtable->tab_hash_funcs;
+	hashtable->cur_eq_funcs = hashtable->tab_eq_funcs;
+
+	saveCurHT = CurTupleHashTable;
+	CurTupleHashTable = hashtable;
+
+	dummy.firstTuple = NULL;	/* flag to reference inputslot */
+	(void) hash_search(hashtable->hashtab,
+					   &dummy,
+					   HASH_REMOVE,
+					   &found);
+
+	CurTupleHashTable = saveCurHT;
+
+	MemoryContextSwitchTo(oldContext);
+
+	return found;
+}
+
 /*
  * Compute the hash value for a tuple
  *
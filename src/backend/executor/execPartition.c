@@ -0,0 +1,337 @@
+/*-------------------------------------------------------------------------
+ *
+ * execPartition.c
+ *	  routines for routing tuples inserted into a partitioned table to the
+ *	  partitions they belong in
+ *
+ * INSERT and COPY FROM into a table with a partition key (see
+ * catalog/partition.c) store each row in the child whose bounds accept the
+ * row's key, instead of in the parent.  The parent's row-level BEFORE
+ * triggers fire first, so trigger-based routing keeps working; then the
+ * row is routed and the chosen partition's own row triggers, constraints
+ * and indexes apply as if the row had been inserted into it directly.
+ *
+ * A partition's ResultRelInfo is only built when the first row is routed
+ * to it, so a statement touching few partitions doesn't pay for opening
+ * the indexes of all the others.
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *	  $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/tupconvert.h"
+#include "catalog/partition.h"
+#include "commands/trigger.h"
+#include "executor/execPartition.h"
+#include "executor/executor.h"
+#include "utils/lsyscache.h"
+#include "utils/rel.h"
+
+
+/*
+ * Routing state hanging off the partitioned table's ResultRelInfo
+ */
+typedef struct PartitionDispatchData
+{
+	PartitionDesc partdesc;		/* bounds of the partitions */
+	ResultRelInfo **partinfos;	/* per partition; NULL until first used */
+	TupleConversionMap **partmaps;	/* per partition; NULL if not needed */
+	TupleConversionMap **parentmaps;	/* reverse of partmaps */
+	BulkInsertState *bistates;	/* per partition, if bulk inserting */
+	TupleTableSlot *partslot;	/* holds tuples in a partition's rowtype */
+	TupleTableSlot *parentslot; /* holds routed tuples converted back */
+	int			lastpart;		/* partition chosen by last ExecRouteTuple */
+} PartitionDispatchData;
+
+static bool partition_rowtype_matches(TupleDesc parentdesc,
+						  TupleDesc partdesc);
+
+
+/*
+ * ExecSetupPartitionRouting
+ *
+ * Prepare to route tuples inserted into 'rootinfo''s relation, which must
+ * have a partition key.  All the partitions are locked.  If 'bulk_insert',
+ * each partition gets its own BulkInsertState for heap_insert.
+ */
+void
+ExecSetupPartitionRouting(ResultRelInfo *rootinfo, EState *estate,
+						  bool bulk_insert)
+{
+	PartitionDispatchData *dispatch;
+	int			nparts;
+
+	dispatch = (PartitionDispatchData *) palloc0(sizeof(PartitionDispatchData));
+	dispatch->partdesc = RelationBuildPartitionDesc(rootinfo->ri_RelationDesc,
+													RowExclusiveLock,
+													true);
+	nparts = dispatch->partdesc->nparts;
+	dispatch->partinfos = (ResultRelInfo **)
+		palloc0(Max(nparts, 1) * sizeof(ResultRelInfo *));
+	dispatch->partmaps = (TupleConversionMap **)
+		palloc0(Max(nparts, 1) * sizeof(TupleConversionMap *));
+	dispatch->parentmaps = (TupleConversionMap **)
+		palloc0(Max(nparts, 1) * sizeof(TupleConversionMap *));
+	if (bulk_insert)
+		dispatch->bistates = (BulkInsertState *)
+			palloc0(Max(nparts, 1) * sizeof(BulkInsertState));
+	dispatch->partslot = ExecInitExtraTupleSlot(estate);
+	dispatch->parentslot = ExecInitExtraTupleSlot(estate);
+	ExecSetSlotDescriptor(dispatch->parentslot,
+						  RelationGetDescr(rootinfo->ri_RelationDesc));
+	dispatch->lastpart = -1;
+
+	rootinfo->ri_PartitionDispatch = dispatch;
+}
+
+/*
+ * ExecRouteTuple
+ *
+ * Find the partition that the tuple in *slotp (also given as *tuplep)
+ * belongs in, and return its ResultRelInfo.  If the partition's rowtype
+ * differs from the parent's, the tuple is converted and *slotp and *tuplep
+ * are replaced with the converted version.  The partition's row-level
+ * BEFORE INSERT triggers are fired too, with the same convention for a
+ * modified tuple; if one of them suppresses the row, NULL is returned.
+ *
+ * If 'bistatep' isn't NULL, the partition's BulkInsertState is returned
+ * in it.
+ *
+ * It is an error for no partition to accept the tuple.
+ */
+ResultRelInfo *
+ExecRouteTuple(ResultRelInfo *rootinfo,
+			   TupleTableSlot **slotp, HeapTuple *tuplep,
+			   EState *estate, BulkInsertState *bistatep)
+{
+	PartitionDispatchData *dispatch = rootinfo->ri_PartitionDispatch;
+	PartitionDesc pd = dispatch->partdesc;
+	Relation	rootrel = rootinfo->ri_RelationDesc;
+	ResultRelInfo *partinfo;
+	TupleTableSlot *slot = *slotp;
+	HeapTuple	tuple = *tuplep;
+	Datum		key;
+	bool		isnull;
+	int			partidx;
+
+	key = slot_getattr(slot, pd->keyattno, &isnull);
+	partidx = partition_find_for_value(pd, key, isnull);
+	if (partidx < 0)
+	{
+		char	   *keyname = RelationGetPartitionKey(rootrel);
+		char	   *keyval;
+
+		if (isnull)
+			keyval = pstrdup("null");
+		else
+		{
+			Oid			typoutput;
+			bool		typisvarlena;
+
+			getTypeOutputInfo(slot->tts_tupleDescriptor->attrs[pd->keyattno - 1]->atttypid,
+							  &typoutput, &typisvarlena);
+			keyval = OidOutputFunctionCall(typoutput, key);
+		}
+		ereport(ERROR,
+				(errcode(ERRCODE_CHECK_VIOLATION),
+				 errmsg("no partition of relation \"%s\" found for row",
+						RelationGetRelationName(rootrel)),
+				 errdetail("Partition key of the failing row contains (%s) = (%s).",
+						   keyname, keyval)));
+	}
+
+	partinfo = dispatch->partinfos[partidx];
+	if (partinfo == NULL)
+	{
+		MemoryContext oldcontext;
+		Relation	partrel;
+
+		/*
+		 * The partition is already locked; its ResultRelInfo lives as long
+		 * as the routing state does.
+		 */
+		oldcontext = MemoryContextSwitchTo(estate->es_query_cxt);
+
+		partrel = heap_open(pd->oids[partidx], NoLock);
+		partinfo = makeNode(ResultRelInfo);
+		InitResultRelInfo(partinfo, partrel,
+						  rootinfo->ri_RangeTableIndex,
+						  CMD_INSERT,
+						  estate->es_instrument);
+		if (!partition_rowtype_matches(RelationGetDescr(rootrel),
+									   RelationGetDescr(partrel)))
+		{
+			dispatch->partmaps[partidx] =
+				convert_tuples_by_name(RelationGetDescr(rootrel),
+									   RelationGetDescr(partrel),
+								 gettext_noop("could not convert row type"));
+			dispatch->parentmaps[partidx] =
+				convert_tuples_by_name(RelationGetDescr(partrel),
+									   RelationGetDescr(rootrel),
+								 gettext_noop("could not convert row type"));
+		}
+		if (dispatch->bistates)
+			dispatch->bistates[partidx] = GetBulkInsertState();
+		dispatch->partinfos[partidx] = partinfo;
+
+		MemoryContextSwitchTo(oldcontext);
+	}
+
+	/* Convert the tuple to the partition's rowtype, if needed */
+	if (dispatch->partmaps[partidx] != NULL)
+	{
+		MemoryContext oldcontext;
+
+		oldcontext = MemoryContextSwitchTo(GetPerTupleMemoryContext(estate));
+		tuple = do_convert_tuple(tuple, dispatch->partmaps[partidx]);
+		MemoryContextSwitchTo(oldcontext);
+
+		slot = dispatch->partslot;
+		if (slot->tts_tupleDescriptor !=
+			RelationGetDescr(partinfo->ri_RelationDesc))
+			ExecSetSlotDescriptor(slot,
+								  RelationGetDescr(partinfo->ri_RelationDesc));
+		ExecStoreTuple(tuple, slot, InvalidBuffer, false);
+	}
+
+	/* BEFORE ROW INSERT Triggers of the partition */
+	if (partinfo->ri_TrigDesc &&
+		partinfo->ri_TrigDesc->n_before_row[TRIGGER_EVENT_INSERT] > 0)
+	{
+		HeapTuple	newtuple;
+
+		newtuple = ExecBRInsertTriggers(estate, partinfo, tuple);
+
+		if (newtuple == NULL)	/* "do nothing" */
+			return NULL;
+
+		if (newtuple != tuple)	/* modified by Trigger(s) */
+		{
+			slot = dispatch->partslot;
+			if (slot->tts_tupleDescriptor !=
+				RelationGetDescr(partinfo->ri_RelationDesc))
+				ExecSetSlotDescriptor(slot,
+								RelationGetDescr(partinfo->ri_RelationDesc));
+			ExecStoreTuple(newtuple, slot, InvalidBuffer, false);
+			tuple = newtuple;
+		}
+	}
+
+	if (bistatep)
+		*bistatep = dispatch->bistates[partidx];
+	dispatch->lastpart = partidx;
+	*slotp = slot;
+	*tuplep = tuple;
+	return partinfo;
+}
+
+/*
+ * ExecRoutedTupleToParent
+ *
+ * Given the tuple most recently routed by ExecRouteTuple, as stored in its
+ * partition (that is, after the partition's own BEFORE triggers), return a
+ * slot holding it in the partitioned table's rowtype.  This is what the
+ * parent's RETURNING list must be computed from.  'slot' is the slot the
+ * tuple was stored from, and is returned as is if no conversion is needed.
+ */
+TupleTableSlot *
+ExecRoutedTupleToParent(ResultRelInfo *rootinfo,
+						TupleTableSlot *slot, HeapTuple tuple,
+						EState *estate)
+{
+	PartitionDispatchData *dispatch = rootinfo->ri_PartitionDispatch;
+	TupleConversionMap *map;
+	MemoryContext oldcontext;
+	HeapTuple	parenttuple;
+
+	Assert(dispatch->lastpart >= 0);
+	map = dispatch->parentmaps[dispatch->lastpart];
+	if (map == NULL)
+		return slot;
+
+	oldcontext = MemoryContextSwitchTo(GetPerTupleMemoryContext(estate));
+	parenttuple = do_convert_tuple(tuple, map);
+	MemoryContextSwitchTo(oldcontext);
+
+	/* keep the OID and location heap_insert just assigned */
+	if (map->outdesc->tdhasoid)
+		HeapTupleSetOid(parenttuple, HeapTupleGetOid(tuple));
+	parenttuple->t_self = tuple->t_self;
+
+	ExecStoreTuple(parenttuple, dispatch->parentslot, InvalidBuffer, false);
+	return dispatch->parentslot;
+}
+
+/*
+ * ExecCleanupPartitionRouting
+ *
+ * Close the partitions opened by ExecRouteTuple, if routing was set up
+ * for 'rootinfo'.
+ */
+void
+ExecCleanupPartitionRouting(ResultRelInfo *rootinfo)
+{
+	PartitionDispatchData *dispatch = rootinfo->ri_PartitionDispatch;
+	int			i;
+
+	if (dispatch == NULL)
+		return;
+
+	for (i = 0; i < dispatch->partdesc->nparts; i++)
+	{
+		ResultRelInfo *partinfo = dispatch->partinfos[i];
+
+		if (partinfo == NULL)
+			continue;
+		if (dispatch->bistates && dispatch->bistates[i])
+			FreeBulkInsertState(dispatch->bistates[i]);
+		ExecCloseIndices(partinfo);
+		/* keep the lock till end of transaction */
+		heap_close(partinfo->ri_RelationDesc, NoLock);
+	}
+
+	rootinfo->ri_PartitionDispatch = NULL;
+}
+
+/*
+ * Can tuples of the parent be stored in the partition as they are?  That's
+ * so if the columns are the same, in the same order.  The rowtype OIDs
+ * differ, but that doesn't matter for storing the tuple.
+ */
+static bool
+partition_rowtype_matches(TupleDesc parentdesc, TupleDesc partdesc)
+{
+	int			i;
+
+	if (parentdesc->natts != partdesc->natts ||
+		parentdesc->tdhasoid != partdesc->tdhasoid)
+		return false;
+
+	for (i = 0; i < parentdesc->natts; i++)
+	{
+		Form_pg_attribute patt = parentdesc->attrs[i];
+		Form_pg_attribute catt = partdesc->attrs[i];
+
+		if (patt->attisdropped != catt->attisdropped)
+			return false;
+		if (patt->attisdropped)
+		{
+			if (patt->attlen != catt->attlen ||
+				patt->attalign != catt->attalign)
+				return false;
+			continue;
+		}
+		if (strcmp(NameStr(patt->attname), NameStr(catt->attname)) != 0 ||
+			patt->atttypid != catt->atttypid ||
+			patt->atttypmod != catt->atttypmod)
+			return false;
+	}
+	return true;
+}
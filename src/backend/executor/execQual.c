@@ -100,6 +100,10 @@ static Datum ExecMakeFunctionResult(FuncExprState *fcache,
 static Datum ExecMakeFunctionResultNoSets(FuncExprState *fcache,
 							 ExprContext *econtext,
 							 bool *isNull, ExprDoneCond *isDone);
+static bool ExecInitFuncArgSteps(FuncExprState *fcache, ExprContext *econtext);
+static Datum ExecMakeFunctionResultSimple(FuncExprState *fcache,
+							 ExprContext *econtext,
+							 bool *isNull, ExprDoneCond *isDone);
 static Datum ExecEvalFunc(FuncExprState *fcache, ExprContext *econtext,
 			 bool *isNull, ExprDoneCond *isDone);
 static Datum ExecEvalOper(FuncExprState *fcache, ExprContext *econtext,
@@ -1798,9 +1802,13 @@ restart:
 		 * We change the ExprState function pointer to use the simpler
 		 * ExecMakeFunctionResultNoSets on subsequent calls.  This amounts to
 		 * assuming that no argument can return a set if it didn't do so the
-		 * first time.
+		 * first time.  If the arguments are all simple Vars and Consts, we
+		 * can go further and use ExecMakeFunctionResultSimple.
 		 */
-		fcache->xprstate.evalfunc = (ExprStateEvalFunc) ExecMakeFunctionResultNoSets;
+		if (ExecInitFuncArgSteps(fcache, econtext))
+			fcache->xprstate.evalfunc = (ExprStateEvalFunc) ExecMakeFunctionResultSimple;
+		else
+			fcache->xprstate.evalfunc = (ExprStateEvalFunc) ExecMakeFunctionResultNoSets;
 
 		if (isDone)
 			*isDone = ExprSingleResult;
@@ -1899,6 +1907,167 @@ ExecMakeFunctionResultNoSets(FuncExprState *fcache,
 	return result;
 }
 
+/*
+ *		ExecInitFuncArgSteps
+ *
+ * Try to flatten the argument list of a non-set function into a FuncArgStep
+ * array.  This is possible when every argument is a Const or a user-column
+ * Var.  We recognize those by their ExprStates' evalfuncs, which also
+ * guarantees that ExecEvalVar's one-time sanity checks have been made: we
+ * are called only after the arguments have been evaluated once.
+ *
+ * Returns true if fcache->argSteps was set up.
+ */
+static bool
+ExecInitFuncArgSteps(FuncExprState *fcache, ExprContext *econtext)
+{
+	FuncArgStep *steps;
+	ListCell   *arg;
+	int			nargs = list_length(fcache->args);
+	int			i;
+
+	if (nargs == 0)
+		return false;
+
+	/* Check eligibility before allocating anything */
+	foreach(arg, fcache->args)
+	{
+		ExprState  *argstate = (ExprState *) lfirst(arg);
+
+		if (argstate->evalfunc == ExecEvalConst)
+			continue;
+		if (argstate->evalfunc == ExecEvalScalarVar &&
+			((Var *) argstate->expr)->varattno > 0)
+			continue;
+		return false;
+	}
+
+	steps = (FuncArgStep *)
+		MemoryContextAlloc(econtext->ecxt_per_query_memory,
+						   nargs * sizeof(FuncArgStep));
+
+	i = 0;
+	foreach(arg, fcache->args)
+	{
+		ExprState  *argstate = (ExprState *) lfirst(arg);
+		FuncArgStep *step = &steps[i++];
+
+		if (argstate->evalfunc == ExecEvalConst)
+		{
+			Const	   *con = (Const *) argstate->expr;
+
+			step->kind = FUNCARG_CONST;
+			step->attnum = InvalidAttrNumber;
+			step->constisnull = con->constisnull;
+			step->constvalue = con->constvalue;
+		}
+		else
+		{
+			Var		   *variable = (Var *) argstate->expr;
+
+			switch (variable->varno)
+			{
+				case INNER:
+					step->kind = FUNCARG_INNER_VAR;
+					break;
+				case OUTER:
+					step->kind = FUNCARG_OUTER_VAR;
+					break;
+				default:
+					step->kind = FUNCARG_SCAN_VAR;
+					break;
+			}
+			step->attnum = variable->varattno;
+			step->constisnull = false;
+			step->constvalue = (Datum) 0;
+		}
+	}
+
+	fcache->argSteps = steps;
+	fcache->nargSteps = nargs;
+
+	return true;
+}
+
+/*
+ *		ExecMakeFunctionResultSimple
+ *
+ * Version of ExecMakeFunctionResultNoSets for functions whose arguments
+ * have been flattened by ExecInitFuncArgSteps.  Column values are taken
+ * straight from the slot when it has already been deformed far enough, and
+ * a strict function's null check is made as each argument is fetched.
+ */
+static Datum
+ExecMakeFunctionResultSimple(FuncExprState *fcache,
+							 ExprContext *econtext,
+							 bool *isNull,
+							 ExprDoneCond *isDone)
+{
+	FuncArgStep *step = fcache->argSteps;
+	int			nargs = fcache->nargSteps;
+	bool		strict = fcache->func.fn_strict;
+	Datum		result;
+	FunctionCallInfoData fcinfo;
+	PgStat_FunctionCallUsage fcusage;
+	int			i;
+
+	if (isDone)
+		*isDone = ExprSingleResult;
+
+	for (i = 0; i < nargs; i++, step++)
+	{
+		TupleTableSlot *slot;
+
+		switch (step->kind)
+		{
+			case FUNCARG_CONST:
+				fcinfo.arg[i] = step->constvalue;
+				fcinfo.argnull[i] = step->constisnull;
+				break;
+			case FUNCARG_SCAN_VAR:
+			case FUNCARG_INNER_VAR:
+			case FUNCARG_OUTER_VAR:
+				if (step->kind == FUNCARG_SCAN_VAR)
+					slot = econtext->ecxt_scantuple;
+				else if (step->kind == FUNCARG_INNER_VAR)
+					slot = econtext->ecxt_innertuple;
+				else
+					slot = econtext->ecxt_outertuple;
+				if (step->attnum <= slot->tts_nvalid)
+				{
+					fcinfo.arg[i] = slot->tts_values[step->attnum - 1];
+					fcinfo.argnull[i] = slot->tts_isnull[step->attnum - 1];
+				}
+				else
+					fcinfo.arg[i] = slot_getattr(slot, step->attnum,
+												 &fcinfo.argnull[i]);
+				break;
+		}
+
+		/*
+		 * If function is strict, a NULL argument means we needn't fetch the
+		 * rest, nor call the function.
+		 */
+		if (strict && fcinfo.argnull[i])
+		{
+			*isNull = true;
+			return (Datum) 0;
+		}
+	}
+
+	InitFunctionCallInfoData(fcinfo, &(fcache->func), nargs, NULL, NULL);
+
+	pgstat_init_function_usage(&fcinfo, &fcusage);
+
+	/* fcinfo.isnull = false; */	/* handled by InitFunctionCallInfoData */
+	result = FunctionCallInvoke(&fcinfo);
+	*isNull = fcinfo.isnull;
+
+	pgstat_end_function_usage(&fcusage, true);
+
+	return result;
+}
+
 
 /*
  *		ExecMakeTableFunctionResult
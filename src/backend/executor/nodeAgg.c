@@ -66,6 +66,15 @@
  *	  AggState is available as context in earlier releases (back to 8.1),
  *	  but direct examination of the node is needed to use it before 9.0.
  *
+ *	  In AGG_HASHED mode, we keep an estimate of the hash table's size.  Once
+ *	  that exceeds work_mem, no more groups are added: input tuples that
+ *	  belong to groups already in the table are still aggregated, but the
+ *	  rest are written out to one of HASHAGG_PARTITIONS temp files, chosen
+ *	  by their grouping columns' hash value.  After the groups in memory have
+ *	  been returned, the table is emptied and reloaded from each spilled
+ *	  batch in turn, which may spill again, using the next few bits of the
+ *	  hash value to choose among new partitions.
+ *
  *
  * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
@@ -89,6 +98,7 @@
 #include "optimizer/tlist.h"
 #include "parser/parse_agg.h"
 #include "parser/parse_coerce.h"
+#include "storage/buffile.h"
 #include "utils/acl.h"
 #include "utils/builtins.h"
 #include "utils/lsyscache.h"
@@ -247,6 +257,24 @@ typedef struct AggHashEntryData
 	AggStatePerGroupData pergroup[1];	/* VARIABLE LENGTH ARRAY */
 } AggHashEntryData;				/* VARIABLE LENGTH STRUCT */
 
+/*
+ * A hashed Agg spills into HASHAGG_PARTITIONS files at a time, choosing one
+ * by HASHAGG_PARTITION_BITS bits of the hash value: the topmost bits for
+ * tuples spilled while reading the input, the next ones down for tuples
+ * spilled again while reloading a batch, and so on until the bits run out,
+ * after which we just let the table exceed work_mem.
+ */
+#define HASHAGG_PARTITION_BITS	4
+#define HASHAGG_PARTITIONS		(1 << HASHAGG_PARTITION_BITS)
+#define HASHAGG_MAX_DEPTH		(32 / HASHAGG_PARTITION_BITS)
+
+/* A spilled batch waiting to be loaded into the hash table */
+typedef struct AggHashBatch
+{
+	BufFile    *file;			/* tuples of the batch */
+	int			depth;			/* spill depth they were written at, plus 1 */
+} AggHashBatch;
+
 
 static void initialize_aggregates(AggState *aggstate,
 					  AggStatePerAgg peragg,
@@ -272,6 +300,15 @@ static void build_hash_table(AggState *aggstate);
 static AggHashEntry lookup_hash_entry(AggState *aggstate,
 				  TupleTableSlot *inputslot);
 static TupleTableSlot *agg_retrieve_direct(AggState *aggstate);
+static void agg_hash_input_tuple(AggState *aggstate, TupleTableSlot *slot,
+					 bool hashknown, uint32 hashvalue);
+static uint32 agg_hash_grouping_cols(AggState *aggstate,
+					   TupleTableSlot *slot);
+static void agg_spill_tuple(AggState *aggstate, TupleTableSlot *slot,
+				uint32 hashvalue);
+static void agg_finish_hash_pass(AggState *aggstate);
+static bool agg_refill_hash_table(AggState *aggstate);
+static void agg_release_spill_files(AggState *aggstate);
 static void agg_fill_hash_table(AggState *aggstate);
 static TupleTableSlot *agg_retrieve_hash_table(AggState *aggstate);
 static Datum GetAggInitVal(Datum textInitVal, Oid transtype);
@@ -834,6 +871,8 @@ build_hash_table(AggState *aggstate)
 											  entrysize,
 											  aggstate->aggcontext,
 											  tmpmem);
+	aggstate->hash_mem = 0;
+	aggstate->hash_spill_mode = false;
 }
 
 /*
@@ -907,6 +946,9 @@ hash_agg_entry_size(int numAggs)
  * Find or create a hashtable entry for the tuple group containing the
  * given tuple.
  *
+ * If the table has reached work_mem, we only look for an existing entry,
+ * and return NULL if there is none; the caller must spill the tuple.
+ *
  * When called, CurrentMemoryContext should be the per-query context.
  */
 static AggHashEntry
@@ -935,6 +977,11 @@ lookup_hash_entry(AggState *aggstate, TupleTableSlot *inputslot)
 		hashslot->tts_isnull[varNumber] = inputslot->tts_isnull[varNumber];
 	}
 
+	if (aggstate->hash_spill_mode)
+		return (AggHashEntry) LookupTupleHashEntry(aggstate->hashtable,
+												   hashslot,
+												   NULL);
+
 	/* find or create the hashtable entry using the filtered tuple */
 	entry = (AggHashEntry) LookupTupleHashEntry(aggstate->hashtable,
 												hashslot,
@@ -944,6 +991,16 @@ lookup_hash_entry(AggState *aggstate, TupleTableSlot *inputslot)
 	{
 		/* initialize aggregates for new tuple group */
 		initialize_aggregates(aggstate, aggstate->peragg, entry->pergroup);
+
+		/*
+		 * Account for the new group, and stop adding groups once the table
+		 * exceeds work_mem, unless we have run out of hash bits to split on.
+		 */
+		aggstate->hash_mem += aggstate->hash_entry_space +
+			MAXALIGN(entry->shared.firstTuple->t_len);
+		if (aggstate->hash_mem > work_mem * 1024L &&
+			aggstate->hash_depth < HASHAGG_MAX_DEPTH)
+			aggstate->hash_spill_mode = true;
 	}
 
 	return entry;
@@ -1200,6 +1257,252 @@ agg_retrieve_direct(AggState *aggstate)
 	return NULL;
 }
 
+/*
+ * Aggregate one input tuple into the hash table, or spill it if its group
+ * isn't in the table and the table is full.  hashvalue is the tuple's
+ * grouping hash if hashknown, as it is for tuples read back from a batch.
+ */
+static void
+agg_hash_input_tuple(AggState *aggstate, TupleTableSlot *slot,
+					 bool hashknown, uint32 hashvalue)
+{
+	/* tmpcontext is the per-input-tuple expression context */
+	ExprContext *tmpcontext = aggstate->tmpcontext;
+	AggHashEntry entry;
+
+	/* set up for advance_aggregates call */
+	tmpcontext->ecxt_outertuple = slot;
+
+	/* Find or build hashtable entry for this tuple's group */
+	entry = lookup_hash_entry(aggstate, slot);
+
+	if (entry != NULL)
+	{
+		/* Advance the aggregates */
+		advance_aggregates(aggstate, entry->pergroup);
+	}
+	else
+	{
+		if (!hashknown)
+			hashvalue = agg_hash_grouping_cols(aggstate, slot);
+		agg_spill_tuple(aggstate, slot, hashvalue);
+	}
+
+	/* Reset per-input-tuple context after each tuple */
+	ResetExprContext(tmpcontext);
+}
+
+/*
+ * Compute the hash value of a tuple's grouping columns, for choosing the
+ * partition to spill it to.  This is the same hash the hash table itself
+ * computes; we take partition numbers from its high-order bits, which the
+ * table uses least.
+ *
+ * Runs in the per-input-tuple memory context.
+ */
+static uint32
+agg_hash_grouping_cols(AggState *aggstate, TupleTableSlot *slot)
+{
+	Agg		   *node = (Agg *) aggstate->ss.ps.plan;
+	MemoryContext oldContext;
+	uint32		hashkey = 0;
+	int			i;
+
+	oldContext = MemoryContextSwitchTo(aggstate->tmpcontext->ecxt_per_tuple_memory);
+
+	for (i = 0; i < node->numCols; i++)
+	{
+		AttrNumber	att = node->grpColIdx[i];
+		Datum		attr;
+		bool		isNull;
+
+		/* rotate hashkey left 1 bit at each step */
+		hashkey = (hashkey << 1) | ((hashkey & 0x80000000) ? 1 : 0);
+
+		attr = slot_getattr(slot, att, &isNull);
+
+		if (!isNull)			/* treat nulls as having hash key 0 */
+		{
+			uint32		hkey;
+
+			hkey = DatumGetUInt32(FunctionCall1(&aggstate->hashfunctions[i],
+												attr));
+			hashkey ^= hkey;
+		}
+	}
+
+	MemoryContextSwitchTo(oldContext);
+
+	return hashkey;
+}
+
+/*
+ * Write a tuple whose group didn't fit in the hash table to the partition
+ * file for the current spill depth that its hash value selects.  The hash
+ * value is saved with it, so that it needn't be recomputed if the batch
+ * must be split further.
+ */
+static void
+agg_spill_tuple(AggState *aggstate, TupleTableSlot *slot, uint32 hashvalue)
+{
+	int			shift;
+	int			partno;
+	BufFile   **fileptr;
+	MinimalTuple tuple;
+	size_t		written;
+
+	shift = 32 - (aggstate->hash_depth + 1) * HASHAGG_PARTITION_BITS;
+	partno = (hashvalue >> shift) & (HASHAGG_PARTITIONS - 1);
+	fileptr = &aggstate->hash_spill_files[partno];
+	if (*fileptr == NULL)
+		*fileptr = BufFileCreateTemp(false);
+
+	tuple = ExecFetchSlotMinimalTuple(slot);
+
+	written = BufFileWrite(*fileptr, (void *) &hashvalue, sizeof(uint32));
+	if (written != sizeof(uint32))
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not write to hash-aggregate temporary file: %m")));
+
+	written = BufFileWrite(*fileptr, (void *) tuple, tuple->t_len);
+	if (written != tuple->t_len)
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not write to hash-aggregate temporary file: %m")));
+
+	aggstate->hash_spilled = true;
+}
+
+/*
+ * At the end of a pass over the input or a batch, queue whatever was spilled
+ * during the pass as new batches, one level deeper.
+ */
+static void
+agg_finish_hash_pass(AggState *aggstate)
+{
+	int			partno;
+
+	for (partno = 0; partno < HASHAGG_PARTITIONS; partno++)
+	{
+		BufFile    *file = aggstate->hash_spill_files[partno];
+		AggHashBatch *batch;
+
+		if (file == NULL)
+			continue;
+
+		if (BufFileSeek(file, 0, 0L, SEEK_SET))
+			ereport(ERROR,
+					(errcode_for_file_access(),
+					 errmsg("could not rewind hash-aggregate temporary file: %m")));
+
+		batch = (AggHashBatch *) palloc(sizeof(AggHashBatch));
+		batch->file = file;
+		batch->depth = aggstate->hash_depth + 1;
+		aggstate->hash_batches = lappend(aggstate->hash_batches, batch);
+		aggstate->hash_spill_files[partno] = NULL;
+	}
+}
+
+/*
+ * Empty the hash table and load it from the next spilled batch, if any.
+ * Returns false if there are no more batches.
+ *
+ * When called, CurrentMemoryContext should be the per-query context.
+ */
+static bool
+agg_refill_hash_table(AggState *aggstate)
+{
+	TupleTableSlot *slot = aggstate->hash_batchslot;
+	AggHashBatch *batch;
+
+	if (aggstate->hash_batches == NIL)
+		return false;
+
+	batch = (AggHashBatch *) linitial(aggstate->hash_batches);
+	aggstate->hash_batches = list_delete_first(aggstate->hash_batches);
+
+	/*
+	 * Release the previous batch's groups and transition values.  As in
+	 * ExecReScanAgg, the hash table has a sub-context of the aggcontext.
+	 */
+	MemoryContextResetAndDeleteChildren(aggstate->aggcontext);
+	build_hash_table(aggstate);
+	aggstate->hash_depth = batch->depth;
+
+	for (;;)
+	{
+		uint32		header[2];
+		size_t		nread;
+		MinimalTuple tuple;
+
+		CHECK_FOR_INTERRUPTS();
+
+		/*
+		 * Both the hash value and the MinimalTuple length word are uint32,
+		 * so we can read them both at once, as nodeHashjoin.c does.
+		 */
+		nread = BufFileRead(batch->file, (void *) header, sizeof(header));
+		if (nread == 0)			/* end of file */
+			break;
+		if (nread != sizeof(header))
+			ereport(ERROR,
+					(errcode_for_file_access(),
+				errmsg("could not read from hash-aggregate temporary file: %m")));
+		tuple = (MinimalTuple) palloc(header[1]);
+		tuple->t_len = header[1];
+		nread = BufFileRead(batch->file,
+							(void *) ((char *) tuple + sizeof(uint32)),
+							header[1] - sizeof(uint32));
+		if (nread != header[1] - sizeof(uint32))
+			ereport(ERROR,
+					(errcode_for_file_access(),
+				errmsg("could not read from hash-aggregate temporary file: %m")));
+		ExecStoreMinimalTuple(tuple, slot, true);
+
+		agg_hash_input_tuple(aggstate, slot, true, header[0]);
+	}
+
+	ExecClearTuple(slot);
+	BufFileClose(batch->file);
+	pfree(batch);
+
+	agg_finish_hash_pass(aggstate);
+
+	/* Initialize to walk the hash table */
+	ResetTupleHashIterator(aggstate->hashtable, &aggstate->hashiter);
+
+	return true;
+}
+
+/*
+ * Close any spill files and forget pending batches.
+ */
+static void
+agg_release_spill_files(AggState *aggstate)
+{
+	ListCell   *lc;
+	int			partno;
+
+	foreach(lc, aggstate->hash_batches)
+	{
+		AggHashBatch *batch = (AggHashBatch *) lfirst(lc);
+
+		BufFileClose(batch->file);
+	}
+	list_free_deep(aggstate->hash_batches);
+	aggstate->hash_batches = NIL;
+
+	for (partno = 0; partno < HASHAGG_PARTITIONS; partno++)
+	{
+		if (aggstate->hash_spill_files[partno] != NULL)
+		{
+			BufFileClose(aggstate->hash_spill_files[partno]);
+			aggstate->hash_spill_files[partno] = NULL;
+		}
+	}
+}
+
 /*
  * ExecAgg for hashed case: phase 1, read input and build hash table
  */
@@ -1207,16 +1510,14 @@ static void
 agg_fill_hash_table(AggState *aggstate)
 {
 	PlanState  *outerPlan;
-	ExprContext *tmpcontext;
-	AggHashEntry entry;
 	TupleTableSlot *outerslot;
 
 	/*
 	 * get state info from node
 	 */
 	outerPlan = outerPlanState(aggstate);
-	/* tmpcontext is the per-input-tuple expression context */
-	tmpcontext = aggstate->tmpcontext;
+
+	aggstate->hash_depth = 0;
 
 	/*
 	 * Process each outer-plan tuple, and then fetch the next one, until we
@@ -1227,19 +1528,13 @@ agg_fill_hash_table(AggState *aggstate)
 		outerslot = ExecProcNode(outerPlan);
 		if (TupIsNull(outerslot))
 			break;
-		/* set up for advance_aggregates call */
-		tmpcontext->ecxt_outertuple = outerslot;
-
-		/* Find or build hashtable entry for this tuple's group */
-		entry = lookup_hash_entry(aggstate, outerslot);
 
-		/* Advance the aggregates */
-		advance_aggregates(aggstate, entry->pergroup);
-
-		/* Reset per-input-tuple context after each tuple */
-		ResetExprContext(tmpcontext);
+		agg_hash_input_tuple(aggstate, outerslot, false, 0);
 	}
 
+	/* Queue up anything that didn't fit */
+	agg_finish_hash_pass(aggstate);
+
 	aggstate->table_filled = true;
 	/* Initialize to walk the hash table */
 	ResetTupleHashIterator(aggstate->hashtable, &aggstate->hashiter);
@@ -1282,6 +1577,10 @@ agg_retrieve_hash_table(AggState *aggstate)
 		entry = (AggHashEntry) ScanTupleHashTable(&aggstate->hashiter);
 		if (entry == NULL)
 		{
+			/* Move on to the next spilled batch, if any */
+			if (agg_refill_hash_table(aggstate))
+				continue;
+
 			/* No more entries in hashtable, so done */
 			aggstate->agg_done = TRUE;
 			return NULL;
@@ -1387,6 +1686,14 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 	aggstate->pergroup = NULL;
 	aggstate->grp_firstTuple = NULL;
 	aggstate->hashtable = NULL;
+	aggstate->hash_mem = 0;
+	aggstate->hash_entry_space = 0;
+	aggstate->hash_spill_mode = false;
+	aggstate->hash_spilled = false;
+	aggstate->hash_depth = 0;
+	aggstate->hash_spill_files = NULL;
+	aggstate->hash_batches = NIL;
+	aggstate->hash_batchslot = NULL;
 
 	/*
 	 * Create expression contexts.	We need two, one for per-input-tuple
@@ -1418,6 +1725,8 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 	ExecInitScanTupleSlot(estate, &aggstate->ss);
 	ExecInitResultTupleSlot(estate, &aggstate->ss.ps);
 	aggstate->hashslot = ExecInitExtraTupleSlot(estate);
+	if (node->aggstrategy == AGG_HASHED)
+		aggstate->hash_batchslot = ExecInitExtraTupleSlot(estate);
 
 	/*
 	 * initialize child expressions
@@ -1450,6 +1759,9 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 	 * initialize source tuple type.
 	 */
 	ExecAssignScanTypeFromOuterPlan(&aggstate->ss);
+	if (aggstate->hash_batchslot)
+		ExecSetSlotDescriptor(aggstate->hash_batchslot,
+							  ExecGetResultType(outerPlanState(aggstate)));
 
 	/*
 	 * Initialize result tuple type and projection info.
@@ -1511,6 +1823,10 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 		aggstate->table_filled = false;
 		/* Compute the columns we actually need to hash on */
 		aggstate->hash_needed = find_hash_columns(aggstate);
+		aggstate->hash_spill_files = (BufFile **)
+			palloc0(sizeof(BufFile *) * HASHAGG_PARTITIONS);
+		/* transition value space is added in below */
+		aggstate->hash_entry_space = hash_agg_entry_size(numaggs);
 	}
 	else
 	{
@@ -1687,6 +2003,21 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 						&peraggstate->transtypeLen,
 						&peraggstate->transtypeByVal);
 
+		/*
+		 * Pass-by-reference transition values take space in each hash table
+		 * entry, too.  As in the planner, we can only estimate the size of a
+		 * variable-length one.
+		 */
+		if (node->aggstrategy == AGG_HASHED && !peraggstate->transtypeByVal)
+		{
+			if (peraggstate->transtypeLen > 0)
+				aggstate->hash_entry_space +=
+					MAXALIGN(peraggstate->transtypeLen);
+			else
+				aggstate->hash_entry_space +=
+					MAXALIGN(get_typavgwidth(aggtranstype, -1));
+		}
+
 		/*
 		 * initval is potentially null, so don't try to access it as a struct
 		 * field. Must do it the hard way with SysCacheGetAttr.
@@ -1869,6 +2200,10 @@ ExecEndAgg(AggState *node)
 			tuplesort_end(peraggstate->sortstate);
 	}
 
+	/* Close any hashed-mode spill files */
+	if (node->hash_spill_files != NULL)
+		agg_release_spill_files(node);
+
 	/*
 	 * Free both the expr contexts.
 	 */
@@ -1909,13 +2244,18 @@ ExecReScanAgg(AggState *node, ExprContext *exprCtxt)
 		/*
 		 * If we do have the hash table and the subplan does not have any
 		 * parameter changes, then we can just rescan the existing hash table;
-		 * no need to build it again.
+		 * no need to build it again.  But not if anything was spilled, since
+		 * then the table holds only the last batch loaded.
 		 */
-		if (((PlanState *) node)->lefttree->chgParam == NULL)
+		if (((PlanState *) node)->lefttree->chgParam == NULL &&
+			!node->hash_spilled)
 		{
 			ResetTupleHashIterator(node->hashtable, &node->hashiter);
 			return;
 		}
+
+		agg_release_spill_files(node);
+		node->hash_spilled = false;
 	}
 
 	/* Make sure we have closed any open tuplesorts */
@@ -53,14 +53,31 @@
  *			  nil	nil		 Scan	 Scan	  Scan	   Scan
  *							  |		  |		   |		|
  *							person employee student student-emp
+ *
+ *		When the subplans scan the partitions of a partitioned table, the
+ *		planner may leave us quals comparing the partition key with values
+ *		that weren't known at plan time: Params of a prepared statement or
+ *		of a correlated subquery, or columns of the outer rel when we are
+ *		the inner side of a nestloop.  We then evaluate the values and skip
+ *		the subplans of the partitions that can't hold matching rows.  If
+ *		the values are known at executor startup, the skipped subplans are
+ *		not even initialized; otherwise the choice is made again at each
+ *		rescan, and only the subplans that will be run are rescanned.
  */
 
 #include "postgres.h"
 
+#include "access/heapam.h"
+#include "catalog/partition.h"
 #include "executor/execdebug.h"
 #include "executor/nodeAppend.h"
+#include "nodes/nodeFuncs.h"
+#include "utils/memutils.h"
 
 static bool exec_append_initialize_next(AppendState *appendstate);
+static bool append_prune_needs_rescan_walker(Node *node, void *context);
+static void exec_append_compute_pruning(AppendState *node,
+							ExprContext *exprCtxt);
 
 
 /* ----------------------------------------------------------------
@@ -105,6 +122,83 @@ exec_append_initialize_next(AppendState *appendstate)
 	}
 }
 
+/*
+ * append_prune_needs_rescan_walker
+ *		Does the pruning expression depend on values that aren't available
+ *		at executor startup, namely outer-rel Vars and PARAM_EXEC Params?
+ */
+static bool
+append_prune_needs_rescan_walker(Node *node, void *context)
+{
+	if (node == NULL)
+		return false;
+	if (IsA(node, Var))
+		return true;
+	if (IsA(node, Param) &&
+		((Param *) node)->paramkind == PARAM_EXEC)
+		return true;
+	return expression_tree_walker(node, append_prune_needs_rescan_walker,
+								  context);
+}
+
+/* ----------------------------------------------------------------
+ *		exec_append_compute_pruning
+ *
+ *		Evaluate the partition pruning values, and mark the subplans of
+ *		the partitions that can't hold matching rows as pruned.  Outer
+ *		Vars are taken from exprCtxt's outer tuple, if given.
+ * ----------------------------------------------------------------
+ */
+static void
+exec_append_compute_pruning(AppendState *node, ExprContext *exprCtxt)
+{
+	Append	   *plan = (Append *) node->ps.plan;
+	ExprContext *econtext = node->ps.ps_ExprContext;
+	int			nconds = list_length(node->as_pruneexprs);
+	int		   *strategies;
+	Datum	   *values;
+	bool	   *isnulls;
+	Bitmapset  *liveparts;
+	MemoryContext oldContext;
+	ListCell   *lc1;
+	ListCell   *lc2;
+	int			i;
+
+	ResetExprContext(econtext);
+	if (exprCtxt != NULL)
+		econtext->ecxt_outertuple = exprCtxt->ecxt_outertuple;
+
+	/* Everything we allocate here is garbage once we're done */
+	oldContext = MemoryContextSwitchTo(econtext->ecxt_per_tuple_memory);
+
+	strategies = (int *) palloc(nconds * sizeof(int));
+	values = (Datum *) palloc(nconds * sizeof(Datum));
+	isnulls = (bool *) palloc(nconds * sizeof(bool));
+	i = 0;
+	forboth(lc1, node->as_pruneexprs, lc2, plan->partprunestrategies)
+	{
+		strategies[i] = lfirst_int(lc2);
+		values[i] = ExecEvalExpr((ExprState *) lfirst(lc1), econtext,
+								 &isnulls[i], NULL);
+		i++;
+	}
+
+	liveparts = partition_prune_by_values(node->as_partdesc, nconds,
+										  strategies, values, isnulls);
+
+	for (i = 0; i < node->as_nplans; i++)
+	{
+		int			partidx = node->as_partindexes[i];
+
+		node->as_pruned[i] = (partidx >= 0 &&
+							  !bms_is_member(partidx, liveparts));
+	}
+
+	MemoryContextSwitchTo(oldContext);
+
+	node->as_prunePending = false;
+}
+
 /* ----------------------------------------------------------------
  *		ExecInitAppend
  *
@@ -142,14 +236,71 @@ ExecInitAppend(Append *node, EState *estate, int eflags)
 	appendstate->ps.state = estate;
 	appendstate->appendplans = appendplanstates;
 	appendstate->as_nplans = nplans;
+	appendstate->as_pruned = NULL;
+	appendstate->as_partdesc = NULL;
+	appendstate->as_partindexes = NULL;
+	appendstate->as_pruneexprs = NIL;
+	appendstate->as_prunePending = false;
 
 	/*
 	 * Miscellaneous initialization
 	 *
 	 * Append plans don't have expression contexts because they never call
-	 * ExecQual or ExecProject.
+	 * ExecQual or ExecProject, unless they have partition pruning values to
+	 * compute.
 	 */
 
+	/*
+	 * Set up run-time partition pruning.  The partition bounds might in
+	 * principle have changed since planning, so read them again; if the
+	 * parent isn't partitioned any more, just scan everything.
+	 */
+	if (OidIsValid(node->partrelid))
+	{
+		Relation	partrel = heap_open(node->partrelid, NoLock);
+
+		appendstate->as_partdesc = RelationBuildPartitionDesc(partrel,
+															  NoLock,
+															  false);
+		heap_close(partrel, NoLock);
+	}
+	if (appendstate->as_partdesc != NULL)
+	{
+		ExecAssignExprContext(estate, &appendstate->ps);
+		appendstate->as_pruneexprs = (List *)
+			ExecInitExpr((Expr *) node->partpruneexprs,
+						 (PlanState *) appendstate);
+		appendstate->as_pruned = (bool *) palloc0(nplans * sizeof(bool));
+		appendstate->as_partindexes = (int *) palloc(nplans * sizeof(int));
+		i = 0;
+		foreach(lc, node->partoids)
+		{
+			Oid			childrelid = lfirst_oid(lc);
+
+			if (OidIsValid(childrelid))
+				appendstate->as_partindexes[i] =
+					partition_index_for_oid(appendstate->as_partdesc,
+											childrelid);
+			else
+				appendstate->as_partindexes[i] = -1;
+			i++;
+		}
+
+		/*
+		 * If the values can be computed now, prune once and for all, so
+		 * that the pruned subplans need not be initialized.  Else we must
+		 * wait for the first fetch or rescan.
+		 */
+		if (!append_prune_needs_rescan_walker((Node *) node->partpruneexprs,
+											  NULL))
+		{
+			exec_append_compute_pruning(appendstate, NULL);
+			appendstate->as_pruneexprs = NIL;
+		}
+		else
+			appendstate->as_prunePending = true;
+	}
+
 	/*
 	 * append nodes still have Result slots, which hold pointers to tuples, so
 	 * we have to initialize them.
@@ -158,14 +309,16 @@ ExecInitAppend(Append *node, EState *estate, int eflags)
 
 	/*
 	 * call ExecInitNode on each of the plans to be executed and save the
-	 * results into the array "appendplans".
+	 * results into the array "appendplans".  Plans pruned already are left
+	 * NULL.
 	 */
 	i = 0;
 	foreach(lc, node->appendplans)
 	{
 		Plan	   *initNode = (Plan *) lfirst(lc);
 
-		appendplanstates[i] = ExecInitNode(initNode, estate, eflags);
+		if (appendstate->as_pruned == NULL || !appendstate->as_pruned[i])
+			appendplanstates[i] = ExecInitNode(initNode, estate, eflags);
 		i++;
 	}
 
@@ -193,29 +346,34 @@ ExecInitAppend(Append *node, EState *estate, int eflags)
 TupleTableSlot *
 ExecAppend(AppendState *node)
 {
+	/* Find out which subplans to skip, if no rescan has done so yet */
+	if (node->as_prunePending)
+		exec_append_compute_pruning(node, NULL);
+
 	for (;;)
 	{
 		PlanState  *subnode;
 		TupleTableSlot *result;
 
 		/*
-		 * figure out which subplan we are currently processing
+		 * figure out which subplan we are currently processing, and get a
+		 * tuple from it unless it's pruned
 		 */
-		subnode = node->appendplans[node->as_whichplan];
-
-		/*
-		 * get a tuple from the subplan
-		 */
-		result = ExecProcNode(subnode);
-
-		if (!TupIsNull(result))
+		if (node->as_pruned == NULL || !node->as_pruned[node->as_whichplan])
 		{
-			/*
-			 * If the subplan gave us something then return it as-is. We do
-			 * NOT make use of the result slot that was set up in
-			 * ExecInitAppend; there's no need for it.
-			 */
-			return result;
+			subnode = node->appendplans[node->as_whichplan];
+
+			result = ExecProcNode(subnode);
+
+			if (!TupIsNull(result))
+			{
+				/*
+				 * If the subplan gave us something then return it as-is. We
+				 * do NOT make use of the result slot that was set up in
+				 * ExecInitAppend; there's no need for it.
+				 */
+				return result;
+			}
 		}
 
 		/*
@@ -256,10 +414,16 @@ ExecEndAppend(AppendState *node)
 	nplans = node->as_nplans;
 
 	/*
-	 * shut down each of the subscans
+	 * shut down each of the subscans (those pruned at startup are NULL)
 	 */
 	for (i = 0; i < nplans; i++)
 		ExecEndNode(appendplans[i]);
+
+	/*
+	 * Free the exprcontext, if we made one for partition pruning
+	 */
+	if (node->ps.ps_ExprContext)
+		ExecFreeExprContext(&node->ps);
 }
 
 void
@@ -267,10 +431,22 @@ ExecReScanAppend(AppendState *node, ExprContext *exprCtxt)
 {
 	int			i;
 
+	/*
+	 * Choose the partitions for the new scan.  The subplans of the others
+	 * are neither rescanned nor run; should one of them be chosen again by
+	 * a later rescan, it's rescanned then.
+	 */
+	if (node->as_pruneexprs != NIL)
+		exec_append_compute_pruning(node, exprCtxt);
+
 	for (i = 0; i < node->as_nplans; i++)
 	{
 		PlanState  *subnode = node->appendplans[i];
 
+		/* skip plans pruned at executor startup */
+		if (subnode == NULL)
+			continue;
+
 		/*
 		 * ExecReScan doesn't know about my subplans, so I have to do
 		 * changed-parameter signaling myself.
@@ -278,6 +454,9 @@ ExecReScanAppend(AppendState *node, ExprContext *exprCtxt)
 		if (node->ps.chgParam != NULL)
 			UpdateChangedParamSet(subnode, node->ps.chgParam);
 
+		if (node->as_pruned != NULL && node->as_pruned[i])
+			continue;
+
 		/*
 		 * If chgParam of subnode is not null then plan will be re-scanned by
 		 * first ExecProcNode.	However, if caller is passing us an exprCtxt
@@ -47,6 +47,10 @@ static void ExecHashSkewTableInsert(HashJoinTable hashtable,
 						uint32 hashvalue,
 						int bucketNumber);
 static void ExecHashRemoveNextSkewBucket(HashJoinTable hashtable);
+static void *dense_alloc(HashJoinTable hashtable, Size size);
+static void ExecHashBloomAdd(HashJoinTable hashtable, uint32 hashvalue);
+static void ExecHashQueueTuple(HashJoinTable hashtable,
+				   HashJoinTuple hashTuple, int bucketno);
 
 
 /* ----------------------------------------------------------------
@@ -110,6 +114,9 @@ MultiExecHash(HashState *node)
 		{
 			int			bucketNumber;
 
+			if (hashtable->bloomFilter != NULL)
+				ExecHashBloomAdd(hashtable, hashvalue);
+
 			bucketNumber = ExecHashGetSkewBucket(hashtable, hashvalue);
 			if (bucketNumber != INVALID_SKEW_BUCKET_NO)
 			{
@@ -126,6 +133,21 @@ MultiExecHash(HashState *node)
 		}
 	}
 
+	/*
+	 * If the inner relation turned out much bigger than estimated, the Bloom
+	 * filter is too saturated to reject many outer tuples; don't bother
+	 * checking it.
+	 */
+	if (hashtable->bloomFilter != NULL &&
+		hashtable->totalTuples * 4 > (double) hashtable->bloomMask + 1)
+	{
+		pfree(hashtable->bloomFilter);
+		hashtable->bloomFilter = NULL;
+	}
+
+	/* link the last few tuples into their buckets */
+	ExecHashTableLinkPending(hashtable);
+
 	/* must provide our own instrumentation support */
 	if (node->ps.instrument)
 		InstrStopNode(node->ps.instrument, hashtable->totalTuples);
@@ -292,6 +314,12 @@ ExecHashTableCreate(Hash *node, List *hashOperators)
 	hashtable->spaceUsedSkew = 0;
 	hashtable->spaceAllowedSkew =
 		hashtable->spaceAllowed * SKEW_WORK_MEM_PERCENT / 100;
+	hashtable->chunks = NULL;
+	hashtable->nPending = 0;
+	hashtable->bloomFilter = NULL;
+	hashtable->bloomMask = 0;
+	hashtable->bloomProbes = 0;
+	hashtable->bloomRejects = 0;
 
 	/*
 	 * Get info about the hash functions to be used for each hash key. Also
@@ -359,8 +387,8 @@ ExecHashTableCreate(Hash *node, List *hashOperators)
 	 */
 	MemoryContextSwitchTo(hashtable->batchCxt);
 
-	hashtable->buckets = (HashJoinTuple *)
-		palloc0(nbuckets * sizeof(HashJoinTuple));
+	hashtable->buckets = (HashJoinBucketData *)
+		palloc0(nbuckets * sizeof(HashJoinBucketData));
 
 	/*
 	 * Set up for skew optimization, if possible and there's a need for more
@@ -458,10 +486,10 @@ ExecChooseHashTableSize(double ntuples, int tupwidth, bool useskew,
 	/*
 	 * Set nbuckets to achieve an average bucket load of NTUP_PER_BUCKET when
 	 * memory is filled.  Set nbatch to the smallest power of 2 that appears
-	 * sufficient.	The Min() steps limit the results so that the pointer
-	 * arrays we'll try to allocate do not exceed work_mem.
+	 * sufficient.	The Min() steps limit the results so that the bucket and
+	 * batch arrays we'll try to allocate do not exceed work_mem.
 	 */
-	max_pointers = (work_mem * 1024L) / sizeof(void *);
+	max_pointers = (work_mem * 1024L) / sizeof(HashJoinBucketData);
 	/* also ensure we avoid integer overflow in nbatch and nbuckets */
 	max_pointers = Min(max_pointers, INT_MAX / 2);
 
@@ -542,6 +570,105 @@ ExecHashTableDestroy(HashJoinTable hashtable)
 	pfree(hashtable);
 }
 
+/* ----------------------------------------------------------------
+ *		ExecHashTableInitBloom
+ *
+ *		set up an empty Bloom filter for the inner hash values; to be
+ *		called before the hash table is filled, and only by joins that
+ *		may drop outer tuples that cannot match.  ntuples is the
+ *		estimated size of the inner relation.
+ * ----------------------------------------------------------------
+ */
+void
+ExecHashTableInitBloom(HashJoinTable hashtable, double ntuples)
+{
+	double		maxbits;
+	double		nbits;
+
+	/* keep the filter small compared to the hash table proper */
+	maxbits = (double) hashtable->spaceAllowed;
+	maxbits = Min(maxbits, (double) MaxAllocSize / 8);
+
+	nbits = BLOOM_MIN_BITS;
+	while (nbits < ntuples * BLOOM_BITS_PER_TUPLE && nbits * 2 <= maxbits)
+		nbits *= 2;
+
+	/* not worth it if we can't afford a reasonably sparse filter */
+	if (ntuples * 4 > nbits)
+		return;
+
+	hashtable->bloomFilter = (uint32 *)
+		MemoryContextAllocZero(hashtable->hashCxt, (Size) nbits / 8);
+	hashtable->bloomMask = (uint32) (nbits - 1);
+	hashtable->bloomProbes = 0;
+	hashtable->bloomRejects = 0;
+}
+
+/*
+ * The BLOOM_NUM_HASHES bit positions for a hash value are derived from the
+ * value itself by double hashing; the second hash is a rotation of the
+ * first, forced odd so that the positions are all distinct.
+ */
+#define BLOOM_HASH2(hashvalue)	\
+	((((hashvalue) >> 17) | ((hashvalue) << 15)) | 1)
+
+static void
+ExecHashBloomAdd(HashJoinTable hashtable, uint32 hashvalue)
+{
+	uint32	   *filter = hashtable->bloomFilter;
+	uint32		h2 = BLOOM_HASH2(hashvalue);
+	int			i;
+
+	for (i = 0; i < BLOOM_NUM_HASHES; i++)
+	{
+		uint32		bit = hashvalue & hashtable->bloomMask;
+
+		filter[bit >> 5] |= ((uint32) 1) << (bit & 31);
+		hashvalue += h2;
+	}
+}
+
+/*
+ * ExecHashBloomCheck
+ *		returns false if no inner tuple can have the given hash value
+ *
+ * After BLOOM_CHECK_PROBES calls, the filter is discarded if it has not been
+ * rejecting enough outer tuples to pay for itself; callers must therefore
+ * recheck hashtable->bloomFilter before each call.
+ */
+bool
+ExecHashBloomCheck(HashJoinTable hashtable, uint32 hashvalue)
+{
+	uint32	   *filter = hashtable->bloomFilter;
+	uint32		h2 = BLOOM_HASH2(hashvalue);
+	int			i;
+
+	Assert(filter != NULL);
+
+	if (++hashtable->bloomProbes == BLOOM_CHECK_PROBES &&
+		hashtable->bloomRejects <
+		BLOOM_CHECK_PROBES * BLOOM_MIN_REJECT_FRACTION)
+	{
+		pfree(hashtable->bloomFilter);
+		hashtable->bloomFilter = NULL;
+		return true;
+	}
+
+	for (i = 0; i < BLOOM_NUM_HASHES; i++)
+	{
+		uint32		bit = hashvalue & hashtable->bloomMask;
+
+		if ((filter[bit >> 5] & (((uint32) 1) << (bit & 31))) == 0)
+		{
+			hashtable->bloomRejects++;
+			return false;
+		}
+		hashvalue += h2;
+	}
+
+	return true;
+}
+
 /*
  * ExecHashIncreaseNumBatches
  *		increase the original number of batches in order to reduce
@@ -553,10 +680,10 @@ ExecHashIncreaseNumBatches(HashJoinTable hashtable)
 	int			oldnbatch = hashtable->nbatch;
 	int			curbatch = hashtable->curbatch;
 	int			nbatch;
-	int			i;
 	MemoryContext oldcxt;
 	long		ninmemory;
 	long		nfreed;
+	HashMemoryChunk oldchunks;
 
 	/* do nothing if we've decided to shut off growth */
 	if (!hashtable->growEnabled)
@@ -603,59 +730,70 @@ ExecHashIncreaseNumBatches(HashJoinTable hashtable)
 
 	hashtable->nbatch = nbatch;
 
+	/*
+	 * We walk the chunks rather than the buckets, so the buckets can simply
+	 * be reset now and refilled with the tuples we keep.  Kept tuples are
+	 * copied into fresh chunks, and the old chunks are freed as we go.
+	 */
+	memset(hashtable->buckets, 0,
+		   sizeof(HashJoinBucketData) * hashtable->nbuckets);
+	oldchunks = hashtable->chunks;
+	hashtable->chunks = NULL;
+	/* any queued tuples are in the chunks too, so just forget the queue */
+	hashtable->nPending = 0;
+
 	/*
 	 * Scan through the existing hash table entries and dump out any that are
 	 * no longer of the current batch.
 	 */
 	ninmemory = nfreed = 0;
 
-	for (i = 0; i < hashtable->nbuckets; i++)
+	while (oldchunks != NULL)
 	{
-		HashJoinTuple prevtuple;
-		HashJoinTuple tuple;
+		HashMemoryChunk nextchunk = oldchunks->next;
+		Size		idx = 0;
 
-		prevtuple = NULL;
-		tuple = hashtable->buckets[i];
-
-		while (tuple != NULL)
+		while (idx < oldchunks->used)
 		{
-			/* save link in case we delete */
-			HashJoinTuple nexttuple = tuple->next;
+			HashJoinTuple hashTuple = (HashJoinTuple) (oldchunks->data + idx);
+			MinimalTuple tuple = HJTUPLE_MINTUPLE(hashTuple);
+			Size		hashTupleSize = HJTUPLE_OVERHEAD + tuple->t_len;
 			int			bucketno;
 			int			batchno;
 
 			ninmemory++;
-			ExecHashGetBucketAndBatch(hashtable, tuple->hashvalue,
+			ExecHashGetBucketAndBatch(hashtable, hashTuple->hashvalue,
 									  &bucketno, &batchno);
-			Assert(bucketno == i);
 			if (batchno == curbatch)
 			{
-				/* keep tuple */
-				prevtuple = tuple;
+				/* keep tuple: copy it into the new chunks and relink it */
+				HashJoinTuple copyTuple;
+
+				copyTuple = (HashJoinTuple) dense_alloc(hashtable,
+														hashTupleSize);
+				memcpy(copyTuple, hashTuple, hashTupleSize);
+				ExecHashQueueTuple(hashtable, copyTuple, bucketno);
 			}
 			else
 			{
 				/* dump it out */
 				Assert(batchno > curbatch);
-				ExecHashJoinSaveTuple(HJTUPLE_MINTUPLE(tuple),
-									  tuple->hashvalue,
+				ExecHashJoinSaveTuple(tuple,
+									  hashTuple->hashvalue,
 									  &hashtable->innerBatchFile[batchno]);
-				/* and remove from hash table */
-				if (prevtuple)
-					prevtuple->next = nexttuple;
-				else
-					hashtable->buckets[i] = nexttuple;
-				/* prevtuple doesn't change */
-				hashtable->spaceUsed -=
-					HJTUPLE_OVERHEAD + HJTUPLE_MINTUPLE(tuple)->t_len;
-				pfree(tuple);
+				hashtable->spaceUsed -= hashTupleSize;
 				nfreed++;
 			}
 
-			tuple = nexttuple;
+			idx += MAXALIGN(hashTupleSize);
 		}
+
+		pfree(oldchunks);
+		oldchunks = nextchunk;
 	}
 
+	ExecHashTableLinkPending(hashtable);
+
 #ifdef HJDEBUG
 	printf("Freed %ld of %ld tuples, space now %lu\n",
 		   nfreed, ninmemory, (unsigned long) hashtable->spaceUsed);
@@ -713,12 +851,10 @@ ExecHashTableInsert(HashJoinTable hashtable,
 		int			hashTupleSize;
 
 		hashTupleSize = HJTUPLE_OVERHEAD + tuple->t_len;
-		hashTuple = (HashJoinTuple) MemoryContextAlloc(hashtable->batchCxt,
-													   hashTupleSize);
+		hashTuple = (HashJoinTuple) dense_alloc(hashtable, hashTupleSize);
 		hashTuple->hashvalue = hashvalue;
 		memcpy(HJTUPLE_MINTUPLE(hashTuple), tuple, tuple->t_len);
-		hashTuple->next = hashtable->buckets[bucketno];
-		hashtable->buckets[bucketno] = hashTuple;
+		ExecHashQueueTuple(hashtable, hashTuple, bucketno);
 		hashtable->spaceUsed += hashTupleSize;
 		if (hashtable->spaceUsed > hashtable->spacePeak)
 			hashtable->spacePeak = hashtable->spaceUsed;
@@ -737,6 +873,50 @@ ExecHashTableInsert(HashJoinTable hashtable,
 	}
 }
 
+/*
+ * ExecHashQueueTuple
+ *		queue a tuple already stored in the chunks for linking into its
+ *		bucket, prefetching the bucket header meanwhile
+ */
+static void
+ExecHashQueueTuple(HashJoinTable hashtable, HashJoinTuple hashTuple,
+				   int bucketno)
+{
+	int			n = hashtable->nPending;
+
+	pg_prefetch_mem(&hashtable->buckets[bucketno]);
+	hashtable->pendingTuple[n] = hashTuple;
+	hashtable->pendingBucket[n] = bucketno;
+	hashtable->nPending = n + 1;
+
+	if (hashtable->nPending == HASH_LINK_BATCH)
+		ExecHashTableLinkPending(hashtable);
+}
+
+/*
+ * ExecHashTableLinkPending
+ *		link all queued tuples into their buckets
+ *
+ * Must be called when done loading tuples, before the table is probed.
+ */
+void
+ExecHashTableLinkPending(HashJoinTable hashtable)
+{
+	HashJoinBucketData *buckets = hashtable->buckets;
+	int			i;
+
+	for (i = 0; i < hashtable->nPending; i++)
+	{
+		HashJoinTuple hashTuple = hashtable->pendingTuple[i];
+		HashJoinBucketData *bucket = &buckets[hashtable->pendingBucket[i]];
+
+		hashTuple->next = bucket->tuples;
+		bucket->tuples = hashTuple;
+		bucket->hashtags |= HJ_HASH_TAG(hashTuple->hashvalue);
+	}
+	hashtable->nPending = 0;
+}
+
 /*
  * ExecHashGetHashValue
  *		Compute the hash value for a tuple
@@ -893,17 +1073,30 @@ ExecScanHashBucket(HashJoinState *hjstate,
 	 * bucket, or NULL if it's time to start scanning a new bucket.
 	 *
 	 * If the tuple hashed to a skew bucket then scan the skew bucket
-	 * otherwise scan the standard hashtable bucket.
+	 * otherwise scan the standard hashtable bucket.  A standard bucket whose
+	 * hash tags show no tuple that could have our hash value is skipped
+	 * without walking its chain.
 	 */
 	if (hashTuple != NULL)
 		hashTuple = hashTuple->next;
 	else if (hjstate->hj_CurSkewBucketNo != INVALID_SKEW_BUCKET_NO)
 		hashTuple = hashtable->skewBucket[hjstate->hj_CurSkewBucketNo]->tuples;
 	else
-		hashTuple = hashtable->buckets[hjstate->hj_CurBucketNo];
+	{
+		HashJoinBucketData *bucket;
+
+		bucket = &hashtable->buckets[hjstate->hj_CurBucketNo];
+		if ((bucket->hashtags & HJ_HASH_TAG(hashvalue)) == 0)
+			return NULL;
+		hashTuple = bucket->tuples;
+	}
 
 	while (hashTuple != NULL)
 	{
+		/* start fetching the next tuple while we look at this one */
+		if (hashTuple->next != NULL)
+			pg_prefetch_mem(hashTuple->next);
+
 		if (hashTuple->hashvalue == hashvalue)
 		{
 			TupleTableSlot *inntuple;
@@ -952,12 +1145,16 @@ ExecHashTableReset(HashJoinTable hashtable)
 	oldcxt = MemoryContextSwitchTo(hashtable->batchCxt);
 
 	/* Reallocate and reinitialize the hash bucket headers. */
-	hashtable->buckets = (HashJoinTuple *)
-		palloc0(nbuckets * sizeof(HashJoinTuple));
+	hashtable->buckets = (HashJoinBucketData *)
+		palloc0(nbuckets * sizeof(HashJoinBucketData));
 
 	hashtable->spaceUsed = 0;
 
 	MemoryContextSwitchTo(oldcxt);
+
+	/* Forget the chunks (the memory was freed by the context reset above). */
+	hashtable->chunks = NULL;
+	hashtable->nPending = 0;
 }
 
 void
@@ -1270,8 +1467,20 @@ ExecHashRemoveNextSkewBucket(HashJoinTable hashtable)
 		if (batchno == hashtable->curbatch)
 		{
 			/* Move the tuple to the main hash table */
-			hashTuple->next = hashtable->buckets[bucketno];
-			hashtable->buckets[bucketno] = hashTuple;
+			HashJoinTuple copyTuple;
+
+			/*
+			 * We must copy the tuple into the dense storage, else it will not
+			 * be found by, eg, ExecHashIncreaseNumBatches.
+			 */
+			copyTuple = (HashJoinTuple) dense_alloc(hashtable, tupleSize);
+			memcpy(copyTuple, hashTuple, tupleSize);
+			pfree(hashTuple);
+
+			copyTuple->next = hashtable->buckets[bucketno].tuples;
+			hashtable->buckets[bucketno].tuples = copyTuple;
+			hashtable->buckets[bucketno].hashtags |= HJ_HASH_TAG(hashvalue);
+
 			/* We have reduced skew space, but overall space doesn't change */
 			hashtable->spaceUsedSkew -= tupleSize;
 		}
@@ -1322,3 +1531,75 @@ ExecHashRemoveNextSkewBucket(HashJoinTable hashtable)
 		hashtable->spaceUsedSkew = 0;
 	}
 }
+
+/*
+ * Allocate 'size' bytes from the currently active HashMemoryChunk
+ */
+static void *
+dense_alloc(HashJoinTable hashtable, Size size)
+{
+	HashMemoryChunk newChunk;
+	char	   *ptr;
+
+	/* just in case the size is not already aligned properly */
+	size = MAXALIGN(size);
+
+	/*
+	 * If tuple size is larger than threshold, allocate a separate chunk.
+	 */
+	if (size > HASH_CHUNK_THRESHOLD)
+	{
+		/* allocate new chunk and put it at the beginning of the list */
+		newChunk = (HashMemoryChunk) MemoryContextAlloc(hashtable->batchCxt,
+								 offsetof(HashMemoryChunkData, data) + size);
+		newChunk->maxlen = size;
+		newChunk->used = size;
+		newChunk->ntuples = 1;
+
+		/*
+		 * Add this chunk to the list after the first existing chunk, so that
+		 * we don't lose the remaining space in the "current" chunk.
+		 */
+		if (hashtable->chunks != NULL)
+		{
+			newChunk->next = hashtable->chunks->next;
+			hashtable->chunks->next = newChunk;
+		}
+		else
+		{
+			newChunk->next = hashtable->chunks;
+			hashtable->chunks = newChunk;
+		}
+
+		return newChunk->data;
+	}
+
+	/*
+	 * See if we have enough space for it in the current chunk (if any). If
+	 * not, allocate a fresh chunk.
+	 */
+	if ((hashtable->chunks == NULL) ||
+		(hashtable->chunks->maxlen - hashtable->chunks->used) < size)
+	{
+		/* allocate new chunk and put it at the beginning of the list */
+		newChunk = (HashMemoryChunk) MemoryContextAlloc(hashtable->batchCxt,
+					  offsetof(HashMemoryChunkData, data) + HASH_CHUNK_SIZE);
+
+		newChunk->maxlen = HASH_CHUNK_SIZE;
+		newChunk->used = size;
+		newChunk->ntuples = 1;
+
+		newChunk->next = hashtable->chunks;
+		hashtable->chunks = newChunk;
+
+		return newChunk->data;
+	}
+
+	/* There is enough space in the current chunk, let's add the tuple */
+	ptr = hashtable->chunks->data + hashtable->chunks->used;
+	hashtable->chunks->used += size;
+	hashtable->chunks->ntuples += 1;
+
+	/* return pointer to the start of the tuple memory */
+	return ptr;
+}
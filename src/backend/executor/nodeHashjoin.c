@@ -147,6 +147,14 @@ ExecHashJoin(HashJoinState *node)
 										node->hj_HashOperators);
 		node->hj_HashTable = hashtable;
 
+		/*
+		 * Unless we must emit unmatched outer tuples, also build a Bloom
+		 * filter to weed out outer tuples that cannot match.
+		 */
+		if (!HASHJOIN_IS_OUTER(node))
+			ExecHashTableInitBloom(hashtable,
+								   outerPlan(hashNode->ps.plan)->plan_rows);
+
 		/*
 		 * execute the Hash node, to build the hash table
 		 */
@@ -578,12 +586,20 @@ ExecHashJoinOuterGetTuple(PlanState *outerNode,
 				/* remember outer relation is not empty for possible rescan */
 				hjstate->hj_OuterNotEmpty = true;
 
-				return slot;
+				/*
+				 * Skip the tuple if the Bloom filter says no inner tuple has
+				 * its hash value.  This is only done during the first pass,
+				 * so tuples rejected here never reach the batch files.
+				 */
+				if (hashtable->bloomFilter == NULL ||
+					ExecHashBloomCheck(hashtable, *hashvalue))
+					return slot;
 			}
 
 			/*
-			 * That tuple couldn't match because of a NULL, so discard it and
-			 * continue with the next one.
+			 * That tuple couldn't match because of a NULL or because the
+			 * Bloom filter rejected it, so discard it and continue with the
+			 * next one.
 			 */
 			slot = ExecProcNode(outerNode);
 		}
@@ -731,6 +747,7 @@ start_over:
 			 */
 			ExecHashTableInsert(hashtable, slot, hashvalue);
 		}
+		ExecHashTableLinkPending(hashtable);
 
 		/*
 		 * after we build the hash table, the inner batch file is no longer
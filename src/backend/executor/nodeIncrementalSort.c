@@ -0,0 +1,361 @@
+/*-------------------------------------------------------------------------
+ *
+ * nodeIncrementalSort.c
+ *	  Routines to handle incremental sorting of relations.
+ *
+ * An incremental sort is used when the input is already sorted on a
+ * leading subset of the required sort keys.  Rather than reading and
+ * sorting the whole input, we read one batch of tuples sharing the same
+ * values of the presorted keys, sort just that batch on the remaining keys
+ * and return it, and only then read on.  This bounds the memory used to
+ * the largest batch and lets the first tuples come out long before the
+ * input is exhausted, which matters most under a LIMIT.
+ *
+ * Batches are made at least INCSORT_MIN_GROUP tuples long by merging
+ * consecutive groups, and then extended to the end of the group in
+ * progress; since every key is sorted within a batch, merging groups is
+ * harmless.  Once a batch is full, each further tuple is compared on the
+ * presorted keys with the last tuple accepted at the minimum size; the
+ * first one that differs starts the next batch and is held back until
+ * then.
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *	  $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#include "postgres.h"
+
+#include "executor/execdebug.h"
+#include "executor/executor.h"
+#include "executor/nodeIncrementalSort.h"
+#include "miscadmin.h"
+#include "utils/lsyscache.h"
+#include "utils/memutils.h"
+#include "utils/tuplesort.h"
+
+
+static bool incsort_fill_batch(IncrementalSortState *node);
+
+
+/* ----------------------------------------------------------------
+ *		incsort_fill_batch
+ *
+ *		Read the next batch of tuples from the outer plan into a fresh
+ *		tuplesort and sort it.  Returns false if the input had no more
+ *		tuples to give.
+ * ----------------------------------------------------------------
+ */
+static bool
+incsort_fill_batch(IncrementalSortState *node)
+{
+	IncrementalSort *plannode = (IncrementalSort *) node->ss.ps.plan;
+	PlanState  *outerNode = outerPlanState(node);
+	Tuplesortstate *tuplesortstate;
+	TupleTableSlot *slot;
+	int64		ntuples = 0;
+
+	if (node->outerDone && TupIsNull(node->lookahead))
+		return false;
+
+	tuplesortstate = tuplesort_begin_heap(ExecGetResultType(outerNode),
+										  plannode->sort.numCols,
+										  plannode->sort.sortColIdx,
+										  plannode->sort.sortOperators,
+										  plannode->sort.nullsFirst,
+										  work_mem,
+										  false);
+
+	/*
+	 * Under a LIMIT, this batch need only produce whatever the earlier
+	 * batches didn't.
+	 */
+	if (node->bounded)
+		tuplesort_set_bound(tuplesortstate, node->bound - node->bound_Done);
+	node->tuplesortstate = (void *) tuplesortstate;
+
+	ExecClearTuple(node->groupPivot);
+
+	for (;;)
+	{
+		/* Start with the tuple that ended the previous batch, if any */
+		if (!TupIsNull(node->lookahead))
+			slot = node->lookahead;
+		else
+		{
+			slot = ExecProcNode(outerNode);
+			if (TupIsNull(slot))
+			{
+				node->outerDone = true;
+				break;
+			}
+		}
+
+		/*
+		 * Once the batch has reached its minimum size, stop at the first
+		 * tuple that begins a new presorted-key group.  It becomes the
+		 * first tuple of the next batch.
+		 */
+		if (ntuples >= INCSORT_MIN_GROUP &&
+			!execTuplesMatch(node->groupPivot, slot,
+							 plannode->presortedCols,
+							 plannode->sort.sortColIdx,
+							 node->eqfunctions,
+							 node->tempContext))
+		{
+			if (slot != node->lookahead)
+				ExecCopySlot(node->lookahead, slot);
+			break;
+		}
+
+		tuplesort_puttupleslot(tuplesortstate, slot);
+		if (++ntuples == INCSORT_MIN_GROUP)
+			ExecCopySlot(node->groupPivot, slot);
+
+		if (slot == node->lookahead)
+			ExecClearTuple(node->lookahead);
+	}
+
+	tuplesort_performsort(tuplesortstate);
+
+	return ntuples > 0;
+}
+
+/* ----------------------------------------------------------------
+ *		ExecIncrementalSort
+ *
+ *		Returns the next tuple of the current sorted batch, reading and
+ *		sorting a new batch from the outer plan whenever the current
+ *		one runs out.
+ *
+ *		Conditions:
+ *		  -- the outer plan returns tuples sorted on the presorted keys.
+ *
+ *		Initial States:
+ *		  -- the outer child is prepared to return the first tuple.
+ * ----------------------------------------------------------------
+ */
+TupleTableSlot *
+ExecIncrementalSort(IncrementalSortState *node)
+{
+	EState	   *estate = node->ss.ps.state;
+	ScanDirection dir = estate->es_direction;
+	TupleTableSlot *slot = node->ss.ps.ps_ResultTupleSlot;
+
+	SO1_printf("ExecIncrementalSort: %s\n",
+			   "entering routine");
+
+	for (;;)
+	{
+		if (node->batchReady)
+		{
+			if (tuplesort_gettupleslot((Tuplesortstate *) node->tuplesortstate,
+									   true, slot))
+			{
+				node->bound_Done++;
+				return slot;
+			}
+
+			/* Current batch exhausted; throw it away */
+			tuplesort_end((Tuplesortstate *) node->tuplesortstate);
+			node->tuplesortstate = NULL;
+			node->batchReady = false;
+
+			if (node->bounded && node->bound_Done >= node->bound)
+				return ExecClearTuple(slot);
+		}
+
+		/*
+		 * Read and sort the next batch.  As in ExecSort, the subplan is
+		 * always scanned forwards.
+		 */
+		SO1_printf("ExecIncrementalSort: %s\n",
+				   "sorting next batch");
+
+		estate->es_direction = ForwardScanDirection;
+		if (!incsort_fill_batch(node))
+		{
+			estate->es_direction = dir;
+			if (node->tuplesortstate != NULL)
+			{
+				tuplesort_end((Tuplesortstate *) node->tuplesortstate);
+				node->tuplesortstate = NULL;
+			}
+			return ExecClearTuple(slot);
+		}
+		estate->es_direction = dir;
+		node->batchReady = true;
+	}
+}
+
+/* ----------------------------------------------------------------
+ *		ExecInitIncrementalSort
+ *
+ *		Creates the run-time state information for the incremental sort
+ *		node produced by the planner and initializes its outer subtree.
+ * ----------------------------------------------------------------
+ */
+IncrementalSortState *
+ExecInitIncrementalSort(IncrementalSort *node, EState *estate, int eflags)
+{
+	IncrementalSortState *incrsortstate;
+	Oid		   *eqOperators;
+	int			i;
+
+	SO1_printf("ExecInitIncrementalSort: %s\n",
+			   "initializing incremental sort node");
+
+	/*
+	 * We only ever hold one batch, so we can neither scan backwards nor
+	 * support mark/restore.  The planner knows this.
+	 */
+	Assert(!(eflags & (EXEC_FLAG_BACKWARD | EXEC_FLAG_MARK)));
+
+	/*
+	 * create state structure
+	 */
+	incrsortstate = makeNode(IncrementalSortState);
+	incrsortstate->ss.ps.plan = (Plan *) node;
+	incrsortstate->ss.ps.state = estate;
+
+	incrsortstate->bounded = false;
+	incrsortstate->bound_Done = 0;
+	incrsortstate->outerDone = false;
+	incrsortstate->batchReady = false;
+	incrsortstate->tuplesortstate = NULL;
+
+	/*
+	 * Miscellaneous initialization
+	 *
+	 * Like Sort, we never call ExecQual or ExecProject, but we need a
+	 * per-tuple memory context for execTuplesMatch.
+	 */
+	incrsortstate->tempContext =
+		AllocSetContextCreate(CurrentMemoryContext,
+							  "IncrementalSort",
+							  ALLOCSET_DEFAULT_MINSIZE,
+							  ALLOCSET_DEFAULT_INITSIZE,
+							  ALLOCSET_DEFAULT_MAXSIZE);
+
+	/*
+	 * tuple table initialization
+	 */
+	ExecInitResultTupleSlot(estate, &incrsortstate->ss.ps);
+	ExecInitScanTupleSlot(estate, &incrsortstate->ss);
+	incrsortstate->groupPivot = ExecInitExtraTupleSlot(estate);
+	incrsortstate->lookahead = ExecInitExtraTupleSlot(estate);
+
+	/*
+	 * initialize child nodes
+	 *
+	 * We re-read the subplan on rescan, so it need not support REWIND.
+	 */
+	eflags &= ~(EXEC_FLAG_REWIND | EXEC_FLAG_BACKWARD | EXEC_FLAG_MARK);
+
+	outerPlanState(incrsortstate) = ExecInitNode(outerPlan(node), estate, eflags);
+
+	/*
+	 * initialize tuple type.  no need to initialize projection info because
+	 * this node doesn't do projections.
+	 */
+	ExecAssignResultTypeFromTL(&incrsortstate->ss.ps);
+	ExecAssignScanTypeFromOuterPlan(&incrsortstate->ss);
+	incrsortstate->ss.ps.ps_ProjInfo = NULL;
+
+	ExecSetSlotDescriptor(incrsortstate->groupPivot,
+						  ExecGetResultType(outerPlanState(incrsortstate)));
+	ExecSetSlotDescriptor(incrsortstate->lookahead,
+						  ExecGetResultType(outerPlanState(incrsortstate)));
+
+	/*
+	 * Precompute fmgr lookup data for the group boundary test.  The plan
+	 * carries only ordering operators, so find the matching equality ones.
+	 */
+	eqOperators = (Oid *) palloc(node->presortedCols * sizeof(Oid));
+	for (i = 0; i < node->presortedCols; i++)
+	{
+		Oid			sortop = node->sort.sortOperators[i];
+
+		eqOperators[i] = get_equality_op_for_ordering_op(sortop, NULL);
+		if (!OidIsValid(eqOperators[i]))
+			elog(ERROR, "could not find equality operator for ordering operator %u",
+				 sortop);
+	}
+	incrsortstate->eqfunctions =
+		execTuplesMatchPrepare(node->presortedCols, eqOperators);
+	pfree(eqOperators);
+
+	SO1_printf("ExecInitIncrementalSort: %s\n",
+			   "incremental sort node initialized");
+
+	return incrsortstate;
+}
+
+/* ----------------------------------------------------------------
+ *		ExecEndIncrementalSort(node)
+ * ----------------------------------------------------------------
+ */
+void
+ExecEndIncrementalSort(IncrementalSortState *node)
+{
+	SO1_printf("ExecEndIncrementalSort: %s\n",
+			   "shutting down incremental sort node");
+
+	/*
+	 * clean out the tuple table
+	 */
+	ExecClearTuple(node->ss.ss_ScanTupleSlot);
+	/* must drop pointer to sort result tuple */
+	ExecClearTuple(node->ss.ps.ps_ResultTupleSlot);
+	ExecClearTuple(node->groupPivot);
+	ExecClearTuple(node->lookahead);
+
+	/*
+	 * Release tuplesort resources
+	 */
+	if (node->tuplesortstate != NULL)
+		tuplesort_end((Tuplesortstate *) node->tuplesortstate);
+	node->tuplesortstate = NULL;
+
+	MemoryContextDelete(node->tempContext);
+
+	/*
+	 * shut down the subplan
+	 */
+	ExecEndNode(outerPlanState(node));
+
+	SO1_printf("ExecEndIncrementalSort: %s\n",
+			   "incremental sort node shutdown");
+}
+
+void
+ExecReScanIncrementalSort(IncrementalSortState *node, ExprContext *exprCtxt)
+{
+	/*
+	 * We keep no more than one batch, so a rescan always starts over from
+	 * the beginning of the input.
+	 */
+	ExecClearTuple(node->ss.ps.ps_ResultTupleSlot);
+	ExecClearTuple(node->groupPivot);
+	ExecClearTuple(node->lookahead);
+
+	if (node->tuplesortstate != NULL)
+		tuplesort_end((Tuplesortstate *) node->tuplesortstate);
+	node->tuplesortstate = NULL;
+
+	node->bound_Done = 0;
+	node->outerDone = false;
+	node->batchReady = false;
+
+	/*
+	 * if chgParam of subnode is not null then plan will be re-scanned by
+	 * first ExecProcNode.
+	 */
+	if (((PlanState *) node)->lefttree->chgParam == NULL)
+		ExecReScan(((PlanState *) node)->lefttree, exprCtxt);
+}
@@ -16,6 +16,7 @@
  * INTERFACE ROUTINES
  *		ExecIndexScan			scans a relation using indices
  *		ExecIndexNext			using index to retrieve next tuple
+ *		IndexOnlyNext			same, avoiding heap fetches where possible
  *		ExecInitIndexScan		creates and initializes state info.
  *		ExecIndexReScan			rescans the indexed relation.
  *		ExecEndIndexScan		releases all storage.
@@ -27,15 +28,21 @@
 #include "access/genam.h"
 #include "access/nbtree.h"
 #include "access/relscan.h"
+#include "access/visibilitymap.h"
 #include "executor/execdebug.h"
 #include "executor/nodeIndexscan.h"
 #include "optimizer/clauses.h"
+#include "storage/bufmgr.h"
 #include "utils/array.h"
 #include "utils/lsyscache.h"
 #include "utils/memutils.h"
+#include "utils/tqual.h"
 
 
 static TupleTableSlot *IndexNext(IndexScanState *node);
+static TupleTableSlot *IndexOnlyNext(IndexScanState *node);
+static void StoreIndexTuple(TupleTableSlot *slot, IndexTuple itup,
+				Relation indexRel);
 
 
 /* ----------------------------------------------------------------
@@ -109,6 +116,130 @@ IndexNext(IndexScanState *node)
 	return ExecClearTuple(slot);
 }
 
+/* ----------------------------------------------------------------
+ *		IndexOnlyNext
+ *
+ *		Variant of IndexNext for index-only scans: the scan tuple is
+ *		built from the index tuple, and the heap is visited only for
+ *		pages that the visibility map doesn't show as all-visible.
+ * ----------------------------------------------------------------
+ */
+static TupleTableSlot *
+IndexOnlyNext(IndexScanState *node)
+{
+	EState	   *estate;
+	ExprContext *econtext;
+	ScanDirection direction;
+	IndexScanDesc scandesc;
+	ItemPointer tid;
+	TupleTableSlot *slot;
+
+	/*
+	 * extract necessary information from index scan node
+	 */
+	estate = node->ss.ps.state;
+	direction = estate->es_direction;
+	/* flip direction if this is an overall backward scan */
+	if (ScanDirectionIsBackward(((IndexScan *) node->ss.ps.plan)->indexorderdir))
+	{
+		if (ScanDirectionIsForward(direction))
+			direction = BackwardScanDirection;
+		else if (ScanDirectionIsBackward(direction))
+			direction = ForwardScanDirection;
+	}
+	scandesc = node->iss_ScanDesc;
+	econtext = node->ss.ps.ps_ExprContext;
+	slot = node->ss.ss_ScanTupleSlot;
+
+	/*
+	 * OK, now that we have what we need, fetch the next tuple.
+	 */
+	while ((tid = index_getnext_tid(scandesc, direction)) != NULL)
+	{
+		/*
+		 * We can skip the heap fetch if the TID references a heap page on
+		 * which all tuples are known visible to everybody.  In any case,
+		 * we'll use the index tuple not the heap tuple as the data source.
+		 */
+		if (!visibilitymap_test(scandesc->heapRelation,
+								ItemPointerGetBlockNumber(tid),
+								&node->iss_VMBuffer))
+		{
+			/*
+			 * Rats, we have to visit the heap to check visibility.
+			 */
+			node->iss_HeapFetches++;
+			if (index_fetch_heap(scandesc) == NULL)
+				continue;		/* no visible tuple, try next index entry */
+
+			/*
+			 * Only MVCC snapshots are supported here, so there should be no
+			 * need to keep following the HOT chain once a visible entry has
+			 * been found.
+			 */
+			Assert(scandesc->xs_next_hot == InvalidOffsetNumber);
+		}
+
+		/*
+		 * Fill the scan tuple slot with data from the index.
+		 */
+		StoreIndexTuple(slot, scandesc->xs_itup, node->iss_RelationDesc);
+
+		/*
+		 * If the index was lossy, we have to recheck the index quals.  Only
+		 * the indexed columns are available, but those are all the quals
+		 * can refer to.
+		 */
+		if (scandesc->xs_recheck)
+		{
+			econtext->ecxt_scantuple = slot;
+			ResetExprContext(econtext);
+			if (!ExecQual(node->indexqualorig, econtext, false))
+				continue;		/* nope, so ask index for another one */
+		}
+
+		return slot;
+	}
+
+	/*
+	 * if we get here it means the index scan failed so we are at the end of
+	 * the scan..
+	 */
+	return ExecClearTuple(slot);
+}
+
+/*
+ * StoreIndexTuple
+ *		Fill the slot with data from the index tuple.
+ *
+ * The slot has the heap relation's row type.  The planner only chooses an
+ * index-only scan when every column the plan references is a plain index
+ * column, so the remaining columns are simply set to null.
+ */
+static void
+StoreIndexTuple(TupleTableSlot *slot, IndexTuple itup, Relation indexRel)
+{
+	TupleDesc	itupdesc = RelationGetDescr(indexRel);
+	int2vector *indkey = &indexRel->rd_index->indkey;
+	Datum	   *values = slot->tts_values;
+	bool	   *isnull = slot->tts_isnull;
+	int			i;
+
+	ExecClearTuple(slot);
+	memset(isnull, true, slot->tts_tupleDescriptor->natts * sizeof(bool));
+
+	for (i = 0; i < itupdesc->natts; i++)
+	{
+		AttrNumber	attno = indkey->values[i];
+
+		if (attno > 0)
+			values[attno - 1] = index_getattr(itup, i + 1, itupdesc,
+											  &isnull[attno - 1]);
+	}
+
+	ExecStoreVirtualTuple(slot);
+}
+
 /*
  * IndexRecheck -- access method routine to recheck a tuple in EvalPlanQual
  */
@@ -143,6 +274,11 @@ ExecIndexScan(IndexScanState *node)
 	if (node->iss_NumRuntimeKeys != 0 && !node->iss_RuntimeKeysReady)
 		ExecReScan((PlanState *) node, NULL);
 
+	if (node->iss_IndexOnly)
+		return ExecScan(&node->ss,
+						(ExecScanAccessMtd) IndexOnlyNext,
+						(ExecScanRecheckMtd) IndexRecheck);
+
 	return ExecScan(&node->ss,
 					(ExecScanAccessMtd) IndexNext,
 					(ExecScanRecheckMtd) IndexRecheck);
@@ -427,6 +563,13 @@ ExecEndIndexScan(IndexScanState *node)
 	ExecClearTuple(node->ss.ps.ps_ResultTupleSlot);
 	ExecClearTuple(node->ss.ss_ScanTupleSlot);
 
+	/* Release VM buffer pin, if any. */
+	if (node->iss_VMBuffer != InvalidBuffer)
+	{
+		ReleaseBuffer(node->iss_VMBuffer);
+		node->iss_VMBuffer = InvalidBuffer;
+	}
+
 	/*
 	 * close the index relation (no-op if we didn't open it)
 	 */
@@ -563,6 +706,16 @@ ExecInitIndexScan(IndexScan *node, EState *estate, int eflags)
 	 */
 	indexstate->iss_RuntimeKeysReady = false;
 
+	/*
+	 * Heap fetches can only be skipped under an MVCC snapshot, since the
+	 * visibility map says nothing about what other snapshot types would
+	 * see.  Otherwise just run the scan the regular way.
+	 */
+	indexstate->iss_IndexOnly = node->indexonly &&
+		IsMVCCSnapshot(estate->es_snapshot);
+	indexstate->iss_VMBuffer = InvalidBuffer;
+	indexstate->iss_HeapFetches = 0;
+
 	/*
 	 * build the index scan keys from the index qualification
 	 */
@@ -605,6 +758,9 @@ ExecInitIndexScan(IndexScan *node, EState *estate, int eflags)
 											   indexstate->iss_NumScanKeys,
 											   indexstate->iss_ScanKeys);
 
+	/* Ask the index AM to return index tuples, if we can use them */
+	indexstate->iss_ScanDesc->xs_want_itup = indexstate->iss_IndexOnly;
+
 	/*
 	 * all done.
 	 */
@@ -0,0 +1,596 @@
+/*-------------------------------------------------------------------------
+ *
+ * nodeMemoize.c
+ *	  Routines to handle caching of the results of a parameterized
+ *	  nestloop inner scan.
+ *
+ * A Memoize node sits between a nestloop and its inner side when that is
+ * an indexscan whose join clauses refer to the outer tuple.  Each time the
+ * nestloop rescans us for a new outer tuple, we evaluate the outer values
+ * the inner scan depends on (the cache key) and look them up in a hash
+ * table.  On a hit, the rows the subplan returned for the same key last
+ * time are returned from memory and the subplan isn't run at all.  On a
+ * miss, the subplan is rescanned and the rows it returns are saved in a
+ * new entry as they go by.
+ *
+ * The cache is limited to work_mem.  When it's full, the least recently
+ * used entries are thrown away to make room.  An entry that would not fit
+ * even by itself is abandoned, and the rest of that scan just passes the
+ * subplan's rows through.  An entry is only used once the subplan has been
+ * read to the end for it; a scan the nestloop abandoned part way (because
+ * of an upper LIMIT, say) leaves nothing behind.
+ *
+ * A change in any executor parameter used below us makes the cached rows
+ * stale, so the whole cache is discarded then.
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *	  $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+/*
+ * INTERFACE ROUTINES
+ *		ExecMemoize				- return the next row for the current key
+ *		ExecInitMemoize			- initialize node and subnodes
+ *		ExecEndMemoize			- shutdown node and subnodes
+ *		ExecReScanMemoize		- look up the key of a new outer tuple
+ */
+#include "postgres.h"
+
+#include "access/hash.h"
+#include "executor/executor.h"
+#include "executor/nodeMemoize.h"
+#include "lib/dllist.h"
+#include "miscadmin.h"
+#include "nodes/nodeFuncs.h"
+#include "pgstat.h"
+#include "utils/datum.h"
+#include "utils/lsyscache.h"
+#include "utils/memutils.h"
+
+/* values of MemoizeState.mstatus */
+#define MEMO_END			0	/* no more rows for the current key */
+#define MEMO_CACHE_HIT		1	/* returning the rows of a cached entry */
+#define MEMO_FILLING		2	/* reading the subplan into a new entry */
+#define MEMO_BYPASS			3	/* reading the subplan without caching */
+
+/*
+ * A cache entry.  The hash table's own key is the entry's firstTuple,
+ * which holds the cache key values.
+ */
+typedef struct MemoizeEntryData
+{
+	/* shared must be the first field in this struct! */
+	TupleHashEntryData shared;	/* common header for hash table entries */
+	Dlelem		lruElem;		/* link in the LRU list */
+	List	   *tuples;			/* cached MinimalTuples, in subplan order */
+	Size		mem;			/* memory charged to this entry */
+} MemoizeEntryData;
+
+/*
+ * Cache keys that have no equality operator of their own (see
+ * create_memoize_path) must be binary equal.  The hash table calls these
+ * in place of the type's hash and equality functions for them; fn_extra
+ * points to the key's MemoizeKeyType.
+ */
+typedef struct MemoizeKeyType
+{
+	int16		typlen;
+	bool		typbyval;
+} MemoizeKeyType;
+
+static Datum memo_binary_hash(PG_FUNCTION_ARGS);
+static Datum memo_binary_eq(PG_FUNCTION_ARGS);
+static void memo_binary_fmgr_info(PGFunction func, short nargs,
+					  MemoizeKeyType *keytype, FmgrInfo *finfo);
+static void memo_build_hashtable(MemoizeState *node);
+static void memo_remove_entry(MemoizeState *node, MemoizeEntry entry);
+static bool memo_make_room(MemoizeState *node);
+static void memo_cache_tuple(MemoizeState *node, TupleTableSlot *slot);
+static double memo_chunk_space(double size);
+
+
+/*
+ * Hash a binary-compared key.  Varlenas are hashed on their contents, so
+ * that the header format doesn't matter.
+ */
+static Datum
+memo_binary_hash(PG_FUNCTION_ARGS)
+{
+	MemoizeKeyType *keytype = (MemoizeKeyType *) fcinfo->flinfo->fn_extra;
+	Datum		value = PG_GETARG_DATUM(0);
+
+	if (keytype->typbyval)
+		return hash_any((unsigned char *) &value, sizeof(Datum));
+	if (keytype->typlen == -1)
+	{
+		struct varlena *v = PG_DETOAST_DATUM_PACKED(value);
+
+		return hash_any((unsigned char *) VARDATA_ANY(v),
+						VARSIZE_ANY_EXHDR(v));
+	}
+	return hash_any((unsigned char *) DatumGetPointer(value),
+					datumGetSize(value, false, keytype->typlen));
+}
+
+/*
+ * Compare binary-compared keys, consistently with memo_binary_hash.
+ */
+static Datum
+memo_binary_eq(PG_FUNCTION_ARGS)
+{
+	MemoizeKeyType *keytype = (MemoizeKeyType *) fcinfo->flinfo->fn_extra;
+
+	if (keytype->typlen == -1)
+	{
+		struct varlena *v1 = PG_DETOAST_DATUM_PACKED(PG_GETARG_DATUM(0));
+		struct varlena *v2 = PG_DETOAST_DATUM_PACKED(PG_GETARG_DATUM(1));
+
+		PG_RETURN_BOOL(VARSIZE_ANY_EXHDR(v1) == VARSIZE_ANY_EXHDR(v2) &&
+					   memcmp(VARDATA_ANY(v1), VARDATA_ANY(v2),
+							  VARSIZE_ANY_EXHDR(v1)) == 0);
+	}
+	PG_RETURN_BOOL(datumIsEqual(PG_GETARG_DATUM(0), PG_GETARG_DATUM(1),
+								keytype->typbyval, keytype->typlen));
+}
+
+/*
+ * Fill in 'finfo' to call one of the above for a key of type 'keytype'.
+ */
+static void
+memo_binary_fmgr_info(PGFunction func, short nargs, MemoizeKeyType *keytype,
+					  FmgrInfo *finfo)
+{
+	MemSet(finfo, 0, sizeof(FmgrInfo));
+	finfo->fn_addr = func;
+	finfo->fn_oid = InvalidOid;
+	finfo->fn_nargs = nargs;
+	finfo->fn_strict = true;
+	finfo->fn_stats = TRACK_FUNC_ALL;	/* ie, never track */
+	finfo->fn_extra = (void *) keytype;
+	finfo->fn_mcxt = CurrentMemoryContext;
+}
+
+/*
+ * Create an empty cache.  Everything it holds lives in tableContext.
+ */
+static void
+memo_build_hashtable(MemoizeState *node)
+{
+	Memoize    *plannode = (Memoize *) node->ps.plan;
+	MemoryContext oldcontext;
+
+	oldcontext = MemoryContextSwitchTo(node->tableContext);
+	node->hashtable = BuildTupleHashTable(plannode->numKeys,
+										  node->keyColIdx,
+										  node->eqfunctions,
+										  node->hashfunctions,
+										  Max(plannode->estEntries, 1),
+										  sizeof(MemoizeEntryData),
+										  node->tableContext,
+										  node->tempContext);
+	MemoryContextSwitchTo(oldcontext);
+
+	DLInitList(node->lru);
+	node->memUsed = 0;
+	node->entry = NULL;
+}
+
+/*
+ * Throw a cache entry away and free its rows.
+ */
+static void
+memo_remove_entry(MemoizeState *node, MemoizeEntry entry)
+{
+	MinimalTuple key = entry->shared.firstTuple;
+
+	DLRemove(&entry->lruElem);
+	node->memUsed -= entry->mem;
+	list_free_deep(entry->tuples);
+
+	ExecStoreMinimalTuple(key, node->evictslot, false);
+	if (!RemoveTupleHashEntry(node->hashtable, node->evictslot))
+		elog(ERROR, "memoize cache entry not found");
+	ExecClearTuple(node->evictslot);
+	pfree(key);
+
+	if (entry == node->entry)
+		node->entry = NULL;
+}
+
+/*
+ * Throw away least recently used entries until the cache is within its
+ * memory limit again.  The entry being filled, always the most recently
+ * used one, is not thrown away here; return false if it alone exceeds the
+ * limit.
+ */
+static bool
+memo_make_room(MemoizeState *node)
+{
+	while (node->memUsed > node->memLimit)
+	{
+		MemoizeEntry victim;
+
+		victim = (MemoizeEntry) DLE_VAL(DLGetTail(node->lru));
+		if (victim == node->entry)
+			return false;
+		memo_remove_entry(node, victim);
+		node->evictions++;
+	}
+	return true;
+}
+
+/*
+ * Add the subplan's row in 'slot' to the entry being filled.  If the entry
+ * gets too big to keep, give up on it and pass the rest of the scan
+ * through uncached.
+ */
+static void
+memo_cache_tuple(MemoizeState *node, TupleTableSlot *slot)
+{
+	MemoizeEntry entry = node->entry;
+	MemoryContext oldcontext;
+	MinimalTuple tuple;
+
+	oldcontext = MemoryContextSwitchTo(node->tableContext);
+	tuple = ExecCopySlotMinimalTuple(slot);
+	entry->tuples = lappend(entry->tuples, tuple);
+	MemoryContextSwitchTo(oldcontext);
+
+	entry->mem += GetMemoryChunkSpace(tuple) + sizeof(ListCell);
+	node->memUsed += GetMemoryChunkSpace(tuple) + sizeof(ListCell);
+
+	if (!memo_make_room(node))
+	{
+		memo_remove_entry(node, entry);
+		node->overflows++;
+		node->mstatus = MEMO_BYPASS;
+	}
+}
+
+/* ----------------------------------------------------------------
+ *		ExecMemoize
+ *
+ *		Returns the next row for the cache key set up by the last
+ *		rescan, from the cache or from the subplan.
+ * ----------------------------------------------------------------
+ */
+TupleTableSlot *
+ExecMemoize(MemoizeState *node)
+{
+	TupleTableSlot *slot;
+
+	switch (node->mstatus)
+	{
+		case MEMO_CACHE_HIT:
+			if (node->nextTuple != NULL)
+			{
+				MinimalTuple tuple = (MinimalTuple) lfirst(node->nextTuple);
+
+				node->nextTuple = lnext(node->nextTuple);
+				return ExecStoreMinimalTuple(tuple,
+											 node->ps.ps_ResultTupleSlot,
+											 false);
+			}
+			break;
+
+		case MEMO_FILLING:
+			slot = ExecProcNode(outerPlanState(node));
+			if (!TupIsNull(slot))
+			{
+				memo_cache_tuple(node, slot);
+				return slot;
+			}
+			/* the entry is complete, and may be used from now on */
+			node->entry = NULL;
+			break;
+
+		case MEMO_BYPASS:
+			slot = ExecProcNode(outerPlanState(node));
+			if (!TupIsNull(slot))
+				return slot;
+			break;
+
+		case MEMO_END:
+			break;
+
+		default:
+			elog(ERROR, "unrecognized memoize status: %d", node->mstatus);
+			break;
+	}
+
+	node->mstatus = MEMO_END;
+	return ExecClearTuple(node->ps.ps_ResultTupleSlot);
+}
+
+/* ----------------------------------------------------------------
+ *		ExecInitMemoize
+ * ----------------------------------------------------------------
+ */
+MemoizeState *
+ExecInitMemoize(Memoize *node, EState *estate, int eflags)
+{
+	MemoizeState *mstate;
+	TupleDesc	keydesc;
+	ListCell   *l;
+	int			i;
+
+	/* check for unsupported flags */
+	Assert(!(eflags & (EXEC_FLAG_BACKWARD | EXEC_FLAG_MARK)));
+
+	/*
+	 * create state structure
+	 */
+	mstate = makeNode(MemoizeState);
+	mstate->ps.plan = (Plan *) node;
+	mstate->ps.state = estate;
+	mstate->mstatus = MEMO_END;
+
+	/*
+	 * Miscellaneous initialization
+	 *
+	 * The ExprContext is for evaluating the cache key against the outer
+	 * tuple; the temp context is for hashing and comparing keys.
+	 */
+	ExecAssignExprContext(estate, &mstate->ps);
+
+	mstate->tableContext =
+		AllocSetContextCreate(CurrentMemoryContext,
+							  "Memoize cache",
+							  ALLOCSET_DEFAULT_MINSIZE,
+							  ALLOCSET_DEFAULT_INITSIZE,
+							  ALLOCSET_DEFAULT_MAXSIZE);
+	mstate->tempContext =
+		AllocSetContextCreate(CurrentMemoryContext,
+							  "Memoize",
+							  ALLOCSET_DEFAULT_MINSIZE,
+							  ALLOCSET_DEFAULT_INITSIZE,
+							  ALLOCSET_DEFAULT_MAXSIZE);
+
+	/*
+	 * tuple table initialization
+	 */
+	ExecInitResultTupleSlot(estate, &mstate->ps);
+	mstate->probeslot = ExecInitExtraTupleSlot(estate);
+	mstate->evictslot = ExecInitExtraTupleSlot(estate);
+
+	/*
+	 * initialize child expressions
+	 */
+	mstate->paramExprs = (List *)
+		ExecInitExpr((Expr *) node->paramExprs, (PlanState *) mstate);
+
+	/*
+	 * initialize child nodes
+	 *
+	 * The subplan is rescanned with new parameters each time it is run, so
+	 * it needn't support REWIND.
+	 */
+	eflags &= ~EXEC_FLAG_REWIND;
+	outerPlanState(mstate) = ExecInitNode(outerPlan(node), estate, eflags);
+
+	/*
+	 * initialize tuple type.  no need to initialize projection info because
+	 * this node doesn't do projections.
+	 */
+	ExecAssignResultTypeFromTL(&mstate->ps);
+	mstate->ps.ps_ProjInfo = NULL;
+
+	keydesc = ExecTypeFromExprList(node->paramExprs);
+	ExecSetSlotDescriptor(mstate->probeslot, keydesc);
+	ExecSetSlotDescriptor(mstate->evictslot, keydesc);
+
+	/*
+	 * Set up the cache, which is keyed on all the columns of the key slots.
+	 * Keys with an equality operator are hashed and compared as in
+	 * execTuplesHashPrepare; the others are compared binary.
+	 */
+	mstate->keyColIdx = (AttrNumber *) palloc(node->numKeys * sizeof(AttrNumber));
+	mstate->eqfunctions = (FmgrInfo *) palloc(node->numKeys * sizeof(FmgrInfo));
+	mstate->hashfunctions = (FmgrInfo *) palloc(node->numKeys * sizeof(FmgrInfo));
+	i = 0;
+	foreach(l, node->paramExprs)
+	{
+		Oid			eq_opr = node->hashOperators[i];
+
+		mstate->keyColIdx[i] = i + 1;
+		if (OidIsValid(eq_opr))
+		{
+			Oid			left_hash_function;
+			Oid			right_hash_function;
+
+			if (!get_op_hash_functions(eq_opr, &left_hash_function,
+									   &right_hash_function))
+				elog(ERROR, "could not find hash function for hash operator %u",
+					 eq_opr);
+			fmgr_info(get_opcode(eq_opr), &mstate->eqfunctions[i]);
+			fmgr_info(right_hash_function, &mstate->hashfunctions[i]);
+		}
+		else
+		{
+			MemoizeKeyType *keytype;
+
+			keytype = (MemoizeKeyType *) palloc(sizeof(MemoizeKeyType));
+			get_typlenbyval(exprType((Node *) lfirst(l)),
+							&keytype->typlen, &keytype->typbyval);
+			memo_binary_fmgr_info(memo_binary_eq, 2, keytype,
+								  &mstate->eqfunctions[i]);
+			memo_binary_fmgr_info(memo_binary_hash, 1, keytype,
+								  &mstate->hashfunctions[i]);
+		}
+		i++;
+	}
+
+	mstate->lru = DLNewList();
+	mstate->memLimit = work_mem * 1024L;
+	memo_build_hashtable(mstate);
+
+	return mstate;
+}
+
+/* ----------------------------------------------------------------
+ *		ExecEndMemoize
+ * ----------------------------------------------------------------
+ */
+void
+ExecEndMemoize(MemoizeState *node)
+{
+	/*
+	 * Free the exprcontext
+	 */
+	ExecFreeExprContext(&node->ps);
+
+	/*
+	 * clean out the tuple table
+	 */
+	ExecClearTuple(node->ps.ps_ResultTupleSlot);
+	ExecClearTuple(node->probeslot);
+	ExecClearTuple(node->evictslot);
+
+	MemoryContextDelete(node->tableContext);
+	MemoryContextDelete(node->tempContext);
+
+	/*
+	 * shut down the subplan
+	 */
+	ExecEndNode(outerPlanState(node));
+}
+
+/* ----------------------------------------------------------------
+ *		ExecReScanMemoize
+ *
+ *		Sets up the scan for the outer tuple in exprCtxt: looks its cache
+ *		key up, and rescans the subplan if it isn't cached.
+ * ----------------------------------------------------------------
+ */
+void
+ExecReScanMemoize(MemoizeState *node, ExprContext *exprCtxt)
+{
+	PlanState  *outerPlan = outerPlanState(node);
+	ExprContext *econtext = node->ps.ps_ExprContext;
+	TupleTableSlot *probeslot = node->probeslot;
+	MemoizeEntry entry;
+	bool		isnew;
+	ListCell   *l;
+	int			i;
+
+	/* No cached row may stay in the result slot past an eviction */
+	ExecClearTuple(node->ps.ps_ResultTupleSlot);
+
+	/* Forget an entry that the last scan didn't read to the end */
+	if (node->mstatus == MEMO_FILLING && node->entry != NULL)
+		memo_remove_entry(node, node->entry);
+	node->entry = NULL;
+	node->nextTuple = NULL;
+
+	/* Rows cached under other parameter values are no good any more */
+	if (node->ps.chgParam != NULL)
+	{
+		MemoryContextReset(node->tableContext);
+		memo_build_hashtable(node);
+	}
+
+	/*
+	 * Without an outer tuple there's no key to look up.  The nestloop
+	 * always gives us one, so just let the subplan cope.
+	 */
+	if (exprCtxt == NULL)
+	{
+		node->mstatus = MEMO_BYPASS;
+		ExecReScan(outerPlan, NULL);
+		return;
+	}
+
+	/* Compute the cache key for this outer tuple */
+	econtext->ecxt_outertuple = exprCtxt->ecxt_outertuple;
+	ResetExprContext(econtext);
+	MemoryContextReset(node->tempContext);
+
+	ExecClearTuple(probeslot);
+	i = 0;
+	foreach(l, node->paramExprs)
+	{
+		ExprState  *keyexpr = (ExprState *) lfirst(l);
+
+		probeslot->tts_values[i] = ExecEvalExprSwitchContext(keyexpr,
+															 econtext,
+												  &probeslot->tts_isnull[i],
+															 NULL);
+		i++;
+	}
+	ExecStoreVirtualTuple(probeslot);
+
+	entry = (MemoizeEntry) LookupTupleHashEntry(node->hashtable, probeslot,
+												&isnew);
+	if (!isnew)
+	{
+		/* Hit: serve the rows from the cache */
+		node->hits++;
+		DLMoveToFront(&entry->lruElem);
+		node->nextTuple = list_head(entry->tuples);
+		node->mstatus = MEMO_CACHE_HIT;
+		return;
+	}
+
+	/* Miss: run the subplan, saving its rows in the new entry */
+	node->misses++;
+	DLInitElem(&entry->lruElem, entry);
+	DLAddHead(node->lru, &entry->lruElem);
+	entry->tuples = NIL;
+	entry->mem = sizeof(MemoizeEntryData) +
+		GetMemoryChunkSpace(entry->shared.firstTuple);
+	node->memUsed += entry->mem;
+	node->entry = entry;
+	node->mstatus = MEMO_FILLING;
+
+	if (!memo_make_room(node))
+	{
+		memo_remove_entry(node, entry);
+		node->overflows++;
+		node->mstatus = MEMO_BYPASS;
+	}
+
+	ExecReScan(outerPlan, exprCtxt);
+}
+
+/*
+ * Estimate the memory a cache entry holding 'ntuples' rows of 'width'
+ * bytes, for a key of 'keywidth' bytes, is charged with.  This is for the
+ * planner, and must match the charges made by ExecReScanMemoize and
+ * memo_cache_tuple.
+ */
+double
+memoize_entry_size(double ntuples, int width, int keywidth)
+{
+	double		keyspace;
+	double		tuplespace;
+
+	keyspace = memo_chunk_space(MAXALIGN(sizeof(MinimalTupleData)) +
+								MAXALIGN(keywidth));
+	tuplespace = memo_chunk_space(MAXALIGN(sizeof(MinimalTupleData)) +
+								  MAXALIGN(width));
+
+	return sizeof(MemoizeEntryData) + keyspace +
+		ntuples * (tuplespace + sizeof(ListCell));
+}
+
+/*
+ * Estimate what GetMemoryChunkSpace will say about a palloc'd chunk of
+ * 'size' bytes.  aset.c rounds requests up to a power of 2, except for
+ * ones beyond its chunk limit of 8kB, and puts a header in front.
+ */
+static double
+memo_chunk_space(double size)
+{
+	double		chunksize = 8;
+
+	if (size > 8192)
+		return MAXALIGN((Size) size) + STANDARDCHUNKHEADERSIZE;
+	while (chunksize < size)
+		chunksize *= 2;
+	return chunksize + STANDARDCHUNKHEADERSIZE;
+}
@@ -0,0 +1,363 @@
+/*-------------------------------------------------------------------------
+ *
+ * nodeMergeAppend.c
+ *	  routines to handle MergeAppend nodes.
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *	  $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+/* INTERFACE ROUTINES
+ *		ExecInitMergeAppend		- initialize the MergeAppend node
+ *		ExecMergeAppend			- retrieve the next tuple from the node
+ *		ExecEndMergeAppend		- shut down the MergeAppend node
+ *		ExecReScanMergeAppend	- rescan the MergeAppend node
+ *
+ *	 NOTES
+ *		A MergeAppend node contains a list of one or more subplans.
+ *		These are each expected to deliver tuples that are sorted according
+ *		to a common sort key.  The MergeAppend node merges these streams
+ *		to produce output sorted the same way.
+ *
+ *		MergeAppend nodes don't make use of their left and right
+ *		subtrees, rather they maintain a list of subplans so
+ *		a typical MergeAppend node looks like this in the plan tree:
+ *
+ *				   ...
+ *				   /
+ *				MergeAppend---+------+------+--- nil
+ *				/	\		  |		 |		|
+ *			  nil	nil		 ...	...    ...
+ *								 subplans
+ *
+ *		The merge keeps a binary heap of the subplans whose current tuple
+ *		hasn't been returned yet, ordered by that tuple, so each output
+ *		tuple costs O(log N) comparisons for N subplans.  Only one tuple
+ *		per subplan is held at a time, so a LIMIT above us means each
+ *		subplan is run for only as many tuples as it contributes.
+ */
+
+#include "postgres.h"
+
+#include "executor/execdebug.h"
+#include "executor/nodeMergeAppend.h"
+#include "utils/tuplesort.h"
+
+/*
+ * It gets quite confusing having a heap array (indexed by heap position)
+ * alongside a slot array (indexed by subplan number).  To keep things
+ * straight, we use these typedefs.
+ */
+typedef int SlotNumber;
+typedef int HeapPosition;
+
+static void heap_insert_slot(MergeAppendState *node, SlotNumber new_slot);
+static void heap_siftdown_slot(MergeAppendState *node, HeapPosition hole);
+static int	heap_compare_slots(MergeAppendState *node,
+				   SlotNumber slot1, SlotNumber slot2);
+
+
+/* ----------------------------------------------------------------
+ *		ExecInitMergeAppend
+ *
+ *		Begin all of the subscans of the MergeAppend node.
+ * ----------------------------------------------------------------
+ */
+MergeAppendState *
+ExecInitMergeAppend(MergeAppend *node, EState *estate, int eflags)
+{
+	MergeAppendState *mergestate = makeNode(MergeAppendState);
+	PlanState **mergeplanstates;
+	int			nplans;
+	int			i;
+	ListCell   *lc;
+
+	/* check for unsupported flags */
+	Assert(!(eflags & (EXEC_FLAG_BACKWARD | EXEC_FLAG_MARK)));
+
+	/*
+	 * Set up empty vector of subplan states
+	 */
+	nplans = list_length(node->mergeplans);
+
+	mergeplanstates = (PlanState **) palloc0(nplans * sizeof(PlanState *));
+
+	/*
+	 * create new MergeAppendState for our node
+	 */
+	mergestate->ps.plan = (Plan *) node;
+	mergestate->ps.state = estate;
+	mergestate->mergeplans = mergeplanstates;
+	mergestate->ms_nplans = nplans;
+
+	mergestate->ms_slots = (TupleTableSlot **) palloc0(sizeof(TupleTableSlot *) * nplans);
+	mergestate->ms_heap = (int *) palloc0(sizeof(int) * nplans);
+
+	/*
+	 * Miscellaneous initialization
+	 *
+	 * MergeAppend nodes do have Result slots, which hold pointers to tuples,
+	 * so we have to initialize them.
+	 */
+	ExecInitResultTupleSlot(estate, &mergestate->ps);
+
+	/*
+	 * call ExecInitNode on each of the plans to be executed and save the
+	 * results into the array "mergeplans".
+	 */
+	i = 0;
+	foreach(lc, node->mergeplans)
+	{
+		Plan	   *initNode = (Plan *) lfirst(lc);
+
+		mergeplanstates[i] = ExecInitNode(initNode, estate, eflags);
+		i++;
+	}
+
+	/*
+	 * initialize output tuple type
+	 */
+	ExecAssignResultTypeFromTL(&mergestate->ps);
+	mergestate->ps.ps_ProjInfo = NULL;
+
+	/*
+	 * initialize sort-key information
+	 */
+	mergestate->ms_nkeys = node->numCols;
+	mergestate->ms_sortfuncs = (FmgrInfo *) palloc(sizeof(FmgrInfo) * node->numCols);
+	mergestate->ms_sortflags = (int *) palloc(sizeof(int) * node->numCols);
+	for (i = 0; i < node->numCols; i++)
+	{
+		Oid			sortFunction;
+
+		SelectSortFunction(node->sortOperators[i],
+						   node->nullsFirst[i],
+						   &sortFunction,
+						   &mergestate->ms_sortflags[i]);
+		fmgr_info(sortFunction, &mergestate->ms_sortfuncs[i]);
+	}
+
+	/*
+	 * initialize to show we have not run the subplans yet
+	 */
+	mergestate->ms_heap_size = 0;
+	mergestate->ms_initialized = false;
+
+	return mergestate;
+}
+
+/* ----------------------------------------------------------------
+ *	   ExecMergeAppend
+ *
+ *		Handles iteration over multiple subplans.
+ * ----------------------------------------------------------------
+ */
+TupleTableSlot *
+ExecMergeAppend(MergeAppendState *node)
+{
+	TupleTableSlot *result;
+	SlotNumber	i;
+
+	if (!node->ms_initialized)
+	{
+		/*
+		 * First time through: pull the first tuple from each subplan, and set
+		 * up the heap.
+		 */
+		for (i = 0; i < node->ms_nplans; i++)
+		{
+			node->ms_slots[i] = ExecProcNode(node->mergeplans[i]);
+			if (!TupIsNull(node->ms_slots[i]))
+				heap_insert_slot(node, i);
+		}
+		node->ms_initialized = true;
+	}
+	else
+	{
+		/*
+		 * Otherwise, pull the next tuple from whichever subplan we returned
+		 * from last time, and insert it into the heap.  (We could simplify
+		 * the logic a bit by doing this before returning from the prior call,
+		 * but it's better to not pull tuples until necessary.)
+		 */
+		i = node->ms_heap[0];
+		node->ms_slots[i] = ExecProcNode(node->mergeplans[i]);
+		if (!TupIsNull(node->ms_slots[i]))
+		{
+			/* Replace the top entry, then restore heap order */
+			heap_siftdown_slot(node, 0);
+		}
+		else
+		{
+			/* Subplan exhausted; move the last entry up to the top */
+			if (--node->ms_heap_size > 0)
+			{
+				node->ms_heap[0] = node->ms_heap[node->ms_heap_size];
+				heap_siftdown_slot(node, 0);
+			}
+		}
+	}
+
+	if (node->ms_heap_size > 0)
+	{
+		/* Return the topmost heap node */
+		result = node->ms_slots[node->ms_heap[0]];
+	}
+	else
+	{
+		/* All the subplans are exhausted, and so is the heap */
+		result = ExecClearTuple(node->ps.ps_ResultTupleSlot);
+	}
+
+	return result;
+}
+
+/*
+ * Insert a new slot into the heap.  The slot must contain a valid tuple.
+ */
+static void
+heap_insert_slot(MergeAppendState *node, SlotNumber new_slot)
+{
+	SlotNumber *heap = node->ms_heap;
+	HeapPosition j;
+
+	Assert(!TupIsNull(node->ms_slots[new_slot]));
+
+	j = node->ms_heap_size++;	/* j is where the "hole" is */
+	while (j > 0)
+	{
+		int			i = (j - 1) / 2;
+
+		if (heap_compare_slots(node, new_slot, heap[i]) >= 0)
+			break;
+		heap[j] = heap[i];
+		j = i;
+	}
+	heap[j] = new_slot;
+}
+
+/*
+ * Sift the slot at heap position 'hole' down to where it belongs, so that
+ * the heap invariant holds again.  Used after the tuple at that position
+ * has been replaced.
+ */
+static void
+heap_siftdown_slot(MergeAppendState *node, HeapPosition hole)
+{
+	SlotNumber *heap = node->ms_heap;
+	SlotNumber	moving = heap[hole];
+	int			n = node->ms_heap_size;
+
+	for (;;)
+	{
+		int			j = 2 * hole + 1;
+
+		if (j >= n)
+			break;
+		if (j + 1 < n && heap_compare_slots(node, heap[j], heap[j + 1]) > 0)
+			j++;
+		if (heap_compare_slots(node, moving, heap[j]) <= 0)
+			break;
+		heap[hole] = heap[j];
+		hole = j;
+	}
+	heap[hole] = moving;
+}
+
+/*
+ * Compare the tuples in the two given slots.
+ */
+static int
+heap_compare_slots(MergeAppendState *node, SlotNumber slot1, SlotNumber slot2)
+{
+	MergeAppend *plannode = (MergeAppend *) node->ps.plan;
+	TupleTableSlot *s1 = node->ms_slots[slot1];
+	TupleTableSlot *s2 = node->ms_slots[slot2];
+	int			nkey;
+
+	Assert(!TupIsNull(s1));
+	Assert(!TupIsNull(s2));
+
+	for (nkey = 0; nkey < node->ms_nkeys; nkey++)
+	{
+		AttrNumber	attno = plannode->sortColIdx[nkey];
+		Datum		datum1,
+					datum2;
+		bool		isNull1,
+					isNull2;
+		int32		compare;
+
+		datum1 = slot_getattr(s1, attno, &isNull1);
+		datum2 = slot_getattr(s2, attno, &isNull2);
+
+		compare = ApplySortFunction(&node->ms_sortfuncs[nkey],
+									node->ms_sortflags[nkey],
+									datum1, isNull1,
+									datum2, isNull2);
+		if (compare != 0)
+			return compare;
+	}
+	return 0;
+}
+
+/* ----------------------------------------------------------------
+ *		ExecEndMergeAppend
+ *
+ *		Shuts down the subscans of the MergeAppend node.
+ *
+ *		Returns nothing of interest.
+ * ----------------------------------------------------------------
+ */
+void
+ExecEndMergeAppend(MergeAppendState *node)
+{
+	PlanState **mergeplans;
+	int			nplans;
+	int			i;
+
+	/*
+	 * get information from the node
+	 */
+	mergeplans = node->mergeplans;
+	nplans = node->ms_nplans;
+
+	/*
+	 * shut down each of the subscans
+	 */
+	for (i = 0; i < nplans; i++)
+		ExecEndNode(mergeplans[i]);
+}
+
+void
+ExecReScanMergeAppend(MergeAppendState *node, ExprContext *exprCtxt)
+{
+	int			i;
+
+	for (i = 0; i < node->ms_nplans; i++)
+	{
+		PlanState  *subnode = node->mergeplans[i];
+
+		/*
+		 * ExecReScan doesn't know about my subplans, so I have to do
+		 * changed-parameter signaling myself.
+		 */
+		if (node->ps.chgParam != NULL)
+			UpdateChangedParamSet(subnode, node->ps.chgParam);
+
+		/*
+		 * If chgParam of subnode is not null then plan will be re-scanned by
+		 * first ExecProcNode.	However, if caller is passing us an exprCtxt
+		 * then forcibly rescan all the subnodes now, so that we can pass the
+		 * exprCtxt down to the subnodes (needed for appendrel indexscan).
+		 */
+		if (subnode->chgParam == NULL || exprCtxt != NULL)
+			ExecReScan(subnode, exprCtxt);
+	}
+	node->ms_heap_size = 0;
+	node->ms_initialized = false;
+}
@@ -39,6 +39,7 @@
 
 #include "access/xact.h"
 #include "commands/trigger.h"
+#include "executor/execPartition.h"
 #include "executor/executor.h"
 #include "executor/nodeModifyTable.h"
 #include "miscadmin.h"
@@ -164,6 +165,7 @@ ExecInsert(TupleTableSlot *slot,
 {
 	HeapTuple	tuple;
 	ResultRelInfo *resultRelInfo;
+	ResultRelInfo *saved_resultRelInfo = NULL;
 	Relation	resultRelationDesc;
 	Oid			newId;
 	List	   *recheckIndexes = NIL;
@@ -225,6 +227,25 @@ ExecInsert(TupleTableSlot *slot,
 		}
 	}
 
+	/*
+	 * If the target is partitioned, the row goes into one of its partitions
+	 * instead; from here on, the partition is the result relation.
+	 */
+	if (resultRelInfo->ri_PartitionDispatch)
+	{
+		ResultRelInfo *partRelInfo;
+
+		partRelInfo = ExecRouteTuple(resultRelInfo, &slot, &tuple,
+									 estate, NULL);
+		if (partRelInfo == NULL)	/* "do nothing" */
+			return NULL;
+
+		saved_resultRelInfo = resultRelInfo;
+		resultRelInfo = partRelInfo;
+		resultRelationDesc = resultRelInfo->ri_RelationDesc;
+		estate->es_result_relation_info = resultRelInfo;
+	}
+
 	/*
 	 * Check the constraints of the tuple
 	 */
@@ -256,6 +277,20 @@ ExecInsert(TupleTableSlot *slot,
 
 	list_free(recheckIndexes);
 
+	/*
+	 * If the row was routed to a partition, RETURNING is still computed by
+	 * the target table's projection, so it needs the stored row converted
+	 * back to the target's rowtype.
+	 */
+	if (saved_resultRelInfo)
+	{
+		estate->es_result_relation_info = saved_resultRelInfo;
+		resultRelInfo = saved_resultRelInfo;
+		if (resultRelInfo->ri_projectReturning)
+			slot = ExecRoutedTupleToParent(resultRelInfo, slot, tuple,
+										   estate);
+	}
+
 	/* Process RETURNING if present */
 	if (resultRelInfo->ri_projectReturning)
 		return ExecProcessReturning(resultRelInfo->ri_projectReturning,
@@ -832,6 +867,15 @@ ExecInitModifyTable(ModifyTable *node, EState *estate, int eflags)
 	}
 	estate->es_result_relation_info = NULL;
 
+	/*
+	 * An INSERT into a partitioned table must route each row to one of its
+	 * partitions.
+	 */
+	resultRelInfo = estate->es_result_relations;
+	if (operation == CMD_INSERT &&
+		RelationGetPartitionKey(resultRelInfo->ri_RelationDesc) != NULL)
+		ExecSetupPartitionRouting(resultRelInfo, estate, false);
+
 	/* select first subplan */
 	mtstate->mt_whichplan = 0;
 	subplan = (Plan *) linitial(node->plans);
@@ -1042,6 +1086,12 @@ ExecEndModifyTable(ModifyTableState *node)
 	 */
 	for (i = 0; i < node->mt_nplans; i++)
 		ExecEndNode(node->mt_plans[i]);
+
+	/*
+	 * close any partitions that inserted rows were routed to
+	 */
+	if (node->operation == CMD_INSERT)
+		ExecCleanupPartitionRouting(node->ps.state->es_result_relations);
 }
 
 void
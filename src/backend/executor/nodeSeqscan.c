@@ -25,12 +25,23 @@
 #include "postgres.h"
 
 #include "access/heapam.h"
+#include "access/nbtree.h"
 #include "access/relscan.h"
+#include "catalog/pg_am.h"
+#include "catalog/pg_type.h"
+#include "commands/defrem.h"
 #include "executor/execdebug.h"
 #include "executor/nodeSeqscan.h"
+#include "utils/lsyscache.h"
+#include "utils/memutils.h"
 
 static void InitScanRelation(SeqScanState *node, EState *estate);
 static TupleTableSlot *SeqNext(SeqScanState *node);
+static List *SeqExtractBatchQuals(SeqScanState *node, List *quals);
+static bool SeqMakeBatchQual(SeqScanState *node, Expr *clause,
+				 SeqScanBatchQual *bq);
+static int	SeqPageFilter(HeapScanDesc scan, Page page, int ntuples,
+			  void *arg);
 
 /* ----------------------------------------------------------------
  *						Scan Support
@@ -55,10 +66,10 @@ SeqNext(SeqScanState *node)
 	/*
 	 * get information from the estate and scan state
 	 */
-	scandesc = node->ss_currentScanDesc;
-	estate = node->ps.state;
+	scandesc = node->ss.ss_currentScanDesc;
+	estate = node->ss.ps.state;
 	direction = estate->es_direction;
-	slot = node->ss_ScanTupleSlot;
+	slot = node->ss.ss_ScanTupleSlot;
 
 	/*
 	 * get the next tuple from the table
@@ -91,11 +102,104 @@ SeqNext(SeqScanState *node)
 static bool
 SeqRecheck(SeqScanState *node, TupleTableSlot *slot)
 {
+	ExprContext *econtext;
+
 	/*
 	 * Note that unlike IndexScan, SeqScan never use keys in heap_beginscan
 	 * (and this is very bad) - so, here we do not check are keys ok or not.
+	 * But quals we have turned into a page filter must be checked, since
+	 * the test tuple never went through the filter.
 	 */
-	return true;
+	if (node->ss_BatchQualOrig == NIL)
+		return true;
+
+	econtext = node->ss.ps.ps_ExprContext;
+	econtext->ecxt_scantuple = slot;
+
+	ResetExprContext(econtext);
+
+	return ExecQual(node->ss_BatchQualOrig, econtext, false);
+}
+
+/* ----------------------------------------------------------------
+ *		SeqPageFilter
+ *
+ *		Heap page filter that applies the node's batch quals to all the
+ *		visible tuples of a page at once.  Each qual makes one pass over
+ *		the surviving tuples, so the inner loop is just an attribute fetch
+ *		and an integer comparison, with no per-tuple trip through
+ *		ExecProcNode and ExecQual for tuples that fail.
+ * ----------------------------------------------------------------
+ */
+static int
+SeqPageFilter(HeapScanDesc scan, Page page, int ntuples, void *arg)
+{
+	SeqScanState *node = (SeqScanState *) arg;
+	TupleDesc	tupdesc = RelationGetDescr(scan->rs_rd);
+	OffsetNumber *vistuples = scan->rs_vistuples;
+	int			q;
+
+	for (q = 0; q < node->ss_NumBatchQuals && ntuples > 0; q++)
+	{
+		SeqScanBatchQual *bq = &node->ss_BatchQuals[q];
+		int			nkept = 0;
+		int			i;
+
+		for (i = 0; i < ntuples; i++)
+		{
+			OffsetNumber lineoff = vistuples[i];
+			ItemId		lpp = PageGetItemId(page, lineoff);
+			HeapTupleHeader tup = (HeapTupleHeader) PageGetItem(page, lpp);
+			Datum		d;
+			int64		v;
+			int			cmp;
+
+			if (bq->attoff >= 0 &&
+				!(tup->t_infomask & HEAP_HASNULL) &&
+				HeapTupleHeaderGetNatts(tup) >= bq->attno)
+			{
+				/* fast path: the column is at a known offset */
+				d = fetch_att((char *) tup + tup->t_hoff + bq->attoff,
+							  bq->attbyval, bq->attlen);
+			}
+			else
+			{
+				HeapTupleData loctup;
+				bool		isnull;
+
+				loctup.t_data = tup;
+				loctup.t_len = ItemIdGetLength(lpp);
+				d = heap_getattr(&loctup, bq->attno, tupdesc, &isnull);
+				/* all the operators we accept are strict */
+				if (isnull)
+					continue;
+			}
+
+			switch (bq->typid)
+			{
+				case INT2OID:
+					v = DatumGetInt16(d);
+					break;
+				case INT4OID:
+				case DATEOID:
+					v = DatumGetInt32(d);
+					break;
+				case OIDOID:
+					v = DatumGetObjectId(d);
+					break;
+				default:
+					v = DatumGetInt64(d);
+					break;
+			}
+
+			cmp = (v > bq->value) - (v < bq->value);
+			if (bq->cmpmask & (1 << (cmp + 1)))
+				vistuples[nkept++] = lineoff;
+		}
+		ntuples = nkept;
+	}
+
+	return ntuples;
 }
 
 /* ----------------------------------------------------------------
@@ -133,17 +237,206 @@ InitScanRelation(SeqScanState *node, EState *estate)
 	 * open that relation and acquire appropriate lock on it.
 	 */
 	currentRelation = ExecOpenScanRelation(estate,
-									 ((SeqScan *) node->ps.plan)->scanrelid);
+									 ((SeqScan *) node->ss.ps.plan)->scanrelid);
 
 	currentScanDesc = heap_beginscan(currentRelation,
 									 estate->es_snapshot,
 									 0,
 									 NULL);
 
-	node->ss_currentRelation = currentRelation;
-	node->ss_currentScanDesc = currentScanDesc;
+	node->ss.ss_currentRelation = currentRelation;
+	node->ss.ss_currentScanDesc = currentScanDesc;
 
-	ExecAssignScanType(node, RelationGetDescr(currentRelation));
+	ExecAssignScanType(&node->ss, RelationGetDescr(currentRelation));
+}
+
+/* ----------------------------------------------------------------
+ *		SeqExtractBatchQuals
+ *
+ *		Separate out of the given implicitly-ANDed qual list the clauses
+ *		that SeqPageFilter can evaluate, filling in node->ss_BatchQuals.
+ *		Returns the list of remaining clauses, which must still be
+ *		evaluated per tuple.
+ * ----------------------------------------------------------------
+ */
+static List *
+SeqExtractBatchQuals(SeqScanState *node, List *quals)
+{
+	List	   *remaining = NIL;
+	List	   *batched = NIL;
+	ListCell   *l;
+
+	node->ss_BatchQuals = (SeqScanBatchQual *)
+		palloc(list_length(quals) * sizeof(SeqScanBatchQual));
+	node->ss_NumBatchQuals = 0;
+
+	foreach(l, quals)
+	{
+		Expr	   *clause = (Expr *) lfirst(l);
+
+		if (SeqMakeBatchQual(node, clause,
+							 &node->ss_BatchQuals[node->ss_NumBatchQuals]))
+		{
+			node->ss_NumBatchQuals++;
+			batched = lappend(batched, clause);
+		}
+		else
+			remaining = lappend(remaining, clause);
+	}
+
+	node->ss_BatchQualOrig = (List *)
+		ExecInitExpr((Expr *) batched, (PlanState *) node);
+
+	return remaining;
+}
+
+/*
+ * SeqMakeBatchQual
+ *
+ * Fill *bq and return true if clause is of the form "Var op Const" or
+ * "Const op Var", where the Var is a plain column of the scanned relation
+ * of one of the integer-like types whose default btree ordering matches
+ * integer ordering of the stored values, and op is a member of that btree
+ * opclass other than <>.
+ */
+static bool
+SeqMakeBatchQual(SeqScanState *node, Expr *clause, SeqScanBatchQual *bq)
+{
+	Index		scanrelid = ((Scan *) node->ss.ps.plan)->scanrelid;
+	TupleDesc	tupdesc = RelationGetDescr(node->ss.ss_currentRelation);
+	OpExpr	   *op;
+	Node	   *leftop;
+	Node	   *rightop;
+	Var		   *var;
+	Const	   *con;
+	bool		commuted;
+	Oid			opfamily;
+	Oid			lefttype;
+	Oid			righttype;
+	int			strategy;
+	int			off;
+	int			i;
+
+	if (!IsA(clause, OpExpr))
+		return false;
+	op = (OpExpr *) clause;
+	if (list_length(op->args) != 2)
+		return false;
+	leftop = (Node *) linitial(op->args);
+	rightop = (Node *) lsecond(op->args);
+
+	if (IsA(leftop, Var) && IsA(rightop, Const))
+	{
+		var = (Var *) leftop;
+		con = (Const *) rightop;
+		commuted = false;
+	}
+	else if (IsA(leftop, Const) && IsA(rightop, Var))
+	{
+		var = (Var *) rightop;
+		con = (Const *) leftop;
+		commuted = true;
+	}
+	else
+		return false;
+
+	if (var->varno != scanrelid || var->varlevelsup != 0 ||
+		var->varattno <= 0 || var->varattno > tupdesc->natts)
+		return false;
+	if (con->constisnull || con->consttype != var->vartype)
+		return false;
+
+	switch (var->vartype)
+	{
+		case INT2OID:
+		case INT4OID:
+		case INT8OID:
+		case DATEOID:
+		case OIDOID:
+			break;
+#ifdef HAVE_INT64_TIMESTAMP
+		case TIMESTAMPOID:
+		case TIMESTAMPTZOID:
+			break;
+#endif
+		default:
+			return false;
+	}
+
+	/* The operator must be one of the type's own btree comparisons */
+	opfamily = get_opclass_family(GetDefaultOpClass(var->vartype,
+													BTREE_AM_OID));
+	if (!op_in_opfamily(op->opno, opfamily))
+		return false;
+	get_op_opfamily_properties(op->opno, opfamily,
+							   &strategy, &lefttype, &righttype);
+	if (lefttype != var->vartype || righttype != var->vartype)
+		return false;
+
+	switch (strategy)
+	{
+		case BTLessStrategyNumber:
+			bq->cmpmask = commuted ? 4 : 1;
+			break;
+		case BTLessEqualStrategyNumber:
+			bq->cmpmask = commuted ? 6 : 3;
+			break;
+		case BTEqualStrategyNumber:
+			bq->cmpmask = 2;
+			break;
+		case BTGreaterEqualStrategyNumber:
+			bq->cmpmask = commuted ? 3 : 6;
+			break;
+		case BTGreaterStrategyNumber:
+			bq->cmpmask = commuted ? 1 : 4;
+			break;
+		default:
+			return false;
+	}
+
+	bq->attno = var->varattno;
+	bq->typid = var->vartype;
+	bq->attlen = tupdesc->attrs[var->varattno - 1]->attlen;
+	bq->attbyval = tupdesc->attrs[var->varattno - 1]->attbyval;
+
+	switch (var->vartype)
+	{
+		case INT2OID:
+			bq->value = DatumGetInt16(con->constvalue);
+			break;
+		case INT4OID:
+		case DATEOID:
+			bq->value = DatumGetInt32(con->constvalue);
+			break;
+		case OIDOID:
+			bq->value = DatumGetObjectId(con->constvalue);
+			break;
+		default:
+			bq->value = DatumGetInt64(con->constvalue);
+			break;
+	}
+
+	/*
+	 * Work out the column's offset in tuples without nulls, the same way
+	 * nocachegetattr would, provided no varlena column precedes it.
+	 */
+	off = 0;
+	for (i = 0; i < var->varattno; i++)
+	{
+		Form_pg_attribute att = tupdesc->attrs[i];
+
+		if (att->attlen <= 0)
+		{
+			off = -1;
+			break;
+		}
+		off = att_align_nominal(off, att->attalign);
+		if (i < var->varattno - 1)
+			off += att->attlen;
+	}
+	bq->attoff = off;
+
+	return true;
 }
 
 
@@ -155,6 +448,7 @@ SeqScanState *
 ExecInitSeqScan(SeqScan *node, EState *estate, int eflags)
 {
 	SeqScanState *scanstate;
+	List	   *qual;
 
 	/*
 	 * Once upon a time it was possible to have an outerPlan of a SeqScan, but
@@ -167,44 +461,67 @@ ExecInitSeqScan(SeqScan *node, EState *estate, int eflags)
 	 * create state structure
 	 */
 	scanstate = makeNode(SeqScanState);
-	scanstate->ps.plan = (Plan *) node;
-	scanstate->ps.state = estate;
+	scanstate->ss.ps.plan = (Plan *) node;
+	scanstate->ss.ps.state = estate;
 
 	/*
 	 * Miscellaneous initialization
 	 *
 	 * create expression context for node
 	 */
-	ExecAssignExprContext(estate, &scanstate->ps);
+	ExecAssignExprContext(estate, &scanstate->ss.ps);
 
 	/*
 	 * initialize child expressions
 	 */
-	scanstate->ps.targetlist = (List *)
+	scanstate->ss.ps.targetlist = (List *)
 		ExecInitExpr((Expr *) node->plan.targetlist,
 					 (PlanState *) scanstate);
-	scanstate->ps.qual = (List *)
-		ExecInitExpr((Expr *) node->plan.qual,
-					 (PlanState *) scanstate);
 
 	/*
 	 * tuple table initialization
 	 */
-	ExecInitResultTupleSlot(estate, &scanstate->ps);
-	ExecInitScanTupleSlot(estate, scanstate);
+	ExecInitResultTupleSlot(estate, &scanstate->ss.ps);
+	ExecInitScanTupleSlot(estate, &scanstate->ss);
 
 	/*
 	 * initialize scan relation
 	 */
 	InitScanRelation(scanstate, estate);
 
-	scanstate->ps.ps_TupFromTlist = false;
+	/*
+	 * Quals simple enough to be checked a page at a time are handed to the
+	 * heap scan as a page filter, so that non-matching tuples never leave
+	 * heapam.  If the scan can't take a filter, they go back to being
+	 * ordinary quals.
+	 */
+	qual = node->plan.qual;
+	scanstate->ss_BatchQuals = NULL;
+	scanstate->ss_NumBatchQuals = 0;
+	scanstate->ss_BatchQualOrig = NIL;
+	if (qual != NIL)
+	{
+		qual = SeqExtractBatchQuals(scanstate, qual);
+		if (scanstate->ss_NumBatchQuals > 0 &&
+			!heap_setpagefilter(scanstate->ss.ss_currentScanDesc,
+								SeqPageFilter, scanstate))
+		{
+			scanstate->ss_NumBatchQuals = 0;
+			scanstate->ss_BatchQualOrig = NIL;
+			qual = node->plan.qual;
+		}
+	}
+	scanstate->ss.ps.qual = (List *)
+		ExecInitExpr((Expr *) qual,
+					 (PlanState *) scanstate);
+
+	scanstate->ss.ps.ps_TupFromTlist = false;
 
 	/*
 	 * Initialize result tuple type and projection info.
 	 */
-	ExecAssignResultTypeFromTL(&scanstate->ps);
-	ExecAssignScanProjectionInfo(scanstate);
+	ExecAssignResultTypeFromTL(&scanstate->ss.ps);
+	ExecAssignScanProjectionInfo(&scanstate->ss);
 
 	return scanstate;
 }
@@ -224,19 +541,19 @@ ExecEndSeqScan(SeqScanState *node)
 	/*
 	 * get information from node
 	 */
-	relation = node->ss_currentRelation;
-	scanDesc = node->ss_currentScanDesc;
+	relation = node->ss.ss_currentRelation;
+	scanDesc = node->ss.ss_currentScanDesc;
 
 	/*
 	 * Free the exprcontext
 	 */
-	ExecFreeExprContext(&node->ps);
+	ExecFreeExprContext(&node->ss.ps);
 
 	/*
 	 * clean out the tuple table
 	 */
-	ExecClearTuple(node->ps.ps_ResultTupleSlot);
-	ExecClearTuple(node->ss_ScanTupleSlot);
+	ExecClearTuple(node->ss.ps.ps_ResultTupleSlot);
+	ExecClearTuple(node->ss.ss_ScanTupleSlot);
 
 	/*
 	 * close heap scan
@@ -265,7 +582,7 @@ ExecSeqReScan(SeqScanState *node, ExprContext *exprCtxt)
 {
 	HeapScanDesc scan;
 
-	scan = node->ss_currentScanDesc;
+	scan = node->ss.ss_currentScanDesc;
 
 	heap_rescan(scan,			/* scan desc */
 				NULL);			/* new scan keys */
@@ -282,7 +599,7 @@ ExecSeqReScan(SeqScanState *node, ExprContext *exprCtxt)
 void
 ExecSeqMarkPos(SeqScanState *node)
 {
-	HeapScanDesc scan = node->ss_currentScanDesc;
+	HeapScanDesc scan = node->ss.ss_currentScanDesc;
 
 	heap_markpos(scan);
 }
@@ -296,7 +613,7 @@ ExecSeqMarkPos(SeqScanState *node)
 void
 ExecSeqRestrPos(SeqScanState *node)
 {
-	HeapScanDesc scan = node->ss_currentScanDesc;
+	HeapScanDesc scan = node->ss.ss_currentScanDesc;
 
 	/*
 	 * Clear any reference to the previously returned tuple.  This is needed
@@ -304,7 +621,7 @@ ExecSeqRestrPos(SeqScanState *node)
 	 * heap_restrpos will change; we'd have an internally inconsistent slot if
 	 * we didn't do this.
 	 */
-	ExecClearTuple(node->ss_ScanTupleSlot);
+	ExecClearTuple(node->ss.ss_ScanTupleSlot);
 
 	heap_restrpos(scan);
 }
@@ -99,8 +99,12 @@ typedef struct WindowStatePerFuncData
  */
 typedef struct WindowStatePerAggData
 {
-	/* Oids of transfer functions */
+	/*
+	 * Oids of transfer functions.  These are the aggregate's moving-aggregate
+	 * functions if we're using those, in which case invtransfn_oid is valid.
+	 */
 	Oid			transfn_oid;
+	Oid			invtransfn_oid; /* may be InvalidOid */
 	Oid			finalfn_oid;	/* may be InvalidOid */
 
 	/*
@@ -109,6 +113,7 @@ typedef struct WindowStatePerAggData
 	 * flags are kept here.
 	 */
 	FmgrInfo	transfn;
+	FmgrInfo	invtransfn;
 	FmgrInfo	finalfn;
 
 	/*
@@ -141,6 +146,8 @@ typedef struct WindowStatePerAggData
 	bool		transValueIsNull;
 
 	bool		noTransValue;	/* true if transValue not set yet */
+
+	int64		transValueCount;	/* number of rows in transValue */
 } WindowStatePerAggData;
 
 static void initialize_windowaggregate(WindowAggState *winstate,
@@ -149,6 +156,9 @@ static void initialize_windowaggregate(WindowAggState *winstate,
 static void advance_windowaggregate(WindowAggState *winstate,
 						WindowStatePerFunc perfuncstate,
 						WindowStatePerAgg peraggstate);
+static bool retreat_windowaggregate(WindowAggState *winstate,
+						WindowStatePerFunc perfuncstate,
+						WindowStatePerAgg peraggstate);
 static void finalize_windowaggregate(WindowAggState *winstate,
 						 WindowStatePerFunc perfuncstate,
 						 WindowStatePerAgg peraggstate,
@@ -202,6 +212,7 @@ initialize_windowaggregate(WindowAggState *winstate,
 	}
 	peraggstate->transValueIsNull = peraggstate->initValueIsNull;
 	peraggstate->noTransValue = peraggstate->initValueIsNull;
+	peraggstate->transValueCount = 0;
 	peraggstate->resultValueIsNull = true;
 }
 
@@ -251,6 +262,7 @@ advance_windowaggregate(WindowAggState *winstate,
 				return;
 			}
 		}
+		peraggstate->transValueCount++;
 		if (peraggstate->noTransValue)
 		{
 			/*
@@ -284,6 +296,9 @@ advance_windowaggregate(WindowAggState *winstate,
 		}
 	}
 
+	else
+		peraggstate->transValueCount++;
+
 	/*
 	 * OK to call the transition function
 	 */
@@ -318,6 +333,129 @@ advance_windowaggregate(WindowAggState *winstate,
 	peraggstate->transValueIsNull = fcinfo->isnull;
 }
 
+/*
+ * retreat_windowaggregate
+ * remove the current row from the transition value, using the aggregate's
+ * inverse transition function
+ *
+ * Returns false if that's not possible, because the inverse transition
+ * function returned NULL; the caller must then aggregate the frame afresh.
+ */
+static bool
+retreat_windowaggregate(WindowAggState *winstate,
+						WindowStatePerFunc perfuncstate,
+						WindowStatePerAgg peraggstate)
+{
+	WindowFuncExprState *wfuncstate = perfuncstate->wfuncstate;
+	int			numArguments = perfuncstate->numArguments;
+	FunctionCallInfoData fcinfodata;
+	FunctionCallInfo fcinfo = &fcinfodata;
+	Datum		newVal;
+	ListCell   *arg;
+	int			i;
+	MemoryContext oldContext;
+	ExprContext *econtext = winstate->tmpcontext;
+
+	oldContext = MemoryContextSwitchTo(econtext->ecxt_per_tuple_memory);
+
+	/* We start from 1, since the 0th arg will be the transition value */
+	i = 1;
+	foreach(arg, wfuncstate->args)
+	{
+		ExprState  *argstate = (ExprState *) lfirst(arg);
+
+		fcinfo->arg[i] = ExecEvalExpr(argstate, econtext,
+									  &fcinfo->argnull[i], NULL);
+		i++;
+	}
+
+	if (peraggstate->invtransfn.fn_strict)
+	{
+		/*
+		 * A row with a NULL input was skipped by the strict transfn, so
+		 * there's nothing to remove.
+		 */
+		for (i = 1; i <= numArguments; i++)
+		{
+			if (fcinfo->argnull[i])
+			{
+				MemoryContextSwitchTo(oldContext);
+				return true;
+			}
+		}
+	}
+
+	Assert(peraggstate->transValueCount > 0);
+
+	/*
+	 * If this is the last row in the transition value, just go back to the
+	 * initial value.  That's not only cheaper: when the initial value is
+	 * NULL, no call of the inverse transition function could get us there.
+	 */
+	if (peraggstate->transValueCount == 1)
+	{
+		MemoryContextSwitchTo(winstate->aggcontext);
+		if (!peraggstate->transtypeByVal && !peraggstate->transValueIsNull)
+			pfree(DatumGetPointer(peraggstate->transValue));
+		if (peraggstate->initValueIsNull)
+			peraggstate->transValue = peraggstate->initValue;
+		else
+			peraggstate->transValue = datumCopy(peraggstate->initValue,
+												peraggstate->transtypeByVal,
+												peraggstate->transtypeLen);
+		peraggstate->transValueIsNull = peraggstate->initValueIsNull;
+		peraggstate->noTransValue = peraggstate->initValueIsNull;
+		peraggstate->transValueCount = 0;
+		MemoryContextSwitchTo(oldContext);
+		return true;
+	}
+
+	/*
+	 * A strict transfn that returned NULL leaves nothing to remove from;
+	 * see advance_windowaggregate.
+	 */
+	if (peraggstate->invtransfn.fn_strict && peraggstate->transValueIsNull)
+	{
+		MemoryContextSwitchTo(oldContext);
+		return false;
+	}
+
+	/*
+	 * OK to call the inverse transition function
+	 */
+	InitFunctionCallInfoData(*fcinfo, &(peraggstate->invtransfn),
+							 numArguments + 1,
+							 (void *) winstate, NULL);
+	fcinfo->arg[0] = peraggstate->transValue;
+	fcinfo->argnull[0] = peraggstate->transValueIsNull;
+	newVal = FunctionCallInvoke(fcinfo);
+
+	if (fcinfo->isnull)
+	{
+		MemoryContextSwitchTo(oldContext);
+		return false;
+	}
+
+	/* Same as in advance_windowaggregate */
+	if (!peraggstate->transtypeByVal &&
+		DatumGetPointer(newVal) != DatumGetPointer(peraggstate->transValue))
+	{
+		MemoryContextSwitchTo(winstate->aggcontext);
+		newVal = datumCopy(newVal,
+						   peraggstate->transtypeByVal,
+						   peraggstate->transtypeLen);
+		if (!peraggstate->transValueIsNull)
+			pfree(DatumGetPointer(peraggstate->transValue));
+	}
+
+	MemoryContextSwitchTo(oldContext);
+	peraggstate->transValue = newVal;
+	peraggstate->transValueIsNull = false;
+	peraggstate->transValueCount--;
+
+	return true;
+}
+
 /*
  * finalize_windowaggregate
  * parallel to finalize_aggregate in nodeAgg.c
@@ -393,6 +531,7 @@ eval_windowaggregates(WindowAggState *winstate)
 	ExprContext *econtext;
 	WindowObject agg_winobj;
 	TupleTableSlot *agg_row_slot;
+	bool		headmoved;
 
 	numaggs = winstate->numaggs;
 	if (numaggs == 0)
@@ -419,8 +558,12 @@ eval_windowaggregates(WindowAggState *winstate)
 	 * damage the running transition value, but we have the same assumption in
 	 * nodeAgg.c too (when it rescans an existing hash table).
 	 *
-	 * For other frame start rules, we discard the aggregate state and re-run
-	 * the aggregates whenever the frame head row moves.  We can still
+	 * For other frame start rules, rows also leave the frame as the frame
+	 * head moves.  If every aggregate has an inverse transition function
+	 * (see initialize_peragg), we run that for each row that left the frame
+	 * and carry on from there.  Otherwise, or if an inverse transition
+	 * function declines to remove a row, we discard the aggregate state and
+	 * re-run the aggregates whenever the frame head row moves.  We can still
 	 * optimize as above whenever successive rows share the same frame head.
 	 *
 	 * In many common cases, multiple rows share the same frame and hence the
@@ -430,25 +573,78 @@ eval_windowaggregates(WindowAggState *winstate)
 	 * aggregate value once when we reach the first row of a peer group, and
 	 * then returning the saved value for all subsequent rows.
 	 *
-	 * 'aggregatedupto' keeps track of the first row that has not yet been
-	 * accumulated into the aggregate transition values.  Whenever we start a
-	 * new peer group, we accumulate forward to the end of the peer group.
-	 *
-	 * TODO: Rerunning aggregates from the frame start can be pretty slow. For
-	 * some aggregates like SUM and COUNT we could avoid that by implementing
-	 * a "negative transition function" that would be called for each row as
-	 * it exits the frame.	We'd have to think about avoiding recalculation of
-	 * volatile arguments of aggregate functions, too.
+	 * 'aggregatedbase' and 'aggregatedupto' keep track of the first row that
+	 * has been, and the first row that has not yet been, accumulated into the
+	 * aggregate transition values.  Whenever we start a new peer group, we
+	 * accumulate forward to the end of the peer group.
 	 */
 
 	/*
 	 * First, update the frame head position.
 	 */
 	update_frameheadpos(agg_winobj, winstate->temp_slot_1);
+	headmoved = (winstate->frameheadpos != winstate->aggregatedbase);
+
+	/*
+	 * If the frame head moved but the new frame still overlaps the rows
+	 * we've aggregated, try to remove the rows that left the frame.
+	 */
+	if (winstate->currentpos != 0 && headmoved &&
+		winstate->frameheadpos < winstate->aggregatedupto)
+	{
+		bool		removed = true;
+
+		for (i = 0; i < numaggs; i++)
+		{
+			if (!OidIsValid(winstate->peragg[i].invtransfn_oid))
+			{
+				removed = false;
+				break;
+			}
+		}
+
+		/* The loop below expects agg_row_slot to be empty or at aggregatedupto */
+		ExecClearTuple(agg_row_slot);
+
+		while (removed && winstate->aggregatedbase < winstate->frameheadpos)
+		{
+			if (!window_gettupleslot(agg_winobj, winstate->aggregatedbase,
+									 agg_row_slot))
+				elog(ERROR, "could not re-fetch previously fetched frame row");
+
+			/* Set tuple context for evaluation of aggregate arguments */
+			winstate->tmpcontext->ecxt_outertuple = agg_row_slot;
+
+			for (i = 0; i < numaggs; i++)
+			{
+				peraggstate = &winstate->peragg[i];
+				wfuncno = peraggstate->wfuncno;
+				if (!retreat_windowaggregate(winstate,
+											 &winstate->perfunc[wfuncno],
+											 peraggstate))
+				{
+					removed = false;
+					break;
+				}
+			}
+
+			/* Reset per-input-tuple context after each tuple */
+			ResetExprContext(winstate->tmpcontext);
+			ExecClearTuple(agg_row_slot);
+
+			if (removed)
+				winstate->aggregatedbase++;
+		}
+
+		/* If successful, keep the mark pointer pushed up to the frame head */
+		if (removed)
+			WinSetMarkPosition(agg_winobj, winstate->frameheadpos);
+	}
 
 	/*
 	 * Initialize aggregates on first call for partition, or if the frame head
-	 * position moved since last time.
+	 * position moved since last time and we couldn't just remove the rows
+	 * that left the frame.
 	 */
 	if (winstate->currentpos == 0 ||
 		winstate->frameheadpos != winstate->aggregatedbase)
@@ -491,6 +687,7 @@ eval_windowaggregates(WindowAggState *winstate)
 	 */
 	if ((winstate->frameOptions & (FRAMEOPTION_END_UNBOUNDED_FOLLOWING |
 								   FRAMEOPTION_END_CURRENT_ROW)) &&
+		!headmoved &&
 		winstate->aggregatedbase <= winstate->currentpos &&
 		winstate->aggregatedupto > winstate->currentpos)
 	{
@@ -1496,6 +1693,9 @@ ExecInitWindowAgg(WindowAgg *node, EState *estate, int eflags)
 		winstate->ordEqfunctions = execTuplesMatchPrepare(node->ordNumCols,
 														  node->ordOperators);
 
+	/* copy frame options to state node for easy access */
+	winstate->frameOptions = node->frameOptions;
+
 	/*
 	 * WindowAgg nodes use aggvalues and aggnulls as well as Agg nodes.
 	 */
@@ -1609,9 +1809,6 @@ ExecInitWindowAgg(WindowAgg *node, EState *estate, int eflags)
 		winstate->agg_winobj = agg_winobj;
 	}
 
-	/* copy frame options to state node for easy access */
-	winstate->frameOptions = node->frameOptions;
-
 	/* initialize frame bound offset expressions */
 	winstate->startOffset = ExecInitExpr((Expr *) node->startOffset,
 										 (PlanState *) winstate);
@@ -1711,10 +1908,12 @@ initialize_peragg(WindowAggState *winstate, WindowFunc *wfunc,
 	Oid			aggtranstype;
 	AclResult	aclresult;
 	Oid			transfn_oid,
+				invtransfn_oid,
 				finalfn_oid;
 	Expr	   *transfnexpr,
 			   *finalfnexpr;
 	Datum		textInitVal;
+	AttrNumber	initvalAttno;
 	int			i;
 	ListCell   *lc;
 
@@ -1737,8 +1936,35 @@ initialize_peragg(WindowAggState *winstate, WindowFunc *wfunc,
 	 * ... but we still need to check the component functions
 	 */
 
-	peraggstate->transfn_oid = transfn_oid = aggform->aggtransfn;
-	peraggstate->finalfn_oid = finalfn_oid = aggform->aggfinalfn;
+	/*
+	 * If the frame head can move, rows leave the frame as well as enter it.
+	 * Use the aggregate's moving-aggregate implementation, if it has one, so
+	 * that eval_windowaggregates can remove those rows with the inverse
+	 * transition function instead of aggregating the frame afresh.  Not if
+	 * the arguments contain volatile functions, though: we'd evaluate them
+	 * again for each removed row, and might get different answers.
+	 */
+	if (!(winstate->frameOptions & FRAMEOPTION_START_UNBOUNDED_PRECEDING) &&
+		OidIsValid(aggform->aggminvtransfn) &&
+		!contain_volatile_functions((Node *) wfunc->args))
+	{
+		transfn_oid = aggform->aggmtransfn;
+		invtransfn_oid = aggform->aggminvtransfn;
+		finalfn_oid = aggform->aggmfinalfn;
+		aggtranstype = aggform->aggmtranstype;
+		initvalAttno = Anum_pg_aggregate_aggminitval;
+	}
+	else
+	{
+		transfn_oid = aggform->aggtransfn;
+		invtransfn_oid = InvalidOid;
+		finalfn_oid = aggform->aggfinalfn;
+		aggtranstype = aggform->aggtranstype;
+		initvalAttno = Anum_pg_aggregate_agginitval;
+	}
+	peraggstate->transfn_oid = transfn_oid;
+	peraggstate->invtransfn_oid = invtransfn_oid;
+	peraggstate->finalfn_oid = finalfn_oid;
 
 	/* Check that aggregate owner has permission to call component fns */
 	{
@@ -1758,6 +1984,14 @@ initialize_peragg(WindowAggState *winstate, WindowFunc *wfunc,
 		if (aclresult != ACLCHECK_OK)
 			aclcheck_error(aclresult, ACL_KIND_PROC,
 						   get_func_name(transfn_oid));
+		if (OidIsValid(invtransfn_oid))
+		{
+			aclresult = pg_proc_aclcheck(invtransfn_oid, aggOwner,
+										 ACL_EXECUTE);
+			if (aclresult != ACLCHECK_OK)
+				aclcheck_error(aclresult, ACL_KIND_PROC,
+							   get_func_name(invtransfn_oid));
+		}
 		if (OidIsValid(finalfn_oid))
 		{
 			aclresult = pg_proc_aclcheck(finalfn_oid, aggOwner,
@@ -1769,7 +2003,6 @@ initialize_peragg(WindowAggState *winstate, WindowFunc *wfunc,
 	}
 
 	/* resolve actual type of transition state, if polymorphic */
-	aggtranstype = aggform->aggtranstype;
 	if (IsPolymorphicType(aggtranstype))
 	{
 		/* have to fetch the agg's declared input types... */
@@ -1800,6 +2033,19 @@ initialize_peragg(WindowAggState *winstate, WindowFunc *wfunc,
 	fmgr_info(transfn_oid, &peraggstate->transfn);
 	peraggstate->transfn.fn_expr = (Node *) transfnexpr;
 
+	/* the inverse transition function has the same signature */
+	if (OidIsValid(invtransfn_oid))
+	{
+		fmgr_info(invtransfn_oid, &peraggstate->invtransfn);
+		peraggstate->invtransfn.fn_expr = (Node *) transfnexpr;
+
+		if (peraggstate->invtransfn.fn_strict !=
+			peraggstate->transfn.fn_strict)
+			ereport(ERROR,
+					(errcode(ERRCODE_INVALID_FUNCTION_DEFINITION),
+					 errmsg("strictness of aggregate's forward and inverse transition functions must match")));
+	}
+
 	if (OidIsValid(finalfn_oid))
 	{
 		fmgr_info(finalfn_oid, &peraggstate->finalfn);
@@ -1817,8 +2063,7 @@ initialize_peragg(WindowAggState *winstate, WindowFunc *wfunc,
 	 * initval is potentially null, so don't try to access it as a struct
 	 * field. Must do it the hard way with SysCacheGetAttr.
 	 */
-	textInitVal = SysCacheGetAttr(AGGFNOID, aggTuple,
-								  Anum_pg_aggregate_agginitval,
+	textInitVal = SysCacheGetAttr(AGGFNOID, aggTuple, initvalAttno,
 								  &peraggstate->initValueIsNull);
 
 	if (peraggstate->initValueIsNull)
@@ -341,6 +341,36 @@ _outAppend(StringInfo str, Append *node)
 	_outPlanInfo(str, (Plan *) node);
 
 	WRITE_NODE_FIELD(appendplans);
+	WRITE_OID_FIELD(partrelid);
+	WRITE_NODE_FIELD(partprunestrategies);
+	WRITE_NODE_FIELD(partpruneexprs);
+	WRITE_NODE_FIELD(partoids);
+}
+
+static void
+_outMergeAppend(StringInfo str, MergeAppend *node)
+{
+	int			i;
+
+	WRITE_NODE_TYPE("MERGEAPPEND");
+
+	_outPlanInfo(str, (Plan *) node);
+
+	WRITE_NODE_FIELD(mergeplans);
+
+	WRITE_INT_FIELD(numCols);
+
+	appendStringInfo(str, " :sortColIdx");
+	for (i = 0; i < node->numCols; i++)
+		appendStringInfo(str, " %d", node->sortColIdx[i]);
+
+	appendStringInfo(str, " :sortOperators");
+	for (i = 0; i < node->numCols; i++)
+		appendStringInfo(str, " %u", node->sortOperators[i]);
+
+	appendStringInfo(str, " :nullsFirst");
+	for (i = 0; i < node->numCols; i++)
+		appendStringInfo(str, " %s", booltostr(node->nullsFirst[i]));
 }
 
 static void
@@ -413,6 +443,7 @@ _outIndexScan(StringInfo str, IndexScan *node)
 	WRITE_NODE_FIELD(indexqual);
 	WRITE_NODE_FIELD(indexqualorig);
 	WRITE_ENUM_FIELD(indexorderdir, ScanDirection);
+	WRITE_BOOL_FIELD(indexonly);
 }
 
 static void
@@ -642,6 +673,25 @@ _outMaterial(StringInfo str, Material *node)
 	_outPlanInfo(str, (Plan *) node);
 }
 
+static void
+_outMemoize(StringInfo str, Memoize *node)
+{
+	int			i;
+
+	WRITE_NODE_TYPE("MEMOIZE");
+
+	_outPlanInfo(str, (Plan *) node);
+
+	WRITE_INT_FIELD(numKeys);
+
+	appendStringInfo(str, " :hashOperators");
+	for (i = 0; i < node->numKeys; i++)
+		appendStringInfo(str, " %u", node->hashOperators[i]);
+
+	WRITE_NODE_FIELD(paramExprs);
+	WRITE_LONG_FIELD(estEntries);
+}
+
 static void
 _outSort(StringInfo str, Sort *node)
 {
@@ -666,6 +716,32 @@ _outSort(StringInfo str, Sort *node)
 		appendStringInfo(str, " %s", booltostr(node->nullsFirst[i]));
 }
 
+static void
+_outIncrementalSort(StringInfo str, IncrementalSort *node)
+{
+	int			i;
+
+	WRITE_NODE_TYPE("INCREMENTALSORT");
+
+	_outPlanInfo(str, (Plan *) node);
+
+	appendStringInfo(str, " :numCols %d", node->sort.numCols);
+
+	appendStringInfo(str, " :sortColIdx");
+	for (i = 0; i < node->sort.numCols; i++)
+		appendStringInfo(str, " %d", node->sort.sortColIdx[i]);
+
+	appendStringInfo(str, " :sortOperators");
+	for (i = 0; i < node->sort.numCols; i++)
+		appendStringInfo(str, " %u", node->sort.sortOperators[i]);
+
+	appendStringInfo(str, " :nullsFirst");
+	for (i = 0; i < node->sort.numCols; i++)
+		appendStringInfo(str, " %s", booltostr(node->sort.nullsFirst[i]));
+
+	WRITE_INT_FIELD(presortedCols);
+}
+
 static void
 _outUnique(StringInfo str, Unique *node)
 {
@@ -1385,6 +1461,7 @@ _outIndexPath(StringInfo str, IndexPath *node)
 	WRITE_NODE_FIELD(indexquals);
 	WRITE_BOOL_FIELD(isjoininner);
 	WRITE_ENUM_FIELD(indexscandir, ScanDirection);
+	WRITE_BOOL_FIELD(indexonly);
 	WRITE_FLOAT_FIELD(indextotalcost, "%.2f");
 	WRITE_FLOAT_FIELD(indexselectivity, "%.4f");
 	WRITE_FLOAT_FIELD(rows, "%.0f");
@@ -1441,6 +1518,17 @@ _outAppendPath(StringInfo str, AppendPath *node)
 
 	_outPathInfo(str, (Path *) node);
 
+	WRITE_NODE_FIELD(subpaths);
+	WRITE_NODE_FIELD(partpruneclauses);
+}
+
+static void
+_outMergeAppendPath(StringInfo str, MergeAppendPath *node)
+{
+	WRITE_NODE_TYPE("MERGEAPPENDPATH");
+
+	_outPathInfo(str, (Path *) node);
+
 	WRITE_NODE_FIELD(subpaths);
 }
 
@@ -1464,6 +1552,21 @@ _outMaterialPath(StringInfo str, MaterialPath *node)
 	WRITE_NODE_FIELD(subpath);
 }
 
+static void
+_outMemoizePath(StringInfo str, MemoizePath *node)
+{
+	WRITE_NODE_TYPE("MEMOIZEPATH");
+
+	_outPathInfo(str, (Path *) node);
+
+	WRITE_NODE_FIELD(subpath);
+	WRITE_NODE_FIELD(param_exprs);
+	WRITE_NODE_FIELD(hash_operators);
+	WRITE_FLOAT_FIELD(calls, "%.0f");
+	WRITE_FLOAT_FIELD(est_entries, "%.0f");
+	WRITE_FLOAT_FIELD(hit_ratio, "%.4f");
+}
+
 static void
 _outUniquePath(StringInfo str, UniquePath *node)
 {
@@ -1590,6 +1693,7 @@ _outRelOptInfo(StringInfo str, RelOptInfo *node)
 	WRITE_NODE_FIELD(indexlist);
 	WRITE_UINT_FIELD(pages);
 	WRITE_FLOAT_FIELD(tuples, "%.0f");
+	WRITE_FLOAT_FIELD(allvisfrac, "%.6f");
 	WRITE_NODE_FIELD(subplan);
 	WRITE_NODE_FIELD(subrtable);
 	WRITE_NODE_FIELD(subrowmark);
@@ -2478,6 +2582,9 @@ _outNode(StringInfo str, void *obj)
 			case T_Append:
 				_outAppend(str, obj);
 				break;
+			case T_MergeAppend:
+				_outMergeAppend(str, obj);
+				break;
 			case T_RecursiveUnion:
 				_outRecursiveUnion(str, obj);
 				break;
@@ -2544,9 +2651,15 @@ _outNode(StringInfo str, void *obj)
 			case T_Material:
 				_outMaterial(str, obj);
 				break;
+			case T_Memoize:
+				_outMemoize(str, obj);
+				break;
 			case T_Sort:
 				_outSort(str, obj);
 				break;
+			case T_IncrementalSort:
+				_outIncrementalSort(str, obj);
+				break;
 			case T_Unique:
 				_outUnique(str, obj);
 				break;
@@ -2722,12 +2835,18 @@ _outNode(StringInfo str, void *obj)
 			case T_AppendPath:
 				_outAppendPath(str, obj);
 				break;
+			case T_MergeAppendPath:
+				_outMergeAppendPath(str, obj);
+				break;
 			case T_ResultPath:
 				_outResultPath(str, obj);
 				break;
 			case T_MaterialPath:
 				_outMaterialPath(str, obj);
 				break;
+			case T_MemoizePath:
+				_outMemoizePath(str, obj);
+				break;
 			case T_UniquePath:
 				_outUniquePath(str, obj);
 				break;
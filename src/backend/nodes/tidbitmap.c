@@ -12,12 +12,19 @@
  * we no longer remember individual tuple offsets on a page but only the
  * fact that a particular page needs to be visited.
  *
- * The "lossy" storage uses one bit per disk page, so at the standard 8K
- * BLCKSZ, we can represent all pages in 64Gb of disk space in about 1Mb
- * of memory.  People pushing around tables of that size should have a
- * couple of Mb to spare, so we don't worry about providing a second level
- * of lossiness.  In theory we could fall back to page ranges at some
- * point, but for now that seems useless complexity.
+ * Exact TIDs are stored in compressed form, so that a bitmap can stay
+ * exact for far more pages within the same memory limit.  The heap is
+ * divided into segments of consecutive pages, and the TIDs of a segment
+ * are kept in a "container" in the manner of roaring bitmaps: a sorted
+ * array of 16-bit positions while the segment holds few TIDs, switching
+ * to a plain bitmap when the array would grow larger than that.  Union
+ * and intersection work directly on the containers.  Only when the
+ * containers outgrow the memory limit do we fall back to lossy storage,
+ * one bit per page kept in the segment's hashtable entry, so at the
+ * standard 8K BLCKSZ we can represent all pages in 64Gb of disk space in
+ * a few Mb of memory.  People pushing around tables of that size should
+ * have that much to spare, so we don't worry about providing a second
+ * level of lossiness.
  *
  * We also support the notion of candidate matches, or rechecking.	This
  * means we know that a search need visit only some tuples on a page,
@@ -45,6 +52,7 @@
 #include "nodes/tidbitmap.h"
 #include "storage/bufpage.h"
 #include "utils/hsearch.h"
+#include "utils/memutils.h"
 
 /*
  * The maximum number of tuples per page is not large (typically 256 with
@@ -55,70 +63,102 @@
 #define MAX_TUPLES_PER_PAGE  MaxHeapTuplesPerPage
 
 /*
- * When we have to switch over to lossy storage, we use a data structure
- * with one bit per page, where all pages having the same number DIV
- * PAGES_PER_CHUNK are aggregated into one chunk.  When a chunk is present
- * and has the bit set for a given page, there must not be a per-page entry
- * for that page in the page table.
- *
- * We actually store both exact pages and lossy chunks in the same hash
- * table, using identical data structures.	(This is because dynahash.c's
- * memory management doesn't allow space to be transferred easily from one
- * hashtable to another.)  Therefore it's best if PAGES_PER_CHUNK is the
- * same as MAX_TUPLES_PER_PAGE, or at least not too different.	But we
- * also want PAGES_PER_CHUNK to be a power of 2 to avoid expensive integer
- * remainder operations.  So, define it like this:
+ * The bitmap has one hashtable entry per segment of PAGES_PER_SEGMENT
+ * consecutive heap pages that it has anything to say about.  Within a
+ * segment, a TID is identified by its "position",
+ *		(page - first page of segment) * MAX_TUPLES_PER_PAGE + offset - 1
+ * Since MaxHeapTuplesPerPage is less than BLCKSZ / 28, this definition of
+ * PAGES_PER_SEGMENT makes positions fit in 16 bits for any BLCKSZ, and
+ * it is a power of 2 to avoid expensive integer division.
  */
-#define PAGES_PER_CHUNK  (BLCKSZ / 32)
+#define PAGES_PER_SEGMENT  ((1 << 20) / BLCKSZ)
+#define POSITIONS_PER_SEGMENT  (PAGES_PER_SEGMENT * MAX_TUPLES_PER_PAGE)
 
 /* We use BITS_PER_BITMAPWORD and typedef bitmapword from nodes/bitmapset.h */
 
 #define WORDNUM(x)	((x) / BITS_PER_BITMAPWORD)
 #define BITNUM(x)	((x) % BITS_PER_BITMAPWORD)
 
-/* number of active words for an exact page: */
-#define WORDS_PER_PAGE	((MAX_TUPLES_PER_PAGE - 1) / BITS_PER_BITMAPWORD + 1)
-/* number of active words for a lossy chunk: */
-#define WORDS_PER_CHUNK  ((PAGES_PER_CHUNK - 1) / BITS_PER_BITMAPWORD + 1)
+/* number of words for a bitmap with one bit per page of a segment: */
+#define WORDS_PER_SEGMENT  ((PAGES_PER_SEGMENT - 1) / BITS_PER_BITMAPWORD + 1)
+/* number of words for a bitmap container: */
+#define WORDS_PER_CONTAINER  ((POSITIONS_PER_SEGMENT - 1) / BITS_PER_BITMAPWORD + 1)
 
 /*
- * The hashtable entries are represented by this data structure.  For
- * an exact page, blockno is the page number and bit k of the bitmap
- * represents tuple offset k+1.  For a lossy chunk, blockno is the first
- * page in the chunk (this must be a multiple of PAGES_PER_CHUNK) and
- * bit k represents page blockno+k.  Note that it is not possible to
- * have exact storage for the first page of a chunk if we are using
- * lossy storage for any page in the chunk's range, since the same
- * hashtable entry has to serve both purposes.
- *
- * recheck is used only on exact pages --- it indicates that although
- * only the stated tuples need be checked, the full index qual condition
- * must be checked for each (ie, these are candidate matches).
+ * The exact TIDs of a segment are kept in its container, which is either a
+ * sorted array of positions or a bitmap with one bit per possible position.
+ * We use the array as long as it's no bigger than the bitmap would be, so
+ * a sparsely filled segment costs two bytes per TID, and a densely filled
+ * one less than a bit per possible TID.  Arrays of up to INLINE_POSITIONS
+ * positions are stored in the hashtable entry itself, so that a segment
+ * with just a few TIDs doesn't need a separate allocation.
+ */
+#define INLINE_POSITIONS  4
+#define MAX_ARRAY_POSITIONS \
+	((int) (WORDS_PER_CONTAINER * sizeof(bitmapword) / sizeof(uint16)))
+
+/*
+ * The hashtable entries are represented by this data structure.  Bit k of
+ * lossy is set if page k of the segment is stored lossily, ie, all of its
+ * tuples must be visited; there must not be any exact TIDs for such a page
+ * in the container.  Bit k of recheck is used only for pages with exact
+ * TIDs --- it indicates that although only the stated tuples need be
+ * checked, the full index qual condition must be checked for each (ie,
+ * these are candidate matches).
  */
-typedef struct PagetableEntry
+typedef struct SegmentEntry
 {
-	BlockNumber blockno;		/* page number (hashtable key) */
-	bool		ischunk;		/* T = lossy storage, F = exact */
-	bool		recheck;		/* should the tuples be rechecked? */
-	bitmapword	words[Max(WORDS_PER_PAGE, WORDS_PER_CHUNK)];
-} PagetableEntry;
+	BlockNumber segno;			/* page number / PAGES_PER_SEGMENT (hashtable
+								 * key) */
+	bool		isbitmap;		/* T = bitmap container, F = array */
+	int			npositions;		/* number of exact TIDs in the container */
+	int			maxpositions;	/* allocated length of an array container */
+	bitmapword	lossy[WORDS_PER_SEGMENT];
+	bitmapword	recheck[WORDS_PER_SEGMENT];
+	union
+	{
+		uint16		inline_positions[INLINE_POSITIONS];
+		uint16	   *positions;	/* if maxpositions > INLINE_POSITIONS */
+		bitmapword *words;		/* if isbitmap */
+	}			c;
+} SegmentEntry;
+
+#define SEGMENT_POSITIONS(seg) \
+	((seg)->maxpositions > INLINE_POSITIONS ? \
+	 (seg)->c.positions : (seg)->c.inline_positions)
+
+#define PAGE_BIT(pageno)  ((bitmapword) 1 << BITNUM(pageno))
+
+#define SEGMENT_PAGE_IS_LOSSY(seg, pageno) \
+	(((seg)->lossy[WORDNUM(pageno)] & PAGE_BIT(pageno)) != 0)
+
+/*
+ * Estimated memory used per segment, apart from an out-of-line container.
+ * This counts the hash overhead at MAXALIGN(sizeof(HASHELEMENT)) plus a
+ * pointer per hash entry, which is crude but good enough for our purpose.
+ * Also count an extra Pointer per entry for the array created during
+ * iteration readout.
+ */
+#define SEGMENT_OVERHEAD \
+	(MAXALIGN(sizeof(HASHELEMENT)) + MAXALIGN(sizeof(SegmentEntry)) \
+	 + sizeof(Pointer) + sizeof(Pointer))
 
 /*
  * dynahash.c is optimized for relatively large, long-lived hash tables.
  * This is not ideal for TIDBitMap, particularly when we are using a bitmap
  * scan on the inside of a nestloop join: a bitmap may well live only long
  * enough to accumulate one entry in such cases.  We therefore avoid creating
- * an actual hashtable until we need two pagetable entries.  When just one
- * pagetable entry is needed, we store it in a fixed field of TIDBitMap.
- * (NOTE: we don't get rid of the hashtable if the bitmap later shrinks down
- * to zero or one page again.  So, status can be TBM_HASH even when nentries
- * is zero or one.)
+ * an actual hashtable until we need two segments.  When just one segment
+ * is needed, we store it in a fixed field of TIDBitMap.  (NOTE: we don't
+ * get rid of the hashtable if the bitmap later shrinks down to zero or one
+ * segment again.  So, status can be TBM_HASH even when nsegments is zero
+ * or one.)
  */
 typedef enum
 {
-	TBM_EMPTY,					/* no hashtable, nentries == 0 */
-	TBM_ONE_PAGE,				/* entry1 contains the single entry */
-	TBM_HASH					/* pagetable is valid, entry1 is not */
+	TBM_EMPTY,					/* no hashtable, nsegments == 0 */
+	TBM_ONE_SEGMENT,			/* seg1 contains the single entry */
+	TBM_HASH					/* segtable is valid, seg1 is not */
 } TBMStatus;
 
 /*
@@ -129,16 +169,14 @@ struct TIDBitmap
 	NodeTag		type;			/* to make it a valid Node */
 	MemoryContext mcxt;			/* memory context containing me */
 	TBMStatus	status;			/* see codes above */
-	HTAB	   *pagetable;		/* hash table of PagetableEntry's */
-	int			nentries;		/* number of entries in pagetable */
-	int			maxentries;		/* limit on same to meet maxbytes */
-	int			npages;			/* number of exact entries in pagetable */
-	int			nchunks;		/* number of lossy entries in pagetable */
+	HTAB	   *segtable;		/* hash table of SegmentEntry's */
+	int			nsegments;		/* number of entries in segtable */
+	long		nbytes;			/* estimated memory in use */
+	long		maxbytes;		/* limit on same */
 	bool		iterating;		/* tbm_begin_iterate called? */
-	PagetableEntry entry1;		/* used when status == TBM_ONE_PAGE */
-	/* these are valid when iterating is true: */
-	PagetableEntry **spages;	/* sorted exact-page list, or NULL */
-	PagetableEntry **schunks;	/* sorted lossy-chunk list, or NULL */
+	SegmentEntry seg1;			/* used when status == TBM_ONE_SEGMENT */
+	/* this is valid when iterating is true: */
+	SegmentEntry **ssegments;	/* sorted segment list, or NULL */
 };
 
 /*
@@ -150,24 +188,35 @@ struct TIDBitmap
 struct TBMIterator
 {
 	TIDBitmap  *tbm;			/* TIDBitmap we're iterating over */
-	int			spageptr;		/* next spages index */
-	int			schunkptr;		/* next schunks index */
-	int			schunkbit;		/* next bit to check in current schunk */
+	int			ssegptr;		/* current ssegments index */
+	int			spage;			/* next page to check in current segment */
+	int			spos;			/* next array index in current segment */
 	TBMIterateResult output;	/* MUST BE LAST (because variable-size) */
 };
 
 
 /* Local function prototypes */
-static void tbm_union_page(TIDBitmap *a, const PagetableEntry *bpage);
-static bool tbm_intersect_page(TIDBitmap *a, PagetableEntry *apage,
-				   const TIDBitmap *b);
-static const PagetableEntry *tbm_find_pageentry(const TIDBitmap *tbm,
-				   BlockNumber pageno);
-static PagetableEntry *tbm_get_pageentry(TIDBitmap *tbm, BlockNumber pageno);
-static bool tbm_page_is_lossy(const TIDBitmap *tbm, BlockNumber pageno);
+static void tbm_union_segment(TIDBitmap *a, const SegmentEntry *bseg);
+static bool tbm_intersect_segment(TIDBitmap *a, SegmentEntry *aseg,
+					  const TIDBitmap *b);
+static const SegmentEntry *tbm_find_segment(const TIDBitmap *tbm,
+				 BlockNumber segno);
+static SegmentEntry *tbm_get_segment(TIDBitmap *tbm, BlockNumber segno);
 static void tbm_mark_page_lossy(TIDBitmap *tbm, BlockNumber pageno);
 static void tbm_lossify(TIDBitmap *tbm);
 static int	tbm_comparator(const void *left, const void *right);
+static int	tbm_density_comparator(const void *left, const void *right);
+static void seg_add_position(TIDBitmap *tbm, SegmentEntry *seg, uint16 pos);
+static bool seg_has_position(const SegmentEntry *seg, uint16 pos);
+static int	seg_get_positions(const SegmentEntry *seg, uint16 *positions);
+static void seg_set_positions(TIDBitmap *tbm, SegmentEntry *seg,
+				  const uint16 *positions, int npositions);
+static void seg_exact_pages(const SegmentEntry *seg, bitmapword *pages);
+static void seg_remove_pages(SegmentEntry *seg, const bitmapword *pages);
+static void seg_make_lossy(TIDBitmap *tbm, SegmentEntry *seg);
+static void seg_grow_array(TIDBitmap *tbm, SegmentEntry *seg);
+static void seg_convert_to_bitmap(TIDBitmap *tbm, SegmentEntry *seg);
+static void seg_free_container(TIDBitmap *tbm, SegmentEntry *seg);
 
 
 /*
@@ -181,7 +230,9 @@ TIDBitmap *
 tbm_create(long maxbytes)
 {
 	TIDBitmap  *tbm;
-	long		nbuckets;
+
+	/* positions within a segment must fit in a uint16 */
+	Assert(POSITIONS_PER_SEGMENT <= 65536);
 
 	/* Create the TIDBitmap struct and zero all its fields */
 	tbm = makeNode(TIDBitmap);
@@ -189,19 +240,8 @@ tbm_create(long maxbytes)
 	tbm->mcxt = CurrentMemoryContext;
 	tbm->status = TBM_EMPTY;
 
-	/*
-	 * Estimate number of hashtable entries we can have within maxbytes. This
-	 * estimates the hash overhead at MAXALIGN(sizeof(HASHELEMENT)) plus a
-	 * pointer per hash entry, which is crude but good enough for our purpose.
-	 * Also count an extra Pointer per entry for the arrays created during
-	 * iteration readout.
-	 */
-	nbuckets = maxbytes /
-		(MAXALIGN(sizeof(HASHELEMENT)) + MAXALIGN(sizeof(PagetableEntry))
-		 + sizeof(Pointer) + sizeof(Pointer));
-	nbuckets = Min(nbuckets, INT_MAX - 1);		/* safety limit */
-	nbuckets = Max(nbuckets, 16);		/* sanity limit */
-	tbm->maxentries = (int) nbuckets;
+	/* sanity limit: allow at least 16 segments */
+	tbm->maxbytes = Max(maxbytes, (long) (16 * SEGMENT_OVERHEAD));
 
 	return tbm;
 }
@@ -211,35 +251,35 @@ tbm_create(long maxbytes)
  * proposition, we don't do it until we have to.
  */
 static void
-tbm_create_pagetable(TIDBitmap *tbm)
+tbm_create_segtable(TIDBitmap *tbm)
 {
 	HASHCTL		hash_ctl;
 
 	Assert(tbm->status != TBM_HASH);
-	Assert(tbm->pagetable == NULL);
+	Assert(tbm->segtable == NULL);
 
 	/* Create the hashtable proper */
 	MemSet(&hash_ctl, 0, sizeof(hash_ctl));
 	hash_ctl.keysize = sizeof(BlockNumber);
-	hash_ctl.entrysize = sizeof(PagetableEntry);
+	hash_ctl.entrysize = sizeof(SegmentEntry);
 	hash_ctl.hash = tag_hash;
 	hash_ctl.hcxt = tbm->mcxt;
-	tbm->pagetable = hash_create("TIDBitmap",
-								 128,	/* start small and extend */
-								 &hash_ctl,
-								 HASH_ELEM | HASH_FUNCTION | HASH_CONTEXT);
+	tbm->segtable = hash_create("TIDBitmap",
+								128,	/* start small and extend */
+								&hash_ctl,
+								HASH_ELEM | HASH_FUNCTION | HASH_CONTEXT);
 
-	/* If entry1 is valid, push it into the hashtable */
-	if (tbm->status == TBM_ONE_PAGE)
+	/* If seg1 is valid, push it into the hashtable */
+	if (tbm->status == TBM_ONE_SEGMENT)
 	{
-		PagetableEntry *page;
+		SegmentEntry *seg;
 		bool		found;
 
-		page = (PagetableEntry *) hash_search(tbm->pagetable,
-											  (void *) &tbm->entry1.blockno,
-											  HASH_ENTER, &found);
+		seg = (SegmentEntry *) hash_search(tbm->segtable,
+										   (void *) &tbm->seg1.segno,
+										   HASH_ENTER, &found);
 		Assert(!found);
-		memcpy(page, &tbm->entry1, sizeof(PagetableEntry));
+		memcpy(seg, &tbm->seg1, sizeof(SegmentEntry));
 	}
 
 	tbm->status = TBM_HASH;
@@ -251,12 +291,21 @@ tbm_create_pagetable(TIDBitmap *tbm)
 void
 tbm_free(TIDBitmap *tbm)
 {
-	if (tbm->pagetable)
-		hash_destroy(tbm->pagetable);
-	if (tbm->spages)
-		pfree(tbm->spages);
-	if (tbm->schunks)
-		pfree(tbm->schunks);
+	if (tbm->status == TBM_ONE_SEGMENT)
+		seg_free_container(tbm, &tbm->seg1);
+	else if (tbm->status == TBM_HASH)
+	{
+		HASH_SEQ_STATUS status;
+		SegmentEntry *seg;
+
+		hash_seq_init(&status, tbm->segtable);
+		while ((seg = (SegmentEntry *) hash_seq_search(&status)) != NULL)
+			seg_free_container(tbm, seg);
+	}
+	if (tbm->segtable)
+		hash_destroy(tbm->segtable);
+	if (tbm->ssegments)
+		pfree(tbm->ssegments);
 	pfree(tbm);
 }
 
@@ -277,34 +326,25 @@ tbm_add_tuples(TIDBitmap *tbm, const ItemPointer tids, int ntids,
 	{
 		BlockNumber blk = ItemPointerGetBlockNumber(tids + i);
 		OffsetNumber off = ItemPointerGetOffsetNumber(tids + i);
-		PagetableEntry *page;
-		int			wordnum,
-					bitnum;
+		SegmentEntry *seg;
+		int			pageno;
 
 		/* safety check to ensure we don't overrun bit array bounds */
 		if (off < 1 || off > MAX_TUPLES_PER_PAGE)
 			elog(ERROR, "tuple offset out of range: %u", off);
 
-		if (tbm_page_is_lossy(tbm, blk))
-			continue;			/* whole page is already marked */
+		seg = tbm_get_segment(tbm, blk / PAGES_PER_SEGMENT);
+		pageno = blk % PAGES_PER_SEGMENT;
 
-		page = tbm_get_pageentry(tbm, blk);
+		if (SEGMENT_PAGE_IS_LOSSY(seg, pageno))
+			continue;			/* whole page is already marked */
 
-		if (page->ischunk)
-		{
-			/* The page is a lossy chunk header, set bit for itself */
-			wordnum = bitnum = 0;
-		}
-		else
-		{
-			/* Page is exact, so set bit for individual tuple */
-			wordnum = WORDNUM(off - 1);
-			bitnum = BITNUM(off - 1);
-		}
-		page->words[wordnum] |= ((bitmapword) 1 << bitnum);
-		page->recheck |= recheck;
+		seg_add_position(tbm, seg,
+						 (uint16) (pageno * MAX_TUPLES_PER_PAGE + off - 1));
+		if (recheck)
+			seg->recheck[WORDNUM(pageno)] |= PAGE_BIT(pageno);
 
-		if (tbm->nentries > tbm->maxentries)
+		if (tbm->nbytes > tbm->maxbytes)
 			tbm_lossify(tbm);
 	}
 }
@@ -321,7 +361,7 @@ tbm_add_page(TIDBitmap *tbm, BlockNumber pageno)
 	/* Enter the page in the bitmap, or mark it lossy if already present */
 	tbm_mark_page_lossy(tbm, pageno);
 	/* If we went over the memory limit, lossify some more pages */
-	if (tbm->nentries > tbm->maxentries)
+	if (tbm->nbytes > tbm->maxbytes)
 		tbm_lossify(tbm);
 }
 
@@ -335,75 +375,118 @@ tbm_union(TIDBitmap *a, const TIDBitmap *b)
 {
 	Assert(!a->iterating);
 	/* Nothing to do if b is empty */
-	if (b->nentries == 0)
+	if (b->nsegments == 0)
 		return;
-	/* Scan through chunks and pages in b, merge into a */
-	if (b->status == TBM_ONE_PAGE)
-		tbm_union_page(a, &b->entry1);
+	/* Scan through segments in b, merge into a */
+	if (b->status == TBM_ONE_SEGMENT)
+		tbm_union_segment(a, &b->seg1);
 	else
 	{
 		HASH_SEQ_STATUS status;
-		PagetableEntry *bpage;
+		SegmentEntry *bseg;
 
 		Assert(b->status == TBM_HASH);
-		hash_seq_init(&status, b->pagetable);
-		while ((bpage = (PagetableEntry *) hash_seq_search(&status)) != NULL)
-			tbm_union_page(a, bpage);
+		hash_seq_init(&status, b->segtable);
+		while ((bseg = (SegmentEntry *) hash_seq_search(&status)) != NULL)
+			tbm_union_segment(a, bseg);
 	}
 }
 
-/* Process one page of b during a union op */
+/* Process one segment of b during a union op */
 static void
-tbm_union_page(TIDBitmap *a, const PagetableEntry *bpage)
+tbm_union_segment(TIDBitmap *a, const SegmentEntry *bseg)
 {
-	PagetableEntry *apage;
+	SegmentEntry *aseg;
+	bitmapword	newlossy[WORDS_PER_SEGMENT];
+	bool		anynewlossy = false;
 	int			wordnum;
 
-	if (bpage->ischunk)
-	{
-		/* Scan b's chunk, mark each indicated page lossy in a */
-		for (wordnum = 0; wordnum < WORDS_PER_PAGE; wordnum++)
-		{
-			bitmapword	w = bpage->words[wordnum];
-
-			if (w != 0)
-			{
-				BlockNumber pg;
+	aseg = tbm_get_segment(a, bseg->segno);
 
-				pg = bpage->blockno + (wordnum * BITS_PER_BITMAPWORD);
-				while (w != 0)
-				{
-					if (w & 1)
-						tbm_mark_page_lossy(a, pg);
-					pg++;
-					w >>= 1;
-				}
-			}
-		}
+	/* Pages lossy in b become lossy in a, dropping a's TIDs on them */
+	for (wordnum = 0; wordnum < WORDS_PER_SEGMENT; wordnum++)
+	{
+		newlossy[wordnum] = bseg->lossy[wordnum] & ~aseg->lossy[wordnum];
+		if (newlossy[wordnum] != 0)
+			anynewlossy = true;
 	}
-	else if (tbm_page_is_lossy(a, bpage->blockno))
+	if (anynewlossy)
 	{
-		/* page is already lossy in a, nothing to do */
-		return;
+		seg_remove_pages(aseg, newlossy);
+		for (wordnum = 0; wordnum < WORDS_PER_SEGMENT; wordnum++)
+			aseg->lossy[wordnum] |= newlossy[wordnum];
 	}
-	else
+
+	/* Merge b's exact TIDs, except those on pages that are lossy in a */
+	if (bseg->npositions > 0)
 	{
-		apage = tbm_get_pageentry(a, bpage->blockno);
-		if (apage->ischunk)
+		const uint16 *bpositions;
+		uint16	   *bbuf = NULL;
+		int			nb = bseg->npositions;
+		int			i;
+
+		if (bseg->isbitmap)
+		{
+			bbuf = (uint16 *) palloc(nb * sizeof(uint16));
+			seg_get_positions(bseg, bbuf);
+			bpositions = bbuf;
+		}
+		else
+			bpositions = SEGMENT_POSITIONS(bseg);
+
+		if (aseg->isbitmap || aseg->npositions + nb > MAX_ARRAY_POSITIONS)
 		{
-			/* The page is a lossy chunk header, set bit for itself */
-			apage->words[0] |= ((bitmapword) 1 << 0);
+			/* The result might not fit in an array, so OR into a bitmap */
+			if (!aseg->isbitmap)
+				seg_convert_to_bitmap(a, aseg);
+			for (i = 0; i < nb; i++)
+			{
+				if (!SEGMENT_PAGE_IS_LOSSY(aseg,
+										   bpositions[i] / MAX_TUPLES_PER_PAGE))
+					seg_add_position(a, aseg, bpositions[i]);
+			}
 		}
 		else
 		{
-			/* Both pages are exact, merge at the bit level */
-			for (wordnum = 0; wordnum < WORDS_PER_PAGE; wordnum++)
-				apage->words[wordnum] |= bpage->words[wordnum];
-			apage->recheck |= bpage->recheck;
+			/* Both are arrays: merge them, eliminating duplicates */
+			const uint16 *apositions = SEGMENT_POSITIONS(aseg);
+			int			na = aseg->npositions;
+			uint16	   *merged;
+			int			n = 0;
+			int			j = 0;
+
+			merged = (uint16 *) palloc((na + nb) * sizeof(uint16));
+			i = 0;
+			while (i < na || j < nb)
+			{
+				if (j >= nb || (i < na && apositions[i] < bpositions[j]))
+					merged[n++] = apositions[i++];
+				else if (i >= na || bpositions[j] < apositions[i])
+				{
+					if (!SEGMENT_PAGE_IS_LOSSY(aseg,
+										bpositions[j] / MAX_TUPLES_PER_PAGE))
+						merged[n++] = bpositions[j];
+					j++;
+				}
+				else
+				{
+					merged[n++] = apositions[i++];
+					j++;
+				}
+			}
+			seg_set_positions(a, aseg, merged, n);
+			pfree(merged);
 		}
+
+		for (wordnum = 0; wordnum < WORDS_PER_SEGMENT; wordnum++)
+			aseg->recheck[wordnum] |= bseg->recheck[wordnum] &
+				~aseg->lossy[wordnum];
+
+		if (bbuf)
+			pfree(bbuf);
 	}
 
-	if (a->nentries > a->maxentries)
+	if (a->nbytes > a->maxbytes)
 		tbm_lossify(a);
 }
 
@@ -417,128 +500,117 @@ tbm_intersect(TIDBitmap *a, const TIDBitmap *b)
 {
 	Assert(!a->iterating);
 	/* Nothing to do if a is empty */
-	if (a->nentries == 0)
+	if (a->nsegments == 0)
 		return;
-	/* Scan through chunks and pages in a, try to match to b */
-	if (a->status == TBM_ONE_PAGE)
+	/* Scan through segments in a, try to match to b */
+	if (a->status == TBM_ONE_SEGMENT)
 	{
-		if (tbm_intersect_page(a, &a->entry1, b))
+		if (tbm_intersect_segment(a, &a->seg1, b))
 		{
-			/* Page is now empty, remove it from a */
-			Assert(!a->entry1.ischunk);
-			a->npages--;
-			a->nentries--;
-			Assert(a->nentries == 0);
+			/* Segment is now empty, remove it from a */
+			a->nsegments--;
+			a->nbytes -= SEGMENT_OVERHEAD;
+			Assert(a->nsegments == 0);
 			a->status = TBM_EMPTY;
 		}
 	}
 	else
 	{
 		HASH_SEQ_STATUS status;
-		PagetableEntry *apage;
+		SegmentEntry *aseg;
 
 		Assert(a->status == TBM_HASH);
-		hash_seq_init(&status, a->pagetable);
-		while ((apage = (PagetableEntry *) hash_seq_search(&status)) != NULL)
+		hash_seq_init(&status, a->segtable);
+		while ((aseg = (SegmentEntry *) hash_seq_search(&status)) != NULL)
 		{
-			if (tbm_intersect_page(a, apage, b))
+			if (tbm_intersect_segment(a, aseg, b))
 			{
-				/* Page or chunk is now empty, remove it from a */
-				if (apage->ischunk)
-					a->nchunks--;
-				else
-					a->npages--;
-				a->nentries--;
-				if (hash_search(a->pagetable,
-								(void *) &apage->blockno,
+				/* Segment is now empty, remove it from a */
+				if (hash_search(a->segtable,
+								(void *) &aseg->segno,
 								HASH_REMOVE, NULL) == NULL)
 					elog(ERROR, "hash table corrupted");
+				a->nsegments--;
+				a->nbytes -= SEGMENT_OVERHEAD;
 			}
 		}
 	}
 }
 
 /*
- * Process one page of a during an intersection op
+ * Process one segment of a during an intersection op
  *
- * Returns TRUE if apage is now empty and should be deleted from a
+ * Returns TRUE if aseg is now empty and should be deleted from a; its
+ * container has been freed in that case.
  */
 static bool
-tbm_intersect_page(TIDBitmap *a, PagetableEntry *apage, const TIDBitmap *b)
+tbm_intersect_segment(TIDBitmap *a, SegmentEntry *aseg, const TIDBitmap *b)
 {
-	const PagetableEntry *bpage;
+	const SegmentEntry *bseg;
+	bitmapword	bpages[WORDS_PER_SEGMENT];
+	bool		candelete = true;
 	int			wordnum;
 
-	if (apage->ischunk)
+	bseg = tbm_find_segment(b, aseg->segno);
+	if (bseg == NULL)
 	{
-		/* Scan each bit in chunk, try to clear */
-		bool		candelete = true;
-
-		for (wordnum = 0; wordnum < WORDS_PER_PAGE; wordnum++)
-		{
-			bitmapword	w = apage->words[wordnum];
-
-			if (w != 0)
-			{
-				bitmapword	neww = w;
-				BlockNumber pg;
-				int			bitnum;
-
-				pg = apage->blockno + (wordnum * BITS_PER_BITMAPWORD);
-				bitnum = 0;
-				while (w != 0)
-				{
-					if (w & 1)
-					{
-						if (!tbm_page_is_lossy(b, pg) &&
-							tbm_find_pageentry(b, pg) == NULL)
-						{
-							/* Page is not in b at all, lose lossy bit */
-							neww &= ~((bitmapword) 1 << bitnum);
-						}
-					}
-					pg++;
-					bitnum++;
-					w >>= 1;
-				}
-				apage->words[wordnum] = neww;
-				if (neww != 0)
-					candelete = false;
-			}
-		}
-		return candelete;
+		/* b has nothing in this segment, so we can just delete it */
+		seg_free_container(a, aseg);
+		return true;
 	}
-	else if (tbm_page_is_lossy(b, apage->blockno))
+
+	/* A lossy page of a survives if b has the page lossy or exact */
+	seg_exact_pages(bseg, bpages);
+	for (wordnum = 0; wordnum < WORDS_PER_SEGMENT; wordnum++)
 	{
-		/*
-		 * Some of the tuples in 'a' might not satisfy the quals for 'b', but
-		 * because the page 'b' is lossy, we don't know which ones. Therefore
-		 * we mark 'a' as requiring rechecks, to indicate that at most those
-		 * tuples set in 'a' are matches.
-		 */
-		apage->recheck = true;
-		return false;
+		aseg->lossy[wordnum] &= bseg->lossy[wordnum] | bpages[wordnum];
+		if (aseg->lossy[wordnum] != 0)
+			candelete = false;
 	}
-	else
-	{
-		bool		candelete = true;
 
-		bpage = tbm_find_pageentry(b, apage->blockno);
-		if (bpage != NULL)
+	/*
+	 * An exact TID of a survives if b has it too, or if b's page is lossy;
+	 * in the latter case it becomes a candidate match.
+	 */
+	if (aseg->npositions > 0)
+	{
+		uint16	   *positions;
+		bitmapword	apages[WORDS_PER_SEGMENT];
+		int			na;
+		int			n = 0;
+		int			i;
+
+		positions = (uint16 *) palloc(aseg->npositions * sizeof(uint16));
+		na = seg_get_positions(aseg, positions);
+		for (i = 0; i < na; i++)
 		{
-			/* Both pages are exact, merge at the bit level */
-			Assert(!bpage->ischunk);
-			for (wordnum = 0; wordnum < WORDS_PER_PAGE; wordnum++)
+			uint16		pos = positions[i];
+			int			pageno = pos / MAX_TUPLES_PER_PAGE;
+
+			if (SEGMENT_PAGE_IS_LOSSY(bseg, pageno))
+			{
+				aseg->recheck[WORDNUM(pageno)] |= PAGE_BIT(pageno);
+				positions[n++] = pos;
+			}
+			else if (seg_has_position(bseg, pos))
 			{
-				apage->words[wordnum] &= bpage->words[wordnum];
-				if (apage->words[wordnum] != 0)
-					candelete = false;
+				aseg->recheck[WORDNUM(pageno)] |=
+					bseg->recheck[WORDNUM(pageno)] & PAGE_BIT(pageno);
+				positions[n++] = pos;
 			}
-			apage->recheck |= bpage->recheck;
 		}
-		/* If there is no matching b page, we can just delete the a page */
-		return candelete;
+		seg_set_positions(a, aseg, positions, n);
+		pfree(positions);
+		if (n > 0)
+			candelete = false;
+
+		/* Forget the recheck flags of pages that lost all their TIDs */
+		seg_exact_pages(aseg, apages);
+		for (wordnum = 0; wordnum < WORDS_PER_SEGMENT; wordnum++)
+			aseg->recheck[wordnum] &= apages[wordnum];
 	}
+
+	return candelete;
 }
 
 /*
@@ -547,7 +619,7 @@ tbm_intersect_page(TIDBitmap *a, PagetableEntry *apage, const TIDBitmap *b)
 bool
 tbm_is_empty(const TIDBitmap *tbm)
 {
-	return (tbm->nentries == 0);
+	return (tbm->nsegments == 0);
 }
 
 /*
@@ -579,48 +651,34 @@ tbm_begin_iterate(TIDBitmap *tbm)
 	/*
 	 * Initialize iteration pointers.
 	 */
-	iterator->spageptr = 0;
-	iterator->schunkptr = 0;
-	iterator->schunkbit = 0;
+	iterator->ssegptr = 0;
+	iterator->spage = 0;
+	iterator->spos = 0;
 
 	/*
-	 * If we have a hashtable, create and fill the sorted page lists, unless
-	 * we already did that for a previous iterator.  Note that the lists are
-	 * attached to the bitmap not the iterator, so they can be used by more
-	 * than one iterator.
+	 * If we have a hashtable, create and fill the sorted segment list,
+	 * unless we already did that for a previous iterator.  Note that the
+	 * list is attached to the bitmap not the iterator, so it can be used by
+	 * more than one iterator.
 	 */
 	if (tbm->status == TBM_HASH && !tbm->iterating)
 	{
 		HASH_SEQ_STATUS status;
-		PagetableEntry *page;
-		int			npages;
-		int			nchunks;
+		SegmentEntry *seg;
+		int			nsegments;
 
-		if (!tbm->spages && tbm->npages > 0)
-			tbm->spages = (PagetableEntry **)
-				MemoryContextAlloc(tbm->mcxt,
-								   tbm->npages * sizeof(PagetableEntry *));
-		if (!tbm->schunks && tbm->nchunks > 0)
-			tbm->schunks = (PagetableEntry **)
+		if (!tbm->ssegments && tbm->nsegments > 0)
+			tbm->ssegments = (SegmentEntry **)
 				MemoryContextAlloc(tbm->mcxt,
-								   tbm->nchunks * sizeof(PagetableEntry *));
-
-		hash_seq_init(&status, tbm->pagetable);
-		npages = nchunks = 0;
-		while ((page = (PagetableEntry *) hash_seq_search(&status)) != NULL)
-		{
-			if (page->ischunk)
-				tbm->schunks[nchunks++] = page;
-			else
-				tbm->spages[npages++] = page;
-		}
-		Assert(npages == tbm->npages);
-		Assert(nchunks == tbm->nchunks);
-		if (npages > 1)
-			qsort(tbm->spages, npages, sizeof(PagetableEntry *),
-				  tbm_comparator);
-		if (nchunks > 1)
-			qsort(tbm->schunks, nchunks, sizeof(PagetableEntry *),
+								   tbm->nsegments * sizeof(SegmentEntry *));
+
+		hash_seq_init(&status, tbm->segtable);
+		nsegments = 0;
+		while ((seg = (SegmentEntry *) hash_seq_search(&status)) != NULL)
+			tbm->ssegments[nsegments++] = seg;
+		Assert(nsegments == tbm->nsegments);
+		if (nsegments > 1)
+			qsort(tbm->ssegments, nsegments, sizeof(SegmentEntry *),
 				  tbm_comparator);
 	}
 
@@ -649,92 +707,72 @@ tbm_iterate(TBMIterator *iterator)
 
 	Assert(tbm->iterating);
 
-	/*
-	 * If lossy chunk pages remain, make sure we've advanced schunkptr/
-	 * schunkbit to the next set bit.
-	 */
-	while (iterator->schunkptr < tbm->nchunks)
+	while (iterator->ssegptr < tbm->nsegments)
 	{
-		PagetableEntry *chunk = tbm->schunks[iterator->schunkptr];
-		int			schunkbit = iterator->schunkbit;
+		const SegmentEntry *seg;
 
-		while (schunkbit < PAGES_PER_CHUNK)
-		{
-			int			wordnum = WORDNUM(schunkbit);
-			int			bitnum = BITNUM(schunkbit);
+		/* In ONE_SEGMENT state, we don't allocate an ssegments[] array */
+		if (tbm->status == TBM_ONE_SEGMENT)
+			seg = &tbm->seg1;
+		else
+			seg = tbm->ssegments[iterator->ssegptr];
 
-			if ((chunk->words[wordnum] & ((bitmapword) 1 << bitnum)) != 0)
-				break;
-			schunkbit++;
-		}
-		if (schunkbit < PAGES_PER_CHUNK)
+		while (iterator->spage < PAGES_PER_SEGMENT)
 		{
-			iterator->schunkbit = schunkbit;
-			break;
-		}
-		/* advance to next chunk */
-		iterator->schunkptr++;
-		iterator->schunkbit = 0;
-	}
-
-	/*
-	 * If both chunk and per-page data remain, must output the numerically
-	 * earlier page.
-	 */
-	if (iterator->schunkptr < tbm->nchunks)
-	{
-		PagetableEntry *chunk = tbm->schunks[iterator->schunkptr];
-		BlockNumber chunk_blockno;
+			int			pageno = iterator->spage++;
+			int			base = pageno * MAX_TUPLES_PER_PAGE;
+			int			ntuples = 0;
 
-		chunk_blockno = chunk->blockno + iterator->schunkbit;
-		if (iterator->spageptr >= tbm->npages ||
-			chunk_blockno < tbm->spages[iterator->spageptr]->blockno)
-		{
-			/* Return a lossy page indicator from the chunk */
-			output->blockno = chunk_blockno;
-			output->ntuples = -1;
-			output->recheck = true;
-			iterator->schunkbit++;
-			return output;
-		}
-	}
+			output->blockno = seg->segno * PAGES_PER_SEGMENT + pageno;
 
-	if (iterator->spageptr < tbm->npages)
-	{
-		PagetableEntry *page;
-		int			ntuples;
-		int			wordnum;
+			if (SEGMENT_PAGE_IS_LOSSY(seg, pageno))
+			{
+				/* Return a lossy page indicator */
+				output->ntuples = -1;
+				output->recheck = true;
+				return output;
+			}
 
-		/* In ONE_PAGE state, we don't allocate an spages[] array */
-		if (tbm->status == TBM_ONE_PAGE)
-			page = &tbm->entry1;
-		else
-			page = tbm->spages[iterator->spageptr];
+			/* extract the page's individual offset numbers */
+			if (seg->isbitmap)
+			{
+				int			off;
 
-		/* scan bitmap to extract individual offset numbers */
-		ntuples = 0;
-		for (wordnum = 0; wordnum < WORDS_PER_PAGE; wordnum++)
-		{
-			bitmapword	w = page->words[wordnum];
+				for (off = 0; off < MAX_TUPLES_PER_PAGE; off++)
+				{
+					int			pos = base + off;
 
-			if (w != 0)
+					if ((seg->c.words[WORDNUM(pos)] &
+						 ((bitmapword) 1 << BITNUM(pos))) != 0)
+						output->offsets[ntuples++] = (OffsetNumber) (off + 1);
+				}
+			}
+			else
 			{
-				int			off = wordnum * BITS_PER_BITMAPWORD + 1;
+				const uint16 *positions = SEGMENT_POSITIONS(seg);
 
-				while (w != 0)
+				while (iterator->spos < seg->npositions &&
+					   positions[iterator->spos] < base + MAX_TUPLES_PER_PAGE)
 				{
-					if (w & 1)
-						output->offsets[ntuples++] = (OffsetNumber) off;
-					off++;
-					w >>= 1;
+					output->offsets[ntuples++] = (OffsetNumber)
+						(positions[iterator->spos] - base + 1);
+					iterator->spos++;
 				}
 			}
+
+			if (ntuples > 0)
+			{
+				output->ntuples = ntuples;
+				output->recheck =
+					(seg->recheck[WORDNUM(pageno)] & PAGE_BIT(pageno)) != 0;
+				return output;
+			}
 		}
-		output->blockno = page->blockno;
-		output->ntuples = ntuples;
-		output->recheck = page->recheck;
-		iterator->spageptr++;
-		return output;
+
+		/* advance to next segment */
+		iterator->ssegptr++;
+		iterator->spage = 0;
+		iterator->spos = 0;
 	}
 
 	/* Nothing more in the bitmap */
@@ -755,253 +793,580 @@ tbm_end_iterate(TBMIterator *iterator)
 }
 
 /*
- * tbm_find_pageentry - find a PagetableEntry for the pageno
+ * tbm_find_segment - find the SegmentEntry for the segno
  *
- * Returns NULL if there is no non-lossy entry for the pageno.
+ * Returns NULL if there is no entry for the segno.
  */
-static const PagetableEntry *
-tbm_find_pageentry(const TIDBitmap *tbm, BlockNumber pageno)
+static const SegmentEntry *
+tbm_find_segment(const TIDBitmap *tbm, BlockNumber segno)
 {
-	const PagetableEntry *page;
-
-	if (tbm->nentries == 0)		/* in case pagetable doesn't exist */
+	if (tbm->nsegments == 0)	/* in case segtable doesn't exist */
 		return NULL;
 
-	if (tbm->status == TBM_ONE_PAGE)
+	if (tbm->status == TBM_ONE_SEGMENT)
 	{
-		page = &tbm->entry1;
-		if (page->blockno != pageno)
+		if (tbm->seg1.segno != segno)
 			return NULL;
-		Assert(!page->ischunk);
-		return page;
+		return &tbm->seg1;
 	}
 
-	page = (PagetableEntry *) hash_search(tbm->pagetable,
-										  (void *) &pageno,
-										  HASH_FIND, NULL);
-	if (page == NULL)
-		return NULL;
-	if (page->ischunk)
-		return NULL;			/* don't want a lossy chunk header */
-	return page;
+	return (const SegmentEntry *) hash_search(tbm->segtable,
+											  (void *) &segno,
+											  HASH_FIND, NULL);
 }
 
 /*
- * tbm_get_pageentry - find or create a PagetableEntry for the pageno
- *
- * If new, the entry is marked as an exact (non-chunk) entry.
+ * tbm_get_segment - find or create a SegmentEntry for the segno
  *
- * This may cause the table to exceed the desired memory size.	It is
- * up to the caller to call tbm_lossify() at the next safe point if so.
+ * If new, the entry is marked as having no TIDs and no lossy pages.
  */
-static PagetableEntry *
-tbm_get_pageentry(TIDBitmap *tbm, BlockNumber pageno)
+static SegmentEntry *
+tbm_get_segment(TIDBitmap *tbm, BlockNumber segno)
 {
-	PagetableEntry *page;
+	SegmentEntry *seg;
 	bool		found;
 
 	if (tbm->status == TBM_EMPTY)
 	{
 		/* Use the fixed slot */
-		page = &tbm->entry1;
+		seg = &tbm->seg1;
 		found = false;
-		tbm->status = TBM_ONE_PAGE;
+		tbm->status = TBM_ONE_SEGMENT;
 	}
 	else
 	{
-		if (tbm->status == TBM_ONE_PAGE)
+		if (tbm->status == TBM_ONE_SEGMENT)
 		{
-			page = &tbm->entry1;
-			if (page->blockno == pageno)
-				return page;
-			/* Time to switch from one page to a hashtable */
-			tbm_create_pagetable(tbm);
+			seg = &tbm->seg1;
+			if (seg->segno == segno)
+				return seg;
+			/* Time to switch from one segment to a hashtable */
+			tbm_create_segtable(tbm);
 		}
 
 		/* Look up or create an entry */
-		page = (PagetableEntry *) hash_search(tbm->pagetable,
-											  (void *) &pageno,
-											  HASH_ENTER, &found);
+		seg = (SegmentEntry *) hash_search(tbm->segtable,
+										   (void *) &segno,
+										   HASH_ENTER, &found);
 	}
 
 	/* Initialize it if not present before */
 	if (!found)
 	{
-		MemSet(page, 0, sizeof(PagetableEntry));
-		page->blockno = pageno;
+		MemSet(seg, 0, sizeof(SegmentEntry));
+		seg->segno = segno;
+		seg->maxpositions = INLINE_POSITIONS;
 		/* must count it too */
-		tbm->nentries++;
-		tbm->npages++;
+		tbm->nsegments++;
+		tbm->nbytes += SEGMENT_OVERHEAD;
 	}
 
-	return page;
+	return seg;
 }
 
 /*
- * tbm_page_is_lossy - is the page marked as lossily stored?
+ * tbm_mark_page_lossy - mark the page number as lossily stored
+ *
+ * This may cause the segment's container to shrink, but never to grow.
  */
-static bool
-tbm_page_is_lossy(const TIDBitmap *tbm, BlockNumber pageno)
+static void
+tbm_mark_page_lossy(TIDBitmap *tbm, BlockNumber pageno)
 {
-	PagetableEntry *page;
-	BlockNumber chunk_pageno;
-	int			bitno;
+	SegmentEntry *seg;
+	int			segpageno = pageno % PAGES_PER_SEGMENT;
+
+	seg = tbm_get_segment(tbm, pageno / PAGES_PER_SEGMENT);
 
-	/* we can skip the lookup if there are no lossy chunks */
-	if (tbm->nchunks == 0)
-		return false;
-	Assert(tbm->status == TBM_HASH);
+	if (SEGMENT_PAGE_IS_LOSSY(seg, segpageno))
+		return;					/* already lossy */
 
-	bitno = pageno % PAGES_PER_CHUNK;
-	chunk_pageno = pageno - bitno;
-	page = (PagetableEntry *) hash_search(tbm->pagetable,
-										  (void *) &chunk_pageno,
-										  HASH_FIND, NULL);
-	if (page != NULL && page->ischunk)
+	/* Remove any exact TIDs for the page */
+	if (seg->npositions > 0)
 	{
-		int			wordnum = WORDNUM(bitno);
-		int			bitnum = BITNUM(bitno);
+		bitmapword	pages[WORDS_PER_SEGMENT];
 
-		if ((page->words[wordnum] & ((bitmapword) 1 << bitnum)) != 0)
-			return true;
+		MemSet(pages, 0, sizeof(pages));
+		pages[WORDNUM(segpageno)] = PAGE_BIT(segpageno);
+		seg_remove_pages(seg, pages);
 	}
-	return false;
+
+	seg->lossy[WORDNUM(segpageno)] |= PAGE_BIT(segpageno);
 }
 
 /*
- * tbm_mark_page_lossy - mark the page number as lossily stored
+ * tbm_lossify - lose some information to get back under the memory limit
+ */
+static void
+tbm_lossify(TIDBitmap *tbm)
+{
+	HASH_SEQ_STATUS status;
+	SegmentEntry *seg;
+	SegmentEntry **segs;
+	int			nsegs;
+	int			i;
+
+	Assert(!tbm->iterating);
+
+	/*
+	 * Make all the exact pages of whole segments lossy, which frees their
+	 * containers.  The segments holding the most exact TIDs go first: they
+	 * are the most densely filled, so rechecking whole pages costs the heap
+	 * scan the least extra work, and they free the most memory.  Converting
+	 * a segment whose TIDs are stored inline wouldn't save anything, so
+	 * those are left alone.
+	 *
+	 * We go down to half the limit, so that we don't have to come back here
+	 * again as soon as a few more TIDs are added.
+	 */
+	if (tbm->status == TBM_ONE_SEGMENT)
+	{
+		if (tbm->seg1.isbitmap ||
+			tbm->seg1.maxpositions > INLINE_POSITIONS)
+			seg_make_lossy(tbm, &tbm->seg1);
+	}
+	else if (tbm->status == TBM_HASH)
+	{
+		segs = (SegmentEntry **)
+			palloc(Max(tbm->nsegments, 1) * sizeof(SegmentEntry *));
+		nsegs = 0;
+		hash_seq_init(&status, tbm->segtable);
+		while ((seg = (SegmentEntry *) hash_seq_search(&status)) != NULL)
+		{
+			if (seg->isbitmap || seg->maxpositions > INLINE_POSITIONS)
+				segs[nsegs++] = seg;
+		}
+		if (nsegs > 1)
+			qsort(segs, nsegs, sizeof(SegmentEntry *),
+				  tbm_density_comparator);
+
+		for (i = 0; i < nsegs && tbm->nbytes > tbm->maxbytes / 2; i++)
+		{
+			/* This does the dirty work ... */
+			seg_make_lossy(tbm, segs[i]);
+		}
+		pfree(segs);
+	}
+
+	/*
+	 * If the bitmap is mostly made of segments holding just a few TIDs, we
+	 * may not have been able to free enough memory.  Rather than rescanning
+	 * the hashtable uselessly each time another TID is added, raise the
+	 * limit so that we don't come back until the bitmap has doubled.
+	 */
+	if (tbm->nbytes > tbm->maxbytes / 2)
+		tbm->maxbytes = Min(tbm->nbytes, LONG_MAX / 2) * 2;
+}
+
+/*
+ * qsort comparator to handle SegmentEntry pointers.
+ */
+static int
+tbm_comparator(const void *left, const void *right)
+{
+	BlockNumber l = (*((const SegmentEntry **) left))->segno;
+	BlockNumber r = (*((const SegmentEntry **) right))->segno;
+
+	if (l < r)
+		return -1;
+	else if (l > r)
+		return 1;
+	return 0;
+}
+
+/*
+ * qsort comparator putting SegmentEntry pointers in decreasing order of
+ * the number of exact TIDs they hold.
+ */
+static int
+tbm_density_comparator(const void *left, const void *right)
+{
+	int			l = (*((const SegmentEntry **) left))->npositions;
+	int			r = (*((const SegmentEntry **) right))->npositions;
+
+	if (l > r)
+		return -1;
+	else if (l < r)
+		return 1;
+	return 0;
+}
+
+/*
+ * seg_add_position - add one exact TID to a segment's container
  *
- * This may cause the table to exceed the desired memory size.	It is
- * up to the caller to call tbm_lossify() at the next safe point if so.
+ * The caller must have checked that the TID's page is not lossy.
  */
 static void
-tbm_mark_page_lossy(TIDBitmap *tbm, BlockNumber pageno)
+seg_add_position(TIDBitmap *tbm, SegmentEntry *seg, uint16 pos)
 {
-	PagetableEntry *page;
-	bool		found;
-	BlockNumber chunk_pageno;
-	int			bitno;
-	int			wordnum;
-	int			bitnum;
+	uint16	   *positions;
+	int			n = seg->npositions;
+	int			lo;
 
-	/* We force the bitmap into hashtable mode whenever it's lossy */
-	if (tbm->status != TBM_HASH)
-		tbm_create_pagetable(tbm);
+	if (seg->isbitmap)
+	{
+		bitmapword	bit = (bitmapword) 1 << BITNUM(pos);
 
-	bitno = pageno % PAGES_PER_CHUNK;
-	chunk_pageno = pageno - bitno;
+		if ((seg->c.words[WORDNUM(pos)] & bit) == 0)
+		{
+			seg->c.words[WORDNUM(pos)] |= bit;
+			seg->npositions++;
+		}
+		return;
+	}
 
 	/*
-	 * Remove any extant non-lossy entry for the page.	If the page is its own
-	 * chunk header, however, we skip this and handle the case below.
+	 * Find the insertion point.  Index scans often return TIDs in ascending
+	 * order, so check for appending at the end before doing a binary
+	 * search.
 	 */
-	if (bitno != 0)
+	positions = SEGMENT_POSITIONS(seg);
+	if (n == 0 || positions[n - 1] < pos)
+		lo = n;
+	else
 	{
-		if (hash_search(tbm->pagetable,
-						(void *) &pageno,
-						HASH_REMOVE, NULL) != NULL)
+		int			hi = n - 1;
+
+		lo = 0;
+		while (lo < hi)
 		{
-			/* It was present, so adjust counts */
-			tbm->nentries--;
-			tbm->npages--;		/* assume it must have been non-lossy */
+			int			mid = (lo + hi) / 2;
+
+			if (positions[mid] < pos)
+				lo = mid + 1;
+			else
+				hi = mid;
 		}
+		if (positions[lo] == pos)
+			return;				/* already present */
 	}
 
-	/* Look up or create entry for chunk-header page */
-	page = (PagetableEntry *) hash_search(tbm->pagetable,
-										  (void *) &chunk_pageno,
-										  HASH_ENTER, &found);
+	if (n >= seg->maxpositions)
+	{
+		if (n >= MAX_ARRAY_POSITIONS)
+		{
+			/* The array would get bigger than a bitmap, so switch over */
+			seg_convert_to_bitmap(tbm, seg);
+			seg->c.words[WORDNUM(pos)] |= (bitmapword) 1 << BITNUM(pos);
+			seg->npositions++;
+			return;
+		}
+		seg_grow_array(tbm, seg);
+		positions = SEGMENT_POSITIONS(seg);
+	}
 
-	/* Initialize it if not present before */
-	if (!found)
+	if (lo < n)
+		memmove(positions + lo + 1, positions + lo,
+				(n - lo) * sizeof(uint16));
+	positions[lo] = pos;
+	seg->npositions++;
+}
+
+/*
+ * seg_has_position - does a segment's container hold the given TID?
+ */
+static bool
+seg_has_position(const SegmentEntry *seg, uint16 pos)
+{
+	const uint16 *positions;
+	int			lo,
+				hi;
+
+	if (seg->isbitmap)
+		return (seg->c.words[WORDNUM(pos)] &
+				((bitmapword) 1 << BITNUM(pos))) != 0;
+
+	positions = SEGMENT_POSITIONS(seg);
+	lo = 0;
+	hi = seg->npositions - 1;
+	while (lo <= hi)
 	{
-		MemSet(page, 0, sizeof(PagetableEntry));
-		page->blockno = chunk_pageno;
-		page->ischunk = true;
-		/* must count it too */
-		tbm->nentries++;
-		tbm->nchunks++;
-	}
-	else if (!page->ischunk)
-	{
-		/* chunk header page was formerly non-lossy, make it lossy */
-		MemSet(page, 0, sizeof(PagetableEntry));
-		page->blockno = chunk_pageno;
-		page->ischunk = true;
-		/* we assume it had some tuple bit(s) set, so mark it lossy */
-		page->words[0] = ((bitmapword) 1 << 0);
-		/* adjust counts */
-		tbm->nchunks++;
-		tbm->npages--;
-	}
-
-	/* Now set the original target page's bit */
-	wordnum = WORDNUM(bitno);
-	bitnum = BITNUM(bitno);
-	page->words[wordnum] |= ((bitmapword) 1 << bitnum);
+		int			mid = (lo + hi) / 2;
+
+		if (positions[mid] < pos)
+			lo = mid + 1;
+		else if (positions[mid] > pos)
+			hi = mid - 1;
+		else
+			return true;
+	}
+	return false;
 }
 
 /*
- * tbm_lossify - lose some information to get back under the memory limit
+ * seg_get_positions - copy a segment's exact TIDs into an array
+ *
+ * The array must have room for seg->npositions entries; they are returned
+ * in ascending order.  Returns the number of entries stored.
+ */
+static int
+seg_get_positions(const SegmentEntry *seg, uint16 *positions)
+{
+	int			n = 0;
+	int			wordnum;
+
+	if (!seg->isbitmap)
+	{
+		memcpy(positions, SEGMENT_POSITIONS(seg),
+			   seg->npositions * sizeof(uint16));
+		return seg->npositions;
+	}
+
+	for (wordnum = 0; wordnum < WORDS_PER_CONTAINER; wordnum++)
+	{
+		bitmapword	w = seg->c.words[wordnum];
+		int			pos = wordnum * BITS_PER_BITMAPWORD;
+
+		while (w != 0)
+		{
+			if (w & 1)
+				positions[n++] = (uint16) pos;
+			pos++;
+			w >>= 1;
+		}
+	}
+	Assert(n == seg->npositions);
+	return n;
+}
+
+/*
+ * seg_set_positions - replace a segment's container
+ *
+ * The new contents are given as an ascending array of positions, which
+ * must not point into the old container.  The most compact kind of
+ * container is chosen for them.
  */
 static void
-tbm_lossify(TIDBitmap *tbm)
+seg_set_positions(TIDBitmap *tbm, SegmentEntry *seg,
+				  const uint16 *positions, int npositions)
 {
-	HASH_SEQ_STATUS status;
-	PagetableEntry *page;
+	seg_free_container(tbm, seg);
 
-	/*
-	 * XXX Really stupid implementation: this just lossifies pages in
-	 * essentially random order.  We should be paying some attention to the
-	 * number of bits set in each page, instead.  Also it might be a good idea
-	 * to lossify more than the minimum number of pages during each call.
-	 */
-	Assert(!tbm->iterating);
-	Assert(tbm->status == TBM_HASH);
+	if (npositions > MAX_ARRAY_POSITIONS)
+	{
+		bitmapword *words;
+		int			i;
+
+		words = (bitmapword *)
+			MemoryContextAllocZero(tbm->mcxt,
+								   WORDS_PER_CONTAINER * sizeof(bitmapword));
+		for (i = 0; i < npositions; i++)
+			words[WORDNUM(positions[i])] |=
+				(bitmapword) 1 << BITNUM(positions[i]);
+		tbm->nbytes += GetMemoryChunkSpace(words);
+		seg->c.words = words;
+		seg->isbitmap = true;
+	}
+	else if (npositions > INLINE_POSITIONS)
+	{
+		uint16	   *newpositions;
+
+		newpositions = (uint16 *)
+			MemoryContextAlloc(tbm->mcxt, npositions * sizeof(uint16));
+		memcpy(newpositions, positions, npositions * sizeof(uint16));
+		tbm->nbytes += GetMemoryChunkSpace(newpositions);
+		seg->c.positions = newpositions;
+		seg->maxpositions = npositions;
+	}
+	else if (npositions > 0)
+		memcpy(seg->c.inline_positions, positions,
+			   npositions * sizeof(uint16));
+
+	seg->npositions = npositions;
+}
+
+/*
+ * seg_exact_pages - compute the pages of a segment having exact TIDs
+ *
+ * pages is filled with a bitmap of WORDS_PER_SEGMENT words.
+ */
+static void
+seg_exact_pages(const SegmentEntry *seg, bitmapword *pages)
+{
+	MemSet(pages, 0, WORDS_PER_SEGMENT * sizeof(bitmapword));
+
+	if (seg->isbitmap)
+	{
+		int			wordnum;
+
+		for (wordnum = 0; wordnum < WORDS_PER_CONTAINER; wordnum++)
+		{
+			bitmapword	w = seg->c.words[wordnum];
+			int			pos = wordnum * BITS_PER_BITMAPWORD;
+
+			while (w != 0)
+			{
+				if (w & 1)
+				{
+					int			pageno = pos / MAX_TUPLES_PER_PAGE;
 
-	hash_seq_init(&status, tbm->pagetable);
-	while ((page = (PagetableEntry *) hash_seq_search(&status)) != NULL)
+					pages[WORDNUM(pageno)] |= PAGE_BIT(pageno);
+				}
+				pos++;
+				w >>= 1;
+			}
+		}
+	}
+	else
 	{
-		if (page->ischunk)
-			continue;			/* already a chunk header */
+		const uint16 *positions = SEGMENT_POSITIONS(seg);
+		int			i;
+
+		for (i = 0; i < seg->npositions; i++)
+		{
+			int			pageno = positions[i] / MAX_TUPLES_PER_PAGE;
+
+			pages[WORDNUM(pageno)] |= PAGE_BIT(pageno);
+		}
+	}
+}
 
-		/*
-		 * If the page would become a chunk header, we won't save anything by
-		 * converting it to lossy, so skip it.
-		 */
-		if ((page->blockno % PAGES_PER_CHUNK) == 0)
-			continue;
+/*
+ * seg_remove_pages - remove the exact TIDs of some pages of a segment
+ *
+ * pages is a bitmap of WORDS_PER_SEGMENT words.  The container is updated
+ * in place; we don't bother to switch it to a more compact kind.
+ */
+static void
+seg_remove_pages(SegmentEntry *seg, const bitmapword *pages)
+{
+	int			wordnum;
 
-		/* This does the dirty work ... */
-		tbm_mark_page_lossy(tbm, page->blockno);
+	if (seg->isbitmap)
+	{
+		int			pageno;
 
-		if (tbm->nentries <= tbm->maxentries)
+		for (pageno = 0; pageno < PAGES_PER_SEGMENT; pageno++)
 		{
-			/* we have done enough */
-			hash_seq_term(&status);
-			break;
+			int			pos;
+
+			if ((pages[WORDNUM(pageno)] & PAGE_BIT(pageno)) == 0)
+				continue;
+			for (pos = pageno * MAX_TUPLES_PER_PAGE;
+				 pos < (pageno + 1) * MAX_TUPLES_PER_PAGE;
+				 pos++)
+			{
+				bitmapword	bit = (bitmapword) 1 << BITNUM(pos);
+
+				if ((seg->c.words[WORDNUM(pos)] & bit) != 0)
+				{
+					seg->c.words[WORDNUM(pos)] &= ~bit;
+					seg->npositions--;
+				}
+			}
 		}
+	}
+	else
+	{
+		uint16	   *positions = SEGMENT_POSITIONS(seg);
+		int			n = 0;
+		int			i;
+
+		for (i = 0; i < seg->npositions; i++)
+		{
+			int			pageno = positions[i] / MAX_TUPLES_PER_PAGE;
 
-		/*
-		 * Note: tbm_mark_page_lossy may have inserted a lossy chunk into the
-		 * hashtable.  We can continue the same seq_search scan since we do
-		 * not care whether we visit lossy chunks or not.
-		 */
+			if ((pages[WORDNUM(pageno)] & PAGE_BIT(pageno)) == 0)
+				positions[n++] = positions[i];
+		}
+		seg->npositions = n;
 	}
+
+	for (wordnum = 0; wordnum < WORDS_PER_SEGMENT; wordnum++)
+		seg->recheck[wordnum] &= ~pages[wordnum];
 }
 
 /*
- * qsort comparator to handle PagetableEntry pointers.
+ * seg_make_lossy - make all the exact pages of a segment lossy
  */
-static int
-tbm_comparator(const void *left, const void *right)
+static void
+seg_make_lossy(TIDBitmap *tbm, SegmentEntry *seg)
 {
-	BlockNumber l = (*((const PagetableEntry **) left))->blockno;
-	BlockNumber r = (*((const PagetableEntry **) right))->blockno;
+	bitmapword	pages[WORDS_PER_SEGMENT];
+	int			wordnum;
 
-	if (l < r)
-		return -1;
-	else if (l > r)
-		return 1;
-	return 0;
+	seg_exact_pages(seg, pages);
+	for (wordnum = 0; wordnum < WORDS_PER_SEGMENT; wordnum++)
+	{
+		seg->lossy[wordnum] |= pages[wordnum];
+		seg->recheck[wordnum] = 0;
+	}
+	seg_free_container(tbm, seg);
+}
+
+/*
+ * seg_grow_array - enlarge a segment's array container
+ */
+static void
+seg_grow_array(TIDBitmap *tbm, SegmentEntry *seg)
+{
+	int			newmax = Min(seg->maxpositions * 2, MAX_ARRAY_POSITIONS);
+	uint16	   *newpositions;
+
+	Assert(!seg->isbitmap);
+	if (seg->maxpositions > INLINE_POSITIONS)
+	{
+		tbm->nbytes -= GetMemoryChunkSpace(seg->c.positions);
+		newpositions = (uint16 *) repalloc(seg->c.positions,
+										   newmax * sizeof(uint16));
+	}
+	else
+	{
+		newpositions = (uint16 *)
+			MemoryContextAlloc(tbm->mcxt, newmax * sizeof(uint16));
+		memcpy(newpositions, seg->c.inline_positions,
+			   seg->npositions * sizeof(uint16));
+	}
+	tbm->nbytes += GetMemoryChunkSpace(newpositions);
+	seg->c.positions = newpositions;
+	seg->maxpositions = newmax;
+}
+
+/*
+ * seg_convert_to_bitmap - switch a segment's array container to a bitmap
+ */
+static void
+seg_convert_to_bitmap(TIDBitmap *tbm, SegmentEntry *seg)
+{
+	uint16	   *positions = SEGMENT_POSITIONS(seg);
+	bitmapword *words;
+	int			i;
+
+	Assert(!seg->isbitmap);
+	words = (bitmapword *)
+		MemoryContextAllocZero(tbm->mcxt,
+							   WORDS_PER_CONTAINER * sizeof(bitmapword));
+	for (i = 0; i < seg->npositions; i++)
+		words[WORDNUM(positions[i])] |= (bitmapword) 1 << BITNUM(positions[i]);
+
+	if (seg->maxpositions > INLINE_POSITIONS)
+	{
+		tbm->nbytes -= GetMemoryChunkSpace(positions);
+		pfree(positions);
+	}
+	tbm->nbytes += GetMemoryChunkSpace(words);
+	seg->c.words = words;
+	seg->isbitmap = true;
+	seg->maxpositions = 0;
+}
+
+/*
+ * seg_free_container - release a segment's container, leaving it empty
+ */
+static void
+seg_free_container(TIDBitmap *tbm, SegmentEntry *seg)
+{
+	void	   *ptr = NULL;
+
+	if (seg->isbitmap)
+		ptr = seg->c.words;
+	else if (seg->maxpositions > INLINE_POSITIONS)
+		ptr = seg->c.positions;
+	if (ptr != NULL)
+	{
+		tbm->nbytes -= GetMemoryChunkSpace(ptr);
+		pfree(ptr);
+	}
+	seg->isbitmap = false;
+	seg->npositions = 0;
+	seg->maxpositions = INLINE_POSITIONS;
 }
@@ -17,6 +17,8 @@
 
 #include <math.h>
 
+#include "access/heapam.h"
+#include "catalog/partition.h"
 #include "nodes/nodeFuncs.h"
 #ifdef OPTIMIZER_DEBUG
 #include "nodes/print.h"
@@ -283,7 +285,12 @@ set_append_rel_pathlist(PlannerInfo *root, RelOptInfo *rel,
 						Index rti, RangeTblEntry *rte)
 {
 	int			parentRTindex = rti;
+	List	   *live_childrels = NIL;
 	List	   *subpaths = NIL;
+	List	   *all_child_pathkeys = NIL;
+	AppendPath *appendpath;
+	PartitionDesc partdesc = NULL;
+	Bitmapset  *live_parts = NULL;
 	double		parent_rows;
 	double		parent_size;
 	double	   *parent_attrsizes;
@@ -309,6 +316,29 @@ set_append_rel_pathlist(PlannerInfo *root, RelOptInfo *rel,
 	nattrs = rel->max_attr - rel->min_attr + 1;
 	parent_attrsizes = (double *) palloc0(nattrs * sizeof(double));
 
+	/*
+	 * If the parent is a partitioned table, find the partitions whose bounds
+	 * admit rows satisfying the restriction clauses.  That takes a binary
+	 * search over the bounds per clause, so we use it in place of proving
+	 * constraint exclusion for each partition.  Children that aren't
+	 * partitions of this parent (the parent itself, and grandchildren) are
+	 * still checked with constraint exclusion.
+	 */
+	if (rte->rtekind == RTE_RELATION &&
+		constraint_exclusion != CONSTRAINT_EXCLUSION_OFF)
+	{
+		Relation	parentrel = heap_open(rte->relid, NoLock);
+
+		partdesc = RelationBuildPartitionDesc(parentrel, NoLock, false);
+		heap_close(parentrel, NoLock);
+		rel->partdesc = partdesc;
+
+		if (partdesc != NULL)
+			live_parts = partition_prune_by_clauses(partdesc,
+								get_all_actual_clauses(rel->baserestrictinfo),
+													rel->relid);
+	}
+
 	/*
 	 * Generate access paths for each member relation, and pick the cheapest
 	 * path for each one.
@@ -324,6 +354,8 @@ set_append_rel_pathlist(PlannerInfo *root, RelOptInfo *rel,
 		Path	   *childpath;
 		ListCell   *parentvars;
 		ListCell   *childvars;
+		ListCell   *lcp;
+		int			partidx = -1;
 
 		/* append_rel_list contains all append rels; ignore others */
 		if (appinfo->parent_relid != parentRTindex)
@@ -339,6 +371,18 @@ set_append_rel_pathlist(PlannerInfo *root, RelOptInfo *rel,
 		childrel = find_base_rel(root, childRTindex);
 		Assert(childrel->reloptkind == RELOPT_OTHER_MEMBER_REL);
 
+		/*
+		 * A partition whose bounds can't match the restriction clauses is
+		 * excluded before we spend any effort on translating the clauses.
+		 */
+		if (partdesc != NULL)
+			partidx = partition_index_for_oid(partdesc, childRTE->relid);
+		if (partidx >= 0 && !bms_is_member(partidx, live_parts))
+		{
+			set_dummy_rel_pathlist(childrel);
+			continue;
+		}
+
 		/*
 		 * We have to copy the parent's targetlist and quals to the child,
 		 * with appropriate substitution of variables.	However, only the
@@ -374,7 +418,8 @@ set_append_rel_pathlist(PlannerInfo *root, RelOptInfo *rel,
 															childquals);
 		childrel->baserestrictinfo = childquals;
 
-		if (relation_excluded_by_constraints(root, childrel, childRTE))
+		if (partidx < 0 &&
+			relation_excluded_by_constraints(root, childrel, childRTE))
 		{
 			/*
 			 * This child need not be scanned, so we can omit it from the
@@ -385,7 +430,13 @@ set_append_rel_pathlist(PlannerInfo *root, RelOptInfo *rel,
 			continue;
 		}
 
-		/* CE failed, so finish copying targetlist and join quals */
+		/*
+		 * CE failed, so finish copying targetlist and join quals, and fetch
+		 * the catalog information that get_relation_info left for now.
+		 */
+		if (childRTE->rtekind == RTE_RELATION)
+			get_appendrel_member_info(root, childRTE->relid, childRTE->inh,
+									  childrel);
 		childrel->joininfo = (List *)
 			adjust_appendrel_attrs((Node *) rel->joininfo,
 								   appinfo);
@@ -395,13 +446,15 @@ set_append_rel_pathlist(PlannerInfo *root, RelOptInfo *rel,
 
 		/*
 		 * We have to make child entries in the EquivalenceClass data
-		 * structures as well.
+		 * structures as well.  This is needed either if the parent
+		 * participates in some eclass joins (because we will want to consider
+		 * inner-indexscan joins on the individual children) or if the parent
+		 * has useful pathkeys (because we should try to build MergeAppend
+		 * paths that produce those sort orderings).
 		 */
-		if (rel->has_eclass_joins)
-		{
+		if (rel->has_eclass_joins || has_useful_pathkeys(root, rel))
 			add_child_rel_equivalences(root, appinfo, rel, childrel);
-			childrel->has_eclass_joins = true;
-		}
+		childrel->has_eclass_joins = rel->has_eclass_joins;
 
 		/*
 		 * Note: we could compute appropriate attr_needed data for the child's
@@ -429,6 +482,41 @@ set_append_rel_pathlist(PlannerInfo *root, RelOptInfo *rel,
 		else
 			subpaths = lappend(subpaths, childpath);
 
+		live_childrels = lappend(live_childrels, childrel);
+
+		/*
+		 * Collect a list of all the available path orderings for all the
+		 * children.  We use this as a heuristic to indicate which sort
+		 * orderings we should build MergeAppend paths for.
+		 */
+		foreach(lcp, childrel->pathlist)
+		{
+			Path	   *path = (Path *) lfirst(lcp);
+			List	   *childkeys = path->pathkeys;
+			ListCell   *lpk;
+			bool		found = false;
+
+			/* Ignore orderings the parent can't make use of */
+			childkeys = truncate_useless_pathkeys(root, rel, childkeys);
+			if (childkeys == NIL)
+				continue;
+
+			/* Have we already seen this ordering? */
+			foreach(lpk, all_child_pathkeys)
+			{
+				List	   *existing_pathkeys = (List *) lfirst(lpk);
+
+				if (compare_pathkeys(existing_pathkeys,
+									 childkeys) == PATHKEYS_EQUAL)
+				{
+					found = true;
+					break;
+				}
+			}
+			if (!found)
+				all_child_pathkeys = lappend(all_child_pathkeys, childkeys);
+		}
+
 		/*
 		 * Accumulate size information from each child.
 		 */
@@ -483,16 +571,120 @@ set_append_rel_pathlist(PlannerInfo *root, RelOptInfo *rel,
 	pfree(parent_attrsizes);
 
 	/*
-	 * Finally, build Append path and install it as the only access path for
-	 * the parent rel.	(Note: this is correct even if we have zero or one
-	 * live subpath due to constraint exclusion.)
+	 * Next, build an unordered Append path for the rel.  (Note: this is
+	 * correct even if we have zero or one live subpath due to constraint
+	 * exclusion.)  Restriction clauses comparing the partition key with
+	 * Params let the executor skip more partitions, once it knows the
+	 * Params' values.
 	 */
-	add_path(rel, (Path *) create_append_path(rel, subpaths));
+	appendpath = create_append_path(rel, subpaths);
+	appendpath->partpruneclauses =
+		select_partition_prune_clauses(rel, rel->baserestrictinfo);
+	add_path(rel, (Path *) appendpath);
 
-	/* Select cheapest path (pretty easy in this case...) */
+	/*
+	 * Next, build MergeAppend paths based on the collected list of child
+	 * pathkeys.  We consider both cheapest-startup and cheapest-total cases,
+	 * ie, for each interesting ordering, collect all the cheapest startup
+	 * subpaths and all the cheapest total paths, and build a MergeAppend
+	 * path for each list.  Children lacking a suitably ordered path get
+	 * their cheapest-total path, to be sorted explicitly; add_path then
+	 * weighs the result against sorting the plain Append.
+	 */
+	foreach(l, all_child_pathkeys)
+	{
+		List	   *pathkeys = (List *) lfirst(l);
+		List	   *startup_subpaths = NIL;
+		List	   *total_subpaths = NIL;
+		bool		startup_neq_total = false;
+		ListCell   *lcr;
+
+		/* Select the child paths for this ordering... */
+		foreach(lcr, live_childrels)
+		{
+			RelOptInfo *childrel = (RelOptInfo *) lfirst(lcr);
+			Path	   *cheapest_startup,
+					   *cheapest_total;
+
+			/* Locate the right paths, if they are available. */
+			cheapest_startup =
+				get_cheapest_path_for_pathkeys(childrel->pathlist,
+											   pathkeys,
+											   STARTUP_COST);
+			cheapest_total =
+				get_cheapest_path_for_pathkeys(childrel->pathlist,
+											   pathkeys,
+											   TOTAL_COST);
+
+			/*
+			 * If we can't find any paths with the right order just add the
+			 * cheapest-total path; we'll have to sort it.
+			 */
+			if (cheapest_startup == NULL)
+				cheapest_startup = childrel->cheapest_total_path;
+			if (cheapest_total == NULL)
+				cheapest_total = childrel->cheapest_total_path;
+
+			/* Remember whether the two lists will differ at all */
+			if (cheapest_startup != cheapest_total)
+				startup_neq_total = true;
+
+			startup_subpaths = lappend(startup_subpaths, cheapest_startup);
+			total_subpaths = lappend(total_subpaths, cheapest_total);
+		}
+
+		/* ... and build the MergeAppend paths */
+		add_path(rel, (Path *) create_merge_append_path(root,
+														rel,
+														startup_subpaths,
+														pathkeys));
+		if (startup_neq_total)
+			add_path(rel, (Path *) create_merge_append_path(root,
+															rel,
+															total_subpaths,
+															pathkeys));
+	}
+
+	/* Select cheapest path */
 	set_cheapest(rel);
 }
 
+/*
+ * select_partition_prune_clauses
+ *	  Select the clauses among 'restrictinfos' with which an Append over
+ *	  the partitions of 'rel' can skip partitions at run time.
+ *
+ * These are the clauses comparing the partition key with an expression
+ * that isn't constant, but doesn't depend on 'rel' either; see
+ * partition_match_runtime_clause.  Returns NIL if 'rel' isn't partitioned.
+ */
+List *
+select_partition_prune_clauses(RelOptInfo *rel, List *restrictinfos)
+{
+	List	   *result = NIL;
+	ListCell   *lc;
+
+	if (rel->partdesc == NULL)
+		return NIL;
+
+	foreach(lc, restrictinfos)
+	{
+		RestrictInfo *rinfo = (RestrictInfo *) lfirst(lc);
+		int			strategy;
+		Expr	   *valexpr;
+
+		if (rinfo->pseudoconstant)
+			continue;
+		if (partition_match_runtime_clause(rel->partdesc,
+										   (Node *) rinfo->clause,
+										   rel->relid,
+										   &strategy, &valexpr))
+			result = lappend(result, rinfo);
+	}
+
+	return result;
+}
+
 /*
  * set_dummy_rel_pathlist
  *	  Build a dummy path for a relation that's been excluded by constraints
@@ -1385,6 +1577,9 @@ print_path(PlannerInfo *root, Path *path, int indent)
 		case T_AppendPath:
 			ptype = "Append";
 			break;
+		case T_MergeAppendPath:
+			ptype = "MergeAppend";
+			break;
 		case T_ResultPath:
 			ptype = "Result";
 			break;
@@ -70,6 +70,8 @@
 
 #include "executor/executor.h"
 #include "executor/nodeHash.h"
+#include "executor/nodeIncrementalSort.h"
+#include "executor/nodeMemoize.h"
 #include "miscadmin.h"
 #include "nodes/nodeFuncs.h"
 #include "optimizer/clauses.h"
@@ -109,9 +111,12 @@ Cost		disable_cost = 1.0e10;
 
 bool		enable_seqscan = true;
 bool		enable_indexscan = true;
+bool		enable_indexonlyscan = true;
 bool		enable_bitmapscan = true;
 bool		enable_tidscan = true;
 bool		enable_sort = true;
+bool		enable_incrementalsort = true;
+bool		enable_memoize = true;
 bool		enable_hashagg = true;
 bool		enable_nestloop = true;
 bool		enable_mergejoin = true;
@@ -126,8 +131,11 @@ typedef struct
 static MergeScanSelCache *cached_scansel(PlannerInfo *root,
 			   RestrictInfo *rinfo,
 			   PathKey *pathkey);
+static void cost_tuplesort(Cost *startup_cost, Cost *run_cost,
+			   double tuples, int width, double limit_tuples);
 static void cost_rescan(PlannerInfo *root, Path *path,
 			Cost *rescan_startup_cost, Cost *rescan_total_cost);
+static double nestloop_inner_path_rows(Path *path);
 static bool cost_qual_eval_walker(Node *node, cost_qual_eval_context *context);
 static bool adjust_semi_join(PlannerInfo *root, JoinPath *path,
 				 SpecialJoinInfo *sjinfo,
@@ -223,6 +231,9 @@ cost_seqscan(Path *path, PlannerInfo *root,
  *
  * NOTE: as of 8.0, indexQuals is a list of RestrictInfo nodes, where formerly
  * it was a list of bare clause expressions.
+ *
+ * If path->indexonly is set, heap fetches are only charged for the fraction
+ * of the table that isn't known all-visible.
  */
 void
 cost_index(IndexPath *path, PlannerInfo *root,
@@ -231,6 +242,7 @@ cost_index(IndexPath *path, PlannerInfo *root,
 		   RelOptInfo *outer_rel)
 {
 	RelOptInfo *baserel = index->rel;
+	bool		indexonly = path->indexonly;
 	Cost		startup_cost = 0;
 	Cost		run_cost = 0;
 	Cost		indexStartupCost;
@@ -309,6 +321,13 @@ cost_index(IndexPath *path, PlannerInfo *root,
 	 * For partially-correlated indexes, we ought to charge somewhere between
 	 * these two estimates.  We currently interpolate linearly between the
 	 * estimates based on the correlation squared (XXX is that appropriate?).
+	 *
+	 * If it's an index-only scan, then we will not need to fetch any heap
+	 * pages for which the visibility map shows all tuples are visible.
+	 * Hence, reduce the estimated number of heap fetches accordingly.
+	 * We use the measured fraction of the entire heap that is all-visible,
+	 * which might not be particularly relevant to the subset of the heap
+	 * that this query will fetch; but it's not clear how to do better.
 	 *----------
 	 */
 	if (outer_rel != NULL && outer_rel->rows > 1)
@@ -328,6 +347,9 @@ cost_index(IndexPath *path, PlannerInfo *root,
 											(double) index->pages,
 											root);
 
+		if (indexonly)
+			pages_fetched = ceil(pages_fetched * (1.0 - baserel->allvisfrac));
+
 		max_IO_cost = (pages_fetched * spc_random_page_cost) / num_scans;
 
 		/*
@@ -347,6 +369,9 @@ cost_index(IndexPath *path, PlannerInfo *root,
 											(double) index->pages,
 											root);
 
+		if (indexonly)
+			pages_fetched = ceil(pages_fetched * (1.0 - baserel->allvisfrac));
+
 		min_IO_cost = (pages_fetched * spc_random_page_cost) / num_scans;
 	}
 	else
@@ -360,14 +385,26 @@ cost_index(IndexPath *path, PlannerInfo *root,
 											(double) index->pages,
 											root);
 
+		if (indexonly)
+			pages_fetched = ceil(pages_fetched * (1.0 - baserel->allvisfrac));
+
 		/* max_IO_cost is for the perfectly uncorrelated case (csquared=0) */
 		max_IO_cost = pages_fetched * spc_random_page_cost;
 
 		/* min_IO_cost is for the perfectly correlated case (csquared=1) */
 		pages_fetched = ceil(indexSelectivity * (double) baserel->pages);
-		min_IO_cost = spc_random_page_cost;
-		if (pages_fetched > 1)
-			min_IO_cost += (pages_fetched - 1) * spc_seq_page_cost;
+
+		if (indexonly)
+			pages_fetched = ceil(pages_fetched * (1.0 - baserel->allvisfrac));
+
+		if (pages_fetched > 0 || !indexonly)
+		{
+			min_IO_cost = spc_random_page_cost;
+			if (pages_fetched > 1)
+				min_IO_cost += (pages_fetched - 1) * spc_seq_page_cost;
+		}
+		else
+			min_IO_cost = 0;
 	}
 
 	/*
@@ -1113,13 +1150,41 @@ cost_sort(Path *path, PlannerInfo *root,
 {
 	Cost		startup_cost = input_cost;
 	Cost		run_cost = 0;
-	double		input_bytes = relation_byte_size(tuples, width);
+	Cost		sort_startup_cost;
+	Cost		sort_run_cost;
+
+	if (!enable_sort)
+		startup_cost += disable_cost;
+
+	cost_tuplesort(&sort_startup_cost, &sort_run_cost,
+				   tuples, width, limit_tuples);
+	startup_cost += sort_startup_cost;
+	run_cost += sort_run_cost;
+
+	path->startup_cost = startup_cost;
+	path->total_cost = startup_cost + run_cost;
+}
+
+/*
+ * cost_tuplesort
+ *	  Determines the cost of sorting 'tuples' tuples with tuplesort.c,
+ *	  not counting the cost of producing them.
+ *
+ * This is the part of cost_sort's estimate that doesn't depend on the
+ * input plan; see there for the model.  The sorting itself is charged to
+ * *startup_cost and reading back the result to *run_cost.
+ */
+static void
+cost_tuplesort(Cost *startup_cost, Cost *run_cost,
+			   double tuples, int width, double limit_tuples)
+{
+	double		input_bytes;
 	double		output_bytes;
 	double		output_tuples;
 	long		work_mem_bytes = work_mem * 1024L;
 
-	if (!enable_sort)
-		startup_cost += disable_cost;
+	*startup_cost = 0;
+	*run_cost = 0;
 
 	/*
 	 * We want to be sure the cost of a sort is never estimated as zero, even
@@ -1127,6 +1192,7 @@ cost_sort(Path *path, PlannerInfo *root,
 	 */
 	if (tuples < 2.0)
 		tuples = 2.0;
+	input_bytes = relation_byte_size(tuples, width);
 
 	/* Do we have a useful LIMIT? */
 	if (limit_tuples > 0 && limit_tuples < tuples)
@@ -1157,7 +1223,7 @@ cost_sort(Path *path, PlannerInfo *root,
 		 * Assume about two operator evals per tuple comparison and N log2 N
 		 * comparisons
 		 */
-		startup_cost += 2.0 * cpu_operator_cost * tuples * LOG2(tuples);
+		*startup_cost += 2.0 * cpu_operator_cost * tuples * LOG2(tuples);
 
 		/* Disk costs */
 
@@ -1168,7 +1234,7 @@ cost_sort(Path *path, PlannerInfo *root,
 			log_runs = 1.0;
 		npageaccesses = 2.0 * npages * log_runs;
 		/* Assume 3/4ths of accesses are sequential, 1/4th are not */
-		startup_cost += npageaccesses *
+		*startup_cost += npageaccesses *
 			(seq_page_cost * 0.75 + random_page_cost * 0.25);
 	}
 	else if (tuples > 2 * output_tuples || input_bytes > work_mem_bytes)
@@ -1179,12 +1245,12 @@ cost_sort(Path *path, PlannerInfo *root,
 		 * factor is a bit higher than for quicksort.  Tweak it so that the
 		 * cost curve is continuous at the crossover point.
 		 */
-		startup_cost += 2.0 * cpu_operator_cost * tuples * LOG2(2.0 * output_tuples);
+		*startup_cost += 2.0 * cpu_operator_cost * tuples * LOG2(2.0 * output_tuples);
 	}
 	else
 	{
 		/* We'll use plain quicksort on all the input tuples */
-		startup_cost += 2.0 * cpu_operator_cost * tuples * LOG2(tuples);
+		*startup_cost += 2.0 * cpu_operator_cost * tuples * LOG2(tuples);
 	}
 
 	/*
@@ -1195,12 +1261,230 @@ cost_sort(Path *path, PlannerInfo *root,
 	 * here --- the upper LIMIT will pro-rate the run cost so we'd be double
 	 * counting the LIMIT otherwise.
 	 */
-	run_cost += cpu_operator_cost * tuples;
+	*run_cost += cpu_operator_cost * tuples;
+}
+
+/*
+ * cost_incremental_sort
+ *	  Determines and returns the cost of sorting a relation that is already
+ *	  sorted on the first 'presorted_keys' of 'pathkeys', including the
+ *	  cost of reading the input data.
+ *
+ * The input is sorted in batches, each holding one or more whole groups of
+ * tuples with equal presorted keys and at least INCSORT_MIN_GROUP tuples
+ * (see nodeIncrementalSort.c).  We estimate the number of groups from the
+ * presorted key expressions and assume they are all of the same size.
+ * Only the first batch has to be read and sorted before the first tuple is
+ * returned, so that is all the startup cost includes; the other batches
+ * are paid for as we go.  We also charge one operator eval per presorted
+ * key per input tuple for detecting the group boundaries.
+ *
+ * 'input_startup_cost' and 'input_total_cost' are the input path's costs;
+ * the other arguments are as for cost_sort.  The sort bound applies only to
+ * the first batch, so 'limit_tuples' is just passed through to costing it.
+ */
+void
+cost_incremental_sort(Path *path, PlannerInfo *root,
+					  List *pathkeys, int presorted_keys,
+					  Cost input_startup_cost, Cost input_total_cost,
+					  double tuples, int width, double limit_tuples)
+{
+	Cost		startup_cost = input_startup_cost;
+	Cost		run_cost = 0;
+	Cost		input_run_cost = input_total_cost - input_startup_cost;
+	Cost		batch_startup_cost;
+	Cost		batch_run_cost;
+	List	   *presortedExprs = NIL;
+	ListCell   *l;
+	int			keyno = 0;
+	double		ngroups;
+	double		batch_tuples;
+	double		nbatches;
+
+	Assert(presorted_keys > 0);
+
+	if (!enable_incrementalsort)
+		startup_cost += disable_cost;
+
+	if (tuples < 2.0)
+		tuples = 2.0;
+
+	/* Collect one expression for each presorted key to estimate groups */
+	foreach(l, pathkeys)
+	{
+		PathKey    *pathkey = (PathKey *) lfirst(l);
+		ListCell   *lc;
+
+		if (keyno++ >= presorted_keys)
+			break;
+
+		foreach(lc, pathkey->pk_eclass->ec_members)
+		{
+			EquivalenceMember *em = (EquivalenceMember *) lfirst(lc);
+
+			if (em->em_is_const || em->em_is_child)
+				continue;
+			presortedExprs = lappend(presortedExprs, em->em_expr);
+			break;
+		}
+	}
+
+	ngroups = estimate_num_groups(root, presortedExprs, tuples);
+	batch_tuples = Max(tuples / ngroups, (double) INCSORT_MIN_GROUP);
+	batch_tuples = Min(batch_tuples, tuples);
+	nbatches = ceil(tuples / batch_tuples);
+
+	cost_tuplesort(&batch_startup_cost, &batch_run_cost,
+				   batch_tuples, width, limit_tuples);
+
+	/* Reading and sorting the first batch is all we need to get started */
+	startup_cost += input_run_cost * (batch_tuples / tuples) +
+		batch_startup_cost;
+	run_cost += input_run_cost * (1.0 - batch_tuples / tuples);
+
+	/*
+	 * Each later batch is sorted in turn; all are read back.  Charge a
+	 * cpu_tuple_cost per batch for setting up and tearing down its sort.
+	 */
+	run_cost += (nbatches - 1) * batch_startup_cost +
+		nbatches * (batch_run_cost + cpu_tuple_cost);
+
+	/* Group boundary detection */
+	run_cost += cpu_operator_cost * presorted_keys * tuples;
+
+	list_free(presortedExprs);
 
 	path->startup_cost = startup_cost;
 	path->total_cost = startup_cost + run_cost;
 }
 
+/*
+ * cost_merge_append
+ *	  Determines and returns the cost of a MergeAppend node.
+ *
+ * MergeAppend merges several pre-sorted input streams, using a heap that
+ * at any given instant holds the next tuple from each stream.  If there
+ * are N streams, we need about N*log2(N) tuple comparisons to construct
+ * the heap at startup, and then for each output tuple, about log2(N)
+ * comparisons to replace the top entry.
+ *
+ * (The effective value of N will drop once some of the input streams are
+ * exhausted, but it seems unlikely to be worth trying to account for that.)
+ *
+ * The heap is never spilled to disk, since we assume N is not very large.
+ * So this is much simpler than cost_sort.
+ *
+ * As in cost_sort, we charge two operator evals per tuple comparison.
+ *
+ * 'pathkeys' is a list of sort keys
+ * 'n_streams' is the number of input streams
+ * 'input_startup_cost' is the sum of the input streams' startup costs
+ * 'input_total_cost' is the sum of the input streams' total costs
+ * 'tuples' is the number of tuples in all the streams
+ */
+void
+cost_merge_append(Path *path, PlannerInfo *root,
+				  List *pathkeys, int n_streams,
+				  Cost input_startup_cost, Cost input_total_cost,
+				  double tuples)
+{
+	Cost		startup_cost = 0;
+	Cost		run_cost = 0;
+	Cost		comparison_cost;
+	double		N;
+	double		logN;
+
+	/*
+	 * Avoid log(0)...
+	 */
+	N = (n_streams < 2) ? 2.0 : (double) n_streams;
+	logN = LOG2(N);
+
+	/* Assumed cost per tuple comparison */
+	comparison_cost = 2.0 * cpu_operator_cost;
+
+	/* Heap creation cost */
+	startup_cost += comparison_cost * N * logN;
+
+	/* Per-tuple heap maintenance cost */
+	run_cost += tuples * comparison_cost * logN;
+
+	/*
+	 * Also charge a small amount (arbitrarily set equal to operator cost) per
+	 * extracted tuple.  As for Sort, we don't charge cpu_tuple_cost because
+	 * MergeAppend doesn't do qual-checking or projection.
+	 */
+	run_cost += cpu_operator_cost * tuples;
+
+	path->startup_cost = startup_cost + input_startup_cost;
+	path->total_cost = startup_cost + run_cost + input_total_cost;
+}
+
+/*
+ * cost_memoize
+ *	  Determines and returns the cost of caching the results of a nestloop
+ *	  inner path with a Memoize node, and estimates how well the cache
+ *	  will work.
+ *
+ * The path's costs are for the first scan, which never finds anything in
+ * the cache: the subpath's cost plus hashing the key and copying the rows
+ * into the cache.  The savings occur on rescan; see cost_rescan.
+ *
+ * Among 'calls' rescans with 'ndistinct' distinct keys, all but the first
+ * scan for each key could be hits.  If fewer than ndistinct entries fit in
+ * work_mem, we assume that only the fraction of keys that fit are cached
+ * at any time, since the order in which the outer rel presents its values
+ * is unknown.
+ */
+void
+cost_memoize(MemoizePath *path, PlannerInfo *root)
+{
+	Path	   *subpath = path->subpath;
+	double		tuples = nestloop_inner_path_rows(subpath);
+	int			width = path->path.parent->width;
+	int			nkeys = list_length(path->param_exprs);
+	double		calls = Max(path->calls, 1.0);
+	int			keywidth = 0;
+	double		ndistinct;
+	double		entry_bytes;
+	double		max_entries;
+	ListCell   *lc;
+	Cost		startup_cost = 0;
+	Cost		run_cost = 0;
+
+	if (!enable_memoize)
+		startup_cost += disable_cost;
+
+	ndistinct = estimate_num_groups(root, path->param_exprs, calls);
+	ndistinct = clamp_row_est(Min(ndistinct, calls));
+
+	/*
+	 * An entry holds the key and the rows.  Estimate its size the way the
+	 * executor will count it, including the palloc overhead of every row.
+	 */
+	foreach(lc, path->param_exprs)
+	{
+		Node	   *expr = (Node *) lfirst(lc);
+
+		keywidth += get_typavgwidth(exprType(expr), exprTypmod(expr));
+	}
+	entry_bytes = memoize_entry_size(tuples, width, keywidth);
+	max_entries = floor(work_mem * 1024.0 / entry_bytes);
+
+	path->est_entries = Min(ndistinct, max_entries);
+	path->hit_ratio = ((calls - ndistinct) / calls) *
+		(path->est_entries / ndistinct);
+
+	/* hash and look up the key */
+	startup_cost += cpu_operator_cost * nkeys;
+
+	/* copy each row into the cache, much as cost_material charges */
+	run_cost += cpu_operator_cost * tuples;
+
+	path->path.startup_cost = startup_cost + subpath->startup_cost;
+	path->path.total_cost = startup_cost + run_cost + subpath->total_cost;
+}
+
 /*
  * cost_material
  *	  Determines and returns the cost of materializing a relation, including
@@ -1397,7 +1681,8 @@ cost_group(Path *path, PlannerInfo *root,
  * output row count, which may be lower than the restriction-clause-only row
  * count of its parent.  (We don't include this case in the PATH_ROWS macro
  * because it applies *only* to a nestloop's inner relation.)  We have to
- * be prepared to recurse through Append nodes in case of an appendrel.
+ * be prepared to recurse through Append nodes in case of an appendrel, and
+ * through a Memoize caching the indexscan's results.
  */
 static double
 nestloop_inner_path_rows(Path *path)
@@ -1408,6 +1693,8 @@ nestloop_inner_path_rows(Path *path)
 		result = ((IndexPath *) path)->rows;
 	else if (IsA(path, BitmapHeapPath))
 		result = ((BitmapHeapPath *) path)->rows;
+	else if (IsA(path, MemoizePath))
+		result = nestloop_inner_path_rows(((MemoizePath *) path)->subpath);
 	else if (IsA(path, AppendPath))
 	{
 		ListCell   *l;
@@ -2418,6 +2705,36 @@ cost_rescan(PlannerInfo *root, Path *path,
 				*rescan_total_cost = run_cost;
 			}
 			break;
+		case T_Memoize:
+			{
+				/*
+				 * A hit costs the key lookup plus returning the cached rows,
+				 * which we charge like a Material rescan.  A miss costs the
+				 * lookup plus a rescan of the subpath, copying its rows into
+				 * the cache as they go by.
+				 */
+				MemoizePath *mpath = (MemoizePath *) path;
+				double		tuples = nestloop_inner_path_rows(mpath->subpath);
+				Cost		lookup_cost;
+				Cost		sub_startup_cost;
+				Cost		sub_total_cost;
+				Cost		miss_run_cost;
+				Cost		hit_run_cost;
+
+				cost_rescan(root, mpath->subpath,
+							&sub_startup_cost, &sub_total_cost);
+				lookup_cost = cpu_operator_cost * list_length(mpath->param_exprs);
+				hit_run_cost = cpu_operator_cost * tuples;
+				miss_run_cost = sub_total_cost - sub_startup_cost +
+					cpu_operator_cost * tuples;
+
+				*rescan_startup_cost = lookup_cost +
+					(1.0 - mpath->hit_ratio) * sub_startup_cost;
+				*rescan_total_cost = *rescan_startup_cost +
+					mpath->hit_ratio * hit_run_cost +
+					(1.0 - mpath->hit_ratio) * miss_run_cost;
+			}
+			break;
 		default:
 			*rescan_startup_cost = path->startup_cost;
 			*rescan_total_cost = path->total_cost;
@@ -58,6 +58,8 @@ static bool reconsider_outer_join_clause(PlannerInfo *root,
 							 bool outer_on_left);
 static bool reconsider_full_join_clause(PlannerInfo *root,
 							RestrictInfo *rinfo);
+static List *find_eclass_join_clauses(PlannerInfo *root, RelOptInfo *rel,
+						 Relids outer_relids, bool indexcols_only);
 
 
 /*
@@ -1611,8 +1613,9 @@ exprs_known_equal(PlannerInfo *root, Node *item1, Node *item2)
  *	  Search for EC members that reference (only) the parent_rel, and
  *	  add transformed members referencing the child_rel.
  *
- * We only need to do this for ECs that could generate join conditions,
- * since the child members are only used for creating inner-indexscan paths.
+ * The child members are used for creating inner-indexscan paths, and for
+ * matching the child rels' index orderings to the parent's pathkeys so that
+ * presorted child scans can be merged.
  *
  * parent_rel and child_rel could be derived from appinfo, but since the
  * caller has already computed them, we might as well just pass them in.
@@ -1631,10 +1634,14 @@ add_child_rel_equivalences(PlannerInfo *root,
 		ListCell   *lc2;
 
 		/*
-		 * Won't generate joinclauses if const or single-member (the latter
-		 * test covers the volatile case too)
+		 * If this EC contains a constant, then it's not useful for sorting or
+		 * driving an inner index-scan, so we skip generating child EMs.
+		 *
+		 * If this EC contains a volatile expression, then generating child
+		 * EMs would be downright dangerous.  We rely on a volatile EC having
+		 * only one EM.
 		 */
-		if (cur_ec->ec_has_const || list_length(cur_ec->ec_members) <= 1)
+		if (cur_ec->ec_has_const || cur_ec->ec_has_volatile)
 			continue;
 
 		/* No point in searching if parent rel not mentioned in eclass */
@@ -1645,6 +1652,14 @@ add_child_rel_equivalences(PlannerInfo *root,
 		{
 			EquivalenceMember *cur_em = (EquivalenceMember *) lfirst(lc2);
 
+			/*
+			 * Child members, including those added for earlier children,
+			 * can't match; skipping them cheaply matters when there are
+			 * thousands of children.
+			 */
+			if (cur_em->em_is_child)
+				continue;
+
 			/* Does it reference (only) parent_rel? */
 			if (bms_equal(cur_em->em_relids, parent_rel->relids))
 			{
@@ -1708,6 +1723,30 @@ mutate_eclass_expressions(PlannerInfo *root,
 List *
 find_eclass_clauses_for_index_join(PlannerInfo *root, RelOptInfo *rel,
 								   Relids outer_relids)
+{
+	return find_eclass_join_clauses(root, rel, outer_relids, true);
+}
+
+/*
+ * find_eclass_clauses_for_join
+ *	  Likewise, but create a joinclause for every member expression of the
+ *	  inner rel, whether or not an index could use it.
+ */
+List *
+find_eclass_clauses_for_join(PlannerInfo *root, RelOptInfo *rel,
+							 Relids outer_relids)
+{
+	return find_eclass_join_clauses(root, rel, outer_relids, false);
+}
+
+/*
+ * find_eclass_join_clauses
+ *	  Workhorse for the above.  If indexcols_only, only members matching
+ *	  an index of the inner rel are considered.
+ */
+static List *
+find_eclass_join_clauses(PlannerInfo *root, RelOptInfo *rel,
+						 Relids outer_relids, bool indexcols_only)
 {
 	List	   *result = NIL;
 	bool		is_child_rel = (rel->reloptkind == RELOPT_OTHER_MEMBER_REL);
@@ -1745,7 +1784,8 @@ find_eclass_clauses_for_index_join(PlannerInfo *root, RelOptInfo *rel,
 			ListCell   *lc3;
 
 			if (!bms_equal(cur_em->em_relids, rel->relids) ||
-				!eclass_matches_any_index(cur_ec, cur_em, rel))
+				(indexcols_only &&
+				 !eclass_matches_any_index(cur_ec, cur_em, rel)))
 				continue;
 
 			/*
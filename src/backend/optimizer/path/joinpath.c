@@ -36,6 +36,8 @@ static void hash_inner_and_outer(PlannerInfo *root, RelOptInfo *joinrel,
 					 JoinType jointype, SpecialJoinInfo *sjinfo);
 static Path *best_appendrel_indexscan(PlannerInfo *root, RelOptInfo *rel,
 						 RelOptInfo *outer_rel, JoinType jointype);
+static List *appendrel_join_prune_clauses(PlannerInfo *root, RelOptInfo *rel,
+							 RelOptInfo *outer_rel, JoinType jointype);
 static List *select_mergejoin_clauses(PlannerInfo *root,
 						 RelOptInfo *joinrel,
 						 RelOptInfo *outerrel,
@@ -386,6 +388,7 @@ match_unsorted_outer(PlannerInfo *root,
 	Path	   *matpath = NULL;
 	Path	   *index_cheapest_startup = NULL;
 	Path	   *index_cheapest_total = NULL;
+	Path	   *index_memoized = NULL;
 	ListCell   *l;
 
 	/*
@@ -460,6 +463,18 @@ match_unsorted_outer(PlannerInfo *root,
 									 &index_cheapest_startup,
 									 &index_cheapest_total);
 		}
+
+		/*
+		 * Consider caching the innerjoin indexscan's results for each set
+		 * of outer values it depends on.  This is useless for semi and anti
+		 * joins, which stop each inner scan at the first match, so the
+		 * cache entries would never be completed.
+		 */
+		if (index_cheapest_total != NULL &&
+			jointype != JOIN_SEMI && jointype != JOIN_ANTI)
+			index_memoized = (Path *)
+				create_memoize_path(root, innerrel, index_cheapest_total,
+									outerrel);
 	}
 
 	foreach(l, outerrel->pathlist)
@@ -502,7 +517,7 @@ match_unsorted_outer(PlannerInfo *root,
 			 * cheapest-total-cost inner.  When appropriate, also consider
 			 * using the materialized form of the cheapest inner, the
 			 * cheapest-startup-cost inner path, and the cheapest innerjoin
-			 * indexpaths.
+			 * indexpaths, plain and memoized.
 			 */
 			add_path(joinrel, (Path *)
 					 create_nestloop_path(root,
@@ -554,6 +569,16 @@ match_unsorted_outer(PlannerInfo *root,
 											  index_cheapest_startup,
 											  restrictlist,
 											  merge_pathkeys));
+			if (index_memoized != NULL)
+				add_path(joinrel, (Path *)
+						 create_nestloop_path(root,
+											  joinrel,
+											  jointype,
+											  sjinfo,
+											  outerpath,
+											  index_memoized,
+											  restrictlist,
+											  merge_pathkeys));
 		}
 
 		/* Can't do anything else if outer path needs to be unique'd */
@@ -904,6 +929,7 @@ best_appendrel_indexscan(PlannerInfo *root, RelOptInfo *rel,
 	int			parentRTindex = rel->relid;
 	List	   *append_paths = NIL;
 	bool		found_indexscan = false;
+	AppendPath *appendpath;
 	ListCell   *l;
 
 	foreach(l, root->append_rel_list)
@@ -952,8 +978,58 @@ best_appendrel_indexscan(PlannerInfo *root, RelOptInfo *rel,
 	if (!found_indexscan)
 		return NULL;
 
-	/* Form and return the completed Append path. */
-	return (Path *) create_append_path(rel, append_paths);
+	/*
+	 * Form and return the completed Append path.  The join clauses that
+	 * restrict the partition key let the executor skip the partitions that
+	 * can't match each outer row.
+	 */
+	appendpath = create_append_path(rel, append_paths);
+	if (rel->partdesc != NULL)
+		appendpath->partpruneclauses =
+			appendrel_join_prune_clauses(root, rel, outer_rel, jointype);
+	return (Path *) appendpath;
+}
+
+/*
+ * appendrel_join_prune_clauses
+ *	  Find the join clauses with which an Append scanning the partitions of
+ *	  'rel' on the inner side of a nestloop can skip partitions for each
+ *	  outer row.
+ *
+ * This collects the same clauses as find_clauses_for_join does, except
+ * that clauses derived from EquivalenceClasses are wanted whether or not
+ * the parent rel has an index on the column; it usually has none.
+ */
+static List *
+appendrel_join_prune_clauses(PlannerInfo *root, RelOptInfo *rel,
+							 RelOptInfo *outer_rel, JoinType jointype)
+{
+	bool		isouterjoin = (jointype == JOIN_LEFT ||
+							   jointype == JOIN_ANTI);
+	List	   *clause_list = NIL;
+	Relids		join_relids;
+	ListCell   *l;
+
+	join_relids = bms_union(rel->relids, outer_rel->relids);
+	foreach(l, rel->joininfo)
+	{
+		RestrictInfo *rinfo = (RestrictInfo *) lfirst(l);
+
+		/* Can't use pushed-down join clauses in outer join */
+		if (isouterjoin && rinfo->is_pushed_down)
+			continue;
+		if (!bms_is_subset(rinfo->required_relids, join_relids))
+			continue;
+		clause_list = lappend(clause_list, rinfo);
+	}
+	bms_free(join_relids);
+
+	if (!isouterjoin && rel->has_eclass_joins)
+		clause_list = list_concat(clause_list,
+								  find_eclass_clauses_for_join(root, rel,
+															outer_rel->relids));
+
+	return select_partition_prune_clauses(rel, clause_list);
 }
 
 /*
@@ -23,6 +23,7 @@
 #include "nodes/nodeFuncs.h"
 #include "nodes/plannodes.h"
 #include "optimizer/clauses.h"
+#include "optimizer/cost.h"
 #include "optimizer/pathnode.h"
 #include "optimizer/paths.h"
 #include "optimizer/tlist.h"
@@ -388,6 +389,31 @@ pathkeys_contained_in(List *keys1, List *keys2)
 	return false;
 }
 
+/*
+ * pathkeys_common_prefix
+ *	  Return the number of leading pathkeys that keys1 and keys2 share.
+ *
+ * If keys2 is the ordering of a path and keys1 a required ordering, this is
+ * how many of the required keys the path already provides, which is what an
+ * incremental sort can exploit.
+ */
+int
+pathkeys_common_prefix(List *keys1, List *keys2)
+{
+	int			n = 0;
+	ListCell   *key1,
+			   *key2;
+
+	/* See compare_pathkeys for why pointer comparison is enough */
+	forboth(key1, keys1, key2, keys2)
+	{
+		if (lfirst(key1) != lfirst(key2))
+			break;
+		n++;
+	}
+	return n;
+}
+
 /*
  * get_cheapest_path_for_pathkeys
  *	  Find the cheapest path (according to the specified criterion) that
@@ -571,7 +597,7 @@ find_indexkey_var(PlannerInfo *root, RelOptInfo *rel, AttrNumber varattno)
 	}
 
 	relid = rel->relid;
-	reloid = getrelid(relid, root->parse->rtable);
+	reloid = planner_rt_fetch(relid, root)->relid;
 	get_atttypetypmod(reloid, varattno, &vartypeid, &type_mod);
 
 	return makeVar(relid, varattno, vartypeid, type_mod, 0);
@@ -1443,9 +1469,10 @@ right_merge_direction(PlannerInfo *root, PathKey *pathkey)
  *		Count the number of pathkeys that are useful for meeting the
  *		query's requested output ordering.
  *
- * Unlike merge pathkeys, this is an all-or-nothing affair: it does us
- * no good to order by just the first key(s) of the requested ordering.
- * So the result is always either 0 or list_length(root->query_pathkeys).
+ * A path ordered by just the first key(s) of the requested ordering is
+ * useful too, if incremental sorts are enabled, since an incremental sort
+ * on top of it is cheaper than a full sort.  So we return the number of
+ * leading query_pathkeys the path provides.
  */
 int
 pathkeys_useful_for_ordering(PlannerInfo *root, List *pathkeys)
@@ -1462,6 +1489,9 @@ pathkeys_useful_for_ordering(PlannerInfo *root, List *pathkeys)
 		return list_length(root->query_pathkeys);
 	}
 
+	if (enable_incrementalsort)
+		return pathkeys_common_prefix(root->query_pathkeys, pathkeys);
+
 	return 0;					/* path ordering not useful */
 }
 
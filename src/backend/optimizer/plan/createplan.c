@@ -20,10 +20,12 @@
 #include <math.h>
 
 #include "access/skey.h"
+#include "catalog/partition.h"
 #include "nodes/makefuncs.h"
 #include "nodes/nodeFuncs.h"
 #include "optimizer/clauses.h"
 #include "optimizer/cost.h"
+#include "optimizer/paths.h"
 #include "optimizer/plancat.h"
 #include "optimizer/planmain.h"
 #include "optimizer/predtest.h"
@@ -42,8 +44,11 @@ static void disuse_physical_tlist(Plan *plan, Path *path);
 static Plan *create_gating_plan(PlannerInfo *root, Plan *plan, List *quals);
 static Plan *create_join_plan(PlannerInfo *root, JoinPath *best_path);
 static Plan *create_append_plan(PlannerInfo *root, AppendPath *best_path);
+static Plan *create_merge_append_plan(PlannerInfo *root,
+						 MergeAppendPath *best_path);
 static Result *create_result_plan(PlannerInfo *root, ResultPath *best_path);
 static Material *create_material_plan(PlannerInfo *root, MaterialPath *best_path);
+static Memoize *create_memoize_plan(PlannerInfo *root, MemoizePath *best_path);
 static Plan *create_unique_plan(PlannerInfo *root, UniquePath *best_path);
 static SeqScan *create_seqscan_plan(PlannerInfo *root, Path *best_path,
 					List *tlist, List *scan_clauses);
@@ -80,7 +85,7 @@ static void copy_plan_costsize(Plan *dest, Plan *src);
 static SeqScan *make_seqscan(List *qptlist, List *qpqual, Index scanrelid);
 static IndexScan *make_indexscan(List *qptlist, List *qpqual, Index scanrelid,
 			   Oid indexid, List *indexqual, List *indexqualorig,
-			   ScanDirection indexscandir);
+			   ScanDirection indexscandir, bool indexonly);
 static BitmapIndexScan *make_bitmap_indexscan(Index scanrelid, Oid indexid,
 					  List *indexqual,
 					  List *indexqualorig);
@@ -125,10 +130,19 @@ static MergeJoin *make_mergejoin(List *tlist,
 			   bool *mergenullsfirst,
 			   Plan *lefttree, Plan *righttree,
 			   JoinType jointype);
+static Plan *prepare_sort_from_pathkeys(PlannerInfo *root, Plan *lefttree,
+						   List *pathkeys, Relids relids,
+						   bool adjust_tlist_in_place,
+						   int *p_numsortkeys,
+						   AttrNumber **p_sortColIdx,
+						   Oid **p_sortOperators,
+						   bool **p_nullsFirst);
 static Sort *make_sort(PlannerInfo *root, Plan *lefttree, int numCols,
 		  AttrNumber *sortColIdx, Oid *sortOperators, bool *nullsFirst,
 		  double limit_tuples);
 static Material *make_material(Plan *lefttree);
+static Memoize *make_memoize(Plan *lefttree, List *paramExprs,
+			 List *hashOperators, long estEntries);
 
 
 /*
@@ -174,6 +188,10 @@ create_plan(PlannerInfo *root, Path *best_path)
 			plan = create_append_plan(root,
 									  (AppendPath *) best_path);
 			break;
+		case T_MergeAppend:
+			plan = create_merge_append_plan(root,
+											(MergeAppendPath *) best_path);
+			break;
 		case T_Result:
 			plan = (Plan *) create_result_plan(root,
 											   (ResultPath *) best_path);
@@ -182,6 +200,10 @@ create_plan(PlannerInfo *root, Path *best_path)
 			plan = (Plan *) create_material_plan(root,
 												 (MaterialPath *) best_path);
 			break;
+		case T_Memoize:
+			plan = (Plan *) create_memoize_plan(root,
+												(MemoizePath *) best_path);
+			break;
 		case T_Unique:
 			plan = create_unique_plan(root,
 									  (UniquePath *) best_path);
@@ -214,9 +236,12 @@ create_scan_plan(PlannerInfo *root, Path *best_path)
 	 * tlist containing all Vars in order.	This will allow the executor to
 	 * optimize away projection of the table tuples, if possible.  (Note that
 	 * planner.c may replace the tlist we generate here, forcing projection to
-	 * occur.)
+	 * occur.)  An index-only scan can't supply columns that aren't in the
+	 * index, so it must stick to the Vars actually needed.
 	 */
-	if (use_physical_tlist(root, rel))
+	if (use_physical_tlist(root, rel) &&
+		!(best_path->pathtype == T_IndexScan &&
+		  ((IndexPath *) best_path)->indexonly))
 	{
 		tlist = build_physical_tlist(root, rel);
 		/* if fail because of dropped cols, use regular method */
@@ -576,9 +601,140 @@ create_append_plan(PlannerInfo *root, AppendPath *best_path)
 
 	plan = make_append(subplans, tlist);
 
+	/*
+	 * Pass on what the executor needs to skip partitions at run time.  The
+	 * clauses were matched by select_partition_prune_clauses, so they all
+	 * match again here.
+	 */
+	if (best_path->partpruneclauses != NIL)
+	{
+		RelOptInfo *rel = best_path->path.parent;
+		ListCell   *l;
+
+		foreach(l, best_path->partpruneclauses)
+		{
+			RestrictInfo *rinfo = (RestrictInfo *) lfirst(l);
+			int			strategy;
+			Expr	   *valexpr;
+
+			if (!partition_match_runtime_clause(rel->partdesc,
+												(Node *) rinfo->clause,
+												rel->relid,
+												&strategy, &valexpr))
+				elog(ERROR, "partition pruning clause does not match the partition key");
+			plan->partprunestrategies = lappend_int(plan->partprunestrategies,
+													strategy);
+			plan->partpruneexprs = lappend(plan->partpruneexprs, valexpr);
+		}
+
+		plan->partrelid = planner_rt_fetch(rel->relid, root)->relid;
+		foreach(subpaths, best_path->subpaths)
+		{
+			RelOptInfo *childrel = ((Path *) lfirst(subpaths))->parent;
+			Oid			childrelid = InvalidOid;
+
+			if (childrel->rtekind == RTE_RELATION)
+				childrelid = planner_rt_fetch(childrel->relid, root)->relid;
+			plan->partoids = lappend_oid(plan->partoids, childrelid);
+		}
+	}
+
 	return (Plan *) plan;
 }
 
+/*
+ * create_merge_append_plan
+ *	  Create a MergeAppend plan for 'best_path' and (recursively) plans
+ *	  for its subpaths.
+ *
+ *	  Returns a Plan node.
+ */
+static Plan *
+create_merge_append_plan(PlannerInfo *root, MergeAppendPath *best_path)
+{
+	MergeAppend *node = makeNode(MergeAppend);
+	Plan	   *plan = &node->plan;
+	List	   *tlist = build_relation_tlist(best_path->path.parent);
+	List	   *pathkeys = best_path->path.pathkeys;
+	List	   *subplans = NIL;
+	ListCell   *subpaths;
+
+	/*
+	 * We don't have the actual creation of the MergeAppend node split out
+	 * into a separate make_xxx function.  This is because we want to run
+	 * prepare_sort_from_pathkeys on it before we do so on the individual
+	 * child plans, to make cross-checking the sort info easier.
+	 */
+	copy_path_costsize(plan, (Path *) best_path);
+	plan->targetlist = tlist;
+	plan->qual = NIL;
+	plan->lefttree = NULL;
+	plan->righttree = NULL;
+
+	/* Compute sort column info, and adjust MergeAppend's tlist as needed */
+	(void) prepare_sort_from_pathkeys(root, plan, pathkeys,
+									  NULL,
+									  true,
+									  &node->numCols,
+									  &node->sortColIdx,
+									  &node->sortOperators,
+									  &node->nullsFirst);
+
+	/*
+	 * Now prepare the child plans.  We must apply prepare_sort_from_pathkeys
+	 * even to subplans that don't need an explicit sort, to make sure they
+	 * are returning the same sort key columns the MergeAppend expects.
+	 */
+	foreach(subpaths, best_path->subpaths)
+	{
+		Path	   *subpath = (Path *) lfirst(subpaths);
+		Plan	   *subplan;
+		int			numsortkeys;
+		AttrNumber *sortColIdx;
+		Oid		   *sortOperators;
+		bool	   *nullsFirst;
+
+		/* Build the child plan */
+		subplan = create_plan(root, subpath);
+
+		/* Compute sort column info, and adjust subplan's tlist as needed */
+		subplan = prepare_sort_from_pathkeys(root, subplan, pathkeys,
+											 subpath->parent->relids,
+											 false,
+											 &numsortkeys,
+											 &sortColIdx,
+											 &sortOperators,
+											 &nullsFirst);
+
+		/*
+		 * Check that we got the same sort key information.  We just Assert
+		 * that the sortops match, since those depend only on the pathkeys;
+		 * but it seems like a good idea to check the sort column numbers
+		 * explicitly, to ensure the tlists really do match up.
+		 */
+		Assert(numsortkeys == node->numCols);
+		if (memcmp(sortColIdx, node->sortColIdx,
+				   numsortkeys * sizeof(AttrNumber)) != 0)
+			elog(ERROR, "MergeAppend child's targetlist doesn't match MergeAppend");
+		Assert(memcmp(sortOperators, node->sortOperators,
+					  numsortkeys * sizeof(Oid)) == 0);
+		Assert(memcmp(nullsFirst, node->nullsFirst,
+					  numsortkeys * sizeof(bool)) == 0);
+
+		/* Now, insert a Sort node if subplan isn't sufficiently ordered */
+		if (!pathkeys_contained_in(pathkeys, subpath->pathkeys))
+			subplan = (Plan *) make_sort(root, subplan, numsortkeys,
+										 sortColIdx, sortOperators, nullsFirst,
+										 -1.0);
+
+		subplans = lappend(subplans, subplan);
+	}
+
+	node->mergeplans = subplans;
+
+	return (Plan *) node;
+}
+
 /*
  * create_result_plan
  *	  Create a Result plan for 'best_path'.
@@ -628,6 +784,34 @@ create_material_plan(PlannerInfo *root, MaterialPath *best_path)
 	return plan;
 }
 
+/*
+ * create_memoize_plan
+ *	  Create a Memoize plan for 'best_path' and (recursively) plans
+ *	  for its subpaths.
+ *
+ *	  Returns a Plan node.
+ */
+static Memoize *
+create_memoize_plan(PlannerInfo *root, MemoizePath *best_path)
+{
+	Memoize    *plan;
+	Plan	   *subplan;
+
+	subplan = create_plan(root, best_path->subpath);
+
+	/* We don't want any excess columns in the cached tuples */
+	disuse_physical_tlist(subplan, best_path->subpath);
+
+	plan = make_memoize(subplan,
+						(List *) copyObject(best_path->param_exprs),
+						best_path->hash_operators,
+						(long) best_path->est_entries);
+
+	copy_path_costsize(&plan->plan, (Path *) best_path);
+
+	return plan;
+}
+
 /*
  * create_unique_plan
  *	  Create a Unique plan for 'best_path' and (recursively) plans
@@ -968,7 +1152,8 @@ create_indexscan_plan(PlannerInfo *root,
 							   indexoid,
 							   fixed_indexquals,
 							   stripped_indexquals,
-							   best_path->indexscandir);
+							   best_path->indexscandir,
+							   best_path->indexonly);
 
 	copy_path_costsize(&scan_plan->scan.plan, &best_path->path);
 	/* use the indexscan-specific rows estimate, not the parent rel's */
@@ -2419,7 +2604,8 @@ make_indexscan(List *qptlist,
 			   Oid indexid,
 			   List *indexqual,
 			   List *indexqualorig,
-			   ScanDirection indexscandir)
+			   ScanDirection indexscandir,
+			   bool indexonly)
 {
 	IndexScan  *node = makeNode(IndexScan);
 	Plan	   *plan = &node->scan.plan;
@@ -2434,6 +2620,7 @@ make_indexscan(List *qptlist,
 	node->indexqual = indexqual;
 	node->indexqualorig = indexqualorig;
 	node->indexorderdir = indexscandir;
+	node->indexonly = indexonly;
 
 	return node;
 }
@@ -2657,6 +2844,10 @@ make_append(List *appendplans, List *tlist)
 	plan->lefttree = NULL;
 	plan->righttree = NULL;
 	node->appendplans = appendplans;
+	node->partrelid = InvalidOid;
+	node->partprunestrategies = NIL;
+	node->partpruneexprs = NIL;
+	node->partoids = NIL;
 
 	return node;
 }
@@ -2934,26 +3125,46 @@ add_sort_column(AttrNumber colIdx, Oid sortOp, bool nulls_first,
 }
 
 /*
- * make_sort_from_pathkeys
- *	  Create sort plan to sort according to given pathkeys
+ * prepare_sort_from_pathkeys
+ *	  Prepare to sort according to given pathkeys
+ *
+ * This is used to set up for both Sort and MergeAppend nodes.  It calculates
+ * the executor's representation of the sort key information, and adjusts the
+ * plan targetlist if needed to add resjunk sort columns.
  *
+ * Input parameters:
  *	  'lefttree' is the node which yields input tuples
  *	  'pathkeys' is the list of pathkeys by which the result is to be sorted
- *	  'limit_tuples' is the bound on the number of output tuples;
- *				-1 if no bound
+ *	  'relids' identifies the child relation being sorted, if any
+ *	  'adjust_tlist_in_place' is TRUE if lefttree must be modified in-place
  *
  * We must convert the pathkey information into arrays of sort key column
- * numbers and sort operator OIDs.
+ * numbers and sort operator OIDs, which is passed back to the caller.
  *
  * If the pathkeys include expressions that aren't simple Vars, we will
  * usually need to add resjunk items to the input plan's targetlist to
- * compute these expressions (since the Sort node itself won't do it).
- * If the input plan type isn't one that can do projections, this means
- * adding a Result node just to do the projection.
+ * compute these expressions, since the Sort/MergeAppend node itself won't
+ * do any such calculations.  If the input plan type isn't one that can do
+ * projections, this means adding a Result node just to do the projection.
+ * However, the caller can pass adjust_tlist_in_place = TRUE to force the
+ * lefttree tlist to be modified in-place regardless of whether the node type
+ * can project --- we use this for fixing the tlist of MergeAppend itself.
+ *
+ * When sorting a member rel of an appendrel, 'relids' must be its relids,
+ * so that the EquivalenceClass members translated for it can be used;
+ * otherwise pass NULL, and child members are ignored.
+ *
+ * Returns the node which is to be the input to the Sort (either lefttree,
+ * or a Result stacked atop lefttree).
  */
-Sort *
-make_sort_from_pathkeys(PlannerInfo *root, Plan *lefttree, List *pathkeys,
-						double limit_tuples)
+static Plan *
+prepare_sort_from_pathkeys(PlannerInfo *root, Plan *lefttree, List *pathkeys,
+						   Relids relids,
+						   bool adjust_tlist_in_place,
+						   int *p_numsortkeys,
+						   AttrNumber **p_sortColIdx,
+						   Oid **p_sortOperators,
+						   bool **p_nullsFirst)
 {
 	List	   *tlist = lefttree->targetlist;
 	ListCell   *i;
@@ -3017,7 +3228,15 @@ make_sort_from_pathkeys(PlannerInfo *root, Plan *lefttree, List *pathkeys,
 			{
 				EquivalenceMember *em = (EquivalenceMember *) lfirst(j);
 
-				if (em->em_is_const || em->em_is_child)
+				if (em->em_is_const)
+					continue;
+
+				/*
+				 * Ignore child members unless they belong to the rel being
+				 * sorted.
+				 */
+				if (em->em_is_child &&
+					!bms_equal(em->em_relids, relids))
 					continue;
 
 				tle = tlist_member((Node *) em->em_expr, tlist);
@@ -3053,7 +3272,10 @@ make_sort_from_pathkeys(PlannerInfo *root, Plan *lefttree, List *pathkeys,
 					List	   *exprvars;
 					ListCell   *k;
 
-					if (em->em_is_const || em->em_is_child)
+					if (em->em_is_const)
+						continue;
+					if (em->em_is_child &&
+						!bms_equal(em->em_relids, relids))
 						continue;
 					sortexpr = em->em_expr;
 					exprvars = pull_var_clause((Node *) sortexpr,
@@ -3076,7 +3298,8 @@ make_sort_from_pathkeys(PlannerInfo *root, Plan *lefttree, List *pathkeys,
 				/*
 				 * Do we need to insert a Result node?
 				 */
-				if (!is_projection_capable_plan(lefttree))
+				if (!adjust_tlist_in_place &&
+					!is_projection_capable_plan(lefttree))
 				{
 					/* copy needed so we don't modify input's tlist below */
 					tlist = copyObject(tlist);
@@ -3124,10 +3347,113 @@ make_sort_from_pathkeys(PlannerInfo *root, Plan *lefttree, List *pathkeys,
 
 	Assert(numsortkeys > 0);
 
+	/* Return results */
+	*p_numsortkeys = numsortkeys;
+	*p_sortColIdx = sortColIdx;
+	*p_sortOperators = sortOperators;
+	*p_nullsFirst = nullsFirst;
+
+	return lefttree;
+}
+
+/*
+ * make_sort_from_pathkeys
+ *	  Create sort plan to sort according to given pathkeys
+ *
+ *	  'lefttree' is the node which yields input tuples
+ *	  'pathkeys' is the list of pathkeys by which the result is to be sorted
+ *	  'limit_tuples' is the bound on the number of output tuples;
+ *				-1 if no bound
+ */
+Sort *
+make_sort_from_pathkeys(PlannerInfo *root, Plan *lefttree, List *pathkeys,
+						double limit_tuples)
+{
+	int			numsortkeys;
+	AttrNumber *sortColIdx;
+	Oid		   *sortOperators;
+	bool	   *nullsFirst;
+
+	/* Compute sort column info, and adjust lefttree as needed */
+	lefttree = prepare_sort_from_pathkeys(root, lefttree, pathkeys,
+										  NULL,
+										  false,
+										  &numsortkeys,
+										  &sortColIdx,
+										  &sortOperators,
+										  &nullsFirst);
+
+	/* Now build the Sort node */
 	return make_sort(root, lefttree, numsortkeys,
 					 sortColIdx, sortOperators, nullsFirst, limit_tuples);
 }
 
+/*
+ * make_incrementalsort_from_pathkeys
+ *	  Create an incremental sort plan to sort according to given pathkeys,
+ *	  for an input already sorted by the first presorted_keys of them.
+ *
+ * Arguments are otherwise as for make_sort_from_pathkeys.
+ */
+IncrementalSort *
+make_incrementalsort_from_pathkeys(PlannerInfo *root, Plan *lefttree,
+								   List *pathkeys, int presorted_keys,
+								   double limit_tuples)
+{
+	IncrementalSort *node = makeNode(IncrementalSort);
+	Plan	   *plan = &node->sort.plan;
+	Path		sort_path;		/* dummy for result of cost_incremental_sort */
+	int			numsortkeys;
+	AttrNumber *sortColIdx;
+	Oid		   *sortOperators;
+	bool	   *nullsFirst;
+
+	Assert(presorted_keys > 0 && presorted_keys < list_length(pathkeys));
+
+	/*
+	 * Work out the columns of the presorted keys first.  There can be fewer
+	 * of them than presorted_keys if some are duplicates.  Any resjunk
+	 * columns this adds are found again by the second call, which fills in
+	 * the remaining keys in the same order.
+	 */
+	lefttree = prepare_sort_from_pathkeys(root, lefttree,
+										  list_truncate(list_copy(pathkeys),
+														presorted_keys),
+										  NULL,
+										  false,
+										  &node->presortedCols,
+										  &sortColIdx,
+										  &sortOperators,
+										  &nullsFirst);
+	lefttree = prepare_sort_from_pathkeys(root, lefttree, pathkeys,
+										  NULL,
+										  false,
+										  &numsortkeys,
+										  &sortColIdx,
+										  &sortOperators,
+										  &nullsFirst);
+
+	cost_incremental_sort(&sort_path, root, pathkeys, presorted_keys,
+						  lefttree->startup_cost,
+						  lefttree->total_cost,
+						  lefttree->plan_rows,
+						  lefttree->plan_width,
+						  limit_tuples);
+	copy_plan_costsize(plan, lefttree); /* only care about copying size */
+	plan->startup_cost = sort_path.startup_cost;
+	plan->total_cost = sort_path.total_cost;
+	plan->targetlist = lefttree->targetlist;
+	plan->qual = NIL;
+	plan->lefttree = lefttree;
+	plan->righttree = NULL;
+	node->sort.numCols = numsortkeys;
+	node->sort.sortColIdx = sortColIdx;
+	node->sort.sortOperators = sortOperators;
+	node->sort.nullsFirst = nullsFirst;
+
+	return node;
+}
+
 /*
  * make_sort_from_sortclauses
  *	  Create sort plan to sort according to given sortclauses
@@ -3252,6 +3578,32 @@ make_material(Plan *lefttree)
 	return node;
 }
 
+static Memoize *
+make_memoize(Plan *lefttree, List *paramExprs, List *hashOperators,
+			 long estEntries)
+{
+	Memoize    *node = makeNode(Memoize);
+	Plan	   *plan = &node->plan;
+	ListCell   *l;
+	int			i;
+
+	/* cost should be inserted by caller */
+	plan->targetlist = lefttree->targetlist;
+	plan->qual = NIL;
+	plan->lefttree = lefttree;
+	plan->righttree = NULL;
+
+	node->numKeys = list_length(paramExprs);
+	node->hashOperators = (Oid *) palloc(node->numKeys * sizeof(Oid));
+	i = 0;
+	foreach(l, hashOperators)
+		node->hashOperators[i++] = lfirst_oid(l);
+	node->paramExprs = paramExprs;
+	node->estEntries = estEntries;
+
+	return node;
+}
+
 /*
  * materialize_finished_plan: stick a Material node atop a completed plan
  *
@@ -3823,13 +4175,16 @@ is_projection_capable_plan(Plan *plan)
 	{
 		case T_Hash:
 		case T_Material:
+		case T_Memoize:
 		case T_Sort:
+		case T_IncrementalSort:
 		case T_Unique:
 		case T_SetOp:
 		case T_LockRows:
 		case T_Limit:
 		case T_ModifyTable:
 		case T_Append:
+		case T_MergeAppend:
 		case T_RecursiveUnion:
 			return false;
 		default:
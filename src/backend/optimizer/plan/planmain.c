@@ -54,7 +54,10 @@
  * Output parameters:
  * *cheapest_path receives the overall-cheapest path for the query
  * *sorted_path receives the cheapest presorted path for the query,
- *				if any (NULL if there is no useful presorted path)
+ *				if any (NULL if there is no useful presorted path).  For a
+ *				plain ORDER BY this may be sorted on only a leading part
+ *				of the required pathkeys, to be finished by an incremental
+ *				sort.
  * *num_groups receives the estimated number of groups, or 1 if query
  *				does not use grouping
  *
@@ -92,6 +95,7 @@ query_planner(PlannerInfo *root, List *tlist,
 	RelOptInfo *final_rel;
 	Path	   *cheapestpath;
 	Path	   *sortedpath;
+	Path		sort_path;		/* dummy for result of cost_sort */
 	Index		rti;
 	ListCell   *lc;
 	double		total_pages;
@@ -390,33 +394,88 @@ query_planner(PlannerInfo *root, List *tlist,
 	 * cheapest-total path.  Here we need consider only the behavior at the
 	 * tuple fraction point.
 	 */
-	if (sortedpath)
+	if (root->query_pathkeys == NIL ||
+		pathkeys_contained_in(root->query_pathkeys,
+							  cheapestpath->pathkeys))
 	{
-		Path		sort_path;	/* dummy for result of cost_sort */
+		/* No sort needed for cheapest path */
+		sort_path.startup_cost = cheapestpath->startup_cost;
+		sort_path.total_cost = cheapestpath->total_cost;
+	}
+	else
+	{
+		/* Figure cost for sorting */
+		cost_sort(&sort_path, root, root->query_pathkeys,
+				  cheapestpath->total_cost,
+				  final_rel->rows, final_rel->width,
+				  limit_tuples);
+	}
 
-		if (root->query_pathkeys == NIL ||
-			pathkeys_contained_in(root->query_pathkeys,
-								  cheapestpath->pathkeys))
-		{
-			/* No sort needed for cheapest path */
-			sort_path.startup_cost = cheapestpath->startup_cost;
-			sort_path.total_cost = cheapestpath->total_cost;
-		}
-		else
-		{
-			/* Figure cost for sorting */
-			cost_sort(&sort_path, root, root->query_pathkeys,
-					  cheapestpath->total_cost,
-					  final_rel->rows, final_rel->width,
-					  limit_tuples);
-		}
+	if (sortedpath &&
+		compare_fractional_path_costs(sortedpath, &sort_path,
+									  tuple_fraction) > 0)
+	{
+		/* Presorted path is a loser */
+		sortedpath = NULL;
+	}
+
+	/*
+	 * For a plain ORDER BY query, a path sorted on just a leading part of
+	 * the required pathkeys may also do, since grouping_planner can finish
+	 * it off with an incremental sort.  Pick the best such path and keep it
+	 * as the presorted path if the incremental sort on top of it beats both
+	 * the presorted path found above and sorting the cheapest-total path.
+	 * That is most likely under a LIMIT, where the incremental sort needs
+	 * to read only the first few groups.  We skip the cheapest-total path
+	 * here; grouping_planner considers an incremental sort for it anyway.
+	 *
+	 * With grouping, aggregation, window functions or DISTINCT the
+	 * query_pathkeys serve some other step, which needs its input fully
+	 * sorted, so we don't bother there.
+	 */
+	if (enable_incrementalsort &&
+		root->query_pathkeys != NIL &&
+		parse->sortClause && !parse->groupClause && !parse->hasAggs &&
+		!root->hasHavingQual && !parse->hasWindowFuncs &&
+		!parse->distinctClause)
+	{
+		Path	   *partialpath = NULL;
+		Path		partial_sort_path;	/* cost of sorting partialpath */
+		int			nkeys = list_length(root->query_pathkeys);
 
-		if (compare_fractional_path_costs(sortedpath, &sort_path,
-										  tuple_fraction) > 0)
+		foreach(lc, final_rel->pathlist)
 		{
-			/* Presorted path is a loser */
-			sortedpath = NULL;
+			Path	   *path = (Path *) lfirst(lc);
+			Path		incsort_path;	/* dummy for cost_incremental_sort */
+			int			presorted_keys;
+
+			if (path == cheapestpath)
+				continue;
+			presorted_keys = pathkeys_common_prefix(root->query_pathkeys,
+													path->pathkeys);
+			if (presorted_keys == 0 || presorted_keys >= nkeys)
+				continue;
+
+			cost_incremental_sort(&incsort_path, root, root->query_pathkeys,
+								  presorted_keys,
+								  path->startup_cost, path->total_cost,
+								  final_rel->rows, final_rel->width,
+								  limit_tuples);
+			if (partialpath == NULL ||
+				compare_fractional_path_costs(&incsort_path,
+											  &partial_sort_path,
+											  tuple_fraction) < 0)
+			{
+				partialpath = path;
+				partial_sort_path = incsort_path;
+			}
 		}
+
+		if (partialpath &&
+			compare_fractional_path_costs(&partial_sort_path,
+										  sortedpath ? sortedpath : &sort_path,
+										  tuple_fraction) < 0)
+			sortedpath = partialpath;
 	}
 
 	*cheapest_path = cheapestpath;
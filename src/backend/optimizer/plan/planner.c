@@ -81,6 +81,9 @@ static bool choose_hashed_distinct(PlannerInfo *root,
 					   Cost sorted_startup_cost, Cost sorted_total_cost,
 					   List *sorted_pathkeys,
 					   double dNumDistinctRows);
+static bool choose_incremental_sort(PlannerInfo *root,
+						double tuple_fraction, double limit_tuples,
+						Plan *input_plan, int presorted_keys);
 static List *make_subplanTargetList(PlannerInfo *root, List *tlist,
 					   AttrNumber **groupColIdx, bool *need_tlist_eval);
 static void locate_grouping_columns(PlannerInfo *root,
@@ -1652,10 +1655,28 @@ grouping_planner(PlannerInfo *root, double tuple_fraction)
 	{
 		if (!pathkeys_contained_in(root->sort_pathkeys, current_pathkeys))
 		{
-			result_plan = (Plan *) make_sort_from_pathkeys(root,
-														   result_plan,
+			/*
+			 * If the plan is already sorted on a leading part of the ORDER
+			 * BY, it may be cheaper to sort just within each group of equal
+			 * leading keys.
+			 */
+			int			presorted_keys;
+
+			presorted_keys = pathkeys_common_prefix(root->sort_pathkeys,
+													current_pathkeys);
+			if (choose_incremental_sort(root, tuple_fraction, limit_tuples,
+										result_plan, presorted_keys))
+				result_plan = (Plan *)
+					make_incrementalsort_from_pathkeys(root,
+													   result_plan,
+													   root->sort_pathkeys,
+													   presorted_keys,
+													   limit_tuples);
+			else
+				result_plan = (Plan *) make_sort_from_pathkeys(root,
+															   result_plan,
 														 root->sort_pathkeys,
-														   limit_tuples);
+															   limit_tuples);
 			current_pathkeys = root->sort_pathkeys;
 		}
 	}
@@ -2476,6 +2497,46 @@ choose_hashed_distinct(PlannerInfo *root,
 	return false;
 }
 
+/*
+ * choose_incremental_sort - should we use an incremental sort for ORDER BY?
+ *
+ * input_plan delivers its output sorted on the first presorted_keys of
+ * root->sort_pathkeys.  Compare an incremental sort on top of it against
+ * a full sort, at the expected tuple fraction.
+ *
+ * Returns TRUE to select the incremental sort, FALSE for a full sort.
+ */
+static bool
+choose_incremental_sort(PlannerInfo *root,
+						double tuple_fraction, double limit_tuples,
+						Plan *input_plan, int presorted_keys)
+{
+	Path		incsort_p;		/* dummy for result of cost_incremental_sort */
+	Path		sort_p;			/* dummy for result of cost_sort */
+
+	if (!enable_incrementalsort || presorted_keys == 0)
+		return false;
+
+	cost_incremental_sort(&incsort_p, root, root->sort_pathkeys,
+						  presorted_keys,
+						  input_plan->startup_cost, input_plan->total_cost,
+						  input_plan->plan_rows, input_plan->plan_width,
+						  limit_tuples);
+	cost_sort(&sort_p, root, root->sort_pathkeys, input_plan->total_cost,
+			  input_plan->plan_rows, input_plan->plan_width,
+			  limit_tuples);
+
+	/*
+	 * Now make the decision using the top-level tuple fraction.  First we
+	 * have to convert an absolute count (LIMIT) into fractional form.
+	 */
+	if (tuple_fraction >= 1.0 && input_plan->plan_rows > 0)
+		tuple_fraction /= input_plan->plan_rows;
+
+	return compare_fractional_path_costs(&incsort_p, &sort_p,
+										 tuple_fraction) <= 0;
+}
+
 /*
  * make_subplanTargetList
  *	  Generate appropriate target list when grouping is required.
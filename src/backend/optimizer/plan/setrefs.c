@@ -407,6 +407,7 @@ set_plan_refs(PlannerGlobal *glob, Plan *plan, int rtoffset)
 		case T_Hash:
 		case T_Material:
 		case T_Sort:
+		case T_IncrementalSort:
 		case T_Unique:
 		case T_SetOp:
 
@@ -425,6 +426,21 @@ set_plan_refs(PlannerGlobal *glob, Plan *plan, int rtoffset)
 			 */
 			Assert(plan->qual == NIL);
 			break;
+		case T_Memoize:
+			{
+				Memoize    *mplan = (Memoize *) plan;
+
+				/*
+				 * Like Material, but the cache key expressions need fixing
+				 * too.  Their references to the nestloop's outer rel were
+				 * already set by set_inner_join_references.
+				 */
+				set_dummy_tlist_references(plan, rtoffset);
+				Assert(plan->qual == NIL);
+				mplan->paramExprs =
+					fix_scan_list(glob, mplan->paramExprs, rtoffset);
+			}
+			break;
 		case T_LockRows:
 			{
 				LockRows   *splan = (LockRows *) plan;
@@ -544,10 +560,13 @@ set_plan_refs(PlannerGlobal *glob, Plan *plan, int rtoffset)
 
 				/*
 				 * Append, like Sort et al, doesn't actually evaluate its
-				 * targetlist or check quals.
+				 * targetlist or check quals.  It does evaluate its partition
+				 * pruning expressions, though.
 				 */
 				set_dummy_tlist_references(plan, rtoffset);
 				Assert(splan->plan.qual == NIL);
+				splan->partpruneexprs =
+					fix_scan_list(glob, splan->partpruneexprs, rtoffset);
 				foreach(l, splan->appendplans)
 				{
 					lfirst(l) = set_plan_refs(glob,
@@ -556,6 +575,24 @@ set_plan_refs(PlannerGlobal *glob, Plan *plan, int rtoffset)
 				}
 			}
 			break;
+		case T_MergeAppend:
+			{
+				MergeAppend *splan = (MergeAppend *) plan;
+
+				/*
+				 * MergeAppend, like Sort et al, doesn't actually evaluate its
+				 * targetlist or check quals.
+				 */
+				set_dummy_tlist_references(plan, rtoffset);
+				Assert(splan->plan.qual == NIL);
+				foreach(l, splan->mergeplans)
+				{
+					lfirst(l) = set_plan_refs(glob,
+											  (Plan *) lfirst(l),
+											  rtoffset);
+				}
+			}
+			break;
 		case T_RecursiveUnion:
 			/* This doesn't evaluate targetlist or check quals either */
 			set_dummy_tlist_references(plan, rtoffset);
@@ -1168,11 +1205,35 @@ set_inner_join_references(PlannerGlobal *glob, Plan *inner_plan,
 		Append	   *appendplan = (Append *) inner_plan;
 		ListCell   *l;
 
+		/* Partition pruning expressions may refer to the outer rel, too */
+		appendplan->partpruneexprs = fix_join_expr(glob,
+												   appendplan->partpruneexprs,
+												   outer_itlist,
+												   NULL,
+												   (Index) 0,
+												   0);
+
 		foreach(l, appendplan->appendplans)
 		{
 			set_inner_join_references(glob, (Plan *) lfirst(l), outer_itlist);
 		}
 	}
+	else if (IsA(inner_plan, Memoize))
+	{
+		/*
+		 * The cache key consists of outer-rel Vars; fix them, then recurse
+		 * to the indexscan whose results are cached.
+		 */
+		Memoize    *mplan = (Memoize *) inner_plan;
+
+		mplan->paramExprs = fix_join_expr(glob,
+										  mplan->paramExprs,
+										  outer_itlist,
+										  NULL,
+										  (Index) 0,
+										  0);
+		set_inner_join_references(glob, mplan->plan.lefttree, outer_itlist);
+	}
 	else if (IsA(inner_plan, Result))
 	{
 		/* Recurse through a gating Result node (similar to Append case) */
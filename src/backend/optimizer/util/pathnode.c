@@ -18,10 +18,12 @@
 
 #include "catalog/pg_operator.h"
 #include "miscadmin.h"
+#include "nodes/nodeFuncs.h"
 #include "optimizer/clauses.h"
 #include "optimizer/cost.h"
 #include "optimizer/pathnode.h"
 #include "optimizer/paths.h"
+#include "optimizer/restrictinfo.h"
 #include "optimizer/tlist.h"
 #include "optimizer/var.h"
 #include "parser/parse_expr.h"
@@ -29,11 +31,14 @@
 #include "utils/selfuncs.h"
 #include "utils/lsyscache.h"
 #include "utils/syscache.h"
+#include "utils/typcache.h"
 
 
 static List *translate_sub_tlist(List *tlist, int relid);
 static bool query_is_distinct_for(Query *query, List *colnos, List *opids);
 static Oid	distinct_col_search(int colno, List *colnos, List *opids);
+static bool check_index_only(RelOptInfo *rel, IndexOptInfo *index);
+static Oid	memoize_key_equality(Node *outerarg, Oid opno);
 
 
 /*****************************************************************************
@@ -465,6 +470,7 @@ create_index_path(PlannerInfo *root,
 
 	pathnode->isjoininner = (outer_rel != NULL);
 	pathnode->indexscandir = indexscandir;
+	pathnode->indexonly = check_index_only(rel, index);
 
 	if (outer_rel != NULL)
 	{
@@ -508,6 +514,76 @@ create_index_path(PlannerInfo *root,
 	return pathnode;
 }
 
+/*
+ * check_index_only
+ *		Determine whether an index-only scan is possible for this index.
+ *
+ * That requires the index AM to be able to return index tuples, and every
+ * column of the table that the scan must produce or test to be a plain
+ * column of the index.  System columns and whole-row references can never
+ * be supplied from the index.
+ */
+static bool
+check_index_only(RelOptInfo *rel, IndexOptInfo *index)
+{
+	Bitmapset  *index_attrs = NULL;
+	List	   *vars;
+	ListCell   *lc;
+	bool		result = true;
+	int			i;
+
+	/* Index-only scans must be enabled, and index must be capable of them */
+	if (!enable_indexonlyscan)
+		return false;
+	if (!index->canreturn)
+		return false;
+
+	/* Collect the table columns the index can return */
+	for (i = 0; i < index->ncolumns; i++)
+	{
+		int			attno = index->indexkeys[i];
+
+		/* expression columns can't be used to reconstruct table columns */
+		if (attno > 0)
+			index_attrs = bms_add_member(index_attrs, attno);
+	}
+
+	/*
+	 * Check the columns needed above the scan (including any needed for
+	 * join clauses), plus those referenced by restriction clauses that the
+	 * scan will evaluate.
+	 */
+	vars = pull_var_clause((Node *) rel->reltargetlist,
+						   PVC_RECURSE_PLACEHOLDERS);
+	foreach(lc, rel->baserestrictinfo)
+	{
+		RestrictInfo *rinfo = (RestrictInfo *) lfirst(lc);
+
+		vars = list_concat(vars,
+						   pull_var_clause((Node *) rinfo->clause,
+										   PVC_RECURSE_PLACEHOLDERS));
+	}
+
+	foreach(lc, vars)
+	{
+		Var		   *var = (Var *) lfirst(lc);
+
+		if (var->varno != rel->relid || var->varlevelsup != 0)
+			continue;
+		if (var->varattno <= 0 ||
+			!bms_is_member(var->varattno, index_attrs))
+		{
+			result = false;
+			break;
+		}
+	}
+
+	list_free(vars);
+	bms_free(index_attrs);
+
+	return result;
+}
+
 /*
  * create_bitmap_heap_path
  *	  Creates a path node for a bitmap scan.
@@ -648,6 +724,7 @@ create_append_path(RelOptInfo *rel, List *subpaths)
 	pathnode->path.pathkeys = NIL;		/* result is always considered
 										 * unsorted */
 	pathnode->subpaths = subpaths;
+	pathnode->partpruneclauses = NIL;
 
 	pathnode->path.startup_cost = 0;
 	pathnode->path.total_cost = 0;
@@ -663,6 +740,69 @@ create_append_path(RelOptInfo *rel, List *subpaths)
 	return pathnode;
 }
 
+/*
+ * create_merge_append_path
+ *	  Creates a path corresponding to a MergeAppend plan, returning the
+ *	  pathnode.
+ *
+ * Subpaths that aren't already sorted on 'pathkeys' will get an explicit
+ * Sort added above them by createplan.c, so we cost that in here.
+ */
+MergeAppendPath *
+create_merge_append_path(PlannerInfo *root,
+						 RelOptInfo *rel,
+						 List *subpaths,
+						 List *pathkeys)
+{
+	MergeAppendPath *pathnode = makeNode(MergeAppendPath);
+	Cost		input_startup_cost;
+	Cost		input_total_cost;
+	ListCell   *l;
+
+	pathnode->path.pathtype = T_MergeAppend;
+	pathnode->path.parent = rel;
+	pathnode->path.pathkeys = pathkeys;
+	pathnode->subpaths = subpaths;
+
+	/* Add up all the costs of the input paths */
+	input_startup_cost = 0;
+	input_total_cost = 0;
+	foreach(l, subpaths)
+	{
+		Path	   *subpath = (Path *) lfirst(l);
+
+		if (pathkeys_contained_in(pathkeys, subpath->pathkeys))
+		{
+			/* Subpath is adequately ordered, we won't need to sort it */
+			input_startup_cost += subpath->startup_cost;
+			input_total_cost += subpath->total_cost;
+		}
+		else
+		{
+			/* We'll need to insert a Sort node, so include cost for that */
+			Path		sort_path;		/* dummy for result of cost_sort */
+
+			cost_sort(&sort_path,
+					  root,
+					  pathkeys,
+					  subpath->total_cost,
+					  subpath->parent->rows,
+					  subpath->parent->width,
+					  -1.0);
+			input_startup_cost += sort_path.startup_cost;
+			input_total_cost += sort_path.total_cost;
+		}
+	}
+
+	/* Now we can compute total costs of the MergeAppend */
+	cost_merge_append(&pathnode->path, root,
+					  pathkeys, list_length(subpaths),
+					  input_startup_cost, input_total_cost,
+					  rel->tuples);
+
+	return pathnode;
+}
+
 /*
  * create_result_path
  *	  Creates a path representing a Result-and-nothing-else plan.
@@ -718,6 +858,178 @@ create_material_path(RelOptInfo *rel, Path *subpath)
 	return pathnode;
 }
 
+/*
+ * create_memoize_path
+ *	  Creates a path caching the results of 'subpath', a nestloop inner
+ *	  indexscan path whose join clauses refer to 'outer_rel', for each set
+ *	  of values of the outer-rel Vars those clauses use.
+ *
+ * The cache key is taken from the outer side of each join clause, which
+ * must be of the form "inner op outer".  Two keys may share the cached rows
+ * only if the subpath is sure to return the same rows for both.  When the
+ * outer side is a plain Var, and 'op' agrees about equal values with the
+ * Var type's hashable equality operator, the key is the Var, compared with
+ * that operator.  Otherwise (think of "inner.t = outer.n::text", where
+ * numerics 1.0 and 1.00 are equal but give different text), the key is the
+ * outer side expression itself, and keys must be binary equal; its
+ * hash_operators entry is InvalidOid.
+ *
+ * Returns NULL if the results can't be cached: if a join clause has some
+ * other form, or uses PlaceHolderVars of the outer rel, or if the join
+ * clauses or the rel's restriction clauses contain volatile functions, so
+ * that the same key might not give the same rows twice.
+ */
+MemoizePath *
+create_memoize_path(PlannerInfo *root, RelOptInfo *rel, Path *subpath,
+					RelOptInfo *outer_rel)
+{
+	MemoizePath *pathnode;
+	List	   *joinclauses;
+	List	   *param_exprs = NIL;
+	List	   *hash_operators = NIL;
+	ListCell   *l;
+
+	if (IsA(subpath, IndexPath) &&
+		((IndexPath *) subpath)->isjoininner)
+		joinclauses = ((IndexPath *) subpath)->indexclauses;
+	else if (IsA(subpath, BitmapHeapPath) &&
+			 ((BitmapHeapPath *) subpath)->isjoininner)
+		joinclauses = make_restrictinfo_from_bitmapqual(((BitmapHeapPath *) subpath)->bitmapqual,
+														true,
+														false);
+	else
+		return NULL;
+	joinclauses = extract_actual_clauses(joinclauses, false);
+
+	if (contain_volatile_functions((Node *) joinclauses) ||
+		contain_volatile_functions((Node *)
+							extract_actual_clauses(rel->baserestrictinfo,
+												   false)))
+		return NULL;
+
+	foreach(l, joinclauses)
+	{
+		Expr	   *clause = (Expr *) lfirst(l);
+		Node	   *outerarg;
+		List	   *vars;
+		ListCell   *lv;
+		ListCell   *lo;
+		Oid			eq_opr;
+		bool		found;
+
+		if (!bms_overlap(pull_varnos((Node *) clause), outer_rel->relids))
+			continue;
+
+		/* Find the clause's outer side */
+		if (!is_opclause(clause) || list_length(((OpExpr *) clause)->args) != 2)
+			return NULL;
+		if (!bms_overlap(pull_varnos(get_leftop(clause)), outer_rel->relids))
+			outerarg = get_rightop(clause);
+		else if (!bms_overlap(pull_varnos(get_rightop(clause)),
+							  outer_rel->relids))
+			outerarg = get_leftop(clause);
+		else
+			return NULL;
+		if (!bms_is_subset(pull_varnos(outerarg), outer_rel->relids))
+			return NULL;
+
+		/* We don't try to compute PlaceHolderVars for the cache key */
+		vars = pull_var_clause(outerarg, PVC_INCLUDE_PLACEHOLDERS);
+		foreach(lv, vars)
+		{
+			if (!IsA(lfirst(lv), Var))
+				return NULL;
+		}
+		list_free(vars);
+
+		eq_opr = memoize_key_equality(outerarg, ((OpExpr *) clause)->opno);
+		if (OidIsValid(eq_opr) && IsA(outerarg, RelabelType))
+			outerarg = (Node *) ((RelabelType *) outerarg)->arg;
+
+		found = false;
+		forboth(lv, param_exprs, lo, hash_operators)
+		{
+			if (lfirst_oid(lo) == eq_opr && equal(lfirst(lv), outerarg))
+			{
+				found = true;
+				break;
+			}
+		}
+		if (found)
+			continue;
+
+		param_exprs = lappend(param_exprs, outerarg);
+		hash_operators = lappend_oid(hash_operators, eq_opr);
+	}
+
+	if (param_exprs == NIL)
+		return NULL;
+
+	pathnode = makeNode(MemoizePath);
+
+	pathnode->path.pathtype = T_Memoize;
+	pathnode->path.parent = rel;
+
+	/* The cached rows come back in the order the subpath returned them */
+	pathnode->path.pathkeys = subpath->pathkeys;
+
+	pathnode->subpath = subpath;
+	pathnode->param_exprs = param_exprs;
+	pathnode->hash_operators = hash_operators;
+	pathnode->calls = outer_rel->rows;
+
+	cost_memoize(pathnode, root);
+
+	return pathnode;
+}
+
+/*
+ * memoize_key_equality
+ *		Decide how create_memoize_path may compare cache keys taken from
+ *		'outerarg', the outer side of a join clause using operator 'opno'.
+ *
+ * If 'outerarg' is a Var, possibly relabeled, and values of its type that
+ * are equal under the type's hashable equality operator are sure to give
+ * the same result from 'opno', return that equality operator.  That's so
+ * if 'opno' is the operator itself, or belongs to a btree family in which
+ * it is the equality member, since all the operators of a family agree
+ * about equal values.  Otherwise return InvalidOid.
+ */
+static Oid
+memoize_key_equality(Node *outerarg, Oid opno)
+{
+	TypeCacheEntry *typentry;
+	Oid			eq_opr;
+	List	   *opfamilies;
+	ListCell   *l;
+	bool		result = false;
+
+	if (IsA(outerarg, RelabelType))
+		outerarg = (Node *) ((RelabelType *) outerarg)->arg;
+	if (!IsA(outerarg, Var))
+		return InvalidOid;
+
+	typentry = lookup_type_cache(exprType(outerarg), TYPECACHE_EQ_OPR);
+	eq_opr = typentry->eq_opr;
+	if (!OidIsValid(eq_opr) || !op_hashjoinable(eq_opr))
+		return InvalidOid;
+	if (opno == eq_opr)
+		return eq_opr;
+
+	opfamilies = get_mergejoin_opfamilies(eq_opr);
+	foreach(l, opfamilies)
+	{
+		if (op_in_opfamily(opno, lfirst_oid(l)))
+		{
+			result = true;
+			break;
+		}
+	}
+	list_free(opfamilies);
+
+	return result ? eq_opr : InvalidOid;
+}
+
 /*
  * create_unique_path
  *	  Creates a path representing elimination of distinct rows from the
@@ -46,6 +46,8 @@ int			constraint_exclusion = CONSTRAINT_EXCLUSION_PARTITION;
 get_relation_info_hook_type get_relation_info_hook = NULL;
 
 
+static List *get_relation_indexlist(PlannerInfo *root, Relation relation,
+					   bool inhparent, RelOptInfo *rel);
 static List *get_relation_constraints(PlannerInfo *root,
 						 Oid relationObjectId, RelOptInfo *rel,
 						 bool include_notnull);
@@ -77,10 +79,7 @@ void
 get_relation_info(PlannerInfo *root, Oid relationObjectId, bool inhparent,
 				  RelOptInfo *rel)
 {
-	Index		varno = rel->relid;
 	Relation	relation;
-	bool		hasindex;
-	List	   *indexinfos = NIL;
 
 	/*
 	 * We need not lock the relation since it was already locked, either by
@@ -106,9 +105,84 @@ get_relation_info(PlannerInfo *root, Oid relationObjectId, bool inhparent,
 	 * calculation.
 	 */
 	if (!inhparent)
+	{
 		estimate_rel_size(relation, rel->attr_widths - rel->min_attr,
 						  &rel->pages, &rel->tuples);
 
+		/*
+		 * Estimate the fraction of the table's pages that are all-visible,
+		 * which determines how many heap fetches an index-only scan can
+		 * skip.  relallvisible is only as fresh as the last VACUUM or
+		 * ANALYZE, so scale it against the current size estimate.
+		 */
+		if (rel->pages > 0 && relation->rd_rel->relallvisible > 0)
+			rel->allvisfrac = Min((double) relation->rd_rel->relallvisible /
+								  (double) rel->pages, 1.0);
+		else
+			rel->allvisfrac = 0;
+	}
+
+	/*
+	 * Make list of indexes.  For a member of an append relation, such as an
+	 * inheritance child, this is put off until set_append_rel_pathlist has
+	 * found that the member can't be excluded (see
+	 * get_appendrel_member_info).  With many children, most of them often
+	 * are, and opening and locking all their indexes would then be a good
+	 * part of the planning time.
+	 */
+	if (rel->reloptkind != RELOPT_OTHER_MEMBER_REL)
+		rel->indexlist = get_relation_indexlist(root, relation, inhparent,
+												rel);
+
+	heap_close(relation, NoLock);
+
+	/*
+	 * Allow a plugin to editorialize on the info we obtained from the
+	 * catalogs.  Actions might include altering the assumed relation size,
+	 * removing an index, or adding a hypothetical index to the indexlist.
+	 * For an appendrel member, this too waits for the index list.
+	 */
+	if (get_relation_info_hook && rel->reloptkind != RELOPT_OTHER_MEMBER_REL)
+		(*get_relation_info_hook) (root, relationObjectId, inhparent, rel);
+}
+
+/*
+ * get_appendrel_member_info -
+ *	  Finish retrieving catalog information for a member of an append
+ *	  relation, once it is known that the member will be scanned.
+ *
+ * get_relation_info fills in everything but the index list for such a rel.
+ */
+void
+get_appendrel_member_info(PlannerInfo *root, Oid relationObjectId,
+						  bool inhparent, RelOptInfo *rel)
+{
+	Relation	relation;
+
+	Assert(rel->reloptkind == RELOPT_OTHER_MEMBER_REL);
+
+	/* Already locked, as in get_relation_info */
+	relation = heap_open(relationObjectId, NoLock);
+	rel->indexlist = get_relation_indexlist(root, relation, inhparent, rel);
+	heap_close(relation, NoLock);
+
+	/* See comments in get_relation_info */
+	if (get_relation_info_hook)
+		(*get_relation_info_hook) (root, relationObjectId, inhparent, rel);
+}
+
+/*
+ * get_relation_indexlist -
+ *	  Build the list of IndexOptInfos for a relation's usable indexes.
+ */
+static List *
+get_relation_indexlist(PlannerInfo *root, Relation relation, bool inhparent,
+					   RelOptInfo *rel)
+{
+	Index		varno = rel->relid;
+	bool		hasindex;
+	List	   *indexinfos = NIL;
+
 	/*
 	 * Make list of indexes.  Ignore indexes on system catalogs if told to.
 	 * Don't bother with indexes for an inheritance parent, either.
@@ -215,6 +289,7 @@ get_relation_info(PlannerInfo *root, Oid relationObjectId, bool inhparent,
 			info->amsearchnulls = indexRelation->rd_am->amsearchnulls;
 			info->amhasgettuple = OidIsValid(indexRelation->rd_am->amgettuple);
 			info->amhasgetbitmap = OidIsValid(indexRelation->rd_am->amgetbitmap);
+			info->canreturn = indexRelation->rd_am->amcanreturn;
 
 			/*
 			 * Fetch the ordering operators associated with the index, if any.
@@ -304,17 +379,7 @@ get_relation_info(PlannerInfo *root, Oid relationObjectId, bool inhparent,
 		list_free(indexoidlist);
 	}
 
-	rel->indexlist = indexinfos;
-
-	heap_close(relation, NoLock);
-
-	/*
-	 * Allow a plugin to editorialize on the info we obtained from the
-	 * catalogs.  Actions might include altering the assumed relation size,
-	 * removing an index, or adding a hypothetical index to the indexlist.
-	 */
-	if (get_relation_info_hook)
-		(*get_relation_info_hook) (root, relationObjectId, inhparent, rel);
+	return indexinfos;
 }
 
 /*
@@ -689,6 +689,15 @@ select_nonredundant_join_clauses(PlannerInfo *root,
 		}
 	}
 
+	else if (IsA(inner_path, MemoizePath))
+	{
+		/* The cached indexscan enforces the same quals */
+		restrictinfo_list =
+			select_nonredundant_join_clauses(root,
+											 restrictinfo_list,
+									((MemoizePath *) inner_path)->subpath);
+	}
+
 	/*
 	 * XXX the inner path of a nestloop could also be an append relation whose
 	 * elements use join quals.  However, they might each use different quals;
@@ -0,0 +1,541 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_BASE_YY_GRAM_H_INCLUDED
+# define YY_BASE_YY_GRAM_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int base_yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    IDENT = 258,                   /* IDENT  */
+    FCONST = 259,                  /* FCONST  */
+    SCONST = 260,                  /* SCONST  */
+    BCONST = 261,                  /* BCONST  */
+    XCONST = 262,                  /* XCONST  */
+    Op = 263,                      /* Op  */
+    ICONST = 264,                  /* ICONST  */
+    PARAM = 265,                   /* PARAM  */
+    TYPECAST = 266,                /* TYPECAST  */
+    DOT_DOT = 267,                 /* DOT_DOT  */
+    COLON_EQUALS = 268,            /* COLON_EQUALS  */
+    ABORT_P = 269,                 /* ABORT_P  */
+    ABSOLUTE_P = 270,              /* ABSOLUTE_P  */
+    ACCESS = 271,                  /* ACCESS  */
+    ACTION = 272,                  /* ACTION  */
+    ADD_P = 273,                   /* ADD_P  */
+    ADMIN = 274,                   /* ADMIN  */
+    AFTER = 275,                   /* AFTER  */
+    AGGREGATE = 276,               /* AGGREGATE  */
+    ALL = 277,                     /* ALL  */
+    ALSO = 278,                    /* ALSO  */
+    ALTER = 279,                   /* ALTER  */
+    ALWAYS = 280,                  /* ALWAYS  */
+    ANALYSE = 281,                 /* ANALYSE  */
+    ANALYZE = 282,                 /* ANALYZE  */
+    AND = 283,                     /* AND  */
+    ANY = 284,                     /* ANY  */
+    ARRAY = 285,                   /* ARRAY  */
+    AS = 286,                      /* AS  */
+    ASC = 287,                     /* ASC  */
+    ASSERTION = 288,               /* ASSERTION  */
+    ASSIGNMENT = 289,              /* ASSIGNMENT  */
+    ASYMMETRIC = 290,              /* ASYMMETRIC  */
+    AT = 291,                      /* AT  */
+    AUTHORIZATION = 292,           /* AUTHORIZATION  */
+    BACKWARD = 293,                /* BACKWARD  */
+    BEFORE = 294,                  /* BEFORE  */
+    BEGIN_P = 295,                 /* BEGIN_P  */
+    BETWEEN = 296,                 /* BETWEEN  */
+    BIGINT = 297,                  /* BIGINT  */
+    BINARY = 298,                  /* BINARY  */
+    BIT = 299,                     /* BIT  */
+    BOOLEAN_P = 300,               /* BOOLEAN_P  */
+    BOTH = 301,                    /* BOTH  */
+    BY = 302,                      /* BY  */
+    CACHE = 303,                   /* CACHE  */
+    CALLED = 304,                  /* CALLED  */
+    CASCADE = 305,                 /* CASCADE  */
+    CASCADED = 306,                /* CASCADED  */
+    CASE = 307,                    /* CASE  */
+    CAST = 308,                    /* CAST  */
+    CATALOG_P = 309,               /* CATALOG_P  */
+    CHAIN = 310,                   /* CHAIN  */
+    CHAR_P = 311,                  /* CHAR_P  */
+    CHARACTER = 312,               /* CHARACTER  */
+    CHARACTERISTICS = 313,         /* CHARACTERISTICS  */
+    CHECK = 314,                   /* CHECK  */
+    CHECKPOINT = 315,              /* CHECKPOINT  */
+    CLASS = 316,                   /* CLASS  */
+    CLOSE = 317,                   /* CLOSE  */
+    CLUSTER = 318,                 /* CLUSTER  */
+    COALESCE = 319,                /* COALESCE  */
+    COLLATE = 320,                 /* COLLATE  */
+    COLUMN = 321,                  /* COLUMN  */
+    COMMENT = 322,                 /* COMMENT  */
+    COMMENTS = 323,                /* COMMENTS  */
+    COMMIT = 324,                  /* COMMIT  */
+    COMMITTED = 325,               /* COMMITTED  */
+    CONCURRENTLY = 326,            /* CONCURRENTLY  */
+    CONFIGURATION = 327,           /* CONFIGURATION  */
+    CONNECTION = 328,              /* CONNECTION  */
+    CONSTRAINT = 329,              /* CONSTRAINT  */
+    CONSTRAINTS = 330,             /* CONSTRAINTS  */
+    CONTENT_P = 331,               /* CONTENT_P  */
+    CONTINUE_P = 332,              /* CONTINUE_P  */
+    CONVERSION_P = 333,            /* CONVERSION_P  */
+    COPY = 334,                    /* COPY  */
+    COST = 335,                    /* COST  */
+    CREATE = 336,                  /* CREATE  */
+    CREATEDB = 337,                /* CREATEDB  */
+    CREATEROLE = 338,              /* CREATEROLE  */
+    CREATEUSER = 339,              /* CREATEUSER  */
+    CROSS = 340,                   /* CROSS  */
+    CSV = 341,                     /* CSV  */
+    CURRENT_P = 342,               /* CURRENT_P  */
+    CURRENT_CATALOG = 343,         /* CURRENT_CATALOG  */
+    CURRENT_DATE = 344,            /* CURRENT_DATE  */
+    CURRENT_ROLE = 345,            /* CURRENT_ROLE  */
+    CURRENT_SCHEMA = 346,          /* CURRENT_SCHEMA  */
+    CURRENT_TIME = 347,            /* CURRENT_TIME  */
+    CURRENT_TIMESTAMP = 348,       /* CURRENT_TIMESTAMP  */
+    CURRENT_USER = 349,            /* CURRENT_USER  */
+    CURSOR = 350,                  /* CURSOR  */
+    CYCLE = 351,                   /* CYCLE  */
+    DATA_P = 352,                  /* DATA_P  */
+    DATABASE = 353,                /* DATABASE  */
+    DAY_P = 354,                   /* DAY_P  */
+    DEALLOCATE = 355,              /* DEALLOCATE  */
+    DEC = 356,                     /* DEC  */
+    DECIMAL_P = 357,               /* DECIMAL_P  */
+    DECLARE = 358,                 /* DECLARE  */
+    DEFAULT = 359,                 /* DEFAULT  */
+    DEFAULTS = 360,                /* DEFAULTS  */
+    DEFERRABLE = 361,              /* DEFERRABLE  */
+    DEFERRED = 362,                /* DEFERRED  */
+    DEFINER = 363,                 /* DEFINER  */
+    DELETE_P = 364,                /* DELETE_P  */
+    DELIMITER = 365,               /* DELIMITER  */
+    DELIMITERS = 366,              /* DELIMITERS  */
+    DESC = 367,                    /* DESC  */
+    DICTIONARY = 368,              /* DICTIONARY  */
+    DISABLE_P = 369,               /* DISABLE_P  */
+    DISCARD = 370,                 /* DISCARD  */
+    DISTINCT = 371,                /* DISTINCT  */
+    DO = 372,                      /* DO  */
+    DOCUMENT_P = 373,              /* DOCUMENT_P  */
+    DOMAIN_P = 374,                /* DOMAIN_P  */
+    DOUBLE_P = 375,                /* DOUBLE_P  */
+    DROP = 376,                    /* DROP  */
+    EACH = 377,                    /* EACH  */
+    ELSE = 378,                    /* ELSE  */
+    ENABLE_P = 379,                /* ENABLE_P  */
+    ENCODING = 380,                /* ENCODING  */
+    ENCRYPTED = 381,               /* ENCRYPTED  */
+    END_P = 382,                   /* END_P  */
+    ENUM_P = 383,                  /* ENUM_P  */
+    ESCAPE = 384,                  /* ESCAPE  */
+    EXCEPT = 385,                  /* EXCEPT  */
+    EXCLUDE = 386,                 /* EXCLUDE  */
+    EXCLUDING = 387,               /* EXCLUDING  */
+    EXCLUSIVE = 388,               /* EXCLUSIVE  */
+    EXECUTE = 389,                 /* EXECUTE  */
+    EXISTS = 390,                  /* EXISTS  */
+    EXPLAIN = 391,                 /* EXPLAIN  */
+    EXTERNAL = 392,                /* EXTERNAL  */
+    EXTRACT = 393,                 /* EXTRACT  */
+    FALSE_P = 394,                 /* FALSE_P  */
+    FAMILY = 395,                  /* FAMILY  */
+    FETCH = 396,                   /* FETCH  */
+    FIRST_P = 397,                 /* FIRST_P  */
+    FLOAT_P = 398,                 /* FLOAT_P  */
+    FOLLOWING = 399,               /* FOLLOWING  */
+    FOR = 400,                     /* FOR  */
+    FORCE = 401,                   /* FORCE  */
+    FOREIGN = 402,                 /* FOREIGN  */
+    FORWARD = 403,                 /* FORWARD  */
+    FREEZE = 404,                  /* FREEZE  */
+    FROM = 405,                    /* FROM  */
+    FULL = 406,                    /* FULL  */
+    FUNCTION = 407,                /* FUNCTION  */
+    FUNCTIONS = 408,               /* FUNCTIONS  */
+    GLOBAL = 409,                  /* GLOBAL  */
+    GRANT = 410,                   /* GRANT  */
+    GRANTED = 411,                 /* GRANTED  */
+    GREATEST = 412,                /* GREATEST  */
+    GROUP_P = 413,                 /* GROUP_P  */
+    HANDLER = 414,                 /* HANDLER  */
+    HAVING = 415,                  /* HAVING  */
+    HEADER_P = 416,                /* HEADER_P  */
+    HOLD = 417,                    /* HOLD  */
+    HOUR_P = 418,                  /* HOUR_P  */
+    IDENTITY_P = 419,              /* IDENTITY_P  */
+    IF_P = 420,                    /* IF_P  */
+    ILIKE = 421,                   /* ILIKE  */
+    IMMEDIATE = 422,               /* IMMEDIATE  */
+    IMMUTABLE = 423,               /* IMMUTABLE  */
+    IMPLICIT_P = 424,              /* IMPLICIT_P  */
+    IN_P = 425,                    /* IN_P  */
+    INCLUDING = 426,               /* INCLUDING  */
+    INCREMENT = 427,               /* INCREMENT  */
+    INDEX = 428,                   /* INDEX  */
+    INDEXES = 429,                 /* INDEXES  */
+    INHERIT = 430,                 /* INHERIT  */
+    INHERITS = 431,                /* INHERITS  */
+    INITIALLY = 432,               /* INITIALLY  */
+    INLINE_P = 433,                /* INLINE_P  */
+    INNER_P = 434,                 /* INNER_P  */
+    INOUT = 435,                   /* INOUT  */
+    INPUT_P = 436,                 /* INPUT_P  */
+    INSENSITIVE = 437,             /* INSENSITIVE  */
+    INSERT = 438,                  /* INSERT  */
+    INSTEAD = 439,                 /* INSTEAD  */
+    INT_P = 440,                   /* INT_P  */
+    INTEGER = 441,                 /* INTEGER  */
+    INTERSECT = 442,               /* INTERSECT  */
+    INTERVAL = 443,                /* INTERVAL  */
+    INTO = 444,                    /* INTO  */
+    INVOKER = 445,                 /* INVOKER  */
+    IS = 446,                      /* IS  */
+    ISNULL = 447,                  /* ISNULL  */
+    ISOLATION = 448,               /* ISOLATION  */
+    JOIN = 449,                    /* JOIN  */
+    KEY = 450,                     /* KEY  */
+    LANGUAGE = 451,                /* LANGUAGE  */
+    LARGE_P = 452,                 /* LARGE_P  */
+    LAST_P = 453,                  /* LAST_P  */
+    LC_COLLATE_P = 454,            /* LC_COLLATE_P  */
+    LC_CTYPE_P = 455,              /* LC_CTYPE_P  */
+    LEADING = 456,                 /* LEADING  */
+    LEAST = 457,                   /* LEAST  */
+    LEFT = 458,                    /* LEFT  */
+    LEVEL = 459,                   /* LEVEL  */
+    LIKE = 460,                    /* LIKE  */
+    LIMIT = 461,                   /* LIMIT  */
+    LISTEN = 462,                  /* LISTEN  */
+    LOAD = 463,                    /* LOAD  */
+    LOCAL = 464,                   /* LOCAL  */
+    LOCALTIME = 465,               /* LOCALTIME  */
+    LOCALTIMESTAMP = 466,          /* LOCALTIMESTAMP  */
+    LOCATION = 467,                /* LOCATION  */
+    LOCK_P = 468,                  /* LOCK_P  */
+    LOGIN_P = 469,                 /* LOGIN_P  */
+    MAPPING = 470,                 /* MAPPING  */
+    MATCH = 471,                   /* MATCH  */
+    MAXVALUE = 472,                /* MAXVALUE  */
+    MINUTE_P = 473,                /* MINUTE_P  */
+    MINVALUE = 474,                /* MINVALUE  */
+    MODE = 475,                    /* MODE  */
+    MONTH_P = 476,                 /* MONTH_P  */
+    MOVE = 477,                    /* MOVE  */
+    NAME_P = 478,                  /* NAME_P  */
+    NAMES = 479,                   /* NAMES  */
+    NATIONAL = 480,                /* NATIONAL  */
+    NATURAL = 481,                 /* NATURAL  */
+    NCHAR = 482,                   /* NCHAR  */
+    NEXT = 483,                    /* NEXT  */
+    NO = 484,                      /* NO  */
+    NOCREATEDB = 485,              /* NOCREATEDB  */
+    NOCREATEROLE = 486,            /* NOCREATEROLE  */
+    NOCREATEUSER = 487,            /* NOCREATEUSER  */
+    NOINHERIT = 488,               /* NOINHERIT  */
+    NOLOGIN_P = 489,               /* NOLOGIN_P  */
+    NONE = 490,                    /* NONE  */
+    NOSUPERUSER = 491,             /* NOSUPERUSER  */
+    NOT = 492,                     /* NOT  */
+    NOTHING = 493,                 /* NOTHING  */
+    NOTIFY = 494,                  /* NOTIFY  */
+    NOTNULL = 495,                 /* NOTNULL  */
+    NOWAIT = 496,                  /* NOWAIT  */
+    NULL_P = 497,                  /* NULL_P  */
+    NULLIF = 498,                  /* NULLIF  */
+    NULLS_P = 499,                 /* NULLS_P  */
+    NUMERIC = 500,                 /* NUMERIC  */
+    OBJECT_P = 501,                /* OBJECT_P  */
+    OF = 502,                      /* OF  */
+    OFF = 503,                     /* OFF  */
+    OFFSET = 504,                  /* OFFSET  */
+    OIDS = 505,                    /* OIDS  */
+    ON = 506,                      /* ON  */
+    ONLY = 507,                    /* ONLY  */
+    OPERATOR = 508,                /* OPERATOR  */
+    OPTION = 509,                  /* OPTION  */
+    OPTIONS = 510,                 /* OPTIONS  */
+    OR = 511,                      /* OR  */
+    ORDER = 512,                   /* ORDER  */
+    OUT_P = 513,                   /* OUT_P  */
+    OUTER_P = 514,                 /* OUTER_P  */
+    OVER = 515,                    /* OVER  */
+    OVERLAPS = 516,                /* OVERLAPS  */
+    OVERLAY = 517,                 /* OVERLAY  */
+    OWNED = 518,                   /* OWNED  */
+    OWNER = 519,                   /* OWNER  */
+    PARSER = 520,                  /* PARSER  */
+    PARTIAL = 521,                 /* PARTIAL  */
+    PARTITION = 522,               /* PARTITION  */
+    PASSWORD = 523,                /* PASSWORD  */
+    PLACING = 524,                 /* PLACING  */
+    PLANS = 525,                   /* PLANS  */
+    POSITION = 526,                /* POSITION  */
+    PRECEDING = 527,               /* PRECEDING  */
+    PRECISION = 528,               /* PRECISION  */
+    PRESERVE = 529,                /* PRESERVE  */
+    PREPARE = 530,                 /* PREPARE  */
+    PREPARED = 531,                /* PREPARED  */
+    PRIMARY = 532,                 /* PRIMARY  */
+    PRIOR = 533,                   /* PRIOR  */
+    PRIVILEGES = 534,              /* PRIVILEGES  */
+    PROCEDURAL = 535,              /* PROCEDURAL  */
+    PROCEDURE = 536,               /* PROCEDURE  */
+    QUOTE = 537,                   /* QUOTE  */
+    RANGE = 538,                   /* RANGE  */
+    READ = 539,                    /* READ  */
+    REAL = 540,                    /* REAL  */
+    REASSIGN = 541,                /* REASSIGN  */
+    RECHECK = 542,                 /* RECHECK  */
+    RECURSIVE = 543,               /* RECURSIVE  */
+    REFERENCES = 544,              /* REFERENCES  */
+    REINDEX = 545,                 /* REINDEX  */
+    RELATIVE_P = 546,              /* RELATIVE_P  */
+    RELEASE = 547,                 /* RELEASE  */
+    RENAME = 548,                  /* RENAME  */
+    REPEATABLE = 549,              /* REPEATABLE  */
+    REPLACE = 550,                 /* REPLACE  */
+    REPLICA = 551,                 /* REPLICA  */
+    RESET = 552,                   /* RESET  */
+    RESTART = 553,                 /* RESTART  */
+    RESTRICT = 554,                /* RESTRICT  */
+    RETURNING = 555,               /* RETURNING  */
+    RETURNS = 556,                 /* RETURNS  */
+    REVOKE = 557,                  /* REVOKE  */
+    RIGHT = 558,                   /* RIGHT  */
+    ROLE = 559,                    /* ROLE  */
+    ROLLBACK = 560,                /* ROLLBACK  */
+    ROW = 561,                     /* ROW  */
+    ROWS = 562,                    /* ROWS  */
+    RULE = 563,                    /* RULE  */
+    SAVEPOINT = 564,               /* SAVEPOINT  */
+    SCHEMA = 565,                  /* SCHEMA  */
+    SCROLL = 566,                  /* SCROLL  */
+    SEARCH = 567,                  /* SEARCH  */
+    SECOND_P = 568,                /* SECOND_P  */
+    SECURITY = 569,                /* SECURITY  */
+    SELECT = 570,                  /* SELECT  */
+    SEQUENCE = 571,                /* SEQUENCE  */
+    SEQUENCES = 572,               /* SEQUENCES  */
+    SERIALIZABLE = 573,            /* SERIALIZABLE  */
+    SERVER = 574,                  /* SERVER  */
+    SESSION = 575,                 /* SESSION  */
+    SESSION_USER = 576,            /* SESSION_USER  */
+    SET = 577,                     /* SET  */
+    SETOF = 578,                   /* SETOF  */
+    SHARE = 579,                   /* SHARE  */
+    SHOW = 580,                    /* SHOW  */
+    SIMILAR = 581,                 /* SIMILAR  */
+    SIMPLE = 582,                  /* SIMPLE  */
+    SMALLINT = 583,                /* SMALLINT  */
+    SOME = 584,                    /* SOME  */
+    STABLE = 585,                  /* STABLE  */
+    STANDALONE_P = 586,            /* STANDALONE_P  */
+    START = 587,                   /* START  */
+    STATEMENT = 588,               /* STATEMENT  */
+    STATISTICS = 589,              /* STATISTICS  */
+    STDIN = 590,                   /* STDIN  */
+    STDOUT = 591,                  /* STDOUT  */
+    STORAGE = 592,                 /* STORAGE  */
+    STRICT_P = 593,                /* STRICT_P  */
+    STRIP_P = 594,                 /* STRIP_P  */
+    SUBSTRING = 595,               /* SUBSTRING  */
+    SUPERUSER_P = 596,             /* SUPERUSER_P  */
+    SYMMETRIC = 597,               /* SYMMETRIC  */
+    SYSID = 598,                   /* SYSID  */
+    SYSTEM_P = 599,                /* SYSTEM_P  */
+    TABLE = 600,                   /* TABLE  */
+    TABLES = 601,                  /* TABLES  */
+    TABLESPACE = 602,              /* TABLESPACE  */
+    TEMP = 603,                    /* TEMP  */
+    TEMPLATE = 604,                /* TEMPLATE  */
+    TEMPORARY = 605,               /* TEMPORARY  */
+    TEXT_P = 606,                  /* TEXT_P  */
+    THEN = 607,                    /* THEN  */
+    TIME = 608,                    /* TIME  */
+    TIMESTAMP = 609,               /* TIMESTAMP  */
+    TO = 610,                      /* TO  */
+    TRAILING = 611,                /* TRAILING  */
+    TRANSACTION = 612,             /* TRANSACTION  */
+    TREAT = 613,                   /* TREAT  */
+    TRIGGER = 614,                 /* TRIGGER  */
+    TRIM = 615,                    /* TRIM  */
+    TRUE_P = 616,                  /* TRUE_P  */
+    TRUNCATE = 617,                /* TRUNCATE  */
+    TRUSTED = 618,                 /* TRUSTED  */
+    TYPE_P = 619,                  /* TYPE_P  */
+    UNBOUNDED = 620,               /* UNBOUNDED  */
+    UNCOMMITTED = 621,             /* UNCOMMITTED  */
+    UNENCRYPTED = 622,             /* UNENCRYPTED  */
+    UNION = 623,                   /* UNION  */
+    UNIQUE = 624,                  /* UNIQUE  */
+    UNKNOWN = 625,                 /* UNKNOWN  */
+    UNLISTEN = 626,                /* UNLISTEN  */
+    UNTIL = 627,                   /* UNTIL  */
+    UPDATE = 628,                  /* UPDATE  */
+    USER = 629,                    /* USER  */
+    USING = 630,                   /* USING  */
+    VACUUM = 631,                  /* VACUUM  */
+    VALID = 632,                   /* VALID  */
+    VALIDATOR = 633,               /* VALIDATOR  */
+    VALUE_P = 634,                 /* VALUE_P  */
+    VALUES = 635,                  /* VALUES  */
+    VARCHAR = 636,                 /* VARCHAR  */
+    VARIADIC = 637,                /* VARIADIC  */
+    VARYING = 638,                 /* VARYING  */
+    VERBOSE = 639,                 /* VERBOSE  */
+    VERSION_P = 640,               /* VERSION_P  */
+    VIEW = 641,                    /* VIEW  */
+    VOLATILE = 642,                /* VOLATILE  */
+    WHEN = 643,                    /* WHEN  */
+    WHERE = 644,                   /* WHERE  */
+    WHITESPACE_P = 645,            /* WHITESPACE_P  */
+    WINDOW = 646,                  /* WINDOW  */
+    WITH = 647,                    /* WITH  */
+    WITHOUT = 648,                 /* WITHOUT  */
+    WORK = 649,                    /* WORK  */
+    WRAPPER = 650,                 /* WRAPPER  */
+    WRITE = 651,                   /* WRITE  */
+    XML_P = 652,                   /* XML_P  */
+    XMLATTRIBUTES = 653,           /* XMLATTRIBUTES  */
+    XMLCONCAT = 654,               /* XMLCONCAT  */
+    XMLELEMENT = 655,              /* XMLELEMENT  */
+    XMLFOREST = 656,               /* XMLFOREST  */
+    XMLPARSE = 657,                /* XMLPARSE  */
+    XMLPI = 658,                   /* XMLPI  */
+    XMLROOT = 659,                 /* XMLROOT  */
+    XMLSERIALIZE = 660,            /* XMLSERIALIZE  */
+    YEAR_P = 661,                  /* YEAR_P  */
+    YES_P = 662,                   /* YES_P  */
+    ZONE = 663,                    /* ZONE  */
+    NULLS_FIRST = 664,             /* NULLS_FIRST  */
+    NULLS_LAST = 665,              /* NULLS_LAST  */
+    WITH_TIME = 666,               /* WITH_TIME  */
+    POSTFIXOP = 667,               /* POSTFIXOP  */
+    UMINUS = 668                   /* UMINUS  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 146 "gram.y"
+
+	core_YYSTYPE		core_yystype;
+	/* these fields must match core_YYSTYPE: */
+	int					ival;
+	char				*str;
+	const char			*keyword;
+
+	char				chr;
+	bool				boolean;
+	JoinType			jtype;
+	DropBehavior		dbehavior;
+	OnCommitAction		oncommit;
+	List				*list;
+	Node				*node;
+	Value				*value;
+	ObjectType			objtype;
+	TypeName			*typnam;
+	FunctionParameter   *fun_param;
+	FunctionParameterMode fun_param_mode;
+	FuncWithArgs		*funwithargs;
+	DefElem				*defelt;
+	SortBy				*sortby;
+	WindowDef			*windef;
+	JoinExpr			*jexpr;
+	IndexElem			*ielem;
+	Alias				*alias;
+	RangeVar			*range;
+	IntoClause			*into;
+	WithClause			*with;
+	A_Indices			*aind;
+	ResTarget			*target;
+	struct PrivTarget	*privtarget;
+	AccessPriv			*accesspriv;
+	InsertStmt			*istmt;
+	VariableSetStmt		*vsetstmt;
+
+#line 514 "gram.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+/* Location type.  */
+#if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
+typedef struct YYLTYPE YYLTYPE;
+struct YYLTYPE
+{
+  int first_line;
+  int first_column;
+  int last_line;
+  int last_column;
+};
+# define YYLTYPE_IS_DECLARED 1
+# define YYLTYPE_IS_TRIVIAL 1
+#endif
+
+
+
+
+int base_yyparse (core_yyscan_t yyscanner);
+
+
+#endif /* !YY_BASE_YY_GRAM_H_INCLUDED  */
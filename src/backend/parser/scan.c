@@ -0,0 +1,2294 @@
+/* A lexical scanner generated by pyflex */
+#define yy_create_buffer core_yy_create_buffer
+#define yy_delete_buffer core_yy_delete_buffer
+#define yy_flex_debug core_yy_flex_debug
+#define yy_init_buffer core_yy_init_buffer
+#define yy_flush_buffer core_yy_flush_buffer
+#define yy_load_buffer_state core_yy_load_buffer_state
+#define yy_switch_to_buffer core_yy_switch_to_buffer
+#define yyin core_yyin
+#define yyleng core_yyleng
+#define yylex core_yylex
+#define yylineno core_yylineno
+#define yyout core_yyout
+#define yyrestart core_yyrestart
+#define yytext core_yytext
+#define yywrap core_yywrap
+#define yyalloc core_yyalloc
+#define yyrealloc core_yyrealloc
+#define yyfree core_yyfree
+#define yy_scan_buffer core_yy_scan_buffer
+#define yy_scan_string core_yy_scan_string
+#define yy_scan_bytes core_yy_scan_bytes
+#define yylex_init core_yylex_init
+#define yylex_destroy core_yylex_destroy
+#define yyget_extra core_yyget_extra
+#define yyset_extra core_yyset_extra
+#define yyget_in core_yyget_in
+#define yyset_in core_yyset_in
+#define yyget_out core_yyget_out
+#define yyset_out core_yyset_out
+#define yyget_leng core_yyget_leng
+#define yyget_text core_yyget_text
+#define yyget_lineno core_yyget_lineno
+#define yyset_lineno core_yyset_lineno
+#define yyget_column core_yyget_column
+#define yyset_column core_yyset_column
+#define yyget_lval core_yyget_lval
+#define yyset_lval core_yyset_lval
+#define yyget_lloc core_yyget_lloc
+#define yyset_lloc core_yyset_lloc
+#define yyget_debug core_yyget_debug
+#define yyset_debug core_yyset_debug
+#define FLEX_SCANNER
+#define YY_FLEX_MAJOR_VERSION 2
+#define YY_FLEX_MINOR_VERSION 5
+#define YY_FLEX_SUBMINOR_VERSION 35
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <stdlib.h>
+#ifndef YY_TYPEDEF_YY_SIZE_T
+#define YY_TYPEDEF_YY_SIZE_T
+typedef size_t yy_size_t;
+#endif
+#define yyconst const
+#define YY_NULL 0
+#define YY_END_OF_BUFFER_CHAR 0
+#ifndef YY_BUF_SIZE
+#define YY_BUF_SIZE 16384
+#endif
+#ifndef YY_TYPEDEF_YY_BUFFER_STATE
+#define YY_TYPEDEF_YY_BUFFER_STATE
+typedef struct yy_buffer_state *YY_BUFFER_STATE;
+#endif
+struct yy_buffer_state
+{
+	FILE *yy_input_file;
+	char *yy_ch_buf;
+	yy_size_t yy_buf_size;
+	int yy_n_chars;
+	int yy_pos;
+	int yy_filled;
+	int yy_is_our_buffer;
+};
+#ifndef YY_TYPEDEF_YY_SCANNER_T
+#define YY_TYPEDEF_YY_SCANNER_T
+typedef void *yyscan_t;
+#endif
+void yyrestart(FILE *input_file, yyscan_t yyscanner);
+void yy_switch_to_buffer(YY_BUFFER_STATE new_buffer, yyscan_t yyscanner);
+YY_BUFFER_STATE yy_create_buffer(FILE *file, int size, yyscan_t yyscanner);
+void yy_delete_buffer(YY_BUFFER_STATE b, yyscan_t yyscanner);
+void yy_flush_buffer(YY_BUFFER_STATE b, yyscan_t yyscanner);
+YY_BUFFER_STATE yy_scan_buffer(char *base, yy_size_t size, yyscan_t yyscanner);
+YY_BUFFER_STATE yy_scan_string(yyconst char *yy_str, yyscan_t yyscanner);
+YY_BUFFER_STATE yy_scan_bytes(yyconst char *bytes, int len, yyscan_t yyscanner);
+void *yyalloc(yy_size_t, yyscan_t yyscanner);
+void *yyrealloc(void *, yy_size_t, yyscan_t yyscanner);
+void yyfree(void *, yyscan_t yyscanner);
+int yylex_destroy(yyscan_t yyscanner);
+int yylex_init(yyscan_t *scanner);
+
+/* user code from definitions section */
+/*-------------------------------------------------------------------------
+ *
+ * scan.l
+ *	  lexical scanner for PostgreSQL
+ *
+ * NOTE NOTE NOTE:
+ *
+ * The rules in this file must be kept in sync with psql's lexer!!!
+ *
+ * The rules are designed so that the scanner never has to backtrack,
+ * in the sense that there is always a rule that can match the input
+ * consumed so far (the rule action may internally throw back some input
+ * with yyless(), however).  As explained in the flex manual, this makes
+ * for a useful speed increase --- about a third faster than a plain -CF
+ * lexer, in simple testing.  The extra complexity is mostly in the rules
+ * for handling float numbers and continued string literals.  If you change
+ * the lexical rules, verify that you haven't broken the no-backtrack
+ * property by running flex with the "-b" option and checking that the
+ * resulting "lex.backup" file says that no backing up is needed.
+ *
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *	  $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include <ctype.h>
+#include <unistd.h>
+
+#include "parser/parser.h"				/* only needed for GUC variables */
+#include "parser/scanner.h"
+#include "parser/scansup.h"
+#include "mb/pg_wchar.h"
+
+
+/* Avoid exit() on fatal scanner errors (a bit ugly -- see yy_fatal_error) */
+#undef fprintf
+#define fprintf(file, fmt, msg)  ereport(ERROR, (errmsg_internal("%s", msg)))
+
+/*
+ * GUC variables.  This is a DIRECT violation of the warning given at the
+ * head of gram.y, ie flex/bison code must not depend on any GUC variables;
+ * as such, changing their values can induce very unintuitive behavior.
+ * But we shall have to live with it as a short-term thing until the switch
+ * to SQL-standard string syntax is complete.
+ */
+int				backslash_quote = BACKSLASH_QUOTE_SAFE_ENCODING;
+bool			escape_string_warning = true;
+bool			standard_conforming_strings = false;
+
+/*
+ * Set the type of YYSTYPE.
+ */
+#define YYSTYPE core_YYSTYPE
+
+/*
+ * Set the type of yyextra.  All state variables used by the scanner should
+ * be in yyextra, *not* statically allocated.
+ */
+#define YY_EXTRA_TYPE core_yy_extra_type *
+
+/*
+ * Each call to yylex must set yylloc to the location of the found token
+ * (expressed as a byte offset from the start of the input text).
+ * When we parse a token that requires multiple lexer rules to process,
+ * this should be done in the first such rule, else yylloc will point
+ * into the middle of the token.
+ */
+#define SET_YYLLOC()  (*(yylloc) = yytext - yyextra->scanbuf)
+
+/*
+ * Advance yylloc by the given number of bytes.
+ */
+#define ADVANCE_YYLLOC(delta)  ( *(yylloc) += (delta) )
+
+#define startlit()  ( yyextra->literallen = 0 )
+static void addlit(char *ytext, int yleng, core_yyscan_t yyscanner);
+static void addlitchar(unsigned char ychar, core_yyscan_t yyscanner);
+static char *litbufdup(core_yyscan_t yyscanner);
+static char *litbuf_udeescape(unsigned char escape, core_yyscan_t yyscanner);
+static unsigned char unescape_single_char(unsigned char c, core_yyscan_t yyscanner);
+static int	process_integer_literal(const char *token, YYSTYPE *lval);
+static bool is_utf16_surrogate_first(pg_wchar c);
+static bool is_utf16_surrogate_second(pg_wchar c);
+static pg_wchar surrogate_pair_to_codepoint(pg_wchar first, pg_wchar second);
+static void addunicode(pg_wchar c, yyscan_t yyscanner);
+
+#define yyerror(msg)  scanner_yyerror(msg, yyscanner)
+
+#define lexer_errposition()  scanner_errposition(*(yylloc), yyscanner)
+
+static void check_string_escape_warning(unsigned char ychar, core_yyscan_t yyscanner);
+static void check_escape_warning(core_yyscan_t yyscanner);
+
+/*
+ * Work around a bug in flex 2.5.35: it emits a couple of functions that
+ * it forgets to emit declarations for.  Since we use -Wmissing-prototypes,
+ * this would cause warnings.  Providing our own declarations should be
+ * harmless even when the bug gets fixed.
+ */
+extern int	core_yyget_column(yyscan_t yyscanner);
+extern void core_yyset_column(int column_no, yyscan_t yyscanner);
+
+
+/* start conditions */
+#define INITIAL 0
+#define xb 1
+#define xc 2
+#define xd 3
+#define xh 4
+#define xe 5
+#define xq 6
+#define xdolq 7
+#define xui 8
+#define xus 9
+#define xeu 10
+#ifndef YY_EXTRA_TYPE
+#define YY_EXTRA_TYPE void *
+#endif
+struct yyguts_t
+{
+	YY_EXTRA_TYPE yyextra_r;
+	FILE *yyin_r, *yyout_r;
+	YY_BUFFER_STATE yy_current_buffer;
+	char yy_hold_char;
+	char *yy_hold_ptr;
+	int yyleng_r;
+	char *yytext_r;
+	int yy_init;
+	int yy_start;
+	int yylineno_r;
+	int yy_column_r;
+	int yy_flex_debug_r;
+	YYSTYPE *yylval_r;
+	YYLTYPE *yylloc_r;
+};
+#define YYG(x) (yyg->x)
+#define yyin yyg->yyin_r
+#define yyout yyg->yyout_r
+#define yyextra yyg->yyextra_r
+#define yyleng yyg->yyleng_r
+#define yytext yyg->yytext_r
+#define yylineno yyg->yylineno_r
+#define yycolumn yyg->yy_column_r
+#define yylval yyg->yylval_r
+#define yylloc yyg->yylloc_r
+YY_EXTRA_TYPE yyget_extra(yyscan_t yyscanner);
+void yyset_extra(YY_EXTRA_TYPE user_defined, yyscan_t yyscanner);
+int yyget_column(yyscan_t yyscanner);
+void yyset_column(int column_no, yyscan_t yyscanner);
+#define YY_CURRENT_BUFFER (YYG(yy_current_buffer))
+#define YY_CURRENT_BUFFER_LVALUE YYG(yy_current_buffer)
+#define BEGIN YYG(yy_start) = 
+#define YY_START (YYG(yy_start))
+#define YYSTATE YY_START
+#define yyterminate() return YY_NULL
+#ifndef ECHO
+#define ECHO do { if (fwrite(yytext, yyleng, 1, yyout)) {} } while (0)
+#endif
+#ifndef YY_USER_ACTION
+#define YY_USER_ACTION
+#endif
+#ifndef YY_BREAK
+#define YY_BREAK break;
+#endif
+#define YY_RULE_SETUP YY_USER_ACTION
+#define YY_FATAL_ERROR(msg) yy_fatal_error(msg, yyscanner)
+static void yy_fatal_error(yyconst char *msg, yyscan_t yyscanner);
+static void yy_fill_buffer(YY_BUFFER_STATE b, yyscan_t yyscanner);
+#undef yyless
+#define yyless(n) \
+	do { \
+		int yyless_macro_arg = (n); \
+		if (YYG(yy_hold_ptr)) *YYG(yy_hold_ptr) = YYG(yy_hold_char); \
+		YYG(yy_hold_ptr) = yytext + yyless_macro_arg; \
+		YYG(yy_hold_char) = *YYG(yy_hold_ptr); \
+		*YYG(yy_hold_ptr) = '\0'; \
+		yyleng = yyless_macro_arg; \
+		YY_CURRENT_BUFFER->yy_pos = (int) (YYG(yy_hold_ptr) - YY_CURRENT_BUFFER->yy_ch_buf); \
+	} while (0)
+#ifndef YY_DECL
+#define YY_DECL_IS_OURS 1
+extern int yylex(YYSTYPE *yylval_param, YYLTYPE *yylloc_param, yyscan_t yyscanner);
+#define YY_DECL int yylex(YYSTYPE *yylval_param, YYLTYPE *yylloc_param, yyscan_t yyscanner)
+#endif
+static yyconst unsigned char yy_ec[256] = {33,33,33,33,33,33,33,33,33,0,1,33,0,2,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,0,27,29,27,28,20,13,6,23,23,4,19,23,3,22,5,24,24,24,24,24,24,24,24,25,25,21,23,20,18,20,27,27,17,26,30,31,10,31,32,32,32,32,32,32,32,9,32,15,32,32,14,32,12,32,32,8,32,32,23,16,23,20,32,27,17,26,30,31,10,31,32,32,32,32,32,32,32,9,32,15,32,32,14,32,11,32,32,7,32,32,33,27,33,27,33,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32};
+static yyconst short yy_nxt[420][34] = {
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{12,13,12,14,15,16,17,18,18,19,20,21,21,22,23,23,24,23,15,15,15,25,26,27,28,28,29,22,30,31,23,23,23,24},
+{32,32,32,32,32,32,33,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32},
+{34,34,34,35,36,37,34,34,34,34,34,34,34,35,34,34,34,34,35,35,35,34,34,34,34,34,34,35,34,34,34,34,34,34},
+{38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,39,38,38,38,38},
+{40,40,40,40,40,40,41,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40},
+{42,43,42,42,42,42,44,42,42,42,42,42,42,42,42,42,45,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42},
+{46,46,46,46,46,46,47,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46},
+{48,49,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,50,48,48,48,48,48},
+{38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,51,38,38,38,38},
+{46,46,46,46,46,46,52,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46},
+{53,54,53,53,53,53,53,53,53,53,53,53,53,53,53,53,55,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53},
+{56,56,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{56,56,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,57,58,58,0,0,0,0,0,0,0,58,0,0,0,0,58,58,58,0,0,0,0,0,0,58,0,0,0,0,0,0},
+{0,0,0,58,58,58,0,0,0,0,0,0,0,58,0,0,0,0,58,58,58,0,0,0,0,0,0,58,0,0,0,0,0,0},
+{0,0,0,58,59,58,0,0,0,0,0,0,0,58,0,0,0,0,58,58,58,0,0,0,0,0,0,58,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,60,61,61,61,61,61,61,0,61,61,0,61,0,0,0,0,0,0,61,61,61,0,61,0,61,61,61,0},
+{0,0,0,0,0,0,62,61,61,61,61,61,61,0,61,61,0,61,0,0,0,0,0,0,61,61,61,0,61,0,61,61,61,0},
+{0,0,0,0,0,0,63,61,61,61,61,61,61,0,61,61,0,61,0,0,0,0,0,0,61,61,61,0,61,0,61,61,61,0},
+{0,0,0,0,0,0,0,61,61,61,61,61,61,64,61,61,0,61,0,0,0,0,0,0,61,61,61,0,61,0,61,61,61,0},
+{0,0,0,58,58,58,0,0,0,0,0,0,0,58,0,0,0,0,58,58,58,0,0,0,0,0,0,58,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,61,61,61,61,61,61,0,61,61,0,61,0,0,0,0,0,0,61,61,61,0,61,0,61,61,61,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,0,0,66,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,67,0,68,68,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,69,0,0,0,0,0,0,0,0,0,0,0,70,0,71,71,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,72,61,61,61,61,61,61,0,61,61,0,61,0,0,0,0,0,0,61,61,61,0,61,0,61,61,61,0},
+{0,0,0,0,0,0,0,73,73,73,73,73,73,0,73,73,0,73,0,0,0,0,0,0,74,74,73,0,75,0,73,73,73,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{32,32,32,32,32,32,0,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32},
+{76,77,77,78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{79,79,79,79,0,0,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79},
+{79,79,79,79,0,0,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79},
+{0,0,0,0,80,81,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,0,83,83,83,83},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,0,0,0,0},
+{40,40,40,40,40,40,0,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40},
+{85,86,86,87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{88,88,88,88,88,88,0,88,88,88,88,88,88,88,88,88,0,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88},
+{88,88,88,88,88,88,0,88,88,88,88,88,88,88,88,88,0,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88},
+{89,90,90,91,0,0,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{93,93,93,93,93,93,93,94,93,93,93,95,96,93,93,93,93,93,93,93,93,93,93,93,97,93,93,93,93,93,93,93,93,93},
+{98,98,98,98,98,98,0,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98},
+{89,90,90,91,0,0,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,0,99,99,99,99,99},
+{99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,0,99,99,99,99,99},
+{0,0,0,0,0,0,0,100,100,100,100,100,100,0,100,100,0,100,0,0,0,0,0,0,0,0,100,0,101,0,100,100,100,0},
+{102,102,102,103,0,0,0,0,0,0,0,104,104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,0,0,0,0},
+{105,106,106,107,0,0,92,0,0,0,0,108,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,109,110,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{56,56,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{111,0,0,112,112,112,111,111,111,111,111,111,111,112,111,111,111,111,112,112,112,111,111,111,111,111,111,112,111,111,111,111,111,111},
+{0,0,0,58,58,58,0,0,0,0,0,0,0,58,0,0,0,0,58,58,58,0,0,0,0,0,0,58,0,0,0,0,0,0},
+{0,0,0,113,113,113,0,0,0,0,0,0,0,113,0,0,0,0,113,113,113,0,0,0,0,0,0,113,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,61,61,61,61,61,61,0,61,61,0,61,0,0,0,0,0,0,61,61,61,0,61,0,61,61,61,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,114,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,115,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,69,0,0,0,0,0,0,0,0,0,0,0,0,0,116,116,0,0,0,0,0,0,0,0},
+{0,0,0,117,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,117,0,0,0,0,118,118,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,69,0,0,0,0,0,0,0,0,0,0,0,119,0,120,120,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,69,0,0,0,0,0,0,0,0,0,0,0,70,0,71,71,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,121,121,121,121,121,121,0,121,121,0,121,0,0,0,0,0,0,121,121,121,0,75,0,121,121,121,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,122,122,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{123,124,124,78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{125,125,125,126,0,0,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{79,79,79,79,0,0,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79},
+{0,0,0,0,80,81,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,129,129,129,0,0,0,0,0,0,0,129,0,0,0,0,129,129,129,0,0,0,0,0,0,129,0,0,0,0,0,0},
+{83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,0,83,83,83,83},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{130,131,131,87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{132,132,132,133,0,0,134,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{88,88,88,88,88,88,0,88,88,88,88,88,88,88,88,88,0,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88},
+{136,137,137,91,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{138,138,138,139,0,0,140,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,141,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,142,0,0,0,0,0,0,142,0,0,0,0,0,0,142,142,142,0,0,0,142,142,0,0},
+{0,0,0,0,0,0,0,0,0,0,143,0,0,0,0,0,0,143,0,0,0,0,0,0,143,143,143,0,0,0,143,143,0,0},
+{0,0,0,0,0,0,0,0,0,0,144,0,0,0,0,0,0,144,0,0,0,0,0,0,144,144,144,0,0,0,144,144,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,0,0,0,0,0,0,0,0,0},
+{98,98,98,98,98,98,0,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98},
+{99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,0,99,99,99,99,99},
+{0,0,0,0,0,0,0,146,146,146,146,146,146,0,146,146,0,146,0,0,0,0,0,0,146,146,146,0,101,0,146,146,146,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{147,147,147,103,0,0,0,0,0,0,0,104,104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,148,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,149,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{150,151,151,107,0,0,0,0,0,0,0,108,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{152,152,152,153,0,0,140,0,0,0,0,108,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,155,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,156,0,0,0,0,0,0,156,0,0,0,0,0,0,156,156,156,0,0,0,156,156,0,0},
+{0,0,0,0,0,0,0,0,0,0,157,0,0,0,0,0,0,157,0,0,0,0,0,0,157,157,157,0,0,0,157,157,0,0},
+{111,0,0,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111},
+{111,0,0,112,112,112,111,111,111,111,111,111,111,112,111,111,111,111,112,112,112,111,111,111,111,111,111,112,111,111,111,111,111,111},
+{0,0,0,113,113,113,0,0,0,0,0,0,0,113,0,0,0,0,113,113,113,0,0,0,0,0,0,113,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,69,0,0,0,0,0,0,0,0,0,0,0,0,0,116,116,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,118,118,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,158,158,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,69,0,0,0,0,0,0,0,0,0,0,0,0,0,159,159,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,121,121,121,121,121,121,0,121,121,0,121,0,0,0,0,0,0,121,121,121,0,75,0,121,121,121,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,122,122,0,0,0,0,0,0,0,0},
+{123,124,124,78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{125,125,125,126,0,0,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{160,160,160,126,0,0,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{162,77,77,163,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164},
+{0,0,0,129,129,129,0,0,0,0,0,0,0,129,0,0,0,0,129,129,129,0,0,0,0,0,0,129,0,0,0,0,0,0},
+{130,131,131,87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{132,132,132,133,0,0,134,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{165,165,165,133,0,0,134,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,166,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{167,86,86,168,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169},
+{136,137,137,91,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{138,138,138,139,0,0,140,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{170,170,170,139,0,0,140,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,171,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{172,90,90,173,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174},
+{0,0,0,0,0,0,0,0,0,0,175,0,0,0,0,0,0,175,0,0,0,0,0,0,175,175,175,0,0,0,175,175,0,0},
+{0,0,0,0,0,0,0,0,0,0,176,0,0,0,0,0,0,176,0,0,0,0,0,0,176,176,176,0,0,0,176,176,0,0},
+{0,0,0,0,0,0,0,0,0,0,177,0,0,0,0,0,0,177,0,0,0,0,0,0,177,177,177,0,0,0,177,177,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,178,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,146,146,146,146,146,146,0,146,146,0,146,0,0,0,0,0,0,146,146,146,0,101,0,146,146,146,0},
+{147,147,147,103,0,0,0,0,0,0,0,104,104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{179,102,102,180,181,181,181,181,181,181,181,182,182,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,183,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{150,151,151,107,0,0,0,0,0,0,0,108,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{152,152,152,153,0,0,140,0,0,0,0,108,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{184,184,184,153,0,0,140,0,0,0,0,108,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,185,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{186,106,106,187,188,188,188,188,188,188,188,189,189,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,190,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,191,0,0,0,0,0,0,191,0,0,0,0,0,0,191,191,191,0,0,0,191,191,0,0},
+{0,0,0,0,0,0,0,0,0,0,192,0,0,0,0,0,0,192,0,0,0,0,0,0,192,192,192,0,0,0,192,192,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,158,158,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,69,0,0,0,0,0,0,0,0,0,0,0,0,0,159,159,0,0,0,0,0,0,0,0},
+{160,160,160,126,0,0,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{193,194,194,195,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196},
+{197,124,124,163,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164},
+{162,77,77,198,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164},
+{162,77,77,163,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164},
+{165,165,165,133,0,0,134,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{199,200,200,201,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202},
+{203,131,131,168,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169},
+{167,86,86,204,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169},
+{167,86,86,168,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169},
+{170,170,170,139,0,0,140,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{205,206,206,207,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208},
+{209,137,137,173,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174},
+{172,90,90,210,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174},
+{172,90,90,173,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,211,0,0,0,0,0,0,211,0,0,0,0,0,0,211,211,211,0,0,0,211,211,0,0},
+{0,0,0,0,0,0,0,0,0,0,212,0,0,0,0,0,0,212,0,0,0,0,0,0,212,212,212,0,0,0,212,212,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{213,147,147,180,181,181,181,181,181,181,181,182,182,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181},
+{179,102,102,214,181,181,181,181,181,181,181,182,182,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181},
+{179,102,102,180,181,181,181,181,181,181,181,182,182,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181},
+{179,102,102,180,181,181,181,181,181,181,215,182,182,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,216,0,0,0},
+{184,184,184,153,0,0,140,0,0,0,0,108,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{217,218,218,219,220,220,220,220,220,220,220,221,221,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220},
+{222,151,151,187,188,188,188,188,188,188,188,189,189,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188},
+{186,106,106,223,188,188,188,188,188,188,188,189,189,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188},
+{186,106,106,187,188,188,188,188,188,188,188,189,189,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188},
+{186,106,106,187,188,188,188,188,188,188,224,189,189,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,225,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,226,0,0,0,0,0,0,226,0,0,0,0,0,0,226,226,226,0,0,0,226,226,0,0},
+{0,0,0,0,0,0,0,0,0,0,227,0,0,0,0,0,0,227,0,0,0,0,0,0,227,227,227,0,0,0,227,227,0,0},
+{228,229,229,195,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196},
+{125,125,125,126,0,0,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{193,194,194,230,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196},
+{193,194,194,195,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196},
+{197,124,124,163,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164},
+{162,77,77,198,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164,164},
+{231,232,232,201,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202},
+{132,132,132,133,0,0,134,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{199,200,200,233,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202},
+{199,200,200,201,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202},
+{203,131,131,168,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169},
+{167,86,86,204,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169},
+{234,235,235,207,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208},
+{138,138,138,139,0,0,140,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{205,206,206,236,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208},
+{205,206,206,207,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208},
+{209,137,137,173,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174},
+{172,90,90,210,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174},
+{0,0,0,0,0,0,0,0,0,0,237,0,0,0,0,0,0,237,0,0,0,0,0,0,237,237,237,0,0,0,237,237,0,0},
+{0,0,0,0,0,0,0,0,0,0,238,0,0,0,0,0,0,238,0,0,0,0,0,0,238,238,238,0,0,0,238,238,0,0},
+{213,147,147,180,181,181,181,181,181,181,181,182,182,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181},
+{179,102,102,214,181,181,181,181,181,181,181,182,182,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181},
+{179,102,102,180,181,181,181,181,181,181,181,182,182,181,239,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{241,242,242,219,220,220,220,220,220,220,220,221,221,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220},
+{152,152,152,153,0,0,140,0,0,0,0,108,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{217,218,218,243,220,220,220,220,220,220,220,221,221,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220},
+{217,218,218,219,220,220,220,220,220,220,220,221,221,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220},
+{217,218,218,219,220,220,220,220,220,220,244,221,221,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220},
+{222,151,151,187,188,188,188,188,188,188,188,189,189,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188},
+{186,106,106,223,188,188,188,188,188,188,188,189,189,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188},
+{186,106,106,187,188,188,188,188,188,188,188,189,189,188,245,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,247,0,0,0,0,0,0,247,0,0,0,0,0,0,247,247,247,0,0,0,247,247,0,0},
+{0,0,0,0,0,0,0,0,0,0,248,0,0,0,0,0,0,248,0,0,0,0,0,0,248,248,248,0,0,0,248,248,0,0},
+{228,229,229,195,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196},
+{125,125,125,126,0,0,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{193,194,194,230,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196,196},
+{231,232,232,201,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202},
+{132,132,132,133,0,0,134,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{199,200,200,233,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202,202},
+{234,235,235,207,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208},
+{138,138,138,139,0,0,140,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{205,206,206,236,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208,208},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,249,0,0,0,0,0,0,249,0,0,0,0,0,0,249,249,249,0,0,0,249,249,0,0},
+{179,102,102,180,181,181,181,181,181,181,181,182,182,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,250,181,181,181},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,251,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{241,242,242,219,220,220,220,220,220,220,220,221,221,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220},
+{152,152,152,153,0,0,140,0,0,0,0,108,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{217,218,218,243,220,220,220,220,220,220,220,221,221,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220},
+{217,218,218,219,220,220,220,220,220,220,220,221,221,220,252,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220},
+{186,106,106,187,188,188,188,188,188,188,188,189,189,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,253,188,188,188},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,255,0,0,0,0,0,0,255,0,0,0,0,0,0,255,255,255,0,0,0,255,255,0,0},
+{0,0,0,0,0,0,0,0,0,0,256,0,0,0,0,0,0,256,0,0,0,0,0,0,256,256,256,0,0,0,256,256,0,0},
+{179,102,102,180,181,181,181,181,181,181,181,182,182,181,181,181,181,257,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181},
+{0,0,0,0,0,0,0,0,0,0,258,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{217,218,218,219,220,220,220,220,220,220,220,221,221,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,259,220,220,220},
+{186,106,106,187,188,188,188,188,188,188,188,189,189,188,188,188,188,260,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188},
+{0,0,0,0,0,0,0,0,0,0,261,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,262,0,0,0,0,0,0,262,0,0,0,0,0,0,262,262,262,0,0,0,262,262,0,0},
+{0,0,0,0,0,0,0,0,0,0,263,0,0,0,0,0,0,263,0,0,0,0,0,0,263,263,263,0,0,0,263,263,0,0},
+{179,102,102,180,181,181,181,181,181,181,181,182,182,181,181,264,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181},
+{265,265,265,266,0,0,267,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{217,218,218,219,220,220,220,220,220,220,220,221,221,220,220,220,220,268,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220},
+{186,106,106,187,188,188,188,188,188,188,188,189,189,188,188,269,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188},
+{270,270,270,271,0,0,272,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,273,0,0,0,0,0,0,273,0,0,0,0,0,0,273,273,273,0,0,0,273,273,0,0},
+{0,0,0,0,0,0,0,0,0,0,274,0,0,0,0,0,0,274,0,0,0,0,0,0,274,274,274,0,0,0,274,274,0,0},
+{179,102,102,180,181,181,181,181,181,181,275,182,182,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181},
+{276,276,276,266,0,0,267,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,277,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{278,278,278,278,278,278,0,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278},
+{217,218,218,219,220,220,220,220,220,220,220,221,221,220,220,279,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220},
+{186,106,106,187,188,188,188,188,188,188,280,189,189,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188},
+{281,281,281,271,0,0,272,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,282,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{283,283,283,283,283,283,0,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283},
+{0,0,0,0,0,0,0,0,0,0,284,0,0,0,0,0,0,284,0,0,0,0,0,0,284,284,284,0,0,0,284,284,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{285,286,286,287,181,181,288,181,181,181,181,182,182,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181},
+{276,276,276,266,0,0,267,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{289,265,265,290,291,291,292,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291},
+{0,0,0,0,0,0,293,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{217,218,218,219,220,220,220,220,220,220,294,221,221,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220},
+{295,296,296,297,188,188,298,188,188,188,188,189,189,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188},
+{281,281,281,271,0,0,272,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{299,270,270,300,301,301,302,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301},
+{0,0,0,0,0,0,303,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{304,305,305,287,181,181,288,181,181,181,181,182,182,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181},
+{305,305,305,306,0,0,267,0,0,0,0,104,104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{179,102,102,307,181,181,181,181,181,181,181,182,182,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181},
+{308,309,309,310,311,311,181,311,311,311,311,312,312,311,311,311,311,311,311,311,311,311,311,311,311,311,311,311,311,311,311,311,311,311},
+{313,276,276,290,291,291,292,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291},
+{289,265,265,314,291,291,292,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291},
+{289,265,265,290,291,291,292,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291},
+{315,316,316,317,318,318,292,318,318,318,318,318,318,318,318,318,318,318,318,318,318,318,318,318,318,318,318,318,318,318,318,318,318,318},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{319,320,320,321,220,220,322,220,220,220,220,221,221,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220},
+{323,324,324,297,188,188,298,188,188,188,188,189,189,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188},
+{325,325,325,326,0,0,327,0,0,0,0,108,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{186,106,106,328,188,188,188,188,188,188,188,189,189,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188},
+{329,330,330,331,332,332,188,332,332,332,332,333,333,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332},
+{334,281,281,300,301,301,302,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301},
+{299,270,270,335,301,301,302,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301},
+{299,270,270,300,301,301,302,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301},
+{336,337,337,338,339,339,302,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{304,305,305,287,181,181,288,181,181,181,181,182,182,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181},
+{305,305,305,306,0,0,267,0,0,0,0,104,104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,340,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{341,286,286,342,343,343,344,343,343,343,343,345,345,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343},
+{213,147,147,180,181,181,346,181,181,181,181,182,182,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181},
+{147,147,147,103,0,0,293,0,0,0,0,104,104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{179,102,102,214,181,181,346,181,181,181,181,182,182,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181},
+{179,102,102,180,181,181,346,181,181,181,181,182,182,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181},
+{179,102,102,180,181,181,346,181,181,181,215,182,182,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181},
+{313,276,276,290,291,291,292,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291},
+{289,265,265,314,291,291,292,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291},
+{313,276,276,290,291,291,347,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291},
+{276,276,276,266,0,0,348,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{289,265,265,314,291,291,347,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291},
+{289,265,265,290,291,291,347,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291,291},
+{349,350,350,321,220,220,322,220,220,220,220,221,221,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220},
+{325,325,325,326,0,0,327,0,0,0,0,108,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{217,218,218,351,220,220,220,220,220,220,220,221,221,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220},
+{352,353,353,354,355,355,220,355,355,355,355,356,356,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355,355},
+{323,324,324,297,188,188,298,188,188,188,188,189,189,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188},
+{325,325,325,326,0,0,327,0,0,0,0,108,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{357,357,357,326,0,0,327,0,0,0,0,108,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,358,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{283,283,283,283,283,283,0,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283},
+{359,296,296,360,361,361,362,361,361,361,361,363,363,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361},
+{222,151,151,187,188,188,364,188,188,188,188,189,189,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188},
+{152,152,152,153,0,0,365,0,0,0,0,108,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{186,106,106,223,188,188,364,188,188,188,188,189,189,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188},
+{186,106,106,187,188,188,364,188,188,188,188,189,189,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188},
+{186,106,106,187,188,188,364,188,188,188,224,189,189,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188},
+{334,281,281,300,301,301,302,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301},
+{299,270,270,335,301,301,302,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301},
+{334,281,281,300,301,301,366,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301},
+{281,281,281,271,0,0,367,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{299,270,270,335,301,301,366,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301},
+{299,270,270,300,301,301,366,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301,301},
+{341,286,286,368,343,343,344,343,343,343,343,345,345,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343},
+{369,305,305,368,343,343,344,343,343,343,343,345,345,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343},
+{341,286,286,370,343,343,344,343,343,343,343,345,345,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343},
+{341,286,286,368,343,343,344,343,343,343,343,345,345,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343},
+{371,372,372,373,374,374,344,374,374,374,374,375,375,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374},
+{341,286,286,368,343,343,344,343,343,343,376,345,345,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343},
+{179,102,102,180,181,181,181,181,181,181,181,182,182,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181},
+{315,316,316,317,318,318,292,318,318,318,318,318,318,318,318,318,318,318,318,318,318,318,318,318,318,318,318,318,318,318,318,318,318,318},
+{278,278,278,278,278,278,0,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278},
+{349,350,350,321,220,220,322,220,220,220,220,221,221,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220},
+{325,325,325,326,0,0,327,0,0,0,0,108,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{377,320,320,378,379,379,380,379,379,379,379,381,381,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379},
+{241,242,242,219,220,220,382,220,220,220,220,221,221,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220},
+{152,152,152,153,0,0,365,0,0,0,0,108,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{217,218,218,243,220,220,382,220,220,220,220,221,221,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220},
+{217,218,218,219,220,220,382,220,220,220,220,221,221,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220},
+{217,218,218,219,220,220,382,220,220,220,244,221,221,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220},
+{357,357,357,326,0,0,327,0,0,0,0,108,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{377,320,320,383,379,379,380,379,379,379,379,381,381,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379},
+{384,324,324,385,361,361,362,361,361,361,361,363,363,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361},
+{359,296,296,386,361,361,362,361,361,361,361,363,363,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361},
+{359,296,296,385,361,361,362,361,361,361,361,363,363,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361},
+{387,388,388,389,390,390,362,390,390,390,390,391,391,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390},
+{359,296,296,385,361,361,362,361,361,361,392,363,363,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361},
+{186,106,106,187,188,188,188,188,188,188,188,189,189,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{336,337,337,338,339,339,302,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339,339},
+{283,283,283,283,283,283,0,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283},
+{341,286,286,370,343,343,344,343,343,343,343,345,345,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343},
+{369,305,305,368,343,343,344,343,343,343,343,345,345,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343},
+{341,286,286,370,343,343,344,343,343,343,343,345,345,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343},
+{369,305,305,368,343,343,393,343,343,343,343,345,345,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343},
+{305,305,305,306,0,0,348,0,0,0,0,104,104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{341,286,286,370,343,343,393,343,343,343,343,345,345,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343},
+{341,286,286,368,343,343,393,343,343,343,343,345,345,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343},
+{341,286,286,368,343,343,393,343,343,343,376,345,345,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343},
+{341,286,286,368,343,343,344,343,343,343,343,345,345,343,394,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343},
+{395,350,350,383,379,379,380,379,379,379,379,381,381,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379},
+{377,320,320,396,379,379,380,379,379,379,379,381,381,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379},
+{377,320,320,383,379,379,380,379,379,379,379,381,381,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379},
+{397,398,398,399,400,400,380,400,400,400,400,401,401,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400},
+{377,320,320,383,379,379,380,379,379,379,402,381,381,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379},
+{217,218,218,219,220,220,220,220,220,220,220,221,221,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220},
+{377,320,320,396,379,379,380,379,379,379,379,381,381,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379},
+{384,324,324,385,361,361,362,361,361,361,361,363,363,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361},
+{359,296,296,386,361,361,362,361,361,361,361,363,363,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361},
+{359,296,296,386,361,361,362,361,361,361,361,363,363,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361},
+{384,324,324,385,361,361,403,361,361,361,361,363,363,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361},
+{325,325,325,326,0,0,404,0,0,0,0,108,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{359,296,296,386,361,361,403,361,361,361,361,363,363,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361},
+{359,296,296,385,361,361,403,361,361,361,361,363,363,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361},
+{359,296,296,385,361,361,403,361,361,361,392,363,363,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361},
+{359,296,296,385,361,361,362,361,361,361,361,363,363,361,405,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361},
+{371,372,372,373,374,374,344,374,374,374,374,375,375,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374},
+{341,286,286,368,343,343,344,343,343,343,343,345,345,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,406,343,343,343},
+{395,350,350,383,379,379,380,379,379,379,379,381,381,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379},
+{377,320,320,396,379,379,380,379,379,379,379,381,381,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379},
+{395,350,350,383,379,379,407,379,379,379,379,381,381,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379},
+{325,325,325,326,0,0,404,0,0,0,0,108,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{377,320,320,396,379,379,407,379,379,379,379,381,381,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379},
+{377,320,320,383,379,379,407,379,379,379,379,381,381,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379},
+{377,320,320,383,379,379,407,379,379,379,402,381,381,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379},
+{377,320,320,383,379,379,380,379,379,379,379,381,381,379,408,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379},
+{387,388,388,389,390,390,362,390,390,390,390,391,391,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390},
+{283,283,283,283,283,283,0,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283,283},
+{359,296,296,385,361,361,362,361,361,361,361,363,363,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,409,361,361,361},
+{341,286,286,368,343,343,344,343,343,343,343,345,345,343,343,343,343,410,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343},
+{397,398,398,399,400,400,380,400,400,400,400,401,401,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400},
+{377,320,320,383,379,379,380,379,379,379,379,381,381,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,411,379,379,379},
+{359,296,296,385,361,361,362,361,361,361,361,363,363,361,361,361,361,412,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361},
+{341,286,286,368,343,343,344,343,343,343,343,345,345,343,343,413,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343},
+{377,320,320,383,379,379,380,379,379,379,379,381,381,379,379,379,379,414,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379},
+{359,296,296,385,361,361,362,361,361,361,361,363,363,361,361,415,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361},
+{341,286,286,368,343,343,344,343,343,343,416,345,345,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343},
+{377,320,320,383,379,379,380,379,379,379,379,381,381,379,379,417,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379},
+{359,296,296,385,361,361,362,361,361,361,418,363,363,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361},
+{341,286,286,368,343,343,344,343,343,343,343,345,345,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343,343},
+{377,320,320,383,379,379,380,379,379,379,419,381,381,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379},
+{359,296,296,385,361,361,362,361,361,361,361,363,363,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361,361},
+{377,320,320,383,379,379,380,379,379,379,379,381,381,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379,379},
+};
+static yyconst short yy_accept[420] = {0,0,13,0,0,12,0,0,0,0,0,0,1,1,63,63,63,22,72,72,72,72,64,72,73,63,63,63,66,72,73,51,13,10,5,5,6,6,57,53,12,18,31,31,25,42,30,25,47,47,49,54,27,34,35,34,1,1,64,2,17,72,21,23,59,62,60,61,67,70,67,66,9,45,65,44,10,10,11,5,7,4,3,57,56,18,18,19,31,25,25,26,29,38,38,37,37,39,30,47,48,46,54,54,54,27,27,27,27,37,37,1,1,2,24,52,67,71,69,68,67,45,65,10,10,10,11,15,10,3,18,18,18,19,14,18,25,25,25,26,41,25,40,37,37,39,48,54,54,54,27,27,27,27,27,27,37,37,69,67,10,10,10,10,10,18,18,18,18,18,25,25,25,25,25,40,37,37,39,54,54,54,54,54,27,27,27,27,27,27,27,37,37,10,10,10,10,10,10,18,18,18,18,18,18,25,25,25,25,25,25,37,37,54,54,54,54,27,27,27,27,27,27,27,27,27,37,37,10,10,10,18,18,18,25,25,25,32,37,54,54,27,27,27,27,27,27,33,37,37,54,54,27,27,27,37,37,54,54,27,27,27,37,37,54,54,54,54,27,27,27,27,27,37,32,54,54,54,54,27,27,27,27,27,33,54,54,54,54,54,54,54,54,55,27,27,27,27,27,27,27,27,27,28,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,54,54,54,54,54,54,54,54,54,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,28,27,27,54,54,54,54,54,54,54,54,54,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,54,54,27,27,27,27,27,27,27,27,27,27,27,54,27,27,27,54,27,27,54,27,27,54,27,27,27};
+static yyconst short yy_start_state[22] = {1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11};
+YY_DECL
+{
+	int yy_current_state;
+	char *yy_cp, *yy_bp, *yy_end, *yy_last;
+	int yy_act;
+	YY_BUFFER_STATE yy_b;
+	struct yyguts_t *yyg = (struct yyguts_t *) yyscanner;
+	yylval = yylval_param;
+	yylloc = yylloc_param;
+	if (!YYG(yy_init))
+	{
+		YYG(yy_init) = 1;
+		if (!yyin)
+			yyin = stdin;
+		if (!yyout)
+			yyout = stdout;
+	}
+	{
+
+	}
+	while (1)
+	{
+		if (YYG(yy_hold_ptr))
+		{
+			*YYG(yy_hold_ptr) = YYG(yy_hold_char);
+			YYG(yy_hold_ptr) = NULL;
+		}
+		if (!YY_CURRENT_BUFFER)
+			YY_CURRENT_BUFFER_LVALUE = yy_create_buffer(yyin, YY_BUF_SIZE, yyscanner);
+		yy_b = YY_CURRENT_BUFFER;
+		if (!yy_b->yy_filled)
+			yy_fill_buffer(yy_b, yyscanner);
+		yy_bp = yy_b->yy_ch_buf + yy_b->yy_pos;
+		if (yy_b->yy_pos >= yy_b->yy_n_chars)
+		{
+			yytext = yy_bp;
+			yyleng = 0;
+			switch (YY_START)
+			{
+				case 0:
+					yy_act = 74;
+					goto do_action;
+				case 1:
+					yy_act = 16;
+					goto do_action;
+				case 2:
+					yy_act = 8;
+					goto do_action;
+				case 3:
+					yy_act = 58;
+					goto do_action;
+				case 4:
+					yy_act = 20;
+					goto do_action;
+				case 5:
+					yy_act = 43;
+					goto do_action;
+				case 6:
+					yy_act = 43;
+					goto do_action;
+				case 7:
+					yy_act = 50;
+					goto do_action;
+				case 8:
+					yy_act = 58;
+					goto do_action;
+				case 9:
+					yy_act = 43;
+					goto do_action;
+				case 10:
+					yy_act = 36;
+					goto do_action;
+				default:
+					yyterminate();
+			}
+		}
+		yy_current_state = yy_start_state[YY_START * 2 + ((yy_b->yy_pos == 0 || yy_b->yy_ch_buf[yy_b->yy_pos - 1] == '\n') ? 1 : 0)];
+		yy_cp = yy_bp;
+		yy_end = yy_b->yy_ch_buf + yy_b->yy_n_chars;
+		yy_act = 0;
+		yy_last = NULL;
+		while (yy_cp < yy_end)
+		{
+			yy_current_state = yy_nxt[yy_current_state][yy_ec[(unsigned char) *yy_cp]];
+			if (yy_current_state == 0)
+				break;
+			yy_cp++;
+			if (yy_accept[yy_current_state])
+			{
+				yy_act = yy_accept[yy_current_state];
+				yy_last = yy_cp;
+			}
+		}
+		if (!yy_act)
+			YY_FATAL_ERROR("flex scanner jammed");
+		yy_cp = yy_last;
+		yytext = yy_bp;
+		yyleng = (int) (yy_cp - yy_bp);
+		YYG(yy_hold_ptr) = yy_cp;
+		YYG(yy_hold_char) = *yy_cp;
+		*yy_cp = '\0';
+		yy_b->yy_pos = (int) (yy_cp - yy_b->yy_ch_buf);
+do_action:
+		switch (yy_act)
+		{
+			case 1:
+YY_RULE_SETUP
+{
+					/* ignore */
+				}
+	YY_BREAK
+			case 2:
+YY_RULE_SETUP
+{
+					/* Set location in case of syntax error in comment */
+					SET_YYLLOC();
+					yyextra->xcdepth = 0;
+					BEGIN(xc);
+					/* Put back any characters past slash-star; see above */
+					yyless(2);
+				}
+	YY_BREAK
+			case 3:
+YY_RULE_SETUP
+{
+					(yyextra->xcdepth)++;
+					/* Put back any characters past slash-star; see above */
+					yyless(2);
+				}
+	YY_BREAK
+			case 4:
+YY_RULE_SETUP
+{
+					if (yyextra->xcdepth <= 0)
+						BEGIN(INITIAL);
+					else
+						(yyextra->xcdepth)--;
+				}
+	YY_BREAK
+			case 5:
+YY_RULE_SETUP
+{
+					/* ignore */
+				}
+	YY_BREAK
+			case 6:
+YY_RULE_SETUP
+{
+					/* ignore */
+				}
+	YY_BREAK
+			case 7:
+YY_RULE_SETUP
+{
+					/* ignore */
+				}
+	YY_BREAK
+			case 8:
+YY_RULE_SETUP
+{ yyerror("unterminated /* comment"); }
+	YY_BREAK
+			case 9:
+YY_RULE_SETUP
+{
+					/* Binary bit type.
+					 * At some point we should simply pass the string
+					 * forward to the parser and label it there.
+					 * In the meantime, place a leading "b" on the string
+					 * to mark it for the input routine as a binary string.
+					 */
+					SET_YYLLOC();
+					BEGIN(xb);
+					startlit();
+					addlitchar('b', yyscanner);
+				}
+	YY_BREAK
+			case 10:
+			case 11:
+YY_RULE_SETUP
+{
+					yyless(1);
+					BEGIN(INITIAL);
+					yylval->str = litbufdup(yyscanner);
+					return BCONST;
+				}
+	YY_BREAK
+			case 12:
+			case 13:
+YY_RULE_SETUP
+{
+					addlit(yytext, yyleng, yyscanner);
+				}
+	YY_BREAK
+			case 14:
+			case 15:
+YY_RULE_SETUP
+{
+					/* ignore */
+				}
+	YY_BREAK
+			case 16:
+YY_RULE_SETUP
+{ yyerror("unterminated bit string literal"); }
+	YY_BREAK
+			case 17:
+YY_RULE_SETUP
+{
+					/* Hexadecimal bit type.
+					 * At some point we should simply pass the string
+					 * forward to the parser and label it there.
+					 * In the meantime, place a leading "x" on the string
+					 * to mark it for the input routine as a hex string.
+					 */
+					SET_YYLLOC();
+					BEGIN(xh);
+					startlit();
+					addlitchar('x', yyscanner);
+				}
+	YY_BREAK
+			case 18:
+			case 19:
+YY_RULE_SETUP
+{
+					yyless(1);
+					BEGIN(INITIAL);
+					yylval->str = litbufdup(yyscanner);
+					return XCONST;
+				}
+	YY_BREAK
+			case 20:
+YY_RULE_SETUP
+{ yyerror("unterminated hexadecimal string literal"); }
+	YY_BREAK
+			case 21:
+YY_RULE_SETUP
+{
+					/* National character.
+					 * We will pass this along as a normal character string,
+					 * but preceded with an internally-generated "NCHAR".
+					 */
+					const ScanKeyword *keyword;
+
+					SET_YYLLOC();
+					yyless(1);				/* eat only 'n' this time */
+
+					keyword = ScanKeywordLookup("nchar",
+												yyextra->keywords,
+												yyextra->num_keywords);
+					if (keyword != NULL)
+					{
+						yylval->keyword = keyword->name;
+						return keyword->value;
+					}
+					else
+					{
+						/* If NCHAR isn't a keyword, just return "n" */
+						yylval->str = pstrdup("n");
+						return IDENT;
+					}
+				}
+	YY_BREAK
+			case 22:
+YY_RULE_SETUP
+{
+					yyextra->warn_on_first_escape = true;
+					yyextra->saw_non_ascii = false;
+					SET_YYLLOC();
+					if (standard_conforming_strings)
+						BEGIN(xq);
+					else
+						BEGIN(xe);
+					startlit();
+				}
+	YY_BREAK
+			case 23:
+YY_RULE_SETUP
+{
+					yyextra->warn_on_first_escape = false;
+					yyextra->saw_non_ascii = false;
+					SET_YYLLOC();
+					BEGIN(xe);
+					startlit();
+				}
+	YY_BREAK
+			case 24:
+YY_RULE_SETUP
+{
+					SET_YYLLOC();
+					if (!standard_conforming_strings)
+						ereport(ERROR,
+								(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+								 errmsg("unsafe use of string constant with Unicode escapes"),
+								 errdetail("String constants with Unicode escapes cannot be used when standard_conforming_strings is off."),
+								 lexer_errposition()));
+					BEGIN(xus);
+					startlit();
+				}
+	YY_BREAK
+			case 25:
+			case 26:
+YY_RULE_SETUP
+{
+					yyless(1);
+					BEGIN(INITIAL);
+					/*
+					 * check that the data remains valid if it might have been
+					 * made invalid by unescaping any chars.
+					 */
+					if (yyextra->saw_non_ascii)
+						pg_verifymbstr(yyextra->literalbuf,
+									   yyextra->literallen,
+									   false);
+					yylval->str = litbufdup(yyscanner);
+					return SCONST;
+				}
+	YY_BREAK
+			case 27:
+YY_RULE_SETUP
+{
+					/* throw back all but the quote */
+					yyless(1);
+					BEGIN(INITIAL);
+					yylval->str = litbuf_udeescape('\\', yyscanner);
+					return SCONST;
+				}
+	YY_BREAK
+			case 28:
+YY_RULE_SETUP
+{
+					BEGIN(INITIAL);
+					yylval->str = litbuf_udeescape(yytext[yyleng-2], yyscanner);
+					return SCONST;
+				}
+	YY_BREAK
+			case 29:
+YY_RULE_SETUP
+{
+					addlitchar('\'', yyscanner);
+				}
+	YY_BREAK
+			case 30:
+YY_RULE_SETUP
+{
+					addlit(yytext, yyleng, yyscanner);
+				}
+	YY_BREAK
+			case 31:
+YY_RULE_SETUP
+{
+					addlit(yytext, yyleng, yyscanner);
+				}
+	YY_BREAK
+			case 32:
+YY_RULE_SETUP
+{
+					pg_wchar c = strtoul(yytext+2, NULL, 16);
+
+					check_escape_warning(yyscanner);
+
+					if (is_utf16_surrogate_first(c))
+					{
+						yyextra->utf16_first_part = c;
+						BEGIN(xeu);
+					}
+					else if (is_utf16_surrogate_second(c))
+						yyerror("invalid Unicode surrogate pair");
+					else
+						addunicode(c, yyscanner);
+				}
+	YY_BREAK
+			case 33:
+YY_RULE_SETUP
+{
+					pg_wchar c = strtoul(yytext+2, NULL, 16);
+
+					if (!is_utf16_surrogate_second(c))
+						yyerror("invalid Unicode surrogate pair");
+
+					c = surrogate_pair_to_codepoint(yyextra->utf16_first_part, c);
+
+					addunicode(c, yyscanner);
+
+					BEGIN(xe);
+				}
+	YY_BREAK
+			case 34:
+YY_RULE_SETUP
+{ yyerror("invalid Unicode surrogate pair"); }
+	YY_BREAK
+			case 35:
+YY_RULE_SETUP
+{ yyerror("invalid Unicode surrogate pair"); }
+	YY_BREAK
+			case 36:
+YY_RULE_SETUP
+{ yyerror("invalid Unicode surrogate pair"); }
+	YY_BREAK
+			case 37:
+YY_RULE_SETUP
+{
+						ereport(ERROR,
+								(errcode(ERRCODE_INVALID_ESCAPE_SEQUENCE),
+								 errmsg("invalid Unicode escape"),
+								 errhint("Unicode escapes must be \\uXXXX or \\UXXXXXXXX."),
+								 lexer_errposition()));
+				}
+	YY_BREAK
+			case 38:
+YY_RULE_SETUP
+{
+					if (yytext[1] == '\'')
+					{
+						if (backslash_quote == BACKSLASH_QUOTE_OFF ||
+							(backslash_quote == BACKSLASH_QUOTE_SAFE_ENCODING &&
+							 PG_ENCODING_IS_CLIENT_ONLY(pg_get_client_encoding())))
+							ereport(ERROR,
+									(errcode(ERRCODE_NONSTANDARD_USE_OF_ESCAPE_CHARACTER),
+									 errmsg("unsafe use of \\' in a string literal"),
+									 errhint("Use '' to write quotes in strings. \\' is insecure in client-only encodings."),
+									 lexer_errposition()));
+					}
+					check_string_escape_warning(yytext[1], yyscanner);
+					addlitchar(unescape_single_char(yytext[1], yyscanner),
+							   yyscanner);
+				}
+	YY_BREAK
+			case 39:
+YY_RULE_SETUP
+{
+					unsigned char c = strtoul(yytext+1, NULL, 8);
+
+					check_escape_warning(yyscanner);
+					addlitchar(c, yyscanner);
+					if (c == '\0' || IS_HIGHBIT_SET(c))
+						yyextra->saw_non_ascii = true;
+				}
+	YY_BREAK
+			case 40:
+YY_RULE_SETUP
+{
+					unsigned char c = strtoul(yytext+2, NULL, 16);
+
+					check_escape_warning(yyscanner);
+					addlitchar(c, yyscanner);
+					if (c == '\0' || IS_HIGHBIT_SET(c))
+						yyextra->saw_non_ascii = true;
+				}
+	YY_BREAK
+			case 41:
+YY_RULE_SETUP
+{
+					/* ignore */
+				}
+	YY_BREAK
+			case 42:
+YY_RULE_SETUP
+{
+					/* This is only needed for \ just before EOF */
+					addlitchar(yytext[0], yyscanner);
+				}
+	YY_BREAK
+			case 43:
+YY_RULE_SETUP
+{ yyerror("unterminated quoted string"); }
+	YY_BREAK
+			case 44:
+YY_RULE_SETUP
+{
+					SET_YYLLOC();
+					yyextra->dolqstart = pstrdup(yytext);
+					BEGIN(xdolq);
+					startlit();
+				}
+	YY_BREAK
+			case 45:
+YY_RULE_SETUP
+{
+					SET_YYLLOC();
+					/* throw back all but the initial "$" */
+					yyless(1);
+					/* and treat it as {other} */
+					return yytext[0];
+				}
+	YY_BREAK
+			case 46:
+YY_RULE_SETUP
+{
+					if (strcmp(yytext, yyextra->dolqstart) == 0)
+					{
+						pfree(yyextra->dolqstart);
+						yyextra->dolqstart = NULL;
+						BEGIN(INITIAL);
+						yylval->str = litbufdup(yyscanner);
+						return SCONST;
+					}
+					else
+					{
+						/*
+						 * When we fail to match $...$ to dolqstart, transfer
+						 * the $... part to the output, but put back the final
+						 * $ for rescanning.  Consider $delim$...$junk$delim$
+						 */
+						addlit(yytext, yyleng-1, yyscanner);
+						yyless(yyleng-1);
+					}
+				}
+	YY_BREAK
+			case 47:
+YY_RULE_SETUP
+{
+					addlit(yytext, yyleng, yyscanner);
+				}
+	YY_BREAK
+			case 48:
+YY_RULE_SETUP
+{
+					addlit(yytext, yyleng, yyscanner);
+				}
+	YY_BREAK
+			case 49:
+YY_RULE_SETUP
+{
+					/* This is only needed for $ inside the quoted text */
+					addlitchar(yytext[0], yyscanner);
+				}
+	YY_BREAK
+			case 50:
+YY_RULE_SETUP
+{ yyerror("unterminated dollar-quoted string"); }
+	YY_BREAK
+			case 51:
+YY_RULE_SETUP
+{
+					SET_YYLLOC();
+					BEGIN(xd);
+					startlit();
+				}
+	YY_BREAK
+			case 52:
+YY_RULE_SETUP
+{
+					SET_YYLLOC();
+					BEGIN(xui);
+					startlit();
+				}
+	YY_BREAK
+			case 53:
+YY_RULE_SETUP
+{
+					char		   *ident;
+
+					BEGIN(INITIAL);
+					if (yyextra->literallen == 0)
+						yyerror("zero-length delimited identifier");
+					ident = litbufdup(yyscanner);
+					if (yyextra->literallen >= NAMEDATALEN)
+						truncate_identifier(ident, yyextra->literallen, true);
+					yylval->str = ident;
+					return IDENT;
+				}
+	YY_BREAK
+			case 54:
+YY_RULE_SETUP
+{
+					char		   *ident;
+
+					BEGIN(INITIAL);
+					if (yyextra->literallen == 0)
+						yyerror("zero-length delimited identifier");
+					ident = litbuf_udeescape('\\', yyscanner);
+					if (yyextra->literallen >= NAMEDATALEN)
+						truncate_identifier(ident, yyextra->literallen, true);
+					yylval->str = ident;
+					/* throw back all but the quote */
+					yyless(1);
+					return IDENT;
+				}
+	YY_BREAK
+			case 55:
+YY_RULE_SETUP
+{
+					char		   *ident;
+
+					BEGIN(INITIAL);
+					if (yyextra->literallen == 0)
+						yyerror("zero-length delimited identifier");
+					ident = litbuf_udeescape(yytext[yyleng - 2], yyscanner);
+					if (yyextra->literallen >= NAMEDATALEN)
+						truncate_identifier(ident, yyextra->literallen, true);
+					yylval->str = ident;
+					return IDENT;
+				}
+	YY_BREAK
+			case 56:
+YY_RULE_SETUP
+{
+					addlitchar('"', yyscanner);
+				}
+	YY_BREAK
+			case 57:
+YY_RULE_SETUP
+{
+					addlit(yytext, yyleng, yyscanner);
+				}
+	YY_BREAK
+			case 58:
+YY_RULE_SETUP
+{ yyerror("unterminated quoted identifier"); }
+	YY_BREAK
+			case 59:
+YY_RULE_SETUP
+{
+					char		   *ident;
+
+					SET_YYLLOC();
+					/* throw back all but the initial u/U */
+					yyless(1);
+					/* and treat it as {identifier} */
+					ident = downcase_truncate_identifier(yytext, yyleng, true);
+					yylval->str = ident;
+					return IDENT;
+				}
+	YY_BREAK
+			case 60:
+YY_RULE_SETUP
+{
+					SET_YYLLOC();
+					return TYPECAST;
+				}
+	YY_BREAK
+			case 61:
+YY_RULE_SETUP
+{
+					SET_YYLLOC();
+					return DOT_DOT;
+				}
+	YY_BREAK
+			case 62:
+YY_RULE_SETUP
+{
+					SET_YYLLOC();
+					return COLON_EQUALS;
+				}
+	YY_BREAK
+			case 63:
+YY_RULE_SETUP
+{
+					SET_YYLLOC();
+					return yytext[0];
+				}
+	YY_BREAK
+			case 64:
+YY_RULE_SETUP
+{
+					/*
+					 * Check for embedded slash-star or dash-dash; those
+					 * are comment starts, so operator must stop there.
+					 * Note that slash-star or dash-dash at the first
+					 * character will match a prior rule, not this one.
+					 */
+					int		nchars = yyleng;
+					char   *slashstar = strstr(yytext, "/*");
+					char   *dashdash = strstr(yytext, "--");
+
+					if (slashstar && dashdash)
+					{
+						/* if both appear, take the first one */
+						if (slashstar > dashdash)
+							slashstar = dashdash;
+					}
+					else if (!slashstar)
+						slashstar = dashdash;
+					if (slashstar)
+						nchars = slashstar - yytext;
+
+					/*
+					 * For SQL compatibility, '+' and '-' cannot be the
+					 * last char of a multi-char operator unless the operator
+					 * contains chars that are not in SQL operators.
+					 * The idea is to lex '=-' as two operators, but not
+					 * to forbid operator names like '?-' that could not be
+					 * sequences of SQL operators.
+					 */
+					while (nchars > 1 &&
+						   (yytext[nchars-1] == '+' ||
+							yytext[nchars-1] == '-'))
+					{
+						int		ic;
+
+						for (ic = nchars-2; ic >= 0; ic--)
+						{
+							if (strchr("~!@#^&|`?%", yytext[ic]))
+								break;
+						}
+						if (ic >= 0)
+							break; /* found a char that makes it OK */
+						nchars--; /* else remove the +/-, and check again */
+					}
+
+					SET_YYLLOC();
+
+					if (nchars < yyleng)
+					{
+						/* Strip the unwanted chars from the token */
+						yyless(nchars);
+						/*
+						 * If what we have left is only one char, and it's
+						 * one of the characters matching "self", then
+						 * return it as a character token the same way
+						 * that the "self" rule would have.
+						 */
+						if (nchars == 1 &&
+							strchr(",()[].;:+-*/%^<>=", yytext[0]))
+							return yytext[0];
+					}
+
+					/*
+					 * Complain if operator is too long.  Unlike the case
+					 * for identifiers, we make this an error not a notice-
+					 * and-truncate, because the odds are we are looking at
+					 * a syntactic mistake anyway.
+					 */
+					if (nchars >= NAMEDATALEN)
+						yyerror("operator too long");
+
+					/* Convert "!=" operator to "<>" for compatibility */
+					if (strcmp(yytext, "!=") == 0)
+						yylval->str = pstrdup("<>");
+					else
+						yylval->str = pstrdup(yytext);
+					return Op;
+				}
+	YY_BREAK
+			case 65:
+YY_RULE_SETUP
+{
+					SET_YYLLOC();
+					yylval->ival = atol(yytext + 1);
+					return PARAM;
+				}
+	YY_BREAK
+			case 66:
+YY_RULE_SETUP
+{
+					SET_YYLLOC();
+					return process_integer_literal(yytext, yylval);
+				}
+	YY_BREAK
+			case 67:
+YY_RULE_SETUP
+{
+					SET_YYLLOC();
+					yylval->str = pstrdup(yytext);
+					return FCONST;
+				}
+	YY_BREAK
+			case 68:
+YY_RULE_SETUP
+{
+					/* throw back the .., and treat as integer */
+					yyless(yyleng-2);
+					SET_YYLLOC();
+					return process_integer_literal(yytext, yylval);
+				}
+	YY_BREAK
+			case 69:
+YY_RULE_SETUP
+{
+					SET_YYLLOC();
+					yylval->str = pstrdup(yytext);
+					return FCONST;
+				}
+	YY_BREAK
+			case 70:
+YY_RULE_SETUP
+{
+					/*
+					 * throw back the [Ee], and treat as {decimal}.  Note
+					 * that it is possible the input is actually {integer},
+					 * but since this case will almost certainly lead to a
+					 * syntax error anyway, we don't bother to distinguish.
+					 */
+					yyless(yyleng-1);
+					SET_YYLLOC();
+					yylval->str = pstrdup(yytext);
+					return FCONST;
+				}
+	YY_BREAK
+			case 71:
+YY_RULE_SETUP
+{
+					/* throw back the [Ee][+-], and proceed as above */
+					yyless(yyleng-2);
+					SET_YYLLOC();
+					yylval->str = pstrdup(yytext);
+					return FCONST;
+				}
+	YY_BREAK
+			case 72:
+YY_RULE_SETUP
+{
+					const ScanKeyword *keyword;
+					char		   *ident;
+
+					SET_YYLLOC();
+
+					/* Is it a keyword? */
+					keyword = ScanKeywordLookup(yytext,
+												yyextra->keywords,
+												yyextra->num_keywords);
+					if (keyword != NULL)
+					{
+						yylval->keyword = keyword->name;
+						return keyword->value;
+					}
+
+					/*
+					 * No.  Convert the identifier to lower case, and truncate
+					 * if necessary.
+					 */
+					ident = downcase_truncate_identifier(yytext, yyleng, true);
+					yylval->str = ident;
+					return IDENT;
+				}
+	YY_BREAK
+			case 73:
+YY_RULE_SETUP
+{
+					SET_YYLLOC();
+					return yytext[0];
+				}
+	YY_BREAK
+			case 74:
+YY_RULE_SETUP
+{
+					SET_YYLLOC();
+					yyterminate();
+				}
+	YY_BREAK
+			default:
+				YY_FATAL_ERROR("fatal flex scanner internal error--no action found");
+		}
+	}
+}
+
+static void
+yy_fatal_error(yyconst char *msg, yyscan_t yyscanner)
+{
+	(void) fprintf(stderr, "%s\n", msg);
+	exit(2);
+}
+
+static void
+yy_fill_buffer(YY_BUFFER_STATE b, yyscan_t yyscanner)
+{
+	yy_size_t	size = 16384;
+	yy_size_t	n = 0;
+
+	b->yy_ch_buf = (char *) yyalloc(size + 2, yyscanner);
+	if (!b->yy_ch_buf)
+		YY_FATAL_ERROR("out of dynamic memory in yy_fill_buffer()");
+	if (b->yy_input_file)
+	{
+		for (;;)
+		{
+			size_t		r;
+
+			if (n == size)
+			{
+				size *= 2;
+				b->yy_ch_buf = (char *) yyrealloc(b->yy_ch_buf, size + 2, yyscanner);
+				if (!b->yy_ch_buf)
+					YY_FATAL_ERROR("out of dynamic memory in yy_fill_buffer()");
+			}
+			r = fread(b->yy_ch_buf + n, 1, size - n, b->yy_input_file);
+			if (r == 0)
+			{
+				if (ferror(b->yy_input_file) && errno == EINTR)
+				{
+					clearerr(b->yy_input_file);
+					continue;
+				}
+				break;
+			}
+			n += r;
+		}
+	}
+	b->yy_ch_buf[n] = b->yy_ch_buf[n + 1] = YY_END_OF_BUFFER_CHAR;
+	b->yy_n_chars = (int) n;
+	b->yy_buf_size = size;
+	b->yy_pos = 0;
+	b->yy_filled = 1;
+	b->yy_is_our_buffer = 1;
+}
+
+void
+yyrestart(FILE *input_file, yyscan_t yyscanner)
+{
+	struct yyguts_t *yyg = (struct yyguts_t *) yyscanner;
+
+	if (YYG(yy_hold_ptr))
+	{
+		*YYG(yy_hold_ptr) = YYG(yy_hold_char);
+		YYG(yy_hold_ptr) = NULL;
+	}
+	if (YY_CURRENT_BUFFER)
+		yy_delete_buffer(YY_CURRENT_BUFFER, yyscanner);
+	YY_CURRENT_BUFFER_LVALUE = yy_create_buffer(input_file, YY_BUF_SIZE, yyscanner);
+}
+
+void
+yy_switch_to_buffer(YY_BUFFER_STATE new_buffer, yyscan_t yyscanner)
+{
+	struct yyguts_t *yyg = (struct yyguts_t *) yyscanner;
+
+	if (YYG(yy_hold_ptr))
+	{
+		*YYG(yy_hold_ptr) = YYG(yy_hold_char);
+		YYG(yy_hold_ptr) = NULL;
+	}
+	YY_CURRENT_BUFFER_LVALUE = new_buffer;
+}
+
+YY_BUFFER_STATE
+yy_create_buffer(FILE *file, int size, yyscan_t yyscanner)
+{
+	YY_BUFFER_STATE b;
+
+	(void) size;
+	b = (YY_BUFFER_STATE) yyalloc(sizeof(struct yy_buffer_state), yyscanner);
+	if (!b)
+		YY_FATAL_ERROR("out of dynamic memory in yy_create_buffer()");
+	memset(b, 0, sizeof(struct yy_buffer_state));
+	b->yy_input_file = file;
+	return b;
+}
+
+void
+yy_delete_buffer(YY_BUFFER_STATE b, yyscan_t yyscanner)
+{
+	struct yyguts_t *yyg = (struct yyguts_t *) yyscanner;
+
+	if (!b)
+		return;
+	if (b == YY_CURRENT_BUFFER)
+	{
+		if (YYG(yy_hold_ptr))
+		{
+			*YYG(yy_hold_ptr) = YYG(yy_hold_char);
+			YYG(yy_hold_ptr) = NULL;
+		}
+		YY_CURRENT_BUFFER_LVALUE = NULL;
+	}
+	if (b->yy_is_our_buffer && b->yy_ch_buf)
+		yyfree(b->yy_ch_buf, yyscanner);
+	yyfree(b, yyscanner);
+}
+
+void
+yy_flush_buffer(YY_BUFFER_STATE b, yyscan_t yyscanner)
+{
+	if (!b)
+		return;
+	b->yy_pos = b->yy_n_chars;
+}
+
+YY_BUFFER_STATE
+yy_scan_buffer(char *base, yy_size_t size, yyscan_t yyscanner)
+{
+	YY_BUFFER_STATE b;
+
+	if (size < 2 ||
+		base[size - 2] != YY_END_OF_BUFFER_CHAR ||
+		base[size - 1] != YY_END_OF_BUFFER_CHAR)
+		return NULL;
+	b = (YY_BUFFER_STATE) yyalloc(sizeof(struct yy_buffer_state), yyscanner);
+	if (!b)
+		YY_FATAL_ERROR("out of dynamic memory in yy_scan_buffer()");
+	memset(b, 0, sizeof(struct yy_buffer_state));
+	b->yy_ch_buf = base;
+	b->yy_buf_size = size - 2;
+	b->yy_n_chars = (int) (size - 2);
+	b->yy_pos = 0;
+	b->yy_filled = 1;
+	b->yy_is_our_buffer = 0;
+	yy_switch_to_buffer(b, yyscanner);
+	return b;
+}
+
+YY_BUFFER_STATE
+yy_scan_string(yyconst char *yystr, yyscan_t yyscanner)
+{
+	return yy_scan_bytes(yystr, (int) strlen(yystr), yyscanner);
+}
+
+YY_BUFFER_STATE
+yy_scan_bytes(yyconst char *yybytes, int len, yyscan_t yyscanner)
+{
+	YY_BUFFER_STATE b;
+	char	   *buf;
+
+	buf = (char *) yyalloc(len + 2, yyscanner);
+	if (!buf)
+		YY_FATAL_ERROR("out of dynamic memory in yy_scan_bytes()");
+	memcpy(buf, yybytes, len);
+	buf[len] = buf[len + 1] = YY_END_OF_BUFFER_CHAR;
+	b = yy_scan_buffer(buf, len + 2, yyscanner);
+	if (!b)
+		YY_FATAL_ERROR("bad buffer in yy_scan_bytes()");
+	b->yy_is_our_buffer = 1;
+	return b;
+}
+
+int
+yylex_init(yyscan_t *ptr_yy_globals)
+{
+	if (ptr_yy_globals == NULL)
+	{
+		errno = EINVAL;
+		return 1;
+	}
+	*ptr_yy_globals = (yyscan_t) yyalloc(sizeof(struct yyguts_t), NULL);
+	if (*ptr_yy_globals == NULL)
+	{
+		errno = ENOMEM;
+		return 1;
+	}
+	memset(*ptr_yy_globals, 0, sizeof(struct yyguts_t));
+	((struct yyguts_t *) *ptr_yy_globals)->yylineno_r = 1;
+	return 0;
+}
+
+int
+yylex_destroy(yyscan_t yyscanner)
+{
+	struct yyguts_t *yyg = (struct yyguts_t *) yyscanner;
+
+	if (YY_CURRENT_BUFFER)
+		yy_delete_buffer(YY_CURRENT_BUFFER, yyscanner);
+	yyfree(yyg, yyscanner);
+	return 0;
+}
+
+YY_EXTRA_TYPE
+yyget_extra(yyscan_t yyscanner)
+{
+	struct yyguts_t *yyg = (struct yyguts_t *) yyscanner;
+
+	return yyextra;
+}
+
+void
+yyset_extra(YY_EXTRA_TYPE user_defined, yyscan_t yyscanner)
+{
+	struct yyguts_t *yyg = (struct yyguts_t *) yyscanner;
+
+	yyextra = user_defined;
+}
+
+int
+yyget_column(yyscan_t yyscanner)
+{
+	struct yyguts_t *yyg = (struct yyguts_t *) yyscanner;
+
+	return yycolumn;
+}
+
+void
+yyset_column(int column_no, yyscan_t yyscanner)
+{
+	struct yyguts_t *yyg = (struct yyguts_t *) yyscanner;
+
+	yycolumn = column_no;
+}
+
+/* user code */
+
+/*
+ * Arrange access to yyextra for subroutines of the main yylex() function.
+ * We expect each subroutine to have a yyscanner parameter.  Rather than
+ * use the yyget_xxx functions, which might or might not get inlined by the
+ * compiler, we cheat just a bit and cast yyscanner to the right type.
+ */
+#undef yyextra
+#define yyextra  (((struct yyguts_t *) yyscanner)->yyextra_r)
+
+/* Likewise for a couple of other things we need. */
+#undef yylloc
+#define yylloc  (((struct yyguts_t *) yyscanner)->yylloc_r)
+#undef yyleng
+#define yyleng  (((struct yyguts_t *) yyscanner)->yyleng_r)
+
+
+/*
+ * scanner_errposition
+ *		Report a lexer or grammar error cursor position, if possible.
+ *
+ * This is expected to be used within an ereport() call.  The return value
+ * is a dummy (always 0, in fact).
+ *
+ * Note that this can only be used for messages emitted during raw parsing
+ * (essentially, scan.l and gram.y), since it requires the yyscanner struct
+ * to still be available.
+ */
+int
+scanner_errposition(int location, core_yyscan_t yyscanner)
+{
+	int		pos;
+
+	if (location < 0)
+		return 0;				/* no-op if location is unknown */
+
+	/* Convert byte offset to character number */
+	pos = pg_mbstrlen_with_len(yyextra->scanbuf, location) + 1;
+	/* And pass it to the ereport mechanism */
+	return errposition(pos);
+}
+
+/*
+ * scanner_yyerror
+ *		Report a lexer or grammar error.
+ *
+ * The message's cursor position is whatever YYLLOC was last set to,
+ * ie, the start of the current token if called within yylex(), or the
+ * most recently lexed token if called from the grammar.
+ * This is OK for syntax error messages from the Bison parser, because Bison
+ * parsers report error as soon as the first unparsable token is reached.
+ * Beware of using yyerror for other purposes, as the cursor position might
+ * be misleading!
+ */
+void
+scanner_yyerror(const char *message, core_yyscan_t yyscanner)
+{
+	const char *loc = yyextra->scanbuf + *yylloc;
+
+	if (*loc == YY_END_OF_BUFFER_CHAR)
+	{
+		ereport(ERROR,
+				(errcode(ERRCODE_SYNTAX_ERROR),
+				 /* translator: %s is typically the translation of "syntax error" */
+				 errmsg("%s at end of input", _(message)),
+				 lexer_errposition()));
+	}
+	else
+	{
+		ereport(ERROR,
+				(errcode(ERRCODE_SYNTAX_ERROR),
+				 /* translator: first %s is typically the translation of "syntax error" */
+				 errmsg("%s at or near \"%s\"", _(message), loc),
+				 lexer_errposition()));
+	}
+}
+
+
+/*
+ * Called before any actual parsing is done
+ */
+core_yyscan_t
+scanner_init(const char *str,
+			 core_yy_extra_type *yyext,
+			 const ScanKeyword *keywords,
+			 int num_keywords)
+{
+	Size		slen = strlen(str);
+	yyscan_t	scanner;
+
+	if (yylex_init(&scanner) != 0)
+		elog(ERROR, "yylex_init() failed: %m");
+
+	core_yyset_extra(yyext, scanner);
+
+	yyext->keywords = keywords;
+	yyext->num_keywords = num_keywords;
+
+	/*
+	 * Make a scan buffer with special termination needed by flex.
+	 */
+	yyext->scanbuf = (char *) palloc(slen + 2);
+	yyext->scanbuflen = slen;
+	memcpy(yyext->scanbuf, str, slen);
+	yyext->scanbuf[slen] = yyext->scanbuf[slen + 1] = YY_END_OF_BUFFER_CHAR;
+	yy_scan_buffer(yyext->scanbuf, slen + 2, scanner);
+
+	/* initialize literal buffer to a reasonable but expansible size */
+	yyext->literalalloc = 1024;
+	yyext->literalbuf = (char *) palloc(yyext->literalalloc);
+	yyext->literallen = 0;
+
+	return scanner;
+}
+
+
+/*
+ * Called after parsing is done to clean up after scanner_init()
+ */
+void
+scanner_finish(core_yyscan_t yyscanner)
+{
+	/*
+	 * We don't bother to call yylex_destroy(), because all it would do
+	 * is pfree a small amount of control storage.  It's cheaper to leak
+	 * the storage until the parsing context is destroyed.  The amount of
+	 * space involved is usually negligible compared to the output parse
+	 * tree anyway.
+	 *
+	 * We do bother to pfree the scanbuf and literal buffer, but only if they
+	 * represent a nontrivial amount of space.  The 8K cutoff is arbitrary.
+	 */
+	if (yyextra->scanbuflen >= 8192)
+		pfree(yyextra->scanbuf);
+	if (yyextra->literalalloc >= 8192)
+		pfree(yyextra->literalbuf);
+}
+
+
+static void
+addlit(char *ytext, int yleng, core_yyscan_t yyscanner)
+{
+	/* enlarge buffer if needed */
+	if ((yyextra->literallen + yleng) >= yyextra->literalalloc)
+	{
+		do {
+			yyextra->literalalloc *= 2;
+		} while ((yyextra->literallen + yleng) >= yyextra->literalalloc);
+		yyextra->literalbuf = (char *) repalloc(yyextra->literalbuf,
+												yyextra->literalalloc);
+	}
+	/* append new data */
+	memcpy(yyextra->literalbuf + yyextra->literallen, ytext, yleng);
+	yyextra->literallen += yleng;
+}
+
+
+static void
+addlitchar(unsigned char ychar, core_yyscan_t yyscanner)
+{
+	/* enlarge buffer if needed */
+	if ((yyextra->literallen + 1) >= yyextra->literalalloc)
+	{
+		yyextra->literalalloc *= 2;
+		yyextra->literalbuf = (char *) repalloc(yyextra->literalbuf,
+												yyextra->literalalloc);
+	}
+	/* append new data */
+	yyextra->literalbuf[yyextra->literallen] = ychar;
+	yyextra->literallen += 1;
+}
+
+
+/*
+ * Create a palloc'd copy of literalbuf, adding a trailing null.
+ */
+static char *
+litbufdup(core_yyscan_t yyscanner)
+{
+	int			llen = yyextra->literallen;
+	char	   *new;
+
+	new = palloc(llen + 1);
+	memcpy(new, yyextra->literalbuf, llen);
+	new[llen] = '\0';
+	return new;
+}
+
+static int
+process_integer_literal(const char *token, YYSTYPE *lval)
+{
+	long		val;
+	char	   *endptr;
+
+	errno = 0;
+	val = strtol(token, &endptr, 10);
+	if (*endptr != '\0' || errno == ERANGE
+#ifdef HAVE_LONG_INT_64
+		/* if long > 32 bits, check for overflow of int4 */
+		|| val != (long) ((int32) val)
+#endif
+		)
+	{
+		/* integer too large, treat it as a float */
+		lval->str = pstrdup(token);
+		return FCONST;
+	}
+	lval->ival = val;
+	return ICONST;
+}
+
+static unsigned int
+hexval(unsigned char c)
+{
+	if (c >= '0' && c <= '9')
+		return c - '0';
+	if (c >= 'a' && c <= 'f')
+		return c - 'a' + 0xA;
+	if (c >= 'A' && c <= 'F')
+		return c - 'A' + 0xA;
+	elog(ERROR, "invalid hexadecimal digit");
+	return 0; /* not reached */
+}
+
+static void
+check_unicode_value(pg_wchar c, char *loc, core_yyscan_t yyscanner)
+{
+	if (GetDatabaseEncoding() == PG_UTF8)
+		return;
+
+	if (c > 0x7F)
+	{
+		ADVANCE_YYLLOC(loc - yyextra->literalbuf + 3);   /* 3 for U&" */
+		yyerror("Unicode escape values cannot be used for code point values above 007F when the server encoding is not UTF8");
+	}
+}
+
+static bool
+is_utf16_surrogate_first(pg_wchar c)
+{
+	return (c >= 0xD800 && c <= 0xDBFF);
+}
+
+static bool
+is_utf16_surrogate_second(pg_wchar c)
+{
+	return (c >= 0xDC00 && c <= 0xDFFF);
+}
+
+static pg_wchar
+surrogate_pair_to_codepoint(pg_wchar first, pg_wchar second)
+{
+	return ((first & 0x3FF) << 10) + 0x10000 + (second & 0x3FF);
+}
+
+static void
+addunicode(pg_wchar c, core_yyscan_t yyscanner)
+{
+	char buf[8];
+
+	if (c == 0 || c > 0x10FFFF)
+		yyerror("invalid Unicode escape value");
+	if (c > 0x7F)
+	{
+		if (GetDatabaseEncoding() != PG_UTF8)
+			yyerror("Unicode escape values cannot be used for code point values above 007F when the server encoding is not UTF8");
+		yyextra->saw_non_ascii = true;
+	}
+	unicode_to_utf8(c, (unsigned char *) buf);
+	addlit(buf, pg_mblen(buf), yyscanner);
+}
+
+static char *
+litbuf_udeescape(unsigned char escape, core_yyscan_t yyscanner)
+{
+	char *new;
+	char *litbuf, *in, *out;
+	pg_wchar pair_first = 0;
+
+	if (isxdigit(escape)
+		|| escape == '+'
+		|| escape == '\''
+		|| escape == '"'
+		|| scanner_isspace(escape))
+	{
+		ADVANCE_YYLLOC(yyextra->literallen + yyleng + 1);
+		yyerror("invalid Unicode escape character");
+	}
+
+	/* Make literalbuf null-terminated to simplify the scanning loop */
+	litbuf = yyextra->literalbuf;
+	litbuf[yyextra->literallen] = '\0';
+
+	/*
+	 * This relies on the subtle assumption that a UTF-8 expansion
+	 * cannot be longer than its escaped representation.
+	 */
+	new = palloc(yyextra->literallen + 1);
+
+	in = litbuf;
+	out = new;
+	while (*in)
+	{
+		if (in[0] == escape)
+		{
+			if (in[1] == escape)
+			{
+				if (pair_first)
+				{
+					ADVANCE_YYLLOC(in - litbuf + 3);   /* 3 for U&" */
+					yyerror("invalid Unicode surrogate pair");
+				}
+				*out++ = escape;
+				in += 2;
+			}
+			else if (isxdigit((unsigned char) in[1]) &&
+					 isxdigit((unsigned char) in[2]) &&
+					 isxdigit((unsigned char) in[3]) &&
+					 isxdigit((unsigned char) in[4]))
+			{
+				pg_wchar unicode;
+
+				unicode = (hexval(in[1]) << 12) +
+					(hexval(in[2]) << 8) +
+					(hexval(in[3]) << 4) +
+					hexval(in[4]);
+				check_unicode_value(unicode, in, yyscanner);
+				if (pair_first)
+				{
+					if (is_utf16_surrogate_second(unicode))
+					{
+						unicode = surrogate_pair_to_codepoint(pair_first, unicode);
+						pair_first = 0;
+					}
+					else
+					{
+						ADVANCE_YYLLOC(in - litbuf + 3);   /* 3 for U&" */
+						yyerror("invalid Unicode surrogate pair");
+					}
+				}
+				else if (is_utf16_surrogate_second(unicode))
+					yyerror("invalid Unicode surrogate pair");
+
+				if (is_utf16_surrogate_first(unicode))
+					pair_first = unicode;
+				else
+				{
+					unicode_to_utf8(unicode, (unsigned char *) out);
+					out += pg_mblen(out);
+				}
+				in += 5;
+			}
+			else if (in[1] == '+' &&
+					 isxdigit((unsigned char) in[2]) &&
+					 isxdigit((unsigned char) in[3]) &&
+					 isxdigit((unsigned char) in[4]) &&
+					 isxdigit((unsigned char) in[5]) &&
+					 isxdigit((unsigned char) in[6]) &&
+					 isxdigit((unsigned char) in[7]))
+			{
+				pg_wchar unicode;
+
+				unicode = (hexval(in[2]) << 20) +
+					(hexval(in[3]) << 16) +
+					(hexval(in[4]) << 12) +
+					(hexval(in[5]) << 8) +
+					(hexval(in[6]) << 4) +
+					hexval(in[7]);
+				check_unicode_value(unicode, in, yyscanner);
+				if (pair_first)
+				{
+					if (is_utf16_surrogate_second(unicode))
+					{
+						unicode = surrogate_pair_to_codepoint(pair_first, unicode);
+						pair_first = 0;
+					}
+					else
+					{
+						ADVANCE_YYLLOC(in - litbuf + 3);   /* 3 for U&" */
+						yyerror("invalid Unicode surrogate pair");
+					}
+				}
+				else if (is_utf16_surrogate_second(unicode))
+					yyerror("invalid Unicode surrogate pair");
+
+				if (is_utf16_surrogate_first(unicode))
+					pair_first = unicode;
+				else
+				{
+					unicode_to_utf8(unicode, (unsigned char *) out);
+					out += pg_mblen(out);
+				}
+				in += 8;
+			}
+			else
+			{
+				ADVANCE_YYLLOC(in - litbuf + 3);   /* 3 for U&" */
+				yyerror("invalid Unicode escape value");
+			}
+		}
+		else
+		{
+			if (pair_first)
+			{
+				ADVANCE_YYLLOC(in - litbuf + 3);   /* 3 for U&" */
+				yyerror("invalid Unicode surrogate pair");
+			}
+			*out++ = *in++;
+		}
+	}
+
+	*out = '\0';
+	/*
+	 * We could skip pg_verifymbstr if we didn't process any non-7-bit-ASCII
+	 * codes; but it's probably not worth the trouble, since this isn't
+	 * likely to be a performance-critical path.
+	 */
+	pg_verifymbstr(new, out - new, false);
+	return new;
+}
+
+static unsigned char
+unescape_single_char(unsigned char c, core_yyscan_t yyscanner)
+{
+	switch (c)
+	{
+		case 'b':
+			return '\b';
+		case 'f':
+			return '\f';
+		case 'n':
+			return '\n';
+		case 'r':
+			return '\r';
+		case 't':
+			return '\t';
+		default:
+			/* check for backslash followed by non-7-bit-ASCII */
+			if (c == '\0' || IS_HIGHBIT_SET(c))
+				yyextra->saw_non_ascii = true;
+
+			return c;
+	}
+}
+
+static void
+check_string_escape_warning(unsigned char ychar, core_yyscan_t yyscanner)
+{
+	if (ychar == '\'')
+	{
+		if (yyextra->warn_on_first_escape && escape_string_warning)
+			ereport(WARNING,
+					(errcode(ERRCODE_NONSTANDARD_USE_OF_ESCAPE_CHARACTER),
+					 errmsg("nonstandard use of \\' in a string literal"),
+					 errhint("Use '' to write quotes in strings, or use the escape string syntax (E'...')."),
+					 lexer_errposition()));
+		yyextra->warn_on_first_escape = false;	/* warn only once per string */
+	}
+	else if (ychar == '\\')
+	{
+		if (yyextra->warn_on_first_escape && escape_string_warning)
+			ereport(WARNING,
+					(errcode(ERRCODE_NONSTANDARD_USE_OF_ESCAPE_CHARACTER),
+					 errmsg("nonstandard use of \\\\ in a string literal"),
+					 errhint("Use the escape string syntax for backslashes, e.g., E'\\\\'."),
+					 lexer_errposition()));
+		yyextra->warn_on_first_escape = false;	/* warn only once per string */
+	}
+	else
+		check_escape_warning(yyscanner);
+}
+
+static void
+check_escape_warning(core_yyscan_t yyscanner)
+{
+	if (yyextra->warn_on_first_escape && escape_string_warning)
+		ereport(WARNING,
+				(errcode(ERRCODE_NONSTANDARD_USE_OF_ESCAPE_CHARACTER),
+				 errmsg("nonstandard use of escape in a string literal"),
+				 errhint("Use the escape string syntax for escapes, e.g., E'\\r\\n'."),
+				 lexer_errposition()));
+	yyextra->warn_on_first_escape = false;	/* warn only once per string */
+}
+
+/*
+ * Interface functions to make flex use palloc() instead of malloc().
+ * It'd be better to make these static, but flex insists otherwise.
+ */
+
+void *
+core_yyalloc(yy_size_t bytes, core_yyscan_t yyscanner)
+{
+	return palloc(bytes);
+}
+
+void *
+core_yyrealloc(void *ptr, yy_size_t bytes, core_yyscan_t yyscanner)
+{
+	if (ptr)
+		return repalloc(ptr, bytes);
+	else
+		return palloc(bytes);
+}
+
+void
+core_yyfree(void *ptr, core_yyscan_t yyscanner)
+{
+	if (ptr)
+		pfree(ptr);
+}
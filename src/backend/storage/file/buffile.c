@@ -568,6 +568,25 @@ BufFileSeekBlock(BufFile *file, long blknum)
 					   SEEK_SET);
 }
 
+/*
+ * BufFilePrefetchBlock --- hint that a block will be read soon
+ *
+ * Block numbering is as for BufFileSeekBlock.  The seek position is not
+ * affected, and a block beyond the end of the file is silently ignored.
+ */
+void
+BufFilePrefetchBlock(BufFile *file, long blknum)
+{
+#ifdef USE_PREFETCH
+	int			fileno = (int) (blknum / BUFFILE_SEG_SIZE);
+
+	if (fileno < file->numFiles)
+		(void) FilePrefetch(file->files[fileno],
+							(off_t) (blknum % BUFFILE_SEG_SIZE) * BLCKSZ,
+							BLCKSZ);
+#endif
+}
+
 #ifdef NOT_USED
 /*
  * BufFileTellBlock --- block-oriented tell
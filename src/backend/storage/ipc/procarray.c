@@ -1014,7 +1014,10 @@ GetOldestXmin(bool allDbs, bool ignoreVacuum)
  * information may not be available.  If we find any overflowed subxid arrays,
  * we have to mark the snapshot's subxid data as overflowed, and extra work
  * *may* need to be done to determine what's running (see XidInMVCCSnapshot()
- * in tqual.c).
+ * in tqual.c).  We still collect the subxids of every backend that did not
+ * overflow, and remember the oldest top-level XID among those that did as
+ * suboverflowxmin: no XID older than that can be a missing subxact, so only
+ * XIDs at or beyond it ever need a pg_subtrans lookup.
  *
  * We also update the following backend-global variables:
  *		TransactionXmin: the oldest xmin of any snapshot in use in the
@@ -1039,6 +1042,7 @@ GetSnapshotData(Snapshot snapshot)
 	int			count = 0;
 	int			subcount = 0;
 	bool		suboverflowed = false;
+	TransactionId suboverflowxmin;
 
 	Assert(snapshot != NULL);
 
@@ -1089,6 +1093,7 @@ GetSnapshotData(Snapshot snapshot)
 
 	/* initialize xmin calculation with xmax */
 	globalxmin = xmin = xmax;
+	suboverflowxmin = xmax;
 
 	/*
 	 * Spin over procArray checking xid, xmin, and subxids.  The goal is to
@@ -1134,11 +1139,16 @@ GetSnapshotData(Snapshot snapshot)
 		}
 
 		/*
-		 * Save subtransaction XIDs if possible (if we've already overflowed,
-		 * there's no point).  Note that the subxact XIDs must be later than
-		 * their parent, so no need to check them against xmin.  We could
-		 * filter against xmax, but it seems better not to do that much work
-		 * while holding the ProcArrayLock.
+		 * Save subtransaction XIDs if possible.  Note that the subxact XIDs
+		 * must be later than their parent, so no need to check them against
+		 * xmin.  We could filter against xmax, but it seems better not to do
+		 * that much work while holding the ProcArrayLock.
+		 *
+		 * If this backend's cache has overflowed, just note that its subxacts
+		 * are not all present.  They all follow its top-level XID, so that
+		 * bounds the range of XIDs that may need a pg_subtrans lookup.  If we
+		 * saw no valid XID for it, it can only have acquired one after we
+		 * took the lock, and its subxacts must then postdate xmax.
 		 *
 		 * The other backend can add more subxids concurrently, but cannot
 		 * remove any.	Hence it's important to fetch nxids just once. Should
@@ -1147,10 +1157,15 @@ GetSnapshotData(Snapshot snapshot)
 		 *
 		 * Again, our own XIDs are not included in the snapshot.
 		 */
-		if (!suboverflowed && proc != MyProc)
+		if (proc != MyProc)
 		{
 			if (proc->subxids.overflowed)
+			{
 				suboverflowed = true;
+				if (TransactionIdIsNormal(xid) &&
+					TransactionIdPrecedes(xid, suboverflowxmin))
+					suboverflowxmin = xid;
+			}
 			else
 			{
 				int			nxids = proc->subxids.nxids;
@@ -1197,8 +1212,15 @@ GetSnapshotData(Snapshot snapshot)
 		 */
 		subcount = KnownAssignedXidsGetAndSetXmin(snapshot->subxip, &xmin, xmax);
 
+		/*
+		 * We can't tell which of the missing xids are whose, so treat
+		 * everything within the snapshot as possibly missing.
+		 */
 		if (TransactionIdPrecedes(xmin, procArray->lastOverflowedXid))
+		{
 			suboverflowed = true;
+			suboverflowxmin = xmin;
+		}
 	}
 
 	if (!TransactionIdIsValid(MyProc->xmin))
@@ -1225,6 +1247,7 @@ GetSnapshotData(Snapshot snapshot)
 	snapshot->xcnt = count;
 	snapshot->subxcnt = subcount;
 	snapshot->suboverflowed = suboverflowed;
+	snapshot->suboverflowxmin = suboverflowxmin;
 
 	snapshot->curcid = GetCurrentCommandId(false);
 
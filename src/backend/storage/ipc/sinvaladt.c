@@ -93,6 +93,20 @@
  * read maxMsgNum if you are not holding SInvalWriteLock, and you need the
  * spinlock to write maxMsgNum unless you are holding both locks.)
  *
+ * Since every backend calls SIGetDataEntries at least once per transaction,
+ * and usually finds nothing to read, we also keep a per-backend hasMessages
+ * flag that lets a reader skip both SInvalReadLock and the spinlock when its
+ * queue is known to be empty.  Writers set the flag for every active backend
+ * after advancing maxMsgNum; readers clear their own flag (holding
+ * SInvalReadLock) before fetching maxMsgNum, so a message added after that
+ * fetch will set it again.  The flag is read without any lock, which is safe
+ * because it can only be cleared by its owner: a stale "true" merely costs an
+ * unnecessary trip through the locked path, and a stale "false" is no worse
+ * than the message having arrived a moment later.  Since the caller has
+ * already acquired a heavyweight lock on whatever object it is about to look
+ * at, any invalidation it must see was sent before that lock was granted,
+ * and the lock acquisition serves as the needed memory barrier.
+ *
  * Note: since maxMsgNum is an int and hence presumably atomically readable/
  * writable, the spinlock might seem unnecessary.  The reason it is needed
  * is to provide a memory barrier: we need to be sure that messages written
@@ -143,6 +157,7 @@ typedef struct ProcState
 	int			nextMsgNum;		/* next message number to read */
 	bool		resetState;		/* backend needs to reset its state */
 	bool		signaled;		/* backend has been sent catchup signal */
+	bool		hasMessages;	/* backend has unread messages */
 
 	/*
 	 * Backend only sends invalidations, never receives them. This only makes
@@ -248,6 +263,7 @@ CreateSharedInvalidationState(void)
 		shmInvalBuffer->procState[i].nextMsgNum = 0;	/* meaningless */
 		shmInvalBuffer->procState[i].resetState = false;
 		shmInvalBuffer->procState[i].signaled = false;
+		shmInvalBuffer->procState[i].hasMessages = false;
 		shmInvalBuffer->procState[i].nextLXID = InvalidLocalTransactionId;
 	}
 }
@@ -316,6 +332,7 @@ SharedInvalBackendInit(bool sendOnly)
 	stateP->nextMsgNum = segP->maxMsgNum;
 	stateP->resetState = false;
 	stateP->signaled = false;
+	stateP->hasMessages = false;
 	stateP->sendOnly = sendOnly;
 
 	LWLockRelease(SInvalWriteLock);
@@ -355,6 +372,7 @@ CleanupInvalidationState(int status, Datum arg)
 	stateP->nextMsgNum = 0;
 	stateP->resetState = false;
 	stateP->signaled = false;
+	stateP->hasMessages = false;
 
 	/* Recompute index of last active backend */
 	for (i = segP->lastBackend; i > 0; i--)
@@ -417,6 +435,7 @@ SIInsertDataEntries(const SharedInvalidationMessage *data, int n)
 		int			nthistime = Min(n, WRITE_QUANTUM);
 		int			numMsgs;
 		int			max;
+		int			i;
 
 		n -= nthistime;
 
@@ -459,6 +478,15 @@ SIInsertDataEntries(const SharedInvalidationMessage *data, int n)
 			SpinLockRelease(&vsegP->msgnumLock);
 		}
 
+		/*
+		 * Now that the new maxMsgNum is visible, tell every backend that it
+		 * has something to read.  Releasing SInvalWriteLock acts as a memory
+		 * barrier, so these unlocked stores will be visible before anyone
+		 * can acquire a lock that we hold on account of these messages.
+		 */
+		for (i = 0; i < segP->lastBackend; i++)
+			segP->procState[i].hasMessages = true;
+
 		LWLockRelease(SInvalWriteLock);
 	}
 }
@@ -499,11 +527,28 @@ SIGetDataEntries(SharedInvalidationMessage *data, int datasize)
 	int			max;
 	int			n;
 
-	LWLockAcquire(SInvalReadLock, LW_SHARED);
-
 	segP = shmInvalBuffer;
 	stateP = &segP->procState[MyBackendId - 1];
 
+	/*
+	 * Before taking any locks, check without locking whether there can
+	 * possibly be anything to read; see the notes at the top of the file for
+	 * why this is safe.  This is by far the most common case.
+	 */
+	if (!stateP->hasMessages)
+		return 0;
+
+	LWLockAcquire(SInvalReadLock, LW_SHARED);
+
+	/*
+	 * We must clear hasMessages before determining how many messages we're
+	 * going to read.  That way, messages that arrive after we have fetched
+	 * maxMsgNum will set the flag again and won't be overlooked next time.
+	 * If we don't end up reading everything, we must set it again ourselves
+	 * before leaving.
+	 */
+	stateP->hasMessages = false;
+
 	/* Fetch current value of maxMsgNum using spinlock */
 	{
 		/* use volatile pointer to prevent code rearrangement */
@@ -544,10 +589,13 @@ SIGetDataEntries(SharedInvalidationMessage *data, int datasize)
 	}
 
 	/*
-	 * Reset our "signaled" flag whenever we have caught up completely.
+	 * Reset our "signaled" flag whenever we have caught up completely.  If
+	 * we haven't, remember that there is more to read.
 	 */
 	if (stateP->nextMsgNum >= max)
 		stateP->signaled = false;
+	else
+		stateP->hasMessages = true;
 
 	LWLockRelease(SInvalReadLock);
 	return n;
@@ -612,6 +660,8 @@ SICleanupQueue(bool callerHasWriteLock, int minFree)
 		if (n < lowbound)
 		{
 			stateP->resetState = true;
+			/* make sure he notices, even if he's not checked lately */
+			stateP->hasMessages = true;
 			/* no point in signaling him ... */
 			continue;
 		}
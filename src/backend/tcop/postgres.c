@@ -67,6 +67,7 @@
 #include "tcop/pquery.h"
 #include "tcop/tcopprot.h"
 #include "tcop/utility.h"
+#include "utils/catcache.h"
 #include "utils/lsyscache.h"
 #include "utils/memutils.h"
 #include "utils/ps_status.h"
@@ -3805,6 +3806,7 @@ PostgresMain(int argc, char *argv[], const char *username)
 			{
 				ProcessCompletedNotifies();
 				pgstat_report_stat(false);
+				CatalogCacheInitFileWrite();
 
 				set_ps_display("idle", false);
 				pgstat_report_activity("<IDLE>");
@@ -1228,6 +1228,66 @@ cmp_numerics(Numeric num1, Numeric num2)
 	return result;
 }
 
+/*
+ * numeric_abbrev
+ *		Convert a numeric to an abbreviated sort key for tuplesort.
+ *
+ * We build a signed key from the weight and the leading digits of the
+ * absolute value, such that a larger magnitude never gets a smaller key,
+ * negate it for negative values, and map NaN above everything else.  The
+ * result is then offset so that comparing keys as unsigned integers gives
+ * the same answer as cmp_numerics whenever the keys differ.
+ */
+Datum
+numeric_abbrev(Datum original)
+{
+	Numeric		num = DatumGetNumeric(original);
+	NumericDigit *digits = NUMERIC_DIGITS(num);
+	int			ndigits = NUMERIC_NDIGITS(num);
+	int64		key;
+
+	if (NUMERIC_IS_NAN(num))
+	{
+#if SIZEOF_DATUM == 8
+		key = INT64CONST(0x7FFFFFFFFFFFFFFF);
+#else
+		key = 0x7FFFFFFF;
+#endif
+	}
+	else if (ndigits == 0)
+		key = 0;
+	else
+	{
+		/*
+		 * Stored values have no leading zero digits, so the weight orders
+		 * values of differing magnitude, and the leading digits order the
+		 * rest.  Include as many digits as fit.
+		 */
+		int			i;
+
+		key = (int64) num->n_weight + 32768;
+#if SIZEOF_DATUM == 8
+		for (i = 0; i < 3; i++)
+#else
+		for (i = 0; i < 1; i++)
+#endif
+			key = key * NBASE + (i < ndigits ? digits[i] : 0);
+
+		key += 1;				/* keep clear of zero */
+		if (NUMERIC_SIGN(num) == NUMERIC_NEG)
+			key = -key;
+	}
+
+	if ((Pointer) num != DatumGetPointer(original))
+		pfree(num);
+
+#if SIZEOF_DATUM == 8
+	return (Datum) ((uint64) key ^ UINT64CONST(0x8000000000000000));
+#else
+	return (Datum) ((uint32) (int32) key ^ (uint32) 0x80000000);
+#endif
+}
+
 Datum
 hash_numeric(PG_FUNCTION_ARGS)
 {
@@ -2452,6 +2512,135 @@ int8_avg_accum(PG_FUNCTION_ARGS)
 	PG_RETURN_ARRAYTYPE_P(do_numeric_avg_accum(transarray, newval));
 }
 
+/*
+ * Inverse of int8_avg_accum, used by AVG(int8) and SUM(int8) in
+ * moving-aggregate mode.  Integer inputs all have display scale zero, so
+ * subtracting the input gives exactly the state we'd have had without it.
+ */
+Datum
+int8_avg_accum_inv(PG_FUNCTION_ARGS)
+{
+	ArrayType  *transarray = PG_GETARG_ARRAYTYPE_P(0);
+	Datum		newval8 = PG_GETARG_DATUM(1);
+	Datum	   *transdatums;
+	int			ndatums;
+	Datum		N,
+				sumX;
+
+	/* We assume the input is array of numeric */
+	deconstruct_array(transarray,
+					  NUMERICOID, -1, false, 'i',
+					  &transdatums, NULL, &ndatums);
+	if (ndatums != 2)
+		elog(ERROR, "expected 2-element numeric array");
+	N = transdatums[0];
+	sumX = transdatums[1];
+
+	N = DirectFunctionCall2(numeric_sub, N,
+							NumericGetDatum(make_result(&const_one)));
+	sumX = DirectFunctionCall2(numeric_sub, sumX,
+							   DirectFunctionCall1(int8_numeric, newval8));
+
+	transdatums[0] = N;
+	transdatums[1] = sumX;
+
+	PG_RETURN_ARRAYTYPE_P(construct_array(transdatums, 2,
+										  NUMERICOID, -1, false, 'i'));
+}
+
+/*
+ * Moving-aggregate transition functions for SUM(numeric) and AVG(numeric).
+ *
+ * Subtracting an input back out of sum(X) gives the right value, but the
+ * result keeps the largest display scale of any input ever added, where
+ * summing just the remaining inputs would not.  So the state is a 3-element
+ * array of Numeric holding N, sum(X), and the number of inputs whose display
+ * scale equals that of sum(X).  When the last of those is removed the
+ * inverse function returns NULL, telling the caller to recompute the
+ * aggregate from the remaining inputs instead.  It does the same when a NaN
+ * is removed, since NaN can't be subtracted back out.
+ */
+Datum
+numeric_mavg_accum(PG_FUNCTION_ARGS)
+{
+	ArrayType  *transarray = PG_GETARG_ARRAYTYPE_P(0);
+	Numeric		newval = PG_GETARG_NUMERIC(1);
+	Datum	   *transdatums;
+	int			ndatums;
+	Numeric		sumX;
+	Datum		nscale;
+
+	/* We assume the input is array of numeric */
+	deconstruct_array(transarray,
+					  NUMERICOID, -1, false, 'i',
+					  &transdatums, NULL, &ndatums);
+	if (ndatums != 3)
+		elog(ERROR, "expected 3-element numeric array");
+	sumX = DatumGetNumeric(transdatums[1]);
+	nscale = transdatums[2];
+
+	/* once the sum is NaN, the scale count no longer matters */
+	if (!NUMERIC_IS_NAN(sumX) && !NUMERIC_IS_NAN(newval))
+	{
+		if (NUMERIC_DSCALE(newval) > NUMERIC_DSCALE(sumX))
+			nscale = NumericGetDatum(make_result(&const_one));
+		else if (NUMERIC_DSCALE(newval) == NUMERIC_DSCALE(sumX))
+			nscale = DirectFunctionCall1(numeric_inc, nscale);
+	}
+
+	transdatums[0] = DirectFunctionCall1(numeric_inc, transdatums[0]);
+	transdatums[1] = DirectFunctionCall2(numeric_add,
+										 NumericGetDatum(sumX),
+										 NumericGetDatum(newval));
+	transdatums[2] = nscale;
+
+	PG_RETURN_ARRAYTYPE_P(construct_array(transdatums, 3,
+										  NUMERICOID, -1, false, 'i'));
+}
+
+Datum
+numeric_mavg_accum_inv(PG_FUNCTION_ARGS)
+{
+	ArrayType  *transarray = PG_GETARG_ARRAYTYPE_P(0);
+	Numeric		newval = PG_GETARG_NUMERIC(1);
+	Datum	   *transdatums;
+	int			ndatums;
+	Numeric		sumX;
+	Datum		one;
+
+	/* We assume the input is array of numeric */
+	deconstruct_array(transarray,
+					  NUMERICOID, -1, false, 'i',
+					  &transdatums, NULL, &ndatums);
+	if (ndatums != 3)
+		elog(ERROR, "expected 3-element numeric array");
+	sumX = DatumGetNumeric(transdatums[1]);
+
+	if (NUMERIC_IS_NAN(newval))
+		PG_RETURN_NULL();
+
+	one = NumericGetDatum(make_result(&const_one));
+	if (!NUMERIC_IS_NAN(sumX) &&
+		NUMERIC_DSCALE(newval) == NUMERIC_DSCALE(sumX))
+	{
+		Numeric		nscale;
+
+		nscale = DatumGetNumeric(DirectFunctionCall2(numeric_sub,
+													 transdatums[2], one));
+		/* nscale is zero iff no digits (cf. numeric_uminus) */
+		if (VARSIZE(nscale) == NUMERIC_HDRSZ)
+			PG_RETURN_NULL();
+		transdatums[2] = NumericGetDatum(nscale);
+	}
+
+	transdatums[0] = DirectFunctionCall2(numeric_sub, transdatums[0], one);
+	transdatums[1] = DirectFunctionCall2(numeric_sub,
+										 NumericGetDatum(sumX),
+										 NumericGetDatum(newval));
+
+	PG_RETURN_ARRAYTYPE_P(construct_array(transdatums, 3,
+										  NUMERICOID, -1, false, 'i'));
+}
 
 Datum
 numeric_avg(PG_FUNCTION_ARGS)
@@ -2466,8 +2655,9 @@ numeric_avg(PG_FUNCTION_ARGS)
 	deconstruct_array(transarray,
 					  NUMERICOID, -1, false, 'i',
 					  &transdatums, NULL, &ndatums);
-	if (ndatums != 2)
-		elog(ERROR, "expected 2-element numeric array");
+	/* numeric_mavg_accum's state has a third element, which we ignore */
+	if (ndatums != 2 && ndatums != 3)
+		elog(ERROR, "expected 2- or 3-element numeric array");
 	N = DatumGetNumeric(transdatums[0]);
 	sumX = DatumGetNumeric(transdatums[1]);
 
@@ -2481,6 +2671,31 @@ numeric_avg(PG_FUNCTION_ARGS)
 										NumericGetDatum(N)));
 }
 
+/*
+ * Final function of SUM(int8) and SUM(numeric) in moving-aggregate mode,
+ * for the states of int8_avg_accum and numeric_mavg_accum.
+ */
+Datum
+numeric_msum(PG_FUNCTION_ARGS)
+{
+	ArrayType  *transarray = PG_GETARG_ARRAYTYPE_P(0);
+	Datum	   *transdatums;
+	int			ndatums;
+
+	/* We assume the input is array of numeric */
+	deconstruct_array(transarray,
+					  NUMERICOID, -1, false, 'i',
+					  &transdatums, NULL, &ndatums);
+	if (ndatums != 2 && ndatums != 3)
+		elog(ERROR, "expected 2- or 3-element numeric array");
+
+	/* SQL92 defines SUM of no values to be NULL */
+	if (VARSIZE(DatumGetNumeric(transdatums[0])) == NUMERIC_HDRSZ)
+		PG_RETURN_NULL();
+
+	PG_RETURN_DATUM(transdatums[1]);
+}
+
 /*
  * Workhorse routine for the standard deviance and variance
  * aggregates. 'transarray' is the aggregate's transition
@@ -2889,6 +3104,79 @@ int8_avg(PG_FUNCTION_ARGS)
 	PG_RETURN_DATUM(DirectFunctionCall2(numeric_div, sumd, countd));
 }
 
+/*
+ * Inverse transition functions for AVG(int2) and AVG(int4), also used by
+ * SUM(int2) and SUM(int4) in moving-aggregate mode.
+ */
+Datum
+int2_avg_accum_inv(PG_FUNCTION_ARGS)
+{
+	ArrayType  *transarray;
+	int16		newval = PG_GETARG_INT16(1);
+	Int8TransTypeData *transdata;
+
+	/* See int2_avg_accum */
+	if (AggCheckCallContext(fcinfo, NULL))
+		transarray = PG_GETARG_ARRAYTYPE_P(0);
+	else
+		transarray = PG_GETARG_ARRAYTYPE_P_COPY(0);
+
+	if (ARR_HASNULL(transarray) ||
+		ARR_SIZE(transarray) != ARR_OVERHEAD_NONULLS(1) + sizeof(Int8TransTypeData))
+		elog(ERROR, "expected 2-element int8 array");
+
+	transdata = (Int8TransTypeData *) ARR_DATA_PTR(transarray);
+	transdata->count--;
+	transdata->sum -= newval;
+
+	PG_RETURN_ARRAYTYPE_P(transarray);
+}
+
+Datum
+int4_avg_accum_inv(PG_FUNCTION_ARGS)
+{
+	ArrayType  *transarray;
+	int32		newval = PG_GETARG_INT32(1);
+	Int8TransTypeData *transdata;
+
+	/* See int2_avg_accum */
+	if (AggCheckCallContext(fcinfo, NULL))
+		transarray = PG_GETARG_ARRAYTYPE_P(0);
+	else
+		transarray = PG_GETARG_ARRAYTYPE_P_COPY(0);
+
+	if (ARR_HASNULL(transarray) ||
+		ARR_SIZE(transarray) != ARR_OVERHEAD_NONULLS(1) + sizeof(Int8TransTypeData))
+		elog(ERROR, "expected 2-element int8 array");
+
+	transdata = (Int8TransTypeData *) ARR_DATA_PTR(transarray);
+	transdata->count--;
+	transdata->sum -= newval;
+
+	PG_RETURN_ARRAYTYPE_P(transarray);
+}
+
+/*
+ * Final function of SUM(int2) and SUM(int4) in moving-aggregate mode.
+ */
+Datum
+int2int4_sum(PG_FUNCTION_ARGS)
+{
+	ArrayType  *transarray = PG_GETARG_ARRAYTYPE_P(0);
+	Int8TransTypeData *transdata;
+
+	if (ARR_HASNULL(transarray) ||
+		ARR_SIZE(transarray) != ARR_OVERHEAD_NONULLS(1) + sizeof(Int8TransTypeData))
+		elog(ERROR, "expected 2-element int8 array");
+	transdata = (Int8TransTypeData *) ARR_DATA_PTR(transarray);
+
+	/* SQL92 defines SUM of no values to be NULL */
+	if (transdata->count == 0)
+		PG_RETURN_NULL();
+
+	PG_RETURN_INT64(transdata->sum);
+}
+
 
 /* ----------------------------------------------------------------------
  *
@@ -222,6 +222,25 @@ uuid_cmp(PG_FUNCTION_ARGS)
 	PG_RETURN_INT32(uuid_internal_cmp(arg1, arg2));
 }
 
+/*
+ * uuid_abbrev
+ *		Convert a uuid to an abbreviated sort key for tuplesort: its
+ *		leading bytes, packed so that unsigned comparison agrees with
+ *		uuid_cmp whenever the results differ.
+ */
+Datum
+uuid_abbrev(Datum original)
+{
+	pg_uuid_t  *uuid = DatumGetUUIDP(original);
+	Datum		result = 0;
+	int			i;
+
+	for (i = 0; i < sizeof(Datum); i++)
+		result = (result << 8) | uuid->data[i];
+
+	return result;
+}
+
 /* hash index support */
 Datum
 uuid_hash(PG_FUNCTION_ARGS)
@@ -1562,6 +1562,58 @@ bttextcmp(PG_FUNCTION_ARGS)
 	PG_RETURN_INT32(result);
 }
 
+/*
+ * bttext_abbrev
+ *		Convert a text value to an abbreviated sort key for tuplesort.
+ *
+ * The result is the first sizeof(Datum) bytes of the string's sort key,
+ * zero-padded and packed most-significant-first, so that comparing two
+ * results as unsigned integers gives the same answer as bttextcmp whenever
+ * they differ.  In the C locale the sort key is the string itself.  In other
+ * locales it is the output of strxfrm(); since some C libraries' strxfrm()
+ * is known not to agree with their strcoll(), tuplesort only calls us for
+ * non-C locales if TRUST_STRXFRM is defined.
+ */
+Datum
+bttext_abbrev(Datum original)
+{
+	text	   *arg = DatumGetTextPP(original);
+	char	   *key = VARDATA_ANY(arg);
+	Size		keylen = VARSIZE_ANY_EXHDR(arg);
+	char	   *xfrm = NULL;
+	Datum		result = 0;
+	Size		i;
+
+	if (!lc_collate_is_c())
+	{
+		char	   *src = palloc(keylen + 1);
+		Size		xfrmlen;
+
+		memcpy(src, key, keylen);
+		src[keylen] = '\0';
+		xfrmlen = strxfrm(NULL, src, 0);
+		xfrm = palloc(xfrmlen + 1);
+		strxfrm(xfrm, src, xfrmlen + 1);
+		pfree(src);
+		key = xfrm;
+		keylen = xfrmlen;
+	}
+
+	for (i = 0; i < sizeof(Datum); i++)
+	{
+		result <<= 8;
+		if (i < keylen)
+			result |= (unsigned char) key[i];
+	}
+
+	if (xfrm)
+		pfree(xfrm);
+	if ((Pointer) arg != DatumGetPointer(original))
+		pfree(arg);
+
+	return result;
+}
+
 
 Datum
 text_larger(PG_FUNCTION_ARGS)
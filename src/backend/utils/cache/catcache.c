@@ -14,18 +14,27 @@
  */
 #include "postgres.h"
 
+#include <unistd.h>
+
 #include "access/genam.h"
 #include "access/hash.h"
 #include "access/heapam.h"
 #include "access/relscan.h"
 #include "access/sysattr.h"
 #include "access/valid.h"
+#include "access/xact.h"
+#include "access/xlog.h"
+#include "catalog/catalog.h"
+#include "catalog/pg_class.h"
 #include "catalog/pg_operator.h"
+#include "catalog/pg_statistic.h"
 #include "catalog/pg_type.h"
 #include "miscadmin.h"
+#include "storage/fd.h"
 #ifdef CATCACHE_STATS
 #include "storage/ipc.h"		/* for on_proc_exit */
 #endif
+#include "storage/lwlock.h"
 #include "utils/builtins.h"
 #include "utils/fmgroids.h"
 #include "utils/inval.h"
@@ -46,6 +55,56 @@
 #define HASH_INDEX(h, sz) ((Index) ((h) & ((sz) - 1)))
 
 
+/*
+ * Upper limit on the space, in kilobytes, taken by the tuples of any one
+ * catcache; zero means no limit.  When a new entry would push a cache past
+ * the limit, unreferenced entries are evicted in least-recently-used order.
+ */
+int			catalog_cache_max_size = 0;
+
+/*
+ * Space charged against catalog_cache_max_size for a cache entry.  We don't
+ * try to account for palloc overhead, nor for CatCList headers, which are
+ * freed along with their members anyway.
+ */
+#define CatCTupSize(ct) (sizeof(CatCTup) + (ct)->tuple.t_len)
+
+/*
+ * If true, backends preload their catcaches from a per-database init file
+ * at startup, and write one when it's missing.  See CatalogCacheInitFileLoad.
+ */
+bool		catalog_cache_init_file = false;
+
+#define CATCACHE_INIT_FILEMAGIC		0x573267	/* version ID value */
+
+/*
+ * Catalogs whose tuples are never put into the init file.  Their rows are
+ * updated by routine VACUUM and ANALYZE, which would otherwise keep throwing
+ * the file away.
+ */
+#define CatalogIsExcludedFromInitFile(reloid) \
+	((reloid) == RelationRelationId || (reloid) == StatisticRelationId)
+
+/* Per-entry header in the init file; the tuple data follows it */
+typedef struct CatCacheInitFileEntry
+{
+	int			cacheId;		/* ID of the catcache holding the tuple */
+	uint32		hashValue;		/* hash value for its lookup keys */
+	ItemPointerData t_self;		/* tuple's TID */
+	Oid			t_tableOid;		/* catalog the tuple came from */
+	uint32		t_len;			/* length of tuple data that follows */
+} CatCacheInitFileEntry;
+
+/*
+ * Number of catcache invalidation events received, used to tell whether
+ * an init file we just wrote might be out of date already.
+ */
+static long catcacheInvalsReceived = 0L;
+
+/* Should we write an init file, and how many idle periods have we seen? */
+static bool catcacheInitFileWanted = false;
+static int	catcacheIdleCount = 0;
+
 /*
  *		variables, macros and other stuff
  */
@@ -80,11 +139,14 @@ static void CatCachePrintStats(int code, Datum arg);
 #endif
 static void CatCacheRemoveCTup(CatCache *cache, CatCTup *ct);
 static void CatCacheRemoveCList(CatCache *cache, CatCList *cl);
+static void CatCacheEvict(CatCache *cache, Size needed);
 static void CatalogCacheInitializeCache(CatCache *cache);
 static CatCTup *CatalogCacheCreateEntry(CatCache *cache, HeapTuple ntp,
 						uint32 hashValue, Index hashIndex,
 						bool negative);
 static HeapTuple build_dummy_tuple(CatCache *cache, int nkeys, ScanKey skeys);
+static CatCache *CatalogCacheGetById(int cacheId);
+static void write_catcache_init_file(void);
 
 
 /*
@@ -295,6 +357,7 @@ CatCachePrintStats(int code, Datum arg)
 	long		cc_neg_hits = 0;
 	long		cc_newloads = 0;
 	long		cc_invals = 0;
+	long		cc_evicts = 0;
 	long		cc_lsearches = 0;
 	long		cc_lhits = 0;
 
@@ -302,10 +365,11 @@ CatCachePrintStats(int code, Datum arg)
 	{
 		if (cache->cc_ntup == 0 && cache->cc_searches == 0)
 			continue;			/* don't print unused caches */
-		elog(DEBUG2, "catcache %s/%u: %d tup, %ld srch, %ld+%ld=%ld hits, %ld+%ld=%ld loads, %ld invals, %ld lsrch, %ld lhits",
+		elog(DEBUG2, "catcache %s/%u: %d tup, %lu bytes, %ld srch, %ld+%ld=%ld hits, %ld+%ld=%ld loads, %ld invals, %ld evicts, %ld lsrch, %ld lhits",
 			 cache->cc_relname,
 			 cache->cc_indexoid,
 			 cache->cc_ntup,
+			 (unsigned long) cache->cc_memsize,
 			 cache->cc_searches,
 			 cache->cc_hits,
 			 cache->cc_neg_hits,
@@ -314,6 +378,7 @@ CatCachePrintStats(int code, Datum arg)
 			 cache->cc_searches - cache->cc_hits - cache->cc_neg_hits - cache->cc_newloads,
 			 cache->cc_searches - cache->cc_hits - cache->cc_neg_hits,
 			 cache->cc_invals,
+			 cache->cc_evicts,
 			 cache->cc_lsearches,
 			 cache->cc_lhits);
 		cc_searches += cache->cc_searches;
@@ -321,10 +386,11 @@ CatCachePrintStats(int code, Datum arg)
 		cc_neg_hits += cache->cc_neg_hits;
 		cc_newloads += cache->cc_newloads;
 		cc_invals += cache->cc_invals;
+		cc_evicts += cache->cc_evicts;
 		cc_lsearches += cache->cc_lsearches;
 		cc_lhits += cache->cc_lhits;
 	}
-	elog(DEBUG2, "catcache totals: %d tup, %ld srch, %ld+%ld=%ld hits, %ld+%ld=%ld loads, %ld invals, %ld lsrch, %ld lhits",
+	elog(DEBUG2, "catcache totals: %d tup, %ld srch, %ld+%ld=%ld hits, %ld+%ld=%ld loads, %ld invals, %ld evicts, %ld lsrch, %ld lhits",
 		 CacheHdr->ch_ntup,
 		 cc_searches,
 		 cc_hits,
@@ -334,6 +400,7 @@ CatCachePrintStats(int code, Datum arg)
 		 cc_searches - cc_hits - cc_neg_hits - cc_newloads,
 		 cc_searches - cc_hits - cc_neg_hits,
 		 cc_invals,
+		 cc_evicts,
 		 cc_lsearches,
 		 cc_lhits);
 }
@@ -366,8 +433,12 @@ CatCacheRemoveCTup(CatCache *cache, CatCTup *ct)
 		return;					/* nothing left to do */
 	}
 
-	/* delink from linked list */
+	/* delink from linked lists */
 	DLRemove(&ct->cache_elem);
+	DLRemove(&ct->lru_elem);
+
+	Assert(cache->cc_memsize >= CatCTupSize(ct));
+	cache->cc_memsize -= CatCTupSize(ct);
 
 	/* free associated tuple data */
 	if (ct->tuple.t_data != NULL)
@@ -418,6 +489,53 @@ CatCacheRemoveCList(CatCache *cache, CatCList *cl)
 	pfree(cl);
 }
 
+/*
+ *		CatCacheEvict
+ *
+ * Make room for a new entry of "needed" bytes by removing unreferenced
+ * entries, least recently used first, until the cache fits within
+ * catalog_cache_max_size again (or nothing more can be removed).
+ *
+ * Entries that are in use, either directly or through a CatCList, are
+ * skipped; we move them to the front of the LRU list, since they are
+ * evidently not idle, so that later calls needn't step over them again.
+ * Removing an entry that belongs to an unreferenced CatCList removes the
+ * list too.
+ */
+static void
+CatCacheEvict(CatCache *cache, Size needed)
+{
+	Size		limit = (Size) catalog_cache_max_size * 1024L;
+	int			nskipped = 0;
+
+	while (cache->cc_memsize + needed > limit && nskipped < cache->cc_ntup)
+	{
+		Dlelem	   *elt = DLGetTail(&cache->cc_lru);
+		CatCTup    *ct;
+
+		if (elt == NULL)
+			break;
+		ct = (CatCTup *) DLE_VAL(elt);
+
+		if (ct->refcount > 0 || ct->dead ||
+			(ct->c_list && ct->c_list->refcount > 0))
+		{
+			DLMoveToFront(&ct->lru_elem);
+			nskipped++;
+			continue;
+		}
+
+		CACHE3_elog(DEBUG2, "CatCacheEvict(%s): evicting entry from bucket %d",
+					cache->cc_relname,
+					HASH_INDEX(ct->hash_value, cache->cc_nbuckets));
+
+		CatCacheRemoveCTup(cache, ct);
+#ifdef CATCACHE_STATS
+		cache->cc_evicts++;
+#endif
+	}
+}
+
 
 /*
  *	CatalogCacheIdInvalidate
@@ -450,6 +568,8 @@ CatalogCacheIdInvalidate(int cacheId,
 	Assert(ItemPointerIsValid(pointer));
 	CACHE1_elog(DEBUG2, "CatalogCacheIdInvalidate: called");
 
+	catcacheInvalsReceived++;
+
 	/*
 	 * inspect caches to find the proper cache
 	 */
@@ -666,6 +786,8 @@ ResetCatalogCaches(void)
 
 	CACHE1_elog(DEBUG2, "ResetCatalogCaches called");
 
+	catcacheInvalsReceived++;
+
 	for (cache = CacheHdr->ch_caches; cache; cache = cache->cc_next)
 		ResetCatalogCache(cache);
 
@@ -692,6 +814,8 @@ CatalogCacheFlushCatalog(Oid catId)
 
 	CACHE2_elog(DEBUG2, "CatalogCacheFlushCatalog called for %u", catId);
 
+	catcacheInvalsReceived++;
+
 	for (cache = CacheHdr->ch_caches; cache; cache = cache->cc_next)
 	{
 		/* We can ignore uninitialized caches, since they must be empty */
@@ -799,6 +923,7 @@ InitCatCache(int id,
 	cp->cc_relisshared = false; /* temporary */
 	cp->cc_tupdesc = (TupleDesc) NULL;
 	cp->cc_ntup = 0;
+	cp->cc_memsize = 0;
 	cp->cc_nbuckets = nbuckets;
 	cp->cc_nkeys = nkeys;
 	for (i = 0; i < nkeys; ++i)
@@ -1104,9 +1229,11 @@ SearchCatCache(CatCache *cache,
 		 * We found a match in the cache.  Move it to the front of the list
 		 * for its hashbucket, in order to speed subsequent searches.  (The
 		 * most frequently accessed elements in any hashbucket will tend to be
-		 * near the front of the hashbucket's list.)
+		 * near the front of the hashbucket's list.)  Likewise note it as
+		 * recently used, so that it's the last candidate for eviction.
 		 */
 		DLMoveToFront(&ct->cache_elem);
+		DLMoveToFront(&ct->lru_elem);
 
 		/*
 		 * If it's a positive entry, bump its refcount and return it. If it's
@@ -1355,9 +1482,12 @@ SearchCatCacheList(CatCache *cache,
 		 * cache's list-of-lists, to speed subsequent searches.  (We do not
 		 * move the members to the fronts of their hashbucket lists, however,
 		 * since there's no point in that unless they are searched for
-		 * individually.)
+		 * individually.)  The members do count as recently used, though:
+		 * evicting any of them would throw away the whole list.
 		 */
 		DLMoveToFront(&cl->cache_elem);
+		for (i = 0; i < cl->n_members; i++)
+			DLMoveToFront(&cl->members[i]->lru_elem);
 
 		/* Bump the list's refcount and return it */
 		ResourceOwnerEnlargeCatCacheListRefs(CurrentResourceOwner);
@@ -1449,6 +1579,8 @@ SearchCatCacheList(CatCache *cache,
 											 hashValue, hashIndex,
 											 false);
 			}
+			else
+				DLMoveToFront(&ct->lru_elem);
 
 			/* Careful here: add entry to ctlist, then bump its refcount */
 			/* This way leaves state correct if lappend runs out of memory */
@@ -1575,6 +1707,13 @@ CatalogCacheCreateEntry(CatCache *cache, HeapTuple ntp,
 	CatCTup    *ct;
 	MemoryContext oldcxt;
 
+	/*
+	 * If the cache is size-limited, make room first.  This must be done
+	 * before the new entry is linked in, since it is still unreferenced.
+	 */
+	if (catalog_cache_max_size > 0)
+		CatCacheEvict(cache, sizeof(CatCTup) + ntp->t_len);
+
 	/*
 	 * Allocate CatCTup header in cache memory, and copy the tuple there too.
 	 */
@@ -1590,6 +1729,7 @@ CatalogCacheCreateEntry(CatCache *cache, HeapTuple ntp,
 	ct->ct_magic = CT_MAGIC;
 	ct->my_cache = cache;
 	DLInitElem(&ct->cache_elem, (void *) ct);
+	DLInitElem(&ct->lru_elem, (void *) ct);
 	ct->c_list = NULL;
 	ct->refcount = 0;			/* for the moment */
 	ct->dead = false;
@@ -1597,8 +1737,10 @@ CatalogCacheCreateEntry(CatCache *cache, HeapTuple ntp,
 	ct->hash_value = hashValue;
 
 	DLAddHead(&cache->cc_bucket[hashIndex], &ct->cache_elem);
+	DLAddHead(&cache->cc_lru, &ct->lru_elem);
 
 	cache->cc_ntup++;
+	cache->cc_memsize += CatCTupSize(ct);
 	CacheHdr->ch_ntup++;
 
 	return ct;
@@ -1744,6 +1886,359 @@ PrepareToInvalidateCacheTuple(Relation relation,
 }
 
 
+/*
+ * CatalogCacheTupleIsInInitFile
+ *
+ *	Detect whether an update or delete of the given catalog tuple means that
+ *	the catcache init file must be removed at commit.  Tuples inserted by
+ *	the current transaction can't be in anybody's init file yet, so plain
+ *	inserts never cost us the file.
+ *
+ *	Like RelationIdIsInInitFile, this assumes all backends in a database
+ *	would make the same choice of which catalogs to save.
+ */
+bool
+CatalogCacheTupleIsInInitFile(Relation relation, HeapTuple tuple)
+{
+	CatCache   *ccp;
+	Oid			reloid;
+
+	if (!catalog_cache_init_file)
+		return false;
+
+	if (relation->rd_rel->relisshared)
+		return false;
+
+	reloid = RelationGetRelid(relation);
+	if (CatalogIsExcludedFromInitFile(reloid))
+		return false;
+
+	if (TransactionIdIsCurrentTransactionId(HeapTupleHeaderGetXmin(tuple->t_data)))
+		return false;
+
+	for (ccp = CacheHdr->ch_caches; ccp; ccp = ccp->cc_next)
+	{
+		if (ccp->cc_reloid == reloid)
+			return true;
+	}
+	return false;
+}
+
+/*
+ * CatalogCacheGetById
+ *		Find the catcache with the given ID, or NULL if there isn't one.
+ */
+static CatCache *
+CatalogCacheGetById(int cacheId)
+{
+	CatCache   *ccp;
+
+	for (ccp = CacheHdr->ch_caches; ccp; ccp = ccp->cc_next)
+	{
+		if (ccp->id == cacheId)
+			return ccp;
+	}
+	return NULL;
+}
+
+/*
+ * CatalogCacheInitFileLoad
+ *
+ *	Preload the catcaches from the database's catcache init file, if there
+ *	is one.  This is called during backend startup, inside the startup
+ *	transaction, after the relcache is fully initialized.
+ *
+ *	The init file holds the positive entries of the per-database catcaches
+ *	as some earlier backend had them after doing some work, so a new
+ *	backend doesn't have to fetch each of those tuples from the catalogs
+ *	itself.  Only positive entries are saved: negative entries and lists
+ *	could be made stale by a mere insertion, whereas a saved tuple only
+ *	goes stale when it is updated or deleted, which is what
+ *	CatalogCacheTupleIsInInitFile checks for.  Such a commit removes the
+ *	file using the same protocol as the relcache init file (see
+ *	RelationCacheInitFileInvalidate), and we're already in the PGPROC
+ *	array, so anything we load that goes stale later will be flushed by
+ *	the SI messages in the usual way.
+ *
+ *	That only works if those SI messages are processed after the stale
+ *	tuple has been entered.  Any catalog access can process pending SI
+ *	messages, so we do everything that might need one, namely initializing
+ *	the caches, before reading the file, and then enter what we read with
+ *	no catalog access in between.
+ *
+ *	If the file is missing or unreadable, we remember to write a new one
+ *	once this backend has populated its caches.
+ */
+void
+CatalogCacheInitFileLoad(void)
+{
+	char		initfilename[MAXPGPATH];
+	FILE	   *fp;
+	int			magic;
+	List	   *entries = NIL;
+	ListCell   *lc;
+	CatCache   *ccp;
+
+	/*
+	 * Not in hot standby: the master doesn't know whether we use the file,
+	 * so it can't be relied on to invalidate it.
+	 */
+	if (!catalog_cache_init_file || RecoveryInProgress())
+		return;
+
+	snprintf(initfilename, sizeof(initfilename), "%s/%s",
+			 DatabasePath, CATCACHE_INIT_FILENAME);
+
+	fp = AllocateFile(initfilename, PG_BINARY_R);
+	if (fp == NULL)
+	{
+		catcacheInitFileWanted = true;
+		return;
+	}
+
+	/*
+	 * Initialize every cache the file may hold entries for.  We can't tell
+	 * which of them it actually uses until we've read it, and by then it's
+	 * too late, see above.
+	 */
+	for (ccp = CacheHdr->ch_caches; ccp; ccp = ccp->cc_next)
+	{
+		if (ccp->cc_tupdesc == NULL &&
+			!IsSharedRelation(ccp->cc_reloid) &&
+			!CatalogIsExcludedFromInitFile(ccp->cc_reloid))
+			CatalogCacheInitializeCache(ccp);
+	}
+
+	/*
+	 * Read and check the whole file before touching the caches, so that a
+	 * truncated or corrupt file doesn't leave us with a partial load.  The
+	 * workspace is in the startup transaction's memory context, so we don't
+	 * bother to free it on failure.
+	 */
+	if (fread(&magic, 1, sizeof(magic), fp) != sizeof(magic) ||
+		magic != CATCACHE_INIT_FILEMAGIC)
+		goto read_failed;
+
+	for (;;)
+	{
+		CatCacheInitFileEntry *entry;
+		size_t		nread;
+		CatCache   *cache;
+
+		entry = (CatCacheInitFileEntry *) palloc(sizeof(CatCacheInitFileEntry));
+		nread = fread(entry, 1, sizeof(CatCacheInitFileEntry), fp);
+		if (nread != sizeof(CatCacheInitFileEntry))
+		{
+			if (nread == 0)
+				break;			/* end of file */
+			goto read_failed;
+		}
+
+		cache = CatalogCacheGetById(entry->cacheId);
+		if (entry->t_len < offsetof(HeapTupleHeaderData, t_bits) ||
+			entry->t_len > MaxHeapTupleSize ||
+			cache == NULL || cache->cc_tupdesc == NULL ||
+			cache->cc_relisshared)
+			goto read_failed;
+
+		/* keep the entry header and tuple data together in one chunk */
+		entry = (CatCacheInitFileEntry *)
+			repalloc(entry, MAXALIGN(sizeof(CatCacheInitFileEntry)) +
+					 entry->t_len);
+		if (fread((char *) entry + MAXALIGN(sizeof(CatCacheInitFileEntry)),
+				  1, entry->t_len, fp) != entry->t_len)
+			goto read_failed;
+
+		entries = lappend(entries, entry);
+	}
+
+	FreeFile(fp);
+
+	/*
+	 * The file is good, so enter its tuples into the caches.  Nothing in
+	 * this loop may access the catalogs.
+	 */
+	foreach(lc, entries)
+	{
+		CatCacheInitFileEntry *entry = (CatCacheInitFileEntry *) lfirst(lc);
+		CatCache   *cache = CatalogCacheGetById(entry->cacheId);
+		HeapTupleData tuple;
+		Index		hashIndex;
+		Dlelem	   *elt;
+
+		tuple.t_len = entry->t_len;
+		tuple.t_self = entry->t_self;
+		tuple.t_tableOid = entry->t_tableOid;
+		tuple.t_data = (HeapTupleHeader)
+			((char *) entry + MAXALIGN(sizeof(CatCacheInitFileEntry)));
+
+		/*
+		 * Startup may already have loaded some of the same tuples; skip
+		 * those rather than making duplicate entries.
+		 */
+		hashIndex = HASH_INDEX(entry->hashValue, cache->cc_nbuckets);
+		for (elt = DLGetHead(&cache->cc_bucket[hashIndex]);
+			 elt;
+			 elt = DLGetSucc(elt))
+		{
+			CatCTup    *ct = (CatCTup *) DLE_VAL(elt);
+
+			if (ct->hash_value == entry->hashValue && !ct->negative &&
+				ItemPointerEquals(&ct->tuple.t_self, &tuple.t_self))
+				break;
+		}
+		if (elt == NULL)
+			CatalogCacheCreateEntry(cache, &tuple, entry->hashValue,
+									hashIndex, false);
+	}
+
+	list_free_deep(entries);
+	return;
+
+read_failed:
+	FreeFile(fp);
+	elog(LOG, "ignoring invalid catalog cache initialization file \"%s\"",
+		 initfilename);
+	catcacheInitFileWanted = true;
+}
+
+/*
+ * CatalogCacheInitFileWrite
+ *
+ *	Called by the main loop each time the backend goes idle outside a
+ *	transaction block.  If CatalogCacheInitFileLoad didn't find a usable
+ *	init file, write one the second time we get here, that is after the
+ *	first query following startup has filled the caches somewhat.  Once is
+ *	enough; if the file gets removed again some other backend will write
+ *	the next one.
+ */
+void
+CatalogCacheInitFileWrite(void)
+{
+	if (!catcacheInitFileWanted)
+		return;
+	if (++catcacheIdleCount < 2)
+		return;
+	catcacheInitFileWanted = false;
+
+	/* We need a transaction to process incoming SI messages */
+	StartTransactionCommand();
+	write_catcache_init_file();
+	CommitTransactionCommand();
+}
+
+static void
+write_catcache_init_file(void)
+{
+	char		tempfilename[MAXPGPATH];
+	char		finalfilename[MAXPGPATH];
+	FILE	   *fp;
+	int			magic;
+	long		invalsBefore;
+	CatCache   *ccp;
+
+	/*
+	 * Every entry in our caches is up to date as of the SI messages we've
+	 * processed so far.  Remember how many that was, so we can tell below
+	 * whether more arrived while we were writing.
+	 */
+	invalsBefore = catcacheInvalsReceived;
+
+	/*
+	 * As with the relcache init file, write a temporary file and rename it
+	 * into place, so that a starting backend never sees a partial file.
+	 */
+	snprintf(tempfilename, sizeof(tempfilename), "%s/%s.%d",
+			 DatabasePath, CATCACHE_INIT_FILENAME, MyProcPid);
+	snprintf(finalfilename, sizeof(finalfilename), "%s/%s",
+			 DatabasePath, CATCACHE_INIT_FILENAME);
+
+	unlink(tempfilename);		/* in case it exists w/wrong permissions */
+
+	fp = AllocateFile(tempfilename, PG_BINARY_W);
+	if (fp == NULL)
+	{
+		ereport(WARNING,
+				(errcode_for_file_access(),
+				 errmsg("could not create catalog cache initialization file \"%s\": %m",
+						tempfilename),
+			  errdetail("Continuing anyway, but there's something wrong.")));
+		return;
+	}
+
+	magic = CATCACHE_INIT_FILEMAGIC;
+	if (fwrite(&magic, 1, sizeof(magic), fp) != sizeof(magic))
+		elog(FATAL, "could not write init file");
+
+	for (ccp = CacheHdr->ch_caches; ccp; ccp = ccp->cc_next)
+	{
+		int			i;
+
+		/* Skip caches that were never used, or that we don't save */
+		if (ccp->cc_tupdesc == NULL || ccp->cc_relisshared ||
+			CatalogIsExcludedFromInitFile(ccp->cc_reloid))
+			continue;
+
+		for (i = 0; i < ccp->cc_nbuckets; i++)
+		{
+			Dlelem	   *elt;
+
+			for (elt = DLGetHead(&ccp->cc_bucket[i]);
+				 elt;
+				 elt = DLGetSucc(elt))
+			{
+				CatCTup    *ct = (CatCTup *) DLE_VAL(elt);
+				CatCacheInitFileEntry entry;
+
+				if (ct->negative || ct->dead)
+					continue;
+
+				MemSet(&entry, 0, sizeof(entry));
+				entry.cacheId = ccp->id;
+				entry.hashValue = ct->hash_value;
+				entry.t_self = ct->tuple.t_self;
+				entry.t_tableOid = ct->tuple.t_tableOid;
+				entry.t_len = ct->tuple.t_len;
+
+				if (fwrite(&entry, 1, sizeof(entry), fp) != sizeof(entry))
+					elog(FATAL, "could not write init file");
+				if (fwrite(ct->tuple.t_data, 1, ct->tuple.t_len, fp) !=
+					ct->tuple.t_len)
+					elog(FATAL, "could not write init file");
+			}
+		}
+	}
+
+	if (FreeFile(fp))
+		elog(FATAL, "could not write init file");
+
+	/*
+	 * Now check whether any catalog changes were committed while we were
+	 * writing.  This must be interlocked against the unlinking done by
+	 * RelationCacheInitFileInvalidate, exactly as write_relcache_init_file
+	 * is.
+	 */
+	LWLockAcquire(RelCacheInitLock, LW_EXCLUSIVE);
+
+	/* Make sure we have seen all incoming SI messages */
+	AcceptInvalidationMessages();
+
+	if (catcacheInvalsReceived == invalsBefore)
+	{
+		/* noncritical if this fails; see write_relcache_init_file */
+		if (rename(tempfilename, finalfilename) < 0)
+			unlink(tempfilename);
+	}
+	else
+	{
+		/* Delete the possibly-obsolete temp file */
+		unlink(tempfilename);
+	}
+
+	LWLockRelease(RelCacheInitLock);
+}
+
+
 /*
  * Subroutines for warning about reference leaks.  These are exported so
  * that resowner.c can call them.
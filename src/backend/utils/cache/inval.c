@@ -432,6 +432,13 @@ RegisterCatalogInvalidation(Oid dbId, Oid catId)
 {
 	AddCatalogInvalidationMessage(&transInvalInfo->CurrentCmdInvalidMsgs,
 								  dbId, catId);
+
+	/*
+	 * The catalog's tuples have probably moved, so any of them saved in the
+	 * catcache init file are now wrong.
+	 */
+	if (catalog_cache_init_file && OidIsValid(dbId))
+		transInvalInfo->RelcacheInitFileInval = true;
 }
 
 /*
@@ -598,6 +605,13 @@ PrepareForTupleInvalidation(Relation relation, HeapTuple tuple)
 	PrepareToInvalidateCacheTuple(relation, tuple,
 								  RegisterCatcacheInvalidation);
 
+	/*
+	 * If the tuple might be saved in the catcache init file, that has to go
+	 * at commit too.  We piggyback on the relcache init file's flag.
+	 */
+	if (CatalogCacheTupleIsInInitFile(relation, tuple))
+		transInvalInfo->RelcacheInitFileInval = true;
+
 	/*
 	 * Now, is this tuple one of the primary definers of a relcache entry?
 	 */
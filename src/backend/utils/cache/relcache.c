@@ -67,6 +67,7 @@
 #include "storage/smgr.h"
 #include "utils/array.h"
 #include "utils/builtins.h"
+#include "utils/catcache.h"
 #include "utils/fmgroids.h"
 #include "utils/inval.h"
 #include "utils/lsyscache.h"
@@ -143,6 +144,13 @@ static List *initFileRelationIds = NIL;
  */
 static bool need_eoxact_work = false;
 
+/*
+ * Soft limit on the number of relcache entries; zero means no limit.  It is
+ * enforced at transaction end, when entries that have not been opened since
+ * the previous eviction sweep are discarded (see RelationCacheEvict).
+ */
+int			relation_cache_max_entries = 0;
+
 
 /*
  *		macros to manipulate the lookup hashtables
@@ -208,6 +216,7 @@ static void RelationClearRelation(Relation relation, bool rebuild);
 
 static void RelationReloadIndexInfo(Relation relation);
 static void RelationFlushRelation(Relation relation);
+static void RelationCacheEvict(void);
 static bool load_relcache_init_file(bool shared);
 static void write_relcache_init_file(bool shared);
 static void write_item(const void *data, Size len, FILE *fp);
@@ -1453,6 +1462,7 @@ formrdesc(const char *relationName, Oid relationReltype,
 
 	relation->rd_rel->relpages = 1;
 	relation->rd_rel->reltuples = 1;
+	relation->rd_rel->relallvisible = 0;
 	relation->rd_rel->relkind = RELKIND_RELATION;
 	relation->rd_rel->relhasoids = hasoids;
 	relation->rd_rel->relnatts = (int16) natts;
@@ -1581,6 +1591,7 @@ RelationIdGetRelation(Oid relationId)
 	if (RelationIsValid(rd))
 	{
 		RelationIncrementReferenceCount(rd);
+		rd->rd_recentlyused = true;
 		/* revalidate cache entry if necessary */
 		if (!rd->rd_isvalid)
 		{
@@ -1603,7 +1614,10 @@ RelationIdGetRelation(Oid relationId)
 	 */
 	rd = RelationBuildDesc(relationId, true);
 	if (RelationIsValid(rd))
+	{
 		RelationIncrementReferenceCount(rd);
+		rd->rd_recentlyused = true;
+	}
 	return rd;
 }
 
@@ -2247,6 +2261,65 @@ RelationCloseSmgrByOid(Oid relationId)
 	RelationCloseSmgr(relation);
 }
 
+/*
+ * RelationCacheEvict
+ *
+ *	Discard unused relcache entries until the cache is back under
+ *	relation_cache_max_entries.
+ *
+ *	This is a clock sweep over the hash table: an entry opened since the
+ *	previous sweep has its rd_recentlyused flag cleared and is spared this
+ *	time, others are destroyed just as RelationCacheInvalidate would destroy
+ *	them.  We go around at most twice, so that a cache full of recently-used
+ *	entries still gets trimmed.  Nailed entries, entries still referenced,
+ *	and entries carrying state about the current transaction are never
+ *	candidates.  We trim to 90% of the limit so that a cache hovering around
+ *	the limit doesn't have to be swept at every transaction end.
+ *
+ *	Since the entries destroyed have zero refcount, this is no more
+ *	dangerous than processing an sinval reset.
+ */
+static void
+RelationCacheEvict(void)
+{
+	HASH_SEQ_STATUS status;
+	RelIdCacheEnt *idhentry;
+	long		target = relation_cache_max_entries - relation_cache_max_entries / 10;
+	int			pass;
+
+	for (pass = 0; pass < 2; pass++)
+	{
+		hash_seq_init(&status, RelationIdCache);
+
+		while ((idhentry = (RelIdCacheEnt *) hash_seq_search(&status)) != NULL)
+		{
+			Relation	relation = idhentry->reldesc;
+
+			if (hash_get_num_entries(RelationIdCache) <= target)
+			{
+				hash_seq_term(&status);
+				return;
+			}
+
+			if (relation->rd_isnailed ||
+				!RelationHasReferenceCountZero(relation) ||
+				relation->rd_createSubid != InvalidSubTransactionId ||
+				relation->rd_newRelfilenodeSubid != InvalidSubTransactionId ||
+				relation->rd_indexvalid == 2)
+				continue;
+
+			if (relation->rd_recentlyused)
+			{
+				relation->rd_recentlyused = false;
+				continue;
+			}
+
+			/* OK to delete the current entry while scanning */
+			RelationClearRelation(relation, false);
+		}
+	}
+}
+
 /*
  * AtEOXact_RelationCache
  *
@@ -2269,6 +2342,14 @@ AtEOXact_RelationCache(bool isCommit)
 	HASH_SEQ_STATUS status;
 	RelIdCacheEnt *idhentry;
 
+	/*
+	 * If the cache has grown beyond its limit, trim it.  Entries that the
+	 * code below still has to clean up are left alone by this.
+	 */
+	if (relation_cache_max_entries > 0 && !IsBootstrapProcessingMode() &&
+		hash_get_num_entries(RelationIdCache) > relation_cache_max_entries)
+		RelationCacheEvict();
+
 	/*
 	 * To speed up transaction exit, we want to avoid scanning the relcache
 	 * unless there is actually something for this routine to do.  Other than
@@ -2680,6 +2761,7 @@ RelationSetNewRelfilenode(Relation relation, TransactionId freezeXid)
 	/* These changes are safe even for a mapped relation */
 	classform->relpages = 0;	/* it's empty until further notice */
 	classform->reltuples = 0;
+	classform->relallvisible = 0;
 	classform->relfrozenxid = freezeXid;
 
 	simple_heap_update(pg_class, &tuple->t_self, tuple);
@@ -4163,6 +4245,7 @@ load_relcache_init_file(bool shared)
 		rel->rd_oidindex = InvalidOid;
 		rel->rd_createSubid = InvalidSubTransactionId;
 		rel->rd_newRelfilenodeSubid = InvalidSubTransactionId;
+		rel->rd_recentlyused = false;
 		rel->rd_amcache = NULL;
 		MemSet(&rel->pgstat_info, 0, sizeof(rel->pgstat_info));
 
@@ -4460,6 +4543,9 @@ RelationIdIsInInitFile(Oid relationId)
  * Ignore any failure to unlink the file, since it might not be there if
  * no backend has been started since the last removal.
  *
+ * The catcache init file, if any, is removed along with the local relcache
+ * init file; see CatalogCacheInitFileLoad.
+ *
  * Notice this deals only with the local init file, not the shared init file.
  * The reason is that there can never be a "significant" change to the
  * relcache entry of a shared relation; the most that could happen is
@@ -4471,14 +4557,18 @@ void
 RelationCacheInitFileInvalidate(bool beforeSend)
 {
 	char		initfilename[MAXPGPATH];
+	char		catcachefilename[MAXPGPATH];
 
 	snprintf(initfilename, sizeof(initfilename), "%s/%s",
 			 DatabasePath, RELCACHE_INIT_FILENAME);
+	snprintf(catcachefilename, sizeof(catcachefilename), "%s/%s",
+			 DatabasePath, CATCACHE_INIT_FILENAME);
 
 	if (beforeSend)
 	{
 		/* no interlock needed here */
 		unlink(initfilename);
+		unlink(catcachefilename);
 	}
 	else
 	{
@@ -4492,6 +4582,7 @@ RelationCacheInitFileInvalidate(bool beforeSend)
 		 */
 		LWLockAcquire(RelCacheInitLock, LW_EXCLUSIVE);
 		unlink(initfilename);
+		unlink(catcachefilename);
 		LWLockRelease(RelCacheInitLock);
 	}
 }
@@ -4568,10 +4659,13 @@ RelationCacheInitFileRemoveInDir(const char *tblspcpath)
 	{
 		if (strspn(de->d_name, "0123456789") == strlen(de->d_name))
 		{
-			/* Try to remove the init file in each database */
+			/* Try to remove the init files in each database */
 			snprintf(initfilename, sizeof(initfilename), "%s/%s/%s",
 					 tblspcpath, de->d_name, RELCACHE_INIT_FILENAME);
 			unlink_initfile(initfilename);
+			snprintf(initfilename, sizeof(initfilename), "%s/%s/%s",
+					 tblspcpath, de->d_name, CATCACHE_INIT_FILENAME);
+			unlink_initfile(initfilename);
 		}
 	}
 
@@ -841,9 +841,18 @@ hash_search_with_hash_value(HTAB *hashp,
 
 	while (currBucket != NULL)
 	{
-		if (currBucket->hashvalue == hashvalue &&
-			match(ELEMENTKEY(currBucket), keyPtr, keysize) == 0)
-			break;
+		if (currBucket->hashvalue == hashvalue)
+		{
+			/*
+			 * The match function may have to chase pointers out of the
+			 * element (TupleHashTable entries only point to their tuples),
+			 * so get the next element on its way in case this isn't it.
+			 */
+			if (currBucket->link != NULL)
+				pg_prefetch_mem(currBucket->link);
+			if (match(ELEMENTKEY(currBucket), keyPtr, keysize) == 0)
+				break;
+		}
 		prevBucketPtr = &(currBucket->link);
 		currBucket = *prevBucketPtr;
 #if HASH_STATISTICS
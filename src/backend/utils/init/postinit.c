@@ -48,6 +48,7 @@
 #include "storage/smgr.h"
 #include "tcop/tcopprot.h"
 #include "utils/acl.h"
+#include "utils/catcache.h"
 #include "utils/fmgroids.h"
 #include "utils/guc.h"
 #include "utils/pg_locale.h"
@@ -835,6 +836,10 @@ InitPostgres(const char *in_dbname, Oid dboid, const char *username,
 	 * selected the active user and gotten the right GUC settings.
 	 */
 
+	/* preload the catcaches from the init file, if we have one */
+	if (!bootstrap && !am_walsender)
+		CatalogCacheInitFileLoad();
+
 	/* set default namespace search path */
 	InitializeSearchPath();
 
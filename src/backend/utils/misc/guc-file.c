@@ -0,0 +1,1149 @@
+/* A lexical scanner generated by pyflex */
+#define yy_create_buffer GUC_yy_create_buffer
+#define yy_delete_buffer GUC_yy_delete_buffer
+#define yy_flex_debug GUC_yy_flex_debug
+#define yy_init_buffer GUC_yy_init_buffer
+#define yy_flush_buffer GUC_yy_flush_buffer
+#define yy_load_buffer_state GUC_yy_load_buffer_state
+#define yy_switch_to_buffer GUC_yy_switch_to_buffer
+#define yyin GUC_yyin
+#define yyleng GUC_yyleng
+#define yylex GUC_yylex
+#define yylineno GUC_yylineno
+#define yyout GUC_yyout
+#define yyrestart GUC_yyrestart
+#define yytext GUC_yytext
+#define yywrap GUC_yywrap
+#define yyalloc GUC_yyalloc
+#define yyrealloc GUC_yyrealloc
+#define yyfree GUC_yyfree
+#define yy_scan_buffer GUC_yy_scan_buffer
+#define yy_scan_string GUC_yy_scan_string
+#define yy_scan_bytes GUC_yy_scan_bytes
+#define yylex_init GUC_yylex_init
+#define yylex_destroy GUC_yylex_destroy
+#define yyget_extra GUC_yyget_extra
+#define yyset_extra GUC_yyset_extra
+#define yyget_in GUC_yyget_in
+#define yyset_in GUC_yyset_in
+#define yyget_out GUC_yyget_out
+#define yyset_out GUC_yyset_out
+#define yyget_leng GUC_yyget_leng
+#define yyget_text GUC_yyget_text
+#define yyget_lineno GUC_yyget_lineno
+#define yyset_lineno GUC_yyset_lineno
+#define yyget_column GUC_yyget_column
+#define yyset_column GUC_yyset_column
+#define yyget_lval GUC_yyget_lval
+#define yyset_lval GUC_yyset_lval
+#define yyget_lloc GUC_yyget_lloc
+#define yyset_lloc GUC_yyset_lloc
+#define yyget_debug GUC_yyget_debug
+#define yyset_debug GUC_yyset_debug
+#define FLEX_SCANNER
+#define YY_FLEX_MAJOR_VERSION 2
+#define YY_FLEX_MINOR_VERSION 5
+#define YY_FLEX_SUBMINOR_VERSION 35
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <stdlib.h>
+#ifndef YY_TYPEDEF_YY_SIZE_T
+#define YY_TYPEDEF_YY_SIZE_T
+typedef size_t yy_size_t;
+#endif
+#define yyconst const
+#define YY_NULL 0
+#define YY_END_OF_BUFFER_CHAR 0
+#ifndef YY_BUF_SIZE
+#define YY_BUF_SIZE 16384
+#endif
+#ifndef YY_TYPEDEF_YY_BUFFER_STATE
+#define YY_TYPEDEF_YY_BUFFER_STATE
+typedef struct yy_buffer_state *YY_BUFFER_STATE;
+#endif
+struct yy_buffer_state
+{
+	FILE *yy_input_file;
+	char *yy_ch_buf;
+	yy_size_t yy_buf_size;
+	int yy_n_chars;
+	int yy_pos;
+	int yy_filled;
+	int yy_is_our_buffer;
+};
+void yyrestart(FILE *input_file);
+void yy_switch_to_buffer(YY_BUFFER_STATE new_buffer);
+YY_BUFFER_STATE yy_create_buffer(FILE *file, int size);
+void yy_delete_buffer(YY_BUFFER_STATE b);
+void yy_flush_buffer(YY_BUFFER_STATE b);
+YY_BUFFER_STATE yy_scan_buffer(char *base, yy_size_t size);
+YY_BUFFER_STATE yy_scan_string(yyconst char *yy_str);
+YY_BUFFER_STATE yy_scan_bytes(yyconst char *bytes, int len);
+void *yyalloc(yy_size_t);
+void *yyrealloc(void *, yy_size_t);
+void yyfree(void *);
+int yylex_destroy(void);
+extern int yyleng;
+extern FILE *yyin, *yyout;
+extern char *yytext;
+extern int yylineno;
+
+/* user code from definitions section */
+
+#include "postgres.h"
+
+#include <ctype.h>
+#include <unistd.h>
+
+#include "miscadmin.h"
+#include "storage/fd.h"
+#include "utils/guc.h"
+
+
+/* Avoid exit() on fatal scanner errors (a bit ugly -- see yy_fatal_error) */
+#undef fprintf
+#define fprintf(file, fmt, msg)  ereport(ERROR, (errmsg_internal("%s", msg)))
+
+enum {
+	GUC_ID = 1,
+	GUC_STRING = 2,
+	GUC_INTEGER = 3,
+	GUC_REAL = 4,
+	GUC_EQUALS = 5,
+	GUC_UNQUOTED_STRING = 6,
+	GUC_QUALIFIED_ID = 7,
+	GUC_EOL = 99,
+	GUC_ERROR = 100
+};
+
+struct name_value_pair
+{
+	char       *name;
+	char       *value;
+	char	   *filename;
+	int			sourceline;
+	struct name_value_pair *next;
+};
+
+static unsigned int ConfigFileLineno;
+
+/* flex fails to supply a prototype for yylex, so provide one */
+int GUC_yylex(void);
+
+static bool ParseConfigFile(const char *config_file, const char *calling_file,
+							int depth, GucContext context, int elevel,
+							struct name_value_pair **head_p,
+							struct name_value_pair **tail_p);
+static void free_name_value_list(struct name_value_pair * list);
+static char *GUC_scanstr(const char *s);
+
+
+/* start conditions */
+#define INITIAL 0
+#ifndef YY_EXTRA_TYPE
+#define YY_EXTRA_TYPE void *
+#endif
+#define YYG(x) (x)
+int yyleng;
+FILE *yyin = NULL, *yyout = NULL;
+char *yytext;
+int yylineno = 1;
+static YY_BUFFER_STATE yy_current_buffer = NULL;
+static char yy_hold_char;
+static char *yy_hold_ptr = NULL;
+static int yy_init = 0;
+static int yy_start = 0;
+#define YY_CURRENT_BUFFER (YYG(yy_current_buffer))
+#define YY_CURRENT_BUFFER_LVALUE YYG(yy_current_buffer)
+#define BEGIN YYG(yy_start) = 
+#define YY_START (YYG(yy_start))
+#define YYSTATE YY_START
+#define yyterminate() return YY_NULL
+#ifndef ECHO
+#define ECHO do { if (fwrite(yytext, yyleng, 1, yyout)) {} } while (0)
+#endif
+#ifndef YY_USER_ACTION
+#define YY_USER_ACTION
+#endif
+#ifndef YY_BREAK
+#define YY_BREAK break;
+#endif
+#define YY_RULE_SETUP YY_USER_ACTION
+#define YY_FATAL_ERROR(msg) yy_fatal_error(msg)
+static void yy_fatal_error(yyconst char *msg);
+static void yy_fill_buffer(YY_BUFFER_STATE b);
+#undef yyless
+#define yyless(n) \
+	do { \
+		int yyless_macro_arg = (n); \
+		if (YYG(yy_hold_ptr)) *YYG(yy_hold_ptr) = YYG(yy_hold_char); \
+		YYG(yy_hold_ptr) = yytext + yyless_macro_arg; \
+		YYG(yy_hold_char) = *YYG(yy_hold_ptr); \
+		*YYG(yy_hold_ptr) = '\0'; \
+		yyleng = yyless_macro_arg; \
+		YY_CURRENT_BUFFER->yy_pos = (int) (YYG(yy_hold_ptr) - YY_CURRENT_BUFFER->yy_ch_buf); \
+	} while (0)
+#ifndef YY_DECL
+#define YY_DECL_IS_OURS 1
+extern int yylex(void);
+#define YY_DECL int yylex(void)
+#endif
+static yyconst unsigned char yy_ec[256] = {18,18,18,18,18,18,18,18,18,1,0,18,18,1,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,1,18,18,2,18,18,18,4,18,18,18,9,18,6,3,8,10,11,11,11,11,11,11,11,11,11,8,18,18,14,18,18,18,15,15,15,15,13,15,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,18,5,18,18,7,18,15,15,15,15,13,15,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,12,16,16,18,18,18,18,18,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17};
+static yyconst short yy_nxt[47][19] = {
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{2,3,4,5,6,7,8,9,7,10,11,12,9,9,13,9,9,9,7},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15},
+{0,0,0,0,0,0,0,0,0,0,16,16,0,17,0,0,0,0,0},
+{0,18,18,18,19,20,18,18,18,18,18,18,18,18,18,18,18,18,18},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,21,0,0,0,0,0,0,22,23,0,0,0,0,0,0,0},
+{0,0,0,24,0,0,25,26,25,0,27,27,27,27,0,27,27,27,0},
+{0,0,0,21,0,0,0,0,0,0,22,23,0,0,0,0,0,0,0},
+{0,0,0,21,0,0,0,0,0,0,28,28,29,30,0,30,30,0,0},
+{0,0,0,21,0,0,0,0,0,0,28,28,30,30,0,30,30,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15},
+{0,0,0,0,0,0,0,0,0,0,16,16,0,17,0,0,0,0,0},
+{0,0,0,0,0,0,31,0,0,32,33,33,0,0,0,0,0,0,0},
+{0,18,18,18,19,20,18,18,18,18,18,18,18,18,18,18,18,18,18},
+{0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35},
+{0,0,0,0,0,0,0,0,0,0,16,16,0,17,0,0,0,0,0},
+{0,0,0,21,0,0,0,0,0,0,28,28,29,30,0,30,30,0,0},
+{0,0,0,21,0,0,0,0,0,0,28,28,30,30,0,30,30,0,0},
+{0,0,0,25,0,0,25,36,25,0,37,37,38,38,0,38,38,38,0},
+{0,0,0,25,0,0,25,39,25,0,37,37,37,37,0,37,37,37,0},
+{0,0,0,24,0,0,25,26,25,0,27,27,27,27,0,27,27,27,0},
+{0,0,0,24,0,0,25,26,25,0,27,27,27,27,0,27,27,27,0},
+{0,0,0,21,0,0,0,0,0,0,28,28,30,30,0,30,30,0,0},
+{0,0,0,0,0,0,0,0,0,0,40,40,30,41,0,41,30,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,30,30,0,30,30,0,0},
+{0,0,0,0,0,0,0,0,0,0,33,33,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,33,33,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,42,42,0,0,0,0,0,0,0},
+{0,18,18,18,19,20,18,18,18,18,18,18,18,18,18,18,18,18,18},
+{0,18,18,18,19,20,18,18,18,18,18,18,18,18,18,18,18,18,18},
+{0,0,0,25,0,0,25,43,25,0,44,44,44,44,0,44,44,44,0},
+{0,0,0,25,0,0,25,39,25,0,37,37,37,37,0,37,37,37,0},
+{0,0,0,25,0,0,25,43,25,0,44,44,44,44,0,44,44,44,0},
+{0,0,0,25,0,0,25,39,25,0,37,37,37,37,0,37,37,37,0},
+{0,0,0,0,0,0,0,0,0,0,45,45,30,46,0,46,30,0,0},
+{0,0,0,0,0,0,0,0,0,0,45,45,30,46,0,46,30,0,0},
+{0,0,0,0,0,0,0,0,0,0,42,42,0,0,0,0,0,0,0},
+{0,0,0,25,0,0,25,43,25,0,44,44,44,44,0,44,44,44,0},
+{0,0,0,25,0,0,25,43,25,0,44,44,44,44,0,44,44,44,0},
+{0,0,0,0,0,0,0,0,0,0,45,45,30,46,0,46,30,0,0},
+{0,0,0,0,0,0,0,0,0,0,45,45,30,46,0,46,30,0,0},
+};
+static yyconst short yy_accept[47] = {0,0,1,2,3,9,11,11,11,4,11,8,8,10,2,3,9,0,0,6,0,9,8,8,7,7,4,4,8,8,8,0,0,9,0,0,5,7,5,7,8,8,9,5,5,8,8};
+static yyconst short yy_start_state[2] = {1,1};
+YY_DECL
+{
+	int yy_current_state;
+	char *yy_cp, *yy_bp, *yy_end, *yy_last;
+	int yy_act;
+	YY_BUFFER_STATE yy_b;
+	if (!YYG(yy_init))
+	{
+		YYG(yy_init) = 1;
+		if (!yyin)
+			yyin = stdin;
+		if (!yyout)
+			yyout = stdout;
+	}
+	{
+
+	}
+	while (1)
+	{
+		if (YYG(yy_hold_ptr))
+		{
+			*YYG(yy_hold_ptr) = YYG(yy_hold_char);
+			YYG(yy_hold_ptr) = NULL;
+		}
+		if (!YY_CURRENT_BUFFER)
+			YY_CURRENT_BUFFER_LVALUE = yy_create_buffer(yyin, YY_BUF_SIZE);
+		yy_b = YY_CURRENT_BUFFER;
+		if (!yy_b->yy_filled)
+			yy_fill_buffer(yy_b);
+		yy_bp = yy_b->yy_ch_buf + yy_b->yy_pos;
+		if (yy_b->yy_pos >= yy_b->yy_n_chars)
+		{
+			yytext = yy_bp;
+			yyleng = 0;
+			switch (YY_START)
+			{
+				default:
+					yyterminate();
+			}
+		}
+		yy_current_state = yy_start_state[YY_START * 2 + ((yy_b->yy_pos == 0 || yy_b->yy_ch_buf[yy_b->yy_pos - 1] == '\n') ? 1 : 0)];
+		yy_cp = yy_bp;
+		yy_end = yy_b->yy_ch_buf + yy_b->yy_n_chars;
+		yy_act = 0;
+		yy_last = NULL;
+		while (yy_cp < yy_end)
+		{
+			yy_current_state = yy_nxt[yy_current_state][yy_ec[(unsigned char) *yy_cp]];
+			if (yy_current_state == 0)
+				break;
+			yy_cp++;
+			if (yy_accept[yy_current_state])
+			{
+				yy_act = yy_accept[yy_current_state];
+				yy_last = yy_cp;
+			}
+		}
+		if (!yy_act)
+			YY_FATAL_ERROR("flex scanner jammed");
+		yy_cp = yy_last;
+		yytext = yy_bp;
+		yyleng = (int) (yy_cp - yy_bp);
+		YYG(yy_hold_ptr) = yy_cp;
+		YYG(yy_hold_char) = *yy_cp;
+		*yy_cp = '\0';
+		yy_b->yy_pos = (int) (yy_cp - yy_b->yy_ch_buf);
+do_action:
+		switch (yy_act)
+		{
+			case 1:
+YY_RULE_SETUP
+ConfigFileLineno++; return GUC_EOL;
+	YY_BREAK
+			case 2:
+YY_RULE_SETUP
+/* eat whitespace */
+	YY_BREAK
+			case 3:
+YY_RULE_SETUP
+/* eat comment (.* matches anything until newline) */
+	YY_BREAK
+			case 4:
+YY_RULE_SETUP
+return GUC_ID;
+	YY_BREAK
+			case 5:
+YY_RULE_SETUP
+return GUC_QUALIFIED_ID;
+	YY_BREAK
+			case 6:
+YY_RULE_SETUP
+return GUC_STRING;
+	YY_BREAK
+			case 7:
+YY_RULE_SETUP
+return GUC_UNQUOTED_STRING;
+	YY_BREAK
+			case 8:
+YY_RULE_SETUP
+return GUC_INTEGER;
+	YY_BREAK
+			case 9:
+YY_RULE_SETUP
+return GUC_REAL;
+	YY_BREAK
+			case 10:
+YY_RULE_SETUP
+return GUC_EQUALS;
+	YY_BREAK
+			case 11:
+YY_RULE_SETUP
+return GUC_ERROR;
+	YY_BREAK
+			default:
+				YY_FATAL_ERROR("fatal flex scanner internal error--no action found");
+		}
+	}
+}
+
+static void
+yy_fatal_error(yyconst char *msg)
+{
+	(void) fprintf(stderr, "%s\n", msg);
+	exit(2);
+}
+
+static void
+yy_fill_buffer(YY_BUFFER_STATE b)
+{
+	yy_size_t	size = 16384;
+	yy_size_t	n = 0;
+
+	b->yy_ch_buf = (char *) yyalloc(size + 2);
+	if (!b->yy_ch_buf)
+		YY_FATAL_ERROR("out of dynamic memory in yy_fill_buffer()");
+	if (b->yy_input_file)
+	{
+		for (;;)
+		{
+			size_t		r;
+
+			if (n == size)
+			{
+				size *= 2;
+				b->yy_ch_buf = (char *) yyrealloc(b->yy_ch_buf, size + 2);
+				if (!b->yy_ch_buf)
+					YY_FATAL_ERROR("out of dynamic memory in yy_fill_buffer()");
+			}
+			r = fread(b->yy_ch_buf + n, 1, size - n, b->yy_input_file);
+			if (r == 0)
+			{
+				if (ferror(b->yy_input_file) && errno == EINTR)
+				{
+					clearerr(b->yy_input_file);
+					continue;
+				}
+				break;
+			}
+			n += r;
+		}
+	}
+	b->yy_ch_buf[n] = b->yy_ch_buf[n + 1] = YY_END_OF_BUFFER_CHAR;
+	b->yy_n_chars = (int) n;
+	b->yy_buf_size = size;
+	b->yy_pos = 0;
+	b->yy_filled = 1;
+	b->yy_is_our_buffer = 1;
+}
+
+void
+yyrestart(FILE *input_file)
+{
+
+	if (YYG(yy_hold_ptr))
+	{
+		*YYG(yy_hold_ptr) = YYG(yy_hold_char);
+		YYG(yy_hold_ptr) = NULL;
+	}
+	if (YY_CURRENT_BUFFER)
+		yy_delete_buffer(YY_CURRENT_BUFFER);
+	YY_CURRENT_BUFFER_LVALUE = yy_create_buffer(input_file, YY_BUF_SIZE);
+}
+
+void
+yy_switch_to_buffer(YY_BUFFER_STATE new_buffer)
+{
+
+	if (YYG(yy_hold_ptr))
+	{
+		*YYG(yy_hold_ptr) = YYG(yy_hold_char);
+		YYG(yy_hold_ptr) = NULL;
+	}
+	YY_CURRENT_BUFFER_LVALUE = new_buffer;
+}
+
+YY_BUFFER_STATE
+yy_create_buffer(FILE *file, int size)
+{
+	YY_BUFFER_STATE b;
+
+	(void) size;
+	b = (YY_BUFFER_STATE) yyalloc(sizeof(struct yy_buffer_state));
+	if (!b)
+		YY_FATAL_ERROR("out of dynamic memory in yy_create_buffer()");
+	memset(b, 0, sizeof(struct yy_buffer_state));
+	b->yy_input_file = file;
+	return b;
+}
+
+void
+yy_delete_buffer(YY_BUFFER_STATE b)
+{
+
+	if (!b)
+		return;
+	if (b == YY_CURRENT_BUFFER)
+	{
+		if (YYG(yy_hold_ptr))
+		{
+			*YYG(yy_hold_ptr) = YYG(yy_hold_char);
+			YYG(yy_hold_ptr) = NULL;
+		}
+		YY_CURRENT_BUFFER_LVALUE = NULL;
+	}
+	if (b->yy_is_our_buffer && b->yy_ch_buf)
+		yyfree(b->yy_ch_buf);
+	yyfree(b);
+}
+
+void
+yy_flush_buffer(YY_BUFFER_STATE b)
+{
+	if (!b)
+		return;
+	b->yy_pos = b->yy_n_chars;
+}
+
+YY_BUFFER_STATE
+yy_scan_buffer(char *base, yy_size_t size)
+{
+	YY_BUFFER_STATE b;
+
+	if (size < 2 ||
+		base[size - 2] != YY_END_OF_BUFFER_CHAR ||
+		base[size - 1] != YY_END_OF_BUFFER_CHAR)
+		return NULL;
+	b = (YY_BUFFER_STATE) yyalloc(sizeof(struct yy_buffer_state));
+	if (!b)
+		YY_FATAL_ERROR("out of dynamic memory in yy_scan_buffer()");
+	memset(b, 0, sizeof(struct yy_buffer_state));
+	b->yy_ch_buf = base;
+	b->yy_buf_size = size - 2;
+	b->yy_n_chars = (int) (size - 2);
+	b->yy_pos = 0;
+	b->yy_filled = 1;
+	b->yy_is_our_buffer = 0;
+	yy_switch_to_buffer(b);
+	return b;
+}
+
+YY_BUFFER_STATE
+yy_scan_string(yyconst char *yystr)
+{
+	return yy_scan_bytes(yystr, (int) strlen(yystr));
+}
+
+YY_BUFFER_STATE
+yy_scan_bytes(yyconst char *yybytes, int len)
+{
+	YY_BUFFER_STATE b;
+	char	   *buf;
+
+	buf = (char *) yyalloc(len + 2);
+	if (!buf)
+		YY_FATAL_ERROR("out of dynamic memory in yy_scan_bytes()");
+	memcpy(buf, yybytes, len);
+	buf[len] = buf[len + 1] = YY_END_OF_BUFFER_CHAR;
+	b = yy_scan_buffer(buf, len + 2);
+	if (!b)
+		YY_FATAL_ERROR("bad buffer in yy_scan_bytes()");
+	b->yy_is_our_buffer = 1;
+	return b;
+}
+
+int
+yylex_destroy(void)
+{
+	if (YY_CURRENT_BUFFER)
+		yy_delete_buffer(YY_CURRENT_BUFFER);
+	yy_init = 0;
+	yy_start = 0;
+	return 0;
+}
+void *
+yyalloc(yy_size_t size)
+{
+	return malloc(size);
+}
+void *
+yyrealloc(void *ptr, yy_size_t size)
+{
+	return realloc(ptr, size);
+}
+void
+yyfree(void *ptr)
+{
+	free(ptr);
+}
+
+/* user code */
+
+
+
+/*
+ * Exported function to read and process the configuration file. The
+ * parameter indicates in what context the file is being read --- either
+ * postmaster startup (including standalone-backend startup) or SIGHUP.
+ * All options mentioned in the configuration file are set to new values.
+ * If an error occurs, no values will be changed.
+ */
+void
+ProcessConfigFile(GucContext context)
+{
+	int			elevel;
+	struct name_value_pair *item, *head, *tail;
+	char	   *cvc = NULL;
+	struct config_string *cvc_struct;
+	const char *envvar;
+	int			i;
+
+	Assert(context == PGC_POSTMASTER || context == PGC_SIGHUP);
+
+	if (context == PGC_SIGHUP)
+	{
+		/*
+		 * To avoid cluttering the log, only the postmaster bleats loudly
+		 * about problems with the config file.
+		 */
+		elevel = IsUnderPostmaster ? DEBUG2 : LOG;
+	}
+	else
+		elevel = ERROR;
+
+	/* Parse the file into a list of option names and values */
+	head = tail = NULL;
+
+	if (!ParseConfigFile(ConfigFileName, NULL,
+						 0, context, elevel,
+						 &head, &tail))
+		goto cleanup_list;
+
+	/*
+	 * We need the proposed new value of custom_variable_classes to check
+	 * custom variables with.  ParseConfigFile ensured that if it's in
+	 * the file, it's first in the list.  But first check to see if we
+	 * have an active value from the command line, which should override
+	 * the file in any case.  (Since there's no relevant env var, the
+	 * only possible nondefault sources are the file and ARGV.)
+	 */
+	cvc_struct = (struct config_string *)
+		find_option("custom_variable_classes", false, elevel);
+	if (cvc_struct && cvc_struct->gen.reset_source > PGC_S_FILE)
+	{
+		cvc = guc_strdup(elevel, cvc_struct->reset_val);
+		if (cvc == NULL)
+			goto cleanup_list;
+	}
+	else if (head != NULL &&
+			 guc_name_compare(head->name, "custom_variable_classes") == 0)
+	{
+		/*
+		 * Need to canonicalize the value via the assign hook.  Casting away
+		 * const is a bit ugly, but we know the result is malloc'd.
+		 */
+		cvc = (char *) assign_custom_variable_classes(head->value,
+													  false, PGC_S_FILE);
+		if (cvc == NULL)
+		{
+			ereport(elevel,
+					(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+					 errmsg("invalid value for parameter \"%s\": \"%s\"",
+							head->name, head->value)));
+			goto cleanup_list;
+		}
+	}
+
+	/*
+	 * Mark all extant GUC variables as not present in the config file.
+	 * We need this so that we can tell below which ones have been removed
+	 * from the file since we last processed it.
+	 */
+	for (i = 0; i < num_guc_variables; i++)
+	{
+		struct config_generic *gconf = guc_variables[i];
+
+		gconf->status &= ~GUC_IS_IN_FILE;
+	}
+
+	/*
+	 * Check if all options are valid.  As a side-effect, the GUC_IS_IN_FILE
+	 * flag is set on each GUC variable mentioned in the list.
+	 */
+	for (item = head; item; item = item->next)
+	{
+		char *sep = strchr(item->name, GUC_QUALIFIER_SEPARATOR);
+
+		if (sep)
+		{
+			/*
+			 * We have to consider three cases for custom variables:
+			 *
+			 * 1. The class name is not valid according to the (new) setting
+			 * of custom_variable_classes.  If so, reject.  We don't care
+			 * which side is at fault.
+			 */
+			if (!is_custom_class(item->name, sep - item->name, cvc))
+			{
+				ereport(elevel,
+						(errcode(ERRCODE_UNDEFINED_OBJECT),
+						 errmsg("unrecognized configuration parameter \"%s\"",
+								item->name)));
+				goto cleanup_list;
+			}
+			/*
+			 * 2. There is no GUC entry.  If we called set_config_option then
+			 * it would make a placeholder, which we don't want to do yet,
+			 * since we could still fail further down the list.  Do nothing
+			 * (assuming that making the placeholder will succeed later).
+			 */
+			if (find_option(item->name, false, elevel) == NULL)
+				continue;
+			/*
+			 * 3. There is already a GUC entry (either real or placeholder) for
+			 * the variable.  In this case we should let set_config_option
+			 * check it, since the assignment could well fail if it's a real
+			 * entry.
+			 */
+		}
+
+		if (!set_config_option(item->name, item->value, context,
+							   PGC_S_FILE, GUC_ACTION_SET, false))
+			goto cleanup_list;
+	}
+
+	/*
+	 * Check for variables having been removed from the config file, and
+	 * revert their reset values (and perhaps also effective values) to the
+	 * boot-time defaults.  If such a variable can't be changed after startup,
+	 * just throw a warning and continue.  (This is analogous to the fact that
+	 * set_config_option only throws a warning for a new but different value.
+	 * If we wanted to make it a hard error, we'd need an extra pass over the
+	 * list so that we could throw the error before starting to apply
+	 * changes.)
+	 */
+	for (i = 0; i < num_guc_variables; i++)
+	{
+		struct config_generic *gconf = guc_variables[i];
+		GucStack   *stack;
+
+		if (gconf->reset_source != PGC_S_FILE ||
+			(gconf->status & GUC_IS_IN_FILE))
+			continue;
+		if (gconf->context < PGC_SIGHUP)
+		{
+			ereport(elevel,
+					(errcode(ERRCODE_CANT_CHANGE_RUNTIME_PARAM),
+					 errmsg("parameter \"%s\" cannot be changed without restarting the server",
+							gconf->name)));
+			continue;
+		}
+
+		/*
+		 * Reset any "file" sources to "default", else set_config_option
+		 * will not override those settings.
+		 */
+		if (gconf->reset_source == PGC_S_FILE)
+			gconf->reset_source = PGC_S_DEFAULT;
+		if (gconf->source == PGC_S_FILE)
+			gconf->source = PGC_S_DEFAULT;
+		for (stack = gconf->stack; stack; stack = stack->prev)
+		{
+			if (stack->source == PGC_S_FILE)
+				stack->source = PGC_S_DEFAULT;
+		}
+
+		/* Now we can re-apply the wired-in default */
+		set_config_option(gconf->name, NULL, context, PGC_S_DEFAULT,
+						  GUC_ACTION_SET, true);
+		if (context == PGC_SIGHUP)
+			ereport(elevel,
+					(errmsg("parameter \"%s\" removed from configuration file, reset to default",
+							gconf->name)));
+	}
+
+	/*
+	 * Restore any variables determined by environment variables.  This
+	 * is a no-op except in the case where one of these had been in the
+	 * config file and is now removed.  PGC_S_ENV_VAR will override the
+	 * wired-in default we just applied, but cannot override any other source.
+	 *
+	 * Keep this list in sync with InitializeGUCOptions()!
+	 * PGPORT can be ignored, because it cannot be changed without restart.
+	 * We assume rlimit hasn't changed, either.
+	 */
+	envvar = getenv("PGDATESTYLE");
+	if (envvar != NULL)
+		set_config_option("datestyle", envvar, PGC_POSTMASTER,
+						  PGC_S_ENV_VAR, GUC_ACTION_SET, true);
+
+	envvar = getenv("PGCLIENTENCODING");
+	if (envvar != NULL)
+		set_config_option("client_encoding", envvar, PGC_POSTMASTER,
+						  PGC_S_ENV_VAR, GUC_ACTION_SET, true);
+
+
+	/* If we got here all the options checked out okay, so apply them. */
+	for (item = head; item; item = item->next)
+	{
+		char   *pre_value = NULL;
+
+		/* In SIGHUP cases in the postmaster, report changes */
+		if (context == PGC_SIGHUP && !IsUnderPostmaster)
+		{
+			const char *preval = GetConfigOption(item->name, false);
+
+			/* string variables could be NULL; treat that as empty */
+			if (!preval)
+				preval = "";
+			/* must dup, else might have dangling pointer below */
+			pre_value = pstrdup(preval);
+		}
+
+		if (set_config_option(item->name, item->value, context,
+			   					 PGC_S_FILE, GUC_ACTION_SET, true))
+		{
+			set_config_sourcefile(item->name, item->filename,
+								  item->sourceline);
+
+			if (pre_value)
+			{
+				const char *post_value = GetConfigOption(item->name, false);
+
+				if (!post_value)
+					post_value = "";
+				if (strcmp(pre_value, post_value) != 0)
+					ereport(elevel,
+							(errmsg("parameter \"%s\" changed to \"%s\"",
+									item->name, item->value)));
+			}
+		}
+
+		if (pre_value)
+			pfree(pre_value);
+	}
+
+	/* Remember when we last successfully loaded the config file. */
+	PgReloadTime = GetCurrentTimestamp();
+
+ cleanup_list:
+	free_name_value_list(head);
+	if (cvc)
+		free(cvc);
+}
+
+
+/*
+ * Read and parse a single configuration file.  This function recurses
+ * to handle "include" directives.
+ *
+ * Input parameters:
+ *	config_file: absolute or relative path of file to read
+ *	calling_file: absolute path of file containing the "include" directive,
+ *		or NULL at outer level (config_file must be absolute at outer level)
+ *	depth: recursion depth (used only to prevent infinite recursion)
+ *	context: GucContext passed to ProcessConfigFile()
+ *	elevel: error logging level determined by ProcessConfigFile()
+ * Output parameters:
+ *	head_p, tail_p: head and tail of linked list of name/value pairs
+ *
+ * *head_p and *tail_p must be initialized to NULL before calling the outer
+ * recursion level.  On exit, they contain a list of name-value pairs read
+ * from the input file(s).
+ *
+ * Returns TRUE if successful, FALSE if an error occurred.  The error has
+ * already been ereport'd, it is only necessary for the caller to clean up
+ * its own state and release the name/value pairs list.
+ *
+ * Note: if elevel >= ERROR then an error will not return control to the
+ * caller, and internal state such as open files will not be cleaned up.
+ * This case occurs only during postmaster or standalone-backend startup,
+ * where an error will lead to immediate process exit anyway; so there is
+ * no point in contorting the code so it can clean up nicely.
+ */
+static bool
+ParseConfigFile(const char *config_file, const char *calling_file,
+				int depth, GucContext context, int elevel,
+				struct name_value_pair **head_p,
+				struct name_value_pair **tail_p)
+{
+	bool		OK = true;
+	char		abs_path[MAXPGPATH];
+	FILE	   *fp;
+	YY_BUFFER_STATE lex_buffer;
+	int			token;
+
+	/*
+	 * Reject too-deep include nesting depth.  This is just a safety check
+	 * to avoid dumping core due to stack overflow if an include file loops
+	 * back to itself.  The maximum nesting depth is pretty arbitrary.
+	 */
+	if (depth > 10)
+	{
+		ereport(elevel,
+				(errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+				 errmsg("could not open configuration file \"%s\": maximum nesting depth exceeded",
+						config_file)));
+		return false;
+	}
+
+	/*
+	 * If config_file is a relative path, convert to absolute.  We consider
+	 * it to be relative to the directory holding the calling file.
+	 */
+	if (!is_absolute_path(config_file))
+	{
+		Assert(calling_file != NULL);
+		strlcpy(abs_path, calling_file, sizeof(abs_path));
+		get_parent_directory(abs_path);
+		join_path_components(abs_path, abs_path, config_file);
+		canonicalize_path(abs_path);
+		config_file = abs_path;
+	}
+
+	fp = AllocateFile(config_file, "r");
+	if (!fp)
+	{
+		ereport(elevel,
+				(errcode_for_file_access(),
+				 errmsg("could not open configuration file \"%s\": %m",
+						config_file)));
+		return false;
+	}
+
+	/*
+	 * Parse
+	 */
+	lex_buffer = yy_create_buffer(fp, YY_BUF_SIZE);
+	yy_switch_to_buffer(lex_buffer);
+
+	ConfigFileLineno = 1;
+
+	/* This loop iterates once per logical line */
+	while ((token = yylex()))
+	{
+		char	   *opt_name, *opt_value;
+		struct name_value_pair *item;
+
+		if (token == GUC_EOL)	/* empty or comment line */
+			continue;
+
+		/* first token on line is option name */
+		if (token != GUC_ID && token != GUC_QUALIFIED_ID)
+			goto parse_error;
+		opt_name = pstrdup(yytext);
+
+		/* next we have an optional equal sign; discard if present */
+		token = yylex();
+		if (token == GUC_EQUALS)
+			token = yylex();
+
+		/* now we must have the option value */
+		if (token != GUC_ID &&
+			token != GUC_STRING && 
+			token != GUC_INTEGER && 
+			token != GUC_REAL && 
+			token != GUC_UNQUOTED_STRING)
+			goto parse_error;
+		if (token == GUC_STRING)	/* strip quotes and escapes */
+			opt_value = GUC_scanstr(yytext);
+		else
+			opt_value = pstrdup(yytext);
+
+		/* now we'd like an end of line, or possibly EOF */
+		token = yylex();
+		if (token != GUC_EOL)
+		{
+			if (token != 0)
+				goto parse_error;
+			/* treat EOF like \n for line numbering purposes, cf bug 4752 */
+			ConfigFileLineno++;
+		}
+
+		/* OK, process the option name and value */
+		if (guc_name_compare(opt_name, "include") == 0)
+		{
+			/*
+			 * An include directive isn't a variable and should be processed
+			 * immediately.
+			 */
+			unsigned int save_ConfigFileLineno = ConfigFileLineno;
+
+			if (!ParseConfigFile(opt_value, config_file,
+								 depth + 1, context, elevel,
+								 head_p, tail_p))
+			{
+				pfree(opt_name);
+				pfree(opt_value);
+				OK = false;
+				goto cleanup_exit;
+			}
+			yy_switch_to_buffer(lex_buffer);
+			ConfigFileLineno = save_ConfigFileLineno;
+			pfree(opt_name);
+			pfree(opt_value);
+		}
+		else if (guc_name_compare(opt_name, "custom_variable_classes") == 0)
+		{
+			/*
+			 * This variable must be processed first as it controls
+			 * the validity of other variables; so it goes at the head
+			 * of the result list.  If we already found a value for it,
+			 * replace with this one.
+			 */
+			item = *head_p;
+			if (item != NULL &&
+				guc_name_compare(item->name, "custom_variable_classes") == 0)
+			{
+				/* replace existing head item */
+				pfree(item->name);
+				pfree(item->value);
+				item->name = opt_name;
+				item->value = opt_value;
+				item->filename = pstrdup(config_file);
+				item->sourceline = ConfigFileLineno-1;
+			}
+			else
+			{
+				/* prepend to list */
+				item = palloc(sizeof *item);
+				item->name = opt_name;
+				item->value = opt_value;
+				item->filename = pstrdup(config_file);
+				item->sourceline = ConfigFileLineno-1;
+				item->next = *head_p;
+				*head_p = item;
+				if (*tail_p == NULL)
+					*tail_p = item;
+			}
+		}
+		else
+		{
+			/* ordinary variable, append to list */
+			item = palloc(sizeof *item);
+			item->name = opt_name;
+			item->value = opt_value;
+			item->filename = pstrdup(config_file);
+			item->sourceline = ConfigFileLineno-1;
+			item->next = NULL;
+			if (*head_p == NULL)
+				*head_p = item;
+			else
+				(*tail_p)->next = item;
+			*tail_p = item;
+		}
+
+		/* break out of loop if read EOF, else loop for next line */
+		if (token == 0)
+			break;
+	}
+
+	/* successful completion of parsing */
+	goto cleanup_exit;
+
+ parse_error:
+	if (token == GUC_EOL || token == 0)
+		ereport(elevel,
+				(errcode(ERRCODE_SYNTAX_ERROR),
+				 errmsg("syntax error in file \"%s\" line %u, near end of line",
+						config_file, ConfigFileLineno - 1)));
+	else
+		ereport(elevel,
+				(errcode(ERRCODE_SYNTAX_ERROR),
+				 errmsg("syntax error in file \"%s\" line %u, near token \"%s\"", 
+						config_file, ConfigFileLineno, yytext)));
+	OK = false;
+
+cleanup_exit:
+	yy_delete_buffer(lex_buffer);
+	FreeFile(fp);
+	return OK;
+}
+
+
+/*
+ * Free a list of name/value pairs, including the names and the values
+ */
+static void
+free_name_value_list(struct name_value_pair *list)
+{
+	struct name_value_pair *item;
+
+	item = list;
+	while (item)
+	{
+		struct name_value_pair *next = item->next;
+
+		pfree(item->name);
+		pfree(item->value);
+		pfree(item->filename);
+		pfree(item);
+		item = next;
+	}
+}
+
+
+/*
+ *		scanstr
+ *
+ * Strip the quotes surrounding the given string, and collapse any embedded
+ * '' sequences and backslash escapes.
+ *
+ * the string returned is palloc'd and should eventually be pfree'd by the
+ * caller.
+ */
+static char *
+GUC_scanstr(const char *s)
+{
+	char	   *newStr;
+	int			len,
+				i,
+				j;
+
+	Assert(s != NULL && s[0] == '\'');
+	len = strlen(s);
+	Assert(len >= 2);
+	Assert(s[len-1] == '\'');
+
+	/* Skip the leading quote; we'll handle the trailing quote below */
+	s++, len--;
+
+	/* Since len still includes trailing quote, this is enough space */
+	newStr = palloc(len);
+
+	for (i = 0, j = 0; i < len; i++)
+	{
+		if (s[i] == '\\')
+		{
+			i++;
+			switch (s[i])
+			{
+				case 'b':
+					newStr[j] = '\b';
+					break;
+				case 'f':
+					newStr[j] = '\f';
+					break;
+				case 'n':
+					newStr[j] = '\n';
+					break;
+				case 'r':
+					newStr[j] = '\r';
+					break;
+				case 't':
+					newStr[j] = '\t';
+					break;
+				case '0':
+				case '1':
+				case '2':
+				case '3':
+				case '4':
+				case '5':
+				case '6':
+				case '7':
+					{
+						int			k;
+						long		octVal = 0;
+
+						for (k = 0;
+							 s[i + k] >= '0' && s[i + k] <= '7' && k < 3;
+							 k++)
+							octVal = (octVal << 3) + (s[i + k] - '0');
+						i += k - 1;
+						newStr[j] = ((char) octVal);
+					}
+					break;
+				default:
+					newStr[j] = s[i];
+					break;
+			}					/* switch */
+		}
+		else if (s[i] == '\'' && s[i+1] == '\'')
+		{
+			/* doubled quote becomes just one quote */
+			newStr[j] = s[++i];
+		}
+		else
+			newStr[j] = s[i];
+		j++;
+	}
+
+	/* We copied the ending quote to newStr, so replace with \0 */
+	Assert(j > 0 && j <= len);
+	newStr[--j] = '\0';
+
+	return newStr;
+}
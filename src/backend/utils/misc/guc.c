@@ -62,12 +62,14 @@
 #include "tsearch/ts_cache.h"
 #include "utils/builtins.h"
 #include "utils/bytea.h"
+#include "utils/catcache.h"
 #include "utils/guc_tables.h"
 #include "utils/memutils.h"
 #include "utils/pg_locale.h"
 #include "utils/plancache.h"
 #include "utils/portal.h"
 #include "utils/ps_status.h"
+#include "utils/relcache.h"
 #include "utils/tzparser.h"
 #include "utils/xml.h"
 
@@ -611,6 +613,14 @@ static struct config_bool ConfigureNamesBool[] =
 		&enable_indexscan,
 		true, NULL, NULL
 	},
+	{
+		{"enable_indexonlyscan", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Enables the planner's use of index-only-scan plans."),
+			NULL
+		},
+		&enable_indexonlyscan,
+		true, NULL, NULL
+	},
 	{
 		{"enable_bitmapscan", PGC_USERSET, QUERY_TUNING_METHOD,
 			gettext_noop("Enables the planner's use of bitmap-scan plans."),
@@ -635,6 +645,22 @@ static struct config_bool ConfigureNamesBool[] =
 		&enable_sort,
 		true, NULL, NULL
 	},
+	{
+		{"enable_incrementalsort", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Enables the planner's use of incremental sort steps."),
+			NULL
+		},
+		&enable_incrementalsort,
+		true, NULL, NULL
+	},
+	{
+		{"enable_memoize", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Enables the planner's use of caching for parameterized nested-loop inner scans."),
+			NULL
+		},
+		&enable_memoize,
+		true, NULL, NULL
+	},
 	{
 		{"enable_hashagg", PGC_USERSET, QUERY_TUNING_METHOD,
 			gettext_noop("Enables the planner's use of hashed aggregation plans."),
@@ -1223,6 +1249,15 @@ static struct config_bool ConfigureNamesBool[] =
 		true, NULL, NULL
 	},
 
+	{
+		{"catalog_cache_init_file", PGC_POSTMASTER, RESOURCES_MEM,
+			gettext_noop("Saves system catalog cache contents for use by new sessions."),
+			NULL
+		},
+		&catalog_cache_init_file,
+		false, NULL, NULL
+	},
+
 	{
 		{"allow_system_table_mods", PGC_POSTMASTER, DEVELOPER_OPTIONS,
 			gettext_noop("Allows modifications of the structure of system tables."),
@@ -1458,6 +1493,27 @@ static struct config_int ConfigureNamesInt[] =
 		16384, 1024, MAX_KILOBYTES, NULL, NULL
 	},
 
+	{
+		{"catalog_cache_max_size", PGC_USERSET, RESOURCES_MEM,
+			gettext_noop("Sets the maximum memory to be used by each system catalog cache."),
+			gettext_noop("Least recently used entries are discarded to stay "
+						 "within this limit. Zero means no limit."),
+			GUC_UNIT_KB
+		},
+		&catalog_cache_max_size,
+		0, 0, MAX_KILOBYTES, NULL, NULL
+	},
+
+	{
+		{"relation_cache_max_entries", PGC_USERSET, RESOURCES_MEM,
+			gettext_noop("Sets the maximum number of entries kept in the relation cache."),
+			gettext_noop("Entries not used recently are discarded at transaction "
+						 "end to stay within this limit. Zero means no limit.")
+		},
+		&relation_cache_max_entries,
+		0, 0, INT_MAX, NULL, NULL
+	},
+
 	{
 		{"max_stack_depth", PGC_SUSET, RESOURCES_MEM,
 			gettext_noop("Sets the maximum stack depth, in kilobytes."),
@@ -86,6 +86,14 @@
  */
 #define BLOCKS_PER_INDIR_BLOCK	((int) (BLCKSZ / sizeof(long)))
 
+/*
+ * While reading a tape, we ask the kernel to read ahead this many data
+ * blocks of it.  Since the blocks of a tape are scattered around the file
+ * once space gets recycled, the kernel's own sequential read-ahead can't
+ * guess them.
+ */
+#define LTS_PREFETCH_BLOCKS		8
+
 /*
  * We use a struct like this for each active indirection level of each
  * logical tape.  If the indirect block is not the highest level of its
@@ -191,6 +199,8 @@ static long ltsRecallNextBlockNum(LogicalTapeSet *lts,
 static long ltsRecallPrevBlockNum(LogicalTapeSet *lts,
 					  IndirectBlock *indirect);
 static void ltsDumpBuffer(LogicalTapeSet *lts, LogicalTape *lt);
+static void ltsPrefetchAhead(LogicalTapeSet *lts, LogicalTape *lt,
+				 bool initial);
 
 
 /*
@@ -233,6 +243,38 @@ ltsReadBlock(LogicalTapeSet *lts, long blocknum, void *buffer)
 						blocknum)));
 }
 
+/*
+ * Issue read-ahead hints for the data blocks following the one just read.
+ *
+ * We only look at the block numbers remaining in the bottom-level indirect
+ * block; when the read crosses into the next indirect block, read-ahead
+ * lapses for a few blocks, which is not worth more code to avoid.  When
+ * "initial" is true we hint all of the next LTS_PREFETCH_BLOCKS blocks;
+ * otherwise the ones before were hinted already, and only the furthest
+ * needs to be.
+ */
+static void
+ltsPrefetchAhead(LogicalTapeSet *lts, LogicalTape *lt, bool initial)
+{
+	IndirectBlock *indirect = lt->indirect;
+	int			last;
+	int			i;
+
+	if (indirect == NULL)
+		return;
+
+	last = indirect->nextSlot + LTS_PREFETCH_BLOCKS - 1;
+	for (i = indirect->nextSlot;
+		 i <= last && i < BLOCKS_PER_INDIR_BLOCK;
+		 i++)
+	{
+		if (indirect->ptrs[i] == -1L)
+			break;				/* end of tape */
+		if (initial || i == last)
+			BufFilePrefetchBlock(lts->pfile, indirect->ptrs[i]);
+	}
+}
+
 /*
  * qsort comparator for sorting freeBlocks[] into decreasing order.
  */
@@ -722,6 +764,7 @@ LogicalTapeRewind(LogicalTapeSet *lts, int tapenum, bool forWrite)
 		lt->nbytes = 0;
 		if (datablocknum != -1L)
 		{
+			ltsPrefetchAhead(lts, lt, true);
 			ltsReadBlock(lts, datablocknum, (void *) lt->buffer);
 			if (!lt->frozen)
 				ltsReleaseBlock(lts, datablocknum);
@@ -793,6 +836,7 @@ LogicalTapeRead(LogicalTapeSet *lts, int tapenum,
 				break;			/* EOF */
 			lt->curBlockNumber++;
 			lt->pos = 0;
+			ltsPrefetchAhead(lts, lt, false);
 			ltsReadBlock(lts, datablocknum, (void *) lt->buffer);
 			if (!lt->frozen)
 				ltsReleaseBlock(lts, datablocknum);
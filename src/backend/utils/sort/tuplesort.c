@@ -99,18 +99,24 @@
 #include "postgres.h"
 
 #include <limits.h>
+#include <math.h>
 
 #include "access/genam.h"
+#include "access/hash.h"
 #include "access/nbtree.h"
 #include "catalog/pg_amop.h"
 #include "catalog/pg_operator.h"
+#include "catalog/pg_proc.h"
 #include "commands/tablespace.h"
 #include "miscadmin.h"
 #include "pg_trace.h"
+#include "utils/builtins.h"
 #include "utils/datum.h"
+#include "utils/fmgroids.h"
 #include "utils/logtape.h"
 #include "utils/lsyscache.h"
 #include "utils/memutils.h"
+#include "utils/pg_locale.h"
 #include "utils/pg_rusage.h"
 #include "utils/rel.h"
 #include "utils/syscache.h"
@@ -151,6 +157,16 @@ bool		optimize_bounded_sort = true;
  * then datum1 points to a separately palloc'd data value that is also pointed
  * to by the "tuple" pointer; otherwise "tuple" is NULL.
  *
+ * For an in-memory sort of heap or index tuples whose first key column has
+ * a known abbreviation function, tuplesort_performsort replaces each datum1
+ * with an "abbreviated key" just before the qsort: a pass-by-value Datum
+ * that, compared as an unsigned integer, orders the same way as the full
+ * comparator whenever two abbreviated keys differ.  Most comparisons are
+ * then settled without calling the comparator or touching the tuple; only
+ * on a tie do we fetch the first column from the tuple and compare fully.
+ * After the sort datum1 is left abbreviated, which is fine since nothing
+ * looks at datum1 of heap or index tuples once they are sorted.
+ *
  * While building initial runs, tupindex holds the tuple's run number.  During
  * merge passes, we re-use it to hold the input tape number that each tuple in
  * the heap was read from, or to hold the index of the next tuple pre-read
@@ -166,6 +182,11 @@ typedef struct
 } SortTuple;
 
 
+/*
+ * Converts a value of the leading sort column to its abbreviated key.
+ */
+typedef Datum (*SortAbbrevFunc) (Datum original);
+
 /*
  * Possible states of a Tuplesort object.  These denote the states that
  * persist between calls of Tuplesort routines.
@@ -191,6 +212,31 @@ typedef enum
  * MERGE_BUFFER_SIZE is how much data we'd like to read from each input
  * tape during a preread cycle (see discussion at top of file).
  */
+/*
+ * Parameters for deciding whether abbreviated keys are worth keeping.  We
+ * estimate the number of distinct abbreviated keys by linear counting over
+ * a small bitmap; if they are much less distinct than the tuples, most
+ * comparisons would fall through to the full comparator anyway, so we put
+ * the original datums back.
+ */
+#define ABBREV_BITMAP_BITS		16384
+#define ABBREV_MIN_TUPLES		1000
+#define ABBREV_MIN_DISTINCT_FRACTION	0.05
+
+/*
+ * In-memory sorts on a single integer-like key are done by radix sort rather
+ * than by qsort: see radix_sort_memtuples.  radixKind identifies how to turn
+ * the key datum into an unsigned integer with the same ordering.
+ */
+#define RADIX_NONE		0
+#define RADIX_INT2		1
+#define RADIX_INT4		2
+#define RADIX_INT8		3
+#define RADIX_OID		4
+
+#define RADIX_MIN_TUPLES		1024	/* use qsort for fewer tuples */
+#define RADIX_SMALL_BUCKET		32		/* insertion-sort buckets this small */
+
 #define MINORDER		6		/* minimum merge order */
 #define TAPE_BUFFER_OVERHEAD		(BLCKSZ * 3)
 #define MERGE_BUFFER_SIZE			(BLCKSZ * 32)
@@ -226,6 +272,23 @@ struct Tuplesortstate
 	int			(*comparetup) (const SortTuple *a, const SortTuple *b,
 										   Tuplesortstate *state);
 
+	/*
+	 * Function to convert a value of the first key column into an abbreviated
+	 * key, or NULL if there is none for its type; and whether memtuples[]
+	 * currently hold abbreviated keys in datum1.  Only heap and btree index
+	 * sorts use these.
+	 */
+	SortAbbrevFunc abbrevFunc;
+	bool		abbrevActive;
+
+	/*
+	 * If the sort has a single key of a type we can radix sort, radixKind
+	 * says how to extract its bits (RADIX_xxx), and radixBytes how many
+	 * significant bytes the extracted key has.
+	 */
+	int			radixKind;
+	int			radixBytes;
+
 	/*
 	 * Function to copy a supplied input tuple into palloc'd space and set up
 	 * its SortTuple representation (ie, set tuple/datum1/isnull1).  Also,
@@ -367,10 +430,15 @@ struct Tuplesortstate
 	bool		datumTypeByVal;
 
 	/*
-	 * Resource snapshot for time of sort start.
+	 * Resource snapshots for time of sort start, and of the start of the
+	 * current phase (loading, run formation, merging, output).  We also
+	 * remember whether any tuple was fetched, so that an output phase is
+	 * only reported if there was one.
 	 */
 #ifdef TRACE_SORT
 	PGRUsage	ru_start;
+	PGRUsage	ru_phase;
+	bool		fetched;
 #endif
 };
 
@@ -470,6 +538,15 @@ static void readtup_datum(Tuplesortstate *state, SortTuple *stup,
 			  int tapenum, unsigned int len);
 static void reversedirection_datum(Tuplesortstate *state);
 static void free_sort_tuple(Tuplesortstate *state, SortTuple *stup);
+#ifdef TRACE_SORT
+static void trace_sort_phase(Tuplesortstate *state, const char *phase);
+#endif
+static SortAbbrevFunc select_abbrev_func(Oid sortFunction);
+static void select_radix_kind(Tuplesortstate *state, Oid sortFunction);
+static void radix_sort_memtuples(Tuplesortstate *state);
+static void abbreviate_memtuples(Tuplesortstate *state);
+static Datum fetch_first_key(Tuplesortstate *state, const SortTuple *stup,
+				bool *isnull);
 
 
 /*
@@ -518,7 +595,10 @@ tuplesort_begin_common(int workMem, bool randomAccess)
 
 #ifdef TRACE_SORT
 	if (trace_sort)
+	{
 		pg_rusage_init(&state->ru_start);
+		state->ru_phase = state->ru_start;
+	}
 #endif
 
 	state->status = TSS_INITIAL;
@@ -622,6 +702,10 @@ tuplesort_begin_heap(TupleDesc tupDesc,
 			state->scanKeys[i].sk_flags |= SK_BT_NULLS_FIRST;
 	}
 
+	state->abbrevFunc = select_abbrev_func(state->scanKeys[0].sk_func.fn_oid);
+	if (nkeys == 1)
+		select_radix_kind(state, state->scanKeys[0].sk_func.fn_oid);
+
 	MemoryContextSwitchTo(oldcontext);
 
 	return state;
@@ -662,6 +746,11 @@ tuplesort_begin_index_btree(Relation indexRel,
 	state->indexRel = indexRel;
 	state->indexScanKey = _bt_mkscankey_nodata(indexRel);
 	state->enforceUnique = enforceUnique;
+	state->abbrevFunc =
+		select_abbrev_func(state->indexScanKey[0].sk_func.fn_oid);
+	/* uniqueness is checked by the comparator, so we need that */
+	if (state->nKeys == 1 && !enforceUnique)
+		select_radix_kind(state, state->indexScanKey[0].sk_func.fn_oid);
 
 	MemoryContextSwitchTo(oldcontext);
 
@@ -746,6 +835,7 @@ tuplesort_begin_datum(Oid datumType,
 		elog(ERROR, "operator %u is not a valid ordering operator",
 			 sortOperator);
 	fmgr_info(sortFunction, &state->sortOpFn);
+	select_radix_kind(state, sortFunction);
 
 	/* set ordering flags */
 	state->sortFnFlags = reverse ? SK_BT_DESC : 0;
@@ -830,6 +920,8 @@ tuplesort_end(Tuplesortstate *state)
 		LogicalTapeSetClose(state->tapeset);
 
 #ifdef TRACE_SORT
+	if (state->fetched)
+		trace_sort_phase(state, "output");
 	if (trace_sort)
 	{
 		if (state->tapeset)
@@ -1115,6 +1207,7 @@ tuplesort_performsort(Tuplesortstate *state)
 	if (trace_sort)
 		elog(LOG, "performsort starting: %s",
 			 pg_rusage_show(&state->ru_start));
+	trace_sort_phase(state, "input");
 #endif
 
 	switch (state->status)
@@ -1125,12 +1218,28 @@ tuplesort_performsort(Tuplesortstate *state)
 			 * We were able to accumulate all the tuples within the allowed
 			 * amount of memory.  Just qsort 'em and we're done.
 			 */
-			if (state->memtupcount > 1)
-				qsort_arg((void *) state->memtuples,
-						  state->memtupcount,
-						  sizeof(SortTuple),
-						  (qsort_arg_comparator) state->comparetup,
-						  (void *) state);
+			if (state->radixKind != RADIX_NONE &&
+				state->memtupcount >= RADIX_MIN_TUPLES)
+			{
+				radix_sort_memtuples(state);
+#ifdef TRACE_SORT
+				trace_sort_phase(state, "radix sort");
+#endif
+			}
+			else
+			{
+				if (state->abbrevFunc != NULL && state->memtupcount > 1)
+					abbreviate_memtuples(state);
+				if (state->memtupcount > 1)
+					qsort_arg((void *) state->memtuples,
+							  state->memtupcount,
+							  sizeof(SortTuple),
+							  (qsort_arg_comparator) state->comparetup,
+							  (void *) state);
+#ifdef TRACE_SORT
+				trace_sort_phase(state, "quicksort");
+#endif
+			}
 			state->current = 0;
 			state->eof_reached = false;
 			state->markpos_offset = 0;
@@ -1146,6 +1255,9 @@ tuplesort_performsort(Tuplesortstate *state)
 			 * have to transform the heap to a properly-sorted array.
 			 */
 			sort_bounded_heap(state);
+#ifdef TRACE_SORT
+			trace_sort_phase(state, "bounded heapsort");
+#endif
 			state->current = 0;
 			state->eof_reached = false;
 			state->markpos_offset = 0;
@@ -1162,7 +1274,13 @@ tuplesort_performsort(Tuplesortstate *state)
 			 * mergeruns sets the correct state->status.
 			 */
 			dumptuples(state, true);
+#ifdef TRACE_SORT
+			trace_sort_phase(state, "run formation");
+#endif
 			mergeruns(state);
+#ifdef TRACE_SORT
+			trace_sort_phase(state, "merge");
+#endif
 			state->eof_reached = false;
 			state->markpos_block = 0L;
 			state->markpos_offset = 0;
@@ -1201,6 +1319,10 @@ tuplesort_gettuple_common(Tuplesortstate *state, bool forward,
 {
 	unsigned int tuplen;
 
+#ifdef TRACE_SORT
+	state->fetched = true;
+#endif
+
 	switch (state->status)
 	{
 		case TSS_SORTEDINMEM:
@@ -2553,6 +2675,50 @@ inlineApplySortFunction(FmgrInfo *sortFunction, int sk_flags,
 	return compare;
 }
 
+/*
+ * Compare two abbreviated keys, with the same handling of reverse-sort and
+ * NULLs-ordering as inlineApplySortFunction.  Note that a result of zero
+ * for two non-null keys does not mean the original values are equal.
+ */
+static inline int32
+inlineApplyAbbrevCompare(int sk_flags,
+						 Datum datum1, bool isNull1,
+						 Datum datum2, bool isNull2)
+{
+	int32		compare;
+
+	if (isNull1)
+	{
+		if (isNull2)
+			compare = 0;		/* NULL "=" NULL */
+		else if (sk_flags & SK_BT_NULLS_FIRST)
+			compare = -1;		/* NULL "<" NOT_NULL */
+		else
+			compare = 1;		/* NULL ">" NOT_NULL */
+	}
+	else if (isNull2)
+	{
+		if (sk_flags & SK_BT_NULLS_FIRST)
+			compare = 1;		/* NOT_NULL ">" NULL */
+		else
+			compare = -1;		/* NOT_NULL "<" NULL */
+	}
+	else
+	{
+		if (datum1 < datum2)
+			compare = -1;
+		else if (datum1 > datum2)
+			compare = 1;
+		else
+			compare = 0;
+
+		if (sk_flags & SK_BT_DESC)
+			compare = -compare;
+	}
+
+	return compare;
+}
+
 /*
  * Non-inline ApplySortFunction() --- this is needed only to conform to
  * C99's brain-dead notions about how to implement inline functions...
@@ -2567,6 +2733,402 @@ ApplySortFunction(FmgrInfo *sortFunction, int sortFlags,
 								   datum2, isNull2);
 }
 
+#ifdef TRACE_SORT
+/*
+ * Report the resources used by the sort phase just completed, and start
+ * measuring the next one.
+ */
+static void
+trace_sort_phase(Tuplesortstate *state, const char *phase)
+{
+	if (!trace_sort)
+		return;
+	elog(LOG, "%s phase done: %s", phase, pg_rusage_show(&state->ru_phase));
+	pg_rusage_init(&state->ru_phase);
+}
+#endif
+
+/*
+ * Choose the abbreviated-key conversion for a sort function, if any.
+ */
+static SortAbbrevFunc
+select_abbrev_func(Oid sortFunction)
+{
+	switch (sortFunction)
+	{
+		case F_BTTEXTCMP:
+#if !defined(TRUST_STRXFRM) || defined(WIN32)
+			/* we can only trust memcmp order, see bttext_abbrev */
+			if (!lc_collate_is_c())
+				return NULL;
+#endif
+			return bttext_abbrev;
+		case F_NUMERIC_CMP:
+			return numeric_abbrev;
+		case F_UUID_CMP:
+			return uuid_abbrev;
+		default:
+			return NULL;
+	}
+}
+
+/*
+ * Decide whether a single-key sort using the given sort function can be
+ * done by radix sort, and if so set state->radixKind and radixBytes.
+ * The comparators listed here must order exactly as signed (or for OID,
+ * unsigned) comparison of the underlying integer does.
+ */
+static void
+select_radix_kind(Tuplesortstate *state, Oid sortFunction)
+{
+	switch (sortFunction)
+	{
+		case F_BTINT2CMP:
+			state->radixKind = RADIX_INT2;
+			state->radixBytes = 2;
+			break;
+		case F_BTINT4CMP:
+		case F_DATE_CMP:
+			state->radixKind = RADIX_INT4;
+			state->radixBytes = 4;
+			break;
+		case F_BTINT8CMP:
+#ifdef HAVE_INT64_TIMESTAMP
+		/*
+		 * fmgroids.h has only one F_TIMESTAMP_CMP, and it names 1314, which
+		 * is timestamptz_cmp; timestamp's own timestamp_cmp is 2045.
+		 */
+		case F_TIMESTAMP_CMP:
+		case TIMESTAMP_CMP_OID:
+#endif
+			state->radixKind = RADIX_INT8;
+			state->radixBytes = 8;
+			break;
+		case F_BTOIDCMP:
+			state->radixKind = RADIX_OID;
+			state->radixBytes = 4;
+			break;
+		default:
+			state->radixKind = RADIX_NONE;
+			break;
+	}
+}
+
+/*
+ * Map a non-null key datum to an unsigned integer that sorts the same way,
+ * taking account of DESC (via "flip", which is all-ones in the significant
+ * bytes for a descending sort, else zero).
+ */
+static inline uint64
+radix_key(int kind, Datum datum, uint64 flip)
+{
+	uint64		key;
+
+	switch (kind)
+	{
+		case RADIX_INT2:
+			key = (uint16) DatumGetInt16(datum) ^ (uint16) 0x8000;
+			break;
+		case RADIX_INT4:
+			key = (uint32) DatumGetInt32(datum) ^ (uint32) 0x80000000;
+			break;
+		case RADIX_INT8:
+			key = (uint64) DatumGetInt64(datum) ^
+				UINT64CONST(0x8000000000000000);
+			break;
+		case RADIX_OID:
+			key = DatumGetObjectId(datum);
+			break;
+		default:
+			elog(ERROR, "unrecognized radix sort kind: %d", kind);
+			key = 0;			/* keep compiler quiet */
+			break;
+	}
+
+	return key ^ flip;
+}
+
+/*
+ * Insertion sort for small buckets, by full key.
+ */
+static void
+radix_insertion_sort(SortTuple *tuples, int n, int kind, uint64 flip)
+{
+	int			i;
+
+	for (i = 1; i < n; i++)
+	{
+		SortTuple	tmp = tuples[i];
+		uint64		key = radix_key(kind, tmp.datum1, flip);
+		int			j = i;
+
+		while (j > 0 && radix_key(kind, tuples[j - 1].datum1, flip) > key)
+		{
+			tuples[j] = tuples[j - 1];
+			j--;
+		}
+		tuples[j] = tmp;
+	}
+}
+
+/*
+ * In-place MSD radix sort ("American flag sort") of non-null tuples,
+ * on byte number "byte" of the key and, recursively, the bytes below it.
+ */
+static void
+radix_sort_range(SortTuple *tuples, int n, int byte, int kind, uint64 flip)
+{
+	int			count[256];
+	int			next[256];
+	int			end[256];
+	int			shift;
+	int			pos;
+	int			d;
+
+	CHECK_FOR_INTERRUPTS();
+
+	/* Histogram the current byte, skipping bytes that are all alike */
+	for (;;)
+	{
+		int			i;
+
+		shift = byte * 8;
+		memset(count, 0, sizeof(count));
+		for (i = 0; i < n; i++)
+			count[(radix_key(kind, tuples[i].datum1, flip) >> shift) & 0xFF]++;
+
+		for (d = 0; d < 256; d++)
+			if (count[d] != 0)
+				break;
+		if (count[d] != n)
+			break;
+		if (byte == 0)
+			return;				/* all keys are equal */
+		byte--;
+	}
+
+	pos = 0;
+	for (d = 0; d < 256; d++)
+	{
+		next[d] = pos;
+		pos += count[d];
+		end[d] = pos;
+	}
+
+	/* Permute each tuple straight into its bucket */
+	for (d = 0; d < 256; d++)
+	{
+		while (next[d] < end[d])
+		{
+			SortTuple  *cur = &tuples[next[d]];
+			int			dd;
+
+			dd = (radix_key(kind, cur->datum1, flip) >> shift) & 0xFF;
+			if (dd == d)
+				next[d]++;
+			else
+			{
+				SortTuple	tmp = *cur;
+
+				*cur = tuples[next[dd]];
+				tuples[next[dd]] = tmp;
+				next[dd]++;
+			}
+		}
+	}
+
+	if (byte == 0)
+		return;
+
+	/* Sort each bucket on the remaining bytes */
+	for (d = 0; d < 256; d++)
+	{
+		SortTuple  *bucket = tuples + end[d] - count[d];
+
+		if (count[d] > RADIX_SMALL_BUCKET)
+			radix_sort_range(bucket, count[d], byte - 1, kind, flip);
+		else if (count[d] > 1)
+			radix_insertion_sort(bucket, count[d], kind, flip);
+	}
+}
+
+/*
+ * qsort comparator putting index tuples with equal keys into heap order.
+ */
+static int
+radix_compare_tid(const void *a, const void *b)
+{
+	return ItemPointerCompare(&((IndexTuple) ((const SortTuple *) a)->tuple)->t_tid,
+							  &((IndexTuple) ((const SortTuple *) b)->tuple)->t_tid);
+}
+
+/*
+ * Sort memtuples[] by radix sort.  This is used in place of qsort for large
+ * in-memory sorts on a single key for which select_radix_kind found a
+ * suitable kind: there are no fmgr calls at all, and the number of passes
+ * over the data is bounded by the key width rather than log(N).
+ */
+static void
+radix_sort_memtuples(Tuplesortstate *state)
+{
+	SortTuple  *tuples = state->memtuples;
+	int			n = state->memtupcount;
+	int			sk_flags;
+	bool		nullsfirst;
+	uint64		flip;
+	int			nfront;
+	int			i;
+
+	if (state->indexRel != NULL)
+		sk_flags = state->indexScanKey[0].sk_flags;
+	else if (state->scanKeys != NULL)
+		sk_flags = state->scanKeys[0].sk_flags;
+	else
+		sk_flags = state->sortFnFlags;
+
+	nullsfirst = (sk_flags & SK_BT_NULLS_FIRST) != 0;
+	if (sk_flags & SK_BT_DESC)
+		flip = (state->radixBytes == 8) ? ~UINT64CONST(0) :
+			((UINT64CONST(1) << (state->radixBytes * 8)) - 1);
+	else
+		flip = 0;
+
+	/* Move whichever of the nulls and non-nulls go first to the front */
+	nfront = 0;
+	for (i = 0; i < n; i++)
+	{
+		if (tuples[i].isnull1 == nullsfirst)
+		{
+			SortTuple	tmp = tuples[i];
+
+			tuples[i] = tuples[nfront];
+			tuples[nfront] = tmp;
+			nfront++;
+		}
+	}
+
+	if (nullsfirst)
+		radix_sort_range(tuples + nfront, n - nfront,
+						 state->radixBytes - 1, state->radixKind, flip);
+	else
+		radix_sort_range(tuples, nfront,
+						 state->radixBytes - 1, state->radixKind, flip);
+
+	/*
+	 * comparetup_index_btree puts equal keys in heap order, which makes later
+	 * index scans over duplicates read the heap sequentially.  Do the same.
+	 */
+	if (state->indexRel != NULL)
+	{
+		int			start = 0;
+
+		for (i = 1; i <= n; i++)
+		{
+			if (i < n &&
+				tuples[i].isnull1 == tuples[start].isnull1 &&
+				(tuples[i].isnull1 ||
+				 radix_key(state->radixKind, tuples[i].datum1, 0) ==
+				 radix_key(state->radixKind, tuples[start].datum1, 0)))
+				continue;
+			if (i - start > 1)
+				qsort(tuples + start, i - start, sizeof(SortTuple),
+					  radix_compare_tid);
+			start = i;
+		}
+	}
+}
+
+/*
+ * Fetch the original value of the leading sort column of a heap or btree
+ * index tuple, for use once datum1 has been abbreviated.
+ */
+static Datum
+fetch_first_key(Tuplesortstate *state, const SortTuple *stup, bool *isnull)
+{
+	if (state->indexRel != NULL)
+		return index_getattr((IndexTuple) stup->tuple, 1,
+							 RelationGetDescr(state->indexRel), isnull);
+	else
+	{
+		HeapTupleData tup;
+
+		tup.t_len = ((MinimalTuple) stup->tuple)->t_len + MINIMAL_TUPLE_OFFSET;
+		tup.t_data = (HeapTupleHeader) ((char *) stup->tuple -
+										MINIMAL_TUPLE_OFFSET);
+		return heap_getattr(&tup, state->scanKeys[0].sk_attno,
+							state->tupDesc, isnull);
+	}
+}
+
+/*
+ * Replace the leading key of all in-memory tuples by its abbreviated key,
+ * in preparation for an in-memory qsort.  If the abbreviated keys turn out
+ * to be too poorly distinct to be useful, put the original values back.
+ */
+static void
+abbreviate_memtuples(Tuplesortstate *state)
+{
+	uint32		seen[ABBREV_BITMAP_BITS / 32];
+	int			nnotnull = 0;
+	int			nbitsset = 0;
+	int			i;
+
+	memset(seen, 0, sizeof(seen));
+
+	for (i = 0; i < state->memtupcount; i++)
+	{
+		SortTuple  *stup = &state->memtuples[i];
+		Datum		abbrev;
+		uint32		bit;
+
+		if (stup->isnull1)
+			continue;
+
+		abbrev = state->abbrevFunc(stup->datum1);
+		stup->datum1 = abbrev;
+		nnotnull++;
+
+		bit = DatumGetUInt32(hash_any((unsigned char *) &abbrev,
+									  sizeof(Datum))) % ABBREV_BITMAP_BITS;
+		if ((seen[bit / 32] & (1U << (bit % 32))) == 0)
+		{
+			seen[bit / 32] |= 1U << (bit % 32);
+			nbitsset++;
+		}
+	}
+	state->abbrevActive = true;
+
+	/*
+	 * Estimate the number of distinct abbreviated keys by linear counting.
+	 * A saturated bitmap means there are plenty.
+	 */
+	if (nnotnull >= ABBREV_MIN_TUPLES && nbitsset < ABBREV_BITMAP_BITS)
+	{
+		double		ndistinct;
+
+		ndistinct = -ABBREV_BITMAP_BITS *
+			log((double) (ABBREV_BITMAP_BITS - nbitsset) / ABBREV_BITMAP_BITS);
+
+		if (ndistinct < nnotnull * ABBREV_MIN_DISTINCT_FRACTION)
+		{
+#ifdef TRACE_SORT
+			if (trace_sort)
+				elog(LOG, "abandoning abbreviated keys: about %.0f distinct among %d: %s",
+					 ndistinct, nnotnull, pg_rusage_show(&state->ru_start));
+#endif
+			for (i = 0; i < state->memtupcount; i++)
+			{
+				SortTuple  *stup = &state->memtuples[i];
+
+				if (!stup->isnull1)
+					stup->datum1 = fetch_first_key(state, stup,
+												   &stup->isnull1);
+			}
+			state->abbrevActive = false;
+		}
+	}
+}
+
 
 /*
  * Routines specialized for HeapTuple (actually MinimalTuple) case
@@ -2586,12 +3148,36 @@ comparetup_heap(const SortTuple *a, const SortTuple *b, Tuplesortstate *state)
 	CHECK_FOR_INTERRUPTS();
 
 	/* Compare the leading sort key */
-	compare = inlineApplySortFunction(&scanKey->sk_func, scanKey->sk_flags,
-									  a->datum1, a->isnull1,
-									  b->datum1, b->isnull1);
+	if (state->abbrevActive)
+		compare = inlineApplyAbbrevCompare(scanKey->sk_flags,
+										   a->datum1, a->isnull1,
+										   b->datum1, b->isnull1);
+	else
+		compare = inlineApplySortFunction(&scanKey->sk_func,
+										  scanKey->sk_flags,
+										  a->datum1, a->isnull1,
+										  b->datum1, b->isnull1);
 	if (compare != 0)
 		return compare;
 
+	/* Equal abbreviated keys prove nothing; compare the full values */
+	if (state->abbrevActive && !a->isnull1)
+	{
+		Datum		datum1,
+					datum2;
+		bool		isnull1,
+					isnull2;
+
+		datum1 = fetch_first_key(state, a, &isnull1);
+		datum2 = fetch_first_key(state, b, &isnull2);
+		compare = inlineApplySortFunction(&scanKey->sk_func,
+										  scanKey->sk_flags,
+										  datum1, isnull1,
+										  datum2, isnull2);
+		if (compare != 0)
+			return compare;
+	}
+
 	/* Compare additional sort keys */
 	ltup.t_len = ((MinimalTuple) a->tuple)->t_len + MINIMAL_TUPLE_OFFSET;
 	ltup.t_data = (HeapTupleHeader) ((char *) a->tuple - MINIMAL_TUPLE_OFFSET);
@@ -2743,12 +3329,36 @@ comparetup_index_btree(const SortTuple *a, const SortTuple *b,
 	CHECK_FOR_INTERRUPTS();
 
 	/* Compare the leading sort key */
-	compare = inlineApplySortFunction(&scanKey->sk_func, scanKey->sk_flags,
-									  a->datum1, a->isnull1,
-									  b->datum1, b->isnull1);
+	if (state->abbrevActive)
+		compare = inlineApplyAbbrevCompare(scanKey->sk_flags,
+										   a->datum1, a->isnull1,
+										   b->datum1, b->isnull1);
+	else
+		compare = inlineApplySortFunction(&scanKey->sk_func,
+										  scanKey->sk_flags,
+										  a->datum1, a->isnull1,
+										  b->datum1, b->isnull1);
 	if (compare != 0)
 		return compare;
 
+	/* Equal abbreviated keys prove nothing; compare the full values */
+	if (state->abbrevActive && !a->isnull1)
+	{
+		Datum		datum1,
+					datum2;
+		bool		isnull1,
+					isnull2;
+
+		datum1 = fetch_first_key(state, a, &isnull1);
+		datum2 = fetch_first_key(state, b, &isnull2);
+		compare = inlineApplySortFunction(&scanKey->sk_func,
+										  scanKey->sk_flags,
+										  datum1, isnull1,
+										  datum2, isnull2);
+		if (compare != 0)
+			return compare;
+	}
+
 	/* they are equal, so we only need to examine one null flag */
 	if (a->isnull1)
 		equal_hasnull = true;
@@ -1279,29 +1279,27 @@ XidInMVCCSnapshot(TransactionId xid, Snapshot snapshot)
 	 */
 	if (!snapshot->takenDuringRecovery)
 	{
+		int32		j;
+
 		/*
-		 * If the snapshot contains full subxact data, the fastest way to
-		 * check things is just to compare the given XID against both subxact
-		 * XIDs and top-level XIDs.  If the snapshot overflowed, we have to
-		 * use pg_subtrans to convert a subxact XID to its parent XID, but
-		 * then we need only look at top-level XIDs not subxacts.
+		 * The fastest way to check things is just to compare the given XID
+		 * against both subxact XIDs and top-level XIDs.  subxip[] holds the
+		 * subxacts of every backend whose cache did not overflow, so that
+		 * settles the question unless the XID could be a subxact of a backend
+		 * that did.  Those all follow suboverflowxmin; for such an XID we
+		 * have to use pg_subtrans to convert it to its parent XID, and then
+		 * look for that among the top-level XIDs.
 		 */
-		if (!snapshot->suboverflowed)
+		for (j = 0; j < snapshot->subxcnt; j++)
 		{
-			/* full data, so search subxip */
-			int32		j;
-
-			for (j = 0; j < snapshot->subxcnt; j++)
-			{
-				if (TransactionIdEquals(xid, snapshot->subxip[j]))
-					return true;
-			}
-
-			/* not there, fall through to search xip[] */
+			if (TransactionIdEquals(xid, snapshot->subxip[j]))
+				return true;
 		}
-		else
+
+		if (snapshot->suboverflowed &&
+			TransactionIdFollowsOrEquals(xid, snapshot->suboverflowxmin))
 		{
-			/* overflowed, so convert xid to top-level */
+			/* possibly a missing subxact, so convert xid to top-level */
 			xid = SubTransGetTopmostTransaction(xid);
 
 			/*
@@ -0,0 +1,2669 @@
+/* A lexical scanner generated by pyflex */
+#define FLEX_SCANNER
+#define YY_FLEX_MAJOR_VERSION 2
+#define YY_FLEX_MINOR_VERSION 5
+#define YY_FLEX_SUBMINOR_VERSION 35
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <stdlib.h>
+#ifndef YY_TYPEDEF_YY_SIZE_T
+#define YY_TYPEDEF_YY_SIZE_T
+typedef size_t yy_size_t;
+#endif
+#define yyconst const
+#define YY_NULL 0
+#define YY_END_OF_BUFFER_CHAR 0
+#ifndef YY_BUF_SIZE
+#define YY_BUF_SIZE 16384
+#endif
+#ifndef YY_TYPEDEF_YY_BUFFER_STATE
+#define YY_TYPEDEF_YY_BUFFER_STATE
+typedef struct yy_buffer_state *YY_BUFFER_STATE;
+#endif
+struct yy_buffer_state
+{
+	FILE *yy_input_file;
+	char *yy_ch_buf;
+	yy_size_t yy_buf_size;
+	int yy_n_chars;
+	int yy_pos;
+	int yy_filled;
+	int yy_is_our_buffer;
+};
+void yyrestart(FILE *input_file);
+void yy_switch_to_buffer(YY_BUFFER_STATE new_buffer);
+YY_BUFFER_STATE yy_create_buffer(FILE *file, int size);
+void yy_delete_buffer(YY_BUFFER_STATE b);
+void yy_flush_buffer(YY_BUFFER_STATE b);
+YY_BUFFER_STATE yy_scan_buffer(char *base, yy_size_t size);
+YY_BUFFER_STATE yy_scan_string(yyconst char *yy_str);
+YY_BUFFER_STATE yy_scan_bytes(yyconst char *bytes, int len);
+void *yyalloc(yy_size_t);
+void *yyrealloc(void *, yy_size_t);
+void yyfree(void *);
+int yylex_destroy(void);
+extern int yyleng;
+extern FILE *yyin, *yyout;
+extern char *yytext;
+extern int yylineno;
+
+/* user code from definitions section */
+/*-------------------------------------------------------------------------
+ *
+ * psqlscan.l
+ *	  lexical scanner for psql
+ *
+ * This code is mainly needed to determine where the end of a SQL statement
+ * is: we are looking for semicolons that are not within quotes, comments,
+ * or parentheses.  The most reliable way to handle this is to borrow the
+ * backend's flex lexer rules, lock, stock, and barrel.  The rules below
+ * are (except for a few) the same as the backend's, but their actions are
+ * just ECHO whereas the backend's actions generally do other things.
+ *
+ * XXX The rules in this file must be kept in sync with the backend lexer!!!
+ *
+ * XXX Avoid creating backtracking cases --- see the backend lexer for info.
+ *
+ * The most difficult aspect of this code is that we need to work in multibyte
+ * encodings that are not ASCII-safe.  A "safe" encoding is one in which each
+ * byte of a multibyte character has the high bit set (it's >= 0x80).  Since
+ * all our lexing rules treat all high-bit-set characters alike, we don't
+ * really need to care whether such a byte is part of a sequence or not.
+ * In an "unsafe" encoding, we still expect the first byte of a multibyte
+ * sequence to be >= 0x80, but later bytes might not be.  If we scan such
+ * a sequence as-is, the lexing rules could easily be fooled into matching
+ * such bytes to ordinary ASCII characters.  Our solution for this is to
+ * substitute 0xFF for each non-first byte within the data presented to flex.
+ * The flex rules will then pass the FF's through unmolested.  The emit()
+ * subroutine is responsible for looking back to the original string and
+ * replacing FF's with the corresponding original bytes.
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *	  $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres_fe.h"
+
+#include "psqlscan.h"
+
+#include <ctype.h>
+
+#include "common.h"
+#include "settings.h"
+#include "variables.h"
+
+
+/*
+ * We use a stack of flex buffers to handle substitution of psql variables.
+ * Each stacked buffer contains the as-yet-unread text from one psql variable.
+ * When we pop the stack all the way, we resume reading from the outer buffer
+ * identified by scanbufhandle.
+ */
+typedef struct StackElem
+{
+	YY_BUFFER_STATE buf;		/* flex input control structure */
+	char	   *bufstring;		/* data actually being scanned by flex */
+	char	   *origstring;		/* copy of original data, if needed */
+	struct StackElem *next;
+} StackElem;
+
+/*
+ * All working state of the lexer must be stored in PsqlScanStateData
+ * between calls.  This allows us to have multiple open lexer operations,
+ * which is needed for nested include files.  The lexer itself is not
+ * recursive, but it must be re-entrant.
+ */
+typedef struct PsqlScanStateData
+{
+	StackElem  *buffer_stack;	/* stack of variable expansion buffers */
+	/*
+	 * These variables always refer to the outer buffer, never to any
+	 * stacked variable-expansion buffer.
+	 */
+	YY_BUFFER_STATE scanbufhandle;
+	char	   *scanbuf;		/* start of outer-level input buffer */
+	const char *scanline;		/* current input line at outer level */
+
+	/* safe_encoding, curline, refline are used by emit() to replace FFs */
+	int			encoding;		/* encoding being used now */
+	bool		safe_encoding;	/* is current encoding "safe"? */
+	const char *curline;		/* actual flex input string for cur buf */
+	const char *refline;		/* original data for cur buffer */
+
+	/*
+	 * All this state lives across successive input lines, until explicitly
+	 * reset by psql_scan_reset.
+	 */
+	int			start_state;	/* saved YY_START */
+	int			paren_depth;	/* depth of nesting in parentheses */
+	int			xcdepth;		/* depth of nesting in slash-star comments */
+	char	   *dolqstart;		/* current $foo$ quote start string */
+} PsqlScanStateData;
+
+static PsqlScanState cur_state;	/* current state while active */
+
+static PQExpBuffer output_buf;	/* current output buffer */
+
+/* these variables do not need to be saved across calls */
+static enum slash_option_type option_type;
+static char *option_quote;
+
+
+/* Return values from yylex() */
+#define LEXRES_EOL			0	/* end of input */
+#define LEXRES_SEMI			1	/* command-terminating semicolon found */
+#define LEXRES_BACKSLASH	2	/* backslash command start */
+#define LEXRES_OK			3	/* OK completion of backslash argument */
+
+
+int	yylex(void);
+
+static void push_new_buffer(const char *newstr);
+static YY_BUFFER_STATE prepare_buffer(const char *txt, int len,
+									  char **txtcopy);
+static void emit(const char *txt, int len);
+static bool is_utf16_surrogate_first(uint32 c);
+static void escape_variable(bool as_ident);
+
+#define ECHO emit(yytext, yyleng)
+
+
+/* start conditions */
+#define INITIAL 0
+#define xb 1
+#define xc 2
+#define xd 3
+#define xh 4
+#define xe 5
+#define xq 6
+#define xdolq 7
+#define xui 8
+#define xus 9
+#define xeu 10
+#define xslashcmd 11
+#define xslasharg 12
+#define xslashquote 13
+#define xslashbackquote 14
+#define xslashdefaultarg 15
+#define xslashquotedarg 16
+#define xslashwholeline 17
+#define xslashend 18
+#ifndef YY_EXTRA_TYPE
+#define YY_EXTRA_TYPE void *
+#endif
+#define YYG(x) (x)
+int yyleng;
+FILE *yyin = NULL, *yyout = NULL;
+char *yytext;
+int yylineno = 1;
+static YY_BUFFER_STATE yy_current_buffer = NULL;
+static char yy_hold_char;
+static char *yy_hold_ptr = NULL;
+static int yy_init = 0;
+static int yy_start = 0;
+#define YY_CURRENT_BUFFER (YYG(yy_current_buffer))
+#define YY_CURRENT_BUFFER_LVALUE YYG(yy_current_buffer)
+#define BEGIN YYG(yy_start) = 
+#define YY_START (YYG(yy_start))
+#define YYSTATE YY_START
+#define yyterminate() return YY_NULL
+#ifndef ECHO
+#define ECHO do { if (fwrite(yytext, yyleng, 1, yyout)) {} } while (0)
+#endif
+#ifndef YY_USER_ACTION
+#define YY_USER_ACTION
+#endif
+#ifndef YY_BREAK
+#define YY_BREAK break;
+#endif
+#define YY_RULE_SETUP YY_USER_ACTION
+#define YY_FATAL_ERROR(msg) yy_fatal_error(msg)
+static void yy_fatal_error(yyconst char *msg);
+static void yy_fill_buffer(YY_BUFFER_STATE b);
+#undef yyless
+#define yyless(n) \
+	do { \
+		int yyless_macro_arg = (n); \
+		if (YYG(yy_hold_ptr)) *YYG(yy_hold_ptr) = YYG(yy_hold_char); \
+		YYG(yy_hold_ptr) = yytext + yyless_macro_arg; \
+		YYG(yy_hold_char) = *YYG(yy_hold_ptr); \
+		*YYG(yy_hold_ptr) = '\0'; \
+		yyleng = yyless_macro_arg; \
+		YY_CURRENT_BUFFER->yy_pos = (int) (YYG(yy_hold_ptr) - YY_CURRENT_BUFFER->yy_ch_buf); \
+	} while (0)
+#ifndef YY_DECL
+#define YY_DECL_IS_OURS 1
+extern int yylex(void);
+#define YY_DECL int yylex(void)
+#endif
+static yyconst unsigned char yy_ec[256] = {44,44,44,44,44,44,44,44,44,0,1,44,0,2,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,0,34,36,34,35,25,14,6,23,24,4,21,27,3,26,5,28,28,28,28,28,28,28,28,29,29,20,19,25,22,25,34,34,18,33,37,41,11,41,42,42,42,42,42,42,42,10,42,16,42,42,15,42,13,42,42,8,42,42,27,17,27,25,42,30,18,32,37,41,11,40,42,42,42,42,42,42,42,9,42,16,42,39,15,38,12,42,42,7,42,42,44,31,44,34,44,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43};
+static yyconst short yy_nxt[502][45] = {
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{20,21,20,22,23,24,25,26,26,27,27,28,29,29,30,31,31,32,31,33,34,23,23,35,36,23,37,38,39,39,30,30,40,40,30,41,42,31,31,31,31,31,31,31,43},
+{44,44,44,44,44,44,45,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44},
+{46,46,46,47,48,49,46,46,46,46,46,46,46,46,47,46,46,46,46,46,46,47,47,46,46,47,46,46,46,46,47,47,46,46,47,46,46,46,46,46,46,46,46,46,46},
+{50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,51,50,50,50,50,50,50,50,50},
+{52,52,52,52,52,52,53,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52},
+{54,55,54,54,54,54,56,54,54,54,54,54,54,54,54,54,54,57,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54},
+{58,58,58,58,58,58,59,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58},
+{60,61,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,62,60,60,60,60,60,60,60,60,60},
+{50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,63,50,50,50,50,50,50,50,50},
+{58,58,58,58,58,58,64,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58},
+{65,66,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,67,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65},
+{68,69,68,70,70,70,70,70,70,70,70,70,70,70,70,70,70,71,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70},
+{72,73,72,74,74,74,75,74,74,74,74,74,74,74,74,74,74,76,74,74,77,74,74,74,74,74,74,74,74,74,78,79,74,74,74,74,80,74,74,74,74,74,74,74,74},
+{81,82,81,81,81,81,83,81,81,81,81,81,81,81,81,81,81,84,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81},
+{85,86,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,87,85,85,85,85,85,85,85,85,85,85,85,85,85,85},
+{88,89,88,90,90,90,90,90,90,90,90,90,90,90,90,90,90,91,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,92,90,90,90,90,90,90,90,90},
+{93,94,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,95,93,93,93,93,93,93,93,93},
+{96,97,96,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98},
+{99,100,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,101,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99},
+{102,102,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{102,102,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,103,104,104,0,0,0,0,0,0,0,0,104,0,0,0,0,0,0,104,104,0,0,104,0,0,0,0,104,104,0,0,104,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,104,104,104,0,0,0,0,0,0,0,0,104,0,0,0,0,0,0,104,104,0,0,104,0,0,0,0,104,104,0,0,104,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,104,105,104,0,0,0,0,0,0,0,0,104,0,0,0,0,0,0,104,104,0,0,104,0,0,0,0,104,104,0,0,104,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,106,107,107,107,107,107,107,107,0,107,107,0,107,0,0,0,0,0,0,0,0,0,107,107,0,0,107,107,0,107,0,107,107,107,107,107,107,107,0},
+{0,0,0,0,0,0,108,107,107,107,107,107,107,107,0,107,107,0,107,0,0,0,0,0,0,0,0,0,107,107,0,0,107,107,0,107,0,107,107,107,107,107,107,107,0},
+{0,0,0,0,0,0,109,107,107,107,107,107,107,107,0,107,107,0,107,0,0,0,0,0,0,0,0,0,107,107,0,0,107,107,0,107,0,107,107,107,107,107,107,107,0},
+{0,0,0,0,0,0,0,107,107,107,107,107,107,107,110,107,107,0,107,0,0,0,0,0,0,0,0,0,107,107,0,0,107,107,0,107,0,107,107,107,107,107,107,107,0},
+{0,0,0,104,104,104,0,0,0,0,0,0,0,0,104,0,0,0,0,0,0,104,104,0,0,104,0,0,0,0,104,104,0,0,104,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,107,107,107,107,107,107,107,0,107,107,0,107,0,0,0,0,0,0,0,0,0,107,107,0,0,107,107,0,107,0,107,107,107,107,107,107,107,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,111,111,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,112,113,113,113,113,113,113,113,0,113,113,0,113,0,114,0,115,0,0,0,0,0,113,113,0,0,113,113,0,0,116,113,113,113,113,113,113,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,117,0,118,118,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,119,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,0,121,121,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,122,107,107,107,107,107,107,107,0,107,107,0,107,0,0,0,0,0,0,0,0,0,107,107,0,0,107,107,0,107,0,107,107,107,107,107,107,107,0},
+{0,0,0,0,0,0,0,123,123,123,123,123,123,123,0,123,123,0,123,0,0,0,0,0,0,0,0,0,124,124,0,0,123,123,0,125,0,123,123,123,123,123,123,123,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{44,44,44,44,44,44,0,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44},
+{126,127,127,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{129,129,129,129,0,0,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129},
+{129,129,129,129,0,0,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129},
+{0,0,0,0,130,131,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,132,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,0,133,133,133,133,133,133,133,133},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,134,0,0,0,0,0,0,0,0},
+{52,52,52,52,52,52,0,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52},
+{135,136,136,137,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{138,138,138,138,138,138,0,138,138,138,138,138,138,138,138,138,138,0,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138},
+{138,138,138,138,138,138,0,138,138,138,138,138,138,138,138,138,138,0,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138},
+{139,140,140,141,0,0,142,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{143,143,143,143,143,143,143,144,143,143,143,143,145,146,143,143,143,143,143,143,143,143,143,143,143,143,143,143,147,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143},
+{148,148,148,148,148,148,0,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148},
+{139,140,140,141,0,0,142,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,0,149,149,149,149,149,149,149,149,149},
+{149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,0,149,149,149,149,149,149,149,149,149},
+{0,0,0,0,0,0,0,150,150,150,150,150,150,150,0,150,150,0,150,0,0,0,0,0,0,0,0,0,0,0,0,0,150,150,0,151,0,150,150,150,150,150,150,150,0},
+{152,152,152,153,0,0,0,0,0,0,0,0,154,154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,134,0,0,0,0,0,0,0,0},
+{155,156,156,157,0,0,142,0,0,0,0,0,158,158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,159,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{161,161,161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{161,161,161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,162,163,163,163,163,163,163,163,0,163,163,0,163,0,0,0,0,0,0,0,0,0,163,163,0,0,163,163,0,0,164,163,163,163,163,163,163,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,165,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{166,0,166,166,166,166,166,167,166,168,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,169,166,166,166,170,166,166,166,166,166,171,172,173,166,166,166,166},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{174,174,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{174,174,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,175,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{102,102,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{176,0,0,177,177,177,176,176,176,176,176,176,176,176,177,176,176,176,176,176,176,177,177,176,176,177,176,176,176,176,177,177,176,176,177,176,176,176,176,176,176,176,176,176,176},
+{0,0,0,104,104,104,0,0,0,0,0,0,0,0,104,0,0,0,0,0,0,104,104,0,0,104,0,0,0,0,104,104,0,0,104,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,178,178,178,0,0,0,0,0,0,0,0,178,0,0,0,0,0,0,178,178,0,0,178,0,0,0,0,178,178,0,0,178,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,107,107,107,107,107,107,107,0,107,107,0,107,0,0,0,0,0,0,0,0,0,107,107,0,0,107,107,0,107,0,107,107,107,107,107,107,107,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,179,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,181,181,181,181,181,181,181,0,181,181,0,181,0,0,0,0,0,0,0,0,0,181,181,0,0,181,181,0,0,0,181,181,181,181,181,181,0,0},
+{0,0,0,0,0,0,0,182,182,182,182,182,182,182,0,182,182,0,182,0,0,0,0,0,0,0,0,0,182,182,0,0,182,182,0,0,0,182,182,182,182,182,182,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,183,183,183,183,183,183,183,0,183,183,0,183,0,0,0,0,0,0,0,0,0,183,183,0,0,183,183,0,0,0,183,183,183,183,183,183,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,119,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,184,184,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,185,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,185,0,0,0,0,0,0,186,186,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,119,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,0,188,188,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,119,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,0,121,121,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,189,189,189,189,189,189,189,0,189,189,0,189,0,0,0,0,0,0,0,0,0,189,189,0,0,189,189,0,125,0,189,189,189,189,189,189,189,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,190,190,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{191,192,192,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{193,193,193,194,0,0,195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{129,129,129,129,0,0,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129},
+{0,0,0,0,130,131,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,197,197,197,0,0,0,0,0,0,0,0,197,0,0,0,0,0,0,197,197,0,0,197,0,0,0,0,197,197,0,0,197,0,0,0,0,0,0,0,0,0,0},
+{133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,0,133,133,133,133,133,133,133,133},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{198,199,199,137,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{200,200,200,201,0,0,202,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,203,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{138,138,138,138,138,138,0,138,138,138,138,138,138,138,138,138,138,0,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138,138},
+{204,205,205,141,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{206,206,206,207,0,0,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,209,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,210,0,0,0,0,0,0,210,0,0,0,0,0,0,0,0,0,210,210,0,0,210,210,0,0,0,210,0,0,210,210,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,211,0,0,0,0,0,0,211,0,0,0,0,0,0,0,0,0,211,211,0,0,211,211,0,0,0,211,0,0,211,211,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,212,0,0,0,0,0,0,212,0,0,0,0,0,0,0,0,0,212,212,0,0,212,212,0,0,0,212,0,0,212,212,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,213,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{148,148,148,148,148,148,0,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148},
+{149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,0,149,149,149,149,149,149,149,149,149},
+{0,0,0,0,0,0,0,214,214,214,214,214,214,214,0,214,214,0,214,0,0,0,0,0,0,0,0,0,214,214,0,0,214,214,0,151,0,214,214,214,214,214,214,214,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{215,215,215,153,0,0,0,0,0,0,0,0,154,154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,217,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{218,219,219,157,0,0,0,0,0,0,0,0,158,158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{220,220,220,221,0,0,208,0,0,0,0,0,158,158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,223,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,224,0,0,0,0,0,0,224,0,0,0,0,0,0,0,0,0,224,224,0,0,224,224,0,0,0,224,0,0,224,224,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,225,0,0,0,0,0,0,225,0,0,0,0,0,0,0,0,0,225,225,0,0,225,225,0,0,0,225,0,0,225,225,0,0,0},
+{161,161,161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,226,226,226,226,226,226,226,0,226,226,0,226,0,0,0,0,0,0,0,0,0,226,226,0,0,226,226,0,0,0,226,226,226,226,226,226,0,0},
+{0,0,0,0,0,0,0,163,163,163,163,163,163,163,0,163,163,0,163,0,0,0,0,0,0,0,0,0,163,163,0,0,163,163,0,0,0,163,163,163,163,163,163,0,0},
+{0,0,0,0,0,0,0,227,227,227,227,227,227,227,0,227,227,0,227,0,0,0,0,0,0,0,0,0,227,227,0,0,227,227,0,0,0,227,227,227,227,227,227,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,228,0,0,0,0,0,0,228,0,0,0,0,0,0,0,0,0,228,228,0,0,228,228,0,0,0,228,0,0,228,228,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,229,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{174,174,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{176,0,0,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176},
+{176,0,0,177,177,177,176,176,176,176,176,176,176,176,177,176,176,176,176,176,176,177,177,176,176,177,176,176,176,176,177,177,176,176,177,176,176,176,176,176,176,176,176,176,176},
+{0,0,0,178,178,178,0,0,0,0,0,0,0,0,178,0,0,0,0,0,0,178,178,0,0,178,0,0,0,0,178,178,0,0,178,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,230,231,231,231,231,231,231,231,0,231,231,0,231,0,0,0,0,0,0,0,0,0,231,231,0,0,231,231,0,0,0,231,231,231,231,231,231,0,0},
+{0,0,0,0,0,0,0,182,182,182,182,182,182,182,0,182,182,0,182,0,0,0,0,0,0,0,0,0,182,182,0,0,182,182,0,0,0,182,182,182,182,182,182,0,0},
+{0,0,0,0,0,0,0,232,232,232,232,232,232,232,0,232,232,0,232,0,0,0,0,0,0,0,0,0,232,232,0,0,232,232,0,0,233,232,232,232,232,232,232,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,119,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,184,184,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,186,186,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,234,234,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,119,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,235,235,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,189,189,189,189,189,189,189,0,189,189,0,189,0,0,0,0,0,0,0,0,0,189,189,0,0,189,189,0,125,0,189,189,189,189,189,189,189,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,190,190,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{191,192,192,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{193,193,193,194,0,0,195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{236,236,236,194,0,0,195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,237,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{238,127,127,239,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240},
+{0,0,0,197,197,197,0,0,0,0,0,0,0,0,197,0,0,0,0,0,0,197,197,0,0,197,0,0,0,0,197,197,0,0,197,0,0,0,0,0,0,0,0,0,0},
+{198,199,199,137,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{200,200,200,201,0,0,202,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{241,241,241,201,0,0,202,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,242,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{243,136,136,244,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245},
+{204,205,205,141,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{206,206,206,207,0,0,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{246,246,246,207,0,0,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,247,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{248,140,140,249,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250},
+{0,0,0,0,0,0,0,0,0,0,0,251,0,0,0,0,0,0,251,0,0,0,0,0,0,0,0,0,251,251,0,0,251,251,0,0,0,251,0,0,251,251,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,252,0,0,0,0,0,0,252,0,0,0,0,0,0,0,0,0,252,252,0,0,252,252,0,0,0,252,0,0,252,252,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,253,0,0,0,0,0,0,253,0,0,0,0,0,0,0,0,0,253,253,0,0,253,253,0,0,0,253,0,0,253,253,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,214,214,214,214,214,214,214,0,214,214,0,214,0,0,0,0,0,0,0,0,0,214,214,0,0,214,214,0,151,0,214,214,214,214,214,214,214,0},
+{215,215,215,153,0,0,0,0,0,0,0,0,154,154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{255,152,152,256,257,257,257,257,257,257,257,257,258,258,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,259,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{218,219,219,157,0,0,0,0,0,0,0,0,158,158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{220,220,220,221,0,0,208,0,0,0,0,0,158,158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{260,260,260,221,0,0,208,0,0,0,0,0,158,158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,261,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{262,156,156,263,264,264,264,264,264,264,264,264,265,265,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,266,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,267,0,0,0,0,0,0,267,0,0,0,0,0,0,0,0,0,267,267,0,0,267,267,0,0,0,267,0,0,267,267,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,268,0,0,0,0,0,0,268,0,0,0,0,0,0,0,0,0,268,268,0,0,268,268,0,0,0,268,0,0,268,268,0,0,0},
+{0,0,0,0,0,0,269,270,270,270,270,270,270,270,0,270,270,0,270,0,0,0,0,0,0,0,0,0,270,270,0,0,270,270,0,0,0,270,270,270,270,270,270,0,0},
+{0,0,0,0,0,0,0,271,271,271,271,271,271,271,0,271,271,0,271,0,0,0,0,0,0,0,0,0,271,271,0,0,271,271,0,0,272,271,271,271,271,271,271,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,273,0,0,0,0,0,0,273,0,0,0,0,0,0,0,0,0,273,273,0,0,273,273,0,0,0,273,0,0,273,273,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,274,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,230,231,231,231,231,231,231,231,0,231,231,0,231,0,0,0,0,0,0,0,0,0,231,231,0,0,231,231,0,0,0,231,231,231,231,231,231,0,0},
+{0,0,0,0,0,0,0,232,232,232,232,232,232,232,0,232,232,0,232,0,0,0,0,0,0,0,0,0,232,232,0,0,232,232,0,0,233,232,232,232,232,232,232,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,234,234,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,119,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,235,235,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{236,236,236,194,0,0,195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{275,276,276,277,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278},
+{279,192,192,239,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240},
+{238,127,127,280,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240},
+{238,127,127,239,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240},
+{241,241,241,201,0,0,202,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{281,282,282,283,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284},
+{285,199,199,244,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245},
+{243,136,136,286,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245},
+{243,136,136,244,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245},
+{246,246,246,207,0,0,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{287,288,288,289,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290},
+{291,205,205,249,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250},
+{248,140,140,292,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250},
+{248,140,140,249,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,293,0,0,0,0,0,0,293,0,0,0,0,0,0,0,0,0,293,293,0,0,293,293,0,0,0,293,0,0,293,293,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,294,0,0,0,0,0,0,294,0,0,0,0,0,0,0,0,0,294,294,0,0,294,294,0,0,0,294,0,0,294,294,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{295,215,215,256,257,257,257,257,257,257,257,257,258,258,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257},
+{255,152,152,296,257,257,257,257,257,257,257,257,258,258,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257},
+{255,152,152,256,257,257,257,257,257,257,257,257,258,258,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257},
+{255,152,152,256,257,257,257,257,257,257,257,297,258,258,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,298,0,0,0,0,0,0,0},
+{260,260,260,221,0,0,208,0,0,0,0,0,158,158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{299,300,300,301,302,302,302,302,302,302,302,302,303,303,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302},
+{304,219,219,263,264,264,264,264,264,264,264,264,265,265,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264},
+{262,156,156,305,264,264,264,264,264,264,264,264,265,265,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264},
+{262,156,156,263,264,264,264,264,264,264,264,264,265,265,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264},
+{262,156,156,263,264,264,264,264,264,264,264,306,265,265,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,307,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,308,0,0,0,0,0,0,308,0,0,0,0,0,0,0,0,0,308,308,0,0,308,308,0,0,0,308,0,0,308,308,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,309,0,0,0,0,0,0,309,0,0,0,0,0,0,0,0,0,309,309,0,0,309,309,0,0,0,309,0,0,309,309,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,269,270,270,270,270,270,270,270,0,270,270,0,270,0,0,0,0,0,0,0,0,0,270,270,0,0,270,270,0,0,0,270,270,270,270,270,270,0,0},
+{0,0,0,0,0,0,0,271,271,271,271,271,271,271,0,271,271,0,271,0,0,0,0,0,0,0,0,0,271,271,0,0,271,271,0,0,272,271,271,271,271,271,271,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{310,311,311,277,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278},
+{193,193,193,194,0,0,195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{275,276,276,312,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278},
+{275,276,276,277,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278},
+{279,192,192,239,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240},
+{238,127,127,280,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240},
+{313,314,314,283,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284},
+{200,200,200,201,0,0,202,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{281,282,282,315,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284},
+{281,282,282,283,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284},
+{285,199,199,244,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245},
+{243,136,136,286,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245},
+{316,317,317,289,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290},
+{206,206,206,207,0,0,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{287,288,288,318,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290},
+{287,288,288,289,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290},
+{291,205,205,249,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250},
+{248,140,140,292,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250},
+{0,0,0,0,0,0,0,0,0,0,0,319,0,0,0,0,0,0,319,0,0,0,0,0,0,0,0,0,319,319,0,0,319,319,0,0,0,319,0,0,319,319,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,320,0,0,0,0,0,0,320,0,0,0,0,0,0,0,0,0,320,320,0,0,320,320,0,0,0,320,0,0,320,320,0,0,0},
+{295,215,215,256,257,257,257,257,257,257,257,257,258,258,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257},
+{255,152,152,296,257,257,257,257,257,257,257,257,258,258,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257},
+{255,152,152,256,257,257,257,257,257,257,257,257,258,258,257,321,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,322,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{323,324,324,301,302,302,302,302,302,302,302,302,303,303,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302},
+{220,220,220,221,0,0,208,0,0,0,0,0,158,158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{299,300,300,325,302,302,302,302,302,302,302,302,303,303,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302},
+{299,300,300,301,302,302,302,302,302,302,302,302,303,303,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302},
+{299,300,300,301,302,302,302,302,302,302,302,326,303,303,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302},
+{304,219,219,263,264,264,264,264,264,264,264,264,265,265,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264},
+{262,156,156,305,264,264,264,264,264,264,264,264,265,265,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264},
+{262,156,156,263,264,264,264,264,264,264,264,264,265,265,264,327,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,328,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,329,0,0,0,0,0,0,329,0,0,0,0,0,0,0,0,0,329,329,0,0,329,329,0,0,0,329,0,0,329,329,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,330,0,0,0,0,0,0,330,0,0,0,0,0,0,0,0,0,330,330,0,0,330,330,0,0,0,330,0,0,330,330,0,0,0},
+{310,311,311,277,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278},
+{193,193,193,194,0,0,195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{275,276,276,312,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278},
+{313,314,314,283,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284},
+{200,200,200,201,0,0,202,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{281,282,282,315,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284,284},
+{316,317,317,289,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290},
+{206,206,206,207,0,0,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{287,288,288,318,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290,290},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,331,0,0,0,0,0,0,331,0,0,0,0,0,0,0,0,0,331,331,0,0,331,331,0,0,0,331,0,0,331,331,0,0,0},
+{255,152,152,256,257,257,257,257,257,257,257,257,258,258,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,332,257,257,257,257,257,257,257},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{323,324,324,301,302,302,302,302,302,302,302,302,303,303,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302},
+{220,220,220,221,0,0,208,0,0,0,0,0,158,158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{299,300,300,325,302,302,302,302,302,302,302,302,303,303,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302},
+{299,300,300,301,302,302,302,302,302,302,302,302,303,303,302,334,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302},
+{262,156,156,263,264,264,264,264,264,264,264,264,265,265,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,335,264,264,264,264,264,264,264},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,336,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,337,0,0,0,0,0,0,337,0,0,0,0,0,0,0,0,0,337,337,0,0,337,337,0,0,0,337,0,0,337,337,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,338,0,0,0,0,0,0,338,0,0,0,0,0,0,0,0,0,338,338,0,0,338,338,0,0,0,338,0,0,338,338,0,0,0},
+{255,152,152,256,257,257,257,257,257,257,257,257,258,258,257,257,257,257,339,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257},
+{0,0,0,0,0,0,0,0,0,0,0,340,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{299,300,300,301,302,302,302,302,302,302,302,302,303,303,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,341,302,302,302,302,302,302,302},
+{262,156,156,263,264,264,264,264,264,264,264,264,265,265,264,264,264,264,342,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264},
+{0,0,0,0,0,0,0,0,0,0,0,343,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,344,0,0,0,0,0,0,344,0,0,0,0,0,0,0,0,0,344,344,0,0,344,344,0,0,0,344,0,0,344,344,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,345,0,0,0,0,0,0,345,0,0,0,0,0,0,0,0,0,345,345,0,0,345,345,0,0,0,345,0,0,345,345,0,0,0},
+{255,152,152,256,257,257,257,257,257,257,257,257,258,258,257,257,346,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257},
+{347,347,347,348,0,0,349,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{299,300,300,301,302,302,302,302,302,302,302,302,303,303,302,302,302,302,350,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302},
+{262,156,156,263,264,264,264,264,264,264,264,264,265,265,264,264,351,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264},
+{352,352,352,353,0,0,354,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,355,0,0,0,0,0,0,355,0,0,0,0,0,0,0,0,0,355,355,0,0,355,355,0,0,0,355,0,0,355,355,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,356,0,0,0,0,0,0,356,0,0,0,0,0,0,0,0,0,356,356,0,0,356,356,0,0,0,356,0,0,356,356,0,0,0},
+{255,152,152,256,257,257,257,257,257,257,257,357,258,258,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257},
+{358,358,358,348,0,0,349,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,359,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{360,360,360,360,360,360,0,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360},
+{299,300,300,301,302,302,302,302,302,302,302,302,303,303,302,302,361,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302},
+{262,156,156,263,264,264,264,264,264,264,264,362,265,265,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264},
+{363,363,363,353,0,0,354,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,364,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{365,365,365,365,365,365,0,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365},
+{0,0,0,0,0,0,0,0,0,0,0,366,0,0,0,0,0,0,366,0,0,0,0,0,0,0,0,0,366,366,0,0,366,366,0,0,0,366,0,0,366,366,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{367,368,368,369,257,257,370,257,257,257,257,257,258,258,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257},
+{358,358,358,348,0,0,349,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{371,347,347,372,373,373,374,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373},
+{0,0,0,0,0,0,375,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{299,300,300,301,302,302,302,302,302,302,302,376,303,303,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302},
+{377,378,378,379,264,264,380,264,264,264,264,264,265,265,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264},
+{363,363,363,353,0,0,354,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{381,352,352,382,383,383,384,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383},
+{0,0,0,0,0,0,385,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{386,387,387,369,257,257,370,257,257,257,257,257,258,258,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257},
+{387,387,387,388,0,0,349,0,0,0,0,0,154,154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{255,152,152,389,257,257,257,257,257,257,257,257,258,258,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257},
+{390,391,391,392,393,393,257,393,393,393,393,393,394,394,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393,393},
+{395,358,358,372,373,373,374,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373},
+{371,347,347,396,373,373,374,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373},
+{371,347,347,372,373,373,374,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373},
+{397,398,398,399,400,400,374,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{401,402,402,403,302,302,404,302,302,302,302,302,303,303,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302},
+{405,406,406,379,264,264,380,264,264,264,264,264,265,265,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264},
+{407,407,407,408,0,0,409,0,0,0,0,0,158,158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{262,156,156,410,264,264,264,264,264,264,264,264,265,265,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264},
+{411,412,412,413,414,414,264,414,414,414,414,414,415,415,414,414,414,414,414,414,414,414,414,414,414,414,414,414,414,414,414,414,414,414,414,414,414,414,414,414,414,414,414,414,414},
+{416,363,363,382,383,383,384,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383},
+{381,352,352,417,383,383,384,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383},
+{381,352,352,382,383,383,384,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383},
+{418,419,419,420,421,421,384,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{386,387,387,369,257,257,370,257,257,257,257,257,258,258,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257},
+{387,387,387,388,0,0,349,0,0,0,0,0,154,154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,422,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{423,368,368,424,425,425,426,425,425,425,425,425,427,427,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425},
+{295,215,215,256,257,257,428,257,257,257,257,257,258,258,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257},
+{215,215,215,153,0,0,375,0,0,0,0,0,154,154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{255,152,152,296,257,257,428,257,257,257,257,257,258,258,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257},
+{255,152,152,256,257,257,428,257,257,257,257,257,258,258,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257},
+{255,152,152,256,257,257,428,257,257,257,257,297,258,258,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257},
+{395,358,358,372,373,373,374,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373},
+{371,347,347,396,373,373,374,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373},
+{395,358,358,372,373,373,429,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373},
+{358,358,358,348,0,0,430,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{371,347,347,396,373,373,429,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373},
+{371,347,347,372,373,373,429,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373,373},
+{431,432,432,403,302,302,404,302,302,302,302,302,303,303,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302},
+{407,407,407,408,0,0,409,0,0,0,0,0,158,158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{299,300,300,433,302,302,302,302,302,302,302,302,303,303,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302},
+{434,435,435,436,437,437,302,437,437,437,437,437,438,438,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437},
+{405,406,406,379,264,264,380,264,264,264,264,264,265,265,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264},
+{407,407,407,408,0,0,409,0,0,0,0,0,158,158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{439,439,439,408,0,0,409,0,0,0,0,0,158,158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,440,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{365,365,365,365,365,365,0,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365},
+{441,378,378,442,443,443,444,443,443,443,443,443,445,445,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443},
+{304,219,219,263,264,264,446,264,264,264,264,264,265,265,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264},
+{220,220,220,221,0,0,447,0,0,0,0,0,158,158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{262,156,156,305,264,264,446,264,264,264,264,264,265,265,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264},
+{262,156,156,263,264,264,446,264,264,264,264,264,265,265,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264},
+{262,156,156,263,264,264,446,264,264,264,264,306,265,265,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264},
+{416,363,363,382,383,383,384,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383},
+{381,352,352,417,383,383,384,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383},
+{416,363,363,382,383,383,448,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383},
+{363,363,363,353,0,0,449,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{381,352,352,417,383,383,448,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383},
+{381,352,352,382,383,383,448,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383},
+{423,368,368,450,425,425,426,425,425,425,425,425,427,427,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425},
+{451,387,387,450,425,425,426,425,425,425,425,425,427,427,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425},
+{423,368,368,452,425,425,426,425,425,425,425,425,427,427,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425},
+{423,368,368,450,425,425,426,425,425,425,425,425,427,427,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425},
+{453,454,454,455,456,456,426,456,456,456,456,456,457,457,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456},
+{423,368,368,450,425,425,426,425,425,425,425,458,427,427,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425},
+{255,152,152,256,257,257,257,257,257,257,257,257,258,258,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257},
+{397,398,398,399,400,400,374,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400,400},
+{360,360,360,360,360,360,0,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360,360},
+{431,432,432,403,302,302,404,302,302,302,302,302,303,303,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302},
+{407,407,407,408,0,0,409,0,0,0,0,0,158,158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{459,402,402,460,461,461,462,461,461,461,461,461,463,463,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461},
+{323,324,324,301,302,302,464,302,302,302,302,302,303,303,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302},
+{220,220,220,221,0,0,447,0,0,0,0,0,158,158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{299,300,300,325,302,302,464,302,302,302,302,302,303,303,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302},
+{299,300,300,301,302,302,464,302,302,302,302,302,303,303,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302},
+{299,300,300,301,302,302,464,302,302,302,302,326,303,303,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302},
+{439,439,439,408,0,0,409,0,0,0,0,0,158,158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{459,402,402,465,461,461,462,461,461,461,461,461,463,463,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461},
+{466,406,406,467,443,443,444,443,443,443,443,443,445,445,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443},
+{441,378,378,468,443,443,444,443,443,443,443,443,445,445,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443},
+{441,378,378,467,443,443,444,443,443,443,443,443,445,445,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443},
+{469,470,470,471,472,472,444,472,472,472,472,472,473,473,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472},
+{441,378,378,467,443,443,444,443,443,443,443,474,445,445,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443},
+{262,156,156,263,264,264,264,264,264,264,264,264,265,265,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264,264},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{418,419,419,420,421,421,384,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421,421},
+{365,365,365,365,365,365,0,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365},
+{423,368,368,452,425,425,426,425,425,425,425,425,427,427,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425},
+{451,387,387,450,425,425,426,425,425,425,425,425,427,427,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425},
+{423,368,368,452,425,425,426,425,425,425,425,425,427,427,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425},
+{451,387,387,450,425,425,475,425,425,425,425,425,427,427,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425},
+{387,387,387,388,0,0,430,0,0,0,0,0,154,154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{423,368,368,452,425,425,475,425,425,425,425,425,427,427,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425},
+{423,368,368,450,425,425,475,425,425,425,425,425,427,427,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425},
+{423,368,368,450,425,425,475,425,425,425,425,458,427,427,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425},
+{423,368,368,450,425,425,426,425,425,425,425,425,427,427,425,476,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425},
+{477,432,432,465,461,461,462,461,461,461,461,461,463,463,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461},
+{459,402,402,478,461,461,462,461,461,461,461,461,463,463,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461},
+{459,402,402,465,461,461,462,461,461,461,461,461,463,463,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461},
+{479,480,480,481,482,482,462,482,482,482,482,482,483,483,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482},
+{459,402,402,465,461,461,462,461,461,461,461,484,463,463,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461},
+{299,300,300,301,302,302,302,302,302,302,302,302,303,303,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302,302},
+{459,402,402,478,461,461,462,461,461,461,461,461,463,463,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461},
+{466,406,406,467,443,443,444,443,443,443,443,443,445,445,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443},
+{441,378,378,468,443,443,444,443,443,443,443,443,445,445,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443},
+{441,378,378,468,443,443,444,443,443,443,443,443,445,445,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443},
+{466,406,406,467,443,443,485,443,443,443,443,443,445,445,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443},
+{407,407,407,408,0,0,486,0,0,0,0,0,158,158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{441,378,378,468,443,443,485,443,443,443,443,443,445,445,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443},
+{441,378,378,467,443,443,485,443,443,443,443,443,445,445,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443},
+{441,378,378,467,443,443,485,443,443,443,443,474,445,445,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443},
+{441,378,378,467,443,443,444,443,443,443,443,443,445,445,443,487,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443},
+{453,454,454,455,456,456,426,456,456,456,456,456,457,457,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456},
+{423,368,368,450,425,425,426,425,425,425,425,425,427,427,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,488,425,425,425,425,425,425,425},
+{477,432,432,465,461,461,462,461,461,461,461,461,463,463,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461},
+{459,402,402,478,461,461,462,461,461,461,461,461,463,463,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461},
+{477,432,432,465,461,461,489,461,461,461,461,461,463,463,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461},
+{407,407,407,408,0,0,486,0,0,0,0,0,158,158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{459,402,402,478,461,461,489,461,461,461,461,461,463,463,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461},
+{459,402,402,465,461,461,489,461,461,461,461,461,463,463,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461},
+{459,402,402,465,461,461,489,461,461,461,461,484,463,463,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461},
+{459,402,402,465,461,461,462,461,461,461,461,461,463,463,461,490,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461},
+{469,470,470,471,472,472,444,472,472,472,472,472,473,473,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472},
+{365,365,365,365,365,365,0,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365},
+{441,378,378,467,443,443,444,443,443,443,443,443,445,445,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,491,443,443,443,443,443,443,443},
+{423,368,368,450,425,425,426,425,425,425,425,425,427,427,425,425,425,425,492,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425},
+{479,480,480,481,482,482,462,482,482,482,482,482,483,483,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482,482},
+{459,402,402,465,461,461,462,461,461,461,461,461,463,463,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,493,461,461,461,461,461,461,461},
+{441,378,378,467,443,443,444,443,443,443,443,443,445,445,443,443,443,443,494,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443},
+{423,368,368,450,425,425,426,425,425,425,425,425,427,427,425,425,495,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425},
+{459,402,402,465,461,461,462,461,461,461,461,461,463,463,461,461,461,461,496,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461},
+{441,378,378,467,443,443,444,443,443,443,443,443,445,445,443,443,497,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443},
+{423,368,368,450,425,425,426,425,425,425,425,498,427,427,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425},
+{459,402,402,465,461,461,462,461,461,461,461,461,463,463,461,461,499,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461},
+{441,378,378,467,443,443,444,443,443,443,443,500,445,445,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443},
+{423,368,368,450,425,425,426,425,425,425,425,425,427,427,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425,425},
+{459,402,402,465,461,461,462,461,461,461,461,501,463,463,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461},
+{441,378,378,467,443,443,444,443,443,443,443,443,445,445,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443,443},
+{459,402,402,465,461,461,462,461,461,461,461,461,463,463,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461,461},
+};
+static yyconst short yy_accept[502] = {0,0,12,0,0,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,64,64,64,19,73,73,73,73,65,73,60,58,64,56,57,64,64,67,73,74,45,74,12,9,5,5,6,6,51,47,11,16,28,28,22,38,27,22,42,42,44,48,24,31,32,31,76,76,77,76,78,78,87,80,79,82,81,85,86,98,98,88,98,100,100,99,101,101,104,102,103,106,106,105,107,107,108,110,110,110,1,1,65,2,15,73,18,20,52,59,0,61,53,55,0,54,68,71,68,67,8,40,66,39,9,9,10,5,7,4,3,51,50,16,16,17,28,22,22,23,26,34,34,33,33,35,27,42,43,41,48,48,48,24,24,24,24,33,33,78,0,82,0,89,97,97,90,95,92,91,93,94,107,109,1,1,2,21,46,0,61,0,68,72,70,69,68,40,66,9,9,9,10,14,9,3,16,16,16,17,13,16,22,22,22,23,37,22,36,33,33,35,43,48,48,48,24,24,24,24,24,24,33,33,0,0,96,95,62,0,0,63,70,68,9,9,9,9,9,16,16,16,16,16,22,22,22,22,22,36,33,33,35,48,48,48,48,48,24,24,24,24,24,24,24,33,33,83,0,0,84,96,95,9,9,9,9,9,9,16,16,16,16,16,16,22,22,22,22,22,22,33,33,48,48,48,48,24,24,24,24,24,24,24,24,24,33,33,9,9,9,16,16,16,22,22,22,29,33,48,48,24,24,24,24,24,24,30,33,33,48,48,24,24,24,33,33,48,48,24,24,24,33,33,48,48,48,48,24,24,24,24,24,33,29,48,48,48,48,24,24,24,24,24,30,48,48,48,48,48,48,48,48,49,24,24,24,24,24,24,24,24,24,25,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,48,48,48,48,48,48,48,48,48,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,25,24,24,48,48,48,48,48,48,48,48,48,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,48,48,24,24,24,24,24,24,24,24,24,24,24,48,24,24,24,48,24,24,48,24,24,48,24,24,24};
+static yyconst short yy_start_state[38] = {1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13,14,14,15,15,16,16,17,17,18,18,19,19};
+YY_DECL
+{
+	int yy_current_state;
+	char *yy_cp, *yy_bp, *yy_end, *yy_last;
+	int yy_act;
+	YY_BUFFER_STATE yy_b;
+	if (!YYG(yy_init))
+	{
+		YYG(yy_init) = 1;
+		if (!yyin)
+			yyin = stdin;
+		if (!yyout)
+			yyout = stdout;
+	}
+	{
+
+	}
+	while (1)
+	{
+		if (YYG(yy_hold_ptr))
+		{
+			*YYG(yy_hold_ptr) = YYG(yy_hold_char);
+			YYG(yy_hold_ptr) = NULL;
+		}
+		if (!YY_CURRENT_BUFFER)
+			YY_CURRENT_BUFFER_LVALUE = yy_create_buffer(yyin, YY_BUF_SIZE);
+		yy_b = YY_CURRENT_BUFFER;
+		if (!yy_b->yy_filled)
+			yy_fill_buffer(yy_b);
+		yy_bp = yy_b->yy_ch_buf + yy_b->yy_pos;
+		if (yy_b->yy_pos >= yy_b->yy_n_chars)
+		{
+			yytext = yy_bp;
+			yyleng = 0;
+			switch (YY_START)
+			{
+				case 0:
+					yy_act = 75;
+					goto do_action;
+				case 1:
+					yy_act = 75;
+					goto do_action;
+				case 2:
+					yy_act = 75;
+					goto do_action;
+				case 3:
+					yy_act = 75;
+					goto do_action;
+				case 4:
+					yy_act = 75;
+					goto do_action;
+				case 5:
+					yy_act = 75;
+					goto do_action;
+				case 6:
+					yy_act = 75;
+					goto do_action;
+				case 7:
+					yy_act = 75;
+					goto do_action;
+				case 8:
+					yy_act = 75;
+					goto do_action;
+				case 9:
+					yy_act = 75;
+					goto do_action;
+				case 10:
+					yy_act = 75;
+					goto do_action;
+				case 11:
+					yy_act = 75;
+					goto do_action;
+				case 12:
+					yy_act = 75;
+					goto do_action;
+				case 13:
+					yy_act = 75;
+					goto do_action;
+				case 14:
+					yy_act = 75;
+					goto do_action;
+				case 15:
+					yy_act = 75;
+					goto do_action;
+				case 16:
+					yy_act = 75;
+					goto do_action;
+				case 17:
+					yy_act = 75;
+					goto do_action;
+				case 18:
+					yy_act = 75;
+					goto do_action;
+				default:
+					yyterminate();
+			}
+		}
+		yy_current_state = yy_start_state[YY_START * 2 + ((yy_b->yy_pos == 0 || yy_b->yy_ch_buf[yy_b->yy_pos - 1] == '\n') ? 1 : 0)];
+		yy_cp = yy_bp;
+		yy_end = yy_b->yy_ch_buf + yy_b->yy_n_chars;
+		yy_act = 0;
+		yy_last = NULL;
+		while (yy_cp < yy_end)
+		{
+			yy_current_state = yy_nxt[yy_current_state][yy_ec[(unsigned char) *yy_cp]];
+			if (yy_current_state == 0)
+				break;
+			yy_cp++;
+			if (yy_accept[yy_current_state])
+			{
+				yy_act = yy_accept[yy_current_state];
+				yy_last = yy_cp;
+			}
+		}
+		if (!yy_act)
+			YY_FATAL_ERROR("flex scanner jammed");
+		yy_cp = yy_last;
+		yytext = yy_bp;
+		yyleng = (int) (yy_cp - yy_bp);
+		YYG(yy_hold_ptr) = yy_cp;
+		YYG(yy_hold_char) = *yy_cp;
+		*yy_cp = '\0';
+		yy_b->yy_pos = (int) (yy_cp - yy_b->yy_ch_buf);
+do_action:
+		switch (yy_act)
+		{
+			case 1:
+YY_RULE_SETUP
+{
+					/*
+					 * Note that the whitespace rule includes both true
+					 * whitespace and single-line ("--" style) comments.
+					 * We suppress whitespace at the start of the query
+					 * buffer.  We also suppress all single-line comments,
+					 * which is pretty dubious but is the historical
+					 * behavior.
+					 */
+					if (!(output_buf->len == 0 || yytext[0] == '-'))
+						ECHO;
+				}
+	YY_BREAK
+			case 2:
+YY_RULE_SETUP
+{
+					cur_state->xcdepth = 0;
+					BEGIN(xc);
+					/* Put back any characters past slash-star; see above */
+					yyless(2);
+					ECHO;
+				}
+	YY_BREAK
+			case 3:
+YY_RULE_SETUP
+{
+					cur_state->xcdepth++;
+					/* Put back any characters past slash-star; see above */
+					yyless(2);
+					ECHO;
+				}
+	YY_BREAK
+			case 4:
+YY_RULE_SETUP
+{
+					if (cur_state->xcdepth <= 0)
+					{
+						BEGIN(INITIAL);
+					}
+					else
+						cur_state->xcdepth--;
+					ECHO;
+				}
+	YY_BREAK
+			case 5:
+YY_RULE_SETUP
+{
+					ECHO;
+				}
+	YY_BREAK
+			case 6:
+YY_RULE_SETUP
+{
+					ECHO;
+				}
+	YY_BREAK
+			case 7:
+YY_RULE_SETUP
+{
+					ECHO;
+				}
+	YY_BREAK
+			case 8:
+YY_RULE_SETUP
+{
+					BEGIN(xb);
+					ECHO;
+				}
+	YY_BREAK
+			case 9:
+			case 10:
+YY_RULE_SETUP
+{
+					yyless(1);
+					BEGIN(INITIAL);
+					ECHO;
+				}
+	YY_BREAK
+			case 11:
+			case 12:
+YY_RULE_SETUP
+{
+					ECHO;
+				}
+	YY_BREAK
+			case 13:
+			case 14:
+YY_RULE_SETUP
+{
+					ECHO;
+				}
+	YY_BREAK
+			case 15:
+YY_RULE_SETUP
+{
+					/* Hexadecimal bit type.
+					 * At some point we should simply pass the string
+					 * forward to the parser and label it there.
+					 * In the meantime, place a leading "x" on the string
+					 * to mark it for the input routine as a hex string.
+					 */
+					BEGIN(xh);
+					ECHO;
+				}
+	YY_BREAK
+			case 16:
+			case 17:
+YY_RULE_SETUP
+{
+					yyless(1);
+					BEGIN(INITIAL);
+					ECHO;
+				}
+	YY_BREAK
+			case 18:
+YY_RULE_SETUP
+{
+					yyless(1);				/* eat only 'n' this time */
+					ECHO;
+				}
+	YY_BREAK
+			case 19:
+YY_RULE_SETUP
+{
+					if (standard_strings())
+						BEGIN(xq);
+					else
+						BEGIN(xe);
+					ECHO;
+				}
+	YY_BREAK
+			case 20:
+YY_RULE_SETUP
+{
+					BEGIN(xe);
+					ECHO;
+				}
+	YY_BREAK
+			case 21:
+YY_RULE_SETUP
+{
+					BEGIN(xus);
+					ECHO;
+				}
+	YY_BREAK
+			case 22:
+			case 23:
+YY_RULE_SETUP
+{
+					yyless(1);
+					BEGIN(INITIAL);
+					ECHO;
+				}
+	YY_BREAK
+			case 24:
+YY_RULE_SETUP
+{
+					yyless(1);
+					BEGIN(INITIAL);
+					ECHO;
+				}
+	YY_BREAK
+			case 25:
+YY_RULE_SETUP
+{
+					BEGIN(INITIAL);
+					ECHO;
+				}
+	YY_BREAK
+			case 26:
+YY_RULE_SETUP
+{
+					ECHO;
+				}
+	YY_BREAK
+			case 27:
+YY_RULE_SETUP
+{
+					ECHO;
+				}
+	YY_BREAK
+			case 28:
+YY_RULE_SETUP
+{
+					ECHO;
+				}
+	YY_BREAK
+			case 29:
+YY_RULE_SETUP
+{
+					uint32 c = strtoul(yytext+2, NULL, 16);
+
+					if (is_utf16_surrogate_first(c))
+						BEGIN(xeu);
+					ECHO;
+				}
+	YY_BREAK
+			case 30:
+YY_RULE_SETUP
+{
+					BEGIN(xe);
+					ECHO;
+				}
+	YY_BREAK
+			case 31:
+YY_RULE_SETUP
+{ ECHO; }
+	YY_BREAK
+			case 32:
+YY_RULE_SETUP
+{ ECHO; }
+	YY_BREAK
+			case 33:
+YY_RULE_SETUP
+{
+					ECHO;
+				}
+	YY_BREAK
+			case 34:
+YY_RULE_SETUP
+{
+					ECHO;
+				}
+	YY_BREAK
+			case 35:
+YY_RULE_SETUP
+{
+					ECHO;
+				}
+	YY_BREAK
+			case 36:
+YY_RULE_SETUP
+{
+					ECHO;
+				}
+	YY_BREAK
+			case 37:
+YY_RULE_SETUP
+{
+					ECHO;
+				}
+	YY_BREAK
+			case 38:
+YY_RULE_SETUP
+{
+					/* This is only needed for \ just before EOF */
+					ECHO;
+				}
+	YY_BREAK
+			case 39:
+YY_RULE_SETUP
+{
+					cur_state->dolqstart = pg_strdup(yytext);
+					BEGIN(xdolq);
+					ECHO;
+				}
+	YY_BREAK
+			case 40:
+YY_RULE_SETUP
+{
+					/* throw back all but the initial "$" */
+					yyless(1);
+					ECHO;
+				}
+	YY_BREAK
+			case 41:
+YY_RULE_SETUP
+{
+					if (strcmp(yytext, cur_state->dolqstart) == 0)
+					{
+						free(cur_state->dolqstart);
+						cur_state->dolqstart = NULL;
+						BEGIN(INITIAL);
+					}
+					else
+					{
+						/*
+						 * When we fail to match $...$ to dolqstart, transfer
+						 * the $... part to the output, but put back the final
+						 * $ for rescanning.  Consider $delim$...$junk$delim$
+						 */
+						yyless(yyleng-1);
+					}
+					ECHO;
+				}
+	YY_BREAK
+			case 42:
+YY_RULE_SETUP
+{
+					ECHO;
+				}
+	YY_BREAK
+			case 43:
+YY_RULE_SETUP
+{
+					ECHO;
+				}
+	YY_BREAK
+			case 44:
+YY_RULE_SETUP
+{
+					/* This is only needed for $ inside the quoted text */
+					ECHO;
+				}
+	YY_BREAK
+			case 45:
+YY_RULE_SETUP
+{
+					BEGIN(xd);
+					ECHO;
+				}
+	YY_BREAK
+			case 46:
+YY_RULE_SETUP
+{
+					BEGIN(xui);
+					ECHO;
+				}
+	YY_BREAK
+			case 47:
+YY_RULE_SETUP
+{
+					BEGIN(INITIAL);
+					ECHO;
+				}
+	YY_BREAK
+			case 48:
+YY_RULE_SETUP
+{
+					yyless(1);
+					BEGIN(INITIAL);
+					ECHO;
+				}
+	YY_BREAK
+			case 49:
+YY_RULE_SETUP
+{
+					BEGIN(INITIAL);
+					ECHO;
+				}
+	YY_BREAK
+			case 50:
+YY_RULE_SETUP
+{
+					ECHO;
+				}
+	YY_BREAK
+			case 51:
+YY_RULE_SETUP
+{
+					ECHO;
+				}
+	YY_BREAK
+			case 52:
+YY_RULE_SETUP
+{
+					/* throw back all but the initial u/U */
+					yyless(1);
+					ECHO;
+				}
+	YY_BREAK
+			case 53:
+YY_RULE_SETUP
+{
+					ECHO;
+				}
+	YY_BREAK
+			case 54:
+YY_RULE_SETUP
+{
+					ECHO;
+				}
+	YY_BREAK
+			case 55:
+YY_RULE_SETUP
+{
+					ECHO;
+				}
+	YY_BREAK
+			case 56:
+YY_RULE_SETUP
+{
+					cur_state->paren_depth++;
+					ECHO;
+				}
+	YY_BREAK
+			case 57:
+YY_RULE_SETUP
+{
+					if (cur_state->paren_depth > 0)
+						cur_state->paren_depth--;
+					ECHO;
+				}
+	YY_BREAK
+			case 58:
+YY_RULE_SETUP
+{
+					ECHO;
+					if (cur_state->paren_depth == 0)
+					{
+						/* Terminate lexing temporarily */
+						return LEXRES_SEMI;
+					}
+				}
+	YY_BREAK
+			case 59:
+YY_RULE_SETUP
+{
+					/* Force a semicolon or colon into the query buffer */
+					emit(yytext + 1, 1);
+				}
+	YY_BREAK
+			case 60:
+YY_RULE_SETUP
+{
+					/* Terminate lexing temporarily */
+					return LEXRES_BACKSLASH;
+				}
+	YY_BREAK
+			case 61:
+YY_RULE_SETUP
+{
+					/* Possible psql variable substitution */
+					const char *value;
+
+					value = GetVariable(pset.vars, yytext + 1);
+
+					if (value)
+					{
+						/* It is a variable, perform substitution */
+						push_new_buffer(value);
+						/* yy_scan_string already made buffer active */
+					}
+					else
+					{
+						/*
+						 * if the variable doesn't exist we'll copy the
+						 * string as is
+						 */
+						ECHO;
+					}
+				}
+	YY_BREAK
+			case 62:
+YY_RULE_SETUP
+{
+					escape_variable(false);
+				}
+	YY_BREAK
+			case 63:
+YY_RULE_SETUP
+{
+					escape_variable(true);
+				}
+	YY_BREAK
+			case 64:
+YY_RULE_SETUP
+{
+					ECHO;
+				}
+	YY_BREAK
+			case 65:
+YY_RULE_SETUP
+{
+					/*
+					 * Check for embedded slash-star or dash-dash; those
+					 * are comment starts, so operator must stop there.
+					 * Note that slash-star or dash-dash at the first
+					 * character will match a prior rule, not this one.
+					 */
+					int		nchars = yyleng;
+					char   *slashstar = strstr(yytext, "/*");
+					char   *dashdash = strstr(yytext, "--");
+
+					if (slashstar && dashdash)
+					{
+						/* if both appear, take the first one */
+						if (slashstar > dashdash)
+							slashstar = dashdash;
+					}
+					else if (!slashstar)
+						slashstar = dashdash;
+					if (slashstar)
+						nchars = slashstar - yytext;
+
+					/*
+					 * For SQL compatibility, '+' and '-' cannot be the
+					 * last char of a multi-char operator unless the operator
+					 * contains chars that are not in SQL operators.
+					 * The idea is to lex '=-' as two operators, but not
+					 * to forbid operator names like '?-' that could not be
+					 * sequences of SQL operators.
+					 */
+					while (nchars > 1 &&
+						   (yytext[nchars-1] == '+' ||
+							yytext[nchars-1] == '-'))
+					{
+						int		ic;
+
+						for (ic = nchars-2; ic >= 0; ic--)
+						{
+							if (strchr("~!@#^&|`?%", yytext[ic]))
+								break;
+						}
+						if (ic >= 0)
+							break; /* found a char that makes it OK */
+						nchars--; /* else remove the +/-, and check again */
+					}
+
+					if (nchars < yyleng)
+					{
+						/* Strip the unwanted chars from the token */
+						yyless(nchars);
+					}
+					ECHO;
+				}
+	YY_BREAK
+			case 66:
+YY_RULE_SETUP
+{
+					ECHO;
+				}
+	YY_BREAK
+			case 67:
+YY_RULE_SETUP
+{
+					ECHO;
+				}
+	YY_BREAK
+			case 68:
+YY_RULE_SETUP
+{
+					ECHO;
+				}
+	YY_BREAK
+			case 69:
+YY_RULE_SETUP
+{
+					/* throw back the .., and treat as integer */
+					yyless(yyleng-2);
+					ECHO;
+				}
+	YY_BREAK
+			case 70:
+YY_RULE_SETUP
+{
+					ECHO;
+				}
+	YY_BREAK
+			case 71:
+YY_RULE_SETUP
+{
+					/*
+					 * throw back the [Ee], and treat as {decimal}.  Note
+					 * that it is possible the input is actually {integer},
+					 * but since this case will almost certainly lead to a
+					 * syntax error anyway, we don't bother to distinguish.
+					 */
+					yyless(yyleng-1);
+					ECHO;
+				}
+	YY_BREAK
+			case 72:
+YY_RULE_SETUP
+{
+					/* throw back the [Ee][+-], and proceed as above */
+					yyless(yyleng-2);
+					ECHO;
+				}
+	YY_BREAK
+			case 73:
+YY_RULE_SETUP
+{
+					ECHO;
+				}
+	YY_BREAK
+			case 74:
+YY_RULE_SETUP
+{
+					ECHO;
+				}
+	YY_BREAK
+			case 75:
+YY_RULE_SETUP
+{
+					StackElem  *stackelem = cur_state->buffer_stack;
+
+					if (stackelem == NULL)
+						return LEXRES_EOL; /* end of input reached */
+
+					/*
+					 * We were expanding a variable, so pop the inclusion
+					 * stack and keep lexing
+					 */
+					cur_state->buffer_stack = stackelem->next;
+					yy_delete_buffer(stackelem->buf);
+					free(stackelem->bufstring);
+					if (stackelem->origstring)
+						free(stackelem->origstring);
+					free(stackelem);
+
+					stackelem = cur_state->buffer_stack;
+					if (stackelem != NULL)
+					{
+						yy_switch_to_buffer(stackelem->buf);
+						cur_state->curline = stackelem->bufstring;
+						cur_state->refline = stackelem->origstring ? stackelem->origstring : stackelem->bufstring;
+					}
+					else
+					{
+						yy_switch_to_buffer(cur_state->scanbufhandle);
+						cur_state->curline = cur_state->scanbuf;
+						cur_state->refline = cur_state->scanline;
+					}
+				}
+	YY_BREAK
+			case 76:
+YY_RULE_SETUP
+{
+					yyless(0);
+					return LEXRES_OK;
+				}
+	YY_BREAK
+			case 77:
+YY_RULE_SETUP
+{ ECHO; }
+	YY_BREAK
+			case 78:
+YY_RULE_SETUP
+{ }
+	YY_BREAK
+			case 79:
+YY_RULE_SETUP
+{
+					/*
+					 * backslash is end of command or next command, do not eat
+					 *
+					 * XXX this means we can't conveniently accept options
+					 * that start with a backslash; therefore, option
+					 * processing that encourages use of backslashes is rather
+					 * broken.
+					 */
+					yyless(0);
+					return LEXRES_OK;
+				}
+	YY_BREAK
+			case 80:
+YY_RULE_SETUP
+{
+					*option_quote = '\'';
+					BEGIN(xslashquote);
+				}
+	YY_BREAK
+			case 81:
+YY_RULE_SETUP
+{
+					if (option_type == OT_VERBATIM)
+					{
+						/* in verbatim mode, backquote is not special */
+						ECHO;
+						BEGIN(xslashdefaultarg);
+					}
+					else
+					{
+						*option_quote = '`';
+						BEGIN(xslashbackquote);
+					}
+				}
+	YY_BREAK
+			case 82:
+YY_RULE_SETUP
+{
+					/* Possible psql variable substitution */
+					if (option_type == OT_VERBATIM)
+						ECHO;
+					else
+					{
+						const char *value;
+
+						value = GetVariable(pset.vars, yytext + 1);
+
+						/*
+						 * The variable value is just emitted without any
+						 * further examination.  This is consistent with the
+						 * pre-8.0 code behavior, if not with the way that
+						 * variables are handled outside backslash commands.
+						 */
+						if (value)
+							appendPQExpBufferStr(output_buf, value);
+					}
+
+					*option_quote = ':';
+
+					return LEXRES_OK;
+				}
+	YY_BREAK
+			case 83:
+YY_RULE_SETUP
+{
+					if (option_type == OT_VERBATIM)
+						ECHO;
+					else
+					{
+						escape_variable(false);
+						return LEXRES_OK;
+					}
+				}
+	YY_BREAK
+			case 84:
+YY_RULE_SETUP
+{
+					if (option_type == OT_VERBATIM)
+						ECHO;
+					else
+					{
+						escape_variable(true);
+						return LEXRES_OK;
+					}
+				}
+	YY_BREAK
+			case 85:
+YY_RULE_SETUP
+{
+					ECHO;
+					if (option_type == OT_FILEPIPE)
+					{
+						/* treat like whole-string case */
+						BEGIN(xslashwholeline);
+					}
+					else
+					{
+						/* treat like default case */
+						BEGIN(xslashdefaultarg);
+					}
+				}
+	YY_BREAK
+			case 86:
+YY_RULE_SETUP
+{
+					*option_quote = '"';
+					ECHO;
+					BEGIN(xslashquotedarg);
+				}
+	YY_BREAK
+			case 87:
+YY_RULE_SETUP
+{
+					ECHO;
+					BEGIN(xslashdefaultarg);
+				}
+	YY_BREAK
+			case 88:
+YY_RULE_SETUP
+{ return LEXRES_OK; }
+	YY_BREAK
+			case 89:
+YY_RULE_SETUP
+{ appendPQExpBufferChar(output_buf, '\''); }
+	YY_BREAK
+			case 90:
+YY_RULE_SETUP
+{ appendPQExpBufferChar(output_buf, '\n'); }
+	YY_BREAK
+			case 91:
+YY_RULE_SETUP
+{ appendPQExpBufferChar(output_buf, '\t'); }
+	YY_BREAK
+			case 92:
+YY_RULE_SETUP
+{ appendPQExpBufferChar(output_buf, '\b'); }
+	YY_BREAK
+			case 93:
+YY_RULE_SETUP
+{ appendPQExpBufferChar(output_buf, '\r'); }
+	YY_BREAK
+			case 94:
+YY_RULE_SETUP
+{ appendPQExpBufferChar(output_buf, '\f'); }
+	YY_BREAK
+			case 95:
+YY_RULE_SETUP
+{
+					/* octal case */
+					appendPQExpBufferChar(output_buf,
+										  (char) strtol(yytext + 1, NULL, 8));
+				}
+	YY_BREAK
+			case 96:
+YY_RULE_SETUP
+{
+					/* hex case */
+					appendPQExpBufferChar(output_buf,
+										  (char) strtol(yytext + 2, NULL, 16));
+				}
+	YY_BREAK
+			case 97:
+YY_RULE_SETUP
+{ emit(yytext + 1, 1); }
+	YY_BREAK
+			case 98:
+YY_RULE_SETUP
+{ ECHO; }
+	YY_BREAK
+			case 99:
+YY_RULE_SETUP
+{ return LEXRES_OK; }
+	YY_BREAK
+			case 100:
+YY_RULE_SETUP
+{ ECHO; }
+	YY_BREAK
+			case 101:
+YY_RULE_SETUP
+{
+					yyless(0);
+					return LEXRES_OK;
+				}
+	YY_BREAK
+			case 102:
+YY_RULE_SETUP
+{
+					/*
+					 * unquoted backslash is end of command or next command,
+					 * do not eat
+					 *
+					 * (this was not the behavior pre-8.0, but it seems
+					 * consistent)
+					 */
+					yyless(0);
+					return LEXRES_OK;
+				}
+	YY_BREAK
+			case 103:
+YY_RULE_SETUP
+{
+					*option_quote = '"';
+					ECHO;
+					BEGIN(xslashquotedarg);
+				}
+	YY_BREAK
+			case 104:
+YY_RULE_SETUP
+{ ECHO; }
+	YY_BREAK
+			case 105:
+YY_RULE_SETUP
+{
+					ECHO;
+					BEGIN(xslashdefaultarg);
+				}
+	YY_BREAK
+			case 106:
+YY_RULE_SETUP
+{ ECHO; }
+	YY_BREAK
+			case 107:
+YY_RULE_SETUP
+{
+					if (output_buf->len > 0)
+						ECHO;
+				}
+	YY_BREAK
+			case 108:
+YY_RULE_SETUP
+{ ECHO; }
+	YY_BREAK
+			case 109:
+YY_RULE_SETUP
+{ return LEXRES_OK; }
+	YY_BREAK
+			case 110:
+YY_RULE_SETUP
+{
+					yyless(0);
+					return LEXRES_OK;
+				}
+	YY_BREAK
+			default:
+				YY_FATAL_ERROR("fatal flex scanner internal error--no action found");
+		}
+	}
+}
+
+static void
+yy_fatal_error(yyconst char *msg)
+{
+	(void) fprintf(stderr, "%s\n", msg);
+	exit(2);
+}
+
+static void
+yy_fill_buffer(YY_BUFFER_STATE b)
+{
+	yy_size_t	size = 16384;
+	yy_size_t	n = 0;
+
+	b->yy_ch_buf = (char *) yyalloc(size + 2);
+	if (!b->yy_ch_buf)
+		YY_FATAL_ERROR("out of dynamic memory in yy_fill_buffer()");
+	if (b->yy_input_file)
+	{
+		for (;;)
+		{
+			size_t		r;
+
+			if (n == size)
+			{
+				size *= 2;
+				b->yy_ch_buf = (char *) yyrealloc(b->yy_ch_buf, size + 2);
+				if (!b->yy_ch_buf)
+					YY_FATAL_ERROR("out of dynamic memory in yy_fill_buffer()");
+			}
+			r = fread(b->yy_ch_buf + n, 1, size - n, b->yy_input_file);
+			if (r == 0)
+			{
+				if (ferror(b->yy_input_file) && errno == EINTR)
+				{
+					clearerr(b->yy_input_file);
+					continue;
+				}
+				break;
+			}
+			n += r;
+		}
+	}
+	b->yy_ch_buf[n] = b->yy_ch_buf[n + 1] = YY_END_OF_BUFFER_CHAR;
+	b->yy_n_chars = (int) n;
+	b->yy_buf_size = size;
+	b->yy_pos = 0;
+	b->yy_filled = 1;
+	b->yy_is_our_buffer = 1;
+}
+
+void
+yyrestart(FILE *input_file)
+{
+
+	if (YYG(yy_hold_ptr))
+	{
+		*YYG(yy_hold_ptr) = YYG(yy_hold_char);
+		YYG(yy_hold_ptr) = NULL;
+	}
+	if (YY_CURRENT_BUFFER)
+		yy_delete_buffer(YY_CURRENT_BUFFER);
+	YY_CURRENT_BUFFER_LVALUE = yy_create_buffer(input_file, YY_BUF_SIZE);
+}
+
+void
+yy_switch_to_buffer(YY_BUFFER_STATE new_buffer)
+{
+
+	if (YYG(yy_hold_ptr))
+	{
+		*YYG(yy_hold_ptr) = YYG(yy_hold_char);
+		YYG(yy_hold_ptr) = NULL;
+	}
+	YY_CURRENT_BUFFER_LVALUE = new_buffer;
+}
+
+YY_BUFFER_STATE
+yy_create_buffer(FILE *file, int size)
+{
+	YY_BUFFER_STATE b;
+
+	(void) size;
+	b = (YY_BUFFER_STATE) yyalloc(sizeof(struct yy_buffer_state));
+	if (!b)
+		YY_FATAL_ERROR("out of dynamic memory in yy_create_buffer()");
+	memset(b, 0, sizeof(struct yy_buffer_state));
+	b->yy_input_file = file;
+	return b;
+}
+
+void
+yy_delete_buffer(YY_BUFFER_STATE b)
+{
+
+	if (!b)
+		return;
+	if (b == YY_CURRENT_BUFFER)
+	{
+		if (YYG(yy_hold_ptr))
+		{
+			*YYG(yy_hold_ptr) = YYG(yy_hold_char);
+			YYG(yy_hold_ptr) = NULL;
+		}
+		YY_CURRENT_BUFFER_LVALUE = NULL;
+	}
+	if (b->yy_is_our_buffer && b->yy_ch_buf)
+		yyfree(b->yy_ch_buf);
+	yyfree(b);
+}
+
+void
+yy_flush_buffer(YY_BUFFER_STATE b)
+{
+	if (!b)
+		return;
+	b->yy_pos = b->yy_n_chars;
+}
+
+YY_BUFFER_STATE
+yy_scan_buffer(char *base, yy_size_t size)
+{
+	YY_BUFFER_STATE b;
+
+	if (size < 2 ||
+		base[size - 2] != YY_END_OF_BUFFER_CHAR ||
+		base[size - 1] != YY_END_OF_BUFFER_CHAR)
+		return NULL;
+	b = (YY_BUFFER_STATE) yyalloc(sizeof(struct yy_buffer_state));
+	if (!b)
+		YY_FATAL_ERROR("out of dynamic memory in yy_scan_buffer()");
+	memset(b, 0, sizeof(struct yy_buffer_state));
+	b->yy_ch_buf = base;
+	b->yy_buf_size = size - 2;
+	b->yy_n_chars = (int) (size - 2);
+	b->yy_pos = 0;
+	b->yy_filled = 1;
+	b->yy_is_our_buffer = 0;
+	yy_switch_to_buffer(b);
+	return b;
+}
+
+YY_BUFFER_STATE
+yy_scan_string(yyconst char *yystr)
+{
+	return yy_scan_bytes(yystr, (int) strlen(yystr));
+}
+
+YY_BUFFER_STATE
+yy_scan_bytes(yyconst char *yybytes, int len)
+{
+	YY_BUFFER_STATE b;
+	char	   *buf;
+
+	buf = (char *) yyalloc(len + 2);
+	if (!buf)
+		YY_FATAL_ERROR("out of dynamic memory in yy_scan_bytes()");
+	memcpy(buf, yybytes, len);
+	buf[len] = buf[len + 1] = YY_END_OF_BUFFER_CHAR;
+	b = yy_scan_buffer(buf, len + 2);
+	if (!b)
+		YY_FATAL_ERROR("bad buffer in yy_scan_bytes()");
+	b->yy_is_our_buffer = 1;
+	return b;
+}
+
+int
+yylex_destroy(void)
+{
+	if (YY_CURRENT_BUFFER)
+		yy_delete_buffer(YY_CURRENT_BUFFER);
+	yy_init = 0;
+	yy_start = 0;
+	return 0;
+}
+void *
+yyalloc(yy_size_t size)
+{
+	return malloc(size);
+}
+void *
+yyrealloc(void *ptr, yy_size_t size)
+{
+	return realloc(ptr, size);
+}
+void
+yyfree(void *ptr)
+{
+	free(ptr);
+}
+
+/* user code */
+
+/*
+ * Create a lexer working state struct.
+ */
+PsqlScanState
+psql_scan_create(void)
+{
+	PsqlScanState state;
+
+	state = (PsqlScanStateData *) pg_malloc_zero(sizeof(PsqlScanStateData));
+
+	psql_scan_reset(state);
+
+	return state;
+}
+
+/*
+ * Destroy a lexer working state struct, releasing all resources.
+ */
+void
+psql_scan_destroy(PsqlScanState state)
+{
+	psql_scan_finish(state);
+
+	psql_scan_reset(state);
+
+	free(state);
+}
+
+/*
+ * Set up to perform lexing of the given input line.
+ *
+ * The text at *line, extending for line_len bytes, will be scanned by
+ * subsequent calls to the psql_scan routines.  psql_scan_finish should
+ * be called when scanning is complete.  Note that the lexer retains
+ * a pointer to the storage at *line --- this string must not be altered
+ * or freed until after psql_scan_finish is called.
+ */
+void
+psql_scan_setup(PsqlScanState state,
+				const char *line, int line_len)
+{
+	/* Mustn't be scanning already */
+	psql_assert(state->scanbufhandle == NULL);
+	psql_assert(state->buffer_stack == NULL);
+
+	/* Do we need to hack the character set encoding? */
+	state->encoding = pset.encoding;
+	state->safe_encoding = pg_valid_server_encoding_id(state->encoding);
+
+	/* needed for prepare_buffer */
+	cur_state = state;
+
+	/* Set up flex input buffer with appropriate translation and padding */
+	state->scanbufhandle = prepare_buffer(line, line_len,
+										  &state->scanbuf);
+	state->scanline = line;
+
+	/* Set lookaside data in case we have to map unsafe encoding */
+	state->curline = state->scanbuf;
+	state->refline = state->scanline;
+}
+
+/*
+ * Do lexical analysis of SQL command text.
+ *
+ * The text previously passed to psql_scan_setup is scanned, and appended
+ * (possibly with transformation) to query_buf.
+ *
+ * The return value indicates the condition that stopped scanning:
+ *
+ * PSCAN_SEMICOLON: found a command-ending semicolon.  (The semicolon is
+ * transferred to query_buf.)  The command accumulated in query_buf should
+ * be executed, then clear query_buf and call again to scan the remainder
+ * of the line.
+ *
+ * PSCAN_BACKSLASH: found a backslash that starts a psql special command.
+ * Any previous data on the line has been transferred to query_buf.
+ * The caller will typically next call psql_scan_slash_command(),
+ * perhaps psql_scan_slash_option(), and psql_scan_slash_command_end().
+ *
+ * PSCAN_INCOMPLETE: the end of the line was reached, but we have an
+ * incomplete SQL command.  *prompt is set to the appropriate prompt type.
+ *
+ * PSCAN_EOL: the end of the line was reached, and there is no lexical
+ * reason to consider the command incomplete.  The caller may or may not
+ * choose to send it.  *prompt is set to the appropriate prompt type if
+ * the caller chooses to collect more input.
+ *
+ * In the PSCAN_INCOMPLETE and PSCAN_EOL cases, psql_scan_finish() should
+ * be called next, then the cycle may be repeated with a fresh input line.
+ *
+ * In all cases, *prompt is set to an appropriate prompt type code for the
+ * next line-input operation.
+ */
+PsqlScanResult
+psql_scan(PsqlScanState state,
+		  PQExpBuffer query_buf,
+		  promptStatus_t *prompt)
+{
+	PsqlScanResult result;
+	int			lexresult;
+
+	/* Must be scanning already */
+	psql_assert(state->scanbufhandle);
+
+	/* Set up static variables that will be used by yylex */
+	cur_state = state;
+	output_buf = query_buf;
+
+	if (state->buffer_stack != NULL)
+		yy_switch_to_buffer(state->buffer_stack->buf);
+	else
+		yy_switch_to_buffer(state->scanbufhandle);
+
+	BEGIN(state->start_state);
+
+	/* And lex. */
+	lexresult = yylex();
+
+	/* Update static vars back to the state struct */
+	state->start_state = YY_START;
+
+	/*
+	 * Check termination state and return appropriate result info.
+	 */
+	switch (lexresult)
+	{
+		case LEXRES_EOL:		/* end of input */
+			switch (state->start_state)
+			{
+				case INITIAL:
+					if (state->paren_depth > 0)
+					{
+						result = PSCAN_INCOMPLETE;
+						*prompt = PROMPT_PAREN;
+					}
+					else if (query_buf->len > 0)
+					{
+						result = PSCAN_EOL;
+						*prompt = PROMPT_CONTINUE;
+					}
+					else
+					{
+						/* never bother to send an empty buffer */
+						result = PSCAN_INCOMPLETE;
+						*prompt = PROMPT_READY;
+					}
+					break;
+				case xb:
+					result = PSCAN_INCOMPLETE;
+					*prompt = PROMPT_SINGLEQUOTE;
+					break;
+				case xc:
+					result = PSCAN_INCOMPLETE;
+					*prompt = PROMPT_COMMENT;
+					break;
+				case xd:
+					result = PSCAN_INCOMPLETE;
+					*prompt = PROMPT_DOUBLEQUOTE;
+					break;
+				case xh:
+					result = PSCAN_INCOMPLETE;
+					*prompt = PROMPT_SINGLEQUOTE;
+					break;
+				case xq:
+					result = PSCAN_INCOMPLETE;
+					*prompt = PROMPT_SINGLEQUOTE;
+					break;
+				case xe:
+					result = PSCAN_INCOMPLETE;
+					*prompt = PROMPT_SINGLEQUOTE;
+					break;
+				case xdolq:
+					result = PSCAN_INCOMPLETE;
+					*prompt = PROMPT_DOLLARQUOTE;
+					break;
+				default:
+					/* can't get here */
+					fprintf(stderr, "invalid YY_START\n");
+					exit(1);
+			}
+			break;
+		case LEXRES_SEMI:		/* semicolon */
+			result = PSCAN_SEMICOLON;
+			*prompt = PROMPT_READY;
+			break;
+		case LEXRES_BACKSLASH:	/* backslash */
+			result = PSCAN_BACKSLASH;
+			*prompt = PROMPT_READY;
+			break;
+		default:
+			/* can't get here */
+			fprintf(stderr, "invalid yylex result\n");
+			exit(1);
+	}
+
+	return result;
+}
+
+/*
+ * Clean up after scanning a string.  This flushes any unread input and
+ * releases resources (but not the PsqlScanState itself).  Note however
+ * that this does not reset the lexer scan state; that can be done by
+ * psql_scan_reset(), which is an orthogonal operation.
+ *
+ * It is legal to call this when not scanning anything (makes it easier
+ * to deal with error recovery).
+ */
+void
+psql_scan_finish(PsqlScanState state)
+{
+	/* Drop any incomplete variable expansions. */
+	while (state->buffer_stack != NULL)
+	{
+		StackElem  *stackelem = state->buffer_stack;
+
+		state->buffer_stack = stackelem->next;
+		yy_delete_buffer(stackelem->buf);
+		free(stackelem->bufstring);
+		if (stackelem->origstring)
+			free(stackelem->origstring);
+		free(stackelem);
+	}
+
+	/* Done with the outer scan buffer, too */
+	if (state->scanbufhandle)
+		yy_delete_buffer(state->scanbufhandle);
+	state->scanbufhandle = NULL;
+	if (state->scanbuf)
+		free(state->scanbuf);
+	state->scanbuf = NULL;
+}
+
+/*
+ * Reset lexer scanning state to start conditions.  This is appropriate
+ * for executing \r psql commands (or any other time that we discard the
+ * prior contents of query_buf).  It is not, however, necessary to do this
+ * when we execute and clear the buffer after getting a PSCAN_SEMICOLON or
+ * PSCAN_EOL scan result, because the scan state must be INITIAL when those
+ * conditions are returned.
+ *
+ * Note that this is unrelated to flushing unread input; that task is
+ * done by psql_scan_finish().
+ */
+void
+psql_scan_reset(PsqlScanState state)
+{
+	state->start_state = INITIAL;
+	state->paren_depth = 0;
+	state->xcdepth = 0;			/* not really necessary */
+	if (state->dolqstart)
+		free(state->dolqstart);
+	state->dolqstart = NULL;
+}
+
+/*
+ * Return true if lexer is currently in an "inside quotes" state.
+ *
+ * This is pretty grotty but is needed to preserve the old behavior
+ * that mainloop.c drops blank lines not inside quotes without even
+ * echoing them.
+ */
+bool
+psql_scan_in_quote(PsqlScanState state)
+{
+	return state->start_state != INITIAL;
+}
+
+/*
+ * Scan the command name of a psql backslash command.  This should be called
+ * after psql_scan() returns PSCAN_BACKSLASH.  It is assumed that the input
+ * has been consumed through the leading backslash.
+ *
+ * The return value is a malloc'd copy of the command name, as parsed off
+ * from the input.
+ */
+char *
+psql_scan_slash_command(PsqlScanState state)
+{
+	PQExpBufferData mybuf;
+	int			lexresult;
+
+	/* Must be scanning already */
+	psql_assert(state->scanbufhandle);
+
+	/* Build a local buffer that we'll return the data of */
+	initPQExpBuffer(&mybuf);
+
+	/* Set up static variables that will be used by yylex */
+	cur_state = state;
+	output_buf = &mybuf;
+
+	if (state->buffer_stack != NULL)
+		yy_switch_to_buffer(state->buffer_stack->buf);
+	else
+		yy_switch_to_buffer(state->scanbufhandle);
+
+	BEGIN(xslashcmd);
+
+	/* And lex. */
+	lexresult = yylex();
+
+	/* There are no possible errors in this lex state... */
+
+	return mybuf.data;
+}
+
+/*
+ * Parse off the next argument for a backslash command, and return it as a
+ * malloc'd string.  If there are no more arguments, returns NULL.
+ *
+ * type tells what processing, if any, to perform on the option string;
+ * for example, if it's a SQL identifier, we want to downcase any unquoted
+ * letters.
+ *
+ * if quote is not NULL, *quote is set to 0 if no quoting was found, else
+ * the quote symbol.
+ *
+ * if semicolon is true, unquoted trailing semicolon(s) that would otherwise
+ * be taken as part of the option string will be stripped.
+ *
+ * NOTE: the only possible syntax errors for backslash options are unmatched
+ * quotes, which are detected when we run out of input.  Therefore, on a
+ * syntax error we just throw away the string and return NULL; there is no
+ * need to worry about flushing remaining input.
+ */
+char *
+psql_scan_slash_option(PsqlScanState state,
+					   enum slash_option_type type,
+					   char *quote,
+					   bool semicolon)
+{
+	PQExpBufferData mybuf;
+	int			lexresult;
+	char		local_quote;
+	bool		badarg;
+
+	/* Must be scanning already */
+	psql_assert(state->scanbufhandle);
+
+	if (quote == NULL)
+		quote = &local_quote;
+	*quote = 0;
+
+	/* Build a local buffer that we'll return the data of */
+	initPQExpBuffer(&mybuf);
+
+	/* Set up static variables that will be used by yylex */
+	cur_state = state;
+	output_buf = &mybuf;
+	option_type = type;
+	option_quote = quote;
+
+	if (state->buffer_stack != NULL)
+		yy_switch_to_buffer(state->buffer_stack->buf);
+	else
+		yy_switch_to_buffer(state->scanbufhandle);
+
+	if (type == OT_WHOLE_LINE)
+		BEGIN(xslashwholeline);
+	else
+		BEGIN(xslasharg);
+
+	/* And lex. */
+	lexresult = yylex();
+
+	/*
+	 * Check the lex result: we should have gotten back either LEXRES_OK
+	 * or LEXRES_EOL (the latter indicating end of string).  If we were inside
+	 * a quoted string, as indicated by YY_START, EOL is an error.
+	 */
+	psql_assert(lexresult == LEXRES_EOL || lexresult == LEXRES_OK);
+	badarg = false;
+	switch (YY_START)
+	{
+		case xslasharg:
+			/* empty arg, or possibly a psql variable substitution */
+			break;
+		case xslashquote:
+			if (lexresult != LEXRES_OK)
+				badarg = true;		/* hit EOL not ending quote */
+			break;
+		case xslashbackquote:
+			if (lexresult != LEXRES_OK)
+				badarg = true;		/* hit EOL not ending quote */
+			else
+			{
+				/* Perform evaluation of backticked command */
+				char	   *cmd = mybuf.data;
+				FILE	   *fd;
+				bool		error = false;
+				PQExpBufferData output;
+				char		buf[512];
+				size_t		result;
+
+				fd = popen(cmd, PG_BINARY_R);
+				if (!fd)
+				{
+					psql_error("%s: %s\n", cmd, strerror(errno));
+					error = true;
+				}
+
+				initPQExpBuffer(&output);
+
+				if (!error)
+				{
+					do
+					{
+						result = fread(buf, 1, sizeof(buf), fd);
+						if (ferror(fd))
+						{
+							psql_error("%s: %s\n", cmd, strerror(errno));
+							error = true;
+							break;
+						}
+						appendBinaryPQExpBuffer(&output, buf, result);
+					} while (!feof(fd));
+				}
+
+				if (fd && pclose(fd) == -1)
+				{
+					psql_error("%s: %s\n", cmd, strerror(errno));
+					error = true;
+				}
+
+				if (PQExpBufferBroken(&output))
+				{
+					psql_error("%s: out of memory\n", cmd);
+					error = true;
+				}
+
+				/* Now done with cmd, transfer result to mybuf */
+				resetPQExpBuffer(&mybuf);
+
+				if (!error)
+				{
+					/* strip any trailing newline */
+					if (output.len > 0 &&
+						output.data[output.len - 1] == '\n')
+						output.len--;
+					appendBinaryPQExpBuffer(&mybuf, output.data, output.len);
+				}
+
+				termPQExpBuffer(&output);
+			}
+			break;
+		case xslashdefaultarg:
+			/* Strip any trailing semi-colons if requested */
+			if (semicolon)
+			{
+				while (mybuf.len > 0 &&
+					   mybuf.data[mybuf.len - 1] == ';')
+				{
+					mybuf.data[--mybuf.len] = '\0';
+				}
+			}
+
+			/*
+			 * If SQL identifier processing was requested, then we strip out
+			 * excess double quotes and downcase unquoted letters.
+			 * Doubled double-quotes become output double-quotes, per spec.
+			 *
+			 * Note that a string like FOO"BAR"BAZ will be converted to
+			 * fooBARbaz; this is somewhat inconsistent with the SQL spec,
+			 * which would have us parse it as several identifiers.  But
+			 * for psql's purposes, we want a string like "foo"."bar" to
+			 * be treated as one option, so there's little choice.
+			 */
+			if (type == OT_SQLID || type == OT_SQLIDHACK)
+			{
+				bool		inquotes = false;
+				char	   *cp = mybuf.data;
+
+				while (*cp)
+				{
+					if (*cp == '"')
+					{
+						if (inquotes && cp[1] == '"')
+						{
+							/* Keep the first quote, remove the second */
+							cp++;
+						}
+						inquotes = !inquotes;
+						/* Collapse out quote at *cp */
+						memmove(cp, cp + 1, strlen(cp));
+						mybuf.len--;
+						/* do not advance cp */
+					}
+					else
+					{
+						if (!inquotes && type == OT_SQLID)
+							*cp = pg_tolower((unsigned char) *cp);
+						cp += PQmblen(cp, pset.encoding);
+					}
+				}
+			}
+			break;
+		case xslashquotedarg:
+			/* must have hit EOL inside double quotes */
+			badarg = true;
+			break;
+		case xslashwholeline:
+			/* always okay */
+			break;
+		default:
+			/* can't get here */
+			fprintf(stderr, "invalid YY_START\n");
+			exit(1);
+	}
+
+	if (badarg)
+	{
+		psql_error("unterminated quoted string\n");
+		termPQExpBuffer(&mybuf);
+		return NULL;
+	}
+
+	/*
+	 * An unquoted empty argument isn't possible unless we are at end of
+	 * command.  Return NULL instead.
+	 */
+	if (mybuf.len == 0 && *quote == 0)
+	{
+		termPQExpBuffer(&mybuf);
+		return NULL;
+	}
+
+	/* Else return the completed string. */
+	return mybuf.data;
+}
+
+/*
+ * Eat up any unused \\ to complete a backslash command.
+ */
+void
+psql_scan_slash_command_end(PsqlScanState state)
+{
+	int			lexresult;
+
+	/* Must be scanning already */
+	psql_assert(state->scanbufhandle);
+
+	/* Set up static variables that will be used by yylex */
+	cur_state = state;
+	output_buf = NULL;
+
+	if (state->buffer_stack != NULL)
+		yy_switch_to_buffer(state->buffer_stack->buf);
+	else
+		yy_switch_to_buffer(state->scanbufhandle);
+
+	BEGIN(xslashend);
+
+	/* And lex. */
+	lexresult = yylex();
+
+	/* There are no possible errors in this lex state... */
+}
+
+
+/*
+ * Push the given string onto the stack of stuff to scan.
+ *
+ * cur_state must point to the active PsqlScanState.
+ *
+ * NOTE SIDE EFFECT: the new buffer is made the active flex input buffer.
+ */
+static void
+push_new_buffer(const char *newstr)
+{
+	StackElem  *stackelem;
+
+	stackelem = (StackElem *) pg_malloc(sizeof(StackElem));
+	stackelem->buf = prepare_buffer(newstr, strlen(newstr),
+									&stackelem->bufstring);
+	cur_state->curline = stackelem->bufstring;
+	if (cur_state->safe_encoding)
+	{
+		stackelem->origstring = NULL;
+		cur_state->refline = stackelem->bufstring;
+	}
+	else
+	{
+		stackelem->origstring = pg_strdup(newstr);
+		cur_state->refline = stackelem->origstring;
+	}
+	stackelem->next = cur_state->buffer_stack;
+	cur_state->buffer_stack = stackelem;
+}
+
+/*
+ * Set up a flex input buffer to scan the given data.  We always make a
+ * copy of the data.  If working in an unsafe encoding, the copy has
+ * multibyte sequences replaced by FFs to avoid fooling the lexer rules.
+ *
+ * cur_state must point to the active PsqlScanState.
+ *
+ * NOTE SIDE EFFECT: the new buffer is made the active flex input buffer.
+ */
+static YY_BUFFER_STATE
+prepare_buffer(const char *txt, int len, char **txtcopy)
+{
+	char	   *newtxt;
+
+	/* Flex wants two \0 characters after the actual data */
+	newtxt = pg_malloc(len + 2);
+	*txtcopy = newtxt;
+	newtxt[len] = newtxt[len + 1] = YY_END_OF_BUFFER_CHAR;
+
+	if (cur_state->safe_encoding)
+		memcpy(newtxt, txt, len);
+	else
+	{
+		/* Gotta do it the hard way */
+		int		i = 0;
+
+		while (i < len)
+		{
+			int		thislen = PQmblen(txt + i, cur_state->encoding);
+
+			/* first byte should always be okay... */
+			newtxt[i] = txt[i];
+			i++;
+			while (--thislen > 0)
+				newtxt[i++] = (char) 0xFF;
+		}
+	}
+
+	return yy_scan_buffer(newtxt, len + 2);
+}
+
+/*
+ * emit() --- body for ECHO macro
+ *
+ * NB: this must be used for ALL and ONLY the text copied from the flex
+ * input data.  If you pass it something that is not part of the yytext
+ * string, you are making a mistake.  Internally generated text can be
+ * appended directly to output_buf.
+ */
+static void
+emit(const char *txt, int len)
+{
+	if (cur_state->safe_encoding)
+		appendBinaryPQExpBuffer(output_buf, txt, len);
+	else
+	{
+		/* Gotta do it the hard way */
+		const char *reference = cur_state->refline;
+		int		i;
+
+		reference += (txt - cur_state->curline);
+
+		for (i = 0; i < len; i++)
+		{
+			char	ch = txt[i];
+
+			if (ch == (char) 0xFF)
+				ch = reference[i];
+			appendPQExpBufferChar(output_buf, ch);
+		}
+	}
+}
+
+static bool
+is_utf16_surrogate_first(uint32 c)
+{
+	return (c >= 0xD800 && c <= 0xDBFF);
+}
+
+static void
+escape_variable(bool as_ident)
+{
+	char		saved_char;
+	const char *value;
+
+	/* Variable lookup. */
+	saved_char = yytext[yyleng - 1];
+	yytext[yyleng - 1] = '\0';
+	value = GetVariable(pset.vars, yytext + 2);
+
+	/* Escaping. */
+	if (value)
+	{
+		if (!pset.db)
+			psql_error("can't escape without active connection\n");
+		else
+		{
+			char   *escaped_value;
+
+			if (as_ident)
+				escaped_value =
+					PQescapeIdentifier(pset.db, value, strlen(value));
+			else
+				escaped_value =
+					PQescapeLiteral(pset.db, value, strlen(value));
+			if (escaped_value == NULL)
+			{
+				const char *error = PQerrorMessage(pset.db);
+				psql_error("%s", error);
+			}
+			else
+			{
+				appendPQExpBufferStr(output_buf, escaped_value);
+				PQfreemem(escaped_value);
+				return;
+			}
+		}
+	}
+
+	/*
+	 * If we reach this point, some kind of error has occurred.  Emit the
+	 * original text into the output buffer.
+	 */
+	yytext[yyleng - 1] = saved_char;
+	emit(yytext, yyleng);
+}
@@ -0,0 +1 @@
+../../../src/backend/parser/kwlookup.c
\ No newline at end of file
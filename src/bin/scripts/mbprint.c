@@ -0,0 +1 @@
+../../../src/bin/psql/mbprint.c
\ No newline at end of file
@@ -62,6 +62,15 @@ extern Relation try_heap_openrv(const RangeVar *relation, LOCKMODE lockmode);
 /* struct definition appears in relscan.h */
 typedef struct HeapScanDescData *HeapScanDesc;
 
+/*
+ * A page filter for heap_setpagefilter.  It gets a pinned (but unlocked)
+ * page and the number of visible tuples whose offsets heapgetpage stored in
+ * scan->rs_vistuples, and must compact that array in place to the tuples it
+ * wants to keep, returning the new count.
+ */
+typedef int (*HeapPageFilterFunc) (HeapScanDesc scan, Page page,
+											   int ntuples, void *arg);
+
 /*
  * HeapScanIsValid
  *		True iff the heap scan is valid.
@@ -76,6 +85,8 @@ extern HeapScanDesc heap_beginscan_strat(Relation relation, Snapshot snapshot,
 extern HeapScanDesc heap_beginscan_bm(Relation relation, Snapshot snapshot,
 				  int nkeys, ScanKey key);
 extern void heap_rescan(HeapScanDesc scan, ScanKey key);
+extern bool heap_setpagefilter(HeapScanDesc scan,
+				   HeapPageFilterFunc filter, void *arg);
 extern void heap_endscan(HeapScanDesc scan);
 extern HeapTuple heap_getnext(HeapScanDesc scan, ScanDirection direction);
 
@@ -110,6 +121,7 @@ extern HTSU_Result heap_lock_tuple(Relation relation, HeapTuple tuple,
 extern void heap_inplace_update(Relation relation, HeapTuple tuple);
 extern bool heap_freeze_tuple(HeapTupleHeader tuple, TransactionId cutoff_xid,
 				  Buffer buf);
+extern bool heap_tuple_is_frozen(HeapTupleHeader tuple);
 
 extern Oid	simple_heap_insert(Relation relation, HeapTuple tup);
 extern void simple_heap_delete(Relation relation, ItemPointer tid);
@@ -136,6 +148,8 @@ extern XLogRecPtr log_heap_clean(Relation reln, Buffer buffer,
 extern XLogRecPtr log_heap_freeze(Relation reln, Buffer buffer,
 				TransactionId cutoff_xid,
 				OffsetNumber *offsets, int offcnt);
+extern XLogRecPtr log_heap_visible(RelFileNode rnode, BlockNumber block,
+				 Buffer vm_buffer, TransactionId cutoff_xid, uint8 flags);
 extern XLogRecPtr log_newpage(RelFileNode *rnode, ForkNumber forkNum,
 			BlockNumber blk, Page page);
 
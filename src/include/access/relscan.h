@@ -16,6 +16,7 @@
 
 #include "access/genam.h"
 #include "access/heapam.h"
+#include "access/itup.h"
 
 
 typedef struct HeapScanDescData
@@ -29,6 +30,8 @@ typedef struct HeapScanDescData
 	bool		rs_pageatatime; /* verify visibility page-at-a-time? */
 	bool		rs_allow_strat; /* allow or disallow use of access strategy */
 	bool		rs_allow_sync;	/* allow or disallow use of syncscan */
+	HeapPageFilterFunc rs_pagefilter;	/* applied to each page, or NULL */
+	void	   *rs_pagefilter_arg;	/* passthrough argument for filter */
 
 	/* state set up at initscan time */
 	BlockNumber rs_nblocks;		/* number of blocks to scan */
@@ -71,6 +74,9 @@ typedef struct IndexScanDescData
 	bool		xactStartedInRecovery;	/* prevents killing/seeing killed
 										 * tuples */
 
+	/* index-only scans: set by caller before the first amgettuple call */
+	bool		xs_want_itup;	/* caller requests index tuples */
+
 	/* index access method's private state */
 	void	   *opaque;			/* access-method-specific info */
 
@@ -80,6 +86,9 @@ typedef struct IndexScanDescData
 	/* NB: if xs_cbuf is not InvalidBuffer, we hold a pin on that buffer */
 	bool		xs_recheck;		/* T means scan keys must be rechecked */
 
+	/* in an index-only scan, this is valid after a successful amgettuple */
+	IndexTuple	xs_itup;		/* index tuple returned by AM */
+
 	/* state data for traversing HOT chains in index_getnext */
 	bool		xs_hot_dead;	/* T if all members of HOT chain are dead */
 	OffsetNumber xs_next_hot;	/* next member of HOT chain, if any */
@@ -65,6 +65,10 @@ typedef struct tupleConstr
  * context and go away when the context is freed.  We set the tdrefcount
  * field of such a descriptor to -1, while reference-counted descriptors
  * always have tdrefcount >= 0.
+ *
+ * tddeformoff is space for per-attribute offsets computed by
+ * slot_deform_tuple the first time it needs them (when tddeformvalid is
+ * false); see heaptuple.c.
  */
 typedef struct tupleDesc
 {
@@ -76,6 +80,8 @@ typedef struct tupleDesc
 	int32		tdtypmod;		/* typmod for tuple type */
 	bool		tdhasoid;		/* tuple has oid attribute in its header */
 	int			tdrefcount;		/* reference count, or -1 if not counting */
+	bool		tddeformvalid;	/* tddeformoff has been filled in */
+	int		   *tddeformoff;	/* offsets within fixed-width runs */
 }	*TupleDesc;
 
 
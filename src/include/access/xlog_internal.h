@@ -71,7 +71,7 @@ typedef struct XLogContRecord
 /*
  * Each page of XLOG file has a header like this:
  */
-#define XLOG_PAGE_MAGIC 0x9003	/* can be used as WAL version indicator */
+#define XLOG_PAGE_MAGIC 0x9004	/* can be used as WAL version indicator */
 
 typedef struct XLogPageHeaderData
 {
@@ -709,6 +709,19 @@ typedef NameData *Name;
 #define STATUS_FOUND			(1)
 #define STATUS_WAITING			(2)
 
+/*
+ * pg_prefetch_mem
+ *		hint the CPU to start pulling the cache line at addr into cache
+ *
+ * This is only a hint: it never faults, and is a no-op on compilers that
+ * don't provide a way to issue one.
+ */
+#if defined(__GNUC__) || defined(__INTEL_COMPILER)
+#define pg_prefetch_mem(addr)	__builtin_prefetch((addr))
+#else
+#define pg_prefetch_mem(addr)	((void) 0)
+#endif
+
 
 /* gettext domain name mangling */
 
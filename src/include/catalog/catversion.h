@@ -53,6 +53,6 @@
  */
 
 /*							yyyymmddN */
-#define CATALOG_VERSION_NO	201002161
+#define CATALOG_VERSION_NO	201002164
 
 #endif
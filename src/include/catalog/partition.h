@@ -0,0 +1,86 @@
+/*-------------------------------------------------------------------------
+ *
+ * partition.h
+ *	  Partition bounds of inheritance children, for tuple routing and
+ *	  partition pruning.
+ *
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef PARTITION_H
+#define PARTITION_H
+
+#include "fmgr.h"
+#include "nodes/bitmapset.h"
+#include "nodes/pg_list.h"
+#include "nodes/primnodes.h"
+#include "storage/lock.h"
+#include "utils/relcache.h"
+
+/* Partitioning strategies */
+#define PARTITION_STRATEGY_RANGE	'r'
+#define PARTITION_STRATEGY_LIST		'l'
+
+/*
+ * PartitionDescData describes how the rows of a partitioned parent are
+ * divided among its direct inheritance children.
+ *
+ * A range partition holds the key values between its lower and upper
+ * bounds, each of which may be inclusive or exclusive; either end may be
+ * unbounded.  Range partitions are kept sorted by lower bound, inclusive
+ * before exclusive, and never overlap.  For list partitioning, each distinct key value that some child
+ * accepts appears once in the sorted "values" array, together with the
+ * index of that child.
+ */
+typedef struct PartitionDescData
+{
+	Oid			parentrelid;	/* OID of the partitioned parent */
+	AttrNumber	keyattno;		/* key column's attnum in the parent */
+	Oid			keytype;		/* type the bounds are stored as */
+	Oid			opfamily;		/* btree opfamily ordering the key */
+	int16		keytyplen;
+	bool		keytypbyval;
+	FmgrInfo	cmpfn;			/* btree comparison proc for keytype */
+	char		strategy;		/* PARTITION_STRATEGY_xxx */
+	int			nparts;			/* number of partitions */
+	Oid		   *oids;			/* partition OIDs, in bound order */
+
+	/* range partitioning */
+	Datum	   *lower;			/* lower bounds */
+	bool	   *lower_incl;		/* lower bound inclusive (>=)? */
+	bool	   *lower_inf;		/* lower bound absent? */
+	Datum	   *upper;			/* upper bounds */
+	bool	   *upper_incl;		/* upper bound inclusive (<=)? */
+	bool	   *upper_inf;		/* upper bound absent? */
+
+	/* list partitioning */
+	int			nvalues;		/* number of accepted values */
+	Datum	   *values;			/* accepted values, sorted */
+	int		   *valueparts;		/* partition index of each value */
+
+	/* lookup by OID */
+	Oid		   *sorted_oids;
+	int		   *sorted_parts;
+} PartitionDescData;
+
+typedef PartitionDescData *PartitionDesc;
+
+extern PartitionDesc RelationBuildPartitionDesc(Relation parent,
+						   LOCKMODE lockmode, bool complain);
+extern int	partition_find_for_value(PartitionDesc pd, Datum value,
+						 bool isnull);
+extern int	partition_index_for_oid(PartitionDesc pd, Oid relid);
+extern Bitmapset *partition_prune_by_clauses(PartitionDesc pd,
+						   List *clauses, Index varno);
+extern bool partition_match_runtime_clause(PartitionDesc pd, Node *clause,
+							   Index varno, int *strategy, Expr **valexpr);
+extern Bitmapset *partition_prune_by_values(PartitionDesc pd, int nconds,
+						  const int *strategies,
+						  const Datum *values, const bool *isnulls);
+
+#endif   /* PARTITION_H */
@@ -0,0 +1 @@
+../../src/backend/port/dynloader/linux.h
\ No newline at end of file
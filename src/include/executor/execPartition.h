@@ -0,0 +1,30 @@
+/*-------------------------------------------------------------------------
+ *
+ * execPartition.h
+ *	  routing of inserted tuples to the partitions of a partitioned table
+ *
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef EXECPARTITION_H
+#define EXECPARTITION_H
+
+#include "access/heapam.h"
+#include "nodes/execnodes.h"
+
+extern void ExecSetupPartitionRouting(ResultRelInfo *rootinfo,
+						  EState *estate, bool bulk_insert);
+extern ResultRelInfo *ExecRouteTuple(ResultRelInfo *rootinfo,
+			   TupleTableSlot **slotp, HeapTuple *tuplep,
+			   EState *estate, BulkInsertState *bistatep);
+extern TupleTableSlot *ExecRoutedTupleToParent(ResultRelInfo *rootinfo,
+						TupleTableSlot *slot, HeapTuple tuple,
+						EState *estate);
+extern void ExecCleanupPartitionRouting(ResultRelInfo *rootinfo);
+
+#endif   /* EXECPARTITION_H */
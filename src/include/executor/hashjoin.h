@@ -72,6 +72,62 @@ typedef struct HashJoinTupleData
 #define HJTUPLE_MINTUPLE(hjtup)  \
 	((MinimalTuple) ((char *) (hjtup) + HJTUPLE_OVERHEAD))
 
+/*
+ * Each bucket of the main hash table keeps, next to the head of its tuple
+ * chain, a 32-bit summary of the hash values found in the chain: one bit,
+ * chosen by HJ_HASH_TAG, per tuple.  A probe whose bit is not set can give
+ * up on the bucket without touching any of its tuples, which matters once
+ * the tuples are no longer in cache.  The bits are taken from a multiplied
+ * hash value because the low-order bits are the same for every tuple in a
+ * bucket, and the next ones up select the batch.
+ */
+typedef struct HashJoinBucketData
+{
+	struct HashJoinTupleData *tuples;	/* chain of tuples in this bucket */
+	uint32		hashtags;		/* OR of HJ_HASH_TAG() of the chain's tuples */
+} HashJoinBucketData;
+
+#define HJ_HASH_TAG(hashvalue)	\
+	((uint32) 1 << (((uint32) (hashvalue) * 0x9E3779B1U) >> 27))
+
+/*
+ * Tuples in the main hash table are not palloc'd one by one, but packed
+ * MAXALIGN'd one after another into large chunks, saving both the palloc
+ * overhead per tuple and the time to allocate and free them.  It also lets
+ * ExecHashIncreaseNumBatches walk the tuples in memory order, repacking the
+ * ones it keeps, rather than chasing bucket chains around the heap.  Tuples
+ * bigger than HASH_CHUNK_THRESHOLD get a chunk of their own, so as not to
+ * waste the rest of a regular chunk.  (Skew-table tuples are still palloc'd
+ * individually, since they may be freed one bucket at a time.)
+ */
+typedef struct HashMemoryChunkData
+{
+	int			ntuples;		/* number of tuples stored in this chunk */
+	Size		maxlen;			/* size of the buffer holding the tuples */
+	Size		used;			/* number of buffer bytes already used */
+	struct HashMemoryChunkData *next;	/* pointer to the next chunk (linked
+										 * list) */
+	char		data[1];		/* buffer allocated at the end */
+} HashMemoryChunkData;
+
+typedef struct HashMemoryChunkData *HashMemoryChunk;
+
+#define HASH_CHUNK_SIZE			(32 * 1024L)
+#define HASH_CHUNK_THRESHOLD	(HASH_CHUNK_SIZE / 4)
+
+/*
+ * Once the table outgrows the CPU caches, linking each new tuple into its
+ * bucket costs a cache miss on the bucket header.  So tuples being loaded
+ * into the table are copied into chunk storage right away, but linked into
+ * their buckets HASH_LINK_BATCH at a time: the bucket headers are prefetched
+ * as tuples are queued, and the misses overlap rather than being taken one
+ * after another.  Anything that reads the buckets must first make sure the
+ * queue has been flushed by ExecHashTableLinkPending.  Probing works the
+ * same way on a smaller scale: ExecScanHashBucket prefetches the next tuple
+ * of the chain before it evaluates the join quals on the current one.
+ */
+#define HASH_LINK_BATCH			16
+
 /*
  * If the outer relation's distribution is sufficiently nonuniform, we attempt
  * to optimize the join by treating the hash values corresponding to the outer
@@ -102,14 +158,31 @@ typedef struct HashSkewBucket
 #define SKEW_WORK_MEM_PERCENT  2
 #define SKEW_MIN_OUTER_FRACTION  0.01
 
+/*
+ * For joins that may discard outer tuples without a match (that is, not
+ * LEFT or ANTI joins), we also build a small Bloom filter over the hash
+ * values of all inner tuples, across all batches.  During the first pass
+ * over the outer relation, a tuple whose hash value is not in the filter
+ * cannot join with anything, so it is dropped before we probe the buckets
+ * or, more importantly, before it is written into an outer batch file.
+ * The filter is sized from the planner's estimate of the inner relation,
+ * and is thrown away if it ends up too full to be useful, or if it fails
+ * to reject a worthwhile fraction of the first outer tuples checked.
+ */
+#define BLOOM_BITS_PER_TUPLE	8
+#define BLOOM_MIN_BITS			8192
+#define BLOOM_NUM_HASHES		3
+#define BLOOM_CHECK_PROBES		1024	/* when to judge the filter's value */
+#define BLOOM_MIN_REJECT_FRACTION	0.05
+
 
 typedef struct HashJoinTableData
 {
 	int			nbuckets;		/* # buckets in the in-memory hash table */
 	int			log2_nbuckets;	/* its log2 (nbuckets must be a power of 2) */
 
-	/* buckets[i] is head of list of tuples in i'th in-memory bucket */
-	struct HashJoinTupleData **buckets;
+	/* buckets[i] heads the list of tuples in i'th in-memory bucket */
+	HashJoinBucketData *buckets;
 	/* buckets array is per-batch storage, as are all the tuples */
 
 	bool		skewEnabled;	/* are we using skew optimization? */
@@ -155,6 +228,20 @@ typedef struct HashJoinTableData
 
 	MemoryContext hashCxt;		/* context for whole-hash-join storage */
 	MemoryContext batchCxt;		/* context for this-batch-only storage */
+
+	/* used for dense allocation of tuples (into linked chunks) */
+	HashMemoryChunk chunks;		/* one list for the whole batch */
+
+	/* tuples stored in chunks but not yet linked into their buckets */
+	int			nPending;		/* number of valid entries below */
+	int			pendingBucket[HASH_LINK_BATCH];
+	struct HashJoinTupleData *pendingTuple[HASH_LINK_BATCH];
+
+	/* Bloom filter over inner hash values, or NULL if not in use */
+	uint32	   *bloomFilter;	/* allocated in hashCxt */
+	uint32		bloomMask;		/* # bits in filter (a power of 2!) - 1 */
+	long		bloomProbes;	/* # outer tuples checked against filter */
+	long		bloomRejects;	/* # of those that the filter rejected */
 } HashJoinTableData;
 
 #endif   /* HASHJOIN_H */
@@ -24,9 +24,12 @@ extern void ExecReScanHash(HashState *node, ExprContext *exprCtxt);
 
 extern HashJoinTable ExecHashTableCreate(Hash *node, List *hashOperators);
 extern void ExecHashTableDestroy(HashJoinTable hashtable);
+extern void ExecHashTableInitBloom(HashJoinTable hashtable, double ntuples);
+extern bool ExecHashBloomCheck(HashJoinTable hashtable, uint32 hashvalue);
 extern void ExecHashTableInsert(HashJoinTable hashtable,
 					TupleTableSlot *slot,
 					uint32 hashvalue);
+extern void ExecHashTableLinkPending(HashJoinTable hashtable);
 extern bool ExecHashGetHashValue(HashJoinTable hashtable,
 					 ExprContext *econtext,
 					 List *hashkeys,
@@ -0,0 +1,34 @@
+/*-------------------------------------------------------------------------
+ *
+ * nodeIncrementalSort.h
+ *
+ *
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef NODEINCREMENTALSORT_H
+#define NODEINCREMENTALSORT_H
+
+#include "nodes/execnodes.h"
+
+/*
+ * Smallest batch we sort at once.  Consecutive presorted-key groups are
+ * merged into one batch until it reaches this size, since sorting each
+ * tiny group separately would be dominated by tuplesort setup costs.
+ * The planner's costing assumes the same value.
+ */
+#define INCSORT_MIN_GROUP	32
+
+extern IncrementalSortState *ExecInitIncrementalSort(IncrementalSort *node,
+						EState *estate, int eflags);
+extern TupleTableSlot *ExecIncrementalSort(IncrementalSortState *node);
+extern void ExecEndIncrementalSort(IncrementalSortState *node);
+extern void ExecReScanIncrementalSort(IncrementalSortState *node,
+						  ExprContext *exprCtxt);
+
+#endif   /* NODEINCREMENTALSORT_H */
@@ -305,6 +305,7 @@ typedef struct JunkFilter
  *		ConstraintExprs			array of constraint-checking expr states
  *		junkFilter				for removing junk attributes from tuples
  *		projectReturning		for computing a RETURNING list
+ *		PartitionDispatch		for routing inserted tuples to partitions
  * ----------------
  */
 typedef struct ResultRelInfo
@@ -322,6 +323,7 @@ typedef struct ResultRelInfo
 	List	  **ri_ConstraintExprs;
 	JunkFilter *ri_junkFilter;
 	ProjectionInfo *ri_projectReturning;
+	struct PartitionDispatchData *ri_PartitionDispatch;
 } ResultRelInfo;
 
 /* ----------------
@@ -586,6 +588,27 @@ typedef struct ArrayRefExprState
 	char		refelemalign;	/* typalign of the element type */
 } ArrayRefExprState;
 
+/*
+ * FuncArgStep describes how to fetch one argument of a function whose
+ * arguments are all plain Vars or Consts, without going through the
+ * argument's ExprState.
+ */
+typedef enum FuncArgStepKind
+{
+	FUNCARG_CONST,				/* constant value */
+	FUNCARG_SCAN_VAR,			/* user column of ecxt_scantuple */
+	FUNCARG_INNER_VAR,			/* user column of ecxt_innertuple */
+	FUNCARG_OUTER_VAR			/* user column of ecxt_outertuple */
+} FuncArgStepKind;
+
+typedef struct FuncArgStep
+{
+	FuncArgStepKind kind;
+	AttrNumber	attnum;			/* column number, for the Var kinds */
+	bool		constisnull;	/* value, for FUNCARG_CONST */
+	Datum		constvalue;
+} FuncArgStep;
+
 /* ----------------
  *		FuncExprState node
  *
@@ -653,6 +676,16 @@ typedef struct FuncExprState
 	 * only if setArgsValid is true.
 	 */
 	FunctionCallInfoData setArgs;
+
+	/*
+	 * If no argument is a set and every argument turned out to be a plain
+	 * user-column Var or a Const, the arguments are flattened into this array
+	 * of nargSteps steps, which ExecMakeFunctionResultSimple runs in a single
+	 * loop in place of a recursive ExecEvalExpr call per argument.  NULL if
+	 * not applicable.
+	 */
+	FuncArgStep *argSteps;
+	int			nargSteps;
 } FuncExprState;
 
 /* ----------------
@@ -1038,6 +1071,15 @@ typedef struct ModifyTableState
  *
  *		nplans			how many plans are in the array
  *		whichplan		which plan is being executed (0 .. n-1)
+ *		pruned			per plan, true if it's skipped in the current scan;
+ *						NULL if there's no run-time partition pruning
+ *		partdesc		bounds of the partitions, for pruning
+ *		partindexes		per plan, its partition's index in partdesc, or -1
+ *		pruneexprs		ExprStates computing the pruning values
+ *		prunePending	must we compute "pruned" before the next fetch?
+ *
+ * Plans pruned at executor startup are never initialized; their entries
+ * in appendplans are NULL.
  * ----------------
  */
 typedef struct AppendState
@@ -1046,8 +1088,40 @@ typedef struct AppendState
 	PlanState **appendplans;	/* array of PlanStates for my inputs */
 	int			as_nplans;
 	int			as_whichplan;
+	bool	   *as_pruned;
+	struct PartitionDescData *as_partdesc;
+	int		   *as_partindexes;
+	List	   *as_pruneexprs;
+	bool		as_prunePending;
 } AppendState;
 
+/* ----------------
+ *	 MergeAppendState information
+ *
+ *		nplans			how many plans are in the array
+ *		nkeys			number of sort key columns
+ *		sortfuncs		sort function lookup info for each key
+ *		sortflags		DESC and NULLS FIRST flags for each key
+ *		slots			current output tuple of each subplan
+ *		heap			heap of active tuples (represented as array indexes)
+ *		heap_size		number of active heap entries
+ *		initialized		true if we have fetched first tuple from each subplan
+ * ----------------
+ */
+typedef struct MergeAppendState
+{
+	PlanState	ps;				/* its first field is NodeTag */
+	PlanState **mergeplans;		/* array of PlanStates for my inputs */
+	int			ms_nplans;
+	int			ms_nkeys;
+	FmgrInfo   *ms_sortfuncs;	/* array of length ms_nkeys */
+	int		   *ms_sortflags;	/* array of length ms_nkeys */
+	TupleTableSlot **ms_slots;	/* array of length ms_nplans */
+	int		   *ms_heap;		/* array of length ms_nplans */
+	int			ms_heap_size;	/* current active length of ms_heap[] */
+	bool		ms_initialized; /* are subplans started? */
+} MergeAppendState;
+
 /* ----------------
  *	 RecursiveUnionState information
  *
@@ -1124,10 +1198,40 @@ typedef struct ScanState
 } ScanState;
 
 /*
- * SeqScan uses a bare ScanState as its state node, since it needs
- * no additional fields.
+ * SeqScanBatchQual describes a "Var op Const" qual on a fixed-width
+ * integer-like column, which a SeqScan checks against a whole page of
+ * tuples at a time instead of through ExecQual.  The column's value and the
+ * constant are compared as int64s; cmpmask has bit 0, 1, or 2 set if the
+ * qual accepts a value that is less than, equal to, or greater than the
+ * constant, respectively.  attoff is the column's offset from t_hoff in
+ * tuples without nulls, or -1 if that depends on a varlena column.
+ */
+typedef struct SeqScanBatchQual
+{
+	AttrNumber	attno;			/* column to test */
+	Oid			typid;			/* its datatype */
+	int16		attlen;			/* its typlen */
+	bool		attbyval;		/* its typbyval */
+	int			attoff;			/* its fixed offset, or -1 */
+	int			cmpmask;		/* accepted comparison outcomes */
+	int64		value;			/* constant to compare against */
+} SeqScanBatchQual;
+
+/* ----------------
+ *	 SeqScanState information
+ *
+ *		BatchQuals		   quals checked by the heap page filter
+ *		NumBatchQuals	   number of BatchQuals
+ *		BatchQualOrig	   execution state for the same quals, for rechecks
+ * ----------------
  */
-typedef ScanState SeqScanState;
+typedef struct SeqScanState
+{
+	ScanState	ss;				/* its first field is NodeTag */
+	SeqScanBatchQual *ss_BatchQuals;
+	int			ss_NumBatchQuals;
+	List	   *ss_BatchQualOrig;
+} SeqScanState;
 
 /*
  * These structs store information about index quals that don't have simple
@@ -1163,6 +1267,9 @@ typedef struct
  *		RuntimeContext	   expr context for evaling runtime Skeys
  *		RelationDesc	   index relation descriptor
  *		ScanDesc		   index scan descriptor
+ *		IndexOnly		   true if heap fetches may be skipped
+ *		VMBuffer		   buffer in use for visibility map testing, if any
+ *		HeapFetches		   number of tuples we were forced to fetch from heap
  * ----------------
  */
 typedef struct IndexScanState
@@ -1177,6 +1284,9 @@ typedef struct IndexScanState
 	ExprContext *iss_RuntimeContext;
 	Relation	iss_RelationDesc;
 	IndexScanDesc iss_ScanDesc;
+	bool		iss_IndexOnly;
+	Buffer		iss_VMBuffer;
+	long		iss_HeapFetches;
 } IndexScanState;
 
 /* ----------------
@@ -1507,6 +1617,42 @@ typedef struct MaterialState
 	Tuplestorestate *tuplestorestate;
 } MaterialState;
 
+/* ----------------
+ *	 MemoizeState information
+ *
+ *		Memoize nodes keep the rows their subplan returned for each set of
+ *		cache key values seen, as long as work_mem allows.  The entries are
+ *		kept in a TupleHashTable; an LRU list decides which to throw away
+ *		when memory runs short.  The entry layout is private to
+ *		nodeMemoize.c.
+ * ----------------
+ */
+typedef struct MemoizeEntryData *MemoizeEntry;
+
+typedef struct MemoizeState
+{
+	PlanState	ps;				/* its first field is NodeTag */
+	List	   *paramExprs;		/* ExprStates for the cache key */
+	int			mstatus;		/* what the current scan is doing */
+	TupleTableSlot *probeslot;	/* holds the current cache key */
+	TupleTableSlot *evictslot;	/* holds the key of an entry being dropped */
+	AttrNumber *keyColIdx;		/* key columns of the above, ie 1..n */
+	FmgrInfo   *eqfunctions;	/* per-key equality fns */
+	FmgrInfo   *hashfunctions;	/* per-key hashing fns */
+	TupleHashTable hashtable;	/* cache entries, by key */
+	struct Dllist *lru;			/* entries, most recently used first */
+	MemoryContext tableContext; /* holds the hashtable and cached tuples */
+	MemoryContext tempContext;	/* short-term context for comparisons */
+	Size		memUsed;		/* memory charged to cached entries */
+	Size		memLimit;		/* ... and the most we allow */
+	MemoizeEntry entry;			/* entry being returned or filled */
+	ListCell   *nextTuple;		/* next cached tuple to return */
+	long		hits;			/* rescans answered from the cache */
+	long		misses;			/* rescans that ran the subplan */
+	long		evictions;		/* entries dropped to make room */
+	long		overflows;		/* scans too big to cache at all */
+} MemoizeState;
+
 /* ----------------
  *	 SortState information
  * ----------------
@@ -1523,6 +1669,31 @@ typedef struct SortState
 	void	   *tuplesortstate; /* private state of tuplesort.c */
 } SortState;
 
+/* ----------------
+ *	 IncrementalSortState information
+ *
+ *	The input arrives sorted on the presorted key columns, so we collect one
+ *	batch of tuples at a time, sort it on all the keys and emit it before
+ *	reading more.  A batch always ends on a presorted-key group boundary;
+ *	it holds at least a minimum number of tuples so that tiny groups don't
+ *	each pay the tuplesort startup cost.
+ * ----------------
+ */
+typedef struct IncrementalSortState
+{
+	ScanState	ss;				/* its first field is NodeTag */
+	bool		bounded;		/* is the result set bounded? */
+	int64		bound;			/* if bounded, how many tuples are needed */
+	int64		bound_Done;		/* tuples already returned toward bound */
+	bool		outerDone;		/* reached end of input? */
+	bool		batchReady;		/* batch sorted and being returned? */
+	FmgrInfo   *eqfunctions;	/* equality fns for the presorted keys */
+	TupleTableSlot *groupPivot; /* first tuple of current presorted group */
+	TupleTableSlot *lookahead;	/* first tuple of the next batch, if any */
+	MemoryContext tempContext;	/* short-term context for comparisons */
+	void	   *tuplesortstate; /* private state of tuplesort.c */
+} IncrementalSortState;
+
 /* ---------------------
  *	GroupState information
  * -------------------------
@@ -1570,6 +1741,14 @@ typedef struct AggState
 	List	   *hash_needed;	/* list of columns needed in hash table */
 	bool		table_filled;	/* hash table filled yet? */
 	TupleHashIterator hashiter; /* for iterating through hash table */
+	Size		hash_mem;		/* estimated space used by hash table */
+	Size		hash_entry_space;	/* estimated space per group, less tuple */
+	bool		hash_spill_mode;	/* table full: spill tuples of new groups */
+	bool		hash_spilled;	/* have we spilled since last rescan? */
+	int			hash_depth;		/* spill depth of the input being loaded */
+	struct BufFile **hash_spill_files;	/* partitions written by this pass */
+	List	   *hash_batches;	/* spilled batches not yet processed */
+	TupleTableSlot *hash_batchslot;		/* slot for reading spilled tuples */
 } AggState;
 
 /* ----------------
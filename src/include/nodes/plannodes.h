@@ -174,14 +174,43 @@ typedef struct ModifyTable
 /* ----------------
  *	 Append node -
  *		Generate the concatenation of the results of sub-plans.
+ *
+ * If the Append scans the partitions of a partitioned table, and there are
+ * quals comparing the partition key with values that are only known at run
+ * time, the executor skips the subplans of partitions that can't match.
+ * partrelid is then the partitioned table's OID, and each pruning qual is
+ * "key <op> expr", represented by the btree strategy of <op> in
+ * partprunestrategies and by expr, already converted to the key type, in
+ * partpruneexprs.  partoids gives the relation scanned by each subplan;
+ * only subplans scanning a partition of partrelid are ever skipped.
  * ----------------
  */
 typedef struct Append
 {
 	Plan		plan;
 	List	   *appendplans;
+	Oid			partrelid;		/* partitioned table, or InvalidOid */
+	List	   *partprunestrategies;	/* integer list of btree strategies */
+	List	   *partpruneexprs; /* values to compare the key with */
+	List	   *partoids;		/* OID list, one per subplan */
 } Append;
 
+/* ----------------
+ *	 MergeAppend node -
+ *		Merge the results of pre-sorted sub-plans to preserve the ordering.
+ * ----------------
+ */
+typedef struct MergeAppend
+{
+	Plan		plan;
+	List	   *mergeplans;
+	/* remaining fields are just like the sort-key info in struct Sort */
+	int			numCols;		/* number of sort-key columns */
+	AttrNumber *sortColIdx;		/* their indexes in the target list */
+	Oid		   *sortOperators;	/* OIDs of operators to sort them by */
+	bool	   *nullsFirst;		/* NULLS FIRST/LAST directions */
+} MergeAppend;
+
 /* ----------------
  *	RecursiveUnion node -
  *		Generate a recursive union of two subplans.
@@ -264,6 +293,10 @@ typedef Scan SeqScan;
  * table).	This is a bit hokey ... would be cleaner to use a special-purpose
  * node type that could not be mistaken for a regular Var.	But it will do
  * for now.
+ *
+ * If indexonly is true, every column the plan needs from the base table is
+ * available from the index, and the executor can avoid visiting the heap for
+ * tuples on pages that the visibility map says are all-visible.
  * ----------------
  */
 typedef struct IndexScan
@@ -273,6 +306,7 @@ typedef struct IndexScan
 	List	   *indexqual;		/* list of index quals (OpExprs) */
 	List	   *indexqualorig;	/* the same in original form */
 	ScanDirection indexorderdir;	/* forward or backward or don't care */
+	bool		indexonly;		/* attempt to skip heap fetches? */
 } IndexScan;
 
 /* ----------------
@@ -479,6 +513,25 @@ typedef struct Material
 	Plan		plan;
 } Material;
 
+/* ----------------
+ *		memoize node
+ *
+ * Caches the rows returned by its subplan, the parameterized inner side of
+ * a nestloop, keyed on the values of paramExprs.  Those refer to the
+ * nestloop's outer tuple; a rescan with key values seen before returns the
+ * cached rows instead of running the subplan again.  A key whose entry in
+ * hashOperators is InvalidOid is compared by datumIsEqual instead.
+ * ----------------
+ */
+typedef struct Memoize
+{
+	Plan		plan;
+	int			numKeys;		/* number of cache key expressions */
+	Oid		   *hashOperators;	/* equality operators for the keys */
+	List	   *paramExprs;		/* cache key expressions */
+	long		estEntries;		/* estimated number of cache entries */
+} Memoize;
+
 /* ----------------
  *		sort node
  * ----------------
@@ -492,6 +545,19 @@ typedef struct Sort
 	bool	   *nullsFirst;		/* NULLS FIRST/LAST directions */
 } Sort;
 
+/* ----------------
+ *		incremental sort node
+ *
+ * The input is already sorted on the first presortedCols sort keys, so
+ * only each group of tuples sharing those keys needs sorting.
+ * ----------------
+ */
+typedef struct IncrementalSort
+{
+	Sort		sort;
+	int			presortedCols;	/* number of leading keys already sorted */
+} IncrementalSort;
+
 /* ---------------
  *	 group node -
  *		Used for queries with GROUP BY (but no aggregates) specified.
@@ -299,9 +299,12 @@ typedef struct PlannerInfo
  *					(always NIL if it's not a table)
  *		pages - number of disk pages in relation (zero if not a table)
  *		tuples - number of tuples in relation (not considering restrictions)
+ *		allvisfrac - fraction of disk pages that are marked all-visible
  *		subplan - plan for subquery (NULL if it's not a subquery)
  *		subrtable - rangetable for subquery (NIL if it's not a subquery)
  *		subrowmark - rowmarks for subquery (NIL if it's not a subquery)
+ *		partdesc - partition bounds, if the rel is a partitioned table
+ *				   with inheritance children (else NULL)
  *
  *		Note: for a subquery, tuples and subplan are not set immediately
  *		upon creation of the RelOptInfo object; they are filled in when
@@ -385,9 +388,11 @@ typedef struct RelOptInfo
 	List	   *indexlist;		/* list of IndexOptInfo */
 	BlockNumber pages;
 	double		tuples;
+	double		allvisfrac;
 	struct Plan *subplan;		/* if subquery */
 	List	   *subrtable;		/* if subquery */
 	List	   *subrowmark;		/* if subquery */
+	struct PartitionDescData *partdesc; /* if partitioned appendrel */
 
 	/* used by various scans and joins: */
 	List	   *baserestrictinfo;		/* RestrictInfo structures (if base
@@ -469,6 +474,7 @@ typedef struct IndexOptInfo
 	bool		amsearchnulls;	/* can AM search for NULL/NOT NULL entries? */
 	bool		amhasgettuple;	/* does AM have amgettuple interface? */
 	bool		amhasgetbitmap; /* does AM have amgetbitmap interface? */
+	bool		canreturn;		/* can AM return IndexTuples? */
 } IndexOptInfo;
 
 
@@ -642,6 +648,10 @@ typedef struct Path
  * NoMovementScanDirection for an indexscan, but the planner wants to
  * distinguish ordered from unordered indexes for building pathkeys.)
  *
+ * 'indexonly' is TRUE if the index can return all the columns the query
+ * needs from the table, so that the scan can skip fetching heap tuples from
+ * pages that the visibility map says are all-visible.
+ *
  * 'indextotalcost' and 'indexselectivity' are saved in the IndexPath so that
  * we need not recompute them when considering using the same index in a
  * bitmap index/heap scan (see BitmapHeapPath).  The costs of the IndexPath
@@ -662,6 +672,7 @@ typedef struct IndexPath
 	List	   *indexquals;
 	bool		isjoininner;
 	ScanDirection indexscandir;
+	bool		indexonly;
 	Cost		indextotalcost;
 	Selectivity indexselectivity;
 	double		rows;			/* estimated number of result tuples */
@@ -741,16 +752,34 @@ typedef struct TidPath
  * elements.  These cases are optimized during create_append_plan.
  * In particular, an AppendPath with no subpaths is a "dummy" path that
  * is created to represent the case that a relation is provably empty.
+ *
+ * partpruneclauses lists the clauses that the executor may use to skip
+ * partitions once the values of Params, or of the outer rel's Vars for an
+ * inner indexscan Append, are known.  It is NIL unless the parent rel has
+ * a partdesc.
  */
 typedef struct AppendPath
 {
 	Path		path;
 	List	   *subpaths;		/* list of component Paths */
+	List	   *partpruneclauses;	/* RestrictInfos for run-time pruning */
 } AppendPath;
 
 #define IS_DUMMY_PATH(p) \
 	(IsA((p), AppendPath) && ((AppendPath *) (p))->subpaths == NIL)
 
+/*
+ * MergeAppendPath represents a MergeAppend plan, ie, the merging of sorted
+ * results from several member plans to produce similarly-sorted output.
+ * Member paths that aren't already sorted get an explicit Sort added in
+ * create_merge_append_plan.
+ */
+typedef struct MergeAppendPath
+{
+	Path		path;
+	List	   *subpaths;		/* list of component Paths */
+} MergeAppendPath;
+
 /*
  * ResultPath represents use of a Result plan node to compute a variable-free
  * targetlist with no underlying tables (a "SELECT expressions" query).
@@ -776,6 +805,27 @@ typedef struct MaterialPath
 	Path	   *subpath;
 } MaterialPath;
 
+/*
+ * MemoizePath represents use of a Memoize plan node, which caches the
+ * output of a parameterized nestloop inner path for each distinct set of
+ * values of param_exprs, the outer sides of the path's join clauses.
+ * hash_operators are the equality operators to compare them with, or
+ * InvalidOid for keys that must be binary equal instead.  calls
+ * is the expected number of rescans, that is the outer rel's row count.
+ * The path's costs are those of the first scan, which always misses the
+ * cache; cost_rescan uses hit_ratio to estimate the rest.
+ */
+typedef struct MemoizePath
+{
+	Path		path;
+	Path	   *subpath;
+	List	   *param_exprs;
+	List	   *hash_operators;
+	double		calls;
+	double		est_entries;	/* expected number of cache entries */
+	double		hit_ratio;		/* expected fraction of rescans that hit */
+} MemoizePath;
+
 /*
  * UniquePath represents elimination of distinct rows from the output of
  * its subpath.
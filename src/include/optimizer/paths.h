@@ -33,6 +33,8 @@ extern PGDLLIMPORT join_search_hook_type join_search_hook;
 extern RelOptInfo *make_one_rel(PlannerInfo *root, List *joinlist);
 extern RelOptInfo *standard_join_search(PlannerInfo *root, int levels_needed,
 					 List *initial_rels);
+extern List *select_partition_prune_clauses(RelOptInfo *rel,
+							   List *restrictinfos);
 
 #ifdef OPTIMIZER_DEBUG
 extern void debug_print_rel(PlannerInfo *root, RelOptInfo *rel);
@@ -133,6 +135,9 @@ extern void mutate_eclass_expressions(PlannerInfo *root,
 extern List *find_eclass_clauses_for_index_join(PlannerInfo *root,
 								   RelOptInfo *rel,
 								   Relids outer_relids);
+extern List *find_eclass_clauses_for_join(PlannerInfo *root,
+							 RelOptInfo *rel,
+							 Relids outer_relids);
 extern bool have_relevant_eclass_joinclause(PlannerInfo *root,
 								RelOptInfo *rel1, RelOptInfo *rel2);
 extern bool has_relevant_eclass_joinclause(PlannerInfo *root,
@@ -155,6 +160,7 @@ typedef enum
 extern List *canonicalize_pathkeys(PlannerInfo *root, List *pathkeys);
 extern PathKeysComparison compare_pathkeys(List *keys1, List *keys2);
 extern bool pathkeys_contained_in(List *keys1, List *keys2);
+extern int	pathkeys_common_prefix(List *keys1, List *keys2);
 extern Path *get_cheapest_path_for_pathkeys(List *paths, List *pathkeys,
 							   CostSelector cost_criterion);
 extern Path *get_cheapest_fractional_path_for_pathkeys(List *paths,
@@ -44,6 +44,7 @@ typedef struct catcache
 	bool		cc_relisshared; /* is relation shared across databases? */
 	TupleDesc	cc_tupdesc;		/* tuple descriptor (copied from reldesc) */
 	int			cc_ntup;		/* # of tuples currently in this cache */
+	Size		cc_memsize;		/* space used by those tuples, in bytes */
 	int			cc_nbuckets;	/* # of hash buckets in this cache */
 	int			cc_nkeys;		/* # of keys (1..CATCACHE_MAXKEYS) */
 	int			cc_key[CATCACHE_MAXKEYS];		/* AttrNumber of each key */
@@ -52,6 +53,7 @@ typedef struct catcache
 												 * heap scans */
 	bool		cc_isname[CATCACHE_MAXKEYS];	/* flag "name" key columns */
 	Dllist		cc_lists;		/* list of CatCList structs */
+	Dllist		cc_lru;			/* all CatCTups, most recently used first */
 #ifdef CATCACHE_STATS
 	long		cc_searches;	/* total # searches against this cache */
 	long		cc_hits;		/* # of matches against existing entry */
@@ -63,6 +65,7 @@ typedef struct catcache
 	 * searches, each of which will result in loading a negative entry
 	 */
 	long		cc_invals;		/* # of entries invalidated from cache */
+	long		cc_evicts;		/* # of entries evicted to stay in size */
 	long		cc_lsearches;	/* total # list-searches */
 	long		cc_lhits;		/* # of matches against existing lists */
 #endif
@@ -83,6 +86,12 @@ typedef struct catctup
 	 */
 	Dlelem		cache_elem;		/* list member of per-bucket list */
 
+	/*
+	 * Each tuple is also a member of its cache's LRU list, which is used to
+	 * pick victims when the cache exceeds catalog_cache_max_size.
+	 */
+	Dlelem		lru_elem;		/* list member of per-catcache LRU list */
+
 	/*
 	 * The tuple may also be a member of at most one CatCList.	(If a single
 	 * catcache is list-searched with varying numbers of keys, we may have to
@@ -161,6 +170,13 @@ typedef struct catcacheheader
 /* this extern duplicates utils/memutils.h... */
 extern PGDLLIMPORT MemoryContext CacheMemoryContext;
 
+/* name of the per-database catcache init file */
+#define CATCACHE_INIT_FILENAME	"pg_catcache.init"
+
+/* GUC parameters */
+extern int	catalog_cache_max_size;
+extern bool catalog_cache_init_file;
+
 extern void CreateCacheMemoryContext(void);
 extern void AtEOXact_CatCache(bool isCommit);
 
@@ -186,6 +202,10 @@ extern void CatalogCacheIdInvalidate(int cacheId, uint32 hashValue,
 extern void PrepareToInvalidateCacheTuple(Relation relation,
 							  HeapTuple tuple,
 						   void (*function) (int, uint32, ItemPointer, Oid));
+extern bool CatalogCacheTupleIsInInitFile(Relation relation, HeapTuple tuple);
+
+extern void CatalogCacheInitFileLoad(void);
+extern void CatalogCacheInitFileWrite(void);
 
 extern void PrintCatCacheLeakWarning(HeapTuple tuple);
 extern void PrintCatCacheListLeakWarning(CatCList *list);
@@ -0,0 +1 @@
+/root/repo/src/backend/utils/fmgroids.h
\ No newline at end of file
@@ -130,6 +130,7 @@ typedef struct RelationData
 	bool		rd_islocaltemp; /* rel is a temp rel of this session */
 	bool		rd_isnailed;	/* rel is nailed in cache */
 	bool		rd_isvalid;		/* relcache entry is valid */
+	bool		rd_recentlyused;	/* opened since last eviction sweep? */
 	char		rd_indexvalid;	/* state of rd_indexlist: 0 = not valid, 1 =
 								 * valid, 2 = temporarily forced */
 
@@ -242,6 +243,7 @@ typedef struct StdRdOptions
 	int32		vl_len_;		/* varlena header (do not touch directly!) */
 	int			fillfactor;		/* page fill factor in percent (0..100) */
 	AutoVacOpts autovacuum;		/* autovacuum-related options */
+	int			partition_key;	/* offset of key column name, or 0 */
 } StdRdOptions;
 
 #define HEAP_MIN_FILLFACTOR			10
@@ -269,6 +271,17 @@ typedef struct StdRdOptions
 #define RelationGetTargetPageFreeSpace(relation, defaultff) \
 	(BLCKSZ * (100 - RelationGetFillFactor(relation, defaultff)) / 100)
 
+/*
+ * RelationGetPartitionKey
+ *		Returns the name of the relation's partition key column, or NULL
+ *		if it isn't partitioned.  Note multiple eval of argument!
+ */
+#define RelationGetPartitionKey(relation) \
+	((relation)->rd_options && \
+	 ((StdRdOptions *) (relation)->rd_options)->partition_key != 0 ? \
+	 (char *) (relation)->rd_options + \
+	 ((StdRdOptions *) (relation)->rd_options)->partition_key : (char *) NULL)
+
 /*
  * RelationIsValid
  *		True iff relation descriptor is valid.
@@ -99,6 +99,9 @@ extern bool RelationIdIsInInitFile(Oid relationId);
 extern void RelationCacheInitFileInvalidate(bool beforeSend);
 extern void RelationCacheInitFileRemove(void);
 
+/* GUC parameter */
+extern int	relation_cache_max_entries;
+
 /* should be used only by relcache.c and catcache.c */
 extern bool criticalRelcachesBuilt;
 
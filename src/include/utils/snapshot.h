@@ -57,7 +57,13 @@ typedef struct SnapshotData
 	/*
 	 * note: all ids in subxip[] are >= xmin, but we don't bother filtering
 	 * out any that are >= xmax
+	 *
+	 * When suboverflowed is set, subxip[] still holds the subxact IDs of all
+	 * backends whose caches did not overflow; only XIDs >= suboverflowxmin
+	 * (the oldest top-level XID of an overflowed backend) can be missing,
+	 * since a subxact's XID is always later than its parent's.
 	 */
+	TransactionId suboverflowxmin;	/* XIDs below this are in subxip[] */
 	CommandId	curcid;			/* in my xact, CID < curcid are visible */
 	uint32		active_count;	/* refcount on ActiveSnapshot stack */
 	uint32		regd_count;		/* refcount on RegisteredSnapshotList */
@@ -0,0 +1,2884 @@
+/* A lexical scanner generated by pyflex */
+#define FLEX_SCANNER
+#define YY_FLEX_MAJOR_VERSION 2
+#define YY_FLEX_MINOR_VERSION 5
+#define YY_FLEX_SUBMINOR_VERSION 35
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <stdlib.h>
+#ifndef YY_TYPEDEF_YY_SIZE_T
+#define YY_TYPEDEF_YY_SIZE_T
+typedef size_t yy_size_t;
+#endif
+#define yyconst const
+#define YY_NULL 0
+#define YY_END_OF_BUFFER_CHAR 0
+#ifndef YY_BUF_SIZE
+#define YY_BUF_SIZE 16384
+#endif
+#ifndef YY_TYPEDEF_YY_BUFFER_STATE
+#define YY_TYPEDEF_YY_BUFFER_STATE
+typedef struct yy_buffer_state *YY_BUFFER_STATE;
+#endif
+struct yy_buffer_state
+{
+	FILE *yy_input_file;
+	char *yy_ch_buf;
+	yy_size_t yy_buf_size;
+	int yy_n_chars;
+	int yy_pos;
+	int yy_filled;
+	int yy_is_our_buffer;
+};
+void yyrestart(FILE *input_file);
+void yy_switch_to_buffer(YY_BUFFER_STATE new_buffer);
+YY_BUFFER_STATE yy_create_buffer(FILE *file, int size);
+void yy_delete_buffer(YY_BUFFER_STATE b);
+void yy_flush_buffer(YY_BUFFER_STATE b);
+YY_BUFFER_STATE yy_scan_buffer(char *base, yy_size_t size);
+YY_BUFFER_STATE yy_scan_string(yyconst char *yy_str);
+YY_BUFFER_STATE yy_scan_bytes(yyconst char *bytes, int len);
+void *yyalloc(yy_size_t);
+void *yyrealloc(void *, yy_size_t);
+void yyfree(void *);
+int yylex_destroy(void);
+extern int yyleng;
+extern FILE *yyin, *yyout;
+extern char *yytext;
+extern int yylineno;
+
+/* user code from definitions section */
+/*-------------------------------------------------------------------------
+ *
+ * pgc.l
+ *	  lexical scanner for ecpg
+ *
+ * This is a modified version of src/backend/parser/scan.l
+ *
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *	  $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres_fe.h"
+
+#include <ctype.h>
+#include <sys/types.h>
+#include <limits.h>
+
+#include "extern.h"
+
+extern YYSTYPE yylval;
+
+static int		xcdepth = 0;	/* depth of nesting in slash-star comments */
+static char	   *dolqstart;      /* current $foo$ quote start string */
+static YY_BUFFER_STATE scanbufhandle;
+static char *scanbuf;
+
+/*
+ * literalbuf is used to accumulate literal values when multiple rules
+ * are needed to parse a single literal.  Call startlit to reset buffer
+ * to empty, addlit to add text.  Note that the buffer is permanently
+ * malloc'd to the largest size needed so far in the current run.
+ */
+static char    *literalbuf = NULL;		/* expandable buffer */
+static int		literallen;				/* actual current length */
+static int		literalalloc;			/* current allocated buffer size */
+
+/* Used for detecting global state together with braces_open */
+static int		parenths_open;
+
+/* Used to tell parse_include() whether the command was #include or #include_next */
+static bool		include_next;
+
+#define startlit()	(literalbuf[0] = '\0', literallen = 0)
+static void addlit(char *ytext, int yleng);
+static void addlitchar (unsigned char);
+static void parse_include (void);
+static bool ecpg_isspace(char ch);
+static bool isdefine(void);
+static bool isinformixdefine(void);
+
+char *token_start;
+int state_before;
+
+struct _yy_buffer 
+{ 
+	YY_BUFFER_STATE		buffer;
+	long				lineno;
+	char		  		*filename;
+	struct _yy_buffer 	*next;
+} *yy_buffer = NULL;
+
+static char *old;
+
+#define MAX_NESTED_IF 128
+static short preproc_tos;
+static short ifcond;
+static struct _if_value 
+{
+	short condition;
+	short else_branch;
+} stacked_if_value[MAX_NESTED_IF];
+
+
+/* start conditions */
+#define INITIAL 0
+#define C 1
+#define SQL 2
+#define incl 3
+#define def 4
+#define def_ident 5
+#define undef 6
+#define xb 7
+#define xc 8
+#define xd 9
+#define xdc 10
+#define xh 11
+#define xe 12
+#define xn 13
+#define xq 14
+#define xqc 15
+#define xdolq 16
+#define xcond 17
+#define xskip 18
+#define xui 19
+#define xus 20
+#ifndef YY_EXTRA_TYPE
+#define YY_EXTRA_TYPE void *
+#endif
+#define YYG(x) (x)
+int yyleng;
+FILE *yyin = NULL, *yyout = NULL;
+char *yytext;
+int yylineno = 1;
+static YY_BUFFER_STATE yy_current_buffer = NULL;
+static char yy_hold_char;
+static char *yy_hold_ptr = NULL;
+static int yy_init = 0;
+static int yy_start = 0;
+#define YY_CURRENT_BUFFER (YYG(yy_current_buffer))
+#define YY_CURRENT_BUFFER_LVALUE YYG(yy_current_buffer)
+#define BEGIN YYG(yy_start) = 
+#define YY_START (YYG(yy_start))
+#define YYSTATE YY_START
+#define yyterminate() return YY_NULL
+#ifndef ECHO
+#define ECHO do { if (fwrite(yytext, yyleng, 1, yyout)) {} } while (0)
+#endif
+#ifndef YY_USER_ACTION
+#define YY_USER_ACTION
+#endif
+#ifndef YY_BREAK
+#define YY_BREAK break;
+#endif
+#define YY_RULE_SETUP YY_USER_ACTION
+#define YY_FATAL_ERROR(msg) yy_fatal_error(msg)
+static void yy_fatal_error(yyconst char *msg);
+static void yy_fill_buffer(YY_BUFFER_STATE b);
+#undef yyless
+#define yyless(n) \
+	do { \
+		int yyless_macro_arg = (n); \
+		if (YYG(yy_hold_ptr)) *YYG(yy_hold_ptr) = YYG(yy_hold_char); \
+		YYG(yy_hold_ptr) = yytext + yyless_macro_arg; \
+		YYG(yy_hold_char) = *YYG(yy_hold_ptr); \
+		*YYG(yy_hold_ptr) = '\0'; \
+		yyleng = yyless_macro_arg; \
+		YY_CURRENT_BUFFER->yy_pos = (int) (YYG(yy_hold_ptr) - YY_CURRENT_BUFFER->yy_ch_buf); \
+	} while (0)
+#ifndef YY_DECL
+#define YY_DECL_IS_OURS 1
+extern int yylex(void);
+#define YY_DECL int yylex(void)
+#endif
+static yyconst unsigned char yy_ec[256] = {57,57,57,57,57,57,57,57,57,0,1,57,0,2,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,0,41,40,37,39,22,12,6,25,26,4,21,32,3,23,5,16,17,17,17,17,17,17,17,43,43,31,27,29,28,19,42,42,18,38,51,36,10,34,54,54,48,54,54,44,52,9,46,14,50,53,13,45,11,54,54,8,54,54,24,15,20,30,33,42,18,38,51,36,10,34,54,54,49,54,54,44,52,9,46,14,50,53,13,45,11,54,54,7,54,54,56,35,47,42,57,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55};
+static yyconst short yy_nxt[829][58] = {
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{22,23,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22},
+{24,25,24,26,27,28,29,30,30,30,31,30,32,30,30,33,34,35,30,36,37,38,39,40,41,42,43,44,45,46,33,47,48,30,30,49,30,50,30,51,52,53,33,35,30,30,30,54,30,30,30,30,30,30,30,30,55,33},
+{56,57,56,58,59,60,61,62,62,63,64,65,66,67,67,68,69,69,67,59,70,59,59,71,70,70,70,70,59,59,59,72,70,67,67,66,67,73,74,75,76,66,66,69,67,67,67,68,67,67,67,67,67,67,67,67,68,68},
+{77,78,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,79,77,77,77,77,77,77,77,79,77,80,77,77,77,77,77,77,77,77,77,77,81,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77},
+{82,82,82,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,84,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83},
+{85,86,85,85,85,85,85,87,87,87,87,87,85,87,87,85,85,85,87,85,85,85,85,85,85,85,85,85,85,85,85,85,85,87,87,85,87,85,87,85,85,85,85,85,87,87,87,85,87,87,87,87,87,87,87,87,85,85},
+{88,89,88,88,88,88,88,90,90,90,90,90,88,90,90,88,88,88,90,88,88,88,88,88,88,88,88,88,88,88,88,88,88,90,90,88,90,88,90,88,88,88,88,88,90,90,90,88,90,90,90,90,90,90,90,90,88,88},
+{91,91,91,91,91,91,92,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91},
+{93,93,93,94,95,96,93,93,93,93,93,93,94,93,93,93,93,93,93,94,93,94,94,93,93,93,93,93,94,94,94,93,93,93,93,94,93,94,93,93,93,94,94,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93},
+{97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,98,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97},
+{99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,100,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,101,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99},
+{102,102,102,102,102,102,103,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102},
+{104,105,104,104,104,104,106,104,104,104,104,104,104,104,104,107,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104},
+{108,108,108,108,108,108,109,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108},
+{108,108,108,108,108,108,110,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108},
+{108,108,108,108,108,108,111,108,108,108,108,108,108,108,108,112,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108},
+{113,114,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,115,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113},
+{116,117,116,116,116,116,116,118,118,118,118,118,116,118,118,116,116,116,118,116,116,116,116,116,116,116,116,116,116,116,116,116,116,118,118,116,118,116,118,116,116,116,116,116,118,118,118,116,118,118,118,118,118,118,118,118,116,116},
+{119,120,119,121,121,121,121,121,121,121,122,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,123,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121},
+{97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,124,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97},
+{108,108,108,108,108,108,125,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{126,126,126,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{126,126,126,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,129,0,0,0,0,0,0,0,0,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,132,133,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,134,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,135,135,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,136,136,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,137,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,138,138,0,139,0,0,0,0,0,140,140,0,0,0,0,0,141,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,140,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,139,0,0,0,0,0,140,140,0,0,0,0,0,141,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,140,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,142,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,143,0,0,0,0,0,0,144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,146,0,0,0,0,0,0,0,0,0,0,0,147,147,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,147,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,148,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,149,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,152,153,151,151,151,151,151,151,151,151},
+{0,0,0,0,0,0,0,0,0,0,154,155,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,156,0,0,0,0,0,0,0,0,0,0,0,157,157,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{159,159,159,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{159,159,159,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,161,162,162,0,0,0,0,0,0,162,0,0,0,0,0,0,162,0,162,162,0,0,0,0,0,162,162,162,0,0,0,0,162,0,162,0,0,0,162,162,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,162,162,162,0,0,0,0,0,0,162,0,0,0,0,0,0,162,0,162,162,0,0,0,0,0,162,162,162,0,0,0,0,162,0,162,0,0,0,162,162,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,162,163,162,0,0,0,0,0,0,162,0,0,0,0,0,0,162,0,162,162,0,0,0,0,0,162,162,162,0,0,0,0,162,0,162,0,0,0,162,162,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,164,165,165,165,165,165,0,165,165,0,165,165,165,0,0,0,0,0,0,0,0,0,0,0,0,0,0,165,165,0,165,0,165,165,0,0,0,165,165,165,165,0,165,165,165,165,165,165,165,165,0,0},
+{0,0,0,0,0,0,166,165,165,165,165,165,0,165,165,0,165,165,165,0,0,0,0,0,0,0,0,0,0,0,0,0,0,165,165,0,165,0,165,165,0,0,0,165,165,165,165,0,165,165,165,165,165,165,165,165,0,0},
+{0,0,0,0,0,0,167,165,165,165,165,165,0,165,165,0,165,165,165,0,0,0,0,0,0,0,0,0,0,0,0,0,0,165,165,0,165,0,165,165,0,0,0,165,165,165,165,0,165,165,165,165,165,165,165,165,0,0},
+{0,0,0,0,0,0,0,165,165,165,165,165,168,165,165,0,165,165,165,0,0,0,0,0,0,0,0,0,0,0,0,0,0,165,165,0,165,0,165,165,0,0,0,165,165,165,165,0,165,165,165,165,165,165,165,165,0,0},
+{0,0,0,162,162,162,0,0,0,0,0,0,162,0,0,0,0,0,0,162,0,162,162,0,0,0,0,0,162,162,162,0,0,0,0,162,0,162,0,0,0,162,162,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,165,165,165,165,165,0,165,165,0,165,165,165,0,0,0,0,0,0,0,0,0,0,0,0,0,0,165,165,0,165,0,165,165,0,0,0,165,165,165,165,0,165,165,165,165,165,165,165,165,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,169,0,0,0,0,0,170,170,0,0,0,0,0,171,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,170,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,172,172,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,172,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,173,173,173,173,173,0,173,173,0,0,0,173,0,0,0,0,0,0,0,0,0,0,0,0,174,0,173,173,0,173,0,173,0,0,0,0,0,173,173,173,0,173,173,173,173,173,173,173,173,0,0},
+{151,151,151,175,175,175,151,151,151,151,151,151,175,151,151,151,151,151,151,175,151,175,175,151,151,151,151,151,175,175,175,151,151,151,151,175,151,175,151,151,151,175,175,151,151,151,151,151,176,177,151,151,151,151,151,151,151,151},
+{0,0,0,0,0,0,178,165,165,165,165,165,0,165,165,0,165,165,165,0,0,0,0,0,0,0,0,0,0,0,0,0,0,165,165,0,165,0,165,165,0,0,0,165,165,165,165,0,165,165,165,165,165,165,165,165,0,0},
+{0,0,0,0,0,0,0,179,179,179,179,179,0,179,179,0,180,180,179,0,0,0,0,0,0,0,0,0,0,0,0,0,0,179,179,0,179,0,179,181,0,0,0,180,179,179,179,0,179,179,179,179,179,179,179,179,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,0,182,182,182,182,182,182,182,183,182,0,182,182,182,182,182,182,182,182,182,182,0,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182},
+{182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,0,182,182,182,182,182,182,182,183,182,0,182,182,182,182,182,182,182,182,182,182,0,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,0,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184},
+{185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,0,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185},
+{186,186,186,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,187,187,187,187,187,0,187,187,0,187,187,187,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,187,0,187,0,187,187,0,0,0,187,187,187,187,0,187,187,187,187,187,187,187,187,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{188,188,188,0,0,0,0,189,189,189,189,189,0,189,189,0,189,189,189,0,0,0,0,0,0,0,0,190,0,0,0,0,0,189,189,0,189,0,189,189,0,0,0,189,189,189,189,0,189,189,189,189,189,189,189,189,0,0},
+{91,91,91,91,91,91,0,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91},
+{191,192,192,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{194,194,194,194,0,0,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194},
+{194,194,194,194,0,0,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194},
+{0,0,0,0,195,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,197,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,0,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,199,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,200,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,201,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{102,102,102,102,102,102,0,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102},
+{202,203,203,204,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{205,205,205,205,205,205,0,205,205,205,205,205,205,205,205,0,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205},
+{205,205,205,205,205,205,0,205,205,205,205,205,205,205,205,0,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205},
+{206,207,207,208,0,0,209,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{210,210,210,210,210,210,210,211,210,210,210,210,210,210,210,210,212,212,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210},
+{213,213,213,213,213,213,0,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213},
+{214,215,215,216,0,0,209,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{217,218,218,219,0,0,209,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{217,218,218,219,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{213,213,213,213,213,213,220,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213},
+{221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,0,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221},
+{221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,0,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221},
+{0,0,0,0,0,0,0,222,222,222,222,222,0,222,222,0,0,0,222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,222,222,0,222,0,222,223,0,0,0,0,222,222,222,0,222,222,222,222,222,222,222,222,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{224,224,224,0,0,0,0,225,225,225,225,225,0,225,225,0,225,225,225,0,0,0,0,0,0,0,0,226,0,0,0,0,0,225,225,0,225,0,225,225,0,0,0,225,225,225,225,0,225,225,225,225,225,225,225,225,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,227,227,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,228,228,0,0,0,0,0,0,0,0},
+{229,229,229,230,0,0,0,0,0,0,0,231,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,199,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{232,233,233,234,0,0,209,0,0,0,0,235,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{126,126,126,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,152,153,151,151,151,151,151,151,151,151},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,237,237,237,0,0,0,0,0,0,237,0,0,0,0,0,0,237,0,237,237,0,0,0,0,0,237,237,237,0,0,0,0,237,0,237,0,0,0,237,237,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{238,239,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,135,135,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,135,135,135,240,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,241,0,0,0,0,0,241,241,241,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,241,0,241,0,241,0,0,0,0,241,0,0,0,0,0,0,0,241,0,0,0,0,0,0},
+{0,0,0,242,0,0,0,0,0,0,0,0,0,0,0,0,243,243,0,0,0,242,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,139,0,0,0,0,0,140,140,0,0,0,0,0,141,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,140,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,139,0,0,0,0,0,244,244,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,244,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,139,0,0,0,0,0,245,245,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,245,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{246,247,248,246,246,246,246,249,249,249,249,249,246,249,249,250,246,246,249,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,249,246,249,246,249,246,246,246,246,246,249,249,249,246,249,249,249,249,249,249,249,246,246,246},
+{246,247,248,246,246,246,246,249,249,251,249,249,246,249,249,250,246,246,249,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,252,246,249,246,249,246,246,246,246,246,249,249,249,246,249,249,249,249,253,249,249,246,246,246},
+{0,0,0,0,0,0,0,0,0,254,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,256,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,257,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,258,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,259,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,260,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,261,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,262,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{159,159,159,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,176,177,151,151,151,151,151,151,151,151},
+{263,0,0,264,264,264,263,263,263,263,263,263,264,263,263,263,263,263,263,264,263,264,264,263,263,263,263,263,264,264,264,263,263,263,263,264,263,264,263,263,263,264,264,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263},
+{0,0,0,162,162,162,0,0,0,0,0,0,162,0,0,0,0,0,0,162,0,162,162,0,0,0,0,0,162,162,162,0,0,0,0,162,0,162,0,0,0,162,162,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,265,265,265,0,0,0,0,0,0,265,0,0,0,0,0,0,265,0,265,265,0,0,0,0,0,265,265,265,0,0,0,0,265,0,265,0,0,0,265,265,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,165,165,165,165,165,0,165,165,0,165,165,165,0,0,0,0,0,0,0,0,0,0,0,0,0,0,165,165,0,165,0,165,165,0,0,0,165,165,165,165,0,165,165,165,165,165,165,165,165,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,266,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,267,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,268,0,0,0,0,0,0,0,0,0,0,0,0,243,243,0,0,0,268,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,169,0,0,0,0,0,269,269,0,0,0,0,0,171,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,269,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,169,0,0,0,0,0,270,270,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,270,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,169,0,0,0,0,0,271,271,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,271,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,272,0,0,0,273,273,273,273,273,0,273,273,0,273,273,273,0,0,0,0,274,275,0,0,0,0,0,0,0,0,273,273,0,273,0,273,273,0,0,0,273,273,273,273,0,273,273,273,273,273,273,273,273,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{246,247,248,276,276,276,246,249,249,249,249,249,276,249,249,250,246,246,249,276,246,276,276,246,246,246,246,246,276,276,276,246,246,246,249,276,249,276,249,246,246,276,276,246,249,249,249,246,249,249,249,249,249,249,249,246,246,246},
+{246,247,248,246,246,246,246,249,249,249,249,249,246,249,249,250,246,246,249,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,252,246,249,246,249,246,246,246,246,246,249,249,249,246,249,249,249,249,253,249,249,246,246,246},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,256,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,277,277,277,277,277,0,277,277,0,277,277,277,0,0,0,0,0,0,0,0,0,0,0,0,0,0,277,277,0,277,0,277,181,0,0,0,277,277,277,277,0,277,277,277,277,277,277,277,277,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,278,278,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,278,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,0,182,182,182,182,182,182,182,183,182,0,182,182,182,182,182,182,182,182,182,182,0,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182,182},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,280,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279},
+{281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,282,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281},
+{186,186,186,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,187,187,187,187,187,0,187,187,0,187,187,187,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,187,0,187,0,187,187,0,0,0,187,187,187,187,0,187,187,187,187,187,187,187,187,0,0},
+{188,188,188,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,190,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{188,188,188,0,0,0,0,189,189,189,189,189,0,189,189,0,189,189,189,0,0,0,0,0,0,0,0,190,0,0,0,0,0,189,189,0,189,0,189,189,0,0,0,189,189,189,189,0,189,189,189,189,189,189,189,189,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{283,284,284,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{285,285,285,286,0,0,287,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,288,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{194,194,194,194,0,0,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194},
+{0,0,0,0,195,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,289,289,289,0,0,0,0,0,0,289,0,0,0,0,0,0,289,0,289,289,0,0,0,0,0,289,289,289,0,0,0,0,289,0,289,0,0,0,289,289,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,0,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198,198},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{290,291,291,204,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{292,292,292,293,0,0,294,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,295,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{205,205,205,205,205,205,0,205,205,205,205,205,205,205,205,0,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205},
+{296,297,297,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{298,298,298,299,0,0,300,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,301,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,302,0,0,0,0,0,302,302,302,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,302,0,302,0,302,0,0,0,0,302,0,0,0,0,0,0,0,302,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,303,303,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{213,213,213,213,213,213,0,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213},
+{304,305,305,216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{306,306,306,307,0,0,300,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,308,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{309,310,310,219,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{311,311,311,312,0,0,300,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,313,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,0,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221,221},
+{0,0,0,0,0,0,0,314,314,314,314,314,0,314,314,0,314,314,314,0,0,0,0,0,0,0,0,0,0,0,0,0,0,314,314,0,314,0,314,223,0,0,0,314,314,314,314,0,314,314,314,314,314,314,314,314,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{224,224,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{224,224,224,0,0,0,0,225,225,225,225,225,0,225,225,0,225,225,225,0,0,0,0,0,0,0,0,226,0,0,0,0,0,225,225,0,225,0,225,225,0,0,0,225,225,225,225,0,225,225,225,225,225,225,225,225,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,315,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,262,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{316,316,316,230,0,0,0,0,0,0,0,231,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,317,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,318,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{319,320,320,234,0,0,0,0,0,0,0,235,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{321,321,321,322,0,0,300,0,0,0,0,235,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,323,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,324,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,237,237,237,0,0,0,0,0,0,237,0,0,0,0,0,0,237,0,237,237,0,0,0,0,0,237,237,237,0,0,0,0,237,0,237,0,0,0,237,237,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{238,239,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,135,135,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,325,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,0,0,0,241,0,0,0,0,0,241,241,241,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,241,0,241,0,241,0,0,0,0,241,0,0,0,0,0,0,0,241,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,243,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,326,326,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,326,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,139,0,0,0,0,0,327,327,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,327,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,139,0,0,0,0,0,245,245,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,245,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{246,247,248,246,246,246,246,246,246,246,246,246,246,246,246,250,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{246,247,248,246,246,246,246,246,246,246,246,246,246,246,246,250,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246},
+{246,247,248,246,246,246,246,249,249,249,249,249,246,249,249,250,246,246,249,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,249,246,249,246,249,246,246,246,246,246,249,249,249,246,249,249,249,249,249,249,249,246,246,246},
+{328,329,330,246,246,246,246,246,246,246,246,246,246,246,246,250,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246},
+{246,247,248,246,246,246,246,249,249,249,249,249,246,249,249,250,246,246,249,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,249,246,249,246,249,246,246,246,246,246,249,249,249,246,249,249,249,331,249,249,249,246,246,246},
+{246,247,248,246,246,246,246,249,249,332,249,249,246,249,249,250,246,246,249,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,249,246,333,246,249,246,246,246,246,246,249,249,249,246,249,249,249,249,249,249,249,246,246,246},
+{246,247,248,246,246,246,246,249,249,249,249,249,246,249,334,250,246,246,249,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,249,246,249,246,249,246,246,246,246,246,249,249,249,246,249,249,249,249,249,249,249,246,246,246},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,335,0,0,0,0,0,0},
+{246,247,248,246,246,246,246,246,246,336,246,246,246,246,246,250,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,337,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,338,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,339,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,340,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,341,341,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,342,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,343,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,344,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,345,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,346,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{263,0,0,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263},
+{263,0,0,264,264,264,263,263,263,263,263,263,264,263,263,263,263,263,263,264,263,264,264,263,263,263,263,263,264,264,264,263,263,263,263,264,263,264,263,263,263,264,264,263,263,263,263,263,263,263,263,263,263,263,263,263,263,263},
+{0,0,0,265,265,265,0,0,0,0,0,0,265,0,0,0,0,0,0,265,0,265,265,0,0,0,0,0,265,265,265,0,0,0,0,265,0,265,0,0,0,265,265,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,243,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,169,0,0,0,0,0,347,347,0,0,0,0,0,171,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,347,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,169,0,0,0,0,0,348,348,0,0,0,0,0,349,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,348,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,169,0,0,0,0,0,271,271,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,271,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,350,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,272,0,0,0,273,273,273,273,273,0,273,273,0,273,273,273,0,0,0,0,274,275,0,0,0,0,0,0,0,0,273,273,0,273,0,273,273,0,0,0,273,273,273,273,0,273,273,273,273,273,273,273,273,0,0},
+{0,0,0,0,0,0,0,351,351,351,351,351,0,351,351,0,0,0,351,0,0,0,0,0,0,0,0,0,0,0,0,0,0,351,351,0,351,0,351,0,0,0,0,0,351,351,351,0,351,351,351,351,351,351,351,351,0,0},
+{352,352,352,353,354,354,0,355,355,355,355,355,0,355,355,0,355,355,355,354,356,354,354,354,354,354,354,0,0,0,0,0,0,355,355,0,355,0,355,355,0,0,0,355,355,355,355,0,355,355,355,355,355,355,355,355,0,0},
+{246,247,248,276,276,276,246,246,246,246,246,246,276,246,246,250,246,246,246,276,246,276,276,246,246,246,246,246,276,276,276,246,246,246,246,276,246,276,246,246,246,276,276,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246},
+{0,0,0,0,0,0,0,277,277,277,277,277,0,277,277,0,277,277,277,0,0,0,0,0,0,0,0,0,0,0,0,0,0,277,277,0,277,0,277,181,0,0,0,277,277,277,277,0,277,277,277,277,277,277,277,277,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,278,278,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,278,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,280,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279},
+{357,357,357,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,358,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,282,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281},
+{359,359,359,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,360,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{283,284,284,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{285,285,285,286,0,0,287,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{361,361,361,286,0,0,287,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,362,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{363,192,192,364,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365},
+{0,0,0,289,289,289,0,0,0,0,0,0,289,0,0,0,0,0,0,289,0,289,289,0,0,0,0,0,289,289,289,0,0,0,0,289,0,289,0,0,0,289,289,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{290,291,291,204,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{292,292,292,293,0,0,294,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{366,366,366,293,0,0,294,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,367,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{368,203,203,369,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370},
+{296,297,297,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{298,298,298,299,0,0,300,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{371,371,371,299,0,0,300,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,372,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{373,207,207,374,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375},
+{0,0,0,0,0,0,0,0,0,0,376,0,0,0,0,0,376,376,376,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,376,0,376,0,376,0,0,0,0,376,0,0,0,0,0,0,0,376,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,377,377,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{304,305,305,216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{306,306,306,307,0,0,300,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{378,378,378,307,0,0,300,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,379,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{380,215,215,381,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382},
+{309,310,310,219,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{311,311,311,312,0,0,300,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{383,383,383,312,0,0,300,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,384,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{385,218,218,386,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387},
+{0,0,0,0,0,0,0,314,314,314,314,314,0,314,314,0,314,314,314,0,0,0,0,0,0,0,0,0,0,0,0,0,0,314,314,0,314,0,314,223,0,0,0,314,314,314,314,0,314,314,314,314,314,314,314,314,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,388,0,0,0,0,0,0},
+{316,316,316,230,0,0,0,0,0,0,0,231,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{389,229,229,390,391,391,391,391,391,391,391,392,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,393,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{319,320,320,234,0,0,0,0,0,0,0,235,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{321,321,321,322,0,0,300,0,0,0,0,235,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{394,394,394,322,0,0,300,0,0,0,0,235,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,395,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{396,233,233,397,398,398,398,398,398,398,398,399,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,400,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{401,401,401,0,0,0,0,135,135,135,135,135,0,402,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,326,326,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,326,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,139,0,0,0,0,0,327,327,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,327,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{246,247,248,246,246,246,246,246,246,246,246,246,246,246,246,250,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246},
+{246,247,248,246,246,246,246,246,246,246,246,246,246,246,246,250,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246},
+{246,247,248,246,246,246,246,246,246,246,246,246,246,246,246,250,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246},
+{246,247,248,246,246,246,246,249,249,249,249,249,246,249,249,250,246,246,249,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,249,246,249,246,249,246,246,246,246,246,403,249,249,246,249,249,249,249,249,249,249,246,246,246},
+{246,247,248,246,246,246,246,249,249,249,249,249,246,249,249,250,246,246,249,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,249,246,404,246,249,246,246,246,246,246,249,249,249,246,249,249,249,249,249,249,249,246,246,246},
+{246,247,248,246,246,246,246,249,249,249,405,249,246,249,249,250,246,246,249,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,249,246,249,246,249,246,246,246,246,246,249,249,249,246,249,249,249,249,249,249,249,246,246,246},
+{246,247,248,246,246,246,246,249,249,249,249,249,246,249,249,250,246,246,249,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,249,246,249,246,249,246,246,246,246,246,249,249,406,246,249,249,249,249,249,249,249,246,246,246},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,407,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{246,247,248,246,246,246,246,246,246,246,246,246,246,246,246,250,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,408,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246},
+{246,247,248,246,246,246,246,246,246,246,409,246,246,246,246,250,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,410,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,411,411,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,412,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,413,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,414,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,415,415,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,416,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,417,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,418,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,169,0,0,0,0,0,347,347,0,0,0,0,0,419,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,347,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,169,0,0,0,0,0,420,420,0,0,0,0,0,349,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,420,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,421,421,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,421,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,351,351,351,351,351,0,351,351,0,0,0,351,0,0,0,0,0,0,0,0,0,0,0,0,0,0,351,351,0,351,0,351,0,0,0,0,0,351,351,351,0,351,351,351,351,351,351,351,351,0,0},
+{0,0,0,272,0,0,0,422,422,422,422,422,0,422,422,0,422,422,422,0,0,0,0,274,275,0,0,0,0,0,0,0,0,422,422,0,422,0,422,422,0,0,0,422,422,422,422,0,422,422,422,422,422,422,422,422,0,0},
+{423,423,423,353,354,354,0,355,355,355,355,355,0,355,355,0,355,355,355,354,356,354,354,354,354,354,354,0,0,0,0,0,0,355,355,0,355,0,355,355,0,0,0,355,355,355,355,0,355,355,355,355,355,355,355,355,0,0},
+{352,352,352,424,354,354,0,355,355,355,355,355,0,355,355,0,355,355,355,354,356,354,354,354,354,354,354,0,0,0,0,0,0,355,355,0,355,0,355,355,0,0,0,355,355,355,355,0,355,355,355,355,355,355,355,355,0,0},
+{352,352,352,353,354,354,0,355,355,355,355,355,0,355,355,0,355,355,355,354,356,354,354,354,354,354,354,0,0,0,0,0,0,355,355,0,355,0,355,355,0,0,0,355,355,355,355,0,355,355,355,355,355,355,355,355,0,0},
+{352,352,352,353,354,354,0,355,355,355,355,355,0,355,355,0,355,355,355,354,356,354,354,354,354,354,354,0,0,0,0,0,0,355,355,0,355,0,355,355,0,0,0,355,355,355,355,0,355,355,355,355,355,355,355,355,0,0},
+{352,352,352,425,354,354,0,355,355,355,355,355,0,355,355,0,355,355,355,354,356,354,354,426,427,354,354,0,0,0,0,0,0,355,355,0,355,0,355,355,0,0,0,355,355,355,355,0,355,355,355,355,355,355,355,355,0,0},
+{357,357,357,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,358,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{359,359,359,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,360,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{361,361,361,286,0,0,287,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{428,429,429,430,431,431,432,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431},
+{433,284,284,364,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365},
+{363,192,192,434,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365},
+{363,192,192,364,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365},
+{366,366,366,293,0,0,294,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{435,436,436,437,438,438,439,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438},
+{440,291,291,369,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370},
+{368,203,203,441,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370},
+{368,203,203,369,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370},
+{371,371,371,299,0,0,300,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{442,443,443,444,445,445,446,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445},
+{447,297,297,374,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375},
+{373,207,207,448,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375},
+{373,207,207,374,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{378,378,378,307,0,0,300,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{449,450,450,451,452,452,453,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452},
+{454,305,305,381,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382},
+{380,215,215,455,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382},
+{380,215,215,381,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382},
+{383,383,383,312,0,0,300,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{456,457,457,458,459,459,460,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459},
+{461,310,310,386,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387},
+{385,218,218,462,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387},
+{385,218,218,386,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387},
+{463,463,463,0,0,0,0,0,0,0,0,0,0,464,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{465,316,316,390,391,391,391,391,391,391,391,392,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391},
+{389,229,229,466,391,391,391,391,391,391,391,392,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391},
+{389,229,229,390,391,391,391,391,391,391,391,392,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391},
+{389,229,229,390,391,391,391,391,391,391,467,392,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,468,0,0,0,0,0,0},
+{394,394,394,322,0,0,300,0,0,0,0,235,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{469,470,470,471,472,472,473,472,472,472,472,474,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472},
+{475,320,320,397,398,398,398,398,398,398,398,399,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398},
+{396,233,233,476,398,398,398,398,398,398,398,399,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398},
+{396,233,233,397,398,398,398,398,398,398,398,399,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398},
+{396,233,233,397,398,398,398,398,398,398,477,399,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,478,0,0,0,0,0,0},
+{401,401,401,0,0,0,0,0,0,0,0,0,0,479,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,135,135,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,480,135,135,135,135,135,0,0},
+{246,247,248,246,246,246,246,249,249,249,249,481,246,249,249,250,246,246,249,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,249,246,249,246,249,246,246,246,246,246,249,249,249,246,249,249,249,249,249,249,249,246,246,246},
+{246,247,248,246,246,246,246,249,249,249,482,249,246,249,249,250,246,246,249,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,249,246,249,246,249,246,246,246,246,246,249,249,249,246,249,249,249,249,249,249,249,246,246,246},
+{246,247,248,246,246,246,246,249,249,249,249,249,246,249,249,250,246,246,249,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,483,246,249,246,249,246,246,246,246,246,249,249,249,246,249,249,249,249,249,249,249,246,246,246},
+{246,247,248,246,246,246,246,249,249,249,249,249,246,249,249,250,246,246,249,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,249,246,249,246,249,246,246,246,246,246,249,249,249,246,249,249,249,249,249,484,249,246,246,246},
+{0,0,0,0,0,0,0,0,0,0,0,485,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{246,247,248,246,246,246,246,246,246,246,486,246,246,246,246,250,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246},
+{246,247,248,246,246,246,246,246,246,246,246,246,246,246,246,250,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,487,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,488,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,489,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{490,490,490,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,491,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{492,492,492,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,493,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,494,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,495,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,496,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,497,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,169,0,0,0,0,0,498,498,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,498,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,169,0,0,0,0,0,499,499,0,0,0,0,0,349,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,499,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,500,500,0,0,0,0,0,501,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,500,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,272,0,0,0,422,422,422,422,422,0,422,422,0,422,422,422,0,0,0,0,274,275,0,0,0,0,0,0,0,0,422,422,0,422,0,422,422,0,0,0,422,422,422,422,0,422,422,422,422,422,422,422,422,0,0},
+{423,423,423,353,354,354,0,355,355,355,355,355,0,355,355,0,355,355,355,354,356,354,354,354,354,354,354,0,0,0,0,0,0,355,355,0,355,0,355,355,0,0,0,355,355,355,355,0,355,355,355,355,355,355,355,355,0,0},
+{502,352,352,503,504,504,505,506,506,506,506,506,505,506,506,505,506,506,506,504,507,504,504,504,504,504,504,505,505,505,505,505,505,506,506,505,506,505,506,506,505,505,505,506,506,506,506,505,506,506,506,506,506,506,506,506,505,505},
+{352,352,352,424,354,354,0,355,355,355,355,355,0,355,355,0,355,355,355,508,356,354,354,354,354,354,354,0,0,0,0,0,0,355,355,0,355,0,355,355,0,0,0,355,355,355,355,0,355,355,355,355,355,355,355,355,0,0},
+{352,352,352,353,354,354,0,509,509,509,509,509,0,509,509,0,355,355,509,354,356,354,354,354,354,354,354,0,0,0,0,0,0,509,509,0,509,0,509,355,0,0,0,355,509,509,509,0,509,509,509,509,509,509,509,509,0,0},
+{352,352,352,353,354,354,0,355,355,355,355,355,0,355,355,0,355,355,355,354,356,354,354,354,354,354,354,0,0,0,0,0,0,355,355,0,355,0,355,355,0,0,0,355,355,355,355,0,355,355,355,355,355,355,355,355,0,0},
+{510,361,361,430,431,431,432,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431},
+{361,361,361,286,0,0,287,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{428,429,429,511,431,431,432,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431},
+{428,429,429,430,431,431,432,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431},
+{428,429,429,430,431,431,432,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431},
+{433,284,284,364,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365},
+{363,192,192,434,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365,365},
+{512,366,366,437,438,438,439,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438},
+{366,366,366,293,0,0,294,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{435,436,436,513,438,438,439,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438},
+{435,436,436,437,438,438,439,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438},
+{435,436,436,437,438,438,439,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438},
+{440,291,291,369,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370},
+{368,203,203,441,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370,370},
+{514,371,371,444,445,445,446,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445},
+{371,371,371,299,0,0,300,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{442,443,443,515,445,445,446,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445},
+{442,443,443,444,445,445,446,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445},
+{442,443,443,444,445,445,446,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445},
+{447,297,297,374,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375},
+{373,207,207,448,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375,375},
+{516,378,378,451,452,452,453,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452},
+{378,378,378,307,0,0,300,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{449,450,450,517,452,452,453,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452},
+{449,450,450,451,452,452,453,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452},
+{449,450,450,451,452,452,453,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452},
+{454,305,305,381,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382},
+{380,215,215,455,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382,382},
+{518,383,383,458,459,459,460,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459},
+{383,383,383,312,0,0,300,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{456,457,457,519,459,459,460,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459},
+{456,457,457,458,459,459,460,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459},
+{456,457,457,458,459,459,460,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459},
+{461,310,310,386,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387},
+{385,218,218,462,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387,387},
+{463,463,463,0,0,0,0,0,0,0,0,0,0,464,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,520,0,0,0,0,0,0,0},
+{465,316,316,390,391,391,391,391,391,391,391,392,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391},
+{389,229,229,466,391,391,391,391,391,391,391,392,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391},
+{389,229,229,390,391,391,391,391,391,391,391,392,391,521,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,522,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{523,394,394,471,472,472,473,472,472,472,472,474,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472},
+{394,394,394,322,0,0,300,0,0,0,0,235,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{469,470,470,524,472,472,473,472,472,472,472,474,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472},
+{469,470,470,471,472,472,473,472,472,472,472,474,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472},
+{469,470,470,471,472,472,473,472,472,472,472,474,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472},
+{469,470,470,471,472,472,473,472,472,472,525,474,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472},
+{475,320,320,397,398,398,398,398,398,398,398,399,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398},
+{396,233,233,476,398,398,398,398,398,398,398,399,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398},
+{396,233,233,397,398,398,398,398,398,398,398,399,398,526,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,527,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,528,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,135,135,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,529,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{246,247,248,246,246,246,246,249,249,249,249,249,246,249,249,250,246,246,249,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,249,246,530,246,249,246,246,246,246,246,249,249,249,246,249,249,249,249,249,249,249,246,246,246},
+{246,247,248,246,246,246,246,249,249,249,249,249,246,249,249,250,246,246,249,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,531,246,249,246,249,246,246,246,246,246,249,249,249,246,249,249,249,249,249,249,249,246,246,246},
+{246,247,248,246,246,246,246,249,249,249,249,249,246,249,249,250,246,246,249,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,249,246,249,246,249,246,246,246,246,246,249,249,249,246,249,249,249,249,249,249,249,246,246,246},
+{246,247,248,246,246,246,246,249,249,249,249,249,246,249,249,250,246,246,249,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,249,246,249,246,249,246,246,246,246,246,249,532,249,246,249,249,249,249,249,249,249,246,246,246},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,533,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{246,247,248,246,246,246,246,246,246,246,246,246,246,246,246,250,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,534,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246},
+{246,247,248,246,246,246,246,246,246,246,246,246,246,246,246,250,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,535,0,0,0,0,0,0,0,0,0,0,0,0},
+{536,536,536,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,537,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{490,490,490,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,491,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{492,492,492,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{538,538,538,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,539,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,540,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,541,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{542,542,542,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,169,0,0,0,0,0,499,499,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,499,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,169,0,0,0,0,0,499,499,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,499,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,543,543,0,0,0,0,0,501,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,543,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,544,544,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,544,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{545,423,423,546,504,504,505,506,506,506,506,506,505,506,506,505,506,506,506,504,507,504,504,504,504,504,504,505,505,505,505,505,505,506,506,505,506,505,506,506,505,505,505,506,506,506,506,505,506,506,506,506,506,506,506,506,505,505},
+{502,352,352,503,504,504,505,506,506,506,506,506,505,506,506,505,506,506,506,504,507,504,504,504,504,504,504,505,505,505,505,505,505,506,506,505,506,505,506,506,505,505,505,506,506,506,506,505,506,506,506,506,506,506,506,506,505,505},
+{502,352,352,546,504,504,505,506,506,506,506,506,505,506,506,505,506,506,506,504,507,504,504,504,504,504,504,505,505,505,505,505,505,506,506,505,506,505,506,506,505,505,505,506,506,506,506,505,506,506,506,506,506,506,506,506,505,505},
+{502,352,352,546,504,504,505,506,506,506,506,506,505,506,506,505,506,506,506,504,507,504,504,504,504,504,504,505,505,505,505,505,505,506,506,505,506,505,506,506,505,505,505,506,506,506,506,505,506,506,506,506,506,506,506,506,505,505},
+{502,352,352,546,504,504,505,506,506,506,506,506,505,506,506,505,506,506,506,504,507,504,504,504,504,504,504,505,505,505,505,505,505,506,506,505,506,505,506,506,505,505,505,506,506,506,506,505,506,506,506,506,506,506,506,506,505,505},
+{502,352,352,547,504,504,505,506,506,506,506,506,505,506,506,505,506,506,506,504,507,504,504,548,549,504,504,505,505,505,505,505,505,506,506,505,506,505,506,506,505,505,505,506,506,506,506,505,506,506,506,506,506,506,506,506,505,505},
+{352,352,352,353,354,354,0,509,509,509,509,509,0,509,509,0,355,355,509,354,356,354,354,354,354,354,354,0,0,0,0,0,0,509,509,0,509,0,509,355,0,0,0,355,509,509,509,0,509,509,509,509,509,509,509,509,0,0},
+{352,352,352,425,354,354,0,550,550,550,550,550,0,550,550,0,550,550,550,354,356,354,354,426,427,354,354,0,0,0,0,0,0,550,550,0,550,0,550,550,0,0,0,550,550,550,550,0,550,550,550,550,550,550,550,550,0,0},
+{510,361,361,430,431,431,432,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431},
+{428,429,429,511,431,431,432,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431},
+{512,366,366,437,438,438,439,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438},
+{435,436,436,513,438,438,439,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438,438},
+{514,371,371,444,445,445,446,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445},
+{442,443,443,515,445,445,446,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445,445},
+{516,378,378,451,452,452,453,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452},
+{449,450,450,517,452,452,453,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452,452},
+{518,383,383,458,459,459,460,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459},
+{456,457,457,519,459,459,460,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459,459},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,551,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{389,229,229,390,391,391,391,391,391,391,391,392,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,552,391,391,391,391,391,391},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,553,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{523,394,394,471,472,472,473,472,472,472,472,474,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472},
+{469,470,470,524,472,472,473,472,472,472,472,474,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472},
+{469,470,470,471,472,472,473,472,472,472,472,474,472,554,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472},
+{396,233,233,397,398,398,398,398,398,398,398,399,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,555,398,398,398,398,398,398},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,556,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,557,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{558,558,558,0,0,0,0,135,135,135,559,560,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,561,0,135,135,0,0,0,135,135,135,135,0,562,562,135,135,135,135,135,135,0,0},
+{246,247,248,246,246,246,246,249,249,249,563,249,246,249,249,250,246,246,249,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,249,246,249,246,249,246,246,246,246,246,249,249,249,246,249,249,249,249,249,249,249,246,246,246},
+{246,247,248,246,246,246,246,249,249,249,249,249,246,249,249,250,246,246,249,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,249,246,249,246,249,246,246,246,246,246,249,249,249,246,249,249,249,249,249,249,249,246,246,246},
+{246,247,248,246,246,246,246,249,249,249,249,249,246,249,249,250,246,246,249,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,249,246,249,246,249,246,246,246,246,246,249,249,249,246,249,249,249,249,249,249,249,246,246,246},
+{0,0,0,0,0,0,0,0,0,0,564,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{246,247,248,246,246,246,246,246,246,246,246,246,246,246,246,250,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246},
+{246,247,248,246,246,246,246,246,246,246,246,246,246,246,246,250,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246},
+{536,536,536,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,537,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{538,538,538,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{565,565,565,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,566,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{567,567,567,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{542,542,542,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,501,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,568,568,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,568,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{545,423,423,546,504,504,505,506,506,506,506,506,505,506,506,505,506,506,506,504,507,504,504,504,504,504,504,505,505,505,505,505,505,506,506,505,506,505,506,506,505,505,505,506,506,506,506,505,506,506,506,506,506,506,506,506,505,505},
+{502,352,352,503,504,504,505,506,506,506,506,506,505,506,506,505,506,506,506,504,507,504,504,504,504,504,504,505,505,505,505,505,505,506,506,505,506,505,506,506,505,505,505,506,506,506,506,505,506,506,506,506,506,506,506,506,505,505},
+{502,352,352,503,504,504,505,506,506,506,506,506,505,506,506,505,506,506,506,569,507,504,504,504,504,504,504,505,505,505,505,505,505,506,506,505,506,505,506,506,505,505,505,506,506,506,506,505,506,506,506,506,506,506,506,506,505,505},
+{502,352,352,546,504,504,505,570,570,570,570,570,505,570,570,505,506,506,570,504,507,504,504,504,504,504,504,505,505,505,505,505,505,570,570,505,570,505,570,506,505,505,505,506,570,570,570,505,570,570,570,570,570,570,570,570,505,505},
+{502,352,352,546,504,504,505,506,506,506,506,506,505,506,506,505,506,506,506,504,507,504,504,504,504,504,504,505,505,505,505,505,505,506,506,505,506,505,506,506,505,505,505,506,506,506,506,505,506,506,506,506,506,506,506,506,505,505},
+{352,352,352,425,354,354,0,550,550,550,550,550,0,550,550,0,550,550,550,354,356,354,354,426,427,354,354,0,0,0,0,0,0,550,550,0,550,0,550,550,0,0,0,550,550,550,550,0,550,550,550,550,550,550,550,550,0,0},
+{571,571,571,0,0,0,0,0,0,0,572,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,573,573,0,0,0,0,0,0,0,0},
+{389,229,229,390,391,391,391,391,391,391,391,392,391,391,391,391,391,391,574,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391},
+{0,0,0,0,0,0,0,0,0,0,575,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{469,470,470,471,472,472,473,472,472,472,472,474,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,576,472,472,472,472,472,472},
+{396,233,233,397,398,398,398,398,398,398,398,399,398,398,398,398,398,398,577,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398},
+{0,0,0,0,0,0,0,0,0,0,578,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{558,558,558,0,0,0,0,0,0,0,572,579,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,580,0,0,0,0,0,0,0,0,0,0,0,581,581,0,0,0,0,0,0,0,0},
+{558,558,558,0,0,0,0,0,0,0,572,579,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,580,0,0,0,0,0,0,0,0,0,0,0,581,581,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,135,135,582,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,583,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,135,135,584,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,135,135,135,585,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,135,135,586,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,587,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{588,589,590,246,246,246,246,249,249,249,249,249,246,249,249,250,246,246,249,246,246,246,246,246,246,246,246,246,246,246,246,246,246,591,249,246,249,246,249,246,246,246,246,246,249,249,249,246,249,249,249,249,249,249,249,246,246,246},
+{592,592,592,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,593,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{565,565,565,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{594,594,594,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{567,567,567,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,595,595,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,595,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{502,352,352,546,504,504,505,570,570,570,570,570,505,570,570,505,506,506,570,504,507,504,504,504,504,504,504,505,505,505,505,505,505,570,570,505,570,505,570,506,505,505,505,506,570,570,570,505,570,570,570,570,570,570,570,570,505,505},
+{502,352,352,547,504,504,505,596,596,596,596,596,505,596,596,505,596,596,596,504,507,504,504,548,549,504,504,505,505,505,505,505,505,596,596,505,596,505,596,596,505,505,505,596,596,596,596,505,596,596,596,596,596,596,596,596,505,505},
+{571,571,571,0,0,0,0,0,0,0,572,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,573,573,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,597,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,598,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,599,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{389,229,229,390,391,391,391,391,391,391,391,392,391,391,600,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391},
+{601,601,601,602,0,0,603,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{469,470,470,471,472,472,473,472,472,472,472,474,472,472,472,472,472,472,604,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472},
+{396,233,233,397,398,398,398,398,398,398,398,399,398,398,605,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398},
+{606,606,606,607,0,0,608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,609,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,610,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,611,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,599,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,135,135,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,612,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,135,135,135,135,135,0,613,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,614,614,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,135,135,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,615,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,135,135,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,616,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,135,135,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,617,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,135,135,618,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,619,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{588,589,590,246,246,246,246,246,246,246,246,246,246,246,246,250,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246},
+{592,592,592,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{588,589,590,246,246,246,246,246,246,246,246,246,246,246,246,250,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246},
+{246,247,248,246,246,246,246,246,246,620,246,246,246,246,246,250,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246},
+{592,592,592,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,621,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{594,594,594,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{502,352,352,547,504,504,505,596,596,596,596,596,505,596,596,505,596,596,596,504,507,504,504,548,549,504,504,505,505,505,505,505,505,596,596,505,596,505,596,596,505,505,505,596,596,596,596,505,596,596,596,596,596,596,596,596,505,505},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,622,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,623,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,624,624,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,625,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,626,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{389,229,229,390,391,391,391,391,391,391,627,392,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391},
+{628,628,628,602,0,0,603,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,629,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{630,630,630,630,630,630,0,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630},
+{469,470,470,471,472,472,473,472,472,472,472,474,472,472,631,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472},
+{396,233,233,397,398,398,398,398,398,398,632,399,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398},
+{633,633,633,607,0,0,608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,634,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{635,635,635,635,635,635,0,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,636,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,637,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,638,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,135,135,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,639,639,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,135,135,135,640,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,135,135,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,641,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,135,135,135,642,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,135,135,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,643,643,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,135,135,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,644,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,135,135,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,645,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,135,135,135,646,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{246,247,248,246,246,246,246,246,246,246,647,246,246,246,246,250,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246},
+{0,0,0,0,0,0,0,0,0,0,648,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,649,649,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,650,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,651,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,652,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,653,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{654,655,655,656,391,391,657,391,391,391,391,392,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391},
+{628,628,628,602,0,0,603,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{658,601,601,659,660,660,661,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660},
+{0,0,0,0,0,0,662,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{469,470,470,471,472,472,473,472,472,472,663,474,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472},
+{664,665,665,666,398,398,667,398,398,398,398,399,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398},
+{633,633,633,607,0,0,608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{668,606,606,669,670,670,671,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670},
+{0,0,0,0,0,0,672,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,673,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,674,674,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,675,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,135,135,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,676,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{677,677,677,0,0,0,0,135,135,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,678,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{679,679,679,0,0,0,0,135,135,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,135,135,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,680,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,135,135,681,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,135,135,135,135,682,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,135,135,135,683,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,135,135,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,684,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{246,247,248,246,246,246,246,685,685,246,246,246,246,246,246,250,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246},
+{0,0,0,0,0,0,0,686,686,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,687,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{677,677,677,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,678,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{679,679,679,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,688,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,689,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{690,691,691,656,391,391,657,391,391,391,391,392,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391},
+{691,691,691,692,0,0,603,0,0,0,0,231,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{389,229,229,693,391,391,391,391,391,391,391,392,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391},
+{694,695,695,696,697,697,391,697,697,697,697,698,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697,697},
+{699,628,628,659,660,660,661,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660},
+{658,601,601,700,660,660,661,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660},
+{658,601,601,659,660,660,661,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660},
+{701,702,702,703,704,704,661,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{705,706,706,707,472,472,708,472,472,472,472,474,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472},
+{709,710,710,666,398,398,667,398,398,398,398,399,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398},
+{711,711,711,712,0,0,713,0,0,0,0,235,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{396,233,233,714,398,398,398,398,398,398,398,399,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398},
+{715,716,716,717,718,718,398,718,718,718,718,719,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718,718},
+{720,633,633,669,670,670,671,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670},
+{668,606,606,721,670,670,671,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670},
+{668,606,606,669,670,670,671,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670},
+{722,723,723,724,725,725,671,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,726,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,727,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,728,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{729,729,729,0,0,0,0,135,135,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,730,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{677,677,677,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,678,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{679,679,679,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{731,731,731,0,0,0,0,135,135,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,135,135,135,732,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,135,135,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,733,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,135,135,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,734,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{735,735,735,0,0,0,0,135,135,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{246,247,248,246,246,246,246,246,246,246,246,246,246,246,246,250,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,736,246,246,246,246,246,246,246,246,246,246,246,246},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,737,0,0,0,0,0,0,0,0,0,0,0,0},
+{729,729,729,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,730,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,738,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{735,735,735,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{690,691,691,656,391,391,657,391,391,391,391,392,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391},
+{691,691,691,692,0,0,603,0,0,0,0,231,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,739,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{740,655,655,741,742,742,743,742,742,742,742,744,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742},
+{465,316,316,390,391,391,745,391,391,391,391,392,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391},
+{316,316,316,230,0,0,662,0,0,0,0,231,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{389,229,229,466,391,391,745,391,391,391,391,392,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391},
+{389,229,229,390,391,391,745,391,391,391,391,392,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391},
+{389,229,229,390,391,391,745,391,391,391,467,392,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391},
+{699,628,628,659,660,660,661,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660},
+{658,601,601,700,660,660,661,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660},
+{699,628,628,659,660,660,746,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660},
+{628,628,628,602,0,0,747,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{658,601,601,700,660,660,746,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660},
+{658,601,601,659,660,660,746,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660,660},
+{748,749,749,707,472,472,708,472,472,472,472,474,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472},
+{749,749,749,712,0,0,713,0,0,0,0,235,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{469,470,470,750,472,472,473,472,472,472,472,474,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472},
+{751,752,752,753,754,754,473,754,754,754,754,755,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754,754},
+{709,710,710,666,398,398,667,398,398,398,398,399,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398},
+{711,711,711,712,0,0,713,0,0,0,0,235,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{749,749,749,712,0,0,713,0,0,0,0,235,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,756,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{635,635,635,635,635,635,0,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635},
+{757,665,665,758,759,759,760,759,759,759,759,761,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759},
+{475,320,320,397,398,398,762,398,398,398,398,399,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398},
+{321,321,321,322,0,0,763,0,0,0,0,235,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{396,233,233,476,398,398,762,398,398,398,398,399,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398},
+{396,233,233,397,398,398,762,398,398,398,398,399,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398},
+{396,233,233,397,398,398,762,398,398,398,477,399,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398},
+{720,633,633,669,670,670,671,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670},
+{668,606,606,721,670,670,671,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670},
+{720,633,633,669,670,670,764,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670},
+{633,633,633,607,0,0,765,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{668,606,606,721,670,670,764,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670},
+{668,606,606,669,670,670,764,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670,670},
+{731,731,731,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,766,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,767,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{729,729,729,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,730,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{731,731,731,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{768,768,768,0,0,0,0,135,135,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{0,0,0,0,0,0,0,135,135,135,769,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{770,770,770,0,0,0,0,135,135,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{735,735,735,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{771,772,773,246,246,246,246,246,246,246,246,246,246,246,246,250,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246},
+{774,774,774,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{770,770,770,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{740,655,655,775,742,742,743,742,742,742,742,744,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742},
+{776,691,691,775,742,742,743,742,742,742,742,744,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742},
+{740,655,655,777,742,742,743,742,742,742,742,744,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742},
+{740,655,655,775,742,742,743,742,742,742,742,744,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742},
+{778,779,779,780,781,781,743,781,781,781,781,782,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781},
+{740,655,655,775,742,742,743,742,742,742,783,744,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742},
+{389,229,229,390,391,391,391,391,391,391,391,392,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391},
+{701,702,702,703,704,704,661,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704,704},
+{630,630,630,630,630,630,0,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630,630},
+{748,749,749,707,472,472,708,472,472,472,472,474,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472},
+{749,749,749,712,0,0,713,0,0,0,0,235,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{784,706,706,785,786,786,787,786,786,786,786,788,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786},
+{523,394,394,471,472,472,789,472,472,472,472,474,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472},
+{394,394,394,322,0,0,763,0,0,0,0,235,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{469,470,470,524,472,472,789,472,472,472,472,474,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472},
+{469,470,470,471,472,472,789,472,472,472,472,474,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472},
+{469,470,470,471,472,472,789,472,472,472,525,474,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472},
+{784,706,706,790,786,786,787,786,786,786,786,788,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786},
+{791,710,710,792,759,759,760,759,759,759,759,761,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759},
+{757,665,665,793,759,759,760,759,759,759,759,761,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759},
+{757,665,665,792,759,759,760,759,759,759,759,761,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759},
+{794,795,795,796,797,797,760,797,797,797,797,798,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797},
+{757,665,665,792,759,759,760,759,759,759,799,761,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759},
+{396,233,233,397,398,398,398,398,398,398,398,399,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398,398},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{722,723,723,724,725,725,671,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725,725},
+{635,635,635,635,635,635,0,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635},
+{768,768,768,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{0,0,0,0,0,0,0,0,0,0,800,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{768,768,768,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{801,801,801,0,0,0,0,135,135,135,135,135,0,135,135,0,135,135,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,135,0,135,0,135,135,0,0,0,135,135,135,135,0,135,135,135,135,135,135,135,135,0,0},
+{770,770,770,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{771,772,773,246,246,246,246,246,246,246,246,246,246,246,246,250,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246},
+{774,774,774,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{771,772,773,246,246,246,246,246,246,246,246,246,246,246,246,250,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246,246},
+{774,774,774,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{740,655,655,777,742,742,743,742,742,742,742,744,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742},
+{776,691,691,775,742,742,743,742,742,742,742,744,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742},
+{740,655,655,777,742,742,743,742,742,742,742,744,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742},
+{776,691,691,775,742,742,802,742,742,742,742,744,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742},
+{691,691,691,692,0,0,747,0,0,0,0,231,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{740,655,655,777,742,742,802,742,742,742,742,744,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742},
+{740,655,655,775,742,742,802,742,742,742,742,744,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742},
+{740,655,655,775,742,742,802,742,742,742,783,744,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742},
+{740,655,655,775,742,742,743,742,742,742,742,744,742,803,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742},
+{804,749,749,790,786,786,787,786,786,786,786,788,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786},
+{784,706,706,805,786,786,787,786,786,786,786,788,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786},
+{784,706,706,790,786,786,787,786,786,786,786,788,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786},
+{806,807,807,808,809,809,787,809,809,809,809,810,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809},
+{784,706,706,790,786,786,787,786,786,786,811,788,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786},
+{469,470,470,471,472,472,473,472,472,472,472,474,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472,472},
+{784,706,706,805,786,786,787,786,786,786,786,788,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786},
+{791,710,710,792,759,759,760,759,759,759,759,761,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759},
+{757,665,665,793,759,759,760,759,759,759,759,761,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759},
+{757,665,665,793,759,759,760,759,759,759,759,761,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759},
+{791,710,710,792,759,759,812,759,759,759,759,761,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759},
+{711,711,711,712,0,0,813,0,0,0,0,235,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{757,665,665,793,759,759,812,759,759,759,759,761,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759},
+{757,665,665,792,759,759,812,759,759,759,759,761,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759},
+{757,665,665,792,759,759,812,759,759,759,799,761,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759},
+{757,665,665,792,759,759,760,759,759,759,759,761,759,814,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759},
+{801,801,801,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{801,801,801,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{778,779,779,780,781,781,743,781,781,781,781,782,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781,781},
+{740,655,655,775,742,742,743,742,742,742,742,744,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,815,742,742,742,742,742,742},
+{804,749,749,790,786,786,787,786,786,786,786,788,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786},
+{784,706,706,805,786,786,787,786,786,786,786,788,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786},
+{804,749,749,790,786,786,816,786,786,786,786,788,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786},
+{749,749,749,712,0,0,813,0,0,0,0,235,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{784,706,706,805,786,786,816,786,786,786,786,788,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786},
+{784,706,706,790,786,786,816,786,786,786,786,788,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786},
+{784,706,706,790,786,786,816,786,786,786,811,788,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786},
+{784,706,706,790,786,786,787,786,786,786,786,788,786,817,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786},
+{794,795,795,796,797,797,760,797,797,797,797,798,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797,797},
+{635,635,635,635,635,635,0,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635,635},
+{757,665,665,792,759,759,760,759,759,759,759,761,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,818,759,759,759,759,759,759},
+{740,655,655,775,742,742,743,742,742,742,742,744,742,742,742,742,742,742,819,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742},
+{806,807,807,808,809,809,787,809,809,809,809,810,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809,809},
+{784,706,706,790,786,786,787,786,786,786,786,788,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,820,786,786,786,786,786,786},
+{757,665,665,792,759,759,760,759,759,759,759,761,759,759,759,759,759,759,821,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759},
+{740,655,655,775,742,742,743,742,742,742,742,744,742,742,822,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742},
+{784,706,706,790,786,786,787,786,786,786,786,788,786,786,786,786,786,786,823,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786},
+{757,665,665,792,759,759,760,759,759,759,759,761,759,759,824,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759},
+{740,655,655,775,742,742,743,742,742,742,825,744,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742},
+{784,706,706,790,786,786,787,786,786,786,786,788,786,786,826,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786},
+{757,665,665,792,759,759,760,759,759,759,827,761,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759},
+{740,655,655,775,742,742,743,742,742,742,742,744,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742,742},
+{784,706,706,790,786,786,787,786,786,786,828,788,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786},
+{757,665,665,792,759,759,760,759,759,759,759,761,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759,759},
+{784,706,706,790,786,786,787,786,786,786,786,788,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786,786},
+};
+static yyconst short yy_accept[829] = {0,0,0,0,0,0,0,0,13,0,0,0,12,0,0,0,0,0,0,0,0,0,145,145,92,92,89,85,87,22,81,81,114,114,65,65,114,96,88,86,114,95,90,91,83,97,114,82,84,114,114,75,58,114,94,93,1,1,62,62,62,23,72,72,72,72,63,72,73,65,62,62,62,63,72,61,50,143,143,143,143,143,139,139,138,137,137,136,120,120,120,13,10,5,5,6,6,56,52,59,59,53,12,18,36,36,28,41,35,30,26,26,35,46,46,48,135,135,135,92,92,133,133,133,54,32,0,0,104,98,108,109,2,0,110,81,81,102,77,0,65,67,99,103,107,111,113,67,105,100,101,0,0,0,0,0,0,0,106,1,0,1,63,2,17,72,21,24,0,69,65,67,67,71,60,63,0,0,9,43,64,44,0,142,0,0,0,136,0,0,119,10,10,11,5,7,4,3,56,55,59,59,18,18,19,36,28,28,29,33,37,37,38,35,30,30,31,26,26,27,34,46,47,45,0,0,134,0,0,0,0,0,0,0,0,0,112,2,0,76,81,77,0,68,67,67,0,80,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,2,25,51,70,65,67,67,0,71,0,0,63,43,64,0,140,0,141,10,10,10,11,15,10,3,18,18,18,19,14,18,28,28,28,29,40,28,39,38,30,30,30,31,30,26,26,26,27,26,47,0,0,0,0,0,0,0,0,0,0,81,68,67,0,80,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,67,0,0,71,0,0,0,0,71,140,140,141,141,10,10,10,10,10,18,18,18,18,18,28,28,28,28,28,39,38,30,30,30,30,30,26,26,26,26,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,67,67,0,71,0,0,0,0,0,10,10,10,10,10,10,10,18,18,18,18,14,18,18,28,28,28,28,28,28,28,30,30,30,30,30,30,30,26,26,26,26,26,26,26,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,81,0,0,0,0,0,0,0,0,0,0,130,128,118,0,0,0,124,67,67,0,0,0,0,0,0,0,71,0,71,10,10,18,18,28,28,30,30,26,26,0,0,0,0,0,0,0,0,0,74,0,0,0,0,0,0,0,132,118,116,0,126,124,0,66,0,0,0,0,0,71,0,0,0,0,0,0,74,74,81,81,81,81,78,78,116,122,126,66,0,71,0,0,0,0,0,0,0,0,0,0,0,81,81,81,81,81,81,78,78,78,0,78,0,122,66,71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,81,81,81,81,81,81,81,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,81,81,81,81,81,81,81,0,0,0,0,127,0,0,0,0,0,0,0,0,0,0,54,0,0,0,0,0,0,0,0,0,32,0,0,0,81,0,129,127,81,81,81,81,81,0,0,0,0,123,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,117,0,0,0,131,117,81,81,81,123,79,79,125,0,0,0,0,0,0,54,54,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,32,32,32,115,0,115,81,125,79,79,79,79,0,0,0,0,0,0,0,0,0,0,0,0,40,0,32,0,0,0,0,0,0,0,0,0,0,121,121,54,0,0,0,0,0,0,0,0,0,32,32,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0};
+static yyconst short yy_start_state[42] = {1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13,14,14,15,15,16,16,17,17,18,18,19,19,20,20,21,21};
+YY_DECL
+{
+	int yy_current_state;
+	char *yy_cp, *yy_bp, *yy_end, *yy_last;
+	int yy_act;
+	YY_BUFFER_STATE yy_b;
+	if (!YYG(yy_init))
+	{
+		YYG(yy_init) = 1;
+		if (!yyin)
+			yyin = stdin;
+		if (!yyout)
+			yyout = stdout;
+	}
+	{
+		/* code to execute during start of each call of yylex() */
+		token_start = NULL;
+	}
+	while (1)
+	{
+		if (YYG(yy_hold_ptr))
+		{
+			*YYG(yy_hold_ptr) = YYG(yy_hold_char);
+			YYG(yy_hold_ptr) = NULL;
+		}
+		if (!YY_CURRENT_BUFFER)
+			YY_CURRENT_BUFFER_LVALUE = yy_create_buffer(yyin, YY_BUF_SIZE);
+		yy_b = YY_CURRENT_BUFFER;
+		if (!yy_b->yy_filled)
+			yy_fill_buffer(yy_b);
+		yy_bp = yy_b->yy_ch_buf + yy_b->yy_pos;
+		if (yy_b->yy_pos >= yy_b->yy_n_chars)
+		{
+			yytext = yy_bp;
+			yyleng = 0;
+			switch (YY_START)
+			{
+				case 0:
+					yy_act = 144;
+					goto do_action;
+				case 1:
+					yy_act = 144;
+					goto do_action;
+				case 2:
+					yy_act = 144;
+					goto do_action;
+				case 3:
+					yy_act = 144;
+					goto do_action;
+				case 4:
+					yy_act = 144;
+					goto do_action;
+				case 5:
+					yy_act = 144;
+					goto do_action;
+				case 6:
+					yy_act = 144;
+					goto do_action;
+				case 7:
+					yy_act = 16;
+					goto do_action;
+				case 8:
+					yy_act = 8;
+					goto do_action;
+				case 9:
+					yy_act = 57;
+					goto do_action;
+				case 10:
+					yy_act = 57;
+					goto do_action;
+				case 11:
+					yy_act = 20;
+					goto do_action;
+				case 12:
+					yy_act = 42;
+					goto do_action;
+				case 13:
+					yy_act = 42;
+					goto do_action;
+				case 14:
+					yy_act = 42;
+					goto do_action;
+				case 15:
+					yy_act = 42;
+					goto do_action;
+				case 16:
+					yy_act = 49;
+					goto do_action;
+				case 17:
+					yy_act = 144;
+					goto do_action;
+				case 18:
+					yy_act = 144;
+					goto do_action;
+				case 19:
+					yy_act = 57;
+					goto do_action;
+				case 20:
+					yy_act = 42;
+					goto do_action;
+				default:
+					yyterminate();
+			}
+		}
+		yy_current_state = yy_start_state[YY_START * 2 + ((yy_b->yy_pos == 0 || yy_b->yy_ch_buf[yy_b->yy_pos - 1] == '\n') ? 1 : 0)];
+		yy_cp = yy_bp;
+		yy_end = yy_b->yy_ch_buf + yy_b->yy_n_chars;
+		yy_act = 0;
+		yy_last = NULL;
+		while (yy_cp < yy_end)
+		{
+			yy_current_state = yy_nxt[yy_current_state][yy_ec[(unsigned char) *yy_cp]];
+			if (yy_current_state == 0)
+				break;
+			yy_cp++;
+			if (yy_accept[yy_current_state])
+			{
+				yy_act = yy_accept[yy_current_state];
+				yy_last = yy_cp;
+			}
+		}
+		if (!yy_act)
+			YY_FATAL_ERROR("flex scanner jammed");
+		yy_cp = yy_last;
+		yytext = yy_bp;
+		yyleng = (int) (yy_cp - yy_bp);
+		YYG(yy_hold_ptr) = yy_cp;
+		YYG(yy_hold_char) = *yy_cp;
+		*yy_cp = '\0';
+		yy_b->yy_pos = (int) (yy_cp - yy_b->yy_ch_buf);
+		{
+			char *yyl;
+			for (yyl = yy_bp; yyl < yy_cp; yyl++)
+				if (*yyl == '\n')
+					yylineno++;
+		}
+do_action:
+		switch (yy_act)
+		{
+			case 1:
+YY_RULE_SETUP
+{ /* ignore */ }
+	YY_BREAK
+			case 2:
+YY_RULE_SETUP
+{
+					token_start = yytext;
+					state_before = YYSTATE;
+					xcdepth = 0;
+					BEGIN(xc);
+					/* Put back any characters past slash-star; see above */
+					yyless(2);
+					fputs("/*", yyout);
+				}
+	YY_BREAK
+			case 3:
+YY_RULE_SETUP
+{
+					xcdepth++;
+			 		/* Put back any characters past slash-star; see above */
+			 		yyless(2);
+					fputs("/*", yyout);
+				}
+	YY_BREAK
+			case 4:
+YY_RULE_SETUP
+{
+					ECHO;
+					if (xcdepth <= 0)
+					{
+						BEGIN(state_before);
+						token_start = NULL;
+					}
+					else
+						xcdepth--;
+				}
+	YY_BREAK
+			case 5:
+YY_RULE_SETUP
+{ ECHO; }
+	YY_BREAK
+			case 6:
+YY_RULE_SETUP
+{ ECHO; }
+	YY_BREAK
+			case 7:
+YY_RULE_SETUP
+{ ECHO; }
+	YY_BREAK
+			case 8:
+YY_RULE_SETUP
+{ mmerror(PARSE_ERROR, ET_FATAL, "unterminated /* comment"); }
+	YY_BREAK
+			case 9:
+YY_RULE_SETUP
+{
+					token_start = yytext;
+					BEGIN(xb);
+					startlit();
+					addlitchar('b');
+				}
+	YY_BREAK
+			case 10:
+			case 11:
+YY_RULE_SETUP
+{
+					yyless(1);
+					BEGIN(SQL);
+					if (literalbuf[strspn(literalbuf, "01") + 1] != '\0')
+						mmerror(PARSE_ERROR, ET_ERROR, "invalid bit string literal");
+					yylval.str = mm_strdup(literalbuf);
+					return BCONST;
+				}
+	YY_BREAK
+			case 12:
+			case 13:
+YY_RULE_SETUP
+{ addlit(yytext, yyleng); }
+	YY_BREAK
+			case 14:
+			case 15:
+YY_RULE_SETUP
+{ /* ignore */ }
+	YY_BREAK
+			case 16:
+YY_RULE_SETUP
+{ mmerror(PARSE_ERROR, ET_FATAL, "unterminated bit string literal"); }
+	YY_BREAK
+			case 17:
+YY_RULE_SETUP
+{
+					token_start = yytext;
+					BEGIN(xh);
+					startlit();
+					addlitchar('x');
+				}
+	YY_BREAK
+			case 18:
+			case 19:
+YY_RULE_SETUP
+{
+				yyless(1);
+				BEGIN(SQL);
+				yylval.str = mm_strdup(literalbuf);
+				return XCONST;
+			}
+	YY_BREAK
+			case 20:
+YY_RULE_SETUP
+{ mmerror(PARSE_ERROR, ET_FATAL, "unterminated hexadecimal string literal"); }
+	YY_BREAK
+			case 21:
+YY_RULE_SETUP
+{
+				/* National character.
+				 * Transfer it as-is to the backend.
+				 */
+				token_start = yytext;
+				state_before = YYSTATE;
+				BEGIN(xn);
+				startlit();
+			}
+	YY_BREAK
+			case 22:
+YY_RULE_SETUP
+{
+				token_start = yytext;
+				state_before = YYSTATE;
+				BEGIN(xqc);
+				startlit();
+			}
+	YY_BREAK
+			case 23:
+YY_RULE_SETUP
+{
+				token_start = yytext;
+				state_before = YYSTATE;
+				BEGIN(xq);
+				startlit();
+			}
+	YY_BREAK
+			case 24:
+YY_RULE_SETUP
+{
+				token_start = yytext;
+				state_before = YYSTATE;
+				BEGIN(xe);
+				startlit();
+			}
+	YY_BREAK
+			case 25:
+YY_RULE_SETUP
+{
+				token_start = yytext;
+				state_before = YYSTATE;
+				BEGIN(xus);
+				startlit();
+				addlit(yytext, yyleng);
+			}
+	YY_BREAK
+			case 26:
+			case 27:
+YY_RULE_SETUP
+{
+				yyless(1);
+				BEGIN(state_before);
+				yylval.str = mm_strdup(literalbuf);
+				return SCONST;
+			}
+	YY_BREAK
+			case 28:
+			case 29:
+YY_RULE_SETUP
+{
+				yyless(1);
+				BEGIN(state_before);
+				yylval.str = mm_strdup(literalbuf);
+				return ECONST;
+			}
+	YY_BREAK
+			case 30:
+			case 31:
+YY_RULE_SETUP
+{
+				yyless(1);
+				BEGIN(state_before);
+				yylval.str = mm_strdup(literalbuf);
+				return NCONST;
+			}
+	YY_BREAK
+			case 32:
+YY_RULE_SETUP
+{
+				addlit(yytext, yyleng);
+				BEGIN(state_before);
+				yylval.str = mm_strdup(literalbuf);
+				return UCONST;
+			}
+	YY_BREAK
+			case 33:
+YY_RULE_SETUP
+{ addlitchar('\''); }
+	YY_BREAK
+			case 34:
+YY_RULE_SETUP
+{
+				addlitchar('\\');
+				addlitchar('\'');
+			}
+	YY_BREAK
+			case 35:
+YY_RULE_SETUP
+{ addlit(yytext, yyleng); }
+	YY_BREAK
+			case 36:
+YY_RULE_SETUP
+{ addlit(yytext, yyleng); }
+	YY_BREAK
+			case 37:
+YY_RULE_SETUP
+{ addlit(yytext, yyleng); }
+	YY_BREAK
+			case 38:
+YY_RULE_SETUP
+{ addlit(yytext, yyleng); }
+	YY_BREAK
+			case 39:
+YY_RULE_SETUP
+{ addlit(yytext, yyleng); }
+	YY_BREAK
+			case 40:
+YY_RULE_SETUP
+{ /* ignore */ }
+	YY_BREAK
+			case 41:
+YY_RULE_SETUP
+{
+			   /* This is only needed for \ just before EOF */
+			   addlitchar(yytext[0]);
+			}
+	YY_BREAK
+			case 42:
+YY_RULE_SETUP
+{ mmerror(PARSE_ERROR, ET_FATAL, "unterminated quoted string"); }
+	YY_BREAK
+			case 43:
+YY_RULE_SETUP
+{
+				/* throw back all but the initial "$" */
+				yyless(1);
+				/* and treat it as {other} */
+				return yytext[0];	
+			}
+	YY_BREAK
+			case 44:
+YY_RULE_SETUP
+{
+				token_start = yytext;
+				dolqstart = mm_strdup(yytext);
+				BEGIN(xdolq);
+				startlit();
+				addlit(yytext, yyleng);
+			}
+	YY_BREAK
+			case 45:
+YY_RULE_SETUP
+{
+				if (strcmp(yytext, dolqstart) == 0)
+				{
+					addlit(yytext, yyleng);
+					free(dolqstart);
+					BEGIN(SQL);
+					yylval.str = mm_strdup(literalbuf);
+					return DOLCONST;
+				}
+				else
+				{
+			        /*
+			         * When we fail to match $...$ to dolqstart, transfer
+			         * the $... part to the output, but put back the final
+			         * $ for rescanning.  Consider $delim$...$junk$delim$
+			         */
+			        addlit(yytext, yyleng-1);
+			        yyless(yyleng-1);
+				}
+			}
+	YY_BREAK
+			case 46:
+YY_RULE_SETUP
+{ addlit(yytext, yyleng); }
+	YY_BREAK
+			case 47:
+YY_RULE_SETUP
+{ addlit(yytext, yyleng); }
+	YY_BREAK
+			case 48:
+YY_RULE_SETUP
+{
+				/* single quote or dollar sign */
+				addlitchar(yytext[0]);
+			}
+	YY_BREAK
+			case 49:
+YY_RULE_SETUP
+{ base_yyerror("unterminated dollar-quoted string"); }
+	YY_BREAK
+			case 50:
+YY_RULE_SETUP
+{
+						state_before = YYSTATE;
+						BEGIN(xd);
+						startlit();
+					}
+	YY_BREAK
+			case 51:
+YY_RULE_SETUP
+{
+						state_before = YYSTATE;
+						BEGIN(xui);
+						startlit();
+						addlit(yytext, yyleng);
+					}
+	YY_BREAK
+			case 52:
+YY_RULE_SETUP
+{
+						BEGIN(state_before);
+						if (literallen == 0)
+							mmerror(PARSE_ERROR, ET_ERROR, "zero-length delimited identifier");
+						/* The backend will truncate the identifier here. We do not as it does not change the result. */
+						yylval.str = mm_strdup(literalbuf);
+						return CSTRING;
+					}
+	YY_BREAK
+			case 53:
+YY_RULE_SETUP
+{
+						BEGIN(state_before);
+						yylval.str = mm_strdup(literalbuf);
+						return CSTRING;
+					}
+	YY_BREAK
+			case 54:
+YY_RULE_SETUP
+{
+						BEGIN(state_before);
+						if (literallen == 2) /* "U&" */
+							mmerror(PARSE_ERROR, ET_ERROR, "zero-length delimited identifier");
+						/* The backend will truncate the identifier here. We do not as it does not change the result. */
+						addlit(yytext, yyleng);
+						yylval.str = mm_strdup(literalbuf);
+						return UIDENT;
+					}
+	YY_BREAK
+			case 55:
+YY_RULE_SETUP
+{ addlitchar('"'); }
+	YY_BREAK
+			case 56:
+YY_RULE_SETUP
+{ addlit(yytext, yyleng); }
+	YY_BREAK
+			case 57:
+YY_RULE_SETUP
+{ mmerror(PARSE_ERROR, ET_FATAL, "unterminated quoted identifier"); }
+	YY_BREAK
+			case 58:
+YY_RULE_SETUP
+{
+						state_before = YYSTATE;
+						BEGIN(xdc);
+						startlit();
+					}
+	YY_BREAK
+			case 59:
+YY_RULE_SETUP
+{ addlit(yytext, yyleng); }
+	YY_BREAK
+			case 60:
+YY_RULE_SETUP
+{ return TYPECAST; }
+	YY_BREAK
+			case 61:
+YY_RULE_SETUP
+{
+			  /* are we simulating Informix? */
+				if (INFORMIX_MODE)
+				{
+					unput(':');
+				}
+				else
+					return yytext[0];
+				}
+	YY_BREAK
+			case 62:
+YY_RULE_SETUP
+{ /*
+					   * We may find a ';' inside a structure
+					   * definition in a TYPE or VAR statement.
+					   * This is not an EOL marker.
+					   */
+					  if (yytext[0] == ';' && struct_level == 0)
+						 BEGIN(C);
+					  return yytext[0];
+					}
+	YY_BREAK
+			case 63:
+YY_RULE_SETUP
+{
+						/*
+						 * Check for embedded slash-star or dash-dash; those
+						 * are comment starts, so operator must stop there.
+						 * Note that slash-star or dash-dash at the first
+						 * character will match a prior rule, not this one.
+						 */
+						int		nchars = yyleng;
+						char   *slashstar = strstr(yytext, "/*");
+						char   *dashdash = strstr(yytext, "--");
+
+						if (slashstar && dashdash)
+						{
+							/* if both appear, take the first one */
+							if (slashstar > dashdash)
+								slashstar = dashdash;
+						}
+						else if (!slashstar)
+							slashstar = dashdash;
+						if (slashstar)
+							nchars = slashstar - yytext;
+
+						/*
+						 * For SQL compatibility, '+' and '-' cannot be the
+						 * last char of a multi-char operator unless the operator
+						 * contains chars that are not in SQL operators.
+						 * The idea is to lex '=-' as two operators, but not
+						 * to forbid operator names like '?-' that could not be
+						 * sequences of SQL operators.
+						 */
+						while (nchars > 1 &&
+							   (yytext[nchars-1] == '+' ||
+								yytext[nchars-1] == '-'))
+						{
+							int		ic;
+
+							for (ic = nchars-2; ic >= 0; ic--)
+							{
+								if (strchr("~!@#^&|`?%", yytext[ic]))
+									break;
+							}
+							if (ic >= 0)
+								break; /* found a char that makes it OK */
+							nchars--; /* else remove the +/-, and check again */
+						}
+
+						if (nchars < yyleng)
+						{
+							/* Strip the unwanted chars from the token */
+							yyless(nchars);
+							/*
+							 * If what we have left is only one char, and it's
+							 * one of the characters matching "self", then
+							 * return it as a character token the same way
+							 * that the "self" rule would have.
+							 */
+							if (nchars == 1 &&
+								strchr(",()[].;:+-*/%^<>=", yytext[0]))
+								return yytext[0];
+						}
+
+						/* Convert "!=" operator to "<>" for compatibility */
+						if (strcmp(yytext, "!=") == 0)
+							yylval.str = mm_strdup("<>");
+						else
+							yylval.str = mm_strdup(yytext);
+						return Op;
+					}
+	YY_BREAK
+			case 64:
+YY_RULE_SETUP
+{
+						yylval.ival = atol(yytext+1);
+						return PARAM;
+					}
+	YY_BREAK
+			case 65:
+YY_RULE_SETUP
+{
+						long val;
+						char* endptr;
+
+						errno = 0;
+						val = strtol((char *)yytext, &endptr,10);
+						if (*endptr != '\0' || errno == ERANGE
+#ifdef HAVE_LONG_INT_64
+							/* if long > 32 bits, check for overflow of int4 */
+							|| val != (long) ((int32) val)
+#endif
+							)
+						{
+							errno = 0;
+							yylval.str = mm_strdup(yytext);
+							return FCONST;
+						}
+						yylval.ival = val;
+						return ICONST;
+					}
+	YY_BREAK
+			case 66:
+YY_RULE_SETUP
+{
+						yylval.str = mm_strdup(yytext);
+						return IP;
+				}
+	YY_BREAK
+			case 67:
+YY_RULE_SETUP
+{
+						yylval.str = mm_strdup(yytext);
+						return FCONST;
+			}
+	YY_BREAK
+			case 68:
+YY_RULE_SETUP
+{
+						yylval.str = mm_strdup(yytext);
+						return FCONST;
+			}
+	YY_BREAK
+			case 69:
+YY_RULE_SETUP
+{
+						yyless(yyleng-1);
+						yylval.str = mm_strdup(yytext);
+						return FCONST;
+					}
+	YY_BREAK
+			case 70:
+YY_RULE_SETUP
+{
+						yyless(yyleng-2);
+						yylval.str = mm_strdup(yytext);
+						return FCONST;
+					}
+	YY_BREAK
+			case 71:
+YY_RULE_SETUP
+{
+						yylval.str = mm_strdup(yytext+1);
+						return(CVARIABLE);
+					}
+	YY_BREAK
+			case 72:
+YY_RULE_SETUP
+{
+						const ScanKeyword    *keyword;
+						
+						if (!isdefine())
+						{
+							/* Is it an SQL/ECPG keyword? */
+							keyword = ScanECPGKeywordLookup(yytext);
+							if (keyword != NULL)
+								return keyword->value;
+
+							/* Is it a C keyword? */
+							keyword = ScanCKeywordLookup(yytext);
+							if (keyword != NULL)
+								return keyword->value;
+
+							/*
+							 * None of the above.  Return it as an identifier.
+							 *
+							 * The backend will attempt to truncate and case-fold
+							 * the identifier, but I see no good reason for ecpg
+							 * to do so; that's just another way that ecpg could get
+							 * out of step with the backend.
+							 */
+							yylval.str = mm_strdup(yytext);
+							return IDENT;
+						}
+					}
+	YY_BREAK
+			case 73:
+YY_RULE_SETUP
+{ return yytext[0]; }
+	YY_BREAK
+			case 74:
+YY_RULE_SETUP
+{ BEGIN(SQL); return SQL_START; }
+	YY_BREAK
+			case 75:
+YY_RULE_SETUP
+{ 
+						/* are we simulating Informix? */
+						if (INFORMIX_MODE)
+						{
+							BEGIN(SQL);
+							return SQL_START;
+						}
+						else
+							return S_ANYTHING;
+					 }
+	YY_BREAK
+			case 76:
+YY_RULE_SETUP
+{ ECHO; }
+	YY_BREAK
+			case 77:
+YY_RULE_SETUP
+{
+						char* endptr;
+
+						errno = 0;
+						yylval.ival = strtoul((char *)yytext,&endptr,16);
+						if (*endptr != '\0' || errno == ERANGE)
+						{
+							errno = 0;
+							yylval.str = mm_strdup(yytext);
+							return SCONST;
+						}
+						return ICONST;
+					}
+	YY_BREAK
+			case 78:
+YY_RULE_SETUP
+{
+						if (system_includes)
+						{
+							include_next = false;
+							BEGIN(incl);
+						}
+						else
+					 	{
+							yylval.str = mm_strdup(yytext);
+							return(CPP_LINE);
+					  	}
+					}
+	YY_BREAK
+			case 79:
+YY_RULE_SETUP
+{
+						if (system_includes)
+						{
+							include_next = true;
+							BEGIN(incl);
+						}
+						else
+					 	{
+							yylval.str = mm_strdup(yytext);
+							return(CPP_LINE);
+					  	}
+					}
+	YY_BREAK
+			case 80:
+YY_RULE_SETUP
+{
+						yylval.str = mm_strdup(yytext);
+						return(CPP_LINE);
+					}
+	YY_BREAK
+			case 81:
+YY_RULE_SETUP
+{
+						const ScanKeyword		*keyword;
+
+						/*
+						 * Try to detect a function name:
+						 * look for identifiers at the global scope
+						 * keep the last identifier before the first '(' and '{' */
+						if (braces_open == 0 && parenths_open == 0)
+						{
+							if (current_function)
+								free(current_function);
+							current_function = mm_strdup(yytext);
+						}
+						/* Informix uses SQL defines only in SQL space */
+						/* however, some defines have to be taken care of for compatibility */
+						if ((!INFORMIX_MODE || !isinformixdefine()) && !isdefine())
+						{
+							keyword = ScanCKeywordLookup(yytext);
+							if (keyword != NULL)
+								return keyword->value;
+							else
+							{
+								yylval.str = mm_strdup(yytext);
+								return IDENT;
+							}
+						}
+					}
+	YY_BREAK
+			case 82:
+YY_RULE_SETUP
+{ return(':'); }
+	YY_BREAK
+			case 83:
+YY_RULE_SETUP
+{ return(';'); }
+	YY_BREAK
+			case 84:
+YY_RULE_SETUP
+{ return(','); }
+	YY_BREAK
+			case 85:
+YY_RULE_SETUP
+{ return('*'); }
+	YY_BREAK
+			case 86:
+YY_RULE_SETUP
+{ return('%'); }
+	YY_BREAK
+			case 87:
+YY_RULE_SETUP
+{ return('/'); }
+	YY_BREAK
+			case 88:
+YY_RULE_SETUP
+{ return('+'); }
+	YY_BREAK
+			case 89:
+YY_RULE_SETUP
+{ return('-'); }
+	YY_BREAK
+			case 90:
+YY_RULE_SETUP
+{ parenths_open++; return('('); }
+	YY_BREAK
+			case 91:
+YY_RULE_SETUP
+{ parenths_open--; return(')'); }
+	YY_BREAK
+			case 92:
+YY_RULE_SETUP
+{ ECHO; }
+	YY_BREAK
+			case 93:
+YY_RULE_SETUP
+{ return('{'); }
+	YY_BREAK
+			case 94:
+YY_RULE_SETUP
+{ return('}'); }
+	YY_BREAK
+			case 95:
+YY_RULE_SETUP
+{ return('['); }
+	YY_BREAK
+			case 96:
+YY_RULE_SETUP
+{ return(']'); }
+	YY_BREAK
+			case 97:
+YY_RULE_SETUP
+{ return('='); }
+	YY_BREAK
+			case 98:
+YY_RULE_SETUP
+{ return(S_MEMBER); }
+	YY_BREAK
+			case 99:
+YY_RULE_SETUP
+{ return(S_RSHIFT); }
+	YY_BREAK
+			case 100:
+YY_RULE_SETUP
+{ return(S_LSHIFT); }
+	YY_BREAK
+			case 101:
+YY_RULE_SETUP
+{ return(S_OR); }
+	YY_BREAK
+			case 102:
+YY_RULE_SETUP
+{ return(S_AND); }
+	YY_BREAK
+			case 103:
+YY_RULE_SETUP
+{ return(S_INC); }
+	YY_BREAK
+			case 104:
+YY_RULE_SETUP
+{ return(S_DEC); }
+	YY_BREAK
+			case 105:
+YY_RULE_SETUP
+{ return(S_EQUAL); }
+	YY_BREAK
+			case 106:
+YY_RULE_SETUP
+{ return(S_NEQUAL); }
+	YY_BREAK
+			case 107:
+YY_RULE_SETUP
+{ return(S_ADD); }
+	YY_BREAK
+			case 108:
+YY_RULE_SETUP
+{ return(S_SUB); }
+	YY_BREAK
+			case 109:
+YY_RULE_SETUP
+{ return(S_MUL); }
+	YY_BREAK
+			case 110:
+YY_RULE_SETUP
+{ return(S_DIV); }
+	YY_BREAK
+			case 111:
+YY_RULE_SETUP
+{ return(S_MOD); }
+	YY_BREAK
+			case 112:
+YY_RULE_SETUP
+{ return(S_MEMPOINT); }
+	YY_BREAK
+			case 113:
+YY_RULE_SETUP
+{ return(S_DOTPOINT); }
+	YY_BREAK
+			case 114:
+YY_RULE_SETUP
+{ return S_ANYTHING; }
+	YY_BREAK
+			case 115:
+YY_RULE_SETUP
+{ BEGIN(def_ident); }
+	YY_BREAK
+			case 116:
+YY_RULE_SETUP
+{
+						/* are we simulating Informix? */
+						if (INFORMIX_MODE)
+						{
+							BEGIN(def_ident);
+						}
+						else
+						{
+							yyless(1);
+							return (S_ANYTHING);
+						}
+					}
+	YY_BREAK
+			case 117:
+YY_RULE_SETUP
+{ BEGIN(undef); }
+	YY_BREAK
+			case 118:
+YY_RULE_SETUP
+{
+						/* are we simulating Informix? */
+						if (INFORMIX_MODE)
+						{
+							BEGIN(undef);
+						}
+						else
+						{
+							yyless(1);
+							return (S_ANYTHING);
+						}
+					}
+	YY_BREAK
+			case 119:
+YY_RULE_SETUP
+{
+					struct _defines *ptr, *ptr2 = NULL;
+					int i;
+
+					/*
+					 *	Skip the ";" and trailing whitespace. Note that yytext
+					 *	contains at least one non-space character plus the ";"
+					 */
+					for (i = strlen(yytext)-2;
+						 i > 0 && ecpg_isspace(yytext[i]);
+						 i-- )
+						;
+					yytext[i+1] = '\0';
+
+
+					for (ptr = defines; ptr != NULL; ptr2 = ptr, ptr = ptr->next)
+					{
+						if (strcmp(yytext, ptr->old) == 0)
+						{
+							if (ptr2 == NULL)
+								defines = ptr->next;
+							else
+								ptr2->next = ptr->next;
+							free(ptr->new);
+							free(ptr->old);
+							free(ptr);
+							break;
+						}
+					}
+
+					BEGIN(C);
+				}
+	YY_BREAK
+			case 120:
+YY_RULE_SETUP
+{
+		                	mmerror(PARSE_ERROR, ET_FATAL, "missing identifier in EXEC SQL UNDEF command");
+			                yyterminate();
+				}
+	YY_BREAK
+			case 121:
+YY_RULE_SETUP
+{ BEGIN(incl); }
+	YY_BREAK
+			case 122:
+YY_RULE_SETUP
+{ 
+					  /* are we simulating Informix? */
+					  if (INFORMIX_MODE)
+					  {
+						  BEGIN(incl);
+					  }
+					  else
+					  {
+						  yyless(1);
+						  return (S_ANYTHING);
+					  }
+					}
+	YY_BREAK
+			case 123:
+YY_RULE_SETUP
+{ ifcond = TRUE; BEGIN(xcond); }
+	YY_BREAK
+			case 124:
+YY_RULE_SETUP
+{ 
+					  /* are we simulating Informix? */
+					  if (INFORMIX_MODE)
+					  {
+						  ifcond = TRUE;
+						  BEGIN(xcond);
+					  }
+					  else
+					  {
+						  yyless(1);
+						  return (S_ANYTHING);
+					  }
+					}
+	YY_BREAK
+			case 125:
+YY_RULE_SETUP
+{ ifcond = FALSE; BEGIN(xcond); }
+	YY_BREAK
+			case 126:
+YY_RULE_SETUP
+{ 
+					  /* are we simulating Informix? */
+					  if (INFORMIX_MODE)
+					  {
+						  ifcond = FALSE;
+						  BEGIN(xcond);
+					  }
+					  else
+					  {
+						  yyless(1);
+						  return (S_ANYTHING);
+					  }
+					}
+	YY_BREAK
+			case 127:
+YY_RULE_SETUP
+{	/* pop stack */
+						if ( preproc_tos == 0 ) {
+							mmerror(PARSE_ERROR, ET_FATAL, "missing matching \"EXEC SQL IFDEF\" / \"EXEC SQL IFNDEF\"");
+						}
+						else if ( stacked_if_value[preproc_tos].else_branch )
+							mmerror(PARSE_ERROR, ET_FATAL, "missing \"EXEC SQL ENDIF;\"");
+						else
+							preproc_tos--;
+
+						ifcond = TRUE; BEGIN(xcond);
+					}
+	YY_BREAK
+			case 128:
+YY_RULE_SETUP
+{ 
+					/* are we simulating Informix? */
+					if (INFORMIX_MODE)
+					{
+						if (preproc_tos == 0)
+							mmerror(PARSE_ERROR, ET_FATAL, "missing matching \"EXEC SQL IFDEF\" / \"EXEC SQL IFNDEF\"");
+						else if (stacked_if_value[preproc_tos].else_branch)
+							mmerror(PARSE_ERROR, ET_FATAL, "missing \"EXEC SQL ENDIF;\"");
+						else
+							preproc_tos--;
+
+						ifcond = TRUE;
+						BEGIN(xcond);
+					}
+					else
+					{
+						yyless(1);
+						return (S_ANYTHING);
+					}
+				}
+	YY_BREAK
+			case 129:
+YY_RULE_SETUP
+{	/* only exec sql endif pops the stack, so take care of duplicated 'else' */
+					if (stacked_if_value[preproc_tos].else_branch)
+						mmerror(PARSE_ERROR, ET_FATAL, "more than one EXEC SQL ELSE");
+					else
+					{
+						stacked_if_value[preproc_tos].else_branch = TRUE;
+						stacked_if_value[preproc_tos].condition =
+							(stacked_if_value[preproc_tos-1].condition &&
+							 !stacked_if_value[preproc_tos].condition);
+
+						if (stacked_if_value[preproc_tos].condition)
+							BEGIN(C);
+						else
+							BEGIN(xskip);
+					}
+				}
+	YY_BREAK
+			case 130:
+YY_RULE_SETUP
+{
+					/* are we simulating Informix? */
+					if (INFORMIX_MODE)
+					{
+						if (stacked_if_value[preproc_tos].else_branch)
+							mmerror(PARSE_ERROR, ET_FATAL, "more than one EXEC SQL ELSE");
+						else
+						{
+							stacked_if_value[preproc_tos].else_branch = TRUE;
+							stacked_if_value[preproc_tos].condition =
+							(stacked_if_value[preproc_tos-1].condition &&
+							 !stacked_if_value[preproc_tos].condition);
+
+							if (stacked_if_value[preproc_tos].condition)
+								BEGIN(C);
+							else
+								BEGIN(xskip);
+						}
+					}
+					else
+					{
+						yyless(1);
+						return (S_ANYTHING);
+					}
+				}
+	YY_BREAK
+			case 131:
+YY_RULE_SETUP
+{
+					if (preproc_tos == 0)
+						mmerror(PARSE_ERROR, ET_FATAL, "unmatched EXEC SQL ENDIF");
+					else
+						preproc_tos--;
+
+					if (stacked_if_value[preproc_tos].condition)
+					   BEGIN(C);
+					else
+					   BEGIN(xskip);
+				}
+	YY_BREAK
+			case 132:
+YY_RULE_SETUP
+{
+					/* are we simulating Informix? */
+					if (INFORMIX_MODE)
+					{
+						if (preproc_tos == 0)
+							mmerror(PARSE_ERROR, ET_FATAL, "unmatched EXEC SQL ENDIF");
+						else
+							preproc_tos--;
+
+						if (stacked_if_value[preproc_tos].condition)
+							BEGIN(C);
+						else
+							BEGIN(xskip);
+					}
+					else
+					{
+						yyless(1);
+						return (S_ANYTHING);
+					}
+				}
+	YY_BREAK
+			case 133:
+YY_RULE_SETUP
+{ /* ignore */ }
+	YY_BREAK
+			case 134:
+YY_RULE_SETUP
+{
+					if (preproc_tos >= MAX_NESTED_IF-1)
+						mmerror(PARSE_ERROR, ET_FATAL, "too many nested EXEC SQL IFDEF conditions");
+					else 
+					{
+						struct _defines *defptr;
+						unsigned int i;
+
+						/*
+						 *	Skip the ";" and trailing whitespace. Note that yytext
+						 *	contains at least one non-space character plus the ";"
+						 */
+						for (i = strlen(yytext)-2;
+							 i > 0 && ecpg_isspace(yytext[i]);
+							 i-- )
+							;
+						yytext[i+1] = '\0';
+
+						for (defptr = defines;
+							 defptr != NULL && strcmp(yytext, defptr->old) != 0;
+							 defptr = defptr->next);
+
+						preproc_tos++;
+						stacked_if_value[preproc_tos].else_branch = FALSE;
+						stacked_if_value[preproc_tos].condition =
+						(defptr ? ifcond : !ifcond) && stacked_if_value[preproc_tos-1].condition;
+					}
+
+					if (stacked_if_value[preproc_tos].condition)
+						BEGIN(C);
+					else
+						BEGIN(xskip);
+				}
+	YY_BREAK
+			case 135:
+YY_RULE_SETUP
+{
+				mmerror(PARSE_ERROR, ET_FATAL, "missing identifier in EXEC SQL IFDEF command");
+				yyterminate();
+			}
+	YY_BREAK
+			case 136:
+YY_RULE_SETUP
+{
+				old = mm_strdup(yytext);
+				BEGIN(def);
+				startlit();
+			}
+	YY_BREAK
+			case 137:
+YY_RULE_SETUP
+{
+				mmerror(PARSE_ERROR, ET_FATAL, "missing identifier in EXEC SQL DEFINE command");
+				yyterminate();
+			}
+	YY_BREAK
+			case 138:
+YY_RULE_SETUP
+{
+						struct _defines *ptr, *this;
+
+						for (ptr = defines; ptr != NULL; ptr = ptr->next)
+						{
+							 if (strcmp(old, ptr->old) == 0)
+							 {
+								free(ptr->new);
+								ptr->new = mm_strdup(literalbuf);
+							 }
+						}
+						if (ptr == NULL)
+						{
+							this = (struct _defines *) mm_alloc(sizeof(struct _defines));
+
+							/* initial definition */
+							this->old = old;
+							this->new = mm_strdup(literalbuf);
+							this->next = defines;
+							this->used = NULL;
+							defines = this;
+						}
+
+						BEGIN(C);
+					}
+	YY_BREAK
+			case 139:
+YY_RULE_SETUP
+{ addlit(yytext, yyleng); }
+	YY_BREAK
+			case 140:
+YY_RULE_SETUP
+{	parse_include(); }
+	YY_BREAK
+			case 141:
+YY_RULE_SETUP
+{	parse_include(); }
+	YY_BREAK
+			case 142:
+YY_RULE_SETUP
+{ parse_include(); }
+	YY_BREAK
+			case 143:
+YY_RULE_SETUP
+{
+					mmerror(PARSE_ERROR, ET_FATAL, "syntax error in EXEC SQL INCLUDE command");
+					yyterminate();
+				}
+	YY_BREAK
+			case 144:
+YY_RULE_SETUP
+{
+			  		if (yy_buffer == NULL)
+					{
+				  		if ( preproc_tos > 0 ) 
+						{
+					  		preproc_tos = 0;
+							mmerror(PARSE_ERROR, ET_FATAL, "missing \"EXEC SQL ENDIF;\"");
+				  		}
+						yyterminate();
+					}
+			  		else
+			  		{
+						struct _yy_buffer *yb = yy_buffer;
+						int i;
+						struct _defines *ptr;
+
+						for (ptr = defines; ptr; ptr = ptr->next)
+							if (ptr->used == yy_buffer)
+							{
+								ptr->used = NULL;
+								break;
+							}
+								
+						if (yyin != NULL)
+							fclose(yyin);
+
+						yy_delete_buffer( YY_CURRENT_BUFFER );
+						yy_switch_to_buffer(yy_buffer->buffer);
+
+						yylineno = yy_buffer->lineno;
+
+						/* We have to output the filename only if we change files here */
+						i = strcmp(input_filename, yy_buffer->filename);
+
+						free(input_filename);
+						input_filename = yy_buffer->filename;
+
+						yy_buffer = yy_buffer->next;
+						free(yb);
+
+						if (i != 0)
+							output_line_number();
+						
+			  		}
+				}
+	YY_BREAK
+			case 145:
+YY_RULE_SETUP
+{ mmerror(PARSE_ERROR, ET_FATAL, "internal error: unreachable state; please report this to <pgsql-bugs@postgresql.org>"); }
+	YY_BREAK
+			default:
+				YY_FATAL_ERROR("fatal flex scanner internal error--no action found");
+		}
+	}
+}
+
+static void
+yy_fatal_error(yyconst char *msg)
+{
+	(void) fprintf(stderr, "%s\n", msg);
+	exit(2);
+}
+
+static void
+yy_fill_buffer(YY_BUFFER_STATE b)
+{
+	yy_size_t	size = 16384;
+	yy_size_t	n = 0;
+
+	b->yy_ch_buf = (char *) yyalloc(size + 2);
+	if (!b->yy_ch_buf)
+		YY_FATAL_ERROR("out of dynamic memory in yy_fill_buffer()");
+	if (b->yy_input_file)
+	{
+		for (;;)
+		{
+			size_t		r;
+
+			if (n == size)
+			{
+				size *= 2;
+				b->yy_ch_buf = (char *) yyrealloc(b->yy_ch_buf, size + 2);
+				if (!b->yy_ch_buf)
+					YY_FATAL_ERROR("out of dynamic memory in yy_fill_buffer()");
+			}
+			r = fread(b->yy_ch_buf + n, 1, size - n, b->yy_input_file);
+			if (r == 0)
+			{
+				if (ferror(b->yy_input_file) && errno == EINTR)
+				{
+					clearerr(b->yy_input_file);
+					continue;
+				}
+				break;
+			}
+			n += r;
+		}
+	}
+	b->yy_ch_buf[n] = b->yy_ch_buf[n + 1] = YY_END_OF_BUFFER_CHAR;
+	b->yy_n_chars = (int) n;
+	b->yy_buf_size = size;
+	b->yy_pos = 0;
+	b->yy_filled = 1;
+	b->yy_is_our_buffer = 1;
+}
+
+void
+yyrestart(FILE *input_file)
+{
+
+	if (YYG(yy_hold_ptr))
+	{
+		*YYG(yy_hold_ptr) = YYG(yy_hold_char);
+		YYG(yy_hold_ptr) = NULL;
+	}
+	if (YY_CURRENT_BUFFER)
+		yy_delete_buffer(YY_CURRENT_BUFFER);
+	YY_CURRENT_BUFFER_LVALUE = yy_create_buffer(input_file, YY_BUF_SIZE);
+}
+
+void
+yy_switch_to_buffer(YY_BUFFER_STATE new_buffer)
+{
+
+	if (YYG(yy_hold_ptr))
+	{
+		*YYG(yy_hold_ptr) = YYG(yy_hold_char);
+		YYG(yy_hold_ptr) = NULL;
+	}
+	YY_CURRENT_BUFFER_LVALUE = new_buffer;
+}
+
+YY_BUFFER_STATE
+yy_create_buffer(FILE *file, int size)
+{
+	YY_BUFFER_STATE b;
+
+	(void) size;
+	b = (YY_BUFFER_STATE) yyalloc(sizeof(struct yy_buffer_state));
+	if (!b)
+		YY_FATAL_ERROR("out of dynamic memory in yy_create_buffer()");
+	memset(b, 0, sizeof(struct yy_buffer_state));
+	b->yy_input_file = file;
+	return b;
+}
+
+void
+yy_delete_buffer(YY_BUFFER_STATE b)
+{
+
+	if (!b)
+		return;
+	if (b == YY_CURRENT_BUFFER)
+	{
+		if (YYG(yy_hold_ptr))
+		{
+			*YYG(yy_hold_ptr) = YYG(yy_hold_char);
+			YYG(yy_hold_ptr) = NULL;
+		}
+		YY_CURRENT_BUFFER_LVALUE = NULL;
+	}
+	if (b->yy_is_our_buffer && b->yy_ch_buf)
+		yyfree(b->yy_ch_buf);
+	yyfree(b);
+}
+
+void
+yy_flush_buffer(YY_BUFFER_STATE b)
+{
+	if (!b)
+		return;
+	b->yy_pos = b->yy_n_chars;
+}
+
+YY_BUFFER_STATE
+yy_scan_buffer(char *base, yy_size_t size)
+{
+	YY_BUFFER_STATE b;
+
+	if (size < 2 ||
+		base[size - 2] != YY_END_OF_BUFFER_CHAR ||
+		base[size - 1] != YY_END_OF_BUFFER_CHAR)
+		return NULL;
+	b = (YY_BUFFER_STATE) yyalloc(sizeof(struct yy_buffer_state));
+	if (!b)
+		YY_FATAL_ERROR("out of dynamic memory in yy_scan_buffer()");
+	memset(b, 0, sizeof(struct yy_buffer_state));
+	b->yy_ch_buf = base;
+	b->yy_buf_size = size - 2;
+	b->yy_n_chars = (int) (size - 2);
+	b->yy_pos = 0;
+	b->yy_filled = 1;
+	b->yy_is_our_buffer = 0;
+	yy_switch_to_buffer(b);
+	return b;
+}
+
+YY_BUFFER_STATE
+yy_scan_string(yyconst char *yystr)
+{
+	return yy_scan_bytes(yystr, (int) strlen(yystr));
+}
+
+YY_BUFFER_STATE
+yy_scan_bytes(yyconst char *yybytes, int len)
+{
+	YY_BUFFER_STATE b;
+	char	   *buf;
+
+	buf = (char *) yyalloc(len + 2);
+	if (!buf)
+		YY_FATAL_ERROR("out of dynamic memory in yy_scan_bytes()");
+	memcpy(buf, yybytes, len);
+	buf[len] = buf[len + 1] = YY_END_OF_BUFFER_CHAR;
+	b = yy_scan_buffer(buf, len + 2);
+	if (!b)
+		YY_FATAL_ERROR("bad buffer in yy_scan_bytes()");
+	b->yy_is_our_buffer = 1;
+	return b;
+}
+
+int
+yylex_destroy(void)
+{
+	if (YY_CURRENT_BUFFER)
+		yy_delete_buffer(YY_CURRENT_BUFFER);
+	yy_init = 0;
+	yy_start = 0;
+	return 0;
+}
+void *
+yyalloc(yy_size_t size)
+{
+	return malloc(size);
+}
+void *
+yyrealloc(void *ptr, yy_size_t size)
+{
+	return realloc(ptr, size);
+}
+void
+yyfree(void *ptr)
+{
+	free(ptr);
+}
+
+/* user code */
+void
+lex_init(void)
+{
+	braces_open = 0;
+	parenths_open = 0;
+	current_function = NULL;
+
+	preproc_tos = 0;
+	yylineno = 1;
+	ifcond = TRUE;
+	stacked_if_value[preproc_tos].condition = ifcond;
+	stacked_if_value[preproc_tos].else_branch = FALSE;
+
+	/* initialize literal buffer to a reasonable but expansible size */
+	if (literalbuf == NULL)
+	{
+		literalalloc = 1024;
+		literalbuf = (char *) malloc(literalalloc);
+	}
+	startlit();
+
+	BEGIN(C);
+}
+
+static void
+addlit(char *ytext, int yleng)
+{
+	/* enlarge buffer if needed */
+	if ((literallen+yleng) >= literalalloc)
+	{
+		do 
+			literalalloc *= 2;
+		while ((literallen+yleng) >= literalalloc);
+		literalbuf = (char *) realloc(literalbuf, literalalloc);
+	}
+	/* append new data, add trailing null */
+	memcpy(literalbuf+literallen, ytext, yleng);
+	literallen += yleng;
+	literalbuf[literallen] = '\0';
+}
+
+static void
+addlitchar(unsigned char ychar)
+{
+	/* enlarge buffer if needed */
+        if ((literallen+1) >= literalalloc)
+        {
+                literalalloc *= 2;
+                literalbuf = (char *) realloc(literalbuf, literalalloc);
+        }
+	/* append new data, add trailing null */
+	literalbuf[literallen] = ychar;
+	literallen += 1;
+	literalbuf[literallen] = '\0';
+}
+
+static void
+parse_include(void)
+{
+	/* got the include file name */
+	struct _yy_buffer *yb;
+  	struct _include_path *ip;
+  	char inc_file[MAXPGPATH];
+  	unsigned int i;
+
+  	yb = mm_alloc(sizeof(struct _yy_buffer));
+
+  	yb->buffer =	YY_CURRENT_BUFFER;
+  	yb->lineno = yylineno;
+  	yb->filename = input_filename;
+  	yb->next = yy_buffer;
+
+  	yy_buffer = yb;
+
+  	/*
+	 * skip the ";" if there is one and trailing whitespace. Note that
+	 * yytext contains at least one non-space character plus the ";" 
+	 */
+  	for (i = strlen(yytext)-2;
+		 i > 0 && ecpg_isspace(yytext[i]);
+		 i--)
+		;
+
+	if (yytext[i] == ';')
+		i--;
+
+	yytext[i+1] = '\0';
+	
+	yyin = NULL;
+
+	/* If file name is enclosed in '"' remove these and look only in '.' */
+	/* Informix does look into all include paths though, except filename starts with '/' */
+	if (yytext[0] == '"' && yytext[i] == '"' &&
+	    ((compat != ECPG_COMPAT_INFORMIX && compat != ECPG_COMPAT_INFORMIX_SE) || yytext[1] == '/'))
+	{
+		yytext[i] = '\0';
+		memmove(yytext, yytext+1, strlen(yytext));
+	
+		strncpy(inc_file, yytext, sizeof(inc_file));
+		yyin = fopen(inc_file, "r");
+		if (!yyin)
+		{
+			if (strcmp(inc_file + strlen(inc_file) - 2, ".h"))
+			{
+				strcat(inc_file, ".h");
+				yyin = fopen(inc_file, "r");
+			}
+		}
+		
+	}
+	else
+	{
+		if ((yytext[0] == '"' && yytext[i] == '"') || (yytext[0] == '<' && yytext[i] == '>'))
+		{
+			yytext[i] = '\0';
+			memmove(yytext, yytext+1, strlen(yytext));
+		}
+		
+	  	for (ip = include_paths; yyin == NULL && ip != NULL; ip = ip->next)
+	  	{
+			if (strlen(ip->path) + strlen(yytext) + 3 > MAXPGPATH)
+			{
+				fprintf(stderr, _("Error: include path \"%s/%s\" is too long on line %d, skipping\n"), ip->path, yytext, yylineno);
+				continue;
+			}
+			snprintf (inc_file, sizeof(inc_file), "%s/%s", ip->path, yytext);
+			yyin = fopen(inc_file, "r");
+			if (!yyin)
+			{
+				if (strcmp(inc_file + strlen(inc_file) - 2, ".h"))
+				{
+					strcat(inc_file, ".h");
+					yyin = fopen( inc_file, "r" );
+				}
+			}
+			/* if the command was "include_next" we have to disregard the first hit */
+			if (yyin && include_next)
+			{
+				yyin = NULL;
+				include_next = false;
+			}
+		}
+	}
+	if (!yyin)
+		mmerror(NO_INCLUDE_FILE, ET_FATAL, "could not open include file \"%s\" on line %d", yytext, yylineno);
+
+	input_filename = mm_strdup(inc_file);
+	yy_switch_to_buffer(yy_create_buffer(yyin,YY_BUF_SIZE ));
+	yylineno = 1;
+	output_line_number();
+
+  	BEGIN(C);
+}
+
+/*
+ * ecpg_isspace() --- return TRUE if flex scanner considers char whitespace
+ */
+static bool
+ecpg_isspace(char ch)
+{
+	if (ch == ' ' ||
+		ch == '\t' ||
+		ch == '\n' ||
+		ch == '\r' ||
+		ch == '\f')
+		return true;
+	return false;
+}
+
+static bool isdefine(void)
+{
+	struct _defines *ptr;
+
+	/* is it a define? */
+	for (ptr = defines; ptr; ptr = ptr->next)
+	{
+		if (strcmp(yytext, ptr->old) == 0 && ptr->used == NULL)
+		{
+			struct _yy_buffer *yb;
+
+			yb = mm_alloc(sizeof(struct _yy_buffer));
+
+			yb->buffer =  YY_CURRENT_BUFFER;
+			yb->lineno = yylineno;
+			yb->filename = mm_strdup(input_filename);
+			yb->next = yy_buffer;
+
+			ptr->used = yy_buffer = yb;
+
+			yy_scan_string(ptr->new);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool isinformixdefine(void)
+{
+	const char *new = NULL;
+
+	if (strcmp(yytext, "dec_t") == 0)
+		new = "decimal";
+	else if (strcmp(yytext, "intrvl_t") == 0)
+	        new = "interval";
+	else if (strcmp(yytext, "dtime_t") == 0)
+                new = "timestamp";
+
+	if (new)
+	{
+		struct _yy_buffer *yb;
+
+		yb = mm_alloc(sizeof(struct _yy_buffer));
+
+		yb->buffer =  YY_CURRENT_BUFFER;
+		yb->lineno = yylineno;
+		yb->filename = mm_strdup(input_filename);
+		yb->next = yy_buffer;
+		yy_buffer = yb;
+
+		yy_scan_string(new);
+		return true;
+	}
+
+	return false;
+}
+
+/*
+ * Called before any actual parsing is done
+ */
+void
+scanner_init(const char *str)
+{
+	Size	slen = strlen(str);
+
+	/*
+	 * Might be left over after ereport()
+	 */
+	if (YY_CURRENT_BUFFER)
+		yy_delete_buffer(YY_CURRENT_BUFFER);
+
+	/*
+	 * Make a scan buffer with special termination needed by flex.
+	 */
+	scanbuf = mm_alloc(slen + 2);
+	memcpy(scanbuf, str, slen);
+	scanbuf[slen] = scanbuf[slen + 1] = YY_END_OF_BUFFER_CHAR;
+	scanbufhandle = yy_scan_buffer(scanbuf, slen + 2);
+
+	/* initialize literal buffer to a reasonable but expansible size */
+	literalalloc = 128;
+	literalbuf = (char *) mm_alloc(literalalloc);
+	startlit();
+
+	BEGIN(INITIAL);
+}
+
+
+/*
+ * Called after parsing is done to clean up after scanner_init()
+ */
+void
+scanner_finish(void)
+{
+	yy_delete_buffer(scanbufhandle);
+	free(scanbuf);
+}
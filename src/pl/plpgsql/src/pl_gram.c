@@ -0,0 +1,5248 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+/* Substitute the variable and function names.  */
+#define yyparse         plpgsql_yyparse
+#define yylex           plpgsql_yylex
+#define yyerror         plpgsql_yyerror
+#define yydebug         plpgsql_yydebug
+#define yynerrs         plpgsql_yynerrs
+#define yylval          plpgsql_yylval
+#define yychar          plpgsql_yychar
+#define yylloc          plpgsql_yylloc
+
+/* First part of user prologue.  */
+#line 1 "gram.y"
+
+/*-------------------------------------------------------------------------
+ *
+ * gram.y				- Parser for the PL/pgSQL procedural language
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *	  $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#include "plpgsql.h"
+
+#include "catalog/namespace.h"
+#include "catalog/pg_type.h"
+#include "parser/parser.h"
+#include "parser/parse_type.h"
+#include "parser/scanner.h"
+#include "parser/scansup.h"
+
+
+/* Location tracking support --- simpler than bison's default */
+#define YYLLOC_DEFAULT(Current, Rhs, N) \
+	do { \
+		if (N) \
+			(Current) = (Rhs)[1]; \
+		else \
+			(Current) = (Rhs)[0]; \
+	} while (0)
+
+/*
+ * Bison doesn't allocate anything that needs to live across parser calls,
+ * so we can easily have it use palloc instead of malloc.  This prevents
+ * memory leaks if we error out during parsing.  Note this only works with
+ * bison >= 2.0.  However, in bison 1.875 the default is to use alloca()
+ * if possible, so there's not really much problem anyhow, at least if
+ * you're building with gcc.
+ */
+#define YYMALLOC palloc
+#define YYFREE   pfree
+
+
+typedef struct
+{
+	int			location;
+	int			leaderlen;
+} sql_error_callback_arg;
+
+#define parser_errposition(pos)  plpgsql_scanner_errposition(pos)
+
+union YYSTYPE;					/* need forward reference for tok_is_keyword */
+
+static	bool			tok_is_keyword(int token, union YYSTYPE *lval,
+									   int kw_token, const char *kw_str);
+static	void			word_is_not_variable(PLword *word, int location);
+static	void			cword_is_not_variable(PLcword *cword, int location);
+static	void			current_token_is_not_variable(int tok);
+static	PLpgSQL_expr	*read_sql_construct(int until,
+											int until2,
+											int until3,
+											const char *expected,
+											const char *sqlstart,
+											bool isexpression,
+											bool valid_sql,
+											int *startloc,
+											int *endtoken);
+static	PLpgSQL_expr	*read_sql_expression(int until,
+											 const char *expected);
+static	PLpgSQL_expr	*read_sql_expression2(int until, int until2,
+											  const char *expected,
+											  int *endtoken);
+static	PLpgSQL_expr	*read_sql_stmt(const char *sqlstart);
+static	PLpgSQL_type	*read_datatype(int tok);
+static	PLpgSQL_stmt	*make_execsql_stmt(int firsttoken, int location);
+static	PLpgSQL_stmt_fetch *read_fetch_direction(void);
+static	void			 complete_direction(PLpgSQL_stmt_fetch *fetch,
+											bool *check_FROM);
+static	PLpgSQL_stmt	*make_return_stmt(int location);
+static	PLpgSQL_stmt	*make_return_next_stmt(int location);
+static	PLpgSQL_stmt	*make_return_query_stmt(int location);
+static  PLpgSQL_stmt 	*make_case(int location, PLpgSQL_expr *t_expr,
+								   List *case_when_list, List *else_stmts);
+static	char			*NameOfDatum(PLwdatum *wdatum);
+static	void			 check_assignable(PLpgSQL_datum *datum, int location);
+static	void			 read_into_target(PLpgSQL_rec **rec, PLpgSQL_row **row,
+										  bool *strict);
+static	PLpgSQL_row		*read_into_scalar_list(char *initial_name,
+											   PLpgSQL_datum *initial_datum,
+											   int initial_location);
+static	PLpgSQL_row		*make_scalar_list1(char *initial_name,
+										   PLpgSQL_datum *initial_datum,
+										   int lineno, int location);
+static	void			 check_sql_expr(const char *stmt, int location,
+										int leaderlen);
+static	void			 plpgsql_sql_error_callback(void *arg);
+static	PLpgSQL_type	*parse_datatype(const char *string, int location);
+static	void			 check_labels(const char *start_label,
+									  const char *end_label,
+									  int end_location);
+static	PLpgSQL_expr 	*read_cursor_args(PLpgSQL_var *cursor,
+										  int until, const char *expected);
+static	List			*read_raise_options(void);
+
+
+#line 188 "pl_gram.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "pl_gram.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_IDENT = 3,                      /* IDENT  */
+  YYSYMBOL_FCONST = 4,                     /* FCONST  */
+  YYSYMBOL_SCONST = 5,                     /* SCONST  */
+  YYSYMBOL_BCONST = 6,                     /* BCONST  */
+  YYSYMBOL_XCONST = 7,                     /* XCONST  */
+  YYSYMBOL_Op = 8,                         /* Op  */
+  YYSYMBOL_ICONST = 9,                     /* ICONST  */
+  YYSYMBOL_PARAM = 10,                     /* PARAM  */
+  YYSYMBOL_TYPECAST = 11,                  /* TYPECAST  */
+  YYSYMBOL_DOT_DOT = 12,                   /* DOT_DOT  */
+  YYSYMBOL_COLON_EQUALS = 13,              /* COLON_EQUALS  */
+  YYSYMBOL_T_WORD = 14,                    /* T_WORD  */
+  YYSYMBOL_T_CWORD = 15,                   /* T_CWORD  */
+  YYSYMBOL_T_DATUM = 16,                   /* T_DATUM  */
+  YYSYMBOL_LESS_LESS = 17,                 /* LESS_LESS  */
+  YYSYMBOL_GREATER_GREATER = 18,           /* GREATER_GREATER  */
+  YYSYMBOL_K_ABSOLUTE = 19,                /* K_ABSOLUTE  */
+  YYSYMBOL_K_ALIAS = 20,                   /* K_ALIAS  */
+  YYSYMBOL_K_ALL = 21,                     /* K_ALL  */
+  YYSYMBOL_K_BACKWARD = 22,                /* K_BACKWARD  */
+  YYSYMBOL_K_BEGIN = 23,                   /* K_BEGIN  */
+  YYSYMBOL_K_BY = 24,                      /* K_BY  */
+  YYSYMBOL_K_CASE = 25,                    /* K_CASE  */
+  YYSYMBOL_K_CLOSE = 26,                   /* K_CLOSE  */
+  YYSYMBOL_K_CONSTANT = 27,                /* K_CONSTANT  */
+  YYSYMBOL_K_CONTINUE = 28,                /* K_CONTINUE  */
+  YYSYMBOL_K_CURSOR = 29,                  /* K_CURSOR  */
+  YYSYMBOL_K_DEBUG = 30,                   /* K_DEBUG  */
+  YYSYMBOL_K_DECLARE = 31,                 /* K_DECLARE  */
+  YYSYMBOL_K_DEFAULT = 32,                 /* K_DEFAULT  */
+  YYSYMBOL_K_DETAIL = 33,                  /* K_DETAIL  */
+  YYSYMBOL_K_DIAGNOSTICS = 34,             /* K_DIAGNOSTICS  */
+  YYSYMBOL_K_DUMP = 35,                    /* K_DUMP  */
+  YYSYMBOL_K_ELSE = 36,                    /* K_ELSE  */
+  YYSYMBOL_K_ELSIF = 37,                   /* K_ELSIF  */
+  YYSYMBOL_K_END = 38,                     /* K_END  */
+  YYSYMBOL_K_ERRCODE = 39,                 /* K_ERRCODE  */
+  YYSYMBOL_K_ERROR = 40,                   /* K_ERROR  */
+  YYSYMBOL_K_EXCEPTION = 41,               /* K_EXCEPTION  */
+  YYSYMBOL_K_EXECUTE = 42,                 /* K_EXECUTE  */
+  YYSYMBOL_K_EXIT = 43,                    /* K_EXIT  */
+  YYSYMBOL_K_FETCH = 44,                   /* K_FETCH  */
+  YYSYMBOL_K_FIRST = 45,                   /* K_FIRST  */
+  YYSYMBOL_K_FOR = 46,                     /* K_FOR  */
+  YYSYMBOL_K_FORWARD = 47,                 /* K_FORWARD  */
+  YYSYMBOL_K_FROM = 48,                    /* K_FROM  */
+  YYSYMBOL_K_GET = 49,                     /* K_GET  */
+  YYSYMBOL_K_HINT = 50,                    /* K_HINT  */
+  YYSYMBOL_K_IF = 51,                      /* K_IF  */
+  YYSYMBOL_K_IN = 52,                      /* K_IN  */
+  YYSYMBOL_K_INFO = 53,                    /* K_INFO  */
+  YYSYMBOL_K_INSERT = 54,                  /* K_INSERT  */
+  YYSYMBOL_K_INTO = 55,                    /* K_INTO  */
+  YYSYMBOL_K_IS = 56,                      /* K_IS  */
+  YYSYMBOL_K_LAST = 57,                    /* K_LAST  */
+  YYSYMBOL_K_LOG = 58,                     /* K_LOG  */
+  YYSYMBOL_K_LOOP = 59,                    /* K_LOOP  */
+  YYSYMBOL_K_MESSAGE = 60,                 /* K_MESSAGE  */
+  YYSYMBOL_K_MOVE = 61,                    /* K_MOVE  */
+  YYSYMBOL_K_NEXT = 62,                    /* K_NEXT  */
+  YYSYMBOL_K_NO = 63,                      /* K_NO  */
+  YYSYMBOL_K_NOT = 64,                     /* K_NOT  */
+  YYSYMBOL_K_NOTICE = 65,                  /* K_NOTICE  */
+  YYSYMBOL_K_NULL = 66,                    /* K_NULL  */
+  YYSYMBOL_K_OPEN = 67,                    /* K_OPEN  */
+  YYSYMBOL_K_OPTION = 68,                  /* K_OPTION  */
+  YYSYMBOL_K_OR = 69,                      /* K_OR  */
+  YYSYMBOL_K_PERFORM = 70,                 /* K_PERFORM  */
+  YYSYMBOL_K_PRIOR = 71,                   /* K_PRIOR  */
+  YYSYMBOL_K_QUERY = 72,                   /* K_QUERY  */
+  YYSYMBOL_K_RAISE = 73,                   /* K_RAISE  */
+  YYSYMBOL_K_RELATIVE = 74,                /* K_RELATIVE  */
+  YYSYMBOL_K_RESULT_OID = 75,              /* K_RESULT_OID  */
+  YYSYMBOL_K_RETURN = 76,                  /* K_RETURN  */
+  YYSYMBOL_K_REVERSE = 77,                 /* K_REVERSE  */
+  YYSYMBOL_K_ROWTYPE = 78,                 /* K_ROWTYPE  */
+  YYSYMBOL_K_ROW_COUNT = 79,               /* K_ROW_COUNT  */
+  YYSYMBOL_K_SCROLL = 80,                  /* K_SCROLL  */
+  YYSYMBOL_K_SQLSTATE = 81,                /* K_SQLSTATE  */
+  YYSYMBOL_K_STRICT = 82,                  /* K_STRICT  */
+  YYSYMBOL_K_THEN = 83,                    /* K_THEN  */
+  YYSYMBOL_K_TO = 84,                      /* K_TO  */
+  YYSYMBOL_K_TYPE = 85,                    /* K_TYPE  */
+  YYSYMBOL_K_USE_COLUMN = 86,              /* K_USE_COLUMN  */
+  YYSYMBOL_K_USE_VARIABLE = 87,            /* K_USE_VARIABLE  */
+  YYSYMBOL_K_USING = 88,                   /* K_USING  */
+  YYSYMBOL_K_VARIABLE_CONFLICT = 89,       /* K_VARIABLE_CONFLICT  */
+  YYSYMBOL_K_WARNING = 90,                 /* K_WARNING  */
+  YYSYMBOL_K_WHEN = 91,                    /* K_WHEN  */
+  YYSYMBOL_K_WHILE = 92,                   /* K_WHILE  */
+  YYSYMBOL_93_ = 93,                       /* '#'  */
+  YYSYMBOL_94_ = 94,                       /* ';'  */
+  YYSYMBOL_95_ = 95,                       /* '('  */
+  YYSYMBOL_96_ = 96,                       /* ')'  */
+  YYSYMBOL_97_ = 97,                       /* ','  */
+  YYSYMBOL_98_ = 98,                       /* '='  */
+  YYSYMBOL_99_ = 99,                       /* '['  */
+  YYSYMBOL_YYACCEPT = 100,                 /* $accept  */
+  YYSYMBOL_pl_function = 101,              /* pl_function  */
+  YYSYMBOL_comp_options = 102,             /* comp_options  */
+  YYSYMBOL_comp_option = 103,              /* comp_option  */
+  YYSYMBOL_opt_semi = 104,                 /* opt_semi  */
+  YYSYMBOL_pl_block = 105,                 /* pl_block  */
+  YYSYMBOL_decl_sect = 106,                /* decl_sect  */
+  YYSYMBOL_decl_start = 107,               /* decl_start  */
+  YYSYMBOL_decl_stmts = 108,               /* decl_stmts  */
+  YYSYMBOL_decl_stmt = 109,                /* decl_stmt  */
+  YYSYMBOL_decl_statement = 110,           /* decl_statement  */
+  YYSYMBOL_111_1 = 111,                    /* $@1  */
+  YYSYMBOL_opt_scrollable = 112,           /* opt_scrollable  */
+  YYSYMBOL_decl_cursor_query = 113,        /* decl_cursor_query  */
+  YYSYMBOL_decl_cursor_args = 114,         /* decl_cursor_args  */
+  YYSYMBOL_decl_cursor_arglist = 115,      /* decl_cursor_arglist  */
+  YYSYMBOL_decl_cursor_arg = 116,          /* decl_cursor_arg  */
+  YYSYMBOL_decl_is_for = 117,              /* decl_is_for  */
+  YYSYMBOL_decl_aliasitem = 118,           /* decl_aliasitem  */
+  YYSYMBOL_decl_varname = 119,             /* decl_varname  */
+  YYSYMBOL_decl_const = 120,               /* decl_const  */
+  YYSYMBOL_decl_datatype = 121,            /* decl_datatype  */
+  YYSYMBOL_decl_notnull = 122,             /* decl_notnull  */
+  YYSYMBOL_decl_defval = 123,              /* decl_defval  */
+  YYSYMBOL_decl_defkey = 124,              /* decl_defkey  */
+  YYSYMBOL_assign_operator = 125,          /* assign_operator  */
+  YYSYMBOL_proc_sect = 126,                /* proc_sect  */
+  YYSYMBOL_proc_stmts = 127,               /* proc_stmts  */
+  YYSYMBOL_proc_stmt = 128,                /* proc_stmt  */
+  YYSYMBOL_stmt_perform = 129,             /* stmt_perform  */
+  YYSYMBOL_stmt_assign = 130,              /* stmt_assign  */
+  YYSYMBOL_stmt_getdiag = 131,             /* stmt_getdiag  */
+  YYSYMBOL_getdiag_list = 132,             /* getdiag_list  */
+  YYSYMBOL_getdiag_list_item = 133,        /* getdiag_list_item  */
+  YYSYMBOL_getdiag_item = 134,             /* getdiag_item  */
+  YYSYMBOL_getdiag_target = 135,           /* getdiag_target  */
+  YYSYMBOL_assign_var = 136,               /* assign_var  */
+  YYSYMBOL_stmt_if = 137,                  /* stmt_if  */
+  YYSYMBOL_stmt_else = 138,                /* stmt_else  */
+  YYSYMBOL_stmt_case = 139,                /* stmt_case  */
+  YYSYMBOL_opt_expr_until_when = 140,      /* opt_expr_until_when  */
+  YYSYMBOL_case_when_list = 141,           /* case_when_list  */
+  YYSYMBOL_case_when = 142,                /* case_when  */
+  YYSYMBOL_opt_case_else = 143,            /* opt_case_else  */
+  YYSYMBOL_stmt_loop = 144,                /* stmt_loop  */
+  YYSYMBOL_stmt_while = 145,               /* stmt_while  */
+  YYSYMBOL_stmt_for = 146,                 /* stmt_for  */
+  YYSYMBOL_for_control = 147,              /* for_control  */
+  YYSYMBOL_for_variable = 148,             /* for_variable  */
+  YYSYMBOL_stmt_exit = 149,                /* stmt_exit  */
+  YYSYMBOL_exit_type = 150,                /* exit_type  */
+  YYSYMBOL_stmt_return = 151,              /* stmt_return  */
+  YYSYMBOL_stmt_raise = 152,               /* stmt_raise  */
+  YYSYMBOL_loop_body = 153,                /* loop_body  */
+  YYSYMBOL_stmt_execsql = 154,             /* stmt_execsql  */
+  YYSYMBOL_stmt_dynexecute = 155,          /* stmt_dynexecute  */
+  YYSYMBOL_stmt_open = 156,                /* stmt_open  */
+  YYSYMBOL_stmt_fetch = 157,               /* stmt_fetch  */
+  YYSYMBOL_stmt_move = 158,                /* stmt_move  */
+  YYSYMBOL_opt_fetch_direction = 159,      /* opt_fetch_direction  */
+  YYSYMBOL_stmt_close = 160,               /* stmt_close  */
+  YYSYMBOL_stmt_null = 161,                /* stmt_null  */
+  YYSYMBOL_cursor_variable = 162,          /* cursor_variable  */
+  YYSYMBOL_exception_sect = 163,           /* exception_sect  */
+  YYSYMBOL_164_2 = 164,                    /* @2  */
+  YYSYMBOL_proc_exceptions = 165,          /* proc_exceptions  */
+  YYSYMBOL_proc_exception = 166,           /* proc_exception  */
+  YYSYMBOL_proc_conditions = 167,          /* proc_conditions  */
+  YYSYMBOL_proc_condition = 168,           /* proc_condition  */
+  YYSYMBOL_expr_until_semi = 169,          /* expr_until_semi  */
+  YYSYMBOL_expr_until_rightbracket = 170,  /* expr_until_rightbracket  */
+  YYSYMBOL_expr_until_then = 171,          /* expr_until_then  */
+  YYSYMBOL_expr_until_loop = 172,          /* expr_until_loop  */
+  YYSYMBOL_opt_block_label = 173,          /* opt_block_label  */
+  YYSYMBOL_opt_label = 174,                /* opt_label  */
+  YYSYMBOL_opt_exitcond = 175,             /* opt_exitcond  */
+  YYSYMBOL_any_identifier = 176,           /* any_identifier  */
+  YYSYMBOL_unreserved_keyword = 177        /* unreserved_keyword  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_uint8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL \
+             && defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+  YYLTYPE yyls_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE) \
+             + YYSIZEOF (YYLTYPE)) \
+      + 2 * YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  3
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   479
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  100
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  78
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  179
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  250
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   347
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,    93,     2,     2,     2,     2,
+      95,    96,     2,     2,    97,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,    94,
+       2,    98,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,    99,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   316,   316,   322,   323,   326,   330,   334,   338,   344,
+     345,   348,   370,   378,   385,   394,   406,   407,   410,   411,
+     415,   428,   466,   472,   471,   523,   526,   530,   537,   543,
+     546,   575,   579,   585,   593,   594,   596,   611,   639,   652,
+     668,   669,   674,   685,   686,   690,   692,   698,   699,   702,
+     703,   707,   708,   712,   719,   728,   730,   732,   734,   736,
+     738,   740,   742,   744,   746,   748,   750,   752,   754,   756,
+     758,   760,   762,   764,   768,   781,   795,   808,   812,   818,
+     831,   845,   857,   862,   870,   875,   890,   906,   909,   939,
+     945,   952,   966,   970,   976,   988,   991,  1006,  1023,  1041,
+    1075,  1335,  1367,  1382,  1389,  1404,  1408,  1414,  1440,  1579,
+    1597,  1601,  1611,  1623,  1672,  1749,  1781,  1794,  1799,  1812,
+    1819,  1835,  1840,  1848,  1850,  1849,  1885,  1889,  1895,  1908,
+    1917,  1923,  1960,  1964,  1968,  1972,  1976,  1980,  1988,  1991,
+    1999,  2001,  2008,  2012,  2021,  2022,  2023,  2024,  2025,  2026,
+    2027,  2028,  2029,  2030,  2031,  2032,  2033,  2034,  2035,  2036,
+    2037,  2038,  2039,  2040,  2041,  2042,  2043,  2044,  2045,  2046,
+    2047,  2048,  2049,  2050,  2051,  2052,  2053,  2054,  2055,  2056
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "IDENT", "FCONST",
+  "SCONST", "BCONST", "XCONST", "Op", "ICONST", "PARAM", "TYPECAST",
+  "DOT_DOT", "COLON_EQUALS", "T_WORD", "T_CWORD", "T_DATUM", "LESS_LESS",
+  "GREATER_GREATER", "K_ABSOLUTE", "K_ALIAS", "K_ALL", "K_BACKWARD",
+  "K_BEGIN", "K_BY", "K_CASE", "K_CLOSE", "K_CONSTANT", "K_CONTINUE",
+  "K_CURSOR", "K_DEBUG", "K_DECLARE", "K_DEFAULT", "K_DETAIL",
+  "K_DIAGNOSTICS", "K_DUMP", "K_ELSE", "K_ELSIF", "K_END", "K_ERRCODE",
+  "K_ERROR", "K_EXCEPTION", "K_EXECUTE", "K_EXIT", "K_FETCH", "K_FIRST",
+  "K_FOR", "K_FORWARD", "K_FROM", "K_GET", "K_HINT", "K_IF", "K_IN",
+  "K_INFO", "K_INSERT", "K_INTO", "K_IS", "K_LAST", "K_LOG", "K_LOOP",
+  "K_MESSAGE", "K_MOVE", "K_NEXT", "K_NO", "K_NOT", "K_NOTICE", "K_NULL",
+  "K_OPEN", "K_OPTION", "K_OR", "K_PERFORM", "K_PRIOR", "K_QUERY",
+  "K_RAISE", "K_RELATIVE", "K_RESULT_OID", "K_RETURN", "K_REVERSE",
+  "K_ROWTYPE", "K_ROW_COUNT", "K_SCROLL", "K_SQLSTATE", "K_STRICT",
+  "K_THEN", "K_TO", "K_TYPE", "K_USE_COLUMN", "K_USE_VARIABLE", "K_USING",
+  "K_VARIABLE_CONFLICT", "K_WARNING", "K_WHEN", "K_WHILE", "'#'", "';'",
+  "'('", "')'", "','", "'='", "'['", "$accept", "pl_function",
+  "comp_options", "comp_option", "opt_semi", "pl_block", "decl_sect",
+  "decl_start", "decl_stmts", "decl_stmt", "decl_statement", "$@1",
+  "opt_scrollable", "decl_cursor_query", "decl_cursor_args",
+  "decl_cursor_arglist", "decl_cursor_arg", "decl_is_for",
+  "decl_aliasitem", "decl_varname", "decl_const", "decl_datatype",
+  "decl_notnull", "decl_defval", "decl_defkey", "assign_operator",
+  "proc_sect", "proc_stmts", "proc_stmt", "stmt_perform", "stmt_assign",
+  "stmt_getdiag", "getdiag_list", "getdiag_list_item", "getdiag_item",
+  "getdiag_target", "assign_var", "stmt_if", "stmt_else", "stmt_case",
+  "opt_expr_until_when", "case_when_list", "case_when", "opt_case_else",
+  "stmt_loop", "stmt_while", "stmt_for", "for_control", "for_variable",
+  "stmt_exit", "exit_type", "stmt_return", "stmt_raise", "loop_body",
+  "stmt_execsql", "stmt_dynexecute", "stmt_open", "stmt_fetch",
+  "stmt_move", "opt_fetch_direction", "stmt_close", "stmt_null",
+  "cursor_variable", "exception_sect", "@2", "proc_exceptions",
+  "proc_exception", "proc_conditions", "proc_condition", "expr_until_semi",
+  "expr_until_rightbracket", "expr_until_then", "expr_until_loop",
+  "opt_block_label", "opt_label", "opt_exitcond", "any_identifier",
+  "unreserved_keyword", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-190)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-137)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+    -190,    44,   -10,  -190,    36,   -62,  -190,   -35,    43,    47,
+    -190,  -190,    64,    56,    -7,  -190,  -190,   383,  -190,   189,
+    -190,  -190,  -190,  -190,  -190,  -190,  -190,  -190,  -190,    61,
+    -190,  -190,  -190,  -190,    59,  -190,  -190,  -190,     7,    61,
+    -190,  -190,  -190,     8,    63,    -6,  -190,  -190,  -190,  -190,
+     -11,  -190,  -190,  -190,  -190,  -190,  -190,    36,  -190,  -190,
+    -190,  -190,  -190,  -190,  -190,  -190,  -190,   -18,  -190,    36,
+    -190,  -190,  -190,  -190,  -190,  -190,  -190,  -190,  -190,  -190,
+    -190,  -190,  -190,  -190,  -190,  -190,  -190,  -190,  -190,  -190,
+    -190,  -190,  -190,  -190,  -190,  -190,  -190,  -190,  -190,  -190,
+    -190,  -190,  -190,  -190,  -190,  -190,  -190,   189,  -190,  -190,
+      29,  -190,    16,  -190,  -190,  -190,    19,    61,    84,   340,
+      61,  -190,  -190,  -190,  -190,  -190,    76,  -190,  -190,  -190,
+    -190,  -190,   -65,  -190,    96,   403,  -190,    97,  -190,    71,
+    -190,    39,  -190,    91,  -190,  -190,   -20,  -190,  -190,    66,
+    -190,  -190,  -190,   -55,  -190,    -8,    -2,    31,    35,    36,
+    -190,  -190,  -190,  -190,  -190,  -190,  -190,  -190,   403,    75,
+      90,  -190,   403,  -190,    48,  -190,  -190,    68,    80,   403,
+    -190,    92,  -190,  -190,    84,  -190,   403,  -190,    95,  -190,
+      36,    35,  -190,  -190,  -190,  -190,  -190,    77,  -190,  -190,
+    -190,    41,    49,    79,    -9,  -190,  -190,   117,  -190,  -190,
+    -190,   340,   101,   -51,  -190,  -190,  -190,    36,  -190,   263,
+     -25,  -190,  -190,  -190,  -190,  -190,  -190,    60,    -2,    65,
+      36,   123,    70,   -28,  -190,  -190,  -190,  -190,  -190,  -190,
+    -190,  -190,  -190,  -190,  -190,  -190,   263,  -190,  -190,  -190
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_uint8 yydefact[] =
+{
+       3,     0,   136,     1,     0,     0,     4,     9,     0,    12,
+     142,   143,     0,     0,     0,    10,     2,   136,    15,    13,
+     137,     5,     6,     8,     7,   111,   112,    84,    91,     0,
+     106,   113,   105,   117,     0,   134,   110,   117,     0,     0,
+     132,   108,   107,     0,   123,    52,    54,    67,    56,    68,
+       0,    57,    58,    59,    60,    61,    62,   138,    63,    64,
+      65,    66,    69,    70,    71,    72,    73,    12,    38,     0,
+     144,   145,   146,   147,   148,   149,    19,   150,   151,   152,
+     153,   154,   155,   156,   157,   158,   159,   160,   161,   162,
+     163,   164,   165,   166,   167,   168,   169,   170,   172,   171,
+     173,   174,   175,   176,   177,   178,   179,    14,    17,    18,
+      40,    39,     0,   121,   122,   120,     0,     0,     0,   136,
+       0,   119,   114,    74,    55,   124,     0,    53,    50,    49,
+     133,   132,     0,   139,     0,   136,   135,     0,    16,     0,
+      41,     0,    27,     0,    42,   134,    95,    93,   118,     0,
+      82,    83,    81,     0,    78,     0,    87,     0,     0,   138,
+      85,    75,   132,   140,   104,   102,   103,   101,   136,     0,
+       0,    97,   136,    20,     0,    26,    23,    43,   136,   136,
+      92,     0,   115,    76,     0,    80,   136,   134,     0,   116,
+       0,   125,   127,    11,   141,    99,   100,     0,    98,    36,
+      37,     0,    29,     0,     0,    94,    96,     0,    77,    79,
+      89,   136,     0,     0,   130,   131,   126,   138,    22,     0,
+       0,    44,    48,    45,    21,    46,    47,     0,    87,     0,
+       0,   136,     0,     0,    31,    42,    35,    34,    28,    90,
+      88,    86,   129,   128,   109,    30,     0,    33,    24,    32
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -190,  -190,  -190,  -190,  -190,   141,  -190,  -190,  -190,    50,
+    -190,  -190,  -190,  -190,  -190,  -190,   -91,  -190,  -190,  -189,
+    -190,   -77,  -190,  -190,  -190,  -131,   -16,  -190,   115,  -190,
+    -190,  -190,  -190,   -15,  -190,  -190,  -190,  -190,   -60,  -190,
+    -190,  -190,    27,  -190,  -190,  -190,  -190,  -190,  -190,  -190,
+    -190,  -190,  -190,  -121,  -190,  -190,  -190,  -190,  -190,   138,
+    -190,  -190,   -36,  -190,  -190,  -190,   -13,  -190,   -54,  -116,
+    -190,  -133,  -190,   177,  -145,  -190,    -4,  -190
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_uint8 yydefgoto[] =
+{
+       0,     1,     2,     6,    16,    43,     8,    19,   107,   108,
+     109,   202,   143,   248,   220,   233,   234,   238,   201,   110,
+     144,   177,   204,   224,   225,   131,   170,    45,    46,    47,
+      48,    49,   153,   154,   209,   155,    50,    51,   188,    52,
+     112,   146,   147,   181,    53,    54,    55,   168,   169,    56,
+      57,    58,    59,   171,    60,    61,    62,    63,    64,   117,
+      65,    66,   116,   126,   158,   191,   192,   213,   214,   123,
+     160,   119,   172,    67,   132,   164,   133,   111
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      12,    44,   128,   122,   128,   128,    13,     4,    25,    26,
+      27,     4,   178,    18,   193,   161,   179,  -136,   230,    28,
+      29,   236,    30,   222,   185,  -136,   162,    14,   134,   163,
+     235,   237,   231,    22,   186,   187,    31,    32,    33,   183,
+    -136,   135,   184,    34,     3,    35,   194,   195,    36,   139,
+      10,   198,    11,  -136,   211,    37,   140,   235,   -25,    15,
+      38,    39,   199,   200,    40,   137,    17,    41,   245,   246,
+      42,   145,   232,   226,   136,   113,   114,   115,    18,    23,
+      24,   149,    20,     5,   157,   223,  -136,   129,   130,   129,
+     129,    21,   141,   118,    25,    26,    27,     4,   150,   151,
+     152,   121,   124,   156,   125,    28,    29,   145,    30,   142,
+     165,   166,   167,   148,   159,   173,   -51,   174,   -51,   175,
+     176,   182,    31,    32,    33,   189,   190,   196,   197,    34,
+     207,    35,   203,   212,    36,   218,   217,    25,    26,    27,
+       4,    37,   227,     7,   219,   221,    38,    39,    28,    29,
+      40,    30,   229,    41,   239,   249,    42,   138,   247,   241,
+     127,   -51,   205,   206,   244,    31,    32,    33,   240,   208,
+     210,   -51,    34,   180,    35,   120,   242,    36,   216,     9,
+       0,     0,     0,     0,    37,     0,   215,     0,     0,    38,
+      39,     0,     0,    40,     0,   228,    41,     0,     0,    42,
+       0,     0,     0,    68,     0,     0,    69,     0,    70,    71,
+       0,    72,     0,     0,   -51,   243,    73,     0,    74,    75,
+      76,     0,    77,     0,    78,     0,   215,     0,    79,    80,
+       0,     0,     0,     0,    81,     0,    82,     0,     0,    83,
+       0,     0,    84,     0,     0,    85,    86,    87,     0,    88,
+       0,    89,    90,     0,    91,     0,     0,    92,     0,     0,
+      93,    94,     0,    95,    96,     0,    97,    98,    99,   100,
+     101,     0,     0,     0,   102,   103,   104,    68,   105,   106,
+       0,     0,    70,    71,     0,    72,     0,     0,     0,     0,
+      73,     0,    74,    75,     0,     0,    77,     0,    78,     0,
+       0,     0,    79,    80,     0,     0,     0,     0,    81,     0,
+      82,     0,     0,    83,     0,     0,    84,     0,     0,    85,
+      86,    87,     0,    88,     0,    89,    90,     0,    91,     0,
+       0,    92,     0,     0,    93,    94,     0,    95,    96,     0,
+      97,    98,    99,   100,   101,     0,     0,     0,   102,   103,
+     104,     0,   105,   106,    25,    26,    27,     4,     0,     0,
+       0,     0,     0,     0,     0,    28,    29,     0,    30,     0,
+       0,     0,     0,     0,     0,     0,   -51,   -51,   -51,     0,
+       0,     0,    31,    32,    33,     0,     0,     0,     0,    34,
+       0,    35,     0,     0,    36,     0,     0,    25,    26,    27,
+       4,    37,     0,     0,     0,     0,    38,    39,    28,    29,
+      40,    30,     0,    41,     0,     0,    42,    25,    26,    27,
+       4,   -51,     0,     0,   -51,    31,    32,    33,    28,    29,
+       0,    30,    34,     0,    35,     0,     0,    36,     0,     0,
+       0,   -51,     0,     0,    37,    31,    32,    33,     0,    38,
+      39,     0,    34,    40,    35,     0,    41,    36,     0,    42,
+       0,     0,     0,     0,    37,     0,     0,     0,     0,    38,
+      39,     0,     0,    40,     0,     0,    41,     0,     0,    42
+};
+
+static const yytype_int16 yycheck[] =
+{
+       4,    17,    13,    39,    13,    13,    68,    17,    14,    15,
+      16,    17,   145,    31,   159,   131,    36,    23,    69,    25,
+      26,    46,    28,    32,   155,    31,    91,    89,    46,    94,
+     219,    56,    83,    40,    36,    37,    42,    43,    44,    94,
+      46,    59,    97,    49,     0,    51,   162,   168,    54,    20,
+      14,   172,    16,    59,   187,    61,    27,   246,    29,    94,
+      66,    67,    14,    15,    70,    69,    23,    73,    96,    97,
+      76,    91,   217,   204,    92,    14,    15,    16,    31,    86,
+      87,   117,    18,    93,   120,    94,    92,    98,    99,    98,
+      98,    35,    63,    34,    14,    15,    16,    17,    14,    15,
+      16,    94,    94,   119,    41,    25,    26,    91,    28,    80,
+      14,    15,    16,    94,    38,    18,    36,    46,    38,    80,
+      29,    55,    42,    43,    44,    94,    91,    52,    38,    49,
+      38,    51,    64,    38,    54,    94,    59,    14,    15,    16,
+      17,    61,    25,     2,    95,    66,    66,    67,    25,    26,
+      70,    28,    51,    73,    94,   246,    76,   107,   235,    94,
+      45,    38,   178,   179,    94,    42,    43,    44,   228,   184,
+     186,    91,    49,   146,    51,    37,   230,    54,   191,     2,
+      -1,    -1,    -1,    -1,    61,    -1,   190,    -1,    -1,    66,
+      67,    -1,    -1,    70,    -1,   211,    73,    -1,    -1,    76,
+      -1,    -1,    -1,    14,    -1,    -1,    17,    -1,    19,    20,
+      -1,    22,    -1,    -1,    91,   231,    27,    -1,    29,    30,
+      31,    -1,    33,    -1,    35,    -1,   230,    -1,    39,    40,
+      -1,    -1,    -1,    -1,    45,    -1,    47,    -1,    -1,    50,
+      -1,    -1,    53,    -1,    -1,    56,    57,    58,    -1,    60,
+      -1,    62,    63,    -1,    65,    -1,    -1,    68,    -1,    -1,
+      71,    72,    -1,    74,    75,    -1,    77,    78,    79,    80,
+      81,    -1,    -1,    -1,    85,    86,    87,    14,    89,    90,
+      -1,    -1,    19,    20,    -1,    22,    -1,    -1,    -1,    -1,
+      27,    -1,    29,    30,    -1,    -1,    33,    -1,    35,    -1,
+      -1,    -1,    39,    40,    -1,    -1,    -1,    -1,    45,    -1,
+      47,    -1,    -1,    50,    -1,    -1,    53,    -1,    -1,    56,
+      57,    58,    -1,    60,    -1,    62,    63,    -1,    65,    -1,
+      -1,    68,    -1,    -1,    71,    72,    -1,    74,    75,    -1,
+      77,    78,    79,    80,    81,    -1,    -1,    -1,    85,    86,
+      87,    -1,    89,    90,    14,    15,    16,    17,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    25,    26,    -1,    28,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    36,    37,    38,    -1,
+      -1,    -1,    42,    43,    44,    -1,    -1,    -1,    -1,    49,
+      -1,    51,    -1,    -1,    54,    -1,    -1,    14,    15,    16,
+      17,    61,    -1,    -1,    -1,    -1,    66,    67,    25,    26,
+      70,    28,    -1,    73,    -1,    -1,    76,    14,    15,    16,
+      17,    38,    -1,    -1,    41,    42,    43,    44,    25,    26,
+      -1,    28,    49,    -1,    51,    -1,    -1,    54,    -1,    -1,
+      -1,    38,    -1,    -1,    61,    42,    43,    44,    -1,    66,
+      67,    -1,    49,    70,    51,    -1,    73,    54,    -1,    76,
+      -1,    -1,    -1,    -1,    61,    -1,    -1,    -1,    -1,    66,
+      67,    -1,    -1,    70,    -1,    -1,    73,    -1,    -1,    76
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_uint8 yystos[] =
+{
+       0,   101,   102,     0,    17,    93,   103,   105,   106,   173,
+      14,    16,   176,    68,    89,    94,   104,    23,    31,   107,
+      18,    35,    40,    86,    87,    14,    15,    16,    25,    26,
+      28,    42,    43,    44,    49,    51,    54,    61,    66,    67,
+      70,    73,    76,   105,   126,   127,   128,   129,   130,   131,
+     136,   137,   139,   144,   145,   146,   149,   150,   151,   152,
+     154,   155,   156,   157,   158,   160,   161,   173,    14,    17,
+      19,    20,    22,    27,    29,    30,    31,    33,    35,    39,
+      40,    45,    47,    50,    53,    56,    57,    58,    60,    62,
+      63,    65,    68,    71,    72,    74,    75,    77,    78,    79,
+      80,    81,    85,    86,    87,    89,    90,   108,   109,   110,
+     119,   177,   140,    14,    15,    16,   162,   159,    34,   171,
+     159,    94,   162,   169,    94,    41,   163,   128,    13,    98,
+      99,   125,   174,   176,    46,    59,    92,   176,   109,    20,
+      27,    63,    80,   112,   120,    91,   141,   142,    94,   162,
+      14,    15,    16,   132,   133,   135,   126,   162,   164,    38,
+     170,   169,    91,    94,   175,    14,    15,    16,   147,   148,
+     126,   153,   172,    18,    46,    80,    29,   121,   171,    36,
+     142,   143,    55,    94,    97,   125,    36,    37,   138,    94,
+      91,   165,   166,   174,   169,   153,    52,    38,   153,    14,
+      15,   118,   111,    64,   122,   126,   126,    38,   133,   134,
+     126,   171,    38,   167,   168,   176,   166,    59,    94,    95,
+     114,    66,    32,    94,   123,   124,   125,    25,   126,    51,
+      69,    83,   174,   115,   116,   119,    46,    56,   117,    94,
+     138,    94,   168,   126,    94,    96,    97,   121,   113,   116
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_uint8 yyr1[] =
+{
+       0,   100,   101,   102,   102,   103,   103,   103,   103,   104,
+     104,   105,   106,   106,   106,   107,   108,   108,   109,   109,
+     109,   110,   110,   111,   110,   112,   112,   112,   113,   114,
+     114,   115,   115,   116,   117,   117,   118,   118,   119,   119,
+     120,   120,   121,   122,   122,   123,   123,   124,   124,   125,
+     125,   126,   126,   127,   127,   128,   128,   128,   128,   128,
+     128,   128,   128,   128,   128,   128,   128,   128,   128,   128,
+     128,   128,   128,   128,   129,   130,   131,   132,   132,   133,
+     134,   135,   135,   135,   136,   136,   137,   138,   138,   138,
+     139,   140,   141,   141,   142,   143,   143,   144,   145,   146,
+     147,   148,   148,   148,   149,   150,   150,   151,   152,   153,
+     154,   154,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   162,   162,   163,   164,   163,   165,   165,   166,   167,
+     167,   168,   169,   170,   171,   172,   173,   173,   174,   174,
+     175,   175,   176,   176,   177,   177,   177,   177,   177,   177,
+     177,   177,   177,   177,   177,   177,   177,   177,   177,   177,
+     177,   177,   177,   177,   177,   177,   177,   177,   177,   177,
+     177,   177,   177,   177,   177,   177,   177,   177,   177,   177
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     3,     0,     2,     3,     3,     3,     3,     0,
+       1,     6,     1,     2,     3,     1,     2,     1,     1,     1,
+       3,     5,     5,     0,     7,     0,     2,     1,     0,     0,
+       3,     1,     3,     2,     1,     1,     1,     1,     1,     1,
+       0,     1,     0,     0,     2,     1,     1,     1,     1,     1,
+       1,     0,     1,     2,     1,     2,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     2,     3,     4,     3,     1,     3,
+       0,     1,     1,     1,     1,     3,     7,     0,     4,     2,
+       7,     0,     2,     1,     3,     0,     2,     3,     4,     4,
+       2,     1,     1,     1,     3,     1,     1,     1,     1,     5,
+       1,     1,     1,     1,     2,     4,     4,     0,     3,     2,
+       1,     1,     1,     0,     0,     3,     2,     1,     4,     3,
+       1,     1,     0,     0,     0,     0,     0,     3,     0,     1,
+       1,     2,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
+   If N is 0, then set CURRENT to the empty location which ends
+   the previous symbol: RHS[0] (always defined).  */
+
+#ifndef YYLLOC_DEFAULT
+# define YYLLOC_DEFAULT(Current, Rhs, N)                                \
+    do                                                                  \
+      if (N)                                                            \
+        {                                                               \
+          (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;        \
+          (Current).first_column = YYRHSLOC (Rhs, 1).first_column;      \
+          (Current).last_line    = YYRHSLOC (Rhs, N).last_line;         \
+          (Current).last_column  = YYRHSLOC (Rhs, N).last_column;       \
+        }                                                               \
+      else                                                              \
+        {                                                               \
+          (Current).first_line   = (Current).last_line   =              \
+            YYRHSLOC (Rhs, 0).last_line;                                \
+          (Current).first_column = (Current).last_column =              \
+            YYRHSLOC (Rhs, 0).last_column;                              \
+        }                                                               \
+    while (0)
+#endif
+
+#define YYRHSLOC(Rhs, K) ((Rhs)[K])
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+/* YYLOCATION_PRINT -- Print the location on the stream.
+   This macro was not mandated originally: define only if we know
+   we won't break user code: when these are the locations we know.  */
+
+# ifndef YYLOCATION_PRINT
+
+#  if defined YY_LOCATION_PRINT
+
+   /* Temporary convenience wrapper in case some people defined the
+      undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YYLOCATION_PRINT(File, Loc)  YY_LOCATION_PRINT(File, *(Loc))
+
+#  elif defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+
+/* Print *YYLOCP on YYO.  Private, do not rely on its existence. */
+
+YY_ATTRIBUTE_UNUSED
+static int
+yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
+{
+  int res = 0;
+  int end_col = 0 != yylocp->last_column ? yylocp->last_column - 1 : 0;
+  if (0 <= yylocp->first_line)
+    {
+      res += YYFPRINTF (yyo, "%d", yylocp->first_line);
+      if (0 <= yylocp->first_column)
+        res += YYFPRINTF (yyo, ".%d", yylocp->first_column);
+    }
+  if (0 <= yylocp->last_line)
+    {
+      if (yylocp->first_line < yylocp->last_line)
+        {
+          res += YYFPRINTF (yyo, "-%d", yylocp->last_line);
+          if (0 <= end_col)
+            res += YYFPRINTF (yyo, ".%d", end_col);
+        }
+      else if (0 <= end_col && yylocp->first_column < end_col)
+        res += YYFPRINTF (yyo, "-%d", end_col);
+    }
+  return res;
+}
+
+#   define YYLOCATION_PRINT  yy_location_print_
+
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT(File, Loc)  YYLOCATION_PRINT(File, &(Loc))
+
+#  else
+
+#   define YYLOCATION_PRINT(File, Loc) ((void) 0)
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT  YYLOCATION_PRINT
+
+#  endif
+# endif /* !defined YYLOCATION_PRINT */
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, Location); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (yylocationp);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  YYLOCATION_PRINT (yyo, yylocationp);
+  YYFPRINTF (yyo, ": ");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, yylocationp);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)],
+                       &(yylsp[(yyi + 1) - (yynrhs)]));
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, yylsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, YYLTYPE *yylocationp)
+{
+  YY_USE (yyvaluep);
+  YY_USE (yylocationp);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Location data for the lookahead symbol.  */
+YYLTYPE yylloc
+# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+  = { 1, 1, 1, 1 }
+# endif
+;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+    /* The location stack: array, bottom, top.  */
+    YYLTYPE yylsa[YYINITDEPTH];
+    YYLTYPE *yyls = yylsa;
+    YYLTYPE *yylsp = yyls;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+  YYLTYPE yyloc;
+
+  /* The locations where the error started and ended.  */
+  YYLTYPE yyerror_range[3];
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N), yylsp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  yylsp[0] = yylloc;
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+        YYLTYPE *yyls1 = yyls;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yyls1, yysize * YYSIZEOF (*yylsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+        yyls = yyls1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        YYSTACK_RELOCATE (yyls_alloc, yyls);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+      yylsp = yyls + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      yyerror_range[1] = yylloc;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+  *++yylsp = yylloc;
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+  /* Default location. */
+  YYLLOC_DEFAULT (yyloc, (yylsp - yylen), yylen);
+  yyerror_range[1] = yyloc;
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* pl_function: comp_options pl_block opt_semi  */
+#line 317 "gram.y"
+                                        {
+						plpgsql_parse_result = (PLpgSQL_stmt_block *) (yyvsp[-1].stmt);
+					}
+#line 1730 "pl_gram.c"
+    break;
+
+  case 5: /* comp_option: '#' K_OPTION K_DUMP  */
+#line 327 "gram.y"
+                                        {
+						plpgsql_DumpExecTree = true;
+					}
+#line 1738 "pl_gram.c"
+    break;
+
+  case 6: /* comp_option: '#' K_VARIABLE_CONFLICT K_ERROR  */
+#line 331 "gram.y"
+                                        {
+						plpgsql_curr_compile->resolve_option = PLPGSQL_RESOLVE_ERROR;
+					}
+#line 1746 "pl_gram.c"
+    break;
+
+  case 7: /* comp_option: '#' K_VARIABLE_CONFLICT K_USE_VARIABLE  */
+#line 335 "gram.y"
+                                        {
+						plpgsql_curr_compile->resolve_option = PLPGSQL_RESOLVE_VARIABLE;
+					}
+#line 1754 "pl_gram.c"
+    break;
+
+  case 8: /* comp_option: '#' K_VARIABLE_CONFLICT K_USE_COLUMN  */
+#line 339 "gram.y"
+                                        {
+						plpgsql_curr_compile->resolve_option = PLPGSQL_RESOLVE_COLUMN;
+					}
+#line 1762 "pl_gram.c"
+    break;
+
+  case 11: /* pl_block: decl_sect K_BEGIN proc_sect exception_sect K_END opt_label  */
+#line 349 "gram.y"
+                                        {
+						PLpgSQL_stmt_block *new;
+
+						new = palloc0(sizeof(PLpgSQL_stmt_block));
+
+						new->cmd_type	= PLPGSQL_STMT_BLOCK;
+						new->lineno		= plpgsql_location_to_lineno((yylsp[-4]));
+						new->label		= (yyvsp[-5].declhdr).label;
+						new->n_initvars = (yyvsp[-5].declhdr).n_initvars;
+						new->initvarnos = (yyvsp[-5].declhdr).initvarnos;
+						new->body		= (yyvsp[-3].list);
+						new->exceptions	= (yyvsp[-2].exception_block);
+
+						check_labels((yyvsp[-5].declhdr).label, (yyvsp[0].str), (yylsp[0]));
+						plpgsql_ns_pop();
+
+						(yyval.stmt) = (PLpgSQL_stmt *)new;
+					}
+#line 1785 "pl_gram.c"
+    break;
+
+  case 12: /* decl_sect: opt_block_label  */
+#line 371 "gram.y"
+                                        {
+						/* done with decls, so resume identifier lookup */
+						plpgsql_IdentifierLookup = IDENTIFIER_LOOKUP_NORMAL;
+						(yyval.declhdr).label	  = (yyvsp[0].str);
+						(yyval.declhdr).n_initvars = 0;
+						(yyval.declhdr).initvarnos = NULL;
+					}
+#line 1797 "pl_gram.c"
+    break;
+
+  case 13: /* decl_sect: opt_block_label decl_start  */
+#line 379 "gram.y"
+                                        {
+						plpgsql_IdentifierLookup = IDENTIFIER_LOOKUP_NORMAL;
+						(yyval.declhdr).label	  = (yyvsp[-1].str);
+						(yyval.declhdr).n_initvars = 0;
+						(yyval.declhdr).initvarnos = NULL;
+					}
+#line 1808 "pl_gram.c"
+    break;
+
+  case 14: /* decl_sect: opt_block_label decl_start decl_stmts  */
+#line 386 "gram.y"
+                                        {
+						plpgsql_IdentifierLookup = IDENTIFIER_LOOKUP_NORMAL;
+						(yyval.declhdr).label	  = (yyvsp[-2].str);
+						/* Remember variables declared in decl_stmts */
+						(yyval.declhdr).n_initvars = plpgsql_add_initdatums(&((yyval.declhdr).initvarnos));
+					}
+#line 1819 "pl_gram.c"
+    break;
+
+  case 15: /* decl_start: K_DECLARE  */
+#line 395 "gram.y"
+                                        {
+						/* Forget any variables created before block */
+						plpgsql_add_initdatums(NULL);
+						/*
+						 * Disable scanner lookup of identifiers while
+						 * we process the decl_stmts
+						 */
+						plpgsql_IdentifierLookup = IDENTIFIER_LOOKUP_DECLARE;
+					}
+#line 1833 "pl_gram.c"
+    break;
+
+  case 19: /* decl_stmt: K_DECLARE  */
+#line 412 "gram.y"
+                                        {
+						/* We allow useless extra DECLAREs */
+					}
+#line 1841 "pl_gram.c"
+    break;
+
+  case 20: /* decl_stmt: LESS_LESS any_identifier GREATER_GREATER  */
+#line 416 "gram.y"
+                                        {
+						/*
+						 * Throw a helpful error if user tries to put block
+						 * label just before BEGIN, instead of before DECLARE.
+						 */
+						ereport(ERROR,
+								(errcode(ERRCODE_SYNTAX_ERROR),
+								 errmsg("block label must be placed before DECLARE, not after"),
+								 parser_errposition((yylsp[-2]))));
+					}
+#line 1856 "pl_gram.c"
+    break;
+
+  case 21: /* decl_statement: decl_varname decl_const decl_datatype decl_notnull decl_defval  */
+#line 429 "gram.y"
+                                        {
+						PLpgSQL_variable	*var;
+
+						var = plpgsql_build_variable((yyvsp[-4].varname).name, (yyvsp[-4].varname).lineno,
+													 (yyvsp[-2].dtype), true);
+						if ((yyvsp[-3].boolean))
+						{
+							if (var->dtype == PLPGSQL_DTYPE_VAR)
+								((PLpgSQL_var *) var)->isconst = (yyvsp[-3].boolean);
+							else
+								ereport(ERROR,
+										(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+										 errmsg("row or record variable cannot be CONSTANT"),
+										 parser_errposition((yylsp[-3]))));
+						}
+						if ((yyvsp[-1].boolean))
+						{
+							if (var->dtype == PLPGSQL_DTYPE_VAR)
+								((PLpgSQL_var *) var)->notnull = (yyvsp[-1].boolean);
+							else
+								ereport(ERROR,
+										(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+										 errmsg("row or record variable cannot be NOT NULL"),
+										 parser_errposition((yylsp[-1]))));
+
+						}
+						if ((yyvsp[0].expr) != NULL)
+						{
+							if (var->dtype == PLPGSQL_DTYPE_VAR)
+								((PLpgSQL_var *) var)->default_val = (yyvsp[0].expr);
+							else
+								ereport(ERROR,
+										(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+										 errmsg("default value for row or record variable is not supported"),
+										 parser_errposition((yylsp[0]))));
+						}
+					}
+#line 1898 "pl_gram.c"
+    break;
+
+  case 22: /* decl_statement: decl_varname K_ALIAS K_FOR decl_aliasitem ';'  */
+#line 467 "gram.y"
+                                        {
+						plpgsql_ns_additem((yyvsp[-1].nsitem)->itemtype,
+										   (yyvsp[-1].nsitem)->itemno, (yyvsp[-4].varname).name);
+					}
+#line 1907 "pl_gram.c"
+    break;
+
+  case 23: /* $@1: %empty  */
+#line 472 "gram.y"
+                                        { plpgsql_ns_push((yyvsp[-2].varname).name); }
+#line 1913 "pl_gram.c"
+    break;
+
+  case 24: /* decl_statement: decl_varname opt_scrollable K_CURSOR $@1 decl_cursor_args decl_is_for decl_cursor_query  */
+#line 474 "gram.y"
+                                        {
+						PLpgSQL_var *new;
+						PLpgSQL_expr *curname_def;
+						char		buf[1024];
+						char		*cp1;
+						char		*cp2;
+
+						/* pop local namespace for cursor args */
+						plpgsql_ns_pop();
+
+						new = (PLpgSQL_var *)
+							plpgsql_build_variable((yyvsp[-6].varname).name, (yyvsp[-6].varname).lineno,
+												   plpgsql_build_datatype(REFCURSOROID,
+																		  -1),
+												   true);
+
+						curname_def = palloc0(sizeof(PLpgSQL_expr));
+
+						curname_def->dtype = PLPGSQL_DTYPE_EXPR;
+						strcpy(buf, "SELECT ");
+						cp1 = new->refname;
+						cp2 = buf + strlen(buf);
+						/*
+						 * Don't trust standard_conforming_strings here;
+						 * it might change before we use the string.
+						 */
+						if (strchr(cp1, '\\') != NULL)
+							*cp2++ = ESCAPE_STRING_SYNTAX;
+						*cp2++ = '\'';
+						while (*cp1)
+						{
+							if (SQL_STR_DOUBLE(*cp1, true))
+								*cp2++ = *cp1;
+							*cp2++ = *cp1++;
+						}
+						strcpy(cp2, "'::pg_catalog.refcursor");
+						curname_def->query = pstrdup(buf);
+						new->default_val = curname_def;
+
+						new->cursor_explicit_expr = (yyvsp[0].expr);
+						if ((yyvsp[-2].datum) == NULL)
+							new->cursor_explicit_argrow = -1;
+						else
+							new->cursor_explicit_argrow = (yyvsp[-2].datum)->dno;
+						new->cursor_options = CURSOR_OPT_FAST_PLAN | (yyvsp[-5].ival);
+					}
+#line 1964 "pl_gram.c"
+    break;
+
+  case 25: /* opt_scrollable: %empty  */
+#line 523 "gram.y"
+                                        {
+						(yyval.ival) = 0;
+					}
+#line 1972 "pl_gram.c"
+    break;
+
+  case 26: /* opt_scrollable: K_NO K_SCROLL  */
+#line 527 "gram.y"
+                                        {
+						(yyval.ival) = CURSOR_OPT_NO_SCROLL;
+					}
+#line 1980 "pl_gram.c"
+    break;
+
+  case 27: /* opt_scrollable: K_SCROLL  */
+#line 531 "gram.y"
+                                        {
+						(yyval.ival) = CURSOR_OPT_SCROLL;
+					}
+#line 1988 "pl_gram.c"
+    break;
+
+  case 28: /* decl_cursor_query: %empty  */
+#line 537 "gram.y"
+                                        {
+						(yyval.expr) = read_sql_stmt("");
+					}
+#line 1996 "pl_gram.c"
+    break;
+
+  case 29: /* decl_cursor_args: %empty  */
+#line 543 "gram.y"
+                                        {
+						(yyval.datum) = NULL;
+					}
+#line 2004 "pl_gram.c"
+    break;
+
+  case 30: /* decl_cursor_args: '(' decl_cursor_arglist ')'  */
+#line 547 "gram.y"
+                                        {
+						PLpgSQL_row *new;
+						int i;
+						ListCell *l;
+
+						new = palloc0(sizeof(PLpgSQL_row));
+						new->dtype = PLPGSQL_DTYPE_ROW;
+						new->lineno = plpgsql_location_to_lineno((yylsp[-2]));
+						new->rowtupdesc = NULL;
+						new->nfields = list_length((yyvsp[-1].list));
+						new->fieldnames = palloc(new->nfields * sizeof(char *));
+						new->varnos = palloc(new->nfields * sizeof(int));
+
+						i = 0;
+						foreach (l, (yyvsp[-1].list))
+						{
+							PLpgSQL_variable *arg = (PLpgSQL_variable *) lfirst(l);
+							new->fieldnames[i] = arg->refname;
+							new->varnos[i] = arg->dno;
+							i++;
+						}
+						list_free((yyvsp[-1].list));
+
+						plpgsql_adddatum((PLpgSQL_datum *) new);
+						(yyval.datum) = (PLpgSQL_datum *) new;
+					}
+#line 2035 "pl_gram.c"
+    break;
+
+  case 31: /* decl_cursor_arglist: decl_cursor_arg  */
+#line 576 "gram.y"
+                                        {
+						(yyval.list) = list_make1((yyvsp[0].datum));
+					}
+#line 2043 "pl_gram.c"
+    break;
+
+  case 32: /* decl_cursor_arglist: decl_cursor_arglist ',' decl_cursor_arg  */
+#line 580 "gram.y"
+                                        {
+						(yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].datum));
+					}
+#line 2051 "pl_gram.c"
+    break;
+
+  case 33: /* decl_cursor_arg: decl_varname decl_datatype  */
+#line 586 "gram.y"
+                                        {
+						(yyval.datum) = (PLpgSQL_datum *)
+							plpgsql_build_variable((yyvsp[-1].varname).name, (yyvsp[-1].varname).lineno,
+												   (yyvsp[0].dtype), true);
+					}
+#line 2061 "pl_gram.c"
+    break;
+
+  case 36: /* decl_aliasitem: T_WORD  */
+#line 597 "gram.y"
+                                        {
+						PLpgSQL_nsitem *nsi;
+
+						nsi = plpgsql_ns_lookup(plpgsql_ns_top(), false,
+												(yyvsp[0].word).ident, NULL, NULL,
+												NULL);
+						if (nsi == NULL)
+							ereport(ERROR,
+									(errcode(ERRCODE_UNDEFINED_OBJECT),
+									 errmsg("variable \"%s\" does not exist",
+											(yyvsp[0].word).ident),
+									 parser_errposition((yylsp[0]))));
+						(yyval.nsitem) = nsi;
+					}
+#line 2080 "pl_gram.c"
+    break;
+
+  case 37: /* decl_aliasitem: T_CWORD  */
+#line 612 "gram.y"
+                                        {
+						PLpgSQL_nsitem *nsi;
+
+						if (list_length((yyvsp[0].cword).idents) == 2)
+							nsi = plpgsql_ns_lookup(plpgsql_ns_top(), false,
+													strVal(linitial((yyvsp[0].cword).idents)),
+													strVal(lsecond((yyvsp[0].cword).idents)),
+													NULL,
+													NULL);
+						else if (list_length((yyvsp[0].cword).idents) == 3)
+							nsi = plpgsql_ns_lookup(plpgsql_ns_top(), false,
+													strVal(linitial((yyvsp[0].cword).idents)),
+													strVal(lsecond((yyvsp[0].cword).idents)),
+													strVal(lthird((yyvsp[0].cword).idents)),
+													NULL);
+						else
+							nsi = NULL;
+						if (nsi == NULL)
+							ereport(ERROR,
+									(errcode(ERRCODE_UNDEFINED_OBJECT),
+									 errmsg("variable \"%s\" does not exist",
+											NameListToString((yyvsp[0].cword).idents)),
+									 parser_errposition((yylsp[0]))));
+						(yyval.nsitem) = nsi;
+					}
+#line 2110 "pl_gram.c"
+    break;
+
+  case 38: /* decl_varname: T_WORD  */
+#line 640 "gram.y"
+                                        {
+						(yyval.varname).name = (yyvsp[0].word).ident;
+						(yyval.varname).lineno = plpgsql_location_to_lineno((yylsp[0]));
+						/*
+						 * Check to make sure name isn't already declared
+						 * in the current block.
+						 */
+						if (plpgsql_ns_lookup(plpgsql_ns_top(), true,
+											  (yyvsp[0].word).ident, NULL, NULL,
+											  NULL) != NULL)
+							yyerror("duplicate declaration");
+					}
+#line 2127 "pl_gram.c"
+    break;
+
+  case 39: /* decl_varname: unreserved_keyword  */
+#line 653 "gram.y"
+                                        {
+						(yyval.varname).name = pstrdup((yyvsp[0].keyword));
+						(yyval.varname).lineno = plpgsql_location_to_lineno((yylsp[0]));
+						/*
+						 * Check to make sure name isn't already declared
+						 * in the current block.
+						 */
+						if (plpgsql_ns_lookup(plpgsql_ns_top(), true,
+											  (yyvsp[0].keyword), NULL, NULL,
+											  NULL) != NULL)
+							yyerror("duplicate declaration");
+					}
+#line 2144 "pl_gram.c"
+    break;
+
+  case 40: /* decl_const: %empty  */
+#line 668 "gram.y"
+                                        { (yyval.boolean) = false; }
+#line 2150 "pl_gram.c"
+    break;
+
+  case 41: /* decl_const: K_CONSTANT  */
+#line 670 "gram.y"
+                                        { (yyval.boolean) = true; }
+#line 2156 "pl_gram.c"
+    break;
+
+  case 42: /* decl_datatype: %empty  */
+#line 674 "gram.y"
+                                        {
+						/*
+						 * If there's a lookahead token, read_datatype
+						 * should consume it.
+						 */
+						(yyval.dtype) = read_datatype(yychar);
+						yyclearin;
+					}
+#line 2169 "pl_gram.c"
+    break;
+
+  case 43: /* decl_notnull: %empty  */
+#line 685 "gram.y"
+                                        { (yyval.boolean) = false; }
+#line 2175 "pl_gram.c"
+    break;
+
+  case 44: /* decl_notnull: K_NOT K_NULL  */
+#line 687 "gram.y"
+                                        { (yyval.boolean) = true; }
+#line 2181 "pl_gram.c"
+    break;
+
+  case 45: /* decl_defval: ';'  */
+#line 691 "gram.y"
+                                        { (yyval.expr) = NULL; }
+#line 2187 "pl_gram.c"
+    break;
+
+  case 46: /* decl_defval: decl_defkey  */
+#line 693 "gram.y"
+                                        {
+						(yyval.expr) = read_sql_expression(';', ";");
+					}
+#line 2195 "pl_gram.c"
+    break;
+
+  case 51: /* proc_sect: %empty  */
+#line 707 "gram.y"
+                                        { (yyval.list) = NIL; }
+#line 2201 "pl_gram.c"
+    break;
+
+  case 52: /* proc_sect: proc_stmts  */
+#line 709 "gram.y"
+                                        { (yyval.list) = (yyvsp[0].list); }
+#line 2207 "pl_gram.c"
+    break;
+
+  case 53: /* proc_stmts: proc_stmts proc_stmt  */
+#line 713 "gram.y"
+                                                {
+							if ((yyvsp[0].stmt) == NULL)
+								(yyval.list) = (yyvsp[-1].list);
+							else
+								(yyval.list) = lappend((yyvsp[-1].list), (yyvsp[0].stmt));
+						}
+#line 2218 "pl_gram.c"
+    break;
+
+  case 54: /* proc_stmts: proc_stmt  */
+#line 720 "gram.y"
+                                                {
+							if ((yyvsp[0].stmt) == NULL)
+								(yyval.list) = NIL;
+							else
+								(yyval.list) = list_make1((yyvsp[0].stmt));
+						}
+#line 2229 "pl_gram.c"
+    break;
+
+  case 55: /* proc_stmt: pl_block ';'  */
+#line 729 "gram.y"
+                                                { (yyval.stmt) = (yyvsp[-1].stmt); }
+#line 2235 "pl_gram.c"
+    break;
+
+  case 56: /* proc_stmt: stmt_assign  */
+#line 731 "gram.y"
+                                                { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 2241 "pl_gram.c"
+    break;
+
+  case 57: /* proc_stmt: stmt_if  */
+#line 733 "gram.y"
+                                                { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 2247 "pl_gram.c"
+    break;
+
+  case 58: /* proc_stmt: stmt_case  */
+#line 735 "gram.y"
+                                                { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 2253 "pl_gram.c"
+    break;
+
+  case 59: /* proc_stmt: stmt_loop  */
+#line 737 "gram.y"
+                                                { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 2259 "pl_gram.c"
+    break;
+
+  case 60: /* proc_stmt: stmt_while  */
+#line 739 "gram.y"
+                                                { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 2265 "pl_gram.c"
+    break;
+
+  case 61: /* proc_stmt: stmt_for  */
+#line 741 "gram.y"
+                                                { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 2271 "pl_gram.c"
+    break;
+
+  case 62: /* proc_stmt: stmt_exit  */
+#line 743 "gram.y"
+                                                { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 2277 "pl_gram.c"
+    break;
+
+  case 63: /* proc_stmt: stmt_return  */
+#line 745 "gram.y"
+                                                { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 2283 "pl_gram.c"
+    break;
+
+  case 64: /* proc_stmt: stmt_raise  */
+#line 747 "gram.y"
+                                                { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 2289 "pl_gram.c"
+    break;
+
+  case 65: /* proc_stmt: stmt_execsql  */
+#line 749 "gram.y"
+                                                { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 2295 "pl_gram.c"
+    break;
+
+  case 66: /* proc_stmt: stmt_dynexecute  */
+#line 751 "gram.y"
+                                                { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 2301 "pl_gram.c"
+    break;
+
+  case 67: /* proc_stmt: stmt_perform  */
+#line 753 "gram.y"
+                                                { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 2307 "pl_gram.c"
+    break;
+
+  case 68: /* proc_stmt: stmt_getdiag  */
+#line 755 "gram.y"
+                                                { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 2313 "pl_gram.c"
+    break;
+
+  case 69: /* proc_stmt: stmt_open  */
+#line 757 "gram.y"
+                                                { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 2319 "pl_gram.c"
+    break;
+
+  case 70: /* proc_stmt: stmt_fetch  */
+#line 759 "gram.y"
+                                                { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 2325 "pl_gram.c"
+    break;
+
+  case 71: /* proc_stmt: stmt_move  */
+#line 761 "gram.y"
+                                                { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 2331 "pl_gram.c"
+    break;
+
+  case 72: /* proc_stmt: stmt_close  */
+#line 763 "gram.y"
+                                                { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 2337 "pl_gram.c"
+    break;
+
+  case 73: /* proc_stmt: stmt_null  */
+#line 765 "gram.y"
+                                                { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 2343 "pl_gram.c"
+    break;
+
+  case 74: /* stmt_perform: K_PERFORM expr_until_semi  */
+#line 769 "gram.y"
+                                        {
+						PLpgSQL_stmt_perform *new;
+
+						new = palloc0(sizeof(PLpgSQL_stmt_perform));
+						new->cmd_type = PLPGSQL_STMT_PERFORM;
+						new->lineno   = plpgsql_location_to_lineno((yylsp[-1]));
+						new->expr  = (yyvsp[0].expr);
+
+						(yyval.stmt) = (PLpgSQL_stmt *)new;
+					}
+#line 2358 "pl_gram.c"
+    break;
+
+  case 75: /* stmt_assign: assign_var assign_operator expr_until_semi  */
+#line 782 "gram.y"
+                                        {
+						PLpgSQL_stmt_assign *new;
+
+						new = palloc0(sizeof(PLpgSQL_stmt_assign));
+						new->cmd_type = PLPGSQL_STMT_ASSIGN;
+						new->lineno   = plpgsql_location_to_lineno((yylsp[-2]));
+						new->varno = (yyvsp[-2].ival);
+						new->expr  = (yyvsp[0].expr);
+
+						(yyval.stmt) = (PLpgSQL_stmt *)new;
+					}
+#line 2374 "pl_gram.c"
+    break;
+
+  case 76: /* stmt_getdiag: K_GET K_DIAGNOSTICS getdiag_list ';'  */
+#line 796 "gram.y"
+                                        {
+						PLpgSQL_stmt_getdiag	 *new;
+
+						new = palloc0(sizeof(PLpgSQL_stmt_getdiag));
+						new->cmd_type = PLPGSQL_STMT_GETDIAG;
+						new->lineno   = plpgsql_location_to_lineno((yylsp[-3]));
+						new->diag_items  = (yyvsp[-1].list);
+
+						(yyval.stmt) = (PLpgSQL_stmt *)new;
+					}
+#line 2389 "pl_gram.c"
+    break;
+
+  case 77: /* getdiag_list: getdiag_list ',' getdiag_list_item  */
+#line 809 "gram.y"
+                                        {
+						(yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].diagitem));
+					}
+#line 2397 "pl_gram.c"
+    break;
+
+  case 78: /* getdiag_list: getdiag_list_item  */
+#line 813 "gram.y"
+                                        {
+						(yyval.list) = list_make1((yyvsp[0].diagitem));
+					}
+#line 2405 "pl_gram.c"
+    break;
+
+  case 79: /* getdiag_list_item: getdiag_target assign_operator getdiag_item  */
+#line 819 "gram.y"
+                                        {
+						PLpgSQL_diag_item *new;
+
+						new = palloc(sizeof(PLpgSQL_diag_item));
+						new->target = (yyvsp[-2].ival);
+						new->kind = (yyvsp[0].ival);
+
+						(yyval.diagitem) = new;
+					}
+#line 2419 "pl_gram.c"
+    break;
+
+  case 80: /* getdiag_item: %empty  */
+#line 831 "gram.y"
+                                        {
+						int	tok = yylex();
+
+						if (tok_is_keyword(tok, &yylval,
+										   K_ROW_COUNT, "row_count"))
+							(yyval.ival) = PLPGSQL_GETDIAG_ROW_COUNT;
+						else if (tok_is_keyword(tok, &yylval,
+												K_RESULT_OID, "result_oid"))
+							(yyval.ival) = PLPGSQL_GETDIAG_RESULT_OID;
+						else
+							yyerror("unrecognized GET DIAGNOSTICS item");
+					}
+#line 2436 "pl_gram.c"
+    break;
+
+  case 81: /* getdiag_target: T_DATUM  */
+#line 846 "gram.y"
+                                        {
+						check_assignable((yyvsp[0].wdatum).datum, (yylsp[0]));
+						if ((yyvsp[0].wdatum).datum->dtype == PLPGSQL_DTYPE_ROW ||
+							(yyvsp[0].wdatum).datum->dtype == PLPGSQL_DTYPE_REC)
+							ereport(ERROR,
+									(errcode(ERRCODE_SYNTAX_ERROR),
+									 errmsg("\"%s\" is not a scalar variable",
+											NameOfDatum(&((yyvsp[0].wdatum)))),
+									 parser_errposition((yylsp[0]))));
+						(yyval.ival) = (yyvsp[0].wdatum).datum->dno;
+					}
+#line 2452 "pl_gram.c"
+    break;
+
+  case 82: /* getdiag_target: T_WORD  */
+#line 858 "gram.y"
+                                        {
+						/* just to give a better message than "syntax error" */
+						word_is_not_variable(&((yyvsp[0].word)), (yylsp[0]));
+					}
+#line 2461 "pl_gram.c"
+    break;
+
+  case 83: /* getdiag_target: T_CWORD  */
+#line 863 "gram.y"
+                                        {
+						/* just to give a better message than "syntax error" */
+						cword_is_not_variable(&((yyvsp[0].cword)), (yylsp[0]));
+					}
+#line 2470 "pl_gram.c"
+    break;
+
+  case 84: /* assign_var: T_DATUM  */
+#line 871 "gram.y"
+                                        {
+						check_assignable((yyvsp[0].wdatum).datum, (yylsp[0]));
+						(yyval.ival) = (yyvsp[0].wdatum).datum->dno;
+					}
+#line 2479 "pl_gram.c"
+    break;
+
+  case 85: /* assign_var: assign_var '[' expr_until_rightbracket  */
+#line 876 "gram.y"
+                                        {
+						PLpgSQL_arrayelem	*new;
+
+						new = palloc0(sizeof(PLpgSQL_arrayelem));
+						new->dtype		= PLPGSQL_DTYPE_ARRAYELEM;
+						new->subscript	= (yyvsp[0].expr);
+						new->arrayparentno = (yyvsp[-2].ival);
+
+						plpgsql_adddatum((PLpgSQL_datum *) new);
+
+						(yyval.ival) = new->dno;
+					}
+#line 2496 "pl_gram.c"
+    break;
+
+  case 86: /* stmt_if: K_IF expr_until_then proc_sect stmt_else K_END K_IF ';'  */
+#line 891 "gram.y"
+                                        {
+						PLpgSQL_stmt_if *new;
+
+						new = palloc0(sizeof(PLpgSQL_stmt_if));
+						new->cmd_type	= PLPGSQL_STMT_IF;
+						new->lineno		= plpgsql_location_to_lineno((yylsp[-6]));
+						new->cond		= (yyvsp[-5].expr);
+						new->true_body	= (yyvsp[-4].list);
+						new->false_body = (yyvsp[-3].list);
+
+						(yyval.stmt) = (PLpgSQL_stmt *)new;
+					}
+#line 2513 "pl_gram.c"
+    break;
+
+  case 87: /* stmt_else: %empty  */
+#line 906 "gram.y"
+                                        {
+						(yyval.list) = NIL;
+					}
+#line 2521 "pl_gram.c"
+    break;
+
+  case 88: /* stmt_else: K_ELSIF expr_until_then proc_sect stmt_else  */
+#line 910 "gram.y"
+                                        {
+						/*----------
+						 * Translate the structure:	   into:
+						 *
+						 * IF c1 THEN				   IF c1 THEN
+						 *	 ...						   ...
+						 * ELSIF c2 THEN			   ELSE
+						 *								   IF c2 THEN
+						 *	 ...							   ...
+						 * ELSE							   ELSE
+						 *	 ...							   ...
+						 * END IF						   END IF
+						 *							   END IF
+						 *----------
+						 */
+						PLpgSQL_stmt_if *new_if;
+
+						/* first create a new if-statement */
+						new_if = palloc0(sizeof(PLpgSQL_stmt_if));
+						new_if->cmd_type	= PLPGSQL_STMT_IF;
+						new_if->lineno		= plpgsql_location_to_lineno((yylsp[-3]));
+						new_if->cond		= (yyvsp[-2].expr);
+						new_if->true_body	= (yyvsp[-1].list);
+						new_if->false_body	= (yyvsp[0].list);
+
+						/* wrap the if-statement in a "container" list */
+						(yyval.list) = list_make1(new_if);
+					}
+#line 2554 "pl_gram.c"
+    break;
+
+  case 89: /* stmt_else: K_ELSE proc_sect  */
+#line 940 "gram.y"
+                                        {
+						(yyval.list) = (yyvsp[0].list);
+					}
+#line 2562 "pl_gram.c"
+    break;
+
+  case 90: /* stmt_case: K_CASE opt_expr_until_when case_when_list opt_case_else K_END K_CASE ';'  */
+#line 946 "gram.y"
+                                        {
+						(yyval.stmt) = make_case((yylsp[-6]), (yyvsp[-5].expr), (yyvsp[-4].list), (yyvsp[-3].list));
+					}
+#line 2570 "pl_gram.c"
+    break;
+
+  case 91: /* opt_expr_until_when: %empty  */
+#line 952 "gram.y"
+                                        {
+						PLpgSQL_expr *expr = NULL;
+						int	tok = yylex();
+
+						if (tok != K_WHEN)
+						{
+							plpgsql_push_back_token(tok);
+							expr = read_sql_expression(K_WHEN, "WHEN");
+						}
+						plpgsql_push_back_token(K_WHEN);
+						(yyval.expr) = expr;
+					}
+#line 2587 "pl_gram.c"
+    break;
+
+  case 92: /* case_when_list: case_when_list case_when  */
+#line 967 "gram.y"
+                                        {
+						(yyval.list) = lappend((yyvsp[-1].list), (yyvsp[0].casewhen));
+					}
+#line 2595 "pl_gram.c"
+    break;
+
+  case 93: /* case_when_list: case_when  */
+#line 971 "gram.y"
+                                        {
+						(yyval.list) = list_make1((yyvsp[0].casewhen));
+					}
+#line 2603 "pl_gram.c"
+    break;
+
+  case 94: /* case_when: K_WHEN expr_until_then proc_sect  */
+#line 977 "gram.y"
+                                        {
+						PLpgSQL_case_when *new = palloc(sizeof(PLpgSQL_case_when));
+
+						new->lineno	= plpgsql_location_to_lineno((yylsp[-2]));
+						new->expr	= (yyvsp[-1].expr);
+						new->stmts	= (yyvsp[0].list);
+						(yyval.casewhen) = new;
+					}
+#line 2616 "pl_gram.c"
+    break;
+
+  case 95: /* opt_case_else: %empty  */
+#line 988 "gram.y"
+                                        {
+						(yyval.list) = NIL;
+					}
+#line 2624 "pl_gram.c"
+    break;
+
+  case 96: /* opt_case_else: K_ELSE proc_sect  */
+#line 992 "gram.y"
+                                        {
+						/*
+						 * proc_sect could return an empty list, but we
+						 * must distinguish that from not having ELSE at all.
+						 * Simplest fix is to return a list with one NULL
+						 * pointer, which make_case() must take care of.
+						 */
+						if ((yyvsp[0].list) != NIL)
+							(yyval.list) = (yyvsp[0].list);
+						else
+							(yyval.list) = list_make1(NULL);
+					}
+#line 2641 "pl_gram.c"
+    break;
+
+  case 97: /* stmt_loop: opt_block_label K_LOOP loop_body  */
+#line 1007 "gram.y"
+                                        {
+						PLpgSQL_stmt_loop *new;
+
+						new = palloc0(sizeof(PLpgSQL_stmt_loop));
+						new->cmd_type = PLPGSQL_STMT_LOOP;
+						new->lineno   = plpgsql_location_to_lineno((yylsp[-1]));
+						new->label	  = (yyvsp[-2].str);
+						new->body	  = (yyvsp[0].loop_body).stmts;
+
+						check_labels((yyvsp[-2].str), (yyvsp[0].loop_body).end_label, (yyvsp[0].loop_body).end_label_location);
+						plpgsql_ns_pop();
+
+						(yyval.stmt) = (PLpgSQL_stmt *)new;
+					}
+#line 2660 "pl_gram.c"
+    break;
+
+  case 98: /* stmt_while: opt_block_label K_WHILE expr_until_loop loop_body  */
+#line 1024 "gram.y"
+                                        {
+						PLpgSQL_stmt_while *new;
+
+						new = palloc0(sizeof(PLpgSQL_stmt_while));
+						new->cmd_type = PLPGSQL_STMT_WHILE;
+						new->lineno   = plpgsql_location_to_lineno((yylsp[-2]));
+						new->label	  = (yyvsp[-3].str);
+						new->cond	  = (yyvsp[-1].expr);
+						new->body	  = (yyvsp[0].loop_body).stmts;
+
+						check_labels((yyvsp[-3].str), (yyvsp[0].loop_body).end_label, (yyvsp[0].loop_body).end_label_location);
+						plpgsql_ns_pop();
+
+						(yyval.stmt) = (PLpgSQL_stmt *)new;
+					}
+#line 2680 "pl_gram.c"
+    break;
+
+  case 99: /* stmt_for: opt_block_label K_FOR for_control loop_body  */
+#line 1042 "gram.y"
+                                        {
+						/* This runs after we've scanned the loop body */
+						if ((yyvsp[-1].stmt)->cmd_type == PLPGSQL_STMT_FORI)
+						{
+							PLpgSQL_stmt_fori		*new;
+
+							new = (PLpgSQL_stmt_fori *) (yyvsp[-1].stmt);
+							new->lineno   = plpgsql_location_to_lineno((yylsp[-2]));
+							new->label	  = (yyvsp[-3].str);
+							new->body	  = (yyvsp[0].loop_body).stmts;
+							(yyval.stmt) = (PLpgSQL_stmt *) new;
+						}
+						else
+						{
+							PLpgSQL_stmt_forq		*new;
+
+							Assert((yyvsp[-1].stmt)->cmd_type == PLPGSQL_STMT_FORS ||
+								   (yyvsp[-1].stmt)->cmd_type == PLPGSQL_STMT_FORC ||
+								   (yyvsp[-1].stmt)->cmd_type == PLPGSQL_STMT_DYNFORS);
+							/* forq is the common supertype of all three */
+							new = (PLpgSQL_stmt_forq *) (yyvsp[-1].stmt);
+							new->lineno   = plpgsql_location_to_lineno((yylsp[-2]));
+							new->label	  = (yyvsp[-3].str);
+							new->body	  = (yyvsp[0].loop_body).stmts;
+							(yyval.stmt) = (PLpgSQL_stmt *) new;
+						}
+
+						check_labels((yyvsp[-3].str), (yyvsp[0].loop_body).end_label, (yyvsp[0].loop_body).end_label_location);
+						/* close namespace started in opt_block_label */
+						plpgsql_ns_pop();
+					}
+#line 2716 "pl_gram.c"
+    break;
+
+  case 100: /* for_control: for_variable K_IN  */
+#line 1076 "gram.y"
+                                        {
+						int			tok = yylex();
+						int			tokloc = yylloc;
+
+						if (tok == K_EXECUTE)
+						{
+							/* EXECUTE means it's a dynamic FOR loop */
+							PLpgSQL_stmt_dynfors	*new;
+							PLpgSQL_expr			*expr;
+							int						term;
+
+							expr = read_sql_expression2(K_LOOP, K_USING,
+														"LOOP or USING",
+														&term);
+
+							new = palloc0(sizeof(PLpgSQL_stmt_dynfors));
+							new->cmd_type = PLPGSQL_STMT_DYNFORS;
+							if ((yyvsp[-1].forvariable).rec)
+							{
+								new->rec = (yyvsp[-1].forvariable).rec;
+								check_assignable((PLpgSQL_datum *) new->rec, (yylsp[-1]));
+							}
+							else if ((yyvsp[-1].forvariable).row)
+							{
+								new->row = (yyvsp[-1].forvariable).row;
+								check_assignable((PLpgSQL_datum *) new->row, (yylsp[-1]));
+							}
+							else if ((yyvsp[-1].forvariable).scalar)
+							{
+								/* convert single scalar to list */
+								new->row = make_scalar_list1((yyvsp[-1].forvariable).name, (yyvsp[-1].forvariable).scalar,
+															 (yyvsp[-1].forvariable).lineno, (yylsp[-1]));
+								/* no need for check_assignable */
+							}
+							else
+							{
+								ereport(ERROR,
+										(errcode(ERRCODE_DATATYPE_MISMATCH),
+										 errmsg("loop variable of loop over rows must be a record or row variable or list of scalar variables"),
+										 parser_errposition((yylsp[-1]))));
+							}
+							new->query = expr;
+
+							if (term == K_USING)
+							{
+								do
+								{
+									expr = read_sql_expression2(',', K_LOOP,
+																", or LOOP",
+																&term);
+									new->params = lappend(new->params, expr);
+								} while (term == ',');
+							}
+
+							(yyval.stmt) = (PLpgSQL_stmt *) new;
+						}
+						else if (tok == T_DATUM &&
+								 yylval.wdatum.datum->dtype == PLPGSQL_DTYPE_VAR &&
+								 ((PLpgSQL_var *) yylval.wdatum.datum)->datatype->typoid == REFCURSOROID)
+						{
+							/* It's FOR var IN cursor */
+							PLpgSQL_stmt_forc	*new;
+							PLpgSQL_var			*cursor = (PLpgSQL_var *) yylval.wdatum.datum;
+
+							new = (PLpgSQL_stmt_forc *) palloc0(sizeof(PLpgSQL_stmt_forc));
+							new->cmd_type = PLPGSQL_STMT_FORC;
+							new->curvar = cursor->dno;
+
+							/* Should have had a single variable name */
+							if ((yyvsp[-1].forvariable).scalar && (yyvsp[-1].forvariable).row)
+								ereport(ERROR,
+										(errcode(ERRCODE_SYNTAX_ERROR),
+										 errmsg("cursor FOR loop must have only one target variable"),
+										 parser_errposition((yylsp[-1]))));
+
+							/* can't use an unbound cursor this way */
+							if (cursor->cursor_explicit_expr == NULL)
+								ereport(ERROR,
+										(errcode(ERRCODE_SYNTAX_ERROR),
+										 errmsg("cursor FOR loop must use a bound cursor variable"),
+										 parser_errposition(tokloc)));
+
+							/* collect cursor's parameters if any */
+							new->argquery = read_cursor_args(cursor,
+															 K_LOOP,
+															 "LOOP");
+
+							/* create loop's private RECORD variable */
+							new->rec = plpgsql_build_record((yyvsp[-1].forvariable).name,
+															(yyvsp[-1].forvariable).lineno,
+															true);
+
+							(yyval.stmt) = (PLpgSQL_stmt *) new;
+						}
+						else
+						{
+							PLpgSQL_expr	*expr1;
+							int				expr1loc;
+							bool			reverse = false;
+
+							/*
+							 * We have to distinguish between two
+							 * alternatives: FOR var IN a .. b and FOR
+							 * var IN query. Unfortunately this is
+							 * tricky, since the query in the second
+							 * form needn't start with a SELECT
+							 * keyword.  We use the ugly hack of
+							 * looking for two periods after the first
+							 * token. We also check for the REVERSE
+							 * keyword, which means it must be an
+							 * integer loop.
+							 */
+							if (tok_is_keyword(tok, &yylval,
+											   K_REVERSE, "reverse"))
+								reverse = true;
+							else
+								plpgsql_push_back_token(tok);
+
+							/*
+							 * Read tokens until we see either a ".."
+							 * or a LOOP. The text we read may not
+							 * necessarily be a well-formed SQL
+							 * statement, so we need to invoke
+							 * read_sql_construct directly.
+							 */
+							expr1 = read_sql_construct(DOT_DOT,
+													   K_LOOP,
+													   0,
+													   "LOOP",
+													   "SELECT ",
+													   true,
+													   false,
+													   &expr1loc,
+													   &tok);
+
+							if (tok == DOT_DOT)
+							{
+								/* Saw "..", so it must be an integer loop */
+								PLpgSQL_expr		*expr2;
+								PLpgSQL_expr		*expr_by;
+								PLpgSQL_var			*fvar;
+								PLpgSQL_stmt_fori	*new;
+
+								/* Check first expression is well-formed */
+								check_sql_expr(expr1->query, expr1loc, 7);
+
+								/* Read and check the second one */
+								expr2 = read_sql_expression2(K_LOOP, K_BY,
+															 "LOOP",
+															 &tok);
+
+								/* Get the BY clause if any */
+								if (tok == K_BY)
+									expr_by = read_sql_expression(K_LOOP,
+																  "LOOP");
+								else
+									expr_by = NULL;
+
+								/* Should have had a single variable name */
+								if ((yyvsp[-1].forvariable).scalar && (yyvsp[-1].forvariable).row)
+									ereport(ERROR,
+											(errcode(ERRCODE_SYNTAX_ERROR),
+											 errmsg("integer FOR loop must have only one target variable"),
+											 parser_errposition((yylsp[-1]))));
+
+								/* create loop's private variable */
+								fvar = (PLpgSQL_var *)
+									plpgsql_build_variable((yyvsp[-1].forvariable).name,
+														   (yyvsp[-1].forvariable).lineno,
+														   plpgsql_build_datatype(INT4OID,
+																				  -1),
+														   true);
+
+								new = palloc0(sizeof(PLpgSQL_stmt_fori));
+								new->cmd_type = PLPGSQL_STMT_FORI;
+								new->var	  = fvar;
+								new->reverse  = reverse;
+								new->lower	  = expr1;
+								new->upper	  = expr2;
+								new->step	  = expr_by;
+
+								(yyval.stmt) = (PLpgSQL_stmt *) new;
+							}
+							else
+							{
+								/*
+								 * No "..", so it must be a query loop. We've
+								 * prefixed an extra SELECT to the query text,
+								 * so we need to remove that before performing
+								 * syntax checking.
+								 */
+								char				*tmp_query;
+								PLpgSQL_stmt_fors	*new;
+
+								if (reverse)
+									ereport(ERROR,
+											(errcode(ERRCODE_SYNTAX_ERROR),
+											 errmsg("cannot specify REVERSE in query FOR loop"),
+											 parser_errposition(tokloc)));
+
+								Assert(strncmp(expr1->query, "SELECT ", 7) == 0);
+								tmp_query = pstrdup(expr1->query + 7);
+								pfree(expr1->query);
+								expr1->query = tmp_query;
+
+								check_sql_expr(expr1->query, expr1loc, 0);
+
+								new = palloc0(sizeof(PLpgSQL_stmt_fors));
+								new->cmd_type = PLPGSQL_STMT_FORS;
+								if ((yyvsp[-1].forvariable).rec)
+								{
+									new->rec = (yyvsp[-1].forvariable).rec;
+									check_assignable((PLpgSQL_datum *) new->rec, (yylsp[-1]));
+								}
+								else if ((yyvsp[-1].forvariable).row)
+								{
+									new->row = (yyvsp[-1].forvariable).row;
+									check_assignable((PLpgSQL_datum *) new->row, (yylsp[-1]));
+								}
+								else if ((yyvsp[-1].forvariable).scalar)
+								{
+									/* convert single scalar to list */
+									new->row = make_scalar_list1((yyvsp[-1].forvariable).name, (yyvsp[-1].forvariable).scalar,
+																 (yyvsp[-1].forvariable).lineno, (yylsp[-1]));
+									/* no need for check_assignable */
+								}
+								else
+								{
+									ereport(ERROR,
+											(errcode(ERRCODE_SYNTAX_ERROR),
+											 errmsg("loop variable of loop over rows must be a record or row variable or list of scalar variables"),
+											 parser_errposition((yylsp[-1]))));
+								}
+
+								new->query = expr1;
+								(yyval.stmt) = (PLpgSQL_stmt *) new;
+							}
+						}
+					}
+#line 2960 "pl_gram.c"
+    break;
+
+  case 101: /* for_variable: T_DATUM  */
+#line 1336 "gram.y"
+                                        {
+						(yyval.forvariable).name = NameOfDatum(&((yyvsp[0].wdatum)));
+						(yyval.forvariable).lineno = plpgsql_location_to_lineno((yylsp[0]));
+						if ((yyvsp[0].wdatum).datum->dtype == PLPGSQL_DTYPE_ROW)
+						{
+							(yyval.forvariable).scalar = NULL;
+							(yyval.forvariable).rec = NULL;
+							(yyval.forvariable).row = (PLpgSQL_row *) (yyvsp[0].wdatum).datum;
+						}
+						else if ((yyvsp[0].wdatum).datum->dtype == PLPGSQL_DTYPE_REC)
+						{
+							(yyval.forvariable).scalar = NULL;
+							(yyval.forvariable).rec = (PLpgSQL_rec *) (yyvsp[0].wdatum).datum;
+							(yyval.forvariable).row = NULL;
+						}
+						else
+						{
+							int			tok;
+
+							(yyval.forvariable).scalar = (yyvsp[0].wdatum).datum;
+							(yyval.forvariable).rec = NULL;
+							(yyval.forvariable).row = NULL;
+							/* check for comma-separated list */
+							tok = yylex();
+							plpgsql_push_back_token(tok);
+							if (tok == ',')
+								(yyval.forvariable).row = read_into_scalar_list((yyval.forvariable).name,
+															   (yyval.forvariable).scalar,
+															   (yylsp[0]));
+						}
+					}
+#line 2996 "pl_gram.c"
+    break;
+
+  case 102: /* for_variable: T_WORD  */
+#line 1368 "gram.y"
+                                        {
+						int			tok;
+
+						(yyval.forvariable).name = (yyvsp[0].word).ident;
+						(yyval.forvariable).lineno = plpgsql_location_to_lineno((yylsp[0]));
+						(yyval.forvariable).scalar = NULL;
+						(yyval.forvariable).rec = NULL;
+						(yyval.forvariable).row = NULL;
+						/* check for comma-separated list */
+						tok = yylex();
+						plpgsql_push_back_token(tok);
+						if (tok == ',')
+							word_is_not_variable(&((yyvsp[0].word)), (yylsp[0]));
+					}
+#line 3015 "pl_gram.c"
+    break;
+
+  case 103: /* for_variable: T_CWORD  */
+#line 1383 "gram.y"
+                                        {
+						/* just to give a better message than "syntax error" */
+						cword_is_not_variable(&((yyvsp[0].cword)), (yylsp[0]));
+					}
+#line 3024 "pl_gram.c"
+    break;
+
+  case 104: /* stmt_exit: exit_type opt_label opt_exitcond  */
+#line 1390 "gram.y"
+                                        {
+						PLpgSQL_stmt_exit *new;
+
+						new = palloc0(sizeof(PLpgSQL_stmt_exit));
+						new->cmd_type = PLPGSQL_STMT_EXIT;
+						new->is_exit  = (yyvsp[-2].boolean);
+						new->lineno	  = plpgsql_location_to_lineno((yylsp[-2]));
+						new->label	  = (yyvsp[-1].str);
+						new->cond	  = (yyvsp[0].expr);
+
+						(yyval.stmt) = (PLpgSQL_stmt *)new;
+					}
+#line 3041 "pl_gram.c"
+    break;
+
+  case 105: /* exit_type: K_EXIT  */
+#line 1405 "gram.y"
+                                        {
+						(yyval.boolean) = true;
+					}
+#line 3049 "pl_gram.c"
+    break;
+
+  case 106: /* exit_type: K_CONTINUE  */
+#line 1409 "gram.y"
+                                        {
+						(yyval.boolean) = false;
+					}
+#line 3057 "pl_gram.c"
+    break;
+
+  case 107: /* stmt_return: K_RETURN  */
+#line 1415 "gram.y"
+                                        {
+						int	tok;
+
+						tok = yylex();
+						if (tok == 0)
+							yyerror("unexpected end of function definition");
+
+						if (tok_is_keyword(tok, &yylval,
+										   K_NEXT, "next"))
+						{
+							(yyval.stmt) = make_return_next_stmt((yylsp[0]));
+						}
+						else if (tok_is_keyword(tok, &yylval,
+												K_QUERY, "query"))
+						{
+							(yyval.stmt) = make_return_query_stmt((yylsp[0]));
+						}
+						else
+						{
+							plpgsql_push_back_token(tok);
+							(yyval.stmt) = make_return_stmt((yylsp[0]));
+						}
+					}
+#line 3085 "pl_gram.c"
+    break;
+
+  case 108: /* stmt_raise: K_RAISE  */
+#line 1441 "gram.y"
+                                        {
+						PLpgSQL_stmt_raise		*new;
+						int	tok;
+
+						new = palloc(sizeof(PLpgSQL_stmt_raise));
+
+						new->cmd_type	= PLPGSQL_STMT_RAISE;
+						new->lineno		= plpgsql_location_to_lineno((yylsp[0]));
+						new->elog_level = ERROR;	/* default */
+						new->condname	= NULL;
+						new->message	= NULL;
+						new->params		= NIL;
+						new->options	= NIL;
+
+						tok = yylex();
+						if (tok == 0)
+							yyerror("unexpected end of function definition");
+
+						/*
+						 * We could have just RAISE, meaning to re-throw
+						 * the current error.
+						 */
+						if (tok != ';')
+						{
+							/*
+							 * First is an optional elog severity level.
+							 */
+							if (tok_is_keyword(tok, &yylval,
+											   K_EXCEPTION, "exception"))
+							{
+								new->elog_level = ERROR;
+								tok = yylex();
+							}
+							else if (tok_is_keyword(tok, &yylval,
+													K_WARNING, "warning"))
+							{
+								new->elog_level = WARNING;
+								tok = yylex();
+							}
+							else if (tok_is_keyword(tok, &yylval,
+													K_NOTICE, "notice"))
+							{
+								new->elog_level = NOTICE;
+								tok = yylex();
+							}
+							else if (tok_is_keyword(tok, &yylval,
+													K_INFO, "info"))
+							{
+								new->elog_level = INFO;
+								tok = yylex();
+							}
+							else if (tok_is_keyword(tok, &yylval,
+													K_LOG, "log"))
+							{
+								new->elog_level = LOG;
+								tok = yylex();
+							}
+							else if (tok_is_keyword(tok, &yylval,
+													K_DEBUG, "debug"))
+							{
+								new->elog_level = DEBUG1;
+								tok = yylex();
+							}
+							if (tok == 0)
+								yyerror("unexpected end of function definition");
+
+							/*
+							 * Next we can have a condition name, or
+							 * equivalently SQLSTATE 'xxxxx', or a string
+							 * literal that is the old-style message format,
+							 * or USING to start the option list immediately.
+							 */
+							if (tok == SCONST)
+							{
+								/* old style message and parameters */
+								new->message = yylval.str;
+								/*
+								 * We expect either a semi-colon, which
+								 * indicates no parameters, or a comma that
+								 * begins the list of parameter expressions,
+								 * or USING to begin the options list.
+								 */
+								tok = yylex();
+								if (tok != ',' && tok != ';' && tok != K_USING)
+									yyerror("syntax error");
+
+								while (tok == ',')
+								{
+									PLpgSQL_expr *expr;
+
+									expr = read_sql_construct(',', ';', K_USING,
+															  ", or ; or USING",
+															  "SELECT ",
+															  true, true,
+															  NULL, &tok);
+									new->params = lappend(new->params, expr);
+								}
+							}
+							else if (tok != K_USING)
+							{
+								/* must be condition name or SQLSTATE */
+								if (tok_is_keyword(tok, &yylval,
+												   K_SQLSTATE, "sqlstate"))
+								{
+									/* next token should be a string literal */
+									char   *sqlstatestr;
+
+									if (yylex() != SCONST)
+										yyerror("syntax error");
+									sqlstatestr = yylval.str;
+
+									if (strlen(sqlstatestr) != 5)
+										yyerror("invalid SQLSTATE code");
+									if (strspn(sqlstatestr, "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ") != 5)
+										yyerror("invalid SQLSTATE code");
+									new->condname = sqlstatestr;
+								}
+								else
+								{
+									if (tok != T_WORD)
+										yyerror("syntax error");
+									new->condname = yylval.word.ident;
+									plpgsql_recognize_err_condition(new->condname,
+																	false);
+								}
+								tok = yylex();
+								if (tok != ';' && tok != K_USING)
+									yyerror("syntax error");
+							}
+
+							if (tok == K_USING)
+								new->options = read_raise_options();
+						}
+
+						(yyval.stmt) = (PLpgSQL_stmt *)new;
+					}
+#line 3226 "pl_gram.c"
+    break;
+
+  case 109: /* loop_body: proc_sect K_END K_LOOP opt_label ';'  */
+#line 1580 "gram.y"
+                                        {
+						(yyval.loop_body).stmts = (yyvsp[-4].list);
+						(yyval.loop_body).end_label = (yyvsp[-1].str);
+						(yyval.loop_body).end_label_location = (yylsp[-1]);
+					}
+#line 3236 "pl_gram.c"
+    break;
+
+  case 110: /* stmt_execsql: K_INSERT  */
+#line 1598 "gram.y"
+                                        {
+						(yyval.stmt) = make_execsql_stmt(K_INSERT, (yylsp[0]));
+					}
+#line 3244 "pl_gram.c"
+    break;
+
+  case 111: /* stmt_execsql: T_WORD  */
+#line 1602 "gram.y"
+                                        {
+						int			tok;
+
+						tok = yylex();
+						plpgsql_push_back_token(tok);
+						if (tok == '=' || tok == COLON_EQUALS || tok == '[')
+							word_is_not_variable(&((yyvsp[0].word)), (yylsp[0]));
+						(yyval.stmt) = make_execsql_stmt(T_WORD, (yylsp[0]));
+					}
+#line 3258 "pl_gram.c"
+    break;
+
+  case 112: /* stmt_execsql: T_CWORD  */
+#line 1612 "gram.y"
+                                        {
+						int			tok;
+
+						tok = yylex();
+						plpgsql_push_back_token(tok);
+						if (tok == '=' || tok == COLON_EQUALS || tok == '[')
+							cword_is_not_variable(&((yyvsp[0].cword)), (yylsp[0]));
+						(yyval.stmt) = make_execsql_stmt(T_CWORD, (yylsp[0]));
+					}
+#line 3272 "pl_gram.c"
+    break;
+
+  case 113: /* stmt_dynexecute: K_EXECUTE  */
+#line 1624 "gram.y"
+                                        {
+						PLpgSQL_stmt_dynexecute *new;
+						PLpgSQL_expr *expr;
+						int endtoken;
+
+						expr = read_sql_construct(K_INTO, K_USING, ';',
+												  "INTO or USING or ;",
+												  "SELECT ",
+												  true, true,
+												  NULL, &endtoken);
+
+						new = palloc(sizeof(PLpgSQL_stmt_dynexecute));
+						new->cmd_type = PLPGSQL_STMT_DYNEXECUTE;
+						new->lineno = plpgsql_location_to_lineno((yylsp[0]));
+						new->query = expr;
+						new->into = false;
+						new->strict = false;
+						new->rec = NULL;
+						new->row = NULL;
+						new->params = NIL;
+
+						/* If we found "INTO", collect the argument */
+						if (endtoken == K_INTO)
+						{
+							new->into = true;
+							read_into_target(&new->rec, &new->row, &new->strict);
+							endtoken = yylex();
+							if (endtoken != ';' && endtoken != K_USING)
+								yyerror("syntax error");
+						}
+
+						/* If we found "USING", collect the argument(s) */
+						if (endtoken == K_USING)
+						{
+							do
+							{
+								expr = read_sql_expression2(',', ';',
+															", or ;",
+															&endtoken);
+								new->params = lappend(new->params, expr);
+							} while (endtoken == ',');
+						}
+
+						(yyval.stmt) = (PLpgSQL_stmt *)new;
+					}
+#line 3322 "pl_gram.c"
+    break;
+
+  case 114: /* stmt_open: K_OPEN cursor_variable  */
+#line 1673 "gram.y"
+                                        {
+						PLpgSQL_stmt_open *new;
+						int				  tok;
+
+						new = palloc0(sizeof(PLpgSQL_stmt_open));
+						new->cmd_type = PLPGSQL_STMT_OPEN;
+						new->lineno = plpgsql_location_to_lineno((yylsp[-1]));
+						new->curvar = (yyvsp[0].var)->dno;
+						new->cursor_options = CURSOR_OPT_FAST_PLAN;
+
+						if ((yyvsp[0].var)->cursor_explicit_expr == NULL)
+						{
+							/* be nice if we could use opt_scrollable here */
+						    tok = yylex();
+							if (tok_is_keyword(tok, &yylval,
+											   K_NO, "no"))
+							{
+								tok = yylex();
+								if (tok_is_keyword(tok, &yylval,
+												   K_SCROLL, "scroll"))
+								{
+									new->cursor_options |= CURSOR_OPT_NO_SCROLL;
+									tok = yylex();
+								}
+							}
+							else if (tok_is_keyword(tok, &yylval,
+													K_SCROLL, "scroll"))
+							{
+								new->cursor_options |= CURSOR_OPT_SCROLL;
+								tok = yylex();
+							}
+
+							if (tok != K_FOR)
+								yyerror("syntax error, expected \"FOR\"");
+
+							tok = yylex();
+							if (tok == K_EXECUTE)
+							{
+								int		endtoken;
+
+								new->dynquery =
+									read_sql_expression2(K_USING, ';',
+														 "USING or ;",
+														 &endtoken);
+
+								/* If we found "USING", collect argument(s) */
+								if (endtoken == K_USING)
+								{
+									PLpgSQL_expr *expr;
+									
+									do
+									{
+										expr = read_sql_expression2(',', ';',
+																	", or ;",
+																	&endtoken);
+										new->params = lappend(new->params,
+															  expr);
+									} while (endtoken == ',');
+								}
+							}
+							else
+							{
+								plpgsql_push_back_token(tok);
+								new->query = read_sql_stmt("");
+							}
+						}
+						else
+						{
+							/* predefined cursor query, so read args */
+							new->argquery = read_cursor_args((yyvsp[0].var), ';', ";");
+						}
+
+						(yyval.stmt) = (PLpgSQL_stmt *)new;
+					}
+#line 3401 "pl_gram.c"
+    break;
+
+  case 115: /* stmt_fetch: K_FETCH opt_fetch_direction cursor_variable K_INTO  */
+#line 1750 "gram.y"
+                                        {
+						PLpgSQL_stmt_fetch *fetch = (yyvsp[-2].fetch);
+						PLpgSQL_rec	   *rec;
+						PLpgSQL_row	   *row;
+
+						/* We have already parsed everything through the INTO keyword */
+						read_into_target(&rec, &row, NULL);
+
+						if (yylex() != ';')
+							yyerror("syntax error");
+
+						/*
+						 * We don't allow multiple rows in PL/pgSQL's FETCH
+						 * statement, only in MOVE.
+						 */
+						if (fetch->returns_multiple_rows)
+							ereport(ERROR,
+									(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+									 errmsg("FETCH statement cannot return multiple rows"),
+									 parser_errposition((yylsp[-3]))));
+
+						fetch->lineno = plpgsql_location_to_lineno((yylsp[-3]));
+						fetch->rec		= rec;
+						fetch->row		= row;
+						fetch->curvar	= (yyvsp[-1].var)->dno;
+						fetch->is_move	= false;
+
+						(yyval.stmt) = (PLpgSQL_stmt *)fetch;
+					}
+#line 3435 "pl_gram.c"
+    break;
+
+  case 116: /* stmt_move: K_MOVE opt_fetch_direction cursor_variable ';'  */
+#line 1782 "gram.y"
+                                        {
+						PLpgSQL_stmt_fetch *fetch = (yyvsp[-2].fetch);
+
+						fetch->lineno = plpgsql_location_to_lineno((yylsp[-3]));
+						fetch->curvar	= (yyvsp[-1].var)->dno;
+						fetch->is_move	= true;
+
+						(yyval.stmt) = (PLpgSQL_stmt *)fetch;
+					}
+#line 3449 "pl_gram.c"
+    break;
+
+  case 117: /* opt_fetch_direction: %empty  */
+#line 1794 "gram.y"
+                                        {
+						(yyval.fetch) = read_fetch_direction();
+					}
+#line 3457 "pl_gram.c"
+    break;
+
+  case 118: /* stmt_close: K_CLOSE cursor_variable ';'  */
+#line 1800 "gram.y"
+                                        {
+						PLpgSQL_stmt_close *new;
+
+						new = palloc(sizeof(PLpgSQL_stmt_close));
+						new->cmd_type = PLPGSQL_STMT_CLOSE;
+						new->lineno = plpgsql_location_to_lineno((yylsp[-2]));
+						new->curvar = (yyvsp[-1].var)->dno;
+
+						(yyval.stmt) = (PLpgSQL_stmt *)new;
+					}
+#line 3472 "pl_gram.c"
+    break;
+
+  case 119: /* stmt_null: K_NULL ';'  */
+#line 1813 "gram.y"
+                                        {
+						/* We do not bother building a node for NULL */
+						(yyval.stmt) = NULL;
+					}
+#line 3481 "pl_gram.c"
+    break;
+
+  case 120: /* cursor_variable: T_DATUM  */
+#line 1820 "gram.y"
+                                        {
+						if ((yyvsp[0].wdatum).datum->dtype != PLPGSQL_DTYPE_VAR)
+							ereport(ERROR,
+									(errcode(ERRCODE_DATATYPE_MISMATCH),
+									 errmsg("cursor variable must be a simple variable"),
+									 parser_errposition((yylsp[0]))));
+
+						if (((PLpgSQL_var *) (yyvsp[0].wdatum).datum)->datatype->typoid != REFCURSOROID)
+							ereport(ERROR,
+									(errcode(ERRCODE_DATATYPE_MISMATCH),
+									 errmsg("variable \"%s\" must be of type cursor or refcursor",
+											((PLpgSQL_var *) (yyvsp[0].wdatum).datum)->refname),
+									 parser_errposition((yylsp[0]))));
+						(yyval.var) = (PLpgSQL_var *) (yyvsp[0].wdatum).datum;
+					}
+#line 3501 "pl_gram.c"
+    break;
+
+  case 121: /* cursor_variable: T_WORD  */
+#line 1836 "gram.y"
+                                        {
+						/* just to give a better message than "syntax error" */
+						word_is_not_variable(&((yyvsp[0].word)), (yylsp[0]));
+					}
+#line 3510 "pl_gram.c"
+    break;
+
+  case 122: /* cursor_variable: T_CWORD  */
+#line 1841 "gram.y"
+                                        {
+						/* just to give a better message than "syntax error" */
+						cword_is_not_variable(&((yyvsp[0].cword)), (yylsp[0]));
+					}
+#line 3519 "pl_gram.c"
+    break;
+
+  case 123: /* exception_sect: %empty  */
+#line 1848 "gram.y"
+                                        { (yyval.exception_block) = NULL; }
+#line 3525 "pl_gram.c"
+    break;
+
+  case 124: /* @2: %empty  */
+#line 1850 "gram.y"
+                                        {
+						/*
+						 * We use a mid-rule action to add these
+						 * special variables to the namespace before
+						 * parsing the WHEN clauses themselves.  The
+						 * scope of the names extends to the end of the
+						 * current block.
+						 */
+						int			lineno = plpgsql_location_to_lineno((yylsp[0]));
+						PLpgSQL_exception_block *new = palloc(sizeof(PLpgSQL_exception_block));
+						PLpgSQL_variable *var;
+
+						var = plpgsql_build_variable("sqlstate", lineno,
+													 plpgsql_build_datatype(TEXTOID, -1),
+													 true);
+						((PLpgSQL_var *) var)->isconst = true;
+						new->sqlstate_varno = var->dno;
+
+						var = plpgsql_build_variable("sqlerrm", lineno,
+													 plpgsql_build_datatype(TEXTOID, -1),
+													 true);
+						((PLpgSQL_var *) var)->isconst = true;
+						new->sqlerrm_varno = var->dno;
+
+						(yyval.exception_block) = new;
+					}
+#line 3556 "pl_gram.c"
+    break;
+
+  case 125: /* exception_sect: K_EXCEPTION @2 proc_exceptions  */
+#line 1877 "gram.y"
+                                        {
+						PLpgSQL_exception_block *new = (yyvsp[-1].exception_block);
+						new->exc_list = (yyvsp[0].list);
+
+						(yyval.exception_block) = new;
+					}
+#line 3567 "pl_gram.c"
+    break;
+
+  case 126: /* proc_exceptions: proc_exceptions proc_exception  */
+#line 1886 "gram.y"
+                                                {
+							(yyval.list) = lappend((yyvsp[-1].list), (yyvsp[0].exception));
+						}
+#line 3575 "pl_gram.c"
+    break;
+
+  case 127: /* proc_exceptions: proc_exception  */
+#line 1890 "gram.y"
+                                                {
+							(yyval.list) = list_make1((yyvsp[0].exception));
+						}
+#line 3583 "pl_gram.c"
+    break;
+
+  case 128: /* proc_exception: K_WHEN proc_conditions K_THEN proc_sect  */
+#line 1896 "gram.y"
+                                        {
+						PLpgSQL_exception *new;
+
+						new = palloc0(sizeof(PLpgSQL_exception));
+						new->lineno     = plpgsql_location_to_lineno((yylsp[-3]));
+						new->conditions = (yyvsp[-2].condition);
+						new->action	    = (yyvsp[0].list);
+
+						(yyval.exception) = new;
+					}
+#line 3598 "pl_gram.c"
+    break;
+
+  case 129: /* proc_conditions: proc_conditions K_OR proc_condition  */
+#line 1909 "gram.y"
+                                                {
+							PLpgSQL_condition	*old;
+
+							for (old = (yyvsp[-2].condition); old->next != NULL; old = old->next)
+								/* skip */ ;
+							old->next = (yyvsp[0].condition);
+							(yyval.condition) = (yyvsp[-2].condition);
+						}
+#line 3611 "pl_gram.c"
+    break;
+
+  case 130: /* proc_conditions: proc_condition  */
+#line 1918 "gram.y"
+                                                {
+							(yyval.condition) = (yyvsp[0].condition);
+						}
+#line 3619 "pl_gram.c"
+    break;
+
+  case 131: /* proc_condition: any_identifier  */
+#line 1924 "gram.y"
+                                                {
+							if (strcmp((yyvsp[0].str), "sqlstate") != 0)
+							{
+								(yyval.condition) = plpgsql_parse_err_condition((yyvsp[0].str));
+							}
+							else
+							{
+								PLpgSQL_condition *new;
+								char   *sqlstatestr;
+
+								/* next token should be a string literal */
+								if (yylex() != SCONST)
+									yyerror("syntax error");
+								sqlstatestr = yylval.str;
+
+								if (strlen(sqlstatestr) != 5)
+									yyerror("invalid SQLSTATE code");
+								if (strspn(sqlstatestr, "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ") != 5)
+									yyerror("invalid SQLSTATE code");
+
+								new = palloc(sizeof(PLpgSQL_condition));
+								new->sqlerrstate =
+									MAKE_SQLSTATE(sqlstatestr[0],
+												  sqlstatestr[1],
+												  sqlstatestr[2],
+												  sqlstatestr[3],
+												  sqlstatestr[4]);
+								new->condname = sqlstatestr;
+								new->next = NULL;
+
+								(yyval.condition) = new;
+							}
+						}
+#line 3657 "pl_gram.c"
+    break;
+
+  case 132: /* expr_until_semi: %empty  */
+#line 1960 "gram.y"
+                                        { (yyval.expr) = read_sql_expression(';', ";"); }
+#line 3663 "pl_gram.c"
+    break;
+
+  case 133: /* expr_until_rightbracket: %empty  */
+#line 1964 "gram.y"
+                                        { (yyval.expr) = read_sql_expression(']', "]"); }
+#line 3669 "pl_gram.c"
+    break;
+
+  case 134: /* expr_until_then: %empty  */
+#line 1968 "gram.y"
+                                        { (yyval.expr) = read_sql_expression(K_THEN, "THEN"); }
+#line 3675 "pl_gram.c"
+    break;
+
+  case 135: /* expr_until_loop: %empty  */
+#line 1972 "gram.y"
+                                        { (yyval.expr) = read_sql_expression(K_LOOP, "LOOP"); }
+#line 3681 "pl_gram.c"
+    break;
+
+  case 136: /* opt_block_label: %empty  */
+#line 1976 "gram.y"
+                                        {
+						plpgsql_ns_push(NULL);
+						(yyval.str) = NULL;
+					}
+#line 3690 "pl_gram.c"
+    break;
+
+  case 137: /* opt_block_label: LESS_LESS any_identifier GREATER_GREATER  */
+#line 1981 "gram.y"
+                                        {
+						plpgsql_ns_push((yyvsp[-1].str));
+						(yyval.str) = (yyvsp[-1].str);
+					}
+#line 3699 "pl_gram.c"
+    break;
+
+  case 138: /* opt_label: %empty  */
+#line 1988 "gram.y"
+                                        {
+						(yyval.str) = NULL;
+					}
+#line 3707 "pl_gram.c"
+    break;
+
+  case 139: /* opt_label: any_identifier  */
+#line 1992 "gram.y"
+                                        {
+						if (plpgsql_ns_lookup_label(plpgsql_ns_top(), (yyvsp[0].str)) == NULL)
+							yyerror("label does not exist");
+						(yyval.str) = (yyvsp[0].str);
+					}
+#line 3717 "pl_gram.c"
+    break;
+
+  case 140: /* opt_exitcond: ';'  */
+#line 2000 "gram.y"
+                                        { (yyval.expr) = NULL; }
+#line 3723 "pl_gram.c"
+    break;
+
+  case 141: /* opt_exitcond: K_WHEN expr_until_semi  */
+#line 2002 "gram.y"
+                                        { (yyval.expr) = (yyvsp[0].expr); }
+#line 3729 "pl_gram.c"
+    break;
+
+  case 142: /* any_identifier: T_WORD  */
+#line 2009 "gram.y"
+                                        {
+						(yyval.str) = (yyvsp[0].word).ident;
+					}
+#line 3737 "pl_gram.c"
+    break;
+
+  case 143: /* any_identifier: T_DATUM  */
+#line 2013 "gram.y"
+                                        {
+						if ((yyvsp[0].wdatum).ident == NULL) /* composite name not OK */
+							yyerror("syntax error");
+						(yyval.str) = (yyvsp[0].wdatum).ident;
+					}
+#line 3747 "pl_gram.c"
+    break;
+
+
+#line 3751 "pl_gram.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+  *++yylsp = yyloc;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  yyerror_range[1] = yylloc;
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, &yylloc);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+      yyerror_range[1] = *yylsp;
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, yylsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  yyerror_range[2] = yylloc;
+  ++yylsp;
+  YYLLOC_DEFAULT (*yylsp, yyerror_range, 2);
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval, &yylloc);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, yylsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 2059 "gram.y"
+
+
+/*
+ * Check whether a token represents an "unreserved keyword".
+ * We have various places where we want to recognize a keyword in preference
+ * to a variable name, but not reserve that keyword in other contexts.
+ * Hence, this kluge.
+ */
+static bool
+tok_is_keyword(int token, union YYSTYPE *lval,
+			   int kw_token, const char *kw_str)
+{
+	if (token == kw_token)
+	{
+		/* Normal case, was recognized by scanner (no conflicting variable) */
+		return true;
+	}
+	else if (token == T_DATUM)
+	{
+		/*
+		 * It's a variable, so recheck the string name.  Note we will not
+		 * match composite names (hence an unreserved word followed by "."
+		 * will not be recognized).
+		 */
+		if (!lval->word.quoted && lval->word.ident != NULL &&
+			strcmp(lval->word.ident, kw_str) == 0)
+			return true;
+	}
+	return false;				/* not the keyword */
+}
+
+/*
+ * Convenience routine to complain when we expected T_DATUM and got T_WORD,
+ * ie, unrecognized variable.
+ */
+static void
+word_is_not_variable(PLword *word, int location)
+{
+	ereport(ERROR,
+			(errcode(ERRCODE_SYNTAX_ERROR),
+			 errmsg("\"%s\" is not a known variable",
+					word->ident),
+			 parser_errposition(location)));
+}
+
+/* Same, for a CWORD */
+static void
+cword_is_not_variable(PLcword *cword, int location)
+{
+	ereport(ERROR,
+			(errcode(ERRCODE_SYNTAX_ERROR),
+			 errmsg("\"%s\" is not a known variable",
+					NameListToString(cword->idents)),
+			 parser_errposition(location)));
+}
+
+/*
+ * Convenience routine to complain when we expected T_DATUM and got
+ * something else.  "tok" must be the current token, since we also
+ * look at yylval and yylloc.
+ */
+static void
+current_token_is_not_variable(int tok)
+{
+	if (tok == T_WORD)
+		word_is_not_variable(&(yylval.word), yylloc);
+	else if (tok == T_CWORD)
+		cword_is_not_variable(&(yylval.cword), yylloc);
+	else
+		yyerror("syntax error");
+}
+
+/* Convenience routine to read an expression with one possible terminator */
+static PLpgSQL_expr *
+read_sql_expression(int until, const char *expected)
+{
+	return read_sql_construct(until, 0, 0, expected,
+							  "SELECT ", true, true, NULL, NULL);
+}
+
+/* Convenience routine to read an expression with two possible terminators */
+static PLpgSQL_expr *
+read_sql_expression2(int until, int until2, const char *expected,
+					 int *endtoken)
+{
+	return read_sql_construct(until, until2, 0, expected,
+							  "SELECT ", true, true, NULL, endtoken);
+}
+
+/* Convenience routine to read a SQL statement that must end with ';' */
+static PLpgSQL_expr *
+read_sql_stmt(const char *sqlstart)
+{
+	return read_sql_construct(';', 0, 0, ";",
+							  sqlstart, false, true, NULL, NULL);
+}
+
+/*
+ * Read a SQL construct and build a PLpgSQL_expr for it.
+ *
+ * until:		token code for expected terminator
+ * until2:		token code for alternate terminator (pass 0 if none)
+ * until3:		token code for another alternate terminator (pass 0 if none)
+ * expected:	text to use in complaining that terminator was not found
+ * sqlstart:	text to prefix to the accumulated SQL text
+ * isexpression: whether to say we're reading an "expression" or a "statement"
+ * valid_sql:   whether to check the syntax of the expr (prefixed with sqlstart)
+ * startloc:	if not NULL, location of first token is stored at *startloc
+ * endtoken:	if not NULL, ending token is stored at *endtoken
+ *				(this is only interesting if until2 or until3 isn't zero)
+ */
+static PLpgSQL_expr *
+read_sql_construct(int until,
+				   int until2,
+				   int until3,
+				   const char *expected,
+				   const char *sqlstart,
+				   bool isexpression,
+				   bool valid_sql,
+				   int *startloc,
+				   int *endtoken)
+{
+	int					tok;
+	StringInfoData		ds;
+	IdentifierLookup	save_IdentifierLookup;
+	int					startlocation = -1;
+	int					parenlevel = 0;
+	PLpgSQL_expr		*expr;
+
+	initStringInfo(&ds);
+	appendStringInfoString(&ds, sqlstart);
+
+	/* special lookup mode for identifiers within the SQL text */
+	save_IdentifierLookup = plpgsql_IdentifierLookup;
+	plpgsql_IdentifierLookup = IDENTIFIER_LOOKUP_EXPR;
+
+	for (;;)
+	{
+		tok = yylex();
+		if (startlocation < 0)			/* remember loc of first token */
+			startlocation = yylloc;
+		if (tok == until && parenlevel == 0)
+			break;
+		if (tok == until2 && parenlevel == 0)
+			break;
+		if (tok == until3 && parenlevel == 0)
+			break;
+		if (tok == '(' || tok == '[')
+			parenlevel++;
+		else if (tok == ')' || tok == ']')
+		{
+			parenlevel--;
+			if (parenlevel < 0)
+				yyerror("mismatched parentheses");
+		}
+		/*
+		 * End of function definition is an error, and we don't expect to
+		 * hit a semicolon either (unless it's the until symbol, in which
+		 * case we should have fallen out above).
+		 */
+		if (tok == 0 || tok == ';')
+		{
+			if (parenlevel != 0)
+				yyerror("mismatched parentheses");
+			if (isexpression)
+				ereport(ERROR,
+						(errcode(ERRCODE_SYNTAX_ERROR),
+						 errmsg("missing \"%s\" at end of SQL expression",
+								expected),
+						 parser_errposition(yylloc)));
+			else
+				ereport(ERROR,
+						(errcode(ERRCODE_SYNTAX_ERROR),
+						 errmsg("missing \"%s\" at end of SQL statement",
+								expected),
+						 parser_errposition(yylloc)));
+		}
+	}
+
+	plpgsql_IdentifierLookup = save_IdentifierLookup;
+
+	if (startloc)
+		*startloc = startlocation;
+	if (endtoken)
+		*endtoken = tok;
+
+	/* give helpful complaint about empty input */
+	if (startlocation >= yylloc)
+	{
+		if (isexpression)
+			yyerror("missing expression");
+		else
+			yyerror("missing SQL statement");
+	}
+
+	plpgsql_append_source_text(&ds, startlocation, yylloc);
+
+	/* trim any trailing whitespace, for neatness */
+	while (ds.len > 0 && scanner_isspace(ds.data[ds.len - 1]))
+		ds.data[--ds.len] = '\0';
+
+	expr = palloc0(sizeof(PLpgSQL_expr));
+	expr->dtype			= PLPGSQL_DTYPE_EXPR;
+	expr->query			= pstrdup(ds.data);
+	expr->plan			= NULL;
+	expr->paramnos		= NULL;
+	expr->ns            = plpgsql_ns_top();
+	pfree(ds.data);
+
+	if (valid_sql)
+		check_sql_expr(expr->query, startlocation, strlen(sqlstart));
+
+	return expr;
+}
+
+static PLpgSQL_type *
+read_datatype(int tok)
+{
+	StringInfoData		ds;
+	char			   *type_name;
+	int					startlocation;
+	PLpgSQL_type		*result;
+	int					parenlevel = 0;
+
+	/* Should only be called while parsing DECLARE sections */
+	Assert(plpgsql_IdentifierLookup == IDENTIFIER_LOOKUP_DECLARE);
+
+	/* Often there will be a lookahead token, but if not, get one */
+	if (tok == YYEMPTY)
+		tok = yylex();
+
+	startlocation = yylloc;
+
+	/*
+	 * If we have a simple or composite identifier, check for %TYPE
+	 * and %ROWTYPE constructs.
+	 */
+	if (tok == T_WORD)
+	{
+		char   *dtname = yylval.word.ident;
+
+		tok = yylex();
+		if (tok == '%')
+		{
+			tok = yylex();
+			if (tok_is_keyword(tok, &yylval,
+							   K_TYPE, "type"))
+			{
+				result = plpgsql_parse_wordtype(dtname);
+				if (result)
+					return result;
+			}
+			else if (tok_is_keyword(tok, &yylval,
+									K_ROWTYPE, "rowtype"))
+			{
+				result = plpgsql_parse_wordrowtype(dtname);
+				if (result)
+					return result;
+			}
+		}
+	}
+	else if (tok == T_CWORD)
+	{
+		List   *dtnames = yylval.cword.idents;
+
+		tok = yylex();
+		if (tok == '%')
+		{
+			tok = yylex();
+			if (tok_is_keyword(tok, &yylval,
+							   K_TYPE, "type"))
+			{
+				result = plpgsql_parse_cwordtype(dtnames);
+				if (result)
+					return result;
+			}
+			else if (tok_is_keyword(tok, &yylval,
+									K_ROWTYPE, "rowtype"))
+			{
+				result = plpgsql_parse_cwordrowtype(dtnames);
+				if (result)
+					return result;
+			}
+		}
+	}
+
+	while (tok != ';')
+	{
+		if (tok == 0)
+		{
+			if (parenlevel != 0)
+				yyerror("mismatched parentheses");
+			else
+				yyerror("incomplete data type declaration");
+		}
+		/* Possible followers for datatype in a declaration */
+		if (tok == K_NOT || tok == '=' || tok == COLON_EQUALS || tok == K_DEFAULT)
+			break;
+		/* Possible followers for datatype in a cursor_arg list */
+		if ((tok == ',' || tok == ')') && parenlevel == 0)
+			break;
+		if (tok == '(')
+			parenlevel++;
+		else if (tok == ')')
+			parenlevel--;
+
+		tok = yylex();
+	}
+
+	/* set up ds to contain complete typename text */
+	initStringInfo(&ds);
+	plpgsql_append_source_text(&ds, startlocation, yylloc);
+	type_name = ds.data;
+
+	if (type_name[0] == '\0')
+		yyerror("missing data type declaration");
+
+	result = parse_datatype(type_name, startlocation);
+
+	pfree(ds.data);
+
+	plpgsql_push_back_token(tok);
+
+	return result;
+}
+
+static PLpgSQL_stmt *
+make_execsql_stmt(int firsttoken, int location)
+{
+	StringInfoData		ds;
+	IdentifierLookup	save_IdentifierLookup;
+	PLpgSQL_stmt_execsql *execsql;
+	PLpgSQL_expr		*expr;
+	PLpgSQL_row			*row = NULL;
+	PLpgSQL_rec			*rec = NULL;
+	int					tok;
+	int					prev_tok;
+	bool				have_into = false;
+	bool				have_strict = false;
+	int					into_start_loc = -1;
+	int					into_end_loc = -1;
+
+	initStringInfo(&ds);
+
+	/* special lookup mode for identifiers within the SQL text */
+	save_IdentifierLookup = plpgsql_IdentifierLookup;
+	plpgsql_IdentifierLookup = IDENTIFIER_LOOKUP_EXPR;
+
+	/*
+	 * We have to special-case the sequence INSERT INTO, because we don't want
+	 * that to be taken as an INTO-variables clause.  Fortunately, this is the
+	 * only valid use of INTO in a pl/pgsql SQL command, and INTO is already a
+	 * fully reserved word in the main grammar.  We have to treat it that way
+	 * anywhere in the string, not only at the start; consider CREATE RULE
+	 * containing an INSERT statement.
+	 */
+	tok = firsttoken;
+	for (;;)
+	{
+		prev_tok = tok;
+		tok = yylex();
+		if (have_into && into_end_loc < 0)
+			into_end_loc = yylloc;		/* token after the INTO part */
+		if (tok == ';')
+			break;
+		if (tok == 0)
+			yyerror("unexpected end of function definition");
+
+		if (tok == K_INTO && prev_tok != K_INSERT)
+		{
+			if (have_into)
+				yyerror("INTO specified more than once");
+			have_into = true;
+			into_start_loc = yylloc;
+			plpgsql_IdentifierLookup = IDENTIFIER_LOOKUP_NORMAL;
+			read_into_target(&rec, &row, &have_strict);
+			plpgsql_IdentifierLookup = IDENTIFIER_LOOKUP_EXPR;
+		}
+	}
+
+	plpgsql_IdentifierLookup = save_IdentifierLookup;
+
+	if (have_into)
+	{
+		/*
+		 * Insert an appropriate number of spaces corresponding to the
+		 * INTO text, so that locations within the redacted SQL statement
+		 * still line up with those in the original source text.
+		 */
+		plpgsql_append_source_text(&ds, location, into_start_loc);
+		appendStringInfoSpaces(&ds, into_end_loc - into_start_loc);
+		plpgsql_append_source_text(&ds, into_end_loc, yylloc);
+	}
+	else
+		plpgsql_append_source_text(&ds, location, yylloc);
+
+	/* trim any trailing whitespace, for neatness */
+	while (ds.len > 0 && scanner_isspace(ds.data[ds.len - 1]))
+		ds.data[--ds.len] = '\0';
+
+	expr = palloc0(sizeof(PLpgSQL_expr));
+	expr->dtype			= PLPGSQL_DTYPE_EXPR;
+	expr->query			= pstrdup(ds.data);
+	expr->plan			= NULL;
+	expr->paramnos		= NULL;
+	expr->ns            = plpgsql_ns_top();
+	pfree(ds.data);
+
+	check_sql_expr(expr->query, location, 0);
+
+	execsql = palloc(sizeof(PLpgSQL_stmt_execsql));
+	execsql->cmd_type = PLPGSQL_STMT_EXECSQL;
+	execsql->lineno  = plpgsql_location_to_lineno(location);
+	execsql->sqlstmt = expr;
+	execsql->into	 = have_into;
+	execsql->strict	 = have_strict;
+	execsql->rec	 = rec;
+	execsql->row	 = row;
+
+	return (PLpgSQL_stmt *) execsql;
+}
+
+
+/*
+ * Read FETCH or MOVE direction clause (everything through FROM/IN).
+ */
+static PLpgSQL_stmt_fetch *
+read_fetch_direction(void)
+{
+	PLpgSQL_stmt_fetch *fetch;
+	int			tok;
+	bool		check_FROM = true;
+
+	/*
+	 * We create the PLpgSQL_stmt_fetch struct here, but only fill in
+	 * the fields arising from the optional direction clause
+	 */
+	fetch = (PLpgSQL_stmt_fetch *) palloc0(sizeof(PLpgSQL_stmt_fetch));
+	fetch->cmd_type = PLPGSQL_STMT_FETCH;
+	/* set direction defaults: */
+	fetch->direction = FETCH_FORWARD;
+	fetch->how_many  = 1;
+	fetch->expr      = NULL;
+	fetch->returns_multiple_rows = false;
+
+	tok = yylex();
+	if (tok == 0)
+		yyerror("unexpected end of function definition");
+
+	if (tok_is_keyword(tok, &yylval,
+					   K_NEXT, "next"))
+	{
+		/* use defaults */
+	}
+	else if (tok_is_keyword(tok, &yylval,
+							K_PRIOR, "prior"))
+	{
+		fetch->direction = FETCH_BACKWARD;
+	}
+	else if (tok_is_keyword(tok, &yylval,
+							K_FIRST, "first"))
+	{
+		fetch->direction = FETCH_ABSOLUTE;
+	}
+	else if (tok_is_keyword(tok, &yylval,
+							K_LAST, "last"))
+	{
+		fetch->direction = FETCH_ABSOLUTE;
+		fetch->how_many  = -1;
+	}
+	else if (tok_is_keyword(tok, &yylval,
+							K_ABSOLUTE, "absolute"))
+	{
+		fetch->direction = FETCH_ABSOLUTE;
+		fetch->expr = read_sql_expression2(K_FROM, K_IN,
+										   "FROM or IN",
+										   NULL);
+		check_FROM = false;
+	}
+	else if (tok_is_keyword(tok, &yylval,
+							K_RELATIVE, "relative"))
+	{
+		fetch->direction = FETCH_RELATIVE;
+		fetch->expr = read_sql_expression2(K_FROM, K_IN,
+										   "FROM or IN",
+										   NULL);
+		check_FROM = false;
+	}
+	else if (tok_is_keyword(tok, &yylval,
+							K_ALL, "all"))
+	{
+		fetch->how_many = FETCH_ALL;
+		fetch->returns_multiple_rows = true;
+	}
+	else if (tok_is_keyword(tok, &yylval,
+							K_FORWARD, "forward"))
+	{
+		complete_direction(fetch, &check_FROM);
+	}
+	else if (tok_is_keyword(tok, &yylval,
+							K_BACKWARD, "backward"))
+	{
+		fetch->direction = FETCH_BACKWARD;
+		complete_direction(fetch, &check_FROM);
+	}
+	else if (tok == K_FROM || tok == K_IN)
+	{
+		/* empty direction */
+		check_FROM = false;
+	}
+	else if (tok == T_DATUM)
+	{
+		/* Assume there's no direction clause and tok is a cursor name */
+		plpgsql_push_back_token(tok);
+		check_FROM = false;
+	}
+	else
+	{
+		/*
+		 * Assume it's a count expression with no preceding keyword.
+		 * Note: we allow this syntax because core SQL does, but we don't
+		 * document it because of the ambiguity with the omitted-direction
+		 * case.  For instance, "MOVE n IN c" will fail if n is a variable.
+		 * Perhaps this can be improved someday, but it's hardly worth a
+		 * lot of work.
+		 */
+		plpgsql_push_back_token(tok);
+		fetch->expr = read_sql_expression2(K_FROM, K_IN,
+										   "FROM or IN",
+										   NULL);
+		fetch->returns_multiple_rows = true;
+		check_FROM = false;
+	}
+
+	/* check FROM or IN keyword after direction's specification */
+	if (check_FROM)
+	{
+		tok = yylex();
+		if (tok != K_FROM && tok != K_IN)
+			yyerror("expected FROM or IN");
+	}
+
+	return fetch;
+}
+
+/*
+ * Process remainder of FETCH/MOVE direction after FORWARD or BACKWARD.
+ * Allows these cases:
+ *   FORWARD expr,  FORWARD ALL,  FORWARD
+ *   BACKWARD expr, BACKWARD ALL, BACKWARD
+ */
+static void
+complete_direction(PLpgSQL_stmt_fetch *fetch,  bool *check_FROM)
+{
+	int			tok;
+
+	tok = yylex();
+	if (tok == 0)
+		yyerror("unexpected end of function definition");
+
+	if (tok == K_FROM || tok == K_IN)
+	{
+		*check_FROM = false;
+		return;
+	}
+
+	if (tok == K_ALL)
+	{
+		fetch->how_many = FETCH_ALL;
+		fetch->returns_multiple_rows = true;
+		*check_FROM = true;
+		return;
+	}
+
+	plpgsql_push_back_token(tok);
+	fetch->expr = read_sql_expression2(K_FROM, K_IN,
+									   "FROM or IN",
+									   NULL);
+	fetch->returns_multiple_rows = true;
+	*check_FROM = false;
+}
+
+
+static PLpgSQL_stmt *
+make_return_stmt(int location)
+{
+	PLpgSQL_stmt_return *new;
+
+	new = palloc0(sizeof(PLpgSQL_stmt_return));
+	new->cmd_type = PLPGSQL_STMT_RETURN;
+	new->lineno   = plpgsql_location_to_lineno(location);
+	new->expr	  = NULL;
+	new->retvarno = -1;
+
+	if (plpgsql_curr_compile->fn_retset)
+	{
+		if (yylex() != ';')
+			ereport(ERROR,
+					(errcode(ERRCODE_DATATYPE_MISMATCH),
+					 errmsg("RETURN cannot have a parameter in function returning set"),
+					 errhint("Use RETURN NEXT or RETURN QUERY."),
+					 parser_errposition(yylloc)));
+	}
+	else if (plpgsql_curr_compile->out_param_varno >= 0)
+	{
+		if (yylex() != ';')
+			ereport(ERROR,
+					(errcode(ERRCODE_DATATYPE_MISMATCH),
+					 errmsg("RETURN cannot have a parameter in function with OUT parameters"),
+					 parser_errposition(yylloc)));
+		new->retvarno = plpgsql_curr_compile->out_param_varno;
+	}
+	else if (plpgsql_curr_compile->fn_rettype == VOIDOID)
+	{
+		if (yylex() != ';')
+			ereport(ERROR,
+					(errcode(ERRCODE_DATATYPE_MISMATCH),
+					 errmsg("RETURN cannot have a parameter in function returning void"),
+					 parser_errposition(yylloc)));
+	}
+	else if (plpgsql_curr_compile->fn_retistuple)
+	{
+		switch (yylex())
+		{
+			case K_NULL:
+				/* we allow this to support RETURN NULL in triggers */
+				break;
+
+			case T_DATUM:
+				if (yylval.wdatum.datum->dtype == PLPGSQL_DTYPE_ROW ||
+					yylval.wdatum.datum->dtype == PLPGSQL_DTYPE_REC)
+					new->retvarno = yylval.wdatum.datum->dno;
+				else
+					ereport(ERROR,
+							(errcode(ERRCODE_DATATYPE_MISMATCH),
+							 errmsg("RETURN must specify a record or row variable in function returning row"),
+							 parser_errposition(yylloc)));
+				break;
+
+			default:
+				ereport(ERROR,
+						(errcode(ERRCODE_DATATYPE_MISMATCH),
+						 errmsg("RETURN must specify a record or row variable in function returning row"),
+						 parser_errposition(yylloc)));
+				break;
+		}
+		if (yylex() != ';')
+			yyerror("syntax error");
+	}
+	else
+	{
+		/*
+		 * Note that a well-formed expression is _required_ here;
+		 * anything else is a compile-time error.
+		 */
+		new->expr = read_sql_expression(';', ";");
+	}
+
+	return (PLpgSQL_stmt *) new;
+}
+
+
+static PLpgSQL_stmt *
+make_return_next_stmt(int location)
+{
+	PLpgSQL_stmt_return_next *new;
+
+	if (!plpgsql_curr_compile->fn_retset)
+		ereport(ERROR,
+				(errcode(ERRCODE_DATATYPE_MISMATCH),
+				 errmsg("cannot use RETURN NEXT in a non-SETOF function"),
+				 parser_errposition(location)));
+
+	new = palloc0(sizeof(PLpgSQL_stmt_return_next));
+	new->cmd_type	= PLPGSQL_STMT_RETURN_NEXT;
+	new->lineno		= plpgsql_location_to_lineno(location);
+	new->expr		= NULL;
+	new->retvarno	= -1;
+
+	if (plpgsql_curr_compile->out_param_varno >= 0)
+	{
+		if (yylex() != ';')
+			ereport(ERROR,
+					(errcode(ERRCODE_DATATYPE_MISMATCH),
+					 errmsg("RETURN NEXT cannot have a parameter in function with OUT parameters"),
+					 parser_errposition(yylloc)));
+		new->retvarno = plpgsql_curr_compile->out_param_varno;
+	}
+	else if (plpgsql_curr_compile->fn_retistuple)
+	{
+		switch (yylex())
+		{
+			case T_DATUM:
+				if (yylval.wdatum.datum->dtype == PLPGSQL_DTYPE_ROW ||
+					yylval.wdatum.datum->dtype == PLPGSQL_DTYPE_REC)
+					new->retvarno = yylval.wdatum.datum->dno;
+				else
+					ereport(ERROR,
+							(errcode(ERRCODE_DATATYPE_MISMATCH),
+							 errmsg("RETURN NEXT must specify a record or row variable in function returning row"),
+							 parser_errposition(yylloc)));
+				break;
+
+			default:
+				ereport(ERROR,
+						(errcode(ERRCODE_DATATYPE_MISMATCH),
+						 errmsg("RETURN NEXT must specify a record or row variable in function returning row"),
+						 parser_errposition(yylloc)));
+				break;
+		}
+		if (yylex() != ';')
+			yyerror("syntax error");
+	}
+	else
+		new->expr = read_sql_expression(';', ";");
+
+	return (PLpgSQL_stmt *) new;
+}
+
+
+static PLpgSQL_stmt *
+make_return_query_stmt(int location)
+{
+	PLpgSQL_stmt_return_query *new;
+	int			tok;
+
+	if (!plpgsql_curr_compile->fn_retset)
+		ereport(ERROR,
+				(errcode(ERRCODE_DATATYPE_MISMATCH),
+				 errmsg("cannot use RETURN QUERY in a non-SETOF function"),
+				 parser_errposition(location)));
+
+	new = palloc0(sizeof(PLpgSQL_stmt_return_query));
+	new->cmd_type = PLPGSQL_STMT_RETURN_QUERY;
+	new->lineno = plpgsql_location_to_lineno(location);
+
+	/* check for RETURN QUERY EXECUTE */
+	if ((tok = yylex()) != K_EXECUTE)
+	{
+		/* ordinary static query */
+		plpgsql_push_back_token(tok);
+		new->query = read_sql_stmt("");
+	}
+	else
+	{
+		/* dynamic SQL */
+		int		term;
+
+		new->dynquery = read_sql_expression2(';', K_USING, "; or USING",
+											 &term);
+		if (term == K_USING)
+		{
+			do
+			{
+				PLpgSQL_expr *expr;
+
+				expr = read_sql_expression2(',', ';', ", or ;", &term);
+				new->params = lappend(new->params, expr);
+			} while (term == ',');
+		}
+	}
+
+	return (PLpgSQL_stmt *) new;
+}
+
+
+/* convenience routine to fetch the name of a T_DATUM */
+static char *
+NameOfDatum(PLwdatum *wdatum)
+{
+	if (wdatum->ident)
+		return wdatum->ident;
+	Assert(wdatum->idents != NIL);
+	return NameListToString(wdatum->idents);
+}
+
+static void
+check_assignable(PLpgSQL_datum *datum, int location)
+{
+	switch (datum->dtype)
+	{
+		case PLPGSQL_DTYPE_VAR:
+			if (((PLpgSQL_var *) datum)->isconst)
+				ereport(ERROR,
+						(errcode(ERRCODE_ERROR_IN_ASSIGNMENT),
+						 errmsg("\"%s\" is declared CONSTANT",
+								((PLpgSQL_var *) datum)->refname),
+						 parser_errposition(location)));
+			break;
+		case PLPGSQL_DTYPE_ROW:
+			/* always assignable? */
+			break;
+		case PLPGSQL_DTYPE_REC:
+			/* always assignable?  What about NEW/OLD? */
+			break;
+		case PLPGSQL_DTYPE_RECFIELD:
+			/* always assignable? */
+			break;
+		case PLPGSQL_DTYPE_ARRAYELEM:
+			/* always assignable? */
+			break;
+		default:
+			elog(ERROR, "unrecognized dtype: %d", datum->dtype);
+			break;
+	}
+}
+
+/*
+ * Read the argument of an INTO clause.  On entry, we have just read the
+ * INTO keyword.
+ */
+static void
+read_into_target(PLpgSQL_rec **rec, PLpgSQL_row **row, bool *strict)
+{
+	int			tok;
+
+	/* Set default results */
+	*rec = NULL;
+	*row = NULL;
+	if (strict)
+		*strict = false;
+
+	tok = yylex();
+	if (strict && tok == K_STRICT)
+	{
+		*strict = true;
+		tok = yylex();
+	}
+
+	/*
+	 * Currently, a row or record variable can be the single INTO target,
+	 * but not a member of a multi-target list.  So we throw error if there
+	 * is a comma after it, because that probably means the user tried to
+	 * write a multi-target list.  If this ever gets generalized, we should
+	 * probably refactor read_into_scalar_list so it handles all cases.
+	 */
+	switch (tok)
+	{
+		case T_DATUM:
+			if (yylval.wdatum.datum->dtype == PLPGSQL_DTYPE_ROW)
+			{
+				check_assignable(yylval.wdatum.datum, yylloc);
+				*row = (PLpgSQL_row *) yylval.wdatum.datum;
+
+				if ((tok = yylex()) == ',')
+					ereport(ERROR,
+							(errcode(ERRCODE_SYNTAX_ERROR),
+							 errmsg("record or row variable cannot be part of multiple-item INTO list"),
+							 parser_errposition(yylloc)));
+				plpgsql_push_back_token(tok);
+			}
+			else if (yylval.wdatum.datum->dtype == PLPGSQL_DTYPE_REC)
+			{
+				check_assignable(yylval.wdatum.datum, yylloc);
+				*rec = (PLpgSQL_rec *) yylval.wdatum.datum;
+
+				if ((tok = yylex()) == ',')
+					ereport(ERROR,
+							(errcode(ERRCODE_SYNTAX_ERROR),
+							 errmsg("record or row variable cannot be part of multiple-item INTO list"),
+							 parser_errposition(yylloc)));
+				plpgsql_push_back_token(tok);
+			}
+			else
+			{
+				*row = read_into_scalar_list(NameOfDatum(&(yylval.wdatum)),
+											 yylval.wdatum.datum, yylloc);
+			}
+			break;
+
+		default:
+			/* just to give a better message than "syntax error" */
+			current_token_is_not_variable(tok);
+	}
+}
+
+/*
+ * Given the first datum and name in the INTO list, continue to read
+ * comma-separated scalar variables until we run out. Then construct
+ * and return a fake "row" variable that represents the list of
+ * scalars.
+ */
+static PLpgSQL_row *
+read_into_scalar_list(char *initial_name,
+					  PLpgSQL_datum *initial_datum,
+					  int initial_location)
+{
+	int				 nfields;
+	char			*fieldnames[1024];
+	int				 varnos[1024];
+	PLpgSQL_row		*row;
+	int				 tok;
+
+	check_assignable(initial_datum, initial_location);
+	fieldnames[0] = initial_name;
+	varnos[0]	  = initial_datum->dno;
+	nfields		  = 1;
+
+	while ((tok = yylex()) == ',')
+	{
+		/* Check for array overflow */
+		if (nfields >= 1024)
+			ereport(ERROR,
+					(errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+					 errmsg("too many INTO variables specified"),
+					 parser_errposition(yylloc)));
+
+		tok = yylex();
+		switch (tok)
+		{
+			case T_DATUM:
+				check_assignable(yylval.wdatum.datum, yylloc);
+				if (yylval.wdatum.datum->dtype == PLPGSQL_DTYPE_ROW ||
+					yylval.wdatum.datum->dtype == PLPGSQL_DTYPE_REC)
+					ereport(ERROR,
+							(errcode(ERRCODE_SYNTAX_ERROR),
+							 errmsg("\"%s\" is not a scalar variable",
+									NameOfDatum(&(yylval.wdatum))),
+							 parser_errposition(yylloc)));
+				fieldnames[nfields] = NameOfDatum(&(yylval.wdatum));
+				varnos[nfields++]	= yylval.wdatum.datum->dno;
+				break;
+
+			default:
+				/* just to give a better message than "syntax error" */
+				current_token_is_not_variable(tok);
+		}
+	}
+
+	/*
+	 * We read an extra, non-comma token from yylex(), so push it
+	 * back onto the input stream
+	 */
+	plpgsql_push_back_token(tok);
+
+	row = palloc(sizeof(PLpgSQL_row));
+	row->dtype = PLPGSQL_DTYPE_ROW;
+	row->refname = pstrdup("*internal*");
+	row->lineno = plpgsql_location_to_lineno(initial_location);
+	row->rowtupdesc = NULL;
+	row->nfields = nfields;
+	row->fieldnames = palloc(sizeof(char *) * nfields);
+	row->varnos = palloc(sizeof(int) * nfields);
+	while (--nfields >= 0)
+	{
+		row->fieldnames[nfields] = fieldnames[nfields];
+		row->varnos[nfields] = varnos[nfields];
+	}
+
+	plpgsql_adddatum((PLpgSQL_datum *)row);
+
+	return row;
+}
+
+/*
+ * Convert a single scalar into a "row" list.  This is exactly
+ * like read_into_scalar_list except we never consume any input.
+ *
+ * Note: lineno could be computed from location, but since callers
+ * have it at hand already, we may as well pass it in.
+ */
+static PLpgSQL_row *
+make_scalar_list1(char *initial_name,
+				  PLpgSQL_datum *initial_datum,
+				  int lineno, int location)
+{
+	PLpgSQL_row		*row;
+
+	check_assignable(initial_datum, location);
+
+	row = palloc(sizeof(PLpgSQL_row));
+	row->dtype = PLPGSQL_DTYPE_ROW;
+	row->refname = pstrdup("*internal*");
+	row->lineno = lineno;
+	row->rowtupdesc = NULL;
+	row->nfields = 1;
+	row->fieldnames = palloc(sizeof(char *));
+	row->varnos = palloc(sizeof(int));
+	row->fieldnames[0] = initial_name;
+	row->varnos[0] = initial_datum->dno;
+
+	plpgsql_adddatum((PLpgSQL_datum *)row);
+
+	return row;
+}
+
+/*
+ * When the PL/PgSQL parser expects to see a SQL statement, it is very
+ * liberal in what it accepts; for example, we often assume an
+ * unrecognized keyword is the beginning of a SQL statement. This
+ * avoids the need to duplicate parts of the SQL grammar in the
+ * PL/PgSQL grammar, but it means we can accept wildly malformed
+ * input. To try and catch some of the more obviously invalid input,
+ * we run the strings we expect to be SQL statements through the main
+ * SQL parser.
+ *
+ * We only invoke the raw parser (not the analyzer); this doesn't do
+ * any database access and does not check any semantic rules, it just
+ * checks for basic syntactic correctness. We do this here, rather
+ * than after parsing has finished, because a malformed SQL statement
+ * may cause the PL/PgSQL parser to become confused about statement
+ * borders. So it is best to bail out as early as we can.
+ *
+ * It is assumed that "stmt" represents a copy of the function source text
+ * beginning at offset "location", with leader text of length "leaderlen"
+ * (typically "SELECT ") prefixed to the source text.  We use this assumption
+ * to transpose any error cursor position back to the function source text.
+ * If no error cursor is provided, we'll just point at "location".
+ */
+static void
+check_sql_expr(const char *stmt, int location, int leaderlen)
+{
+	sql_error_callback_arg cbarg;
+	ErrorContextCallback  syntax_errcontext;
+	MemoryContext oldCxt;
+
+	if (!plpgsql_check_syntax)
+		return;
+
+	cbarg.location = location;
+	cbarg.leaderlen = leaderlen;
+
+	syntax_errcontext.callback = plpgsql_sql_error_callback;
+	syntax_errcontext.arg = &cbarg;
+	syntax_errcontext.previous = error_context_stack;
+	error_context_stack = &syntax_errcontext;
+
+	oldCxt = MemoryContextSwitchTo(compile_tmp_cxt);
+	(void) raw_parser(stmt);
+	MemoryContextSwitchTo(oldCxt);
+
+	/* Restore former ereport callback */
+	error_context_stack = syntax_errcontext.previous;
+}
+
+static void
+plpgsql_sql_error_callback(void *arg)
+{
+	sql_error_callback_arg *cbarg = (sql_error_callback_arg *) arg;
+	int			errpos;
+
+	/*
+	 * First, set up internalerrposition to point to the start of the
+	 * statement text within the function text.  Note this converts
+	 * location (a byte offset) to a character number.
+	 */
+	parser_errposition(cbarg->location);
+
+	/*
+	 * If the core parser provided an error position, transpose it.
+	 * Note we are dealing with 1-based character numbers at this point.
+	 */
+	errpos = geterrposition();
+	if (errpos > cbarg->leaderlen)
+	{
+		int		myerrpos = getinternalerrposition();
+
+		if (myerrpos > 0)		/* safety check */
+			internalerrposition(myerrpos + errpos - cbarg->leaderlen - 1);
+	}
+
+	/* In any case, flush errposition --- we want internalerrpos only */
+	errposition(0);
+}
+
+/*
+ * Parse a SQL datatype name and produce a PLpgSQL_type structure.
+ *
+ * The heavy lifting is done elsewhere.  Here we are only concerned
+ * with setting up an errcontext link that will let us give an error
+ * cursor pointing into the plpgsql function source, if necessary.
+ * This is handled the same as in check_sql_expr(), and we likewise
+ * expect that the given string is a copy from the source text.
+ */
+static PLpgSQL_type *
+parse_datatype(const char *string, int location)
+{
+	Oid			type_id;
+	int32		typmod;
+	sql_error_callback_arg cbarg;
+	ErrorContextCallback  syntax_errcontext;
+
+	cbarg.location = location;
+	cbarg.leaderlen = 0;
+
+	syntax_errcontext.callback = plpgsql_sql_error_callback;
+	syntax_errcontext.arg = &cbarg;
+	syntax_errcontext.previous = error_context_stack;
+	error_context_stack = &syntax_errcontext;
+
+	/* Let the main parser try to parse it under standard SQL rules */
+	parseTypeString(string, &type_id, &typmod);
+
+	/* Restore former ereport callback */
+	error_context_stack = syntax_errcontext.previous;
+
+	/* Okay, build a PLpgSQL_type data structure for it */
+	return plpgsql_build_datatype(type_id, typmod);
+}
+
+/*
+ * Check block starting and ending labels match.
+ */
+static void
+check_labels(const char *start_label, const char *end_label, int end_location)
+{
+	if (end_label)
+	{
+		if (!start_label)
+			ereport(ERROR,
+					(errcode(ERRCODE_SYNTAX_ERROR),
+					 errmsg("end label \"%s\" specified for unlabelled block",
+							end_label),
+					 parser_errposition(end_location)));
+
+		if (strcmp(start_label, end_label) != 0)
+			ereport(ERROR,
+					(errcode(ERRCODE_SYNTAX_ERROR),
+					 errmsg("end label \"%s\" differs from block's label \"%s\"",
+							end_label, start_label),
+					 parser_errposition(end_location)));
+	}
+}
+
+/*
+ * Read the arguments (if any) for a cursor, followed by the until token
+ *
+ * If cursor has no args, just swallow the until token and return NULL.
+ * If it does have args, we expect to see "( expr [, expr ...] )" followed
+ * by the until token.  Consume all that and return a SELECT query that
+ * evaluates the expression(s) (without the outer parens).
+ */
+static PLpgSQL_expr *
+read_cursor_args(PLpgSQL_var *cursor, int until, const char *expected)
+{
+	PLpgSQL_expr *expr;
+	int			tok;
+
+	tok = yylex();
+	if (cursor->cursor_explicit_argrow < 0)
+	{
+		/* No arguments expected */
+		if (tok == '(')
+			ereport(ERROR,
+					(errcode(ERRCODE_SYNTAX_ERROR),
+					 errmsg("cursor \"%s\" has no arguments",
+							cursor->refname),
+					 parser_errposition(yylloc)));
+
+		if (tok != until)
+			yyerror("syntax error");
+
+		return NULL;
+	}
+
+	/* Else better provide arguments */
+	if (tok != '(')
+		ereport(ERROR,
+				(errcode(ERRCODE_SYNTAX_ERROR),
+				 errmsg("cursor \"%s\" has arguments",
+						cursor->refname),
+				 parser_errposition(yylloc)));
+
+	/*
+	 * Read expressions until the matching ')'.
+	 */
+	expr = read_sql_expression(')', ")");
+
+	/* Next we'd better find the until token */
+	tok = yylex();
+	if (tok != until)
+		yyerror("syntax error");
+
+	return expr;
+}
+
+/*
+ * Parse RAISE ... USING options
+ */
+static List *
+read_raise_options(void)
+{
+	List	   *result = NIL;
+
+	for (;;)
+	{
+		PLpgSQL_raise_option *opt;
+		int		tok;
+
+		if ((tok = yylex()) == 0)
+			yyerror("unexpected end of function definition");
+
+		opt = (PLpgSQL_raise_option *) palloc(sizeof(PLpgSQL_raise_option));
+
+		if (tok_is_keyword(tok, &yylval,
+						   K_ERRCODE, "errcode"))
+			opt->opt_type = PLPGSQL_RAISEOPTION_ERRCODE;
+		else if (tok_is_keyword(tok, &yylval,
+								K_MESSAGE, "message"))
+			opt->opt_type = PLPGSQL_RAISEOPTION_MESSAGE;
+		else if (tok_is_keyword(tok, &yylval,
+								K_DETAIL, "detail"))
+			opt->opt_type = PLPGSQL_RAISEOPTION_DETAIL;
+		else if (tok_is_keyword(tok, &yylval,
+								K_HINT, "hint"))
+			opt->opt_type = PLPGSQL_RAISEOPTION_HINT;
+		else
+			yyerror("unrecognized RAISE statement option");
+
+		tok = yylex();
+		if (tok != '=' && tok != COLON_EQUALS)
+			yyerror("syntax error, expected \"=\"");
+
+		opt->expr = read_sql_expression2(',', ';', ", or ;", &tok);
+
+		result = lappend(result, opt);
+
+		if (tok == ';')
+			break;
+	}
+
+	return result;
+}
+
+/*
+ * Fix up CASE statement
+ */
+static PLpgSQL_stmt *
+make_case(int location, PLpgSQL_expr *t_expr,
+		  List *case_when_list, List *else_stmts)
+{
+	PLpgSQL_stmt_case 	*new;
+
+	new = palloc(sizeof(PLpgSQL_stmt_case));
+	new->cmd_type = PLPGSQL_STMT_CASE;
+	new->lineno = plpgsql_location_to_lineno(location);
+	new->t_expr = t_expr;
+	new->t_varno = 0;
+	new->case_when_list = case_when_list;
+	new->have_else = (else_stmts != NIL);
+	/* Get rid of list-with-NULL hack */
+	if (list_length(else_stmts) == 1 && linitial(else_stmts) == NULL)
+		new->else_stmts = NIL;
+	else
+		new->else_stmts = else_stmts;
+
+	/*
+	 * When test expression is present, we create a var for it and then
+	 * convert all the WHEN expressions to "VAR IN (original_expression)".
+	 * This is a bit klugy, but okay since we haven't yet done more than
+	 * read the expressions as text.  (Note that previous parsing won't
+	 * have complained if the WHEN ... THEN expression contained multiple
+	 * comma-separated values.)
+	 */
+	if (t_expr)
+	{
+		char	varname[32];
+		PLpgSQL_var *t_var;
+		ListCell *l;
+
+		/* use a name unlikely to collide with any user names */
+		snprintf(varname, sizeof(varname), "__Case__Variable_%d__",
+				 plpgsql_nDatums);
+
+		/*
+		 * We don't yet know the result datatype of t_expr.  Build the
+		 * variable as if it were INT4; we'll fix this at runtime if needed.
+		 */
+		t_var = (PLpgSQL_var *)
+			plpgsql_build_variable(varname, new->lineno,
+								   plpgsql_build_datatype(INT4OID, -1),
+								   true);
+		new->t_varno = t_var->dno;
+
+		foreach(l, case_when_list)
+		{
+			PLpgSQL_case_when *cwt = (PLpgSQL_case_when *) lfirst(l);
+			PLpgSQL_expr *expr = cwt->expr;
+			StringInfoData	ds;
+
+			/* copy expression query without SELECT keyword (expr->query + 7) */
+			Assert(strncmp(expr->query, "SELECT ", 7) == 0);
+
+			/* And do the string hacking */
+			initStringInfo(&ds);
+
+			appendStringInfo(&ds, "SELECT \"%s\" IN (%s)",
+							 varname, expr->query + 7);
+
+			pfree(expr->query);
+			expr->query = pstrdup(ds.data);
+			/* Adjust expr's namespace to include the case variable */
+			expr->ns = plpgsql_ns_top();
+
+			pfree(ds.data);
+		}
+	}
+
+	return (PLpgSQL_stmt *) new;
+}
@@ -0,0 +1,235 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_PLPGSQL_YY_PL_GRAM_H_INCLUDED
+# define YY_PLPGSQL_YY_PL_GRAM_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int plpgsql_yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    IDENT = 258,                   /* IDENT  */
+    FCONST = 259,                  /* FCONST  */
+    SCONST = 260,                  /* SCONST  */
+    BCONST = 261,                  /* BCONST  */
+    XCONST = 262,                  /* XCONST  */
+    Op = 263,                      /* Op  */
+    ICONST = 264,                  /* ICONST  */
+    PARAM = 265,                   /* PARAM  */
+    TYPECAST = 266,                /* TYPECAST  */
+    DOT_DOT = 267,                 /* DOT_DOT  */
+    COLON_EQUALS = 268,            /* COLON_EQUALS  */
+    T_WORD = 269,                  /* T_WORD  */
+    T_CWORD = 270,                 /* T_CWORD  */
+    T_DATUM = 271,                 /* T_DATUM  */
+    LESS_LESS = 272,               /* LESS_LESS  */
+    GREATER_GREATER = 273,         /* GREATER_GREATER  */
+    K_ABSOLUTE = 274,              /* K_ABSOLUTE  */
+    K_ALIAS = 275,                 /* K_ALIAS  */
+    K_ALL = 276,                   /* K_ALL  */
+    K_BACKWARD = 277,              /* K_BACKWARD  */
+    K_BEGIN = 278,                 /* K_BEGIN  */
+    K_BY = 279,                    /* K_BY  */
+    K_CASE = 280,                  /* K_CASE  */
+    K_CLOSE = 281,                 /* K_CLOSE  */
+    K_CONSTANT = 282,              /* K_CONSTANT  */
+    K_CONTINUE = 283,              /* K_CONTINUE  */
+    K_CURSOR = 284,                /* K_CURSOR  */
+    K_DEBUG = 285,                 /* K_DEBUG  */
+    K_DECLARE = 286,               /* K_DECLARE  */
+    K_DEFAULT = 287,               /* K_DEFAULT  */
+    K_DETAIL = 288,                /* K_DETAIL  */
+    K_DIAGNOSTICS = 289,           /* K_DIAGNOSTICS  */
+    K_DUMP = 290,                  /* K_DUMP  */
+    K_ELSE = 291,                  /* K_ELSE  */
+    K_ELSIF = 292,                 /* K_ELSIF  */
+    K_END = 293,                   /* K_END  */
+    K_ERRCODE = 294,               /* K_ERRCODE  */
+    K_ERROR = 295,                 /* K_ERROR  */
+    K_EXCEPTION = 296,             /* K_EXCEPTION  */
+    K_EXECUTE = 297,               /* K_EXECUTE  */
+    K_EXIT = 298,                  /* K_EXIT  */
+    K_FETCH = 299,                 /* K_FETCH  */
+    K_FIRST = 300,                 /* K_FIRST  */
+    K_FOR = 301,                   /* K_FOR  */
+    K_FORWARD = 302,               /* K_FORWARD  */
+    K_FROM = 303,                  /* K_FROM  */
+    K_GET = 304,                   /* K_GET  */
+    K_HINT = 305,                  /* K_HINT  */
+    K_IF = 306,                    /* K_IF  */
+    K_IN = 307,                    /* K_IN  */
+    K_INFO = 308,                  /* K_INFO  */
+    K_INSERT = 309,                /* K_INSERT  */
+    K_INTO = 310,                  /* K_INTO  */
+    K_IS = 311,                    /* K_IS  */
+    K_LAST = 312,                  /* K_LAST  */
+    K_LOG = 313,                   /* K_LOG  */
+    K_LOOP = 314,                  /* K_LOOP  */
+    K_MESSAGE = 315,               /* K_MESSAGE  */
+    K_MOVE = 316,                  /* K_MOVE  */
+    K_NEXT = 317,                  /* K_NEXT  */
+    K_NO = 318,                    /* K_NO  */
+    K_NOT = 319,                   /* K_NOT  */
+    K_NOTICE = 320,                /* K_NOTICE  */
+    K_NULL = 321,                  /* K_NULL  */
+    K_OPEN = 322,                  /* K_OPEN  */
+    K_OPTION = 323,                /* K_OPTION  */
+    K_OR = 324,                    /* K_OR  */
+    K_PERFORM = 325,               /* K_PERFORM  */
+    K_PRIOR = 326,                 /* K_PRIOR  */
+    K_QUERY = 327,                 /* K_QUERY  */
+    K_RAISE = 328,                 /* K_RAISE  */
+    K_RELATIVE = 329,              /* K_RELATIVE  */
+    K_RESULT_OID = 330,            /* K_RESULT_OID  */
+    K_RETURN = 331,                /* K_RETURN  */
+    K_REVERSE = 332,               /* K_REVERSE  */
+    K_ROWTYPE = 333,               /* K_ROWTYPE  */
+    K_ROW_COUNT = 334,             /* K_ROW_COUNT  */
+    K_SCROLL = 335,                /* K_SCROLL  */
+    K_SQLSTATE = 336,              /* K_SQLSTATE  */
+    K_STRICT = 337,                /* K_STRICT  */
+    K_THEN = 338,                  /* K_THEN  */
+    K_TO = 339,                    /* K_TO  */
+    K_TYPE = 340,                  /* K_TYPE  */
+    K_USE_COLUMN = 341,            /* K_USE_COLUMN  */
+    K_USE_VARIABLE = 342,          /* K_USE_VARIABLE  */
+    K_USING = 343,                 /* K_USING  */
+    K_VARIABLE_CONFLICT = 344,     /* K_VARIABLE_CONFLICT  */
+    K_WARNING = 345,               /* K_WARNING  */
+    K_WHEN = 346,                  /* K_WHEN  */
+    K_WHILE = 347                  /* K_WHILE  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 114 "gram.y"
+
+		core_YYSTYPE			core_yystype;
+		/* these fields must match core_YYSTYPE: */
+		int						ival;
+		char					*str;
+		const char				*keyword;
+
+		PLword					word;
+		PLcword					cword;
+		PLwdatum				wdatum;
+		bool					boolean;
+		struct
+		{
+			char *name;
+			int  lineno;
+		}						varname;
+		struct
+		{
+			char *name;
+			int  lineno;
+			PLpgSQL_datum   *scalar;
+			PLpgSQL_rec     *rec;
+			PLpgSQL_row     *row;
+		}						forvariable;
+		struct
+		{
+			char *label;
+			int  n_initvars;
+			int  *initvarnos;
+		}						declhdr;
+		struct
+		{
+			List *stmts;
+			char *end_label;
+			int   end_label_location;
+		}						loop_body;
+		List					*list;
+		PLpgSQL_type			*dtype;
+		PLpgSQL_datum			*datum;
+		PLpgSQL_var				*var;
+		PLpgSQL_expr			*expr;
+		PLpgSQL_stmt			*stmt;
+		PLpgSQL_condition		*condition;
+		PLpgSQL_exception		*exception;
+		PLpgSQL_exception_block	*exception_block;
+		PLpgSQL_nsitem			*nsitem;
+		PLpgSQL_diag_item		*diagitem;
+		PLpgSQL_stmt_fetch		*fetch;
+		PLpgSQL_case_when		*casewhen;
+
+#line 207 "pl_gram.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+/* Location type.  */
+#if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
+typedef struct YYLTYPE YYLTYPE;
+struct YYLTYPE
+{
+  int first_line;
+  int first_column;
+  int last_line;
+  int last_column;
+};
+# define YYLTYPE_IS_DECLARED 1
+# define YYLTYPE_IS_TRIVIAL 1
+#endif
+
+
+extern YYSTYPE plpgsql_yylval;
+extern YYLTYPE plpgsql_yylloc;
+
+int plpgsql_yyparse (void);
+
+
+#endif /* !YY_PLPGSQL_YY_PL_GRAM_H_INCLUDED  */
@@ -362,3 +362,73 @@ select string_agg(a,',') from (values('aaaa'),('bbbb'),('cccc')) g(a);
 select string_agg(a,',') from (values('aaaa'),(null),('bbbb'),('cccc')) g(a);
 select string_agg(a,',') from (values(null),(null),('bbbb'),('cccc')) g(a);
 select string_agg(a,',') from (values(null),(null)) g(a);
+
+-- hashed aggregation spilling to disk: the planner expects only a few
+-- groups of the expression, but there are far more than fit in work_mem,
+-- enough for the spilled batches to be split again when reloaded
+set work_mem = 64;
+
+explain (costs off)
+select g % 20000 as k, count(*), sum(g)
+  from generate_series(1, 40000) g group by 1;
+
+create temp table hashagg_spill as
+select g % 20000 as k, count(*) as c, sum(g) as s
+  from generate_series(1, 40000) g group by 1;
+
+select count(*), sum(c), sum(s) from hashagg_spill;
+
+-- the results must match the sorted plan's
+set enable_hashagg = off;
+
+select count(*) from
+  ((select * from hashagg_spill)
+   except
+   (select g % 20000, count(*), sum(g)
+      from generate_series(1, 40000) g group by 1)) s;
+
+reset enable_hashagg;
+
+-- rescan a spilled hashed aggregation, both after reading all its groups
+-- and when stopping early
+explain (costs off)
+select x, (select max(c) from
+             (select g % 3000 as k, count(*) as c
+                from generate_series(1, 10000) g
+               where g <= 10000 - x * 4000 group by 1) s)
+  from generate_series(0, 2) x;
+
+select x, (select max(c) from
+             (select g % 3000 as k, count(*) as c
+                from generate_series(1, 10000) g
+               where g <= 10000 - x * 4000 group by 1) s),
+       (select count(*) from
+             (select g % 3000 as k, count(*) as c
+                from generate_series(1, 10000) g
+               where g <= 10000 - x * 4000 group by 1) s),
+       exists(select 1 from
+             (select g % 3000 as k, count(*) as c
+                from generate_series(1, 10000) g
+               where g <= 10000 - x * 4000 group by 1) s where c > 3)
+  from generate_series(0, 2) x;
+
+set enable_hashagg = off;
+
+select x, (select max(c) from
+             (select g % 3000 as k, count(*) as c
+                from generate_series(1, 10000) g
+               where g <= 10000 - x * 4000 group by 1) s),
+       (select count(*) from
+             (select g % 3000 as k, count(*) as c
+                from generate_series(1, 10000) g
+               where g <= 10000 - x * 4000 group by 1) s),
+       exists(select 1 from
+             (select g % 3000 as k, count(*) as c
+                from generate_series(1, 10000) g
+               where g <= 10000 - x * 4000 group by 1) s where c > 3)
+  from generate_series(0, 2) x;
+
+reset enable_hashagg;
+reset work_mem;
+
+drop table hashagg_spill;
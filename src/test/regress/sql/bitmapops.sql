@@ -39,3 +39,42 @@ SELECT count(*) FROM bmscantest WHERE a = 1 OR b = 1;
 
 -- clean up
 DROP TABLE bmscantest;
+
+
+-- The table above fits in a 64kB bitmap even when every page matches, so
+-- use one spread over enough segments that the bitmap has to be made lossy
+-- part way through the index scan. Compare against the results of a
+-- sequential scan to check that no rows are lost or returned twice.
+
+CREATE TABLE bmlossytest (id int, a int, b int) WITH (fillfactor = 10);
+
+INSERT INTO bmlossytest
+  SELECT r, r % 20, r % 7 FROM generate_series(1, 50000) r;
+
+CREATE INDEX i_bmlossy_a ON bmlossytest(a);
+CREATE INDEX i_bmlossy_b ON bmlossytest(b);
+
+set enable_seqscan=false;
+
+EXPLAIN (COSTS OFF)
+SELECT count(*), sum(id) FROM bmlossytest WHERE a < 15 AND b = 3;
+
+SELECT count(*), sum(id) FROM bmlossytest WHERE a < 15;
+SELECT count(*), sum(id) FROM bmlossytest WHERE a < 15 AND b = 3;
+SELECT count(*), sum(id) FROM bmlossytest WHERE a < 15 OR b = 3;
+SELECT count(*), sum(id) FROM bmlossytest WHERE (a < 15 OR id < 2000) AND b < 2;
+
+set enable_seqscan=true;
+set enable_bitmapscan=false;
+
+SELECT count(*), sum(id) FROM bmlossytest WHERE a < 15;
+SELECT count(*), sum(id) FROM bmlossytest WHERE a < 15 AND b = 3;
+SELECT count(*), sum(id) FROM bmlossytest WHERE a < 15 OR b = 3;
+SELECT count(*), sum(id) FROM bmlossytest WHERE (a < 15 OR id < 2000) AND b < 2;
+
+reset enable_bitmapscan;
+reset enable_indexscan;
+reset enable_seqscan;
+reset work_mem;
+
+DROP TABLE bmlossytest;
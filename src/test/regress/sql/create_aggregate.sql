@@ -71,3 +71,57 @@ create aggregate aggfns(integer,integer,text) (
    sfunc = aggfns_trans, stype = aggtype[],
    initcond = '{}'
 );
+
+-- moving-aggregate implementation, used when a window frame's head moves
+create function int4_msum_inv(int8[], int4) returns int8[] as
+'select int4_avg_accum_inv($1, $2)' language sql strict immutable;
+
+create aggregate msum(int4) (
+   sfunc = int4_sum, stype = int8,
+   msfunc = int4_avg_accum, minvfunc = int4_msum_inv, mstype = _int8,
+   mfinalfunc = int2int4_sum, minitcond = '{0,0}'
+);
+
+select aggmtransfn, aggminvtransfn, aggmfinalfn, aggmtranstype::regtype,
+       aggminitval
+  from pg_aggregate where aggfnoid = 'msum'::regproc;
+
+select i, msum(v) over w, sum(v) over w
+  from (values (1, 1), (2, 2), (3, null), (4, 4), (5, 5)) t(i, v)
+  window w as (order by i rows between 1 preceding and current row);
+
+select i, msum(v) over w
+  from (values (1, 1), (2, null), (3, null), (4, 4)) t(i, v)
+  window w as (order by i rows between current row and 1 following);
+
+-- moving-aggregate options must be given together
+create aggregate msum_bad(int4) (
+   sfunc = int4_sum, stype = int8,
+   msfunc = int4_avg_accum, mstype = _int8
+);
+
+create aggregate msum_bad(int4) (
+   sfunc = int4_sum, stype = int8,
+   mfinalfunc = int2int4_sum, minitcond = '{0,0}'
+);
+
+-- forward and inverse transition functions must have the same strictness
+create function int4_msum_inv_nonstrict(int8[], int4) returns int8[] as
+'select int4_avg_accum_inv($1, $2)' language sql immutable;
+
+create aggregate msum_bad(int4) (
+   sfunc = int4_sum, stype = int8,
+   msfunc = int4_avg_accum, minvfunc = int4_msum_inv_nonstrict,
+   mstype = _int8, mfinalfunc = int2int4_sum, minitcond = '{0,0}'
+);
+
+-- both implementations must return the same type
+create aggregate msum_bad(int4) (
+   sfunc = int4_sum, stype = int8,
+   msfunc = int4_avg_accum, minvfunc = int4_msum_inv,
+   mstype = _int8, mfinalfunc = int8_avg, minitcond = '{0,0}'
+);
+
+drop aggregate msum(int4);
+drop function int4_msum_inv(int8[], int4);
+drop function int4_msum_inv_nonstrict(int8[], int4);
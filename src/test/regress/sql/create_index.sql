@@ -426,3 +426,41 @@ RESET enable_indexscan;
 RESET enable_bitmapscan;
  
 DROP TABLE onek_with_null;
+
+--
+-- Index-only scans
+--
+
+CREATE TABLE ios_heap (a int, b int, c text);
+INSERT INTO ios_heap SELECT i, i % 7, 'row ' || i FROM generate_series(1, 2000) i;
+CREATE INDEX ios_heap_a_b ON ios_heap (a, b);
+VACUUM ANALYZE ios_heap;
+
+SET enable_seqscan = OFF;
+SET enable_bitmapscan = OFF;
+
+EXPLAIN (COSTS OFF)
+SELECT a, b FROM ios_heap WHERE a < 10 ORDER BY a;
+SELECT a, b FROM ios_heap WHERE a < 10 ORDER BY a;
+
+-- a column that isn't in the index needs the heap
+EXPLAIN (COSTS OFF)
+SELECT a, c FROM ios_heap WHERE a < 3 ORDER BY a;
+SELECT a, c FROM ios_heap WHERE a < 3 ORDER BY a;
+
+-- changes made since the VACUUM must be seen
+UPDATE ios_heap SET b = -1 WHERE a = 4;
+DELETE FROM ios_heap WHERE a = 6;
+INSERT INTO ios_heap VALUES (5, 100, 'new');
+SELECT a, b FROM ios_heap WHERE a < 10 ORDER BY a, b;
+SELECT count(*), sum(b) FROM ios_heap WHERE a BETWEEN 1000 AND 1999;
+
+SET enable_indexonlyscan = OFF;
+EXPLAIN (COSTS OFF)
+SELECT a, b FROM ios_heap WHERE a < 10 ORDER BY a;
+
+RESET enable_seqscan;
+RESET enable_bitmapscan;
+RESET enable_indexonlyscan;
+
+DROP TABLE ios_heap;
@@ -0,0 +1,43 @@
+--
+-- Incremental sort: sorting input that is already ordered by a prefix
+-- of the sort keys, one group of equal prefix values at a time
+--
+
+CREATE TABLE isort_test (a int, b int, c text);
+-- mostly groups of 10, which get batched together, and one big group
+INSERT INTO isort_test
+  SELECT i / 10, (i * 7) % 10, 'x' || i FROM generate_series(0, 9999) i;
+INSERT INTO isort_test
+  SELECT 1000, (i * 37) % 500, 'y' || i FROM generate_series(0, 499) i;
+CREATE INDEX isort_test_a ON isort_test (a);
+ANALYZE isort_test;
+
+SET enable_seqscan = off;
+
+EXPLAIN (COSTS OFF)
+SELECT * FROM isort_test ORDER BY a, b;
+
+-- the whole output must come out in order
+SELECT count(*) AS out_of_order
+  FROM (SELECT a, b, lag(a) OVER () AS pa, lag(b) OVER () AS pb
+          FROM (SELECT a, b FROM isort_test ORDER BY a, b) s) t
+  WHERE (pa, pb) > (a, b);
+
+-- a LIMIT is passed down as a bound
+EXPLAIN (COSTS OFF)
+SELECT * FROM isort_test ORDER BY a, b LIMIT 15;
+SELECT * FROM isort_test ORDER BY a, b LIMIT 15;
+
+SELECT * FROM isort_test WHERE a > 997 AND b < 5 ORDER BY a, b DESC;
+
+-- the big group, read in descending order of a
+SELECT * FROM isort_test WHERE a >= 999 ORDER BY a DESC, b LIMIT 5;
+
+SET enable_incrementalsort = off;
+EXPLAIN (COSTS OFF)
+SELECT * FROM isort_test ORDER BY a, b LIMIT 15;
+RESET enable_incrementalsort;
+
+RESET enable_seqscan;
+
+DROP TABLE isort_test;
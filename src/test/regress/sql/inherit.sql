@@ -373,3 +373,43 @@ SELECT a.attrelid::regclass, a.attname, a.attinhcount, e.expected
   ORDER BY a.attrelid::regclass::name, a.attnum;
 
 DROP TABLE t1, s1 CASCADE;
+
+--
+-- Merge Append: ordered scans of an inheritance tree
+--
+CREATE TABLE matest0 (id int, name text);
+CREATE TABLE matest1 (id int) INHERITS (matest0);
+CREATE TABLE matest2 (id int) INHERITS (matest0);
+CREATE TABLE matest3 (id int) INHERITS (matest0);
+CREATE INDEX matest1i ON matest1 (id);
+CREATE INDEX matest2i ON matest2 (id);
+-- matest3 has no index on id, so it must be sorted explicitly
+INSERT INTO matest1 SELECT i * 3, 'one' FROM generate_series(1, 1000) i;
+INSERT INTO matest2 SELECT i * 3 + 1, 'two' FROM generate_series(1, 1000) i;
+INSERT INTO matest3 SELECT i * 3 + 2, 'three' FROM generate_series(1, 10) i;
+ANALYZE matest0;
+ANALYZE matest1;
+ANALYZE matest2;
+ANALYZE matest3;
+
+SET enable_seqscan = off;
+SET enable_bitmapscan = off;
+
+EXPLAIN (COSTS OFF)
+SELECT * FROM matest0 ORDER BY id LIMIT 10;
+SELECT * FROM matest0 ORDER BY id LIMIT 10;
+EXPLAIN (COSTS OFF)
+SELECT * FROM matest0 ORDER BY id DESC LIMIT 5;
+SELECT * FROM matest0 ORDER BY id DESC LIMIT 5;
+SELECT * FROM matest0 WHERE id BETWEEN 25 AND 35 ORDER BY id;
+
+-- the whole merged output must come out in order
+SELECT count(*) AS total,
+       sum(CASE WHEN prev > id THEN 1 ELSE 0 END) AS out_of_order
+  FROM (SELECT id, lag(id) OVER () AS prev
+          FROM (SELECT id FROM matest0 ORDER BY id) s) t;
+
+RESET enable_bitmapscan;
+RESET enable_seqscan;
+
+DROP TABLE matest0 CASCADE;
@@ -0,0 +1,101 @@
+--
+-- Memoize: caching the rows of a nestloop's inner indexscan per set of
+-- outer values
+--
+
+CREATE TABLE memo_outer (n numeric, i int);
+INSERT INTO memo_outer SELECT (i % 3)::numeric, i FROM generate_series(1, 30) i;
+-- equal to 1 as numerics, but not as text
+INSERT INTO memo_outer VALUES (1.0, 100), (1.00, 101);
+CREATE TABLE memo_inner (t text, n numeric, x int);
+INSERT INTO memo_inner SELECT i::text, i, i FROM generate_series(0, 999) i;
+INSERT INTO memo_inner VALUES ('1.0', 1.0, -1), ('1.00', 1.00, -2);
+CREATE INDEX memo_inner_t ON memo_inner (t);
+CREATE INDEX memo_inner_n ON memo_inner (n);
+ANALYZE memo_outer;
+ANALYZE memo_inner;
+
+SET enable_hashjoin = off;
+SET enable_mergejoin = off;
+SET enable_bitmapscan = off;
+
+-- keyed on the outer Var, compared as numerics like the join clause
+EXPLAIN (COSTS OFF)
+SELECT o.i, m.x FROM memo_outer o JOIN memo_inner m ON m.n = o.n;
+SELECT o.n, count(*), sum(m.x)
+  FROM memo_outer o JOIN memo_inner m ON m.n = o.n GROUP BY o.n ORDER BY 1;
+
+-- keyed on the text the inner scan is given, so 1.0 and 1.00 differ
+EXPLAIN (COSTS OFF)
+SELECT o.i, m.x FROM memo_outer o JOIN memo_inner m ON m.t = o.n::text;
+SELECT o.n, count(*), sum(m.x)
+  FROM memo_outer o JOIN memo_inner m ON m.t = o.n::text GROUP BY o.n ORDER BY 1;
+SELECT o.i, o.n, m.x
+  FROM memo_outer o JOIN memo_inner m ON m.t = o.n::text
+  WHERE o.i >= 100 ORDER BY 1;
+
+-- the same without the cache
+SET enable_memoize = off;
+EXPLAIN (COSTS OFF)
+SELECT o.i, m.x FROM memo_outer o JOIN memo_inner m ON m.t = o.n::text;
+SELECT o.n, count(*), sum(m.x)
+  FROM memo_outer o JOIN memo_inner m ON m.t = o.n::text GROUP BY o.n ORDER BY 1;
+RESET enable_memoize;
+
+-- a cache too small for all keys: the keys come round in turn, so entries
+-- are evicted before they are used again, and key 0 has more rows than
+-- fit at all, so its scans pass the rows through uncached
+CREATE TABLE memo_small_outer (k int, i int);
+INSERT INTO memo_small_outer SELECT (i / 2) % 30, i FROM generate_series(0, 299) i;
+CREATE TABLE memo_small_inner (k int, v int);
+INSERT INTO memo_small_inner SELECT i % 29 + 1, i FROM generate_series(1, 1160) i;
+INSERT INTO memo_small_inner SELECT 0, i FROM generate_series(1, 3000) i;
+CREATE INDEX memo_small_inner_k ON memo_small_inner (k);
+ANALYZE memo_small_outer;
+ANALYZE memo_small_inner;
+
+-- EXPLAIN ANALYZE's timings vary, so show just the cache statistics
+CREATE FUNCTION memo_stats(query text) RETURNS SETOF text
+LANGUAGE plpgsql AS
+$$
+DECLARE
+    ln text;
+BEGIN
+    FOR ln IN EXECUTE 'EXPLAIN (ANALYZE, COSTS OFF) ' || query LOOP
+        IF ln ~ 'Hits:' THEN
+            RETURN NEXT trim(ln);
+        END IF;
+    END LOOP;
+END;
+$$;
+
+SET work_mem = 64;
+EXPLAIN (COSTS OFF)
+SELECT count(*), sum(m.v)
+  FROM memo_small_outer o JOIN memo_small_inner m ON m.k = o.k;
+SELECT memo_stats('SELECT count(*), sum(m.v) FROM memo_small_outer o JOIN memo_small_inner m ON m.k = o.k');
+SELECT count(*), sum(m.v)
+  FROM memo_small_outer o JOIN memo_small_inner m ON m.k = o.k;
+SELECT o.k, count(*), sum(m.v)
+  FROM memo_small_outer o JOIN memo_small_inner m ON m.k = o.k
+  GROUP BY o.k ORDER BY 1 LIMIT 3;
+
+SET enable_memoize = off;
+SELECT count(*), sum(m.v)
+  FROM memo_small_outer o JOIN memo_small_inner m ON m.k = o.k;
+SELECT o.k, count(*), sum(m.v)
+  FROM memo_small_outer o JOIN memo_small_inner m ON m.k = o.k
+  GROUP BY o.k ORDER BY 1 LIMIT 3;
+RESET enable_memoize;
+RESET work_mem;
+
+DROP FUNCTION memo_stats(text);
+DROP TABLE memo_small_outer;
+DROP TABLE memo_small_inner;
+
+RESET enable_hashjoin;
+RESET enable_mergejoin;
+RESET enable_bitmapscan;
+
+DROP TABLE memo_outer;
+DROP TABLE memo_inner;
@@ -0,0 +1,154 @@
+--
+-- Partitioned tables: inheritance children whose CHECK constraints on the
+-- parent's partition_key column give their bounds
+--
+
+CREATE TABLE pmeas (logdate date, city text, val int);
+CREATE TABLE pmeas_lo (CHECK (logdate < DATE '2010-02-01'))
+  INHERITS (pmeas);
+CREATE TABLE pmeas_feb
+  (CHECK (logdate >= DATE '2010-02-01' AND logdate < DATE '2010-03-01'))
+  INHERITS (pmeas);
+-- a partition with its columns in a different order than the parent's
+CREATE TABLE pmeas_mar (val int, city text, logdate date,
+  CHECK (logdate >= DATE '2010-03-01' AND logdate < DATE '2010-04-01'));
+ALTER TABLE pmeas_mar INHERIT pmeas;
+ALTER TABLE pmeas SET (partition_key = 'logdate');
+
+CREATE FUNCTION pmeas_mar_trig() RETURNS trigger LANGUAGE plpgsql AS
+$$ BEGIN NEW.val := NEW.val * 10; RETURN NEW; END $$;
+CREATE TRIGGER pmeas_mar_trig BEFORE INSERT ON pmeas_mar
+  FOR EACH ROW EXECUTE PROCEDURE pmeas_mar_trig();
+
+-- RETURNING shows the rows as stored, in the parent's rowtype
+INSERT INTO pmeas VALUES ('2010-01-15', 'x', 1), ('2010-02-15', 'y', 2),
+  ('2010-03-15', 'z', 3), ('2009-01-01', 'w', 4) RETURNING *;
+
+-- no partition accepts these
+INSERT INTO pmeas VALUES ('2010-04-01', 'q', 5);
+INSERT INTO pmeas VALUES (NULL, 'q', 5);
+
+COPY pmeas FROM stdin;
+2010-02-20	c	6
+2010-03-20	c	7
+\.
+
+SELECT tableoid::regclass, * FROM pmeas ORDER BY logdate;
+SELECT * FROM ONLY pmeas;
+
+-- partitions whose bounds cannot match are left out of the plan
+EXPLAIN (COSTS OFF)
+SELECT * FROM pmeas WHERE logdate = DATE '2010-02-15';
+EXPLAIN (COSTS OFF)
+SELECT * FROM pmeas WHERE logdate >= DATE '2010-02-20';
+EXPLAIN (COSTS OFF)
+SELECT * FROM pmeas WHERE logdate IN (DATE '2010-01-05', DATE '2010-03-05');
+SELECT * FROM pmeas WHERE logdate >= DATE '2010-02-20' ORDER BY logdate;
+SELECT * FROM pmeas WHERE logdate IN (DATE '2010-01-15', DATE '2010-03-20')
+  ORDER BY logdate;
+
+-- run-time pruning, with values known at executor startup
+PREPARE pmeas_q(date) AS
+  SELECT * FROM pmeas WHERE logdate >= $1 ORDER BY logdate;
+EXPLAIN (COSTS OFF) EXECUTE pmeas_q('2010-02-20');
+EXECUTE pmeas_q('2010-02-20');
+EXPLAIN (COSTS OFF) EXECUTE pmeas_q('2010-01-01');
+EXECUTE pmeas_q('2010-01-01');
+DEALLOCATE pmeas_q;
+
+-- ... and with values that change on each rescan
+CREATE TABLE pmeas_probe (d date);
+INSERT INTO pmeas_probe VALUES ('2010-01-01'), ('2010-02-15'), ('2010-03-15'),
+  ('2010-05-01');
+SELECT d, (SELECT sum(val) FROM pmeas WHERE logdate <= d) AS sum_to,
+       (SELECT sum(val) FROM pmeas WHERE logdate > d) AS sum_after
+  FROM pmeas_probe ORDER BY d;
+
+-- ... and with the outer row's values, on the inner side of a nestloop
+INSERT INTO pmeas
+  SELECT DATE '2009-12-01' + i % 120, 'n', i FROM generate_series(1, 3000) i;
+CREATE INDEX pmeas_lo_logdate ON pmeas_lo (logdate);
+CREATE INDEX pmeas_feb_logdate ON pmeas_feb (logdate);
+CREATE INDEX pmeas_mar_logdate ON pmeas_mar (logdate);
+ANALYZE pmeas;
+ANALYZE pmeas_lo;
+ANALYZE pmeas_feb;
+ANALYZE pmeas_mar;
+ANALYZE pmeas_probe;
+SET enable_hashjoin = off;
+SET enable_mergejoin = off;
+
+-- show how often each partition was scanned, without the timings
+CREATE FUNCTION pmeas_loops(query text) RETURNS SETOF text
+LANGUAGE plpgsql AS
+$$
+DECLARE
+    ln text;
+BEGIN
+    FOR ln IN EXECUTE 'EXPLAIN (ANALYZE, COSTS OFF) ' || query LOOP
+        IF ln ~ ' on pmeas' THEN
+            RETURN NEXT regexp_replace(ln, 'actual time=[0-9.]+ ', 'actual ');
+        END IF;
+    END LOOP;
+END;
+$$;
+
+SELECT pmeas_loops('SELECT * FROM pmeas_probe p JOIN pmeas m ON m.logdate = p.d');
+SELECT p.d, count(*), sum(m.val)
+  FROM pmeas_probe p JOIN pmeas m ON m.logdate = p.d
+  GROUP BY p.d ORDER BY p.d;
+
+-- the same without partitioning, so without pruning
+ALTER TABLE pmeas RESET (partition_key);
+SELECT pmeas_loops('SELECT * FROM pmeas_probe p JOIN pmeas m ON m.logdate = p.d');
+SELECT p.d, count(*), sum(m.val)
+  FROM pmeas_probe p JOIN pmeas m ON m.logdate = p.d
+  GROUP BY p.d ORDER BY p.d;
+
+RESET enable_hashjoin;
+RESET enable_mergejoin;
+DROP FUNCTION pmeas_loops(text);
+DROP TABLE pmeas_probe;
+
+DROP TABLE pmeas CASCADE;
+DROP FUNCTION pmeas_mar_trig();
+
+-- bounds given with > and <=, including a single-value range that meets
+-- its neighbours at an excluded bound
+CREATE TABLE pnum (k int, v text);
+CREATE TABLE pnum_lo (CHECK (k <= 10)) INHERITS (pnum);
+CREATE TABLE pnum_mid (CHECK (k > 10 AND k < 20)) INHERITS (pnum);
+CREATE TABLE pnum_20 (CHECK (k >= 20 AND k <= 20)) INHERITS (pnum);
+CREATE TABLE pnum_hi (CHECK (k > 20)) INHERITS (pnum);
+ALTER TABLE pnum SET (partition_key = 'k');
+INSERT INTO pnum SELECT g, 'r' || g FROM generate_series(9, 22) g;
+SELECT tableoid::regclass, count(*), min(k), max(k)
+  FROM pnum GROUP BY 1 ORDER BY 3;
+EXPLAIN (COSTS OFF) SELECT * FROM pnum WHERE k = 20;
+EXPLAIN (COSTS OFF) SELECT * FROM pnum WHERE k > 10;
+EXPLAIN (COSTS OFF) SELECT * FROM pnum WHERE k >= 10;
+EXPLAIN (COSTS OFF) SELECT * FROM pnum WHERE k < 20;
+EXPLAIN (COSTS OFF) SELECT * FROM pnum WHERE k <= 20;
+EXPLAIN (COSTS OFF) SELECT * FROM pnum WHERE k > 20;
+SELECT count(*) FROM pnum WHERE k > 10 AND k <= 20;
+
+-- the cached bounds follow changes to the children
+CREATE TABLE pnum_bad (CHECK (k >= 10 AND k < 11)) INHERITS (pnum);
+INSERT INTO pnum VALUES (5, 'x');
+DROP TABLE pnum_bad;
+CREATE TABLE pnum_bad (CHECK (k <> 5)) INHERITS (pnum);
+INSERT INTO pnum VALUES (5, 'x');
+DROP TABLE pnum_bad;
+INSERT INTO pnum VALUES (5, 'x');
+ALTER TABLE pnum_hi DROP CONSTRAINT pnum_hi_k_check;
+ALTER TABLE pnum_hi ADD CHECK (k > 20 AND k <= 30);
+INSERT INTO pnum VALUES (31, 'x');
+INSERT INTO pnum VALUES (30, 'x');
+ALTER TABLE pnum_20 NO INHERIT pnum;
+INSERT INTO pnum VALUES (20, 'x');
+ALTER TABLE pnum_20 INHERIT pnum;
+INSERT INTO pnum VALUES (20, 'x');
+SELECT tableoid::regclass, count(*), min(k), max(k)
+  FROM pnum GROUP BY 1 ORDER BY 3;
+
+DROP TABLE pnum CASCADE;
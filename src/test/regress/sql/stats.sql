@@ -54,7 +54,10 @@ $$ language plpgsql;
 -- do a seqscan
 SELECT count(*) FROM tenk2;
 -- do an indexscan
+-- make sure it is not an index-only scan, which would skip the heap fetch
+SET enable_indexonlyscan TO off;
 SELECT count(*) FROM tenk2 WHERE unique1 = 1;
+RESET enable_indexonlyscan;
 
 -- force the rate-limiting logic in pgstat_report_tabstat() to time out
 -- and send a message
@@ -247,5 +247,57 @@ SELECT ntile(0) OVER (ORDER BY ten), ten, four FROM tenk1;
 
 SELECT nth_value(four, 0) OVER (ORDER BY ten), ten, four FROM tenk1;
 
+-- moving aggregates: rows leaving the frame are removed from the state
+CREATE TEMP TABLE mvagg (i int, v2 int2, v4 int4, v8 int8, vn numeric);
+INSERT INTO mvagg VALUES
+  (1, 1, 1, 1, 1.5), (2, 2, 2, 2, 2.25), (3, NULL, NULL, NULL, NULL),
+  (4, 4, 4, 4, 4), (5, 5, 5, 5, 'NaN'), (6, 6, 6, 6, 6.1),
+  (7, NULL, NULL, NULL, 7), (8, 8, 8, 8000000000, 8.000);
+
+SELECT i, sum(v4) OVER w, avg(v4) OVER w, count(v4) OVER w, count(*) OVER w,
+       sum(v2) OVER w AS sum2, avg(v2) OVER w AS avg2
+  FROM mvagg WINDOW w AS (ORDER BY i ROWS BETWEEN 1 PRECEDING AND 1 FOLLOWING);
+
+-- numeric keeps the display scale of the values still in the frame, and
+-- gets over a NaN once it has left
+SELECT i, sum(v8) OVER w, avg(v8) OVER w, sum(vn) OVER w, avg(vn) OVER w
+  FROM mvagg WINDOW w AS (ORDER BY i ROWS BETWEEN 1 PRECEDING AND 1 FOLLOWING);
+
+-- the frame shrinks to nothing at the end
+SELECT i, sum(v4) OVER w, avg(v4) OVER w, count(v4) OVER w,
+       sum(v8) OVER w AS sum8, sum(vn) OVER w AS sumn, avg(vn) OVER w AS avgn
+  FROM mvagg WINDOW w AS (ORDER BY i ROWS BETWEEN 1 FOLLOWING AND 2 FOLLOWING);
+SELECT i, sum(vn) OVER w, avg(vn) OVER w
+  FROM mvagg
+  WINDOW w AS (ORDER BY i ROWS BETWEEN CURRENT ROW AND UNBOUNDED FOLLOWING);
+
+-- compare with aggregating each frame from scratch
+CREATE TEMP TABLE mvagg2 AS
+  SELECT i,
+         CASE WHEN i % 7 = 0 THEN NULL ELSE (i * 37) % 101 - 50 END AS v4,
+         CASE WHEN i % 11 = 0 THEN NULL
+              ELSE round((i * 13) % 97 / 7.0, i % 4) END AS vn
+  FROM generate_series(1, 500) i;
+SELECT count(*) AS frames,
+       sum(CASE WHEN s4 IS DISTINCT FROM x4 OR a4 IS DISTINCT FROM y4 OR
+                     sn::text IS DISTINCT FROM xn::text OR
+                     an::text IS DISTINCT FROM yn::text
+                THEN 1 ELSE 0 END) AS mismatches
+FROM (SELECT sum(v4) OVER w AS s4, avg(v4) OVER w AS a4,
+             sum(vn) OVER w AS sn, avg(vn) OVER w AS an,
+             (SELECT sum(v4) FROM mvagg2 b
+               WHERE b.i BETWEEN a.i - 3 AND a.i) AS x4,
+             (SELECT avg(v4) FROM mvagg2 b
+               WHERE b.i BETWEEN a.i - 3 AND a.i) AS y4,
+             (SELECT sum(vn) FROM mvagg2 b
+               WHERE b.i BETWEEN a.i - 3 AND a.i) AS xn,
+             (SELECT avg(vn) FROM mvagg2 b
+               WHERE b.i BETWEEN a.i - 3 AND a.i) AS yn
+        FROM mvagg2 a
+        WINDOW w AS (ORDER BY i ROWS BETWEEN 3 PRECEDING AND CURRENT ROW)) s;
+
+DROP TABLE mvagg;
+DROP TABLE mvagg2;
+
 -- cleanup
 DROP TABLE empsalary;